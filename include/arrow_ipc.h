@@ -0,0 +1,137 @@
+#ifndef ARROW_IPC_H
+#define ARROW_IPC_H
+
+#include <stdio.h>
+#include <stddef.h>
+#include <sqlite3.h>
+#include "constants.h"
+
+/**
+ * @brief 열 자료형
+ */
+typedef enum {
+    ARROW_COLUMN_INT32 = 0,        /**< int32 */
+    ARROW_COLUMN_INT64 = 1,        /**< int64 */
+    ARROW_COLUMN_BOOL = 2,         /**< bool (0이 아니면 참) */
+    ARROW_COLUMN_UTF8 = 3,         /**< utf8 문자열 */
+    ARROW_COLUMN_TIMESTAMP = 4,    /**< timestamp[s, UTC] (int64, 'YYYY-MM-DD HH:MM:SS' 문자열에서 변환) */
+    ARROW_COLUMN_DICTIONARY = 5    /**< int32 인덱스로 사전 인코딩한 utf8 (arrow_writer_set_dictionary로 값 지정) */
+} ArrowColumnType;
+
+/**
+ * @brief 열 정의
+ */
+typedef struct {
+    const char *name;              /**< 열 이름 */
+    ArrowColumnType type;          /**< 자료형 */
+    int nullable;                  /**< NULL이 있을 수 있으면 TRUE */
+} ArrowColumnSpec;
+
+/**
+ * @brief 열 하나의 묶음 버퍼
+ */
+typedef struct {
+    ArrowColumnSpec spec;
+    unsigned char *validity;       /**< NULL 여부 비트맵 (1 = 값 있음) */
+    long long null_count;          /**< 묶음 안의 NULL 수 */
+    unsigned char *values;         /**< 고정 길이 값, bool 비트맵, 또는 utf8 int32 오프셋 */
+    char *text;                    /**< utf8 문자열 바이트 */
+    size_t text_length;
+    size_t text_capacity;
+    char **dictionary;             /**< 정렬된 사전 값 (사전 인코딩 열) */
+    int dictionary_count;
+    char *dictionary_text;         /**< 사전 값 문자열 저장 공간 */
+    int dictionary_written;        /**< 사전 묶음을 썼으면 TRUE */
+} ArrowColumn;
+
+/**
+ * @brief 파일 안의 메시지 위치 (푸터에 기록)
+ */
+typedef struct {
+    long long offset;              /**< 메시지 시작 위치 */
+    int metadata_length;           /**< 접두사와 메타데이터 길이 */
+    long long body_length;         /**< 본문 길이 */
+} ArrowBlock;
+
+/**
+ * @brief 가변 크기 바이트 버퍼 (FlatBuffers 메타데이터 작성용)
+ */
+typedef struct {
+    unsigned char *data;
+    size_t length;
+    size_t capacity;
+    int error;
+} ArrowBuffer;
+
+/**
+ * @brief Arrow IPC 파일 쓰기 상태
+ */
+typedef struct {
+    FILE *file;                    /**< 출력 파일 (앞으로만 쓰므로 표준 출력 가능) */
+    long long offset;              /**< 지금까지 쓴 바이트 수 */
+    int error;                     /**< 쓰기 실패 시 TRUE */
+    ArrowColumn *columns;
+    int column_count;
+    int batch_rows;                /**< 묶음 하나의 최대 행 수 */
+    int rows;                      /**< 현재 묶음의 행 수 */
+    long long total_rows;          /**< 쓴 전체 행 수 */
+    ArrowBlock *dictionary_blocks;
+    int dictionary_block_count;
+    ArrowBlock *batch_blocks;
+    int batch_block_count;
+    int batch_block_capacity;
+    ArrowBuffer metadata;          /**< 메시지마다 재사용하는 메타데이터 버퍼 */
+    long long *layout;             /**< 묶음마다 재사용하는 노드/버퍼 위치 배열 */
+} ArrowWriter;
+
+/**
+ * @brief Arrow IPC 파일을 시작합니다 (매직 바이트와 스키마를 씀).
+ *
+ * @param writer 쓰기 상태
+ * @param file 출력 파일 (이진 모드)
+ * @param columns 열 정의 (writer가 쓰는 동안 유지되어야 함)
+ * @param column_count 열 수
+ * @param batch_rows 묶음 하나의 행 수 (0 이하이면 ARROW_BATCH_ROWS)
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환
+ */
+int arrow_writer_open(ArrowWriter *writer, FILE *file, const ArrowColumnSpec *columns, int column_count,
+                      int batch_rows);
+
+/**
+ * @brief 사전 인코딩 열의 값을 지정하고 사전 묶음을 씁니다. 첫 행을 추가하기 전에 호출해야 합니다.
+ *
+ * @param writer 쓰기 상태
+ * @param column 열 위치
+ * @param values 중복 없이 바이트 순서로 정렬된 값 (SQLite의 ORDER BY 기본 정렬)
+ * @param count 값 수
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환
+ */
+int arrow_writer_set_dictionary(ArrowWriter *writer, int column, const char *const *values, int count);
+
+/**
+ * @brief 조회 결과의 현재 행을 추가합니다. 묶음이 차면 바로 씁니다.
+ *
+ * 열 순서는 열 정의와 같아야 합니다. 사전에 없는 값과 날짜로 읽을 수 없는 값은 NULL로 씁니다.
+ *
+ * @param writer 쓰기 상태
+ * @param stmt sqlite3_step()이 SQLITE_ROW를 반환한 문장
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환
+ */
+int arrow_writer_append_row(ArrowWriter *writer, sqlite3_stmt *stmt);
+
+/**
+ * @brief 남은 묶음과 스트림 끝 표시, 푸터를 써서 파일을 마칩니다.
+ *
+ * @param writer 쓰기 상태
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환
+ */
+int arrow_writer_finish(ArrowWriter *writer);
+
+/**
+ * @brief 쓰기 버퍼를 해제합니다 (파일은 닫지 않음).
+ *
+ * @param writer 쓰기 상태
+ */
+void arrow_writer_free(ArrowWriter *writer);
+
+#endif // ARROW_IPC_H
@@ -0,0 +1,146 @@
+#ifndef BACKUP_H
+#define BACKUP_H
+
+#include <sqlite3.h>
+#include "constants.h"
+
+/**
+ * @brief 백업 작업 상태
+ */
+typedef enum {
+    BACKUP_STATE_IDLE = 0,         /**< 시작한 적 없음 */
+    BACKUP_STATE_RUNNING = 1,      /**< 복사 중 */
+    BACKUP_STATE_DONE = 2,         /**< 완료 */
+    BACKUP_STATE_FAILED = 3,       /**< 실패 */
+    BACKUP_STATE_CANCELLED = 4     /**< 사용자가 취소 */
+} BackupState;
+
+/**
+ * @brief 온라인 백업 설정
+ */
+typedef struct {
+    int pages_per_step;            /**< 한 단계에 복사할 페이지 수 (0 이하이면 BACKUP_PAGES_PER_STEP) */
+    int sleep_ms;                  /**< 단계 사이에 쉬는 시간 (0이면 다른 스레드에 양보만 함) */
+} BackupConfig;
+
+/**
+ * @brief 백업 진행 상황
+ */
+typedef struct {
+    BackupState state;
+    int page_count;                /**< 원본 전체 페이지 수 */
+    int remaining;                 /**< 남은 페이지 수 */
+    int steps;                     /**< 실행한 단계 수 */
+    int restarts;                  /**< 다른 연결이 원본을 바꿔 처음부터 다시 복사한 횟수 */
+    long long busy_retries;        /**< 원본이 잠겨 있어 다시 시도한 횟수 */
+    double elapsed_seconds;        /**< 걸린 시간 */
+    char backup_path[MAX_PATH_LENGTH];
+} BackupProgress;
+
+/**
+ * @brief 백업 검사 결과
+ */
+typedef struct {
+    int page_size;                 /**< 체크섬 목록의 페이지 크기 */
+    int page_count;                /**< 체크섬 목록의 페이지 수 */
+    int bad_pages;                 /**< 체크섬이 다르거나 빠진(또는 남는) 페이지 수 */
+    int first_bad_page;            /**< 처음 다른 페이지 번호 (1부터, 없으면 0) */
+    int quick_check;               /**< PRAGMA quick_check 결과 (TRUE/FALSE, 실행하지 않았으면 -1) */
+    long long bytes;               /**< 읽은 바이트 수 */
+    double elapsed_seconds;        /**< 걸린 시간 */
+} BackupVerifyResult;
+
+/**
+ * @brief 단계마다 호출되는 진행 상황 콜백
+ *
+ * @param progress 현재 진행 상황
+ * @param user_data backup_database_online()에 넘긴 값
+ * @return int 계속하려면 TRUE, 취소하려면 FALSE
+ */
+typedef int (*BackupProgressCallback)(const BackupProgress *progress, void *user_data);
+
+/**
+ * @brief 기본 설정으로 초기화합니다.
+ *
+ * @param config 설정 구조체
+ */
+void backup_default_config(BackupConfig *config);
+
+/**
+ * @brief 원본을 조금씩 나누어 복사하는 온라인 백업을 만듭니다.
+ *
+ * sqlite3_backup_step()을 pages_per_step 페이지씩 호출하고 단계 사이에 잠금을 풀어 쉬므로, 롤백 저널
+ * 모드에서도 복사하는 동안 다른 연결의 쓰기가 막히지 않습니다. 같은 연결에서 쓴 내용은 백업에 바로
+ * 반영되고, 다른 연결이 원본을 바꾸면 SQLite가 처음부터 다시 복사합니다. 다시 시작할 때마다 단계 크기를
+ * 두 배로 늘려 쓰기가 잦아도 결국 끝나도록 합니다. 복사는 backup_path에 BACKUP_PARTIAL_SUFFIX를 붙인
+ * 파일에 하고 끝나면 이름을 바꾸므로, 실패하거나 취소한 백업은 남지 않습니다. 이름을 바꾸기 전에
+ * 페이지별 체크섬 목록(backup_path에 BACKUP_CHECKSUM_SUFFIX를 붙인 파일)을 함께 만듭니다.
+ *
+ * @param db 원본 데이터베이스 연결
+ * @param backup_path 백업 파일 경로 (있으면 덮어씀)
+ * @param config 설정 (NULL이면 기본값)
+ * @param callback 단계마다 호출할 콜백 (NULL 가능)
+ * @param user_data 콜백에 넘길 값
+ * @param progress 최종 진행 상황을 저장할 포인터 (NULL 가능)
+ * @return int 성공 시 SUCCESS, 실패하거나 취소하면 FAILURE 반환
+ */
+int backup_database_online(sqlite3 *db, const char *backup_path, const BackupConfig *config,
+                           BackupProgressCallback callback, void *user_data, BackupProgress *progress);
+
+/**
+ * @brief 백업을 백그라운드 스레드에서 시작합니다.
+ *
+ * 한 번에 하나의 작업만 실행할 수 있습니다. 원본 연결은 작업이 끝날 때까지 닫으면 안 됩니다.
+ *
+ * @param db 원본 데이터베이스 연결 (직렬화 모드여야 함)
+ * @param backup_path 백업 파일 경로
+ * @param config 설정 (NULL이면 기본값)
+ * @return int 시작하면 SUCCESS, 이미 실행 중이거나 스레드를 만들 수 없으면 FAILURE 반환
+ */
+int backup_job_start(sqlite3 *db, const char *backup_path, const BackupConfig *config);
+
+/**
+ * @brief 백그라운드 작업의 현재(또는 마지막) 진행 상황을 가져옵니다.
+ *
+ * @param progress 진행 상황을 저장할 포인터
+ */
+void backup_job_get_progress(BackupProgress *progress);
+
+/**
+ * @brief 백그라운드 작업에 취소를 요청합니다 (다음 단계에서 멈춤).
+ */
+void backup_job_cancel(void);
+
+/**
+ * @brief 백그라운드 작업이 끝날 때까지 기다립니다.
+ *
+ * @param progress 최종 진행 상황을 저장할 포인터 (NULL 가능)
+ * @return int 백업이 완료되었으면 SUCCESS, 실패/취소했거나 작업이 없으면 FAILURE 반환
+ */
+int backup_job_wait(BackupProgress *progress);
+
+/**
+ * @brief 백업 파일의 페이지별 CRC32C 목록을 만듭니다.
+ *
+ * 백업 파일 옆에 BACKUP_CHECKSUM_SUFFIX를 붙인 텍스트 파일로 저장합니다. 백업을 만든 직후,
+ * 아무도 그 파일에 쓰지 않을 때 호출해야 합니다.
+ *
+ * @param backup_path 백업 파일 경로
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환
+ */
+int backup_write_checksums(const char *backup_path);
+
+/**
+ * @brief 백업 파일을 체크섬 목록과 비교해 검사합니다.
+ *
+ * 파일을 큰 단위로 순서대로 읽으며 페이지마다 CRC32C를 계산하므로 디스크 읽기 속도로 끝납니다.
+ * quick_check가 TRUE이면 이어서 사본을 읽기 전용으로 열어 PRAGMA quick_check도 실행합니다.
+ *
+ * @param backup_path 백업 파일 경로
+ * @param quick_check PRAGMA quick_check도 실행하려면 TRUE
+ * @param result 결과를 저장할 포인터 (NULL 가능)
+ * @return int 모든 페이지가 일치하고 quick_check를 통과하면 SUCCESS, 아니면 FAILURE 반환
+ */
+int backup_verify(const char *backup_path, int quick_check, BackupVerifyResult *result);
+
+#endif // BACKUP_H
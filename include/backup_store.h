@@ -0,0 +1,125 @@
+#ifndef BACKUP_STORE_H
+#define BACKUP_STORE_H
+
+#include <stddef.h>
+#include <sqlite3.h>
+#include "constants.h"
+
+/**
+ * @brief 목록에 적힌 조각 하나
+ */
+typedef struct {
+    unsigned char hash[BACKUP_STORE_HASH_SIZE];    /**< 조각 내용의 해시 (저장소 안의 파일 이름) */
+    int length;                                    /**< 조각 길이 (마지막 조각만 짧을 수 있음) */
+} BackupChunkRef;
+
+/**
+ * @brief 백업 하나의 목록 (manifests/<이름>.manifest)
+ */
+typedef struct {
+    char name[BACKUP_STORE_NAME_LENGTH];
+    char created_at[20];           /**< 'YYYY-MM-DD HH:MM:SS' (UTC) */
+    int page_size;                 /**< 원본 데이터베이스 페이지 크기 */
+    int chunk_size;                /**< 조각 크기 (페이지 크기의 배수) */
+    long long file_size;           /**< 원본 파일 크기 */
+    BackupChunkRef *chunks;
+    int chunk_count;
+} BackupManifest;
+
+/**
+ * @brief 저장소 작업 결과
+ */
+typedef struct {
+    long long chunks;              /**< 처리한 조각 수 */
+    long long new_chunks;          /**< 새로 저장한(가비지 수집은 지운) 조각 수 */
+    long long bytes;               /**< 처리한 바이트 수 */
+    long long new_bytes;           /**< 새로 저장한(가비지 수집은 지운) 바이트 수 */
+    double elapsed_seconds;
+} BackupStoreStats;
+
+/**
+ * @brief 128비트 MurmurHash3 (x64, 시드 0)를 계산합니다.
+ *
+ * @param data 데이터
+ * @param length 길이
+ * @param hash 결과 (BACKUP_STORE_HASH_SIZE 바이트, 앞 8바이트가 h1의 리틀 엔디언)
+ */
+void backup_store_hash(const void *data, size_t length, unsigned char *hash);
+
+/**
+ * @brief 데이터베이스를 저장소에 백업합니다.
+ *
+ * 별도의 읽기 전용 연결로 공유 잠금을 잡은 채 데이터베이스 파일을 조각 단위로 읽어 해시하고,
+ * 저장소에 없는 조각만 chunks/<해시 앞 2자리>/<해시>로 씁니다. 하루에 몇 페이지만 바뀌었다면
+ * 바뀐 페이지가 든 조각만 새로 저장하므로, 전체를 읽는 시간 외에는 바뀐 양만큼만 쓰고 공간을 차지합니다.
+ * 파일을 그대로 읽으므로 롤백 저널 모드만 지원합니다 (WAL이면 실패).
+ *
+ * @param db 원본 데이터베이스 연결 (파일 경로를 얻는 데 씀)
+ * @param repository 저장소 디렉터리 (없으면 만듦)
+ * @param name 백업 이름 (NULL이거나 비어 있으면 현재 시각 'YYYYMMDD_HHMMSS')
+ * @param stats 결과를 저장할 포인터 (NULL 가능)
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환
+ */
+int backup_store_create(sqlite3 *db, const char *repository, const char *name, BackupStoreStats *stats);
+
+/**
+ * @brief 백업 목록을 읽습니다.
+ *
+ * @param repository 저장소 디렉터리
+ * @param name 백업 이름
+ * @param manifest 목록을 저장할 구조체 (backup_manifest_free로 해제)
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환
+ */
+int backup_manifest_load(const char *repository, const char *name, BackupManifest *manifest);
+
+/**
+ * @brief 목록의 메모리를 해제합니다.
+ *
+ * @param manifest 목록
+ */
+void backup_manifest_free(BackupManifest *manifest);
+
+/**
+ * @brief 저장소의 백업 이름을 오래된 것부터 가져옵니다.
+ *
+ * @param repository 저장소 디렉터리
+ * @param names 이름 배열을 받을 포인터 (각 이름과 배열을 free로 해제)
+ * @param count 이름 수를 받을 포인터
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환
+ */
+int backup_store_list(const char *repository, char ***names, int *count);
+
+/**
+ * @brief 목록의 조각을 이어 붙여 데이터베이스 파일을 만듭니다.
+ *
+ * 조각마다 해시를 다시 계산해 목록과 다르면 실패합니다. 만든 파일은 database_restore()로
+ * 현재 데이터베이스에 불러올 수 있습니다.
+ *
+ * @param repository 저장소 디렉터리
+ * @param name 백업 이름
+ * @param output_path 만들 파일 경로 (있으면 덮어씀)
+ * @param stats 결과를 저장할 포인터 (NULL 가능)
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환
+ */
+int backup_store_restore(const char *repository, const char *name, const char *output_path,
+                         BackupStoreStats *stats);
+
+/**
+ * @brief 백업 목록을 지웁니다 (조각은 backup_store_gc로 정리).
+ *
+ * @param repository 저장소 디렉터리
+ * @param name 백업 이름
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환
+ */
+int backup_store_delete(const char *repository, const char *name);
+
+/**
+ * @brief 어느 목록에서도 쓰지 않는 조각을 지웁니다.
+ *
+ * @param repository 저장소 디렉터리
+ * @param stats 남긴 조각 수를 chunks에, 지운 조각 수와 바이트 수를 new_chunks/new_bytes에 저장할 포인터 (NULL 가능)
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환
+ */
+int backup_store_gc(const char *repository, BackupStoreStats *stats);
+
+#endif // BACKUP_STORE_H
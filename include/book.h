@@ -37,8 +37,10 @@ int get_book_by_isbn(sqlite3 *db, const char *isbn, Book *book);
 /**
  * @brief 제목으로 도서를 검색합니다.
  * 
+ * 검색어가 BOOK_SEARCH_INDEX_MIN_CHARS 글자 이상이고 검색 색인이 있으면 색인으로 후보를 좁힙니다.
+ * 
  * @param db 데이터베이스 연결 포인터
- * @param title 검색할 제목 (부분 검색 가능)
+ * @param title 검색할 제목 또는 초성 (부분 검색 가능, 공백/대소문자 무시)
  * @param result 검색 결과를 저장할 포인터
  * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환
  */
@@ -47,8 +49,10 @@ int search_books_by_title(sqlite3 *db, const char *title, BookSearchResult *resu
 /**
  * @brief 저자로 도서를 검색합니다.
  * 
+ * 검색어가 BOOK_SEARCH_INDEX_MIN_CHARS 글자 이상이고 검색 색인이 있으면 색인으로 후보를 좁힙니다.
+ * 
  * @param db 데이터베이스 연결 포인터
- * @param author 검색할 저자 (부분 검색 가능)
+ * @param author 검색할 저자 또는 초성 (부분 검색 가능, 공백/대소문자 무시)
  * @param result 검색 결과를 저장할 포인터
  * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환
  */
@@ -0,0 +1,77 @@
+#ifndef BOOK_IMPORT_H
+#define BOOK_IMPORT_H
+
+#include <sqlite3.h>
+#include "constants.h"
+
+/**
+ * @brief 가져올 파일 형식
+ */
+typedef enum {
+    BOOK_IMPORT_AUTO = 0,      /**< 확장자로 판단 (.tsv/.tab이면 TSV, .mrc/.marc이면 MARC, 그 외 CSV) */
+    BOOK_IMPORT_CSV = 1,       /**< 쉼표 구분, 큰따옴표로 감싼 필드 허용 (RFC 4180) */
+    BOOK_IMPORT_TSV = 2,       /**< 탭 구분, 따옴표 처리 없음 */
+    BOOK_IMPORT_MARC = 3       /**< MARC21 (ISO 2709) 서지 레코드 */
+} BookImportFormat;
+
+/**
+ * @brief 도서 일괄 가져오기 설정
+ */
+typedef struct {
+    BookImportFormat format;   /**< 파일 형식 */
+    int worker_threads;        /**< 파싱/검증 스레드 수 (0이면 CPU 수) */
+    int batch_rows;            /**< 스레드에 한 번에 넘기는 행 수 */
+    int commit_rows;           /**< 한 트랜잭션에 넣는 행 수 */
+    int resume;                /**< TRUE면 같은 파일의 마지막 체크포인트부터 이어서 가져옴 */
+    int show_progress;         /**< TRUE면 커밋할 때마다 진행 막대 출력 */
+    char reject_path[MAX_PATH_LENGTH];   /**< 거부된 행을 기록할 파일 (비어 있으면 기록 안 함) */
+} BookImportConfig;
+
+/**
+ * @brief 도서 일괄 가져오기 결과
+ */
+typedef struct {
+    long long rows;            /**< 이번에 읽은 데이터 행 수 (머리글 제외, MARC는 레코드 수) */
+    long long imported;        /**< 추가한 도서 수 */
+    long long rejected;        /**< 형식/검증 오류로 거부한 행 수 */
+    long long duplicates;      /**< 기존 도서나 앞 행과 ISBN이 겹쳐 거부한 행 수 */
+    long long resumed_lines;   /**< 체크포인트 덕분에 건너뛴 줄 수 (MARC는 레코드 수) */
+    double elapsed_seconds;    /**< 걸린 시간 */
+} BookImportStats;
+
+/**
+ * @brief 기본 설정으로 초기화합니다.
+ *
+ * @param config 설정 구조체
+ */
+void book_import_default_config(BookImportConfig *config);
+
+/**
+ * @brief CSV/TSV/MARC21 파일의 도서를 한꺼번에 추가합니다.
+ *
+ * 첫 줄은 머리글이며 title, author, isbn, publisher, publication_year, total_copies,
+ * available_copies, category 열(한국어 이름도 가능)을 순서와 관계없이 찾습니다. 제목과 저자는 필수이고
+ * 모르는 열은 무시합니다. 보유 권수가 없으면 1권, 대출 가능 권수가 없으면 보유 권수로 넣습니다.
+ *
+ * 읽기 스레드가 행을 묶어 넘기면 여러 스레드가 파싱과 검증(validate_book, is_valid_isbn)을 하고,
+ * 호출한 스레드 하나가 파일 순서대로 재사용하는 INSERT 문으로 commit_rows 행씩 트랜잭션에 넣습니다.
+ * ISBN은 ISBN-13으로 바꿔 메모리 해시 집합으로 기존 도서 및 앞 행과의 중복을 찾습니다.
+ * 거부된 행은 원래 형식 그대로 source_line, reject_reason 열을 덧붙여 reject_path에 기록하므로
+ * 고친 뒤 같은 방법으로 다시 가져올 수 있습니다.
+ *
+ * MARC 파일은 메모리에 매핑해 레코드를 복사하지 않고 읽으며 marc_record_to_book()으로 바꾼 뒤
+ * 같은 검증을 거칩니다. 거부된 레코드는 원래 필드에 999$a(사유) $n(레코드 번호)을 덧붙인 MARC로 기록하고,
+ * 디렉터리가 손상된 레코드는 원문 그대로 기록합니다.
+ *
+ * 커밋할 때마다 같은 트랜잭션에서 book_import_checkpoints 테이블에 읽은 위치를 기록하므로,
+ * 중간에 멈춘 가져오기는 resume을 켜고 같은 경로로 다시 실행하면 커밋된 곳 다음부터 이어집니다.
+ *
+ * @param db 데이터베이스 연결 (가져오는 동안 호출한 스레드에서만 사용)
+ * @param path 가져올 파일 경로
+ * @param config 설정 (NULL이면 기본 설정)
+ * @param stats 결과를 저장할 구조체 (NULL 가능)
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환 (실패해도 이미 커밋된 행은 남음)
+ */
+int book_import_file(sqlite3 *db, const char *path, const BookImportConfig *config, BookImportStats *stats);
+
+#endif // BOOK_IMPORT_H
@@ -0,0 +1,98 @@
+#ifndef CALENDAR_H
+#define CALENDAR_H
+
+#include <sqlite3.h>
+#include <time.h>
+#include "types.h"
+#include "constants.h"
+
+/**
+ * @brief 연도별 휴관일 비트맵 달력
+ *
+ * closed_days[i]는 (first_year + i)년의 휴관일을 1년 366비트로 표현합니다.
+ * 비트 위치는 해당 연도의 0부터 시작하는 일 번호(tm_yday)입니다.
+ */
+typedef struct {
+    int first_year;                                                  /**< 첫 번째 연도 */
+    int year_count;                                                  /**< 적재된 연도 수 */
+    unsigned char closed_days[CALENDAR_MAX_YEARS][CALENDAR_BITMAP_BYTES]; /**< 연도별 휴관일 비트맵 */
+} ClosureCalendar;
+
+/**
+ * @brief 휴관일을 등록합니다.
+ *
+ * @param db 데이터베이스 연결 포인터
+ * @param closure_date 휴관일 ('YYYY-MM-DD' 형식)
+ * @param reason 휴관 사유 (NULL 가능)
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환
+ */
+int add_library_closure(sqlite3 *db, const char *closure_date, const char *reason);
+
+/**
+ * @brief 기간 내의 모든 날짜를 휴관일로 등록합니다.
+ *
+ * @param db 데이터베이스 연결 포인터
+ * @param range 휴관 기간 (시작일과 종료일 모두 포함)
+ * @param reason 휴관 사유 (NULL 가능)
+ * @return int 등록된 일수, 실패 시 FAILURE 반환
+ */
+int add_library_closure_range(sqlite3 *db, const DateRange *range, const char *reason);
+
+/**
+ * @brief 휴관일 등록을 취소합니다.
+ *
+ * @param db 데이터베이스 연결 포인터
+ * @param closure_date 취소할 휴관일 ('YYYY-MM-DD' 형식)
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환
+ */
+int remove_library_closure(sqlite3 *db, const char *closure_date);
+
+/**
+ * @brief 휴관일 테이블을 연도별 비트맵으로 적재합니다.
+ *
+ * @param db 데이터베이스 연결 포인터
+ * @param first_year 적재할 첫 연도
+ * @param year_count 적재할 연도 수 (최대 CALENDAR_MAX_YEARS)
+ * @param calendar 적재 결과를 저장할 달력 포인터
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환
+ */
+int calendar_load(sqlite3 *db, int first_year, int year_count, ClosureCalendar *calendar);
+
+/**
+ * @brief 해당 날짜가 휴관일인지 확인합니다.
+ *
+ * 달력에 적재되지 않은 연도는 개관일로 간주합니다.
+ *
+ * @param calendar 휴관일 달력
+ * @param date 확인할 날짜 (현지 시각 기준)
+ * @return int 휴관일이면 TRUE, 아니면 FALSE 반환
+ */
+int calendar_is_closed(const ClosureCalendar *calendar, time_t date);
+
+/**
+ * @brief 해당 날짜부터 시작하여 가장 가까운 개관일을 찾습니다.
+ *
+ * @param calendar 휴관일 달력
+ * @param date 기준 날짜
+ * @return time_t 개관일이 될 때까지 하루씩 미룬 시각 (시각 성분은 유지)
+ */
+time_t calendar_next_open_day(const ClosureCalendar *calendar, time_t date);
+
+/**
+ * @brief 휴관일을 건너뛰어 반납 예정일을 계산합니다.
+ *
+ * 연결별로 캐시된 비트맵 달력을 사용하므로 대출 시마다 테이블을 조회하지 않습니다.
+ *
+ * @param db 데이터베이스 연결 포인터
+ * @param loan_time 대출 시각
+ * @param loan_days 대출 기간 (일수)
+ * @return time_t 반납 예정 시각
+ */
+time_t calendar_compute_due_date(sqlite3 *db, time_t loan_time, int loan_days);
+
+/**
+ * @brief 캐시된 휴관일 달력을 무효화합니다.
+ */
+void calendar_invalidate_cache(void);
+
+#endif // CALENDAR_H
@@ -0,0 +1,173 @@
+#ifndef CHANGE_LOG_H
+#define CHANGE_LOG_H
+
+#include <sqlite3.h>
+#include "constants.h"
+
+/**
+ * @brief change_log.operation 값
+ */
+typedef enum {
+    CHANGE_LOG_INSERT = 1,
+    CHANGE_LOG_UPDATE = 2,
+    CHANGE_LOG_DELETE = 3
+} ChangeLogOperation;
+
+/**
+ * @brief 변경 기록 상태
+ */
+typedef struct {
+    int enabled;                   /**< 트리거가 설치되어 기록 중이면 TRUE */
+    char epoch[17];                /**< 기록을 켤 때마다 새로 정하는 값 (백업과 현재 기록이 이어지는지 확인) */
+    char enabled_at[20];           /**< 마지막으로 켠 시각 (UTC) */
+    long long entries;             /**< 남아 있는 변경 수 */
+    long long first_seq;           /**< 가장 오래된 변경 번호 (없으면 0) */
+    long long last_seq;            /**< 가장 최근 변경 번호 (없으면 0) */
+    char first_time[20];           /**< 가장 오래된 변경 시각 (UTC) */
+    char last_time[20];            /**< 가장 최근 변경 시각 (UTC) */
+} ChangeLogStatus;
+
+/**
+ * @brief 테이블별로 적용한(할) 변경 수
+ */
+typedef struct {
+    char table_name[CHANGE_LOG_NAME_LENGTH];
+    long long inserts;
+    long long updates;
+    long long deletes;
+} ChangeLogTableCount;
+
+/**
+ * @brief 시점 복구 설정
+ */
+typedef struct {
+    int dry_run;                   /**< TRUE이면 아무것도 바꾸지 않고 적용할 변경 수만 보고 */
+    int batch_rows;                /**< 한 트랜잭션에 적용할 변경 수 (0 이하이면 CHANGE_LOG_BATCH_ROWS) */
+    const char *output_path;       /**< NULL이면 현재 데이터베이스에 복원, 아니면 이 파일로만 만듦 */
+} ChangeLogRecoverOptions;
+
+/**
+ * @brief 시점 복구 결과
+ */
+typedef struct {
+    long long backup_seq;          /**< 백업에 들어 있는 마지막 변경 번호 */
+    char backup_time[20];          /**< 백업에 들어 있는 마지막 변경 시각 (UTC) */
+    long long last_seq;            /**< 적용한(할) 마지막 변경 번호 (없으면 backup_seq) */
+    char last_time[20];            /**< 적용한(할) 마지막 변경 시각 (없으면 backup_time) */
+    long long applied;             /**< 적용한(할) 변경 수 */
+    long long skipped;             /**< 목표 시각 이후라 버리는 변경 수 */
+    int batches;                   /**< 적용한 트랜잭션 수 */
+    int table_count;
+    ChangeLogTableCount tables[CHANGE_LOG_MAX_TABLES];
+    double elapsed_seconds;
+} ChangeLogRecoverReport;
+
+/**
+ * @brief 변경 기록을 켭니다.
+ *
+ * change_log와 change_log_state 테이블을 만들고, 나머지 모든 테이블에 AFTER INSERT/UPDATE/DELETE
+ * 트리거를 설치합니다. 트리거는 변경마다 change_log에 순서 번호, 시각(UTC), 테이블, 행의 키와
+ * 새 행 전체를 JSON으로 한 행씩 추가합니다. 쓰기마다 한 행이 더 쓰이므로 쓰기 비용이 늘고,
+ * 기록은 change_log_prune()으로 지우기 전까지 데이터베이스(와 백업)에 남습니다.
+ * 이미 켜져 있으면 트리거만 현재 스키마에 맞춥니다.
+ *
+ * @param db 데이터베이스 연결
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환
+ */
+int change_log_enable(sqlite3 *db);
+
+/**
+ * @brief 변경 기록을 끕니다 (트리거만 지우고 기록은 남김).
+ *
+ * 다시 켜면 그 사이의 변경이 빠지므로 새 에포크가 시작되고, 끄기 전에 만든 백업에서는 시점 복구를
+ * 할 수 없습니다.
+ *
+ * @param db 데이터베이스 연결
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환
+ */
+int change_log_disable(sqlite3 *db);
+
+/**
+ * @brief 변경 기록이 켜져 있는지 확인합니다.
+ *
+ * @param db 데이터베이스 연결
+ * @return int 켜져 있으면 TRUE, 아니면 FALSE, 실패 시 FAILURE 반환
+ */
+int change_log_is_enabled(sqlite3 *db);
+
+/**
+ * @brief 변경 기록이 켜져 있으면 트리거를 현재 테이블과 컬럼에 맞춥니다.
+ *
+ * 스키마가 그대로이면 아무것도 쓰지 않습니다. database_create_tables()가 마지막에 호출합니다.
+ *
+ * @param db 데이터베이스 연결
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환
+ */
+int change_log_refresh_triggers(sqlite3 *db);
+
+/**
+ * @brief 변경 기록 상태를 가져옵니다.
+ *
+ * @param db 데이터베이스 연결
+ * @param status 상태를 저장할 포인터
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환
+ */
+int change_log_get_status(sqlite3 *db, ChangeLogStatus *status);
+
+/**
+ * @brief 지정한 시각보다 오래된 변경을 지웁니다.
+ *
+ * 가장 오래 보관하는 백업보다 이전의 변경만 지워야 그 백업에서 시점 복구를 할 수 있습니다.
+ *
+ * @param db 데이터베이스 연결
+ * @param before_time 'YYYY-MM-DD HH:MM:SS' (UTC), 이 시각 전의 변경을 지움
+ * @param deleted 지운 변경 수를 저장할 포인터 (NULL 가능)
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환
+ */
+int change_log_prune(sqlite3 *db, const char *before_time, long long *deleted);
+
+/**
+ * @brief 디렉터리에서 목표 시각에 가장 가까운 백업을 찾습니다.
+ *
+ * directory의 .db 파일 중 현재 데이터베이스와 같은 에포크의 변경 기록을 가지고 마지막 변경이 target_time
+ * 이전인 백업 가운데 가장 최근 것을 고릅니다. 적용할 변경이 가장 적은 백업입니다.
+ *
+ * @param db 현재 데이터베이스 연결
+ * @param directory 백업 디렉터리
+ * @param target_time 'YYYY-MM-DD HH:MM:SS' (UTC)
+ * @param backup_path 찾은 백업 경로를 저장할 버퍼
+ * @param path_size 버퍼 크기
+ * @return int 찾으면 SUCCESS, 없거나 실패 시 FAILURE 반환
+ */
+int change_log_find_backup(sqlite3 *db, const char *directory, const char *target_time,
+                           char *backup_path, size_t path_size);
+
+/**
+ * @brief 시점 복구 기본 설정으로 초기화합니다.
+ *
+ * @param options 설정 구조체
+ */
+void change_log_default_options(ChangeLogRecoverOptions *options);
+
+/**
+ * @brief 백업과 변경 기록으로 데이터베이스를 지정한 시각의 상태로 되돌립니다.
+ *
+ * 백업을 작업용 사본(CHANGE_LOG_WORK_SUFFIX)으로 복사하고, 현재 데이터베이스의 change_log에서 백업에
+ * 들어 있는 마지막 변경 다음부터 target_time 이하인 변경을 순서대로 batch_rows개씩 한 트랜잭션으로
+ * 적용합니다. 목표 시각을 넘는 첫 변경에서 멈추므로 결과는 항상 기록의 앞부분까지 적용한 상태입니다.
+ * 백업에 체크섬 목록이 있으면 먼저 검사합니다. output_path가 없으면 완성된 사본을 database_restore()로
+ * 현재 데이터베이스에 불러오며, 목표 시각 이후의 변경은 기록에서도 사라집니다.
+ * 백업과 현재 데이터베이스가 같은 에포크여야 하고, 그 사이의 기록이 지워지지 않았어야 합니다.
+ * 백업 이후의 스키마 변경은 재현하지 않습니다.
+ *
+ * @param db 현재 데이터베이스 연결 (변경 기록을 읽고, 복원 대상이 됨)
+ * @param backup_path 목표 시각 이전에 만든 백업 파일
+ * @param target_time 'YYYY-MM-DD HH:MM:SS' (UTC), 이 시각까지의 변경을 적용
+ * @param options 설정 (NULL이면 기본값)
+ * @param report 결과를 저장할 포인터 (NULL 가능)
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환
+ */
+int change_log_recover(sqlite3 *db, const char *backup_path, const char *target_time,
+                       const ChangeLogRecoverOptions *options, ChangeLogRecoverReport *report);
+
+#endif // CHANGE_LOG_H
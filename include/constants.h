@@ -4,6 +4,9 @@
 /* 데이터베이스 관련 상수 */
 #define DATABASE_PATH "database/library.db"
 #define MAX_SQL_LENGTH 2048
+#define DATABASE_BUSY_MAX_RETRIES 12       /* 잠금 대기 최대 재시도 횟수 */
+#define DATABASE_BUSY_BASE_DELAY_MS 2      /* 첫 재시도 대기 시간 (이후 2배씩 증가) */
+#define DATABASE_BUSY_MAX_DELAY_MS 250     /* 재시도 1회당 최대 대기 시간 */
 
 /* 문자열 최대 길이 */
 #define MAX_TITLE_LENGTH 255
@@ -22,10 +25,108 @@
 #define DEFAULT_LOAN_DAYS 14
 #define MAX_RENEWAL_COUNT 2
 #define MAX_BOOKS_PER_MEMBER 5
+#define REQUEST_DEDUPE_TTL_SECONDS (24 * 60 * 60)  /* 요청 ID 중복 확인 유효 기간 */
+
+/* 연체료 관련 상수 (단위: 원) */
+#define DEFAULT_DAILY_FINE 100
+#define DEFAULT_MAX_FINE 10000
+
+/* 휴관일 달력 관련 상수 */
+#define CALENDAR_MAX_YEARS 4
+#define CALENDAR_BITMAP_BYTES 46   /* 366일을 비트로 표현 */
 
 /* 검색 결과 관련 상수 */
 #define INITIAL_SEARCH_CAPACITY 10
 #define MAX_SEARCH_RESULTS 1000
+#define PHONE_BACKFILL_BATCH_SIZE 1000   /* 전화번호 검색 컬럼 보충 시 한 트랜잭션당 처리 건수 */
+#define BOOK_SEARCH_INDEX_MIN_CHARS 3    /* 도서 검색 색인(trigram)을 쓰는 최소 검색어 글자 수 (자모 단위) */
+
+/* 로깅 관련 상수 */
+#define LOGGER_RING_CAPACITY 1024        /* 스레드별 링 버퍼 칸 수 (2의 거듭제곱) */
+#define LOGGER_MESSAGE_LENGTH 240        /* 로그 메시지 최대 길이 (넘으면 잘림) */
+#define LOGGER_FLUSH_INTERVAL_MS 20      /* 기록 스레드가 버퍼를 비우는 주기 */
+#define LOGGER_BATCH_BUFFER_SIZE 65536   /* 한 번에 파일에 쓰는 최대 크기 */
+#define LOGGER_DEFAULT_MAX_BYTES (10 * 1024 * 1024)  /* 로그 파일 교체 크기 */
+#define LOGGER_DEFAULT_MAX_ARCHIVES 14   /* 보관할 교체 파일 수 */
+#define SYSTEM_LOG_TAIL_LINES 20         /* 시스템 로그 화면에 보여줄 줄 수 */
+
+// 지연 시간 히스토그램 설정
+#define METRICS_SUB_BUCKET_BITS 4        /* 2의 거듭제곱 구간마다 2^4 = 16개로 나눔 (상대 오차 1/16 이내) */
+#define METRICS_MAX_EXPONENT 44          /* 기록할 최대 값 2^45ns (약 9.8시간, 넘으면 마지막 칸) */
+#define METRICS_EXPORT_INTERVAL_SECONDS 15   /* 지표 파일 갱신 주기 기본값 */
+#define METRICS_EXPORTER_POLL_MS 200     /* 내보내기 스레드가 종료 요청을 확인하는 간격 */
+#define METRICS_SOCKET_READ_TIMEOUT_MS 100   /* 소켓 연결에서 HTTP 요청을 기다리는 시간 */
+
+// SQL 프로파일러 설정
+#define QUERY_PROFILER_SQL_LENGTH 512    /* 정규화한 SQL 최대 길이 (넘으면 잘림) */
+#define QUERY_PROFILER_MAX_STATEMENTS 256    /* 통계를 모을 서로 다른 SQL 수 (넘으면 "(기타)"로 합침) */
+#define QUERY_PROFILER_SLOW_THRESHOLD_MS 100 /* 느린 쿼리 기준 기본값 */
+#define QUERY_PROFILER_REPORT_TOP 10     /* 보고서에 보여줄 문장 수 */
+
+// 합성 데이터 생성기 기본값
+#define DATASET_DEFAULT_BOOKS 10000      /* 생성할 도서 수 */
+#define DATASET_MEMBERS_PER_BOOK_RATIO 10    /* 도서 수 / 이 값 = 기본 회원 수 */
+#define DATASET_LOANS_PER_BOOK 10        /* 도서 수 x 이 값 = 기본 대출 기록 수 */
+#define DATASET_DEFAULT_YEARS 3          /* 대출 이력 기간 (년) */
+#define DATASET_DEFAULT_ZIPF_EXPONENT 1.0    /* 도서 인기도 치우침 (클수록 소수 도서에 대출 집중) */
+#define DATASET_DEFAULT_OVERDUE_PERCENT 6    /* 반납 예정일을 넘겨 반납하는 대출 비율 (%) */
+
+// 작업 기록(트레이스) 설정
+#define WORKLOAD_TRACE_VERSION 1         /* 트레이스 파일 형식 버전 */
+#define WORKLOAD_TRACE_MAX_ARGS 12       /* 호출 하나에 기록하는 인자 수 최대값 */
+#define WORKLOAD_TRACE_RECORD_SIZE 2048  /* 호출 하나의 기록 최대 크기 (넘으면 기록하지 않음) */
+#define WORKLOAD_TRACE_BUFFER_SIZE 65536 /* 트레이스 파일 쓰기 버퍼 크기 */
+#define WORKLOAD_TRACE_SNAPSHOT_SUFFIX ".db" /* 기록 시작 시점 데이터베이스 사본 파일 접미사 */
+
+// 도서 일괄 가져오기 설정
+#define BOOK_IMPORT_BATCH_ROWS 1000      /* 파싱 스레드에 한 번에 넘기는 행 수 */
+#define BOOK_IMPORT_QUEUE_BATCHES 8      /* 단계 사이 대기열에 쌓아 둘 수 있는 묶음 수 */
+#define BOOK_IMPORT_COMMIT_ROWS 50000    /* 한 트랜잭션에 넣는 행 수 (커밋마다 체크포인트 기록) */
+#define BOOK_IMPORT_MAX_WORKERS 16       /* 파싱/검증 스레드 수 최대값 */
+#define BOOK_IMPORT_MAX_RECORD_LENGTH 16384  /* 행 하나의 최대 길이 (넘으면 거부) */
+#define BOOK_IMPORT_PROGRESS_WIDTH 40    /* 진행 막대 너비 */
+
+// MARC21 (ISO 2709) 설정
+#define MARC_LEADER_LENGTH 24            /* 리더 길이 */
+#define MARC_MAX_RECORD_LENGTH 99999     /* 리더의 레코드 길이 자리수(5자리)로 표현할 수 있는 최대 길이 */
+#define MARC_WRITE_BUFFER_SIZE 262144    /* 내보내기 파일 쓰기 버퍼 크기 */
+
+// 데이터 내보내기(CSV/NDJSON) 설정
+#define DATA_EXPORT_BUFFER_SIZE 1048576  /* 출력 버퍼 크기 (가득 차면 한 번에 씀) */
+#define DATA_EXPORT_DATE_LENGTH 11       /* 기간 필터 날짜 'YYYY-MM-DD' + NUL */
+#define ARROW_BATCH_ROWS 65536           /* Arrow 레코드 묶음 하나의 행 수 */
+#define ARROW_BUFFER_ALIGNMENT 8         /* Arrow 본문 버퍼 정렬 단위 */
+
+// 온라인 백업 설정
+#define BACKUP_PAGES_PER_STEP 256        /* 한 단계에 복사할 페이지 수 기본값 (4KB 페이지면 1MB) */
+#define BACKUP_STEP_SLEEP_MS 5           /* 단계 사이에 쉬는 시간 기본값 (그동안 다른 연결이 쓸 수 있음) */
+#define BACKUP_BUSY_SLEEP_MS 50          /* 원본이 잠겨 있을 때 다시 시도하기 전에 기다리는 시간 */
+#define BACKUP_MAX_BUSY_RETRIES 1200     /* 잠금으로 연속 실패할 수 있는 횟수 (약 1분, 넘으면 실패) */
+#define BACKUP_PARTIAL_SUFFIX ".partial" /* 복사 중인 백업 파일 접미사 (끝나면 이름을 바꿈) */
+#define BACKUP_PROGRESS_WIDTH 40         /* 진행 막대 너비 */
+
+// 중복 제거 백업 저장소 설정
+#define BACKUP_STORE_CHUNK_SIZE 65536    /* 조각 크기 (페이지 크기의 배수로 맞춤, 페이지가 더 크면 페이지 하나) */
+#define BACKUP_STORE_HASH_SIZE 16        /* 조각 해시 길이 (MurmurHash3 x64 128비트) */
+#define BACKUP_STORE_VERSION 1           /* 목록(manifest) 파일 형식 버전 */
+#define BACKUP_STORE_NAME_LENGTH 64      /* 백업 이름 최대 길이 */
+#define BACKUP_STORE_DEFAULT_PATH "./backups/store"  /* 저장소 기본 위치 */
+
+// 백업 무결성 검사 설정
+#define BACKUP_CHECKSUM_SUFFIX ".crc32c"   /* 백업 파일 옆에 두는 페이지별 CRC32C 목록 */
+#define BACKUP_CHECKSUM_VERSION 1          /* 체크섬 목록 파일 형식 버전 */
+#define BACKUP_VERIFY_BUFFER_SIZE (1024 * 1024)  /* 검사할 때 한 번에 읽는 크기 (최대 페이지 크기의 배수) */
+
+// 파일 복사 설정
+#define FILE_COPY_CHUNK_SIZE (64LL * 1024 * 1024)  /* 커널 복사 한 번의 크기이자 쓴 페이지를 캐시에서 내보내는 단위 */
+#define FILE_COPY_BUFFER_SIZE (1024 * 1024)        /* 커널 복사를 쓸 수 없을 때 읽고 쓰는 버퍼 크기 */
+
+// 변경 기록과 시점 복구 설정
+#define CHANGE_LOG_BATCH_ROWS 50000      /* 복구할 때 한 트랜잭션에 적용하는 변경 수 */
+#define CHANGE_LOG_MAX_TABLES 32         /* 변경을 기록하는 테이블 최대 수 */
+#define CHANGE_LOG_MAX_COLUMNS 64        /* 테이블 하나의 최대 컬럼 수 */
+#define CHANGE_LOG_NAME_LENGTH 64        /* 테이블/컬럼 이름 최대 길이 */
+#define CHANGE_LOG_WORK_SUFFIX ".pitr"   /* 복구 작업용 사본 파일 접미사 */
 
 /* 성공/실패 반환값 */
 #define SUCCESS 0
@@ -39,6 +140,12 @@
 #define TABLE_BOOKS "books"
 #define TABLE_MEMBERS "members"
 #define TABLE_LOANS "loans"
+#define TABLE_CLOSURES "library_closures"
+#define TABLE_FEE_POLICIES "fee_policies"
+#define TABLE_LOAN_FINES "loan_fines"
+#define TABLE_MEMBER_BALANCES "member_balances"
+#define TABLE_LOAN_EVENTS "loan_events"
+#define TABLE_REQUEST_DEDUPE "request_dedupe"
 
 /* SQL 쿼리 타입 */
 #define QUERY_SELECT 1
@@ -0,0 +1,37 @@
+#ifndef CRC32C_H
+#define CRC32C_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief CRC32C (Castagnoli, iSCSI 다항식 0x1EDC6F41)를 이어서 계산합니다.
+ *
+ * 처음 호출할 때 CPU를 확인해 x86-64의 SSE4.2 crc32 명령이나 ARMv8의 CRC32 명령을 쓰고,
+ * 둘 다 없으면 8바이트씩 표를 찾는 소프트웨어 구현을 씁니다. 스레드 안전합니다.
+ *
+ * @param crc 이전 결과 (처음에는 0)
+ * @param data 데이터
+ * @param length 길이
+ * @return uint32_t 지금까지의 CRC32C
+ */
+uint32_t crc32c_update(uint32_t crc, const void *data, size_t length);
+
+/**
+ * @brief 소프트웨어 구현으로만 CRC32C를 계산합니다 (하드웨어 구현과 비교하는 용도).
+ *
+ * @param crc 이전 결과 (처음에는 0)
+ * @param data 데이터
+ * @param length 길이
+ * @return uint32_t 지금까지의 CRC32C
+ */
+uint32_t crc32c_update_software(uint32_t crc, const void *data, size_t length);
+
+/**
+ * @brief crc32c_update가 쓰는 구현의 이름을 반환합니다.
+ *
+ * @return const char* "sse4.2", "armv8-crc", "software" 중 하나
+ */
+const char *crc32c_implementation(void);
+
+#endif // CRC32C_H
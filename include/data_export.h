@@ -0,0 +1,98 @@
+#ifndef DATA_EXPORT_H
+#define DATA_EXPORT_H
+
+#include <stdio.h>
+#include <sqlite3.h>
+#include "constants.h"
+
+/**
+ * @brief 내보낼 대상
+ */
+typedef enum {
+    DATA_EXPORT_BOOKS = 0,         /**< 도서 (기간 필터: created_at) */
+    DATA_EXPORT_MEMBERS = 1,       /**< 회원 (기간 필터: registration_date) */
+    DATA_EXPORT_LOANS = 2,         /**< 대출 (기간 필터: loan_date) */
+    DATA_EXPORT_LOAN_DETAILS = 3   /**< 대출에 도서와 회원 정보를 붙인 상세 (기간 필터: loan_date) */
+} DataExportEntity;
+
+/**
+ * @brief 출력 형식
+ */
+typedef enum {
+    DATA_EXPORT_CSV = 0,           /**< 머리글이 있는 RFC 4180 CSV */
+    DATA_EXPORT_NDJSON = 1,        /**< 한 줄에 JSON 객체 하나 */
+    DATA_EXPORT_ARROW = 2          /**< Arrow IPC 파일 (열 묶음, 메모리 매핑 가능) */
+} DataExportFormat;
+
+/**
+ * @brief 내보내기 설정
+ */
+typedef struct {
+    DataExportEntity entity;
+    DataExportFormat format;
+    char from_date[DATA_EXPORT_DATE_LENGTH];   /**< 이 날짜부터 ('YYYY-MM-DD', 비어 있으면 처음부터) */
+    char to_date[DATA_EXPORT_DATE_LENGTH];     /**< 이 날짜까지 포함 ('YYYY-MM-DD', 비어 있으면 끝까지) */
+} DataExportOptions;
+
+/**
+ * @brief 대상 이름("books", "members", "loans", "loan_details")을 읽습니다.
+ *
+ * @param name 대상 이름
+ * @param entity 대상을 저장할 포인터
+ * @return int 성공 시 SUCCESS, 모르는 이름이면 FAILURE 반환
+ */
+int data_export_parse_entity(const char *name, DataExportEntity *entity);
+
+/**
+ * @brief 형식 이름("csv", "ndjson", "arrow")을 읽습니다.
+ *
+ * @param name 형식 이름
+ * @param format 형식을 저장할 포인터
+ * @return int 성공 시 SUCCESS, 모르는 이름이면 FAILURE 반환
+ */
+int data_export_parse_format(const char *name, DataExportFormat *format);
+
+/**
+ * @brief 대상 전체(또는 기간 안의 행)를 ID 순서로 출력 파일에 씁니다.
+ *
+ * 조회 결과를 한 행씩 읽어 고정 크기 버퍼에 바로 변환하므로 행 수와 관계없이 메모리 사용량이 일정하고
+ * 행마다 메모리를 할당하지 않습니다. 기간을 지정한 대출 내보내기는 loan_date 색인 순서(같은 날은 ID 순)로 씁니다.
+ * CSV는 쉼표, 큰따옴표, 줄바꿈이 있는 값만 큰따옴표로 감싸고 NULL은 빈 값으로,
+ * NDJSON은 열 이름을 키로 하고 정수는 숫자, NULL은 null로 씁니다.
+ * Arrow는 ARROW_BATCH_ROWS행씩 열 단위 레코드 묶음으로 쓰고, 날짜는 UTC 초 단위 timestamp,
+ * 분류는 미리 모은 값으로 사전 인코딩합니다 (사전 조회와 본 조회는 하나의 읽기 트랜잭션에서 실행).
+ *
+ * @param db 데이터베이스 연결
+ * @param options 내보내기 설정
+ * @param output 출력 파일 (표준 출력 가능)
+ * @param rows 쓴 행 수를 저장할 포인터 (NULL 가능)
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환
+ */
+int data_export(sqlite3 *db, const DataExportOptions *options, FILE *output, long long *rows);
+
+/**
+ * @brief data_export()의 결과를 파일에 씁니다.
+ *
+ * @param db 데이터베이스 연결
+ * @param options 내보내기 설정
+ * @param path 출력 파일 경로 ("-"이면 표준 출력, 파일은 있으면 덮어씀)
+ * @param rows 쓴 행 수를 저장할 포인터 (NULL 가능)
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환
+ */
+int data_export_to_path(sqlite3 *db, const DataExportOptions *options, const char *path, long long *rows);
+
+/**
+ * @brief 도서, 회원, 대출 전체를 같은 시점의 스냅숏으로 디렉터리에 씁니다.
+ *
+ * 하나의 읽기 트랜잭션 안에서 directory/books.<형식>, members.<형식>, loans.<형식> 파일을 만듭니다
+ * (확장자는 csv, ndjson, arrow). 이미 트랜잭션 안이면 그 트랜잭션을 그대로 씁니다.
+ *
+ * @param db 데이터베이스 연결
+ * @param format 출력 형식
+ * @param directory 출력 디렉터리 (없으면 만듦)
+ * @param rows 세 파일에 쓴 전체 행 수를 저장할 포인터 (NULL 가능)
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환
+ */
+int data_export_snapshot(sqlite3 *db, DataExportFormat format, const char *directory, long long *rows);
+
+#endif // DATA_EXPORT_H
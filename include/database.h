@@ -28,6 +28,51 @@ void database_close(sqlite3 *db);
  */
 int database_create_tables(sqlite3 *db);
 
+/**
+ * @brief 회원 이메일 고유 제약을 대소문자 구분 없이(NOCASE) 적용하도록 변경합니다.
+ * 
+ * 이미 적용된 경우 아무 작업도 하지 않습니다. 대소문자만 다른 중복 이메일이 있으면
+ * 각 중복을 stderr로 보고하고 변경하지 않으며, 없으면 이메일을 소문자로 정규화하여
+ * 회원 테이블을 다시 만듭니다.
+ * 
+ * @param db 데이터베이스 연결 포인터
+ * @return int 적용했거나 이미 적용된 경우 0, 중복이 있으면 중복 그룹 수, 실패 시 FAILURE
+ */
+int database_migrate_member_email(sqlite3 *db);
+
+/**
+ * @brief 기존 데이터베이스에 컬럼이 없으면 추가합니다.
+ * 
+ * @param db 데이터베이스 연결 포인터
+ * @param table 테이블 이름
+ * @param column 컬럼 이름
+ * @param definition 컬럼 정의 (예: "TEXT")
+ * @return int 새로 추가했으면 1, 이미 있으면 0, 실패 시 FAILURE
+ */
+int database_add_column_if_missing(sqlite3 *db, const char *table, const char *column, const char *definition);
+
+/**
+ * @brief 도서 제목/저자 부분 검색용 색인(books_search)을 만듭니다.
+ * 
+ * 검색 컬럼(title_norm 등)을 외부 내용으로 쓰는 FTS5 trigram 가상 테이블과, books가 바뀔 때
+ * 색인을 맞추는 트리거를 만듭니다. 새로 만들었거나 트리거가 빠져 있으면 색인을 다시 채웁니다.
+ * SQLite가 FTS5나 trigram 토크나이저 없이 빌드되었으면 만들지 않고 SUCCESS를 반환합니다.
+ * 
+ * @param db 데이터베이스 연결 포인터
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE
+ */
+int database_create_book_search_index(sqlite3 *db);
+
+/**
+ * @brief 대량 입력 동안 도서 검색 색인의 트리거를 지웁니다.
+ * 
+ * 입력이 끝나면 database_create_book_search_index()로 트리거를 되살리고 색인을 한 번에 다시 채웁니다.
+ * 
+ * @param db 데이터베이스 연결 포인터
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE
+ */
+int database_pause_book_search_index(sqlite3 *db);
+
 /**
  * @brief 트랜잭션을 시작합니다.
  * 
@@ -36,6 +81,34 @@ int database_create_tables(sqlite3 *db);
  */
 int database_begin_transaction(sqlite3 *db);
 
+/**
+ * @brief 쓰기 잠금을 즉시 확보하는 트랜잭션을 시작합니다.
+ * 
+ * 읽은 뒤 쓰는 작업에서 사용하며, 다른 연결이 쓰는 중이면 지수 백오프로 재시도합니다.
+ * 
+ * @param db 데이터베이스 연결 포인터
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE
+ */
+int database_begin_immediate_transaction(sqlite3 *db);
+
+/**
+ * @brief 잠금 대기로 인한 재시도 누적 횟수를 반환합니다.
+ * 
+ * @return long long 모든 연결의 재시도 횟수 합계
+ */
+long long database_get_busy_retry_count(void);
+
+/**
+ * @brief 연결 하나의 잠금 대기 통계를 지정한 구조체에 누적합니다.
+ * 
+ * 재시도 방식은 바뀌지 않으며, 구조체는 그 연결을 쓰는 스레드에서만 읽고 써야 합니다.
+ * 
+ * @param db 데이터베이스 연결 포인터
+ * @param stats 통계를 누적할 구조체 (NULL이면 누적 중단)
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE
+ */
+int database_track_busy(sqlite3 *db, DatabaseBusyStats *stats);
+
 /**
  * @brief 트랜잭션을 커밋합니다.
  * 
@@ -74,6 +147,8 @@ int database_prepare_statement(sqlite3 *db, const char *sql, sqlite3_stmt **stmt
 /**
  * @brief 데이터베이스 백업을 생성합니다.
  * 
+ * 백업 파일 옆에 페이지별 CRC32C 목록(BACKUP_CHECKSUM_SUFFIX)도 만듭니다.
+ * 
  * @param db 데이터베이스 연결 포인터
  * @param backup_path 백업 파일 경로
  * @return int 성공 시 SUCCESS, 실패 시 FAILURE
@@ -83,6 +158,8 @@ int database_backup(sqlite3 *db, const char *backup_path);
 /**
  * @brief 데이터베이스를 복원합니다.
  * 
+ * 체크섬 목록이 있으면 먼저 backup_verify()로 검사하고, 손상된 백업은 복원하지 않습니다.
+ * 
  * @param db 데이터베이스 연결 포인터
  * @param backup_path 백업 파일 경로
  * @return int 성공 시 SUCCESS, 실패 시 FAILURE
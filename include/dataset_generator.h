@@ -0,0 +1,64 @@
+#ifndef DATASET_GENERATOR_H
+#define DATASET_GENERATOR_H
+
+#include <sqlite3.h>
+#include <time.h>
+#include "constants.h"
+
+/**
+ * @brief 합성 데이터 생성 설정
+ */
+typedef struct {
+    unsigned long long seed;   /**< 난수 시드 (같은 시드와 기준 시각이면 같은 데이터) */
+    int book_count;            /**< 도서 수 */
+    int member_count;          /**< 회원 수 */
+    long long loan_count;      /**< 대출 기록 수 (대출 가능한 사본이 없으면 덜 만들어질 수 있음) */
+    int years;                 /**< 대출 이력 기간 (년) */
+    double zipf_exponent;      /**< 도서 인기도의 Zipf 지수 */
+    int overdue_percent;       /**< 연체 후 반납하는 대출 비율 (%) */
+    int write_events;          /**< TRUE면 loan_events에 대출/연장/반납 이벤트도 기록 */
+    time_t as_of;              /**< 기준 시각 (이 시각 이후 반납은 대출 중으로 남음, 0이면 현재 시각) */
+} DatasetGeneratorConfig;
+
+/**
+ * @brief 합성 데이터 생성 결과
+ */
+typedef struct {
+    long long books;           /**< 생성한 도서 수 */
+    long long members;         /**< 생성한 회원 수 */
+    long long loans;           /**< 생성한 대출 기록 수 */
+    long long renewals;        /**< 대출 연장 횟수 */
+    long long open_loans;      /**< 기준 시각에 대출 중인 기록 수 */
+    long long overdue_loans;   /**< 대출 중 연체된 기록 수 */
+    long long events;          /**< 기록한 대출 이벤트 수 */
+    long long skipped_loans;   /**< 남는 사본이나 대출 한도 때문에 만들지 못한 대출 수 */
+    double elapsed_seconds;    /**< 걸린 시간 */
+} DatasetGeneratorStats;
+
+/**
+ * @brief 도서 수 기준의 기본 설정으로 초기화합니다.
+ *
+ * 회원 수와 대출 기록 수는 도서 수에 비례하여 정해집니다.
+ *
+ * @param config 설정 구조체
+ * @param book_count 도서 수
+ */
+void dataset_generator_default_config(DatasetGeneratorConfig *config, int book_count);
+
+/**
+ * @brief 빈 데이터베이스에 합성 데이터를 채웁니다.
+ *
+ * 도서 인기도는 Zipf 분포를, 회원 이름과 도서 제목은 한국어 이름/단어 조합을 따릅니다.
+ * 대출은 기간 전체에 시간순으로 만들어지며, 도서 사본 수와 회원 대출 한도를 넘지 않습니다.
+ * 연장, 연체 반납, 기준 시각에 대출 중인 기록(연체 포함)이 섞입니다.
+ *
+ * 전체를 하나의 트랜잭션으로 넣고, 그동안 보조 인덱스와 도서 검색 색인의 트리거를 지웠다가 마지막에 다시 만듭니다.
+ *
+ * @param db database_init으로 연 데이터베이스 연결 (도서/회원/대출이 비어 있어야 함)
+ * @param config 생성 설정
+ * @param stats 결과를 저장할 구조체 (NULL 가능)
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환 (실패하면 아무것도 남기지 않음)
+ */
+int dataset_generate(sqlite3 *db, const DatasetGeneratorConfig *config, DatasetGeneratorStats *stats);
+
+#endif // DATASET_GENERATOR_H
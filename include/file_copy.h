@@ -0,0 +1,51 @@
+#ifndef FILE_COPY_H
+#define FILE_COPY_H
+
+#include "constants.h"
+
+/**
+ * @brief 파일 복사 방법
+ */
+typedef enum {
+    FILE_COPY_AUTO = 0,            /**< 아래 방법을 차례로 시도 */
+    FILE_COPY_REFLINK = 1,         /**< ioctl(FICLONE): 데이터 블록을 공유해 바로 끝남 (Btrfs, XFS 등) */
+    FILE_COPY_RANGE = 2,           /**< copy_file_range(): 커널 안에서 복사 (NFS 등은 서버 쪽 복사) */
+    FILE_COPY_SENDFILE = 3,        /**< sendfile(): 커널 안에서 복사 */
+    FILE_COPY_BUFFER = 4           /**< FILE_COPY_BUFFER_SIZE 버퍼로 읽고 쓰기 (모든 플랫폼) */
+} FileCopyMethod;
+
+/**
+ * @brief 파일 복사 결과
+ */
+typedef struct {
+    FileCopyMethod method;         /**< 실제로 쓴 방법 */
+    long long bytes;               /**< 복사한 바이트 수 */
+    double elapsed_seconds;        /**< 걸린 시간 (디스크에 내려 쓰는 시간 포함) */
+} FileCopyStats;
+
+/**
+ * @brief 파일을 복사합니다.
+ *
+ * FILE_COPY_AUTO이면 리눅스에서 reflink, copy_file_range, sendfile 순서로 시도하고 파일 시스템이나
+ * 커널이 지원하지 않으면 큰 버퍼로 읽고 씁니다. 원본은 순차 읽기로 알리고, 쓴 내용은
+ * FILE_COPY_CHUNK_SIZE마다 디스크에 내려 쓴 뒤 페이지 캐시에서 내보내므로 수 GB를 복사해도
+ * 실행 중인 데이터베이스의 캐시를 밀어내지 않습니다. 끝나면 대상 파일을 fsync합니다.
+ * 실패하면 만들던 대상 파일을 지웁니다.
+ *
+ * @param source_path 원본 파일 경로
+ * @param dest_path 대상 파일 경로 (있으면 덮어씀)
+ * @param method 복사 방법 (AUTO가 아니면 그 방법만 쓰고, 지원하지 않으면 실패)
+ * @param stats 결과를 저장할 포인터 (NULL 가능)
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환
+ */
+int file_copy(const char *source_path, const char *dest_path, FileCopyMethod method, FileCopyStats *stats);
+
+/**
+ * @brief 복사 방법의 이름을 반환합니다.
+ *
+ * @param method 복사 방법
+ * @return const char* "reflink", "copy_file_range", "sendfile", "buffer", "auto" 중 하나
+ */
+const char *file_copy_method_name(FileCopyMethod method);
+
+#endif // FILE_COPY_H
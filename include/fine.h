@@ -0,0 +1,76 @@
+#ifndef FINE_H
+#define FINE_H
+
+#include <sqlite3.h>
+#include <time.h>
+#include "types.h"
+#include "constants.h"
+
+/**
+ * @brief 카테고리별 연체료 정책을 등록하거나 변경합니다.
+ *
+ * 정책이 없는 카테고리는 DEFAULT_DAILY_FINE, DEFAULT_MAX_FINE을 적용합니다.
+ *
+ * @param db 데이터베이스 연결 포인터
+ * @param category 도서 카테고리
+ * @param daily_rate 하루당 연체료 (원)
+ * @param max_fine 대출 1건당 연체료 상한액 (원)
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환
+ */
+int set_fee_policy(sqlite3 *db, const char *category, int daily_rate, int max_fine);
+
+/**
+ * @brief 모든 연체 대출의 연체료를 한 번에 정산합니다.
+ *
+ * 단일 기준 시각으로 연체 대출 전체의 연체료를 집합 연산으로 계산하고,
+ * 이전 정산 금액과의 차액만큼 회원별 미납 잔액을 증분 갱신합니다.
+ *
+ * @param db 데이터베이스 연결 포인터
+ * @param as_of 정산 기준 시각
+ * @return int 연체료가 변경된 대출 건수, 실패 시 FAILURE 반환
+ */
+int accrue_fines(sqlite3 *db, time_t as_of);
+
+/**
+ * @brief 대출 1건의 연체료를 정산합니다.
+ *
+ * 반납 처리와 같은 트랜잭션 안에서 호출하기 위한 함수로, 트랜잭션을 직접 열지 않습니다.
+ *
+ * @param db 데이터베이스 연결 포인터
+ * @param loan_id 대출 ID
+ * @param as_of 정산 기준 시각
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환
+ */
+int accrue_loan_fine(sqlite3 *db, int loan_id, time_t as_of);
+
+/**
+ * @brief 회원의 미납 연체료 잔액을 조회합니다.
+ *
+ * @param db 데이터베이스 연결 포인터
+ * @param member_id 회원 ID
+ * @param balance 잔액을 저장할 포인터 (기록이 없으면 0)
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환
+ */
+int get_member_balance(sqlite3 *db, int member_id, int *balance);
+
+/**
+ * @brief 회원의 연체료를 납부 처리합니다.
+ *
+ * @param db 데이터베이스 연결 포인터
+ * @param member_id 회원 ID
+ * @param amount 납부 금액 (원, 미납 잔액 이하)
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환
+ */
+int pay_fine(sqlite3 *db, int member_id, int amount);
+
+/**
+ * @brief 대출 1건의 마지막 정산 연체료를 조회합니다.
+ *
+ * @param db 데이터베이스 연결 포인터
+ * @param loan_id 대출 ID
+ * @param amount 연체료를 저장할 포인터 (정산 기록이 없으면 0)
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환
+ */
+int get_loan_fine(sqlite3 *db, int loan_id, int *amount);
+
+#endif // FINE_H
@@ -0,0 +1,69 @@
+#ifndef HANGUL_H
+#define HANGUL_H
+
+#include <stddef.h>
+#include <sqlite3.h>
+#include "constants.h"
+
+/**
+ * @brief 검색용으로 문자열을 정규화합니다.
+ *
+ * 한글 음절은 초성/중성/종성 호환 자모로 분해하고, 영문은 소문자로 바꾸며,
+ * 공백은 제거합니다. 분해된 형태이므로 입력 중인 "김ㅁ"도 "김민수"의 접두어가 됩니다.
+ * 결과는 입력의 최대 3배 길이이므로 dst_size는 strlen(src) * 3 + 1 이상이어야 합니다.
+ *
+ * @param src 원본 문자열 (UTF-8)
+ * @param dst 결과를 저장할 버퍼
+ * @param dst_size 버퍼 크기
+ * @return int 결과 문자열 길이(바이트), 버퍼가 부족하면 FAILURE 반환
+ */
+int hangul_normalize(const char *src, char *dst, size_t dst_size);
+
+/**
+ * @brief 문자열의 초성만 추출합니다.
+ *
+ * 한글 음절은 초성 호환 자모로 바꾸고, 자음 자모와 영문/숫자는 정규화하여 그대로 두며,
+ * 공백은 제거합니다. 예: "김민수" → "ㄱㅁㅅ"
+ *
+ * @param src 원본 문자열 (UTF-8)
+ * @param dst 결과를 저장할 버퍼
+ * @param dst_size 버퍼 크기
+ * @return int 결과 문자열 길이(바이트), 버퍼가 부족하면 FAILURE 반환
+ */
+int hangul_extract_chosung(const char *src, char *dst, size_t dst_size);
+
+/**
+ * @brief 문자열이 초성(자음 자모)만으로 이루어졌는지 확인합니다.
+ *
+ * 공백은 무시하며, 빈 문자열은 초성 검색어로 보지 않습니다.
+ *
+ * @param src 확인할 문자열 (UTF-8)
+ * @return int 초성만으로 이루어졌으면 TRUE, 아니면 FALSE 반환
+ */
+int hangul_is_chosung_query(const char *src);
+
+/**
+ * @brief 접두어 범위 검색의 상한 값을 만듭니다.
+ *
+ * "col >= prefix AND col < 상한" 조건으로 BINARY 인덱스를 범위 조회할 수 있도록
+ * 접두어 뒤에 가장 큰 유니코드 문자(U+10FFFF)를 붙입니다.
+ *
+ * @param prefix 접두어
+ * @param dst 결과를 저장할 버퍼
+ * @param dst_size 버퍼 크기 (strlen(prefix) + 5 이상)
+ * @return int 성공 시 SUCCESS, 버퍼가 부족하면 FAILURE 반환
+ */
+int hangul_prefix_upper_bound(const char *prefix, char *dst, size_t dst_size);
+
+/**
+ * @brief 정규화 SQL 함수를 연결에 등록합니다.
+ *
+ * hangul_normalize(text), hangul_chosung(text) 함수를 결정적(deterministic) 함수로 등록하여
+ * INSERT/UPDATE 문에서 검색 컬럼을 함께 채울 수 있게 합니다.
+ *
+ * @param db 데이터베이스 연결 포인터
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환
+ */
+int hangul_register_functions(sqlite3 *db);
+
+#endif // HANGUL_H
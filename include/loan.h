@@ -5,6 +5,7 @@
 #include <time.h>
 #include "types.h"
 #include "constants.h"
+#include "calendar.h"
 
 /**
  * @brief 도서를 대출합니다.
@@ -12,11 +13,26 @@
  * @param db 데이터베이스 연결 포인터
  * @param book_id 대출할 도서 ID
  * @param member_id 대출하는 회원 ID
- * @param loan_days 대출 기간 (일수, 0이면 기본값 사용)
+ * @param loan_days 대출 기간 (일수, 0이면 기본값 사용, 휴관일에 걸리면 다음 개관일로 연장)
  * @return int 성공 시 생성된 대출 ID, 실패 시 FAILURE 반환
  */
 int loan_book(sqlite3 *db, int book_id, int member_id, int loan_days);
 
+/**
+ * @brief 클라이언트 요청 ID로 중복 처리를 방지하며 도서를 대출합니다.
+ * 
+ * 같은 요청 ID로 재시도하면 유효 기간(REQUEST_DEDUPE_TTL_SECONDS) 동안
+ * 다시 대출하지 않고 처음 생성된 대출 ID를 반환합니다. 실패한 요청은 기록하지 않습니다.
+ * 
+ * @param db 데이터베이스 연결 포인터
+ * @param request_id 클라이언트 요청 ID (NULL이면 중복 확인 안 함)
+ * @param book_id 대출할 도서 ID
+ * @param member_id 대출하는 회원 ID
+ * @param loan_days 대출 기간 (일수, 0이면 기본값 사용)
+ * @return int 성공 시 대출 ID, 실패 시 FAILURE 반환
+ */
+int loan_book_idempotent(sqlite3 *db, const char *request_id, int book_id, int member_id, int loan_days);
+
 /**
  * @brief 도서를 반납합니다.
  * 
@@ -26,6 +42,16 @@ int loan_book(sqlite3 *db, int book_id, int member_id, int loan_days);
  */
 int return_book(sqlite3 *db, int loan_id);
 
+/**
+ * @brief 클라이언트 요청 ID로 중복 처리를 방지하며 도서를 반납합니다.
+ * 
+ * @param db 데이터베이스 연결 포인터
+ * @param request_id 클라이언트 요청 ID (NULL이면 중복 확인 안 함)
+ * @param loan_id 반납할 대출 ID
+ * @return int 성공 시 SUCCESS (재시도 시에도 SUCCESS), 실패 시 FAILURE 반환
+ */
+int return_book_idempotent(sqlite3 *db, const char *request_id, int loan_id);
+
 /**
  * @brief 도서 ID와 회원 ID로 반납합니다.
  * 
@@ -36,6 +62,17 @@ int return_book(sqlite3 *db, int loan_id);
  */
 int return_book_by_ids(sqlite3 *db, int book_id, int member_id);
 
+/**
+ * @brief 클라이언트 요청 ID로 중복 처리를 방지하며 도서 ID와 회원 ID로 반납합니다.
+ * 
+ * @param db 데이터베이스 연결 포인터
+ * @param request_id 클라이언트 요청 ID (NULL이면 중복 확인 안 함)
+ * @param book_id 반납할 도서 ID
+ * @param member_id 반납하는 회원 ID
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환
+ */
+int return_book_by_ids_idempotent(sqlite3 *db, const char *request_id, int book_id, int member_id);
+
 /**
  * @brief 대출을 연장합니다.
  * 
@@ -46,6 +83,38 @@ int return_book_by_ids(sqlite3 *db, int book_id, int member_id);
  */
 int extend_loan(sqlite3 *db, int loan_id, int extend_days);
 
+/**
+ * @brief 클라이언트 요청 ID로 중복 처리를 방지하며 대출을 연장합니다.
+ * 
+ * @param db 데이터베이스 연결 포인터
+ * @param request_id 클라이언트 요청 ID (NULL이면 중복 확인 안 함)
+ * @param loan_id 연장할 대출 ID
+ * @param extend_days 연장할 일수
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환
+ */
+int extend_loan_idempotent(sqlite3 *db, const char *request_id, int loan_id, int extend_days);
+
+/**
+ * @brief 유효 기간이 지난 요청 ID 기록을 삭제합니다.
+ * 
+ * @param db 데이터베이스 연결 포인터
+ * @return int 삭제된 기록 수, 실패 시 FAILURE 반환
+ */
+int purge_expired_loan_requests(sqlite3 *db);
+
+/**
+ * @brief 휴관 기간에 반납 예정인 미반납 대출들의 반납 예정일을 일괄 조정합니다.
+ * 
+ * 기간 내에 반납 예정인 대출을 기간 이후 첫 개관일로 옮기며,
+ * 단일 UPDATE로 처리하고 연장 횟수(renewal_count)는 소모하지 않습니다.
+ * 
+ * @param db 데이터베이스 연결 포인터
+ * @param range 휴관 기간 (시작일과 종료일 모두 포함, 현지 날짜 기준)
+ * @param calendar 첫 개관일 계산에 사용할 휴관일 달력
+ * @return int 조정된 대출 수, 실패 시 FAILURE 반환
+ */
+int shift_due_dates(sqlite3 *db, const DateRange *range, const ClosureCalendar *calendar);
+
 /**
  * @brief 대출 ID로 대출 정보를 조회합니다.
  * 
@@ -169,6 +238,17 @@ int check_duplicate_loan(sqlite3 *db, int book_id, int member_id);
  */
 int calculate_overdue_days(time_t due_date, time_t return_date);
 
+/**
+ * @brief 지정한 기준 시각으로 연체 일수를 계산합니다.
+ * 
+ * 목록 출력이나 일괄 정산처럼 여러 건을 처리할 때 기준 시각을 한 번만 구해 전달합니다.
+ * 
+ * @param due_date 반납 예정일
+ * @param as_of 기준 시각
+ * @return int 연체 일수 (음수면 연체 아님)
+ */
+int calculate_overdue_days_as_of(time_t due_date, time_t as_of);
+
 /**
  * @brief 대출 검색 결과 메모리를 초기화합니다.
  * 
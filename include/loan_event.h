@@ -0,0 +1,123 @@
+#ifndef LOAN_EVENT_H
+#define LOAN_EVENT_H
+
+#include <sqlite3.h>
+#include <time.h>
+#include "types.h"
+#include "constants.h"
+
+/**
+ * @brief 대출 이벤트 종류 (loan_events.event_type에 정수로 저장)
+ */
+typedef enum {
+    LOAN_EVENT_CHECKOUT = 1,   /**< 대출 */
+    LOAN_EVENT_RETURN = 2,     /**< 반납 */
+    LOAN_EVENT_RENEW = 3,      /**< 대출 연장 */
+    LOAN_EVENT_DUE_SHIFT = 4   /**< 휴관에 따른 반납 예정일 조정 */
+} LoanEventType;
+
+/**
+ * @brief 대출 이벤트 로그의 한 행
+ */
+typedef struct {
+    long long seq;             /**< 이벤트 순번 (단조 증가) */
+    time_t event_time;         /**< 발생 시각 */
+    int event_type;            /**< 이벤트 종류 (LoanEventType) */
+    int loan_id;               /**< 대출 ID */
+    int book_id;               /**< 도서 ID */
+    int member_id;             /**< 회원 ID */
+    time_t due_date;           /**< 이벤트 직후의 반납 예정일 */
+} LoanEvent;
+
+/**
+ * @brief 이벤트 재생 시 호출되는 처리 함수
+ *
+ * @param event 재생 중인 이벤트
+ * @param user_data 호출자가 전달한 데이터
+ * @return int 계속하려면 SUCCESS, 처리 실패로 재생을 중단하려면 FAILURE 반환
+ */
+typedef int (*LoanEventHandler)(const LoanEvent *event, void *user_data);
+
+/**
+ * @brief 대출 이벤트를 기록합니다.
+ *
+ * 대출/반납/연장 처리와 같은 트랜잭션 안에서 호출해야 하며,
+ * 도서 ID, 회원 ID, 반납 예정일은 loans 테이블의 현재 값으로 채웁니다.
+ *
+ * @param db 데이터베이스 연결 포인터
+ * @param event_type 이벤트 종류
+ * @param loan_id 대출 ID
+ * @param event_time 발생 시각
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환
+ */
+int loan_event_append(sqlite3 *db, LoanEventType event_type, int loan_id, time_t event_time);
+
+/**
+ * @brief 이벤트 로그를 순번 순서로 재생합니다.
+ *
+ * @param db 데이터베이스 연결 포인터
+ * @param after_seq 이 순번 이후의 이벤트부터 재생 (처음부터는 0)
+ * @param until 이 시각까지 발생한 이벤트만 재생 (제한 없음은 0)
+ * @param handler 이벤트마다 호출할 처리 함수
+ * @param user_data 처리 함수에 전달할 데이터
+ * @param last_seq 마지막으로 재생한 순번을 저장할 포인터 (NULL 가능)
+ * @return int 재생한 이벤트 수, 조회 실패 또는 처리 함수가 FAILURE를 반환하면 FAILURE 반환
+ */
+int loan_event_replay(sqlite3 *db, long long after_seq, time_t until,
+                      LoanEventHandler handler, void *user_data, long long *last_seq);
+
+/**
+ * @brief 지정 시각 기준의 대출 현황을 임시 테이블로 재구성합니다.
+ *
+ * 결과는 temp.loan_snapshot(loan_id, book_id, member_id, loan_time, due_date,
+ * return_time, renewal_count) 테이블에 저장되며 호출할 때마다 새로 만들어집니다.
+ *
+ * @param db 데이터베이스 연결 포인터
+ * @param as_of 기준 시각
+ * @return int 재구성된 대출 건수, 실패 시 FAILURE 반환
+ */
+int loan_event_build_snapshot(sqlite3 *db, time_t as_of);
+
+/**
+ * @brief 소비자의 마지막 처리 순번을 조회합니다.
+ *
+ * @param db 데이터베이스 연결 포인터
+ * @param consumer 소비자 이름
+ * @param last_seq 순번을 저장할 포인터 (기록이 없으면 0)
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환
+ */
+int loan_event_get_cursor(sqlite3 *db, const char *consumer, long long *last_seq);
+
+/**
+ * @brief 소비자가 마지막 처리 순번 이후의 이벤트만 처리하도록 재생합니다.
+ *
+ * 이벤트 처리와 처리 순번 갱신은 하나의 트랜잭션으로 묶이므로,
+ * 처리 함수가 같은 연결로 파생 테이블을 갱신하면 중복 반영되지 않습니다.
+ *
+ * @param db 데이터베이스 연결 포인터
+ * @param consumer 소비자 이름
+ * @param handler 이벤트마다 호출할 처리 함수
+ * @param user_data 처리 함수에 전달할 데이터
+ * @return int 처리한 이벤트 수, 실패 시 FAILURE 반환
+ */
+int loan_event_consume(sqlite3 *db, const char *consumer, LoanEventHandler handler, void *user_data);
+
+/**
+ * @brief 이벤트 로그 도입 이전의 대출 기록을 이벤트로 채워 넣습니다.
+ *
+ * 이벤트가 하나도 없는 대출에 대해서만 대출/반납 이벤트를 생성하므로 여러 번 실행해도 안전합니다.
+ *
+ * @param db 데이터베이스 연결 포인터
+ * @return int 생성된 이벤트 수, 실패 시 FAILURE 반환
+ */
+int loan_event_backfill(sqlite3 *db);
+
+/**
+ * @brief 이벤트 종류를 문자열로 반환합니다.
+ *
+ * @param event_type 이벤트 종류
+ * @return const char* 이벤트 이름
+ */
+const char* loan_event_type_to_string(int event_type);
+
+#endif // LOAN_EVENT_H
@@ -0,0 +1,127 @@
+#ifndef LOGGER_H
+#define LOGGER_H
+
+#include <stdarg.h>
+#include <stddef.h>
+#include "utils.h"
+
+/**
+ * @brief 비동기 로거 통계
+ */
+typedef struct {
+    long long written;         /**< 파일에 기록된 로그 수 */
+    long long dropped;         /**< 버퍼가 가득 차 버려진 로그 수 */
+    long long filtered;        /**< 수준 미달로 걸러진 로그 수 */
+    int ring_count;            /**< 로그를 남긴 스레드(링 버퍼) 수 */
+    long long rotations;       /**< 로그 파일을 교체한 횟수 */
+    long long compressed;      /**< gzip으로 압축한 교체 파일 수 */
+} LoggerStats;
+
+/**
+ * @brief 로그 파일 교체 설정
+ */
+typedef struct {
+    long long max_bytes;       /**< 파일이 이 크기를 넘기 전에 교체 (0이면 크기 기준 없음) */
+    int rotate_daily;          /**< TRUE면 날짜가 바뀔 때 교체 */
+    int max_archives;          /**< 보관할 교체 파일 수 (0이면 제한 없음) */
+    int compress;              /**< TRUE면 교체된 파일을 gzip으로 압축 */
+} LoggerRotation;
+
+/**
+ * @brief 로그 줄 하나를 받는 콜백 (줄 끝 개행 문자는 포함하지 않으며 NUL로 끝나지 않음)
+ */
+typedef void (*LogTailCallback)(const char *line, size_t length, void *user_data);
+
+/**
+ * @brief 비동기 로거를 시작합니다.
+ *
+ * 로그를 남기는 스레드마다 잠금 없는 링 버퍼(단일 생산자/단일 소비자)를 두고,
+ * 백그라운드 기록 스레드가 여러 건을 모아 한 번에 파일에 씁니다.
+ * 이미 시작된 경우 기존 로거를 종료한 뒤 다시 시작합니다.
+ *
+ * @param log_file_path 로그 파일 경로 (NULL이면 표준 출력)
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환
+ */
+int logger_start(const char *log_file_path);
+
+/**
+ * @brief 남은 로그를 모두 기록하고 로거를 종료합니다.
+ *
+ * 진행 중인 압축이 끝날 때까지 기다립니다.
+ */
+void logger_stop(void);
+
+/**
+ * @brief 기록할 최소 로그 수준을 설정합니다.
+ *
+ * 이보다 낮은 수준의 로그는 형식화하기 전에 걸러집니다.
+ *
+ * @param level 최소 로그 수준
+ */
+void logger_set_level(LogLevel level);
+
+/**
+ * @brief 현재 최소 로그 수준을 반환합니다.
+ *
+ * @return LogLevel 최소 로그 수준
+ */
+LogLevel logger_get_level(void);
+
+/**
+ * @brief 로그를 호출한 스레드의 링 버퍼에 넣습니다.
+ *
+ * 파일 기록은 백그라운드 스레드가 하므로 호출 스레드는 대기하지 않으며,
+ * 버퍼가 가득 차면 해당 로그를 버리고 유실 수를 늘립니다.
+ * 로거가 시작되지 않았으면 표준 출력에 바로 씁니다.
+ *
+ * @param level 로그 수준
+ * @param format printf 형식 문자열
+ * @param args 형식 인자
+ */
+void logger_write(LogLevel level, const char *format, va_list args);
+
+/**
+ * @brief 지금까지 버퍼에 쌓인 로그를 모두 파일에 기록합니다.
+ */
+void logger_flush(void);
+
+/**
+ * @brief 로거 통계를 조회합니다.
+ *
+ * @param stats 통계를 저장할 포인터
+ */
+void logger_get_stats(LoggerStats *stats);
+
+/**
+ * @brief 로그 파일 교체 설정을 지정합니다.
+ *
+ * 다음 logger_start 호출부터 적용됩니다. 교체된 파일은
+ * <로그 파일>.<YYYYMMDD-HHMMSS-NN> 이름으로 바뀌고, 백그라운드 스레드가
+ * gzip으로 압축한 뒤 보관 개수를 넘는 오래된 파일을 지웁니다.
+ *
+ * @param rotation 교체 설정
+ */
+void logger_set_rotation(const LoggerRotation *rotation);
+
+/**
+ * @brief 지금까지 쌓인 로그를 기록한 뒤 로그 파일을 즉시 교체합니다.
+ *
+ * @return int 성공 시 SUCCESS, 로거가 파일에 기록 중이 아니면 FAILURE 반환
+ */
+int logger_rotate(void);
+
+/**
+ * @brief 로그 파일의 마지막 줄들을 오래된 순서로 콜백에 넘깁니다.
+ *
+ * 파일을 메모리에 매핑하고 끝에서부터 줄을 찾으므로 파일 크기와 관계없이
+ * 요청한 줄 수만큼만 읽습니다.
+ *
+ * @param log_file_path 로그 파일 경로
+ * @param max_lines 읽을 최대 줄 수
+ * @param callback 줄마다 호출할 함수
+ * @param user_data 콜백에 넘길 값
+ * @return int 넘긴 줄 수, 실패 시 FAILURE 반환
+ */
+int logger_read_tail(const char *log_file_path, int max_lines, LogTailCallback callback, void *user_data);
+
+#endif // LOGGER_H
@@ -9,7 +9,19 @@
 #include "book.h"
 #include "member.h"
 #include "loan.h"
+#include "calendar.h"
+#include "fine.h"
+#include "loan_event.h"
 #include "utils.h"
+#include "logger.h"
+#include "metrics.h"
+#include "metrics_exporter.h"
+#include "query_profiler.h"
+#include "workload_trace.h"
+#include "book_import.h"
+#include "marc.h"
+#include "backup.h"
+#include "change_log.h"
 
 // 메뉴 타입 정의
 typedef enum {
@@ -38,7 +50,9 @@ typedef enum {
     BOOK_SEARCH = 2,
     BOOK_UPDATE = 3,
     BOOK_DELETE = 4,
-    BOOK_LIST_ALL = 5
+    BOOK_LIST_ALL = 5,
+    BOOK_IMPORT = 6,
+    BOOK_EXPORT = 7
 } BookMenuChoice;
 
 // 회원 관리 메뉴 선택지
@@ -58,7 +72,9 @@ typedef enum {
     LOAN_RETURN = 2,
     LOAN_EXTEND = 3,
     LOAN_HISTORY = 4,
-    LOAN_OVERDUE = 5
+    LOAN_OVERDUE = 5,
+    LOAN_CLOSURE = 6,
+    LOAN_FINES = 7
 } LoanMenuChoice;
 
 // 보고서 메뉴 선택지
@@ -67,7 +83,8 @@ typedef enum {
     REPORT_STATISTICS = 1,
     REPORT_POPULAR_BOOKS = 2,
     REPORT_MEMBER_ACTIVITY = 3,
-    REPORT_OVERDUE_LIST = 4
+    REPORT_OVERDUE_LIST = 4,
+    REPORT_POINT_IN_TIME = 5
 } ReportMenuChoice;
 
 // 시스템 설정 메뉴 선택지
@@ -76,7 +93,11 @@ typedef enum {
     SYSTEM_BACKUP = 1,
     SYSTEM_RESTORE = 2,
     SYSTEM_CONFIG = 3,
-    SYSTEM_LOG = 4
+    SYSTEM_LOG = 4,
+    SYSTEM_METRICS = 5,
+    SYSTEM_SQL_PROFILE = 6,
+    SYSTEM_BACKUP_STATUS = 7,
+    SYSTEM_POINT_IN_TIME = 8
 } SystemMenuChoice;
 
 // 전역 변수
@@ -110,6 +131,8 @@ void search_books_interactive(void);
 void update_book_interactive(void);
 void delete_book_interactive(void);
 void list_all_books_interactive(void);
+void import_books_interactive(void);
+void export_books_interactive(void);
 
 // 회원 관리 기능 함수들
 void add_member_interactive(void);
@@ -124,18 +147,25 @@ void return_book_interactive(void);
 void extend_loan_interactive(void);
 void show_loan_history_interactive(void);
 void show_overdue_loans(void);
+void register_closure_interactive(void);
+void manage_fines_interactive(void);
 
 // 보고서 기능 함수들
 void show_library_statistics(void);
 void show_popular_books_report(void);
 void show_member_activity_report(void);
 void show_overdue_report(void);
+void show_point_in_time_report(void);
 
 // 시스템 관리 기능 함수들
 void backup_database_interactive(void);
 void restore_database_interactive(void);
 void configure_system_interactive(void);
 void show_system_log(void);
+void show_metrics_interactive(void);
+void show_sql_profile_interactive(void);
+void show_backup_status_interactive(void);
+void recover_point_in_time_interactive(void);
 
 // 유틸리티 함수들
 void clear_screen(void);
@@ -0,0 +1,226 @@
+#ifndef MARC_H
+#define MARC_H
+
+#include <stdio.h>
+#include <stddef.h>
+#include <sqlite3.h>
+#include "types.h"
+#include "constants.h"
+
+/**
+ * @brief 메모리에 매핑한 MARC21(ISO 2709) 파일 읽기 상태
+ */
+typedef struct {
+    const unsigned char *data; /**< 매핑한 파일 내용 */
+    size_t size;               /**< 파일 크기 */
+    size_t offset;             /**< 다음 레코드의 파일 위치 */
+    long long records;         /**< 지금까지 읽은 레코드 수 (손상된 레코드 포함) */
+    void *mapping;             /**< 매핑 핸들 (Windows) */
+} MarcReader;
+
+/**
+ * @brief 레코드 하나 (매핑한 파일 안을 가리키며 복사하지 않음)
+ */
+typedef struct {
+    const unsigned char *data; /**< 리더부터 레코드 종단 기호까지 */
+    size_t length;             /**< 레코드 길이 */
+    size_t offset;             /**< 파일 안에서의 위치 */
+    size_t base_address;       /**< 데이터 영역 시작 위치 (레코드 안) */
+    int field_count;           /**< 디렉터리 항목 수 */
+} MarcRecord;
+
+/**
+ * @brief 필드 하나 (레코드 안을 가리키며, 필드 종단 기호는 포함하지 않음)
+ */
+typedef struct {
+    char tag[4];               /**< 태그 (예: "245") */
+    const unsigned char *data; /**< 필드 내용 (데이터 필드는 지시기호 2자부터) */
+    size_t length;             /**< 필드 길이 */
+} MarcField;
+
+/**
+ * @brief 스트리밍 MARC21 쓰기 상태
+ */
+typedef struct {
+    FILE *file;                /**< 출력 파일 */
+    unsigned char *directory;  /**< 만드는 중인 레코드의 디렉터리 */
+    size_t directory_length;
+    size_t directory_capacity;
+    unsigned char *fields;     /**< 만드는 중인 레코드의 데이터 영역 */
+    size_t fields_length;
+    size_t fields_capacity;
+    unsigned char leader[MARC_LEADER_LENGTH];   /**< 만드는 중인 레코드의 리더 */
+    char field_tag[4];         /**< 쓰는 중인 데이터 필드의 태그 */
+    size_t field_start;        /**< 쓰는 중인 데이터 필드의 시작 위치 */
+    int field_open;            /**< 데이터 필드를 쓰는 중이면 TRUE */
+    int overflow;              /**< 레코드가 ISO 2709 한도(99999바이트)를 넘으면 TRUE */
+    long long records;         /**< 쓴 레코드 수 */
+} MarcWriter;
+
+/**
+ * @brief MARC 파일을 읽기 전용으로 메모리에 매핑합니다.
+ *
+ * @param reader 읽기 상태
+ * @param path 파일 경로
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환
+ */
+int marc_reader_open(MarcReader *reader, const char *path);
+
+/**
+ * @brief 다음 레코드를 읽습니다.
+ *
+ * 리더와 디렉터리를 검사하지만 필드 내용은 복사하지 않습니다.
+ * 손상된 레코드는 다음 레코드 종단 기호까지 건너뛰고 FAILURE를 반환하므로 이어서 읽을 수 있습니다.
+ * 이때 record에는 건너뛴 구간(data, length, offset)만 채워지고 field_count는 0입니다.
+ *
+ * @param reader 읽기 상태
+ * @param record 읽은 레코드
+ * @return int 읽었으면 TRUE, 파일 끝이면 FALSE, 손상된 레코드를 건너뛰었으면 FAILURE
+ */
+int marc_reader_next(MarcReader *reader, MarcRecord *record);
+
+/**
+ * @brief 다음에 읽을 위치를 옮깁니다 (체크포인트에서 이어 읽기용).
+ *
+ * @param reader 읽기 상태
+ * @param offset 레코드가 시작하는 파일 위치
+ * @param records 그 앞까지 읽은 레코드 수
+ * @return int 성공 시 SUCCESS, 파일 밖이면 FAILURE 반환
+ */
+int marc_reader_seek(MarcReader *reader, size_t offset, long long records);
+
+/**
+ * @brief 매핑을 해제합니다.
+ *
+ * @param reader 읽기 상태
+ */
+void marc_reader_close(MarcReader *reader);
+
+/**
+ * @brief 레코드의 index번째 필드를 가져옵니다.
+ *
+ * @param record 레코드
+ * @param index 디렉터리 순서 (0부터)
+ * @param field 필드를 저장할 구조체
+ * @return int 성공 시 SUCCESS, 범위를 벗어나면 FAILURE 반환
+ */
+int marc_record_field(const MarcRecord *record, int index, MarcField *field);
+
+/**
+ * @brief 태그가 같은 첫 필드를 찾습니다.
+ *
+ * @param record 레코드
+ * @param tag 태그 (예: "020")
+ * @param field 필드를 저장할 구조체
+ * @return int 찾으면 TRUE, 없으면 FALSE
+ */
+int marc_record_find_field(const MarcRecord *record, const char *tag, MarcField *field);
+
+/**
+ * @brief 데이터 필드에서 식별기호가 같은 첫 하위 필드를 찾습니다.
+ *
+ * @param field 데이터 필드
+ * @param code 식별기호 (예: 'a')
+ * @param value 값의 시작 위치를 받을 포인터 (NUL로 끝나지 않음)
+ * @param length 값의 길이를 받을 포인터
+ * @return int 찾으면 TRUE, 없으면 FALSE
+ */
+int marc_field_subfield(const MarcField *field, char code, const char **value, size_t *length);
+
+/**
+ * @brief 서지 레코드를 도서 정보로 바꿉니다.
+ *
+ * 020$a → ISBN, 100$a(없으면 110$a, 700$a, 245$c 순) → 저자, 245$a$b → 제목, 260/264$b → 출판사,
+ * 260/264$c의 네 자리 숫자 → 출판년도, 650$a → 카테고리로 옮기고 ISBD 구두점은 뗍니다.
+ * 보유 권수는 내보내기가 쓰는 로컬 필드 949$t/$v(보유/대출 가능)가 있으면 쓰고 없으면 1권입니다.
+ * 리더 09가 'a'(UCS/Unicode)가 아니면서 ASCII 밖의 바이트가 있는 레코드(MARC-8)는 거부합니다.
+ *
+ * @param record 레코드
+ * @param book 도서 정보를 저장할 구조체
+ * @return const char* 바꿀 수 없으면 이유, 성공하면 NULL
+ */
+const char *marc_record_to_book(const MarcRecord *record, Book *book);
+
+/**
+ * @brief 출력 파일에 레코드를 쓸 준비를 합니다.
+ *
+ * @param writer 쓰기 상태
+ * @param file 출력 파일 (이진 모드로 연 파일)
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환
+ */
+int marc_writer_init(MarcWriter *writer, FILE *file);
+
+/**
+ * @brief 새 레코드를 시작합니다.
+ *
+ * @param writer 쓰기 상태
+ * @param leader 원본 리더 (길이와 주소를 뺀 나머지를 그대로 씀, NULL이면 "nam a22 ... 4500" 기본값)
+ */
+void marc_writer_begin_record(MarcWriter *writer, const unsigned char *leader);
+
+/**
+ * @brief 필드를 내용 그대로 추가합니다 (제어 필드 또는 다른 레코드에서 가져온 필드).
+ *
+ * @param writer 쓰기 상태
+ * @param tag 태그
+ * @param data 필드 내용 (필드 종단 기호 제외)
+ * @param length 내용 길이
+ */
+void marc_writer_add_field(MarcWriter *writer, const char *tag, const void *data, size_t length);
+
+/**
+ * @brief 데이터 필드를 시작합니다. 이어서 marc_writer_add_subfield()로 하위 필드를 추가합니다.
+ *
+ * @param writer 쓰기 상태
+ * @param tag 태그
+ * @param indicator1 제1 지시기호
+ * @param indicator2 제2 지시기호
+ */
+void marc_writer_begin_field(MarcWriter *writer, const char *tag, char indicator1, char indicator2);
+
+/**
+ * @brief 시작한 데이터 필드에 하위 필드를 추가합니다.
+ *
+ * @param writer 쓰기 상태
+ * @param code 식별기호
+ * @param value 값 (NUL로 끝나는 UTF-8 문자열)
+ */
+void marc_writer_add_subfield(MarcWriter *writer, char code, const char *value);
+
+/**
+ * @brief 레코드를 마무리해 파일에 씁니다.
+ *
+ * @param writer 쓰기 상태
+ * @return int 성공 시 SUCCESS, 레코드가 너무 크거나 쓰기에 실패하면 FAILURE 반환
+ */
+int marc_writer_end_record(MarcWriter *writer);
+
+/**
+ * @brief 도서 정보를 레코드 하나로 씁니다 (marc_record_to_book()과 같은 필드 구성).
+ *
+ * @param writer 쓰기 상태
+ * @param book 도서 정보
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환
+ */
+int marc_writer_write_book(MarcWriter *writer, const Book *book);
+
+/**
+ * @brief 쓰기 버퍼를 해제합니다 (파일은 닫지 않음).
+ *
+ * @param writer 쓰기 상태
+ */
+void marc_writer_free(MarcWriter *writer);
+
+/**
+ * @brief 전체 도서를 ID 순서로 MARC21 파일에 내보냅니다.
+ *
+ * 한 번에 한 행씩 읽어 바로 쓰므로 도서 수와 관계없이 메모리를 거의 쓰지 않습니다.
+ *
+ * @param db 데이터베이스 연결
+ * @param path 출력 파일 경로 (있으면 덮어씀)
+ * @param exported 내보낸 도서 수를 저장할 포인터 (NULL 가능)
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환
+ */
+int marc_export_books(sqlite3 *db, const char *path, long long *exported);
+
+#endif // MARC_H
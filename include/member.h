@@ -1,6 +1,7 @@
 #ifndef MEMBER_H
 #define MEMBER_H
 
+#include <stddef.h>
 #include <sqlite3.h>
 #include "types.h"
 #include "constants.h"
@@ -27,6 +28,8 @@ int get_member_by_id(sqlite3 *db, int member_id, Member *member);
 /**
  * @brief 이메일로 회원을 조회합니다.
  * 
+ * 대소문자와 앞뒤 공백을 구분하지 않습니다.
+ * 
  * @param db 데이터베이스 연결 포인터
  * @param email 조회할 이메일
  * @param member 조회된 회원 정보를 저장할 포인터
@@ -37,8 +40,11 @@ int get_member_by_email(sqlite3 *db, const char *email, Member *member);
 /**
  * @brief 이름으로 회원을 검색합니다.
  * 
+ * 공백/대소문자를 무시하고 한글을 자모로 분해한 이름의 접두어로 인덱스 범위 조회합니다.
+ * 초성만 입력하면(예: "ㄱㅁㅅ") 초성 컬럼에서 찾습니다.
+ * 
  * @param db 데이터베이스 연결 포인터
- * @param name 검색할 이름 (부분 검색 가능)
+ * @param name 검색할 이름 또는 초성 (앞부분 검색)
  * @param result 검색 결과를 저장할 포인터
  * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환
  */
@@ -47,8 +53,11 @@ int search_members_by_name(sqlite3 *db, const char *name, MemberSearchResult *re
 /**
  * @brief 전화번호로 회원을 검색합니다.
  * 
+ * 입력한 숫자로 끝나는 전화번호를 찾습니다. 하이픈 등 구분 문자는 무시하며,
+ * 뒤집은 숫자 컬럼의 인덱스를 접두어 범위로 조회합니다.
+ * 
  * @param db 데이터베이스 연결 포인터
- * @param phone 검색할 전화번호 (부분 검색 가능)
+ * @param phone 검색할 전화번호 또는 끝자리 (예: "5678")
  * @param result 검색 결과를 저장할 포인터
  * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환
  */
@@ -178,6 +187,38 @@ int validate_email(const char *email);
  */
 int validate_phone(const char *phone);
 
+/**
+ * @brief 이메일을 저장/조회용 형태로 정규화합니다.
+ * 
+ * 앞뒤 공백을 제거하고 영문을 소문자로 바꿉니다.
+ * 
+ * @param email 원본 이메일
+ * @param normalized 정규화된 이메일을 저장할 버퍼
+ * @param normalized_size 버퍼 크기
+ * @return int 성공 시 SUCCESS, 비어 있거나 버퍼가 부족하면 FAILURE 반환
+ */
+int normalize_email(const char *email, char *normalized, size_t normalized_size);
+
+/**
+ * @brief 전화번호를 검증하고 숫자만 남긴 형태로 변환합니다.
+ * 
+ * @param phone 검증할 전화번호 (숫자, 하이픈, 공백, 괄호 허용)
+ * @param digits 숫자만 남긴 전화번호를 저장할 버퍼
+ * @param digits_size 버퍼 크기
+ * @return int 유효하면 SUCCESS, 무효하면 FAILURE 반환
+ */
+int normalize_phone(const char *phone, char *digits, size_t digits_size);
+
+/**
+ * @brief 전화번호 검색 컬럼이 비어 있는 기존 회원을 채웁니다.
+ * 
+ * PHONE_BACKFILL_BATCH_SIZE건씩 나누어 커밋하므로 회원이 많아도 쓰기 잠금을 오래 잡지 않습니다.
+ * 
+ * @param db 데이터베이스 연결 포인터
+ * @return int 채운 회원 수, 실패 시 FAILURE 반환
+ */
+int backfill_member_phone_digits(sqlite3 *db);
+
 /**
  * @brief 회원 정보를 출력합니다.
  * 
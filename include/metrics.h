@@ -0,0 +1,173 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <stdio.h>
+#include "constants.h"
+
+/**
+ * @brief 지연 시간을 기록하는 공개 API 목록 (함수마다 히스토그램 하나)
+ */
+typedef enum {
+    // 도서
+    METRIC_ADD_BOOK = 0,
+    METRIC_GET_BOOK_BY_ID,
+    METRIC_GET_BOOK_BY_ISBN,
+    METRIC_SEARCH_BOOKS_BY_TITLE,
+    METRIC_SEARCH_BOOKS_BY_AUTHOR,
+    METRIC_SEARCH_BOOKS_BY_CATEGORY,
+    METRIC_UPDATE_BOOK,
+    METRIC_DELETE_BOOK,
+    METRIC_LIST_ALL_BOOKS,
+    METRIC_LIST_AVAILABLE_BOOKS,
+    METRIC_GET_POPULAR_BOOKS,
+
+    // 회원
+    METRIC_ADD_MEMBER,
+    METRIC_GET_MEMBER_BY_ID,
+    METRIC_GET_MEMBER_BY_EMAIL,
+    METRIC_SEARCH_MEMBERS_BY_NAME,
+    METRIC_SEARCH_MEMBERS_BY_PHONE,
+    METRIC_UPDATE_MEMBER,
+    METRIC_DELETE_MEMBER,
+    METRIC_DEACTIVATE_MEMBER,
+    METRIC_ACTIVATE_MEMBER,
+    METRIC_LIST_ALL_MEMBERS,
+    METRIC_LIST_ACTIVE_MEMBERS,
+    METRIC_GET_MEMBER_LOAN_STATS,
+    METRIC_CHECK_MEMBER_LOAN_ELIGIBILITY,
+    METRIC_BACKFILL_MEMBER_PHONE_DIGITS,
+
+    // 대출
+    METRIC_LOAN_BOOK,
+    METRIC_LOAN_BOOK_IDEMPOTENT,
+    METRIC_RETURN_BOOK,
+    METRIC_RETURN_BOOK_IDEMPOTENT,
+    METRIC_RETURN_BOOK_BY_IDS,
+    METRIC_RETURN_BOOK_BY_IDS_IDEMPOTENT,
+    METRIC_EXTEND_LOAN,
+    METRIC_EXTEND_LOAN_IDEMPOTENT,
+    METRIC_PURGE_EXPIRED_LOAN_REQUESTS,
+    METRIC_SHIFT_DUE_DATES,
+    METRIC_GET_LOAN_BY_ID,
+    METRIC_GET_MEMBER_LOAN_HISTORY,
+    METRIC_GET_MEMBER_CURRENT_LOANS,
+    METRIC_GET_BOOK_LOAN_HISTORY,
+    METRIC_GET_OVERDUE_LOANS,
+    METRIC_GET_LOANS_DUE_ON_DATE,
+    METRIC_GET_CURRENT_LOANS,
+    METRIC_GET_LOAN_STATISTICS,
+    METRIC_GET_POPULAR_BOOKS_BY_LOANS,
+    METRIC_CHECK_LOAN_AVAILABILITY,
+    METRIC_CHECK_DUPLICATE_LOAN,
+
+    METRIC_COUNT
+} MetricId;
+
+/**
+ * @brief 히스토그램 요약 (시간 단위는 나노초)
+ */
+typedef struct {
+    const char *name;          /**< API 함수 이름 */
+    long long count;           /**< 호출 수 */
+    long long failures;        /**< FAILURE를 반환한 호출 수 */
+    long long sum;             /**< 걸린 시간 합계 */
+    long long mean;            /**< 평균 */
+    long long p50;             /**< 중앙값 */
+    long long p95;             /**< 95번째 백분위수 */
+    long long p99;             /**< 99번째 백분위수 */
+    long long max;             /**< 최댓값 (정확한 값) */
+} MetricSummary;
+
+/**
+ * @brief 측정 시작 시각을 반환합니다.
+ *
+ * @return long long 단조 증가 시계 기준 나노초
+ */
+long long metrics_start(void);
+
+/**
+ * @brief 시작 시각부터 지금까지 걸린 시간과 호출 결과를 기록합니다.
+ *
+ * 바깥쪽 호출만 기록합니다. loan_book()이 안에서 get_book_by_id() 등을 불러도
+ * loan_book 히스토그램에 한 번만 들어갑니다.
+ *
+ * @param id 기록할 API
+ * @param start_ns metrics_start()가 반환한 시각
+ * @param status API 반환값 (FAILURE면 실패 호출로 셈)
+ */
+void metrics_record_since(MetricId id, long long start_ns, int status);
+
+/**
+ * @brief 현재 스레드에서 진행 중인 공개 API 호출 깊이를 반환합니다.
+ *
+ * metrics_start()마다 1 늘고 metrics_record_since()마다 1 줄어듭니다.
+ * metrics_record_since() 직후에 0이면 바깥쪽 호출이 끝난 것입니다.
+ *
+ * @return int 진행 중인 호출 수
+ */
+int metrics_call_depth(void);
+
+/**
+ * @brief 걸린 시간을 히스토그램에 기록합니다.
+ *
+ * 값은 로그 구간(2의 거듭제곱마다 16개로 나눈 구간)에 들어가므로
+ * 백분위수의 상대 오차는 1/16 이내입니다.
+ * 잠금 없이 원자적으로 더하므로 여러 스레드에서 동시에 호출할 수 있습니다.
+ *
+ * @param id 기록할 API
+ * @param elapsed_ns 걸린 시간 (나노초)
+ */
+void metrics_record(MetricId id, long long elapsed_ns);
+
+/**
+ * @brief API 이름을 반환합니다.
+ *
+ * @param id API
+ * @return const char* API 함수 이름, 범위를 벗어나면 NULL
+ */
+const char *metrics_name(MetricId id);
+
+/**
+ * @brief 히스토그램 요약을 계산합니다.
+ *
+ * @param id API
+ * @param summary 요약을 저장할 포인터
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환
+ */
+int metrics_get_summary(MetricId id, MetricSummary *summary);
+
+/**
+ * @brief 경계값마다 그 이하로 걸린 호출 수를 셉니다.
+ *
+ * 경계가 히스토그램 칸 사이에 걸리면 그 칸은 경계를 넘은 것으로 셉니다.
+ *
+ * @param id API
+ * @param bounds_ns 오름차순 경계값 배열 (나노초)
+ * @param bound_count 경계값 수
+ * @param counts 경계값별 누적 호출 수를 저장할 배열
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환
+ */
+int metrics_get_cumulative_counts(MetricId id, const long long *bounds_ns, int bound_count, long long *counts);
+
+/**
+ * @brief 모든 히스토그램을 비웁니다.
+ */
+void metrics_reset(void);
+
+/**
+ * @brief 호출 기록이 있는 API의 요약 표를 출력합니다.
+ *
+ * @param output 출력 스트림
+ * @return int 출력한 API 수
+ */
+int metrics_print(FILE *output);
+
+/**
+ * @brief 요약 표를 파일에 저장합니다.
+ *
+ * @param file_path 저장할 파일 경로
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환
+ */
+int metrics_dump(const char *file_path);
+
+#endif // METRICS_H
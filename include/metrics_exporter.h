@@ -0,0 +1,61 @@
+#ifndef METRICS_EXPORTER_H
+#define METRICS_EXPORTER_H
+
+#include <stddef.h>
+#include <sqlite3.h>
+#include "constants.h"
+
+/**
+ * @brief 지표 내보내기 설정
+ */
+typedef struct {
+    char textfile_path[MAX_PATH_LENGTH];   /**< node_exporter textfile 수집기용 파일 (비어 있으면 사용 안 함) */
+    char socket_path[MAX_PATH_LENGTH];     /**< 유닉스 도메인 소켓 경로 (비어 있으면 사용 안 함, Windows 미지원) */
+    int interval_seconds;                  /**< 파일 갱신 주기 (초) */
+} MetricsExporterConfig;
+
+/**
+ * @brief 현재 지표를 Prometheus 텍스트 형식으로 만듭니다.
+ *
+ * API별 호출 수(성공/실패), 지연 시간 히스토그램, 대출 현황, SQLite 메모리/캐시/WAL 크기,
+ * 로거 통계를 포함합니다.
+ *
+ * @param db 데이터베이스 연결 (NULL이면 데이터베이스 지표 생략)
+ * @param text 결과 문자열을 받을 포인터 (호출자가 free로 해제)
+ * @param length 결과 길이를 받을 포인터 (NULL 가능)
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환
+ */
+int metrics_format_prometheus(sqlite3 *db, char **text, size_t *length);
+
+/**
+ * @brief 지표를 파일에 씁니다.
+ *
+ * 수집기가 쓰다 만 파일을 읽지 않도록 임시 파일에 쓴 뒤 이름을 바꿉니다.
+ *
+ * @param db 데이터베이스 연결
+ * @param file_path 저장할 파일 경로 (.prom)
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환
+ */
+int metrics_write_textfile(sqlite3 *db, const char *file_path);
+
+/**
+ * @brief 지표 내보내기 스레드를 시작합니다.
+ *
+ * 설정한 주기마다 파일을 갱신하고, 소켓 경로가 있으면 연결마다 현재 지표를 보내고
+ * 연결을 닫습니다 (HTTP GET 요청이면 HTTP 응답으로 보냄).
+ * 이미 시작된 경우 기존 스레드를 종료한 뒤 다시 시작합니다.
+ *
+ * @param db 데이터베이스 연결
+ * @param config 내보내기 설정
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환
+ */
+int metrics_exporter_start(sqlite3 *db, const MetricsExporterConfig *config);
+
+/**
+ * @brief 지표 내보내기 스레드를 종료합니다.
+ *
+ * 파일 경로가 설정되어 있으면 종료 직전의 지표를 한 번 더 씁니다.
+ */
+void metrics_exporter_stop(void);
+
+#endif // METRICS_EXPORTER_H
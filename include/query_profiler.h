@@ -0,0 +1,85 @@
+#ifndef QUERY_PROFILER_H
+#define QUERY_PROFILER_H
+
+#include <stdio.h>
+#include <sqlite3.h>
+#include "constants.h"
+
+/**
+ * @brief 정규화된 SQL 문장 하나의 누적 실행 통계 (시간 단위는 나노초)
+ */
+typedef struct {
+    char sql[QUERY_PROFILER_SQL_LENGTH];   /**< 리터럴을 ?로 바꾼 SQL */
+    long long count;                       /**< 실행 횟수 */
+    long long total_time;                  /**< 실행 시간 합계 */
+    long long max_time;                    /**< 가장 오래 걸린 실행 시간 */
+    long long fullscan_steps;              /**< 전체 테이블 스캔으로 넘긴 행 수 */
+    long long sorts;                       /**< 인덱스 없이 정렬한 횟수 */
+    long long autoindex_rows;              /**< 임시 자동 인덱스에 넣은 행 수 */
+    long long vm_steps;                    /**< 가상 머신 실행 단계 수 */
+    long long slow_count;                  /**< 느린 쿼리 기준을 넘은 횟수 */
+} QueryProfileEntry;
+
+/**
+ * @brief SQL 프로파일러를 설정합니다.
+ *
+ * 사용하도록 설정하면 이후 database_init으로 여는 연결마다 실행 통계를 모읍니다.
+ *
+ * @param enabled TRUE면 사용
+ * @param slow_threshold_ms 이 시간(ms) 이상 걸린 문장을 느린 쿼리 로그에 남김 (음수면 남기지 않음)
+ * @param slow_log_path 느린 쿼리 로그 파일 (NULL이면 애플리케이션 로그에 남김)
+ * @return int 성공 시 SUCCESS, 로그 파일을 열 수 없으면 FAILURE 반환
+ */
+int query_profiler_configure(int enabled, long long slow_threshold_ms, const char *slow_log_path);
+
+/**
+ * @brief SQL 프로파일러 사용 여부를 반환합니다.
+ *
+ * @return int 사용 중이면 TRUE, 아니면 FALSE
+ */
+int query_profiler_is_enabled(void);
+
+/**
+ * @brief 연결에 sqlite3_trace_v2 콜백을 등록합니다.
+ *
+ * @param db 데이터베이스 연결
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환
+ */
+int query_profiler_attach(sqlite3 *db);
+
+/**
+ * @brief SQL 문장을 통계용으로 정규화합니다.
+ *
+ * 문자열/숫자 리터럴을 ?로 바꾸고 연속된 공백을 하나로 줄입니다.
+ * 너무 길면 잘립니다.
+ *
+ * @param sql 원본 SQL
+ * @param normalized 결과를 저장할 버퍼
+ * @param normalized_size 버퍼 크기
+ */
+void query_profiler_normalize(const char *sql, char *normalized, size_t normalized_size);
+
+/**
+ * @brief 누적 통계를 총 실행 시간이 긴 순서로 복사합니다.
+ *
+ * @param entries 통계를 저장할 배열
+ * @param max_entries 배열 크기
+ * @return int 복사한 문장 수
+ */
+int query_profiler_get_top(QueryProfileEntry *entries, int max_entries);
+
+/**
+ * @brief 총 실행 시간이 긴 문장 순으로 보고서를 출력합니다.
+ *
+ * @param output 출력 스트림
+ * @param top_n 출력할 최대 문장 수
+ * @return int 출력한 문장 수
+ */
+int query_profiler_report(FILE *output, int top_n);
+
+/**
+ * @brief 누적 통계를 비웁니다.
+ */
+void query_profiler_reset(void);
+
+#endif // QUERY_PROFILER_H
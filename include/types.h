@@ -78,4 +78,20 @@ typedef struct {
     int capacity;              /**< 배열 용량 */
 } LoanSearchResult;
 
+/**
+ * @brief 날짜 구간을 나타내는 구조체
+ */
+typedef struct {
+    time_t start;              /**< 구간 시작 시각 (포함) */
+    time_t end;                /**< 구간 종료 시각 (포함) */
+} DateRange;
+
+/**
+ * @brief 연결별 잠금 대기 통계를 위한 구조체
+ */
+typedef struct {
+    long long retries;         /**< 잠금 대기 재시도 횟수 */
+    long long timeouts;        /**< 최대 재시도 후에도 잠금을 얻지 못한 횟수 */
+} DatabaseBusyStats;
+
 #endif // TYPES_H
@@ -31,6 +31,7 @@ time_t add_days_to_time(time_t base_time, int days);
 int get_days_difference(time_t start_time, time_t end_time);
 int is_future_date(time_t date);
 int is_past_date(time_t date);
+void time_to_sql_string(time_t time_val, char *buffer, size_t buffer_size);
 
 // 메모리 관리 유틸리티 함수들
 void* safe_malloc(size_t size);
@@ -76,6 +77,7 @@ typedef enum {
 
 int init_logging(const char *log_file_path);
 void log_message(LogLevel level, const char *format, ...);
+void set_log_level(LogLevel level);
 void close_logging(void);
 
 // 설정 관리 유틸리티 함수들
@@ -87,19 +89,30 @@ typedef struct {
     int max_renewal_count;
     int auto_backup_enabled;
     int log_level;
+    int log_max_size_kb;
+    int log_rotate_daily;
+    int log_retention_count;
+    char metrics_textfile_path[MAX_PATH_LENGTH];
+    char metrics_socket_path[MAX_PATH_LENGTH];
+    int metrics_interval_seconds;
+    int sql_profile_enabled;
+    int slow_query_threshold_ms;
+    char slow_query_log_path[MAX_PATH_LENGTH];
+    char workload_trace_path[MAX_PATH_LENGTH];
 } SystemConfig;
 
 int load_config(const char *config_file, SystemConfig *config);
 int save_config(const char *config_file, const SystemConfig *config);
 void init_default_config(SystemConfig *config);
 
-// 성능 측정 유틸리티 함수들
+// 성능 측정 유틸리티 함수들 (단조 증가 시계 기준이므로 I/O 대기 시간도 포함)
 typedef struct {
-    clock_t start_time;
-    clock_t end_time;
-    double elapsed_time;
+    long long start_time;      // 나노초
+    long long end_time;        // 나노초
+    double elapsed_time;       // 초
 } Timer;
 
+long long timer_now_nanoseconds(void);
 void timer_start(Timer *timer);
 void timer_stop(Timer *timer);
 double timer_get_elapsed_seconds(const Timer *timer);
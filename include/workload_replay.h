@@ -0,0 +1,64 @@
+#ifndef WORKLOAD_REPLAY_H
+#define WORKLOAD_REPLAY_H
+
+#include <stdio.h>
+#include <sqlite3.h>
+#include "metrics.h"
+#include "constants.h"
+
+/**
+ * @brief 재실행 속도
+ */
+typedef enum {
+    WORKLOAD_REPLAY_FAST = 0,      /**< 기다리지 않고 연달아 실행 */
+    WORKLOAD_REPLAY_ORIGINAL = 1   /**< 기록된 호출 간격을 지켜 실행 */
+} WorkloadReplayMode;
+
+/**
+ * @brief API 하나의 재실행 비교 결과
+ *
+ * 지연 시간 요약의 백분위수는 표본을 정렬해 구한 정확한 값입니다.
+ */
+typedef struct {
+    MetricSummary captured;    /**< 기록된 호출의 지연 시간 요약 */
+    MetricSummary replayed;    /**< 재실행한 호출의 지연 시간 요약 */
+    long long result_mismatches;   /**< 반환값이 기록과 다른 호출 수 */
+} WorkloadReplayComparison;
+
+/**
+ * @brief 재실행 결과
+ */
+typedef struct {
+    WorkloadReplayComparison apis[METRIC_COUNT];   /**< API별 비교 결과 */
+    long long replayed;        /**< 재실행한 호출 수 */
+    long long result_mismatches;   /**< 반환값이 기록과 다른 호출 수 합계 */
+    double captured_seconds;   /**< 기록된 첫 호출 시작부터 마지막 호출 끝까지 걸린 시간 */
+    double replay_seconds;     /**< 재실행에 걸린 시간 */
+} WorkloadReplayReport;
+
+/**
+ * @brief 트레이스 파일의 호출을 데이터베이스에 다시 실행합니다.
+ *
+ * 호출은 기록된 순서(호출이 끝난 순서)대로 한 연결에서 차례로 실행합니다.
+ * 데이터베이스를 바꾸므로 기록 시작 시점 사본을 복사한 데이터베이스에 실행해야 합니다.
+ *
+ * @param db 재실행할 데이터베이스 연결
+ * @param trace_path 트레이스 파일 경로
+ * @param mode 재실행 속도
+ * @param speed WORKLOAD_REPLAY_ORIGINAL일 때 배속 (2.0이면 간격을 절반으로, 0 이하이면 1.0)
+ * @param report 결과를 저장할 구조체
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환
+ */
+int workload_replay(sqlite3 *db, const char *trace_path, WorkloadReplayMode mode, double speed,
+                    WorkloadReplayReport *report);
+
+/**
+ * @brief 기록과 재실행의 API별 지연 시간 분포를 비교한 표를 출력합니다.
+ *
+ * @param output 출력 스트림
+ * @param report workload_replay()의 결과
+ * @return int 출력한 API 수
+ */
+int workload_replay_print_report(FILE *output, const WorkloadReplayReport *report);
+
+#endif // WORKLOAD_REPLAY_H
@@ -0,0 +1,126 @@
+#ifndef WORKLOAD_TRACE_H
+#define WORKLOAD_TRACE_H
+
+#include <stdio.h>
+#include <sqlite3.h>
+#include "metrics.h"
+#include "constants.h"
+
+/**
+ * @brief 기록된 인자 종류
+ */
+typedef enum {
+    TRACE_ARG_INT = 'i',       /**< 정수 (time_t 포함) */
+    TRACE_ARG_STRING = 's'     /**< 문자열 (NULL 가능) */
+} TraceArgType;
+
+/**
+ * @brief 기록된 인자 하나
+ */
+typedef struct {
+    TraceArgType type;         /**< 인자 종류 */
+    long long integer;         /**< 정수 값 */
+    const char *string;        /**< 문자열 값 (레코드의 string_pool을 가리킴, NULL 가능) */
+} TraceArg;
+
+/**
+ * @brief 트레이스 파일의 호출 기록 하나
+ *
+ * 도서/회원/날짜 구간 구조체 인자는 필드별 인자로 풀어서 기록됩니다.
+ * 호출 결과를 돌려받는 출력 인자는 기록하지 않습니다.
+ */
+typedef struct {
+    MetricId api;              /**< 호출한 공개 API */
+    int thread;                /**< 호출한 스레드 번호 (기록 순서대로 1부터) */
+    long long start_offset_ns; /**< 기록 시작부터 호출 시작까지 걸린 시간 */
+    long long latency_ns;      /**< 호출에 걸린 시간 */
+    int result;                /**< 반환값 */
+    int arg_count;             /**< 인자 수 */
+    TraceArg args[WORKLOAD_TRACE_MAX_ARGS];   /**< 인자 */
+    char string_pool[WORKLOAD_TRACE_RECORD_SIZE];   /**< 문자열 인자 저장 공간 */
+} TraceRecord;
+
+/**
+ * @brief 트레이스 파일 읽기 상태
+ */
+typedef struct {
+    FILE *file;                /**< 트레이스 파일 */
+    int version;               /**< 파일 형식 버전 */
+    long long start_time_ns;   /**< 기록을 시작한 시각 (Unix epoch 기준 나노초) */
+    long long last_start_offset_ns;   /**< 직전 레코드의 시작 시각 (차이값 복원용) */
+} TraceReader;
+
+/**
+ * @brief 공개 API 호출 기록을 시작합니다.
+ *
+ * 이후 모든 스레드의 바깥쪽 공개 API 호출(API 안에서 부른 API는 제외)이
+ * 함수, 인자, 시작 시각, 반환값, 걸린 시간과 함께 이진 파일에 기록됩니다.
+ * snapshot_db를 주면 기록 시작 시점의 데이터베이스를 trace_path + ".db"로 복사해 두어
+ * 같은 상태에서 재실행할 수 있게 합니다.
+ *
+ * @param trace_path 트레이스 파일 경로 (있으면 덮어씀)
+ * @param snapshot_db 사본을 만들 데이터베이스 연결 (NULL이면 사본 없음)
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환
+ */
+int workload_trace_start(const char *trace_path, sqlite3 *snapshot_db);
+
+/**
+ * @brief 호출 기록을 멈추고 파일을 닫습니다.
+ *
+ * @return int 성공 시 SUCCESS, 기록 중이 아니거나 쓰기에 실패하면 FAILURE 반환
+ */
+int workload_trace_stop(void);
+
+/**
+ * @brief 호출을 기록하는 중인지 확인합니다.
+ *
+ * @return int 기록 중이면 TRUE, 아니면 FALSE
+ */
+int workload_trace_is_active(void);
+
+/**
+ * @brief 공개 API 호출 하나를 기록합니다.
+ *
+ * metrics_record_since() 직후에 호출하며, 기록 중이 아니거나 다른 API 안에서 부른 호출이면 무시합니다.
+ * 뒤따르는 인자는 API별로 정해진 순서를 따릅니다 (정수, time_t, 문자열, const Book*, const Member*, const DateRange*).
+ *
+ * @param api 호출한 API
+ * @param start_ns metrics_start()가 반환한 시각
+ * @param result API 반환값
+ */
+void workload_trace_record(MetricId api, long long start_ns, int result, ...);
+
+/**
+ * @brief 지금까지 기록한 호출 수와 기록하지 못한 호출 수를 반환합니다.
+ *
+ * @param dropped 너무 커서 기록하지 못한 호출 수를 저장할 포인터 (NULL 가능)
+ * @return long long 기록한 호출 수
+ */
+long long workload_trace_get_count(long long *dropped);
+
+/**
+ * @brief 트레이스 파일을 읽기 위해 엽니다.
+ *
+ * @param reader 읽기 상태
+ * @param trace_path 트레이스 파일 경로
+ * @return int 성공 시 SUCCESS, 실패 시 FAILURE 반환
+ */
+int workload_trace_open(TraceReader *reader, const char *trace_path);
+
+/**
+ * @brief 다음 호출 기록을 읽습니다 (파일에 기록된 순서, 즉 호출이 끝난 순서).
+ *
+ * @param reader 읽기 상태
+ * @param record 읽은 기록을 저장할 구조체
+ * @return int 읽었으면 TRUE, 파일 끝이면 FALSE, 손상된 파일이면 FAILURE 반환
+ */
+int workload_trace_next(TraceReader *reader, TraceRecord *record);
+
+/**
+ * @brief 트레이스 파일을 닫습니다.
+ *
+ * @param reader 읽기 상태
+ */
+void workload_trace_close(TraceReader *reader);
+
+#endif // WORKLOAD_TRACE_H
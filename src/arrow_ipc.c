@@ -0,0 +1,842 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include "../include/arrow_ipc.h"
+
+// Arrow 형식 정의의 값 (format/Schema.fbs, Message.fbs, File.fbs)
+#define ARROW_MAGIC "ARROW1"
+#define ARROW_MAGIC_LENGTH 6
+#define CONTINUATION_MARKER 0xFFFFFFFFu
+#define METADATA_VERSION_V5 4
+#define TYPE_INT 2
+#define TYPE_UTF8 5
+#define TYPE_BOOL 6
+#define TYPE_TIMESTAMP 10
+#define HEADER_SCHEMA 1
+#define HEADER_DICTIONARY_BATCH 2
+#define HEADER_RECORD_BATCH 3
+#define TIME_UNIT_SECOND 0
+#define ENDIANNESS_LITTLE 0
+#define ENDIANNESS_BIG 1
+
+#define MAX_BUFFERS_PER_COLUMN 3
+
+// ---------------------------------------------------------------------------
+// FlatBuffers 작성
+//
+// 보통의 FlatBuffers 빌더는 뒤에서 앞으로 쓰지만, 여기서는 부모를 먼저 쓰고 자식 위치를 나중에 채워
+// 앞으로만 씁니다. 모든 오프셋이 뒤쪽을 가리키므로 형식 검증기의 조건을 그대로 만족합니다.
+// ---------------------------------------------------------------------------
+
+#define FB_ABSENT 0                // 기본값을 쓰므로 vtable에 없음
+#define FB_OFFSET -1               // 나중에 fb_patch()로 채울 4바이트 오프셋
+#define FB_MAX_FIELDS 8
+
+typedef struct {
+    int size;                      // 1, 2, 4, 8바이트 스칼라, FB_ABSENT 또는 FB_OFFSET
+    long long value;
+} FbField;
+
+static void buffer_reserve(ArrowBuffer *buffer, size_t extra) {
+    if (buffer->length + extra <= buffer->capacity) {
+        return;
+    }
+    size_t capacity = buffer->capacity ? buffer->capacity : 1024;
+    while (capacity < buffer->length + extra) {
+        capacity *= 2;
+    }
+    unsigned char *data = realloc(buffer->data, capacity);
+    if (!data) {
+        buffer->error = TRUE;
+        return;
+    }
+    buffer->data = data;
+    buffer->capacity = capacity;
+}
+
+// FlatBuffers와 메시지 접두사는 호스트와 관계없이 리틀 엔디언
+static void buffer_put(ArrowBuffer *buffer, unsigned long long value, int size) {
+    buffer_reserve(buffer, (size_t)size);
+    if (buffer->error) {
+        return;
+    }
+    for (int i = 0; i < size; i++) {
+        buffer->data[buffer->length++] = (unsigned char)(value >> (8 * i));
+    }
+}
+
+static void buffer_set(ArrowBuffer *buffer, size_t position, unsigned long long value, int size) {
+    if (buffer->error) {
+        return;
+    }
+    for (int i = 0; i < size; i++) {
+        buffer->data[position + (size_t)i] = (unsigned char)(value >> (8 * i));
+    }
+}
+
+static void buffer_pad(ArrowBuffer *buffer, size_t alignment) {
+    while (!buffer->error && buffer->length % alignment != 0) {
+        buffer_put(buffer, 0, 1);
+    }
+}
+
+// slot 위치의 오프셋이 target을 가리키게 함
+static void fb_patch(ArrowBuffer *buffer, size_t slot, size_t target) {
+    buffer_set(buffer, slot, target - slot, 4);
+}
+
+// vtable과 테이블을 쓰고 테이블 위치를 반환. 오프셋 필드의 위치는 slots에 저장
+static size_t fb_table(ArrowBuffer *buffer, const FbField *fields, int count, size_t *slots) {
+    size_t positions[FB_MAX_FIELDS];
+
+    buffer_pad(buffer, 2);
+    size_t vtable = buffer->length;
+    size_t vtable_size = 4 + 2 * (size_t)count;
+    size_t table = (vtable + vtable_size + 7) & ~(size_t)7;
+
+    size_t cursor = table + 4;
+    for (int i = 0; i < count; i++) {
+        if (fields[i].size == FB_ABSENT) {
+            positions[i] = 0;
+            continue;
+        }
+        size_t size = fields[i].size == FB_OFFSET ? 4 : (size_t)fields[i].size;
+        cursor = (cursor + size - 1) & ~(size - 1);
+        positions[i] = cursor;
+        cursor += size;
+    }
+    cursor = (cursor + 3) & ~(size_t)3;
+
+    buffer_put(buffer, vtable_size, 2);
+    buffer_put(buffer, cursor - table, 2);
+    for (int i = 0; i < count; i++) {
+        buffer_put(buffer, positions[i] ? positions[i] - table : 0, 2);
+    }
+    while (!buffer->error && buffer->length < table) {
+        buffer_put(buffer, 0, 1);
+    }
+    buffer_put(buffer, table - vtable, 4);   // vtable = table - soffset
+
+    for (int i = 0; i < count; i++) {
+        if (!positions[i]) {
+            continue;
+        }
+        while (!buffer->error && buffer->length < positions[i]) {
+            buffer_put(buffer, 0, 1);
+        }
+        if (fields[i].size == FB_OFFSET) {
+            if (slots) {
+                slots[i] = positions[i];
+            }
+            buffer_put(buffer, 0, 4);
+        } else {
+            buffer_put(buffer, (unsigned long long)fields[i].value, fields[i].size);
+        }
+    }
+    while (!buffer->error && buffer->length < cursor) {
+        buffer_put(buffer, 0, 1);
+    }
+    return table;
+}
+
+static size_t fb_string(ArrowBuffer *buffer, const char *text) {
+    size_t length = strlen(text);
+    buffer_pad(buffer, 4);
+    size_t position = buffer->length;
+    buffer_put(buffer, length, 4);
+    buffer_reserve(buffer, length + 1);
+    if (!buffer->error) {
+        memcpy(buffer->data + buffer->length, text, length + 1);
+        buffer->length += length + 1;
+    }
+    return position;
+}
+
+// 벡터 길이를 쓰고 위치를 반환 (원소는 alignment에 맞춰 바로 뒤에 옴)
+static size_t fb_vector(ArrowBuffer *buffer, size_t count, size_t alignment) {
+    while (!buffer->error && (buffer->length + 4) % alignment != 0) {
+        buffer_put(buffer, 0, 1);
+    }
+    size_t position = buffer->length;
+    buffer_put(buffer, count, 4);
+    return position;
+}
+
+// 자식 테이블을 가리킬 오프셋 벡터 (원소 i는 position + 4 + 4 * i)
+static size_t fb_offset_vector(ArrowBuffer *buffer, size_t count) {
+    size_t position = fb_vector(buffer, count, 4);
+    for (size_t i = 0; i < count; i++) {
+        buffer_put(buffer, 0, 4);
+    }
+    return position;
+}
+
+// ---------------------------------------------------------------------------
+// 스키마와 메시지 메타데이터
+// ---------------------------------------------------------------------------
+
+static int host_is_little_endian(void) {
+    const unsigned short probe = 1;
+    return *(const unsigned char*)&probe == 1;
+}
+
+static size_t write_int_type(ArrowBuffer *buffer, int bit_width) {
+    FbField fields[] = { { 4, bit_width }, { 1, TRUE } };
+    return fb_table(buffer, fields, 2, NULL);
+}
+
+static int type_id(ArrowColumnType type) {
+    switch (type) {
+        case ARROW_COLUMN_INT32:
+        case ARROW_COLUMN_INT64:
+            return TYPE_INT;
+        case ARROW_COLUMN_BOOL:
+            return TYPE_BOOL;
+        case ARROW_COLUMN_TIMESTAMP:
+            return TYPE_TIMESTAMP;
+        default:
+            return TYPE_UTF8;
+    }
+}
+
+// Field.type 테이블 (사전 인코딩 열은 값의 자료형인 Utf8)
+static size_t write_type(ArrowBuffer *buffer, ArrowColumnType type) {
+    switch (type) {
+        case ARROW_COLUMN_INT32:
+            return write_int_type(buffer, 32);
+        case ARROW_COLUMN_INT64:
+            return write_int_type(buffer, 64);
+        case ARROW_COLUMN_TIMESTAMP: {
+            FbField fields[] = { { 2, TIME_UNIT_SECOND }, { FB_OFFSET, 0 } };
+            size_t slots[2];
+            size_t table = fb_table(buffer, fields, 2, slots);
+            fb_patch(buffer, slots[1], fb_string(buffer, "UTC"));
+            return table;
+        }
+        default:
+            // Bool, Utf8은 필드가 없는 테이블
+            return fb_table(buffer, NULL, 0, NULL);
+    }
+}
+
+static size_t write_schema(ArrowBuffer *buffer, const ArrowWriter *writer) {
+    FbField schema_fields[] = {
+        { 2, host_is_little_endian() ? ENDIANNESS_LITTLE : ENDIANNESS_BIG },
+        { FB_OFFSET, 0 },
+    };
+    size_t schema_slots[2];
+    size_t schema = fb_table(buffer, schema_fields, 2, schema_slots);
+    size_t vector = fb_offset_vector(buffer, (size_t)writer->column_count);
+    fb_patch(buffer, schema_slots[1], vector);
+
+    for (int i = 0; i < writer->column_count; i++) {
+        const ArrowColumnSpec *spec = &writer->columns[i].spec;
+        int dictionary = spec->type == ARROW_COLUMN_DICTIONARY;
+        FbField field_fields[] = {
+            { FB_OFFSET, 0 },                                   // name
+            { 1, spec->nullable ? TRUE : FALSE },               // nullable
+            { 1, type_id(spec->type) },                         // type_type
+            { FB_OFFSET, 0 },                                   // type
+            { dictionary ? FB_OFFSET : FB_ABSENT, 0 },          // dictionary
+            { FB_OFFSET, 0 },                                   // children (비어 있어도 있어야 함)
+        };
+        size_t slots[6];
+        size_t field = fb_table(buffer, field_fields, 6, slots);
+        fb_patch(buffer, vector + 4 + 4 * (size_t)i, field);
+        fb_patch(buffer, slots[0], fb_string(buffer, spec->name));
+        fb_patch(buffer, slots[3], write_type(buffer, spec->type));
+        if (dictionary) {
+            // 사전 ID는 열 위치
+            FbField encoding_fields[] = { { 8, i }, { FB_OFFSET, 0 }, { 1, FALSE } };
+            size_t encoding_slots[3];
+            size_t encoding = fb_table(buffer, encoding_fields, 3, encoding_slots);
+            fb_patch(buffer, slots[4], encoding);
+            fb_patch(buffer, encoding_slots[1], write_int_type(buffer, 32));
+        }
+        fb_patch(buffer, slots[5], fb_vector(buffer, 0, 4));
+    }
+    return schema;
+}
+
+// Message 테이블을 쓰고 header 오프셋 위치를 반환
+static size_t begin_message(ArrowBuffer *buffer, int header_type, long long body_length) {
+    buffer->length = 0;
+    buffer->error = FALSE;
+    buffer_put(buffer, 0, 4);
+    FbField fields[] = {
+        { 2, METADATA_VERSION_V5 },
+        { 1, header_type },
+        { FB_OFFSET, 0 },
+        { 8, body_length },
+    };
+    size_t slots[4];
+    size_t message = fb_table(buffer, fields, 4, slots);
+    fb_patch(buffer, 0, message);
+    return slots[2];
+}
+
+// layout: 열마다 (길이, NULL 수) 노드 다음에 (오프셋, 길이) 버퍼
+static size_t write_record_batch(ArrowBuffer *buffer, long long length, const long long *nodes, int node_count,
+                                 const long long *buffers, int buffer_count) {
+    FbField fields[] = { { 8, length }, { FB_OFFSET, 0 }, { FB_OFFSET, 0 } };
+    size_t slots[3];
+    size_t batch = fb_table(buffer, fields, 3, slots);
+
+    // FieldNode, Buffer 구조체는 int64 두 개
+    fb_patch(buffer, slots[1], fb_vector(buffer, (size_t)node_count, 8));
+    for (int i = 0; i < node_count * 2; i++) {
+        buffer_put(buffer, (unsigned long long)nodes[i], 8);
+    }
+    fb_patch(buffer, slots[2], fb_vector(buffer, (size_t)buffer_count, 8));
+    for (int i = 0; i < buffer_count * 2; i++) {
+        buffer_put(buffer, (unsigned long long)buffers[i], 8);
+    }
+    return batch;
+}
+
+// ---------------------------------------------------------------------------
+// 파일 쓰기
+// ---------------------------------------------------------------------------
+
+static void write_bytes(ArrowWriter *writer, const void *data, size_t length) {
+    if (writer->error || length == 0) {
+        return;
+    }
+    if (fwrite(data, 1, length, writer->file) != length) {
+        writer->error = TRUE;
+        return;
+    }
+    writer->offset += (long long)length;
+}
+
+static void write_padding(ArrowWriter *writer, size_t alignment) {
+    static const unsigned char zeros[64] = { 0 };
+    size_t remainder = (size_t)(writer->offset % (long long)alignment);
+    if (remainder != 0) {
+        write_bytes(writer, zeros, alignment - remainder);
+    }
+}
+
+static void write_u32(ArrowWriter *writer, unsigned int value) {
+    unsigned char bytes[4] = {
+        (unsigned char)value, (unsigned char)(value >> 8), (unsigned char)(value >> 16), (unsigned char)(value >> 24)
+    };
+    write_bytes(writer, bytes, 4);
+}
+
+// 접두사(계속 표시, 메타데이터 길이)와 8바이트로 맞춘 메타데이터를 씀
+static void emit_metadata(ArrowWriter *writer, long long body_length, ArrowBlock *block) {
+    ArrowBuffer *metadata = &writer->metadata;
+    buffer_pad(metadata, 8);
+    if (metadata->error) {
+        writer->error = TRUE;
+        return;
+    }
+    if (block) {
+        block->offset = writer->offset;
+        block->metadata_length = (int)(8 + metadata->length);
+        block->body_length = body_length;
+    }
+    write_u32(writer, CONTINUATION_MARKER);
+    write_u32(writer, (unsigned int)metadata->length);
+    write_bytes(writer, metadata->data, metadata->length);
+}
+
+static size_t padded(size_t length) {
+    return (length + ARROW_BUFFER_ALIGNMENT - 1) & ~(size_t)(ARROW_BUFFER_ALIGNMENT - 1);
+}
+
+// 열의 본문 버퍼 (NULL 비트맵, 값 또는 오프셋, 문자열)
+static int column_buffers(const ArrowColumn *column, int rows, const void **data, size_t *lengths) {
+    size_t bitmap_length = ((size_t)rows + 7) / 8;
+    data[0] = column->validity;
+    lengths[0] = column->null_count > 0 ? bitmap_length : 0;
+    data[1] = column->values;
+
+    switch (column->spec.type) {
+        case ARROW_COLUMN_INT32:
+        case ARROW_COLUMN_DICTIONARY:
+            lengths[1] = (size_t)rows * 4;
+            return 2;
+        case ARROW_COLUMN_INT64:
+        case ARROW_COLUMN_TIMESTAMP:
+            lengths[1] = (size_t)rows * 8;
+            return 2;
+        case ARROW_COLUMN_BOOL:
+            lengths[1] = bitmap_length;
+            return 2;
+        default:
+            lengths[1] = ((size_t)rows + 1) * 4;
+            data[2] = column->text;
+            lengths[2] = column->text_length;
+            return 3;
+    }
+}
+
+// 열들을 레코드 묶음 하나로 씀 (사전 묶음이면 dictionary_id 0 이상)
+static void write_batch(ArrowWriter *writer, const ArrowColumn *columns, int column_count, int rows,
+                        long long dictionary_id, ArrowBlock *block) {
+    long long *nodes = writer->layout;
+    long long *buffers = writer->layout + (size_t)column_count * 2;
+    int buffer_count = 0;
+    long long body_length = 0;
+
+    for (int i = 0; i < column_count; i++) {
+        const void *column_data[MAX_BUFFERS_PER_COLUMN];
+        size_t lengths[MAX_BUFFERS_PER_COLUMN];
+        int count = column_buffers(&columns[i], rows, column_data, lengths);
+        nodes[i * 2] = rows;
+        nodes[i * 2 + 1] = columns[i].null_count;
+        for (int j = 0; j < count; j++) {
+            buffers[buffer_count * 2] = body_length;
+            buffers[buffer_count * 2 + 1] = (long long)lengths[j];
+            body_length += (long long)padded(lengths[j]);
+            buffer_count++;
+        }
+    }
+
+    ArrowBuffer *metadata = &writer->metadata;
+    if (dictionary_id >= 0) {
+        size_t header_slot = begin_message(metadata, HEADER_DICTIONARY_BATCH, body_length);
+        FbField fields[] = { { 8, dictionary_id }, { FB_OFFSET, 0 }, { 1, FALSE } };
+        size_t slots[3];
+        size_t dictionary = fb_table(metadata, fields, 3, slots);
+        fb_patch(metadata, header_slot, dictionary);
+        fb_patch(metadata, slots[1], write_record_batch(metadata, rows, nodes, column_count, buffers, buffer_count));
+    } else {
+        size_t header_slot = begin_message(metadata, HEADER_RECORD_BATCH, body_length);
+        fb_patch(metadata, header_slot, write_record_batch(metadata, rows, nodes, column_count, buffers, buffer_count));
+    }
+    emit_metadata(writer, body_length, block);
+
+    // 본문은 열 버퍼에서 바로 씀
+    for (int i = 0; i < column_count; i++) {
+        const void *column_data[MAX_BUFFERS_PER_COLUMN];
+        size_t lengths[MAX_BUFFERS_PER_COLUMN];
+        int count = column_buffers(&columns[i], rows, column_data, lengths);
+        for (int j = 0; j < count; j++) {
+            write_bytes(writer, column_data[j], lengths[j]);
+            write_padding(writer, ARROW_BUFFER_ALIGNMENT);
+        }
+    }
+}
+
+static void reset_column(ArrowColumn *column, int batch_rows) {
+    size_t bitmap_length = ((size_t)batch_rows + 7) / 8;
+    memset(column->validity, 0, bitmap_length);
+    if (column->spec.type == ARROW_COLUMN_BOOL) {
+        memset(column->values, 0, bitmap_length);
+    }
+    column->null_count = 0;
+    column->text_length = 0;
+}
+
+// 사전 값을 문자열 열 하나로 만들어 사전 묶음으로 씀
+static int write_dictionary(ArrowWriter *writer, int column_index) {
+    ArrowColumn *source = &writer->columns[column_index];
+    ArrowColumn values;
+    memset(&values, 0, sizeof(ArrowColumn));
+    values.spec.type = ARROW_COLUMN_UTF8;
+
+    size_t text_length = 0;
+    for (int i = 0; i < source->dictionary_count; i++) {
+        text_length += strlen(source->dictionary[i]);
+    }
+    int *offsets = malloc(sizeof(int) * ((size_t)source->dictionary_count + 1));
+    if (!offsets) {
+        return FAILURE;
+    }
+    offsets[0] = 0;
+    for (int i = 0; i < source->dictionary_count; i++) {
+        offsets[i + 1] = offsets[i] + (int)strlen(source->dictionary[i]);
+    }
+    // 사전 값은 dictionary_text에 이어 붙어 있음
+    values.values = (unsigned char*)offsets;
+    values.text = source->dictionary_text;
+    values.text_length = text_length;
+
+    ArrowBlock block;
+    write_batch(writer, &values, 1, source->dictionary_count, column_index, &block);
+    free(offsets);
+
+    ArrowBlock *blocks = realloc(writer->dictionary_blocks,
+                                 sizeof(ArrowBlock) * ((size_t)writer->dictionary_block_count + 1));
+    if (!blocks) {
+        return FAILURE;
+    }
+    writer->dictionary_blocks = blocks;
+    writer->dictionary_blocks[writer->dictionary_block_count++] = block;
+    source->dictionary_written = TRUE;
+    return writer->error ? FAILURE : SUCCESS;
+}
+
+static int flush_batch(ArrowWriter *writer) {
+    // 사전을 지정하지 않은 열은 빈 사전으로
+    for (int i = 0; i < writer->column_count; i++) {
+        if (writer->columns[i].spec.type == ARROW_COLUMN_DICTIONARY && !writer->columns[i].dictionary_written &&
+            write_dictionary(writer, i) != SUCCESS) {
+            return FAILURE;
+        }
+    }
+    if (writer->rows == 0) {
+        return SUCCESS;
+    }
+
+    if (writer->batch_block_count == writer->batch_block_capacity) {
+        int capacity = writer->batch_block_capacity ? writer->batch_block_capacity * 2 : 64;
+        ArrowBlock *blocks = realloc(writer->batch_blocks, sizeof(ArrowBlock) * (size_t)capacity);
+        if (!blocks) {
+            fprintf(stderr, "메모리 할당 실패\n");
+            return FAILURE;
+        }
+        writer->batch_blocks = blocks;
+        writer->batch_block_capacity = capacity;
+    }
+
+    write_batch(writer, writer->columns, writer->column_count, writer->rows, -1,
+                &writer->batch_blocks[writer->batch_block_count]);
+    writer->batch_block_count++;
+    writer->total_rows += writer->rows;
+    writer->rows = 0;
+    for (int i = 0; i < writer->column_count; i++) {
+        reset_column(&writer->columns[i], writer->batch_rows);
+    }
+    return writer->error ? FAILURE : SUCCESS;
+}
+
+// ---------------------------------------------------------------------------
+// 값 변환
+// ---------------------------------------------------------------------------
+
+// 1970-01-01부터의 일 수 (그레고리력)
+static long long days_from_civil(int year, int month, int day) {
+    year -= month <= 2;
+    long long era = (year >= 0 ? year : year - 399) / 400;
+    long long year_of_era = year - era * 400;
+    long long day_of_year = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    long long day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+    return era * 146097 + day_of_era - 719468;
+}
+
+static int parse_digits(const unsigned char *text, int count, int *value) {
+    int result = 0;
+    for (int i = 0; i < count; i++) {
+        if (text[i] < '0' || text[i] > '9') {
+            return FAILURE;
+        }
+        result = result * 10 + (text[i] - '0');
+    }
+    *value = result;
+    return SUCCESS;
+}
+
+// 'YYYY-MM-DD' 또는 'YYYY-MM-DD HH:MM:SS'(UTC)를 유닉스 시각으로
+static int parse_timestamp(const unsigned char *text, int length, long long *seconds) {
+    int year, month, day;
+    int hour = 0, minute = 0, second = 0;
+    if (length < 10 || text[4] != '-' || text[7] != '-' ||
+        parse_digits(text, 4, &year) != SUCCESS || parse_digits(text + 5, 2, &month) != SUCCESS ||
+        parse_digits(text + 8, 2, &day) != SUCCESS || month < 1 || month > 12 || day < 1 || day > 31) {
+        return FAILURE;
+    }
+    if (length >= 19 && (text[10] == ' ' || text[10] == 'T')) {
+        if (parse_digits(text + 11, 2, &hour) != SUCCESS || parse_digits(text + 14, 2, &minute) != SUCCESS ||
+            parse_digits(text + 17, 2, &second) != SUCCESS) {
+            return FAILURE;
+        }
+    } else if (length != 10) {
+        return FAILURE;
+    }
+    *seconds = days_from_civil(year, month, day) * 86400LL + hour * 3600LL + minute * 60LL + second;
+    return SUCCESS;
+}
+
+static int compare_dictionary_value(const void *key, const void *element) {
+    return strcmp((const char*)key, *(char *const *)element);
+}
+
+// ---------------------------------------------------------------------------
+// 공개 함수
+// ---------------------------------------------------------------------------
+
+int arrow_writer_open(ArrowWriter *writer, FILE *file, const ArrowColumnSpec *columns, int column_count,
+                      int batch_rows) {
+    if (!writer || !file || !columns || column_count <= 0) {
+        fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
+        return FAILURE;
+    }
+    memset(writer, 0, sizeof(ArrowWriter));
+    writer->file = file;
+    writer->column_count = column_count;
+    writer->batch_rows = batch_rows > 0 ? batch_rows : ARROW_BATCH_ROWS;
+
+    size_t bitmap_length = ((size_t)writer->batch_rows + 7) / 8;
+    writer->columns = calloc((size_t)column_count, sizeof(ArrowColumn));
+    writer->layout = malloc(sizeof(long long) * (size_t)column_count * (2 + MAX_BUFFERS_PER_COLUMN * 2));
+    int status = writer->columns && writer->layout ? SUCCESS : FAILURE;
+    for (int i = 0; status == SUCCESS && i < column_count; i++) {
+        ArrowColumn *column = &writer->columns[i];
+        column->spec = columns[i];
+        column->validity = calloc(bitmap_length, 1);
+
+        size_t values_length;
+        switch (column->spec.type) {
+            case ARROW_COLUMN_INT64:
+            case ARROW_COLUMN_TIMESTAMP:
+                values_length = (size_t)writer->batch_rows * 8;
+                break;
+            case ARROW_COLUMN_BOOL:
+                values_length = bitmap_length;
+                break;
+            case ARROW_COLUMN_UTF8:
+                values_length = ((size_t)writer->batch_rows + 1) * 4;
+                column->text_capacity = (size_t)writer->batch_rows * 16;
+                column->text = malloc(column->text_capacity);
+                if (!column->text) {
+                    status = FAILURE;
+                }
+                break;
+            default:
+                values_length = (size_t)writer->batch_rows * 4;
+                break;
+        }
+        column->values = calloc(values_length, 1);
+        if (!column->validity || !column->values) {
+            status = FAILURE;
+        }
+    }
+    if (status != SUCCESS) {
+        fprintf(stderr, "메모리 할당 실패\n");
+        arrow_writer_free(writer);
+        return FAILURE;
+    }
+
+    static const char header[8] = ARROW_MAGIC;
+    write_bytes(writer, header, sizeof(header));
+
+    size_t header_slot = begin_message(&writer->metadata, HEADER_SCHEMA, 0);
+    fb_patch(&writer->metadata, header_slot, write_schema(&writer->metadata, writer));
+    emit_metadata(writer, 0, NULL);
+
+    if (writer->error) {
+        fprintf(stderr, "Arrow 파일 쓰기 실패\n");
+        return FAILURE;
+    }
+    return SUCCESS;
+}
+
+int arrow_writer_set_dictionary(ArrowWriter *writer, int column, const char *const *values, int count) {
+    if (!writer || column < 0 || column >= writer->column_count || count < 0 || (count > 0 && !values) ||
+        writer->columns[column].spec.type != ARROW_COLUMN_DICTIONARY ||
+        writer->columns[column].dictionary_written || writer->rows > 0 || writer->batch_block_count > 0) {
+        fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
+        return FAILURE;
+    }
+
+    ArrowColumn *target = &writer->columns[column];
+    size_t text_length = 0;
+    for (int i = 0; i < count; i++) {
+        text_length += strlen(values[i]) + 1;
+    }
+    target->dictionary = malloc(sizeof(char*) * ((size_t)count + 1));
+    target->dictionary_text = malloc(text_length + 1);
+    if (!target->dictionary || !target->dictionary_text) {
+        fprintf(stderr, "메모리 할당 실패\n");
+        return FAILURE;
+    }
+
+    // 사전 묶음에 그대로 쓸 수 있도록 값을 NUL 없이 이어 붙이고, 찾기용 사본은 뒤쪽에 둠
+    char *packed = target->dictionary_text;
+    for (int i = 0; i < count; i++) {
+        size_t length = strlen(values[i]);
+        memcpy(packed, values[i], length);
+        packed += length;
+    }
+    char *lookup = malloc(text_length + 1);
+    if (!lookup) {
+        fprintf(stderr, "메모리 할당 실패\n");
+        return FAILURE;
+    }
+    char *cursor = lookup;
+    for (int i = 0; i < count; i++) {
+        size_t length = strlen(values[i]);
+        memcpy(cursor, values[i], length + 1);
+        target->dictionary[i] = cursor;
+        cursor += length + 1;
+    }
+    target->dictionary_count = count;
+    // 찾기용 사본 전체는 dictionary[0]이 가리키는 곳에서 해제 (값이 없으면 바로 해제)
+    if (count == 0) {
+        free(lookup);
+    }
+    return write_dictionary(writer, column);
+}
+
+int arrow_writer_append_row(ArrowWriter *writer, sqlite3_stmt *stmt) {
+    if (!writer || !stmt || writer->error) {
+        return FAILURE;
+    }
+
+    int row = writer->rows;
+    for (int i = 0; i < writer->column_count; i++) {
+        ArrowColumn *column = &writer->columns[i];
+        int valid = sqlite3_column_type(stmt, i) != SQLITE_NULL;
+
+        switch (column->spec.type) {
+            case ARROW_COLUMN_INT32: {
+                int value = valid ? sqlite3_column_int(stmt, i) : 0;
+                memcpy(column->values + (size_t)row * 4, &value, 4);
+                break;
+            }
+            case ARROW_COLUMN_INT64: {
+                long long value = valid ? sqlite3_column_int64(stmt, i) : 0;
+                memcpy(column->values + (size_t)row * 8, &value, 8);
+                break;
+            }
+            case ARROW_COLUMN_TIMESTAMP: {
+                long long value = 0;
+                if (valid && sqlite3_column_type(stmt, i) == SQLITE_INTEGER) {
+                    value = sqlite3_column_int64(stmt, i);
+                } else if (valid) {
+                    valid = parse_timestamp(sqlite3_column_text(stmt, i), sqlite3_column_bytes(stmt, i),
+                                            &value) == SUCCESS;
+                }
+                memcpy(column->values + (size_t)row * 8, &value, 8);
+                break;
+            }
+            case ARROW_COLUMN_BOOL:
+                if (valid && sqlite3_column_int(stmt, i) != 0) {
+                    column->values[row / 8] |= (unsigned char)(1u << (row % 8));
+                }
+                break;
+            case ARROW_COLUMN_DICTIONARY: {
+                int index = 0;
+                if (valid) {
+                    const char *text = (const char*)sqlite3_column_text(stmt, i);
+                    char **found = column->dictionary_count > 0 && text
+                        ? bsearch(text, column->dictionary, (size_t)column->dictionary_count, sizeof(char*),
+                                  compare_dictionary_value)
+                        : NULL;
+                    valid = found != NULL;
+                    index = found ? (int)(found - column->dictionary) : 0;
+                }
+                memcpy(column->values + (size_t)row * 4, &index, 4);
+                break;
+            }
+            default: {
+                int *offsets = (int*)column->values;
+                size_t length = valid ? (size_t)sqlite3_column_bytes(stmt, i) : 0;
+                if (column->text_length + length > INT_MAX) {
+                    fprintf(stderr, "Arrow 묶음의 문자열이 너무 깁니다: %s\n", column->spec.name);
+                    return FAILURE;
+                }
+                if (column->text_length + length > column->text_capacity) {
+                    size_t capacity = column->text_capacity * 2;
+                    while (capacity < column->text_length + length) {
+                        capacity *= 2;
+                    }
+                    char *text = realloc(column->text, capacity);
+                    if (!text) {
+                        fprintf(stderr, "메모리 할당 실패\n");
+                        return FAILURE;
+                    }
+                    column->text = text;
+                    column->text_capacity = capacity;
+                }
+                if (length > 0) {
+                    memcpy(column->text + column->text_length, sqlite3_column_text(stmt, i), length);
+                }
+                column->text_length += length;
+                offsets[row + 1] = (int)column->text_length;
+                break;
+            }
+        }
+
+        if (valid) {
+            column->validity[row / 8] |= (unsigned char)(1u << (row % 8));
+        } else {
+            column->null_count++;
+        }
+    }
+
+    writer->rows++;
+    if (writer->rows == writer->batch_rows) {
+        return flush_batch(writer);
+    }
+    return SUCCESS;
+}
+
+// 푸터의 Block 구조체 벡터 (offset int64, metaDataLength int32 + 빈 4바이트, bodyLength int64)
+static size_t write_blocks(ArrowBuffer *buffer, const ArrowBlock *blocks, int count) {
+    size_t vector = fb_vector(buffer, (size_t)count, 8);
+    for (int i = 0; i < count; i++) {
+        buffer_put(buffer, (unsigned long long)blocks[i].offset, 8);
+        buffer_put(buffer, (unsigned long long)blocks[i].metadata_length, 4);
+        buffer_put(buffer, 0, 4);
+        buffer_put(buffer, (unsigned long long)blocks[i].body_length, 8);
+    }
+    return vector;
+}
+
+int arrow_writer_finish(ArrowWriter *writer) {
+    if (!writer || writer->error) {
+        return FAILURE;
+    }
+    if (flush_batch(writer) != SUCCESS) {
+        return FAILURE;
+    }
+
+    // 스트림 끝 표시
+    write_u32(writer, CONTINUATION_MARKER);
+    write_u32(writer, 0);
+
+    ArrowBuffer *footer = &writer->metadata;
+    footer->length = 0;
+    footer->error = FALSE;
+    buffer_put(footer, 0, 4);
+    FbField fields[] = { { 2, METADATA_VERSION_V5 }, { FB_OFFSET, 0 }, { FB_OFFSET, 0 }, { FB_OFFSET, 0 } };
+    size_t slots[4];
+    size_t table = fb_table(footer, fields, 4, slots);
+    fb_patch(footer, 0, table);
+    fb_patch(footer, slots[1], write_schema(footer, writer));
+    fb_patch(footer, slots[2], write_blocks(footer, writer->dictionary_blocks, writer->dictionary_block_count));
+    fb_patch(footer, slots[3], write_blocks(footer, writer->batch_blocks, writer->batch_block_count));
+    if (footer->error) {
+        fprintf(stderr, "메모리 할당 실패\n");
+        return FAILURE;
+    }
+
+    write_bytes(writer, footer->data, footer->length);
+    write_u32(writer, (unsigned int)footer->length);
+    write_bytes(writer, ARROW_MAGIC, ARROW_MAGIC_LENGTH);
+
+    if (writer->error) {
+        fprintf(stderr, "Arrow 파일 쓰기 실패\n");
+        return FAILURE;
+    }
+    return SUCCESS;
+}
+
+void arrow_writer_free(ArrowWriter *writer) {
+    if (!writer) {
+        return;
+    }
+    for (int i = 0; writer->columns && i < writer->column_count; i++) {
+        ArrowColumn *column = &writer->columns[i];
+        free(column->validity);
+        free(column->values);
+        free(column->text);
+        if (column->dictionary && column->dictionary_count > 0) {
+            free(column->dictionary[0]);
+        }
+        free(column->dictionary);
+        free(column->dictionary_text);
+    }
+    free(writer->columns);
+    free(writer->layout);
+    free(writer->dictionary_blocks);
+    free(writer->batch_blocks);
+    free(writer->metadata.data);
+    memset(writer, 0, sizeof(ArrowWriter));
+}
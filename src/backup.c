@@ -0,0 +1,519 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sched.h>
+#endif
+#include "../include/backup.h"
+#include "../include/crc32c.h"
+#include "../include/utils.h"
+
+void backup_default_config(BackupConfig *config) {
+    if (!config) {
+        return;
+    }
+    config->pages_per_step = BACKUP_PAGES_PER_STEP;
+    config->sleep_ms = BACKUP_STEP_SLEEP_MS;
+}
+
+// 단계 사이에 쉬거나 다른 스레드에 양보
+static void pause_between_steps(int sleep_ms) {
+    if (sleep_ms > 0) {
+        sqlite3_sleep(sleep_ms);
+        return;
+    }
+#ifdef _WIN32
+    Sleep(0);
+#else
+    sched_yield();
+#endif
+}
+
+// 데이터베이스 파일 머리글(16-17번째 바이트)에서 페이지 크기를 읽음
+static int read_page_size(FILE *file) {
+    unsigned char header[100];
+    if (fread(header, 1, sizeof(header), file) != sizeof(header) ||
+        memcmp(header, "SQLite format 3", 16) != 0) {
+        return 0;
+    }
+    int page_size = header[16] << 8 | header[17];
+    return page_size == 1 ? 65536 : page_size;
+}
+
+// data_path의 페이지별 CRC32C를 checksum_path에 저장 (임시 파일에 쓰고 이름을 바꿈)
+static int write_checksum_file(const char *data_path, const char *checksum_path) {
+    char temp_path[MAX_PATH_LENGTH + 8];
+    snprintf(temp_path, sizeof(temp_path), "%s.tmp", checksum_path);
+
+    FILE *data = fopen(data_path, "rb");
+    if (!data) {
+        fprintf(stderr, "백업 파일을 열 수 없습니다: %s\n", data_path);
+        return FAILURE;
+    }
+    int page_size = read_page_size(data);
+    if (page_size < 512 || BACKUP_VERIFY_BUFFER_SIZE % page_size != 0 || fseek(data, 0, SEEK_END) != 0) {
+        fprintf(stderr, "데이터베이스 파일이 아닙니다: %s\n", data_path);
+        fclose(data);
+        return FAILURE;
+    }
+    long long file_size = ftell(data);
+    rewind(data);
+
+    unsigned char *buffer = malloc(BACKUP_VERIFY_BUFFER_SIZE);
+    FILE *output = fopen(temp_path, "w");
+    int result = FAILURE;
+    if (!buffer || !output) {
+        fprintf(stderr, "체크섬 목록을 만들 수 없습니다: %s\n", checksum_path);
+        goto cleanup;
+    }
+
+    fprintf(output, "LMS-BACKUP-CHECKSUM %d\nalgorithm crc32c\npage_size %d\npage_count %lld\n",
+            BACKUP_CHECKSUM_VERSION, page_size, file_size / page_size);
+    size_t read_bytes;
+    long long total = 0;
+    while ((read_bytes = fread(buffer, 1, BACKUP_VERIFY_BUFFER_SIZE, data)) > 0) {
+        for (size_t offset = 0; offset + page_size <= read_bytes; offset += page_size) {
+            fprintf(output, "%08x\n", (unsigned int)crc32c_update(0, buffer + offset, page_size));
+        }
+        total += read_bytes;
+    }
+    if (ferror(data) || total != file_size || file_size % page_size != 0) {
+        fprintf(stderr, "백업 파일 읽기 실패: %s\n", data_path);
+        goto cleanup;
+    }
+    if (fclose(output) != 0) {
+        output = NULL;
+        fprintf(stderr, "체크섬 목록 저장 실패: %s\n", checksum_path);
+        goto cleanup;
+    }
+    output = NULL;
+#ifdef _WIN32
+    remove(checksum_path);
+#endif
+    if (rename(temp_path, checksum_path) != 0) {
+        fprintf(stderr, "체크섬 목록 저장 실패: %s\n", checksum_path);
+        goto cleanup;
+    }
+    result = SUCCESS;
+
+cleanup:
+    if (output) {
+        fclose(output);
+    }
+    if (result != SUCCESS) {
+        remove(temp_path);
+    }
+    free(buffer);
+    fclose(data);
+    return result;
+}
+
+int backup_database_online(sqlite3 *db, const char *backup_path, const BackupConfig *config,
+                           BackupProgressCallback callback, void *user_data, BackupProgress *progress) {
+    BackupProgress current;
+    memset(&current, 0, sizeof(BackupProgress));
+    current.state = BACKUP_STATE_FAILED;
+    if (progress) {
+        *progress = current;
+    }
+
+    if (!db || !backup_path) {
+        fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
+        return FAILURE;
+    }
+
+    BackupConfig effective;
+    backup_default_config(&effective);
+    if (config) {
+        effective = *config;
+        if (effective.pages_per_step <= 0) {
+            effective.pages_per_step = BACKUP_PAGES_PER_STEP;
+        }
+    }
+
+    char partial_path[MAX_PATH_LENGTH];
+    if (snprintf(partial_path, sizeof(partial_path), "%s%s", backup_path, BACKUP_PARTIAL_SUFFIX) >=
+        (int)sizeof(partial_path)) {
+        fprintf(stderr, "백업 경로가 너무 깁니다: %s\n", backup_path);
+        return FAILURE;
+    }
+    char checksum_path[MAX_PATH_LENGTH];
+    if (snprintf(checksum_path, sizeof(checksum_path), "%s%s", backup_path, BACKUP_CHECKSUM_SUFFIX) >=
+        (int)sizeof(checksum_path)) {
+        fprintf(stderr, "백업 경로가 너무 깁니다: %s\n", backup_path);
+        return FAILURE;
+    }
+    safe_string_copy(current.backup_path, backup_path, sizeof(current.backup_path));
+    current.state = BACKUP_STATE_RUNNING;
+
+    // 이전에 중단된 복사본이 있으면 지우고 새로 만듦
+    remove(partial_path);
+
+    long long start_ns = timer_now_nanoseconds();
+    sqlite3 *backup_db = NULL;
+    sqlite3_backup *backup = NULL;
+    int rc = SQLITE_ERROR;
+
+    if (sqlite3_open(partial_path, &backup_db) != SQLITE_OK) {
+        fprintf(stderr, "백업 데이터베이스 생성 실패: %s\n", sqlite3_errmsg(backup_db));
+        goto cleanup;
+    }
+    backup = sqlite3_backup_init(backup_db, "main", db, "main");
+    if (!backup) {
+        fprintf(stderr, "백업 초기화 실패: %s\n", sqlite3_errmsg(backup_db));
+        goto cleanup;
+    }
+
+    int pages = effective.pages_per_step;
+    int previous_copied = 0;
+    int consecutive_busy = 0;
+    while (1) {
+        rc = sqlite3_backup_step(backup, pages);
+        current.steps++;
+
+        if (rc == SQLITE_BUSY || rc == SQLITE_LOCKED) {
+            // 다른 연결이 쓰는 중이면 잠시 뒤 같은 위치부터 다시 시도
+            current.busy_retries++;
+            if (++consecutive_busy > BACKUP_MAX_BUSY_RETRIES) {
+                fprintf(stderr, "원본 데이터베이스가 계속 잠겨 있어 백업을 중단합니다.\n");
+                break;
+            }
+            sqlite3_sleep(BACKUP_BUSY_SLEEP_MS);
+        } else if (rc != SQLITE_OK && rc != SQLITE_DONE) {
+            fprintf(stderr, "백업 실행 실패: %s\n", sqlite3_errstr(rc));
+            break;
+        } else {
+            consecutive_busy = 0;
+        }
+
+        current.page_count = sqlite3_backup_pagecount(backup);
+        current.remaining = sqlite3_backup_remaining(backup);
+        int copied = current.page_count - current.remaining;
+        if (rc == SQLITE_OK && copied < previous_copied) {
+            // 다른 연결이 원본을 바꿔 처음부터 다시 복사하기 시작함. 단계를 키워 쓰기 사이에 끝낼 수 있게 함
+            current.restarts++;
+            pages = pages > current.page_count / 2 ? -1 : pages * 2;
+        }
+        previous_copied = copied;
+        current.elapsed_seconds = (timer_now_nanoseconds() - start_ns) / 1e9;
+
+        if (rc == SQLITE_DONE) {
+            break;
+        }
+        if (callback && !callback(&current, user_data)) {
+            current.state = BACKUP_STATE_CANCELLED;
+            break;
+        }
+        if (rc == SQLITE_OK) {
+            pause_between_steps(effective.sleep_ms);
+        }
+    }
+
+cleanup:
+    if (backup && sqlite3_backup_finish(backup) != SQLITE_OK && rc == SQLITE_DONE) {
+        fprintf(stderr, "백업 마무리 실패: %s\n", sqlite3_errmsg(backup_db));
+        rc = SQLITE_ERROR;
+    }
+    if (backup_db) {
+        sqlite3_close(backup_db);
+    }
+
+    if (rc == SQLITE_DONE && current.state == BACKUP_STATE_RUNNING &&
+        write_checksum_file(partial_path, checksum_path) == SUCCESS) {
+#ifdef _WIN32
+        // Windows의 rename은 대상 파일이 있으면 실패함
+        remove(backup_path);
+#endif
+        if (rename(partial_path, backup_path) == 0) {
+            current.state = BACKUP_STATE_DONE;
+        } else {
+            fprintf(stderr, "백업 파일 이름 변경 실패: %s\n", backup_path);
+            remove(checksum_path);
+        }
+    }
+    if (current.state != BACKUP_STATE_DONE) {
+        if (current.state == BACKUP_STATE_RUNNING) {
+            current.state = BACKUP_STATE_FAILED;
+        }
+        remove(partial_path);
+    }
+
+    current.elapsed_seconds = (timer_now_nanoseconds() - start_ns) / 1e9;
+    if (callback) {
+        callback(&current, user_data);
+    }
+    if (progress) {
+        *progress = current;
+    }
+    return current.state == BACKUP_STATE_DONE ? SUCCESS : FAILURE;
+}
+
+// 백그라운드 작업 상태
+static pthread_t job_thread;
+static atomic_int job_started = 0;        // 스레드를 만들고 아직 join하지 않음
+static atomic_int job_cancel_requested = 0;
+static pthread_mutex_t job_mutex = PTHREAD_MUTEX_INITIALIZER;
+static BackupProgress job_progress;       // job_mutex로 보호
+static sqlite3 *job_db = NULL;
+static BackupConfig job_config;
+
+static int job_progress_callback(const BackupProgress *progress, void *user_data) {
+    (void)user_data;
+    pthread_mutex_lock(&job_mutex);
+    job_progress = *progress;
+    pthread_mutex_unlock(&job_mutex);
+    return !atomic_load(&job_cancel_requested);
+}
+
+static void *job_main(void *arg) {
+    (void)arg;
+    char backup_path[MAX_PATH_LENGTH];
+    pthread_mutex_lock(&job_mutex);
+    safe_string_copy(backup_path, job_progress.backup_path, sizeof(backup_path));
+    pthread_mutex_unlock(&job_mutex);
+
+    BackupProgress result;
+    backup_database_online(job_db, backup_path, &job_config, job_progress_callback, NULL, &result);
+
+    // 매개변수 오류처럼 콜백을 거치지 않고 끝난 경우에도 최종 상태를 남김
+    pthread_mutex_lock(&job_mutex);
+    job_progress = result;
+    safe_string_copy(job_progress.backup_path, backup_path, sizeof(job_progress.backup_path));
+    pthread_mutex_unlock(&job_mutex);
+    return NULL;
+}
+
+static int job_is_running(void) {
+    pthread_mutex_lock(&job_mutex);
+    int running = job_progress.state == BACKUP_STATE_RUNNING;
+    pthread_mutex_unlock(&job_mutex);
+    return running;
+}
+
+int backup_job_start(sqlite3 *db, const char *backup_path, const BackupConfig *config) {
+    if (!db || !backup_path) {
+        fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
+        return FAILURE;
+    }
+    if (atomic_load(&job_started)) {
+        if (job_is_running()) {
+            fprintf(stderr, "이미 백업이 실행 중입니다.\n");
+            return FAILURE;
+        }
+        // 끝났지만 아직 정리하지 않은 이전 작업
+        backup_job_wait(NULL);
+    }
+
+    job_db = db;
+    backup_default_config(&job_config);
+    if (config) {
+        job_config = *config;
+    }
+    atomic_store(&job_cancel_requested, 0);
+
+    pthread_mutex_lock(&job_mutex);
+    memset(&job_progress, 0, sizeof(BackupProgress));
+    job_progress.state = BACKUP_STATE_RUNNING;
+    safe_string_copy(job_progress.backup_path, backup_path, sizeof(job_progress.backup_path));
+    pthread_mutex_unlock(&job_mutex);
+
+    if (pthread_create(&job_thread, NULL, job_main, NULL) != 0) {
+        fprintf(stderr, "백업 스레드 생성 실패\n");
+        pthread_mutex_lock(&job_mutex);
+        job_progress.state = BACKUP_STATE_FAILED;
+        pthread_mutex_unlock(&job_mutex);
+        return FAILURE;
+    }
+    atomic_store(&job_started, 1);
+    return SUCCESS;
+}
+
+void backup_job_get_progress(BackupProgress *progress) {
+    if (!progress) {
+        return;
+    }
+    pthread_mutex_lock(&job_mutex);
+    *progress = job_progress;
+    pthread_mutex_unlock(&job_mutex);
+}
+
+void backup_job_cancel(void) {
+    atomic_store(&job_cancel_requested, 1);
+}
+
+int backup_job_wait(BackupProgress *progress) {
+    if (atomic_exchange(&job_started, 0)) {
+        pthread_join(job_thread, NULL);
+    }
+
+    BackupProgress result;
+    backup_job_get_progress(&result);
+    if (progress) {
+        *progress = result;
+    }
+    return result.state == BACKUP_STATE_DONE ? SUCCESS : FAILURE;
+}
+
+int backup_write_checksums(const char *backup_path) {
+    if (!backup_path) {
+        fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
+        return FAILURE;
+    }
+    char checksum_path[MAX_PATH_LENGTH];
+    if (snprintf(checksum_path, sizeof(checksum_path), "%s%s", backup_path, BACKUP_CHECKSUM_SUFFIX) >=
+        (int)sizeof(checksum_path)) {
+        fprintf(stderr, "백업 경로가 너무 깁니다: %s\n", backup_path);
+        return FAILURE;
+    }
+    return write_checksum_file(backup_path, checksum_path);
+}
+
+// 체크섬 목록을 읽음 (*checksums는 호출한 쪽이 free)
+static int load_checksum_file(const char *checksum_path, int *page_size, int *page_count, uint32_t **checksums) {
+    FILE *file = fopen(checksum_path, "r");
+    if (!file) {
+        fprintf(stderr, "체크섬 목록을 찾을 수 없습니다: %s\n", checksum_path);
+        return FAILURE;
+    }
+
+    int version = 0;
+    char algorithm[16] = "";
+    *checksums = NULL;
+    if (fscanf(file, "LMS-BACKUP-CHECKSUM %d algorithm %15s page_size %d page_count %d", &version, algorithm,
+               page_size, page_count) != 4 ||
+        version != BACKUP_CHECKSUM_VERSION || strcmp(algorithm, "crc32c") != 0 || *page_size < 512 ||
+        BACKUP_VERIFY_BUFFER_SIZE % *page_size != 0 || *page_count < 0) {
+        fprintf(stderr, "체크섬 목록이 손상되었습니다: %s\n", checksum_path);
+        fclose(file);
+        return FAILURE;
+    }
+
+    *checksums = malloc(sizeof(uint32_t) * (*page_count > 0 ? *page_count : 1));
+    if (!*checksums) {
+        fprintf(stderr, "메모리 할당 실패\n");
+        fclose(file);
+        return FAILURE;
+    }
+    for (int i = 0; i < *page_count; i++) {
+        unsigned int value;
+        if (fscanf(file, "%8x", &value) != 1) {
+            fprintf(stderr, "체크섬 목록이 손상되었습니다: %s\n", checksum_path);
+            free(*checksums);
+            *checksums = NULL;
+            fclose(file);
+            return FAILURE;
+        }
+        (*checksums)[i] = value;
+    }
+    fclose(file);
+    return SUCCESS;
+}
+
+// 사본을 읽기 전용으로 열어 PRAGMA quick_check 실행
+static int run_quick_check(const char *backup_path) {
+    sqlite3 *copy = NULL;
+    sqlite3_stmt *stmt = NULL;
+    int passed = FALSE;
+    if (sqlite3_open_v2(backup_path, &copy, SQLITE_OPEN_READONLY, NULL) == SQLITE_OK &&
+        sqlite3_prepare_v2(copy, "PRAGMA quick_check;", -1, &stmt, NULL) == SQLITE_OK &&
+        sqlite3_step(stmt) == SQLITE_ROW) {
+        const char *message = (const char*)sqlite3_column_text(stmt, 0);
+        passed = message && strcmp(message, "ok") == 0;
+        if (!passed) {
+            fprintf(stderr, "PRAGMA quick_check 실패: %s\n", message ? message : "");
+        }
+    } else {
+        fprintf(stderr, "PRAGMA quick_check 실행 실패: %s\n", sqlite3_errmsg(copy));
+    }
+    sqlite3_finalize(stmt);
+    sqlite3_close(copy);
+    return passed;
+}
+
+int backup_verify(const char *backup_path, int quick_check, BackupVerifyResult *result) {
+    BackupVerifyResult current;
+    memset(&current, 0, sizeof(BackupVerifyResult));
+    current.quick_check = -1;
+    if (result) {
+        *result = current;
+    }
+    if (!backup_path) {
+        fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
+        return FAILURE;
+    }
+
+    char checksum_path[MAX_PATH_LENGTH];
+    if (snprintf(checksum_path, sizeof(checksum_path), "%s%s", backup_path, BACKUP_CHECKSUM_SUFFIX) >=
+        (int)sizeof(checksum_path)) {
+        fprintf(stderr, "백업 경로가 너무 깁니다: %s\n", backup_path);
+        return FAILURE;
+    }
+
+    long long start_ns = timer_now_nanoseconds();
+    uint32_t *checksums = NULL;
+    if (load_checksum_file(checksum_path, &current.page_size, &current.page_count, &checksums) != SUCCESS) {
+        return FAILURE;
+    }
+
+    FILE *file = fopen(backup_path, "rb");
+    unsigned char *buffer = malloc(BACKUP_VERIFY_BUFFER_SIZE);
+    if (!file || !buffer) {
+        fprintf(stderr, "백업 파일을 열 수 없습니다: %s\n", backup_path);
+        free(checksums);
+        free(buffer);
+        if (file) {
+            fclose(file);
+        }
+        return FAILURE;
+    }
+    // 한 번만 순서대로 읽으므로 표준 입출력 버퍼를 거치지 않음
+    setvbuf(file, NULL, _IONBF, 0);
+
+    int page = 0;
+    size_t read_bytes;
+    while ((read_bytes = fread(buffer, 1, BACKUP_VERIFY_BUFFER_SIZE, file)) > 0) {
+        current.bytes += read_bytes;
+        for (size_t offset = 0; offset < read_bytes; offset += current.page_size, page++) {
+            // 목록보다 긴 파일이나 잘린 마지막 페이지도 불일치로 셈
+            int matches = page < current.page_count && offset + current.page_size <= read_bytes &&
+                          crc32c_update(0, buffer + offset, current.page_size) == checksums[page];
+            if (!matches) {
+                current.bad_pages++;
+                if (current.first_bad_page == 0) {
+                    current.first_bad_page = page + 1;
+                }
+            }
+        }
+    }
+    int read_failed = ferror(file);
+    fclose(file);
+    free(buffer);
+    free(checksums);
+
+    // 목록보다 짧은 파일
+    if (page < current.page_count) {
+        if (current.first_bad_page == 0) {
+            current.first_bad_page = page + 1;
+        }
+        current.bad_pages += current.page_count - page;
+    }
+
+    if (read_failed) {
+        fprintf(stderr, "백업 파일 읽기 실패: %s\n", backup_path);
+    } else if (current.bad_pages > 0) {
+        fprintf(stderr, "백업 파일이 손상되었습니다: %s (%d번 페이지 등 %d개 페이지 불일치)\n", backup_path,
+                current.first_bad_page, current.bad_pages);
+    } else if (quick_check) {
+        current.quick_check = run_quick_check(backup_path);
+    }
+
+    current.elapsed_seconds = (timer_now_nanoseconds() - start_ns) / 1e9;
+    if (result) {
+        *result = current;
+    }
+    return !read_failed && current.bad_pages == 0 && current.quick_check != FALSE ? SUCCESS : FAILURE;
+}
@@ -0,0 +1,784 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include <sys/stat.h>
+#include "../include/backup_store.h"
+#include "../include/utils.h"
+
+// 조각 디렉터리 탐색에 dirent를 쓰므로 Windows에서는 이를 제공하는 MinGW-w64로만 빌드할 수 있음
+#if defined(_WIN32) && !defined(__MINGW32__)
+    #error "Windows에서는 MinGW-w64(dirent.h 포함)로 빌드해야 합니다."
+#endif
+#include <dirent.h>
+
+#define MANIFEST_MAGIC "LMS-BACKUP-MANIFEST"
+#define MANIFEST_SUFFIX ".manifest"
+#define HASH_HEX_LENGTH (BACKUP_STORE_HASH_SIZE * 2)
+
+// ---------------------------------------------------------------------------
+// MurmurHash3 x64 128 (Austin Appleby, 공개 도메인)
+// ---------------------------------------------------------------------------
+
+static uint64_t rotl64(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+static uint64_t fmix64(uint64_t k) {
+    k ^= k >> 33;
+    k *= 0xff51afd7ed558ccdULL;
+    k ^= k >> 33;
+    k *= 0xc4ceb9fe1a85ec53ULL;
+    k ^= k >> 33;
+    return k;
+}
+
+// 정렬과 엔디언에 관계없이 리틀 엔디언 8바이트를 읽음
+static uint64_t read_u64(const unsigned char *p) {
+    uint64_t value = 0;
+    for (int i = 7; i >= 0; i--) {
+        value = (value << 8) | p[i];
+    }
+    return value;
+}
+
+void backup_store_hash(const void *data, size_t length, unsigned char *hash) {
+    const unsigned char *bytes = (const unsigned char*)data;
+    const uint64_t c1 = 0x87c37b91114253d5ULL;
+    const uint64_t c2 = 0x4cf5ad432745937fULL;
+    uint64_t h1 = 0;
+    uint64_t h2 = 0;
+    size_t blocks = length / 16;
+
+    for (size_t i = 0; i < blocks; i++) {
+        uint64_t k1 = read_u64(bytes + i * 16);
+        uint64_t k2 = read_u64(bytes + i * 16 + 8);
+
+        k1 *= c1; k1 = rotl64(k1, 31); k1 *= c2; h1 ^= k1;
+        h1 = rotl64(h1, 27); h1 += h2; h1 = h1 * 5 + 0x52dce729;
+        k2 *= c2; k2 = rotl64(k2, 33); k2 *= c1; h2 ^= k2;
+        h2 = rotl64(h2, 31); h2 += h1; h2 = h2 * 5 + 0x38495ab5;
+    }
+
+    const unsigned char *tail = bytes + blocks * 16;
+    uint64_t k1 = 0;
+    uint64_t k2 = 0;
+    size_t rest = length & 15;
+    for (size_t i = rest; i > 8; i--) {
+        k2 ^= (uint64_t)tail[i - 1] << (8 * (i - 9));
+    }
+    if (rest > 8) {
+        k2 *= c2; k2 = rotl64(k2, 33); k2 *= c1; h2 ^= k2;
+    }
+    for (size_t i = rest < 8 ? rest : 8; i > 0; i--) {
+        k1 ^= (uint64_t)tail[i - 1] << (8 * (i - 1));
+    }
+    if (rest > 0) {
+        k1 *= c1; k1 = rotl64(k1, 31); k1 *= c2; h1 ^= k1;
+    }
+
+    h1 ^= (uint64_t)length;
+    h2 ^= (uint64_t)length;
+    h1 += h2;
+    h2 += h1;
+    h1 = fmix64(h1);
+    h2 = fmix64(h2);
+    h1 += h2;
+    h2 += h1;
+
+    for (int i = 0; i < 8; i++) {
+        hash[i] = (unsigned char)(h1 >> (8 * i));
+        hash[8 + i] = (unsigned char)(h2 >> (8 * i));
+    }
+}
+
+// ---------------------------------------------------------------------------
+// 저장소 경로
+// ---------------------------------------------------------------------------
+
+static void hash_to_hex(const unsigned char *hash, char *hex) {
+    static const char digits[] = "0123456789abcdef";
+    for (int i = 0; i < BACKUP_STORE_HASH_SIZE; i++) {
+        hex[i * 2] = digits[hash[i] >> 4];
+        hex[i * 2 + 1] = digits[hash[i] & 0x0F];
+    }
+    hex[HASH_HEX_LENGTH] = '\0';
+}
+
+static int hex_value(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    return -1;
+}
+
+static int hex_to_hash(const char *hex, unsigned char *hash) {
+    for (int i = 0; i < BACKUP_STORE_HASH_SIZE; i++) {
+        int high = hex_value(hex[i * 2]);
+        int low = hex_value(hex[i * 2 + 1]);
+        if (high < 0 || low < 0) {
+            return FAILURE;
+        }
+        hash[i] = (unsigned char)(high << 4 | low);
+    }
+    return SUCCESS;
+}
+
+// 이름은 파일 이름으로 쓰므로 영문자, 숫자, '_', '-', '.'만 허용 (점으로 시작하면 안 됨)
+static int is_valid_name(const char *name) {
+    size_t length = strlen(name);
+    if (length == 0 || length >= BACKUP_STORE_NAME_LENGTH || name[0] == '.') {
+        return FALSE;
+    }
+    for (size_t i = 0; i < length; i++) {
+        char c = name[i];
+        if (!((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') ||
+              c == '_' || c == '-' || c == '.')) {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+static void manifest_path(const char *repository, const char *name, char *path, size_t size) {
+    snprintf(path, size, "%s/manifests/%s%s", repository, name, MANIFEST_SUFFIX);
+}
+
+static void chunk_path(const char *repository, const unsigned char *hash, char *path, size_t size) {
+    char hex[HASH_HEX_LENGTH + 1];
+    hash_to_hex(hash, hex);
+    snprintf(path, size, "%s/chunks/%.2s/%s", repository, hex, hex);
+}
+
+static int file_is_present(const char *path) {
+    struct stat info;
+    return stat(path, &info) == 0;
+}
+
+static int prepare_repository(const char *repository) {
+    char path[MAX_PATH_LENGTH];
+    if (create_directory_if_not_exists(repository) != SUCCESS) {
+        return FAILURE;
+    }
+    snprintf(path, sizeof(path), "%s/manifests", repository);
+    if (create_directory_if_not_exists(path) != SUCCESS) {
+        return FAILURE;
+    }
+    snprintf(path, sizeof(path), "%s/chunks", repository);
+    return create_directory_if_not_exists(path);
+}
+
+// 임시 파일에 쓴 뒤 이름을 바꿔, 중간에 끊겨도 불완전한 조각이 저장소에 남지 않게 함
+static int write_chunk(const char *path, const unsigned char *data, size_t length) {
+    char tmp_path[MAX_PATH_LENGTH + 8];
+    snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", path);
+
+    FILE *file = fopen(tmp_path, "wb");
+    if (!file) {
+        return FAILURE;
+    }
+    int status = fwrite(data, 1, length, file) == length ? SUCCESS : FAILURE;
+    if (fclose(file) != 0) {
+        status = FAILURE;
+    }
+    if (status != SUCCESS || rename(tmp_path, path) != 0) {
+        remove(tmp_path);
+        return FAILURE;
+    }
+    return SUCCESS;
+}
+
+// ---------------------------------------------------------------------------
+// 목록
+// ---------------------------------------------------------------------------
+
+static int save_manifest(const char *repository, const BackupManifest *manifest) {
+    char path[MAX_PATH_LENGTH];
+    char tmp_path[MAX_PATH_LENGTH + 8];
+    manifest_path(repository, manifest->name, path, sizeof(path));
+    snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", path);
+
+    FILE *file = fopen(tmp_path, "w");
+    if (!file) {
+        fprintf(stderr, "백업 목록을 만들 수 없습니다: %s\n", path);
+        return FAILURE;
+    }
+    fprintf(file, "%s %d\n", MANIFEST_MAGIC, BACKUP_STORE_VERSION);
+    fprintf(file, "name %s\n", manifest->name);
+    fprintf(file, "created %s\n", manifest->created_at);
+    fprintf(file, "page_size %d\n", manifest->page_size);
+    fprintf(file, "chunk_size %d\n", manifest->chunk_size);
+    fprintf(file, "file_size %lld\n", manifest->file_size);
+    fprintf(file, "chunks %d\n", manifest->chunk_count);
+    for (int i = 0; i < manifest->chunk_count; i++) {
+        char hex[HASH_HEX_LENGTH + 1];
+        hash_to_hex(manifest->chunks[i].hash, hex);
+        fprintf(file, "%s %d\n", hex, manifest->chunks[i].length);
+    }
+
+    int status = ferror(file) ? FAILURE : SUCCESS;
+    if (fclose(file) != 0) {
+        status = FAILURE;
+    }
+    if (status != SUCCESS || rename(tmp_path, path) != 0) {
+        fprintf(stderr, "백업 목록 저장 실패: %s\n", path);
+        remove(tmp_path);
+        return FAILURE;
+    }
+    return SUCCESS;
+}
+
+// headers_only이면 조각 목록은 읽지 않음
+static int load_manifest(const char *repository, const char *name, BackupManifest *manifest, int headers_only) {
+    memset(manifest, 0, sizeof(BackupManifest));
+    if (!repository || !name || !is_valid_name(name)) {
+        fprintf(stderr, "유효하지 않은 백업 이름입니다.\n");
+        return FAILURE;
+    }
+
+    char path[MAX_PATH_LENGTH];
+    manifest_path(repository, name, path, sizeof(path));
+    FILE *file = fopen(path, "r");
+    if (!file) {
+        fprintf(stderr, "백업 목록을 찾을 수 없습니다: %s\n", name);
+        return FAILURE;
+    }
+
+    char line[256];
+    char magic[32];
+    int version = 0;
+    int declared_chunks = -1;
+    int status = FAILURE;
+    if (fgets(line, sizeof(line), file) && sscanf(line, "%31s %d", magic, &version) == 2 &&
+        strcmp(magic, MANIFEST_MAGIC) == 0 && version == BACKUP_STORE_VERSION &&
+        fgets(line, sizeof(line), file) && sscanf(line, "name %63s", manifest->name) == 1 &&
+        fgets(line, sizeof(line), file) && sscanf(line, "created %19[^\n]", manifest->created_at) == 1 &&
+        fgets(line, sizeof(line), file) && sscanf(line, "page_size %d", &manifest->page_size) == 1 &&
+        fgets(line, sizeof(line), file) && sscanf(line, "chunk_size %d", &manifest->chunk_size) == 1 &&
+        fgets(line, sizeof(line), file) && sscanf(line, "file_size %lld", &manifest->file_size) == 1 &&
+        fgets(line, sizeof(line), file) && sscanf(line, "chunks %d", &declared_chunks) == 1 &&
+        declared_chunks >= 0 && manifest->chunk_size > 0) {
+        status = SUCCESS;
+    }
+
+    if (status == SUCCESS && headers_only) {
+        manifest->chunk_count = declared_chunks;
+    } else if (status == SUCCESS) {
+        manifest->chunks = malloc(sizeof(BackupChunkRef) * ((size_t)declared_chunks + 1));
+        if (!manifest->chunks) {
+            status = FAILURE;
+        }
+        long long total = 0;
+        while (status == SUCCESS && manifest->chunk_count < declared_chunks && fgets(line, sizeof(line), file)) {
+            BackupChunkRef *chunk = &manifest->chunks[manifest->chunk_count];
+            char hex[HASH_HEX_LENGTH + 2];
+            if (sscanf(line, "%33s %d", hex, &chunk->length) != 2 || strlen(hex) != HASH_HEX_LENGTH ||
+                hex_to_hash(hex, chunk->hash) != SUCCESS || chunk->length <= 0 ||
+                chunk->length > manifest->chunk_size) {
+                status = FAILURE;
+                break;
+            }
+            total += chunk->length;
+            manifest->chunk_count++;
+        }
+        if (manifest->chunk_count != declared_chunks || total != manifest->file_size) {
+            status = FAILURE;
+        }
+    }
+    fclose(file);
+
+    if (status != SUCCESS) {
+        fprintf(stderr, "백업 목록이 손상되었습니다: %s\n", name);
+        backup_manifest_free(manifest);
+    }
+    return status;
+}
+
+int backup_manifest_load(const char *repository, const char *name, BackupManifest *manifest) {
+    if (!manifest) {
+        return FAILURE;
+    }
+    return load_manifest(repository, name, manifest, FALSE);
+}
+
+void backup_manifest_free(BackupManifest *manifest) {
+    if (!manifest) {
+        return;
+    }
+    free(manifest->chunks);
+    manifest->chunks = NULL;
+    manifest->chunk_count = 0;
+}
+
+// ---------------------------------------------------------------------------
+// 백업
+// ---------------------------------------------------------------------------
+
+// 읽기 전용 연결로 공유 잠금을 잡아, 파일을 읽는 동안 다른 연결이 원본 파일을 고치지 못하게 함
+static sqlite3 *open_locked_reader(const char *db_path, int *page_size) {
+    sqlite3 *reader = NULL;
+    if (sqlite3_open_v2(db_path, &reader, SQLITE_OPEN_READONLY, NULL) != SQLITE_OK) {
+        fprintf(stderr, "데이터베이스를 열 수 없습니다: %s\n", sqlite3_errmsg(reader));
+        sqlite3_close(reader);
+        return NULL;
+    }
+    sqlite3_busy_timeout(reader, BACKUP_BUSY_SLEEP_MS * BACKUP_MAX_BUSY_RETRIES);
+
+    sqlite3_stmt *stmt = NULL;
+    int ok = FALSE;
+    if (sqlite3_prepare_v2(reader, "PRAGMA journal_mode;", -1, &stmt, NULL) == SQLITE_OK &&
+        sqlite3_step(stmt) == SQLITE_ROW) {
+        ok = strcmp((const char*)sqlite3_column_text(stmt, 0), "wal") != 0;
+        if (!ok) {
+            fprintf(stderr, "WAL 모드 데이터베이스는 저장소 백업을 지원하지 않습니다.\n");
+        }
+    }
+    sqlite3_finalize(stmt);
+
+    if (ok) {
+        ok = FALSE;
+        if (sqlite3_exec(reader, "BEGIN;", NULL, NULL, NULL) == SQLITE_OK &&
+            sqlite3_prepare_v2(reader, "PRAGMA page_size;", -1, &stmt, NULL) == SQLITE_OK &&
+            sqlite3_step(stmt) == SQLITE_ROW) {
+            *page_size = sqlite3_column_int(stmt, 0);
+            ok = TRUE;
+        }
+        sqlite3_finalize(stmt);
+        // 스키마를 읽어야 실제로 공유 잠금을 잡음
+        if (ok && sqlite3_exec(reader, "SELECT COUNT(*) FROM sqlite_master;", NULL, NULL, NULL) != SQLITE_OK) {
+            fprintf(stderr, "데이터베이스 잠금 실패: %s\n", sqlite3_errmsg(reader));
+            ok = FALSE;
+        }
+    }
+
+    if (!ok) {
+        sqlite3_close(reader);
+        return NULL;
+    }
+    return reader;
+}
+
+int backup_store_create(sqlite3 *db, const char *repository, const char *name, BackupStoreStats *stats) {
+    BackupStoreStats result;
+    memset(&result, 0, sizeof(BackupStoreStats));
+    if (stats) {
+        *stats = result;
+    }
+    if (!db || !repository) {
+        fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
+        return FAILURE;
+    }
+
+    BackupManifest manifest;
+    memset(&manifest, 0, sizeof(BackupManifest));
+    time_t now = time(NULL);
+    struct tm local_tm, utc_tm;
+#ifdef _WIN32
+    localtime_s(&local_tm, &now);
+    gmtime_s(&utc_tm, &now);
+#else
+    localtime_r(&now, &local_tm);
+    gmtime_r(&now, &utc_tm);
+#endif
+    if (name && name[0] != '\0') {
+        safe_string_copy(manifest.name, name, sizeof(manifest.name));
+    } else {
+        strftime(manifest.name, sizeof(manifest.name), "%Y%m%d_%H%M%S", &local_tm);
+    }
+    strftime(manifest.created_at, sizeof(manifest.created_at), "%Y-%m-%d %H:%M:%S", &utc_tm);
+    if (!is_valid_name(manifest.name) || (name && strlen(name) >= sizeof(manifest.name))) {
+        fprintf(stderr, "백업 이름은 영문자, 숫자, '_', '-', '.'만 쓸 수 있습니다: %s\n", manifest.name);
+        return FAILURE;
+    }
+
+    const char *db_path = sqlite3_db_filename(db, "main");
+    if (!db_path || db_path[0] == '\0') {
+        fprintf(stderr, "파일 데이터베이스만 저장소에 백업할 수 있습니다.\n");
+        return FAILURE;
+    }
+    if (prepare_repository(repository) != SUCCESS) {
+        fprintf(stderr, "백업 저장소를 만들 수 없습니다: %s\n", repository);
+        return FAILURE;
+    }
+    char path[MAX_PATH_LENGTH];
+    manifest_path(repository, manifest.name, path, sizeof(path));
+    if (file_is_present(path)) {
+        fprintf(stderr, "같은 이름의 백업이 이미 있습니다: %s\n", manifest.name);
+        return FAILURE;
+    }
+
+    long long start_ns = timer_now_nanoseconds();
+    sqlite3 *reader = open_locked_reader(db_path, &manifest.page_size);
+    if (!reader) {
+        return FAILURE;
+    }
+    manifest.chunk_size = manifest.page_size >= BACKUP_STORE_CHUNK_SIZE
+        ? manifest.page_size
+        : BACKUP_STORE_CHUNK_SIZE - BACKUP_STORE_CHUNK_SIZE % manifest.page_size;
+
+    int status = SUCCESS;
+    unsigned char *buffer = malloc((size_t)manifest.chunk_size);
+    FILE *source = fopen(db_path, "rb");
+    if (!buffer || !source) {
+        fprintf(stderr, "데이터베이스 파일을 읽을 수 없습니다: %s\n", db_path);
+        status = FAILURE;
+    }
+
+    int capacity = 0;
+    unsigned char prefix_ready[256] = { 0 };   // 이번에 확인한 chunks/<앞 2자리> 디렉터리
+    size_t length;
+    while (status == SUCCESS && (length = fread(buffer, 1, (size_t)manifest.chunk_size, source)) > 0) {
+        if (manifest.chunk_count == capacity) {
+            capacity = capacity ? capacity * 2 : 1024;
+            BackupChunkRef *chunks = realloc(manifest.chunks, sizeof(BackupChunkRef) * (size_t)capacity);
+            if (!chunks) {
+                fprintf(stderr, "메모리 할당 실패\n");
+                status = FAILURE;
+                break;
+            }
+            manifest.chunks = chunks;
+        }
+        BackupChunkRef *chunk = &manifest.chunks[manifest.chunk_count++];
+        backup_store_hash(buffer, length, chunk->hash);
+        chunk->length = (int)length;
+        result.chunks++;
+        result.bytes += (long long)length;
+
+        char chunk_file[MAX_PATH_LENGTH];
+        chunk_path(repository, chunk->hash, chunk_file, sizeof(chunk_file));
+        if (file_is_present(chunk_file)) {
+            continue;   // 이전 백업이나 같은 백업의 앞 조각과 내용이 같음
+        }
+        if (!prefix_ready[chunk->hash[0]]) {
+            char directory[MAX_PATH_LENGTH];
+            snprintf(directory, sizeof(directory), "%.*s", (int)(strrchr(chunk_file, '/') - chunk_file), chunk_file);
+            create_directory_if_not_exists(directory);
+            prefix_ready[chunk->hash[0]] = TRUE;
+        }
+        if (write_chunk(chunk_file, buffer, length) != SUCCESS) {
+            fprintf(stderr, "조각 저장 실패: %s\n", chunk_file);
+            status = FAILURE;
+            break;
+        }
+        result.new_chunks++;
+        result.new_bytes += (long long)length;
+    }
+    if (status == SUCCESS && source && ferror(source)) {
+        fprintf(stderr, "데이터베이스 파일 읽기 실패: %s\n", db_path);
+        status = FAILURE;
+    }
+    manifest.file_size = result.bytes;
+
+    if (source) {
+        fclose(source);
+    }
+    free(buffer);
+    sqlite3_exec(reader, "COMMIT;", NULL, NULL, NULL);
+    sqlite3_close(reader);
+
+    if (status == SUCCESS) {
+        status = save_manifest(repository, &manifest);
+    }
+    backup_manifest_free(&manifest);
+
+    result.elapsed_seconds = (timer_now_nanoseconds() - start_ns) / 1e9;
+    if (stats) {
+        *stats = result;
+    }
+    return status;
+}
+
+// ---------------------------------------------------------------------------
+// 목록 조회, 복원, 정리
+// ---------------------------------------------------------------------------
+
+typedef struct {
+    char *name;
+    char created_at[20];
+} ManifestEntry;
+
+static int compare_manifest_entry(const void *a, const void *b) {
+    const ManifestEntry *left = (const ManifestEntry*)a;
+    const ManifestEntry *right = (const ManifestEntry*)b;
+    int order = strcmp(left->created_at, right->created_at);
+    return order != 0 ? order : strcmp(left->name, right->name);
+}
+
+int backup_store_list(const char *repository, char ***names, int *count) {
+    if (!repository || !names || !count) {
+        fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
+        return FAILURE;
+    }
+    *names = NULL;
+    *count = 0;
+
+    char path[MAX_PATH_LENGTH];
+    snprintf(path, sizeof(path), "%s/manifests", repository);
+    DIR *directory = opendir(path);
+    if (!directory) {
+        return SUCCESS;   // 아직 백업이 없는 저장소
+    }
+
+    ManifestEntry *entries = NULL;
+    int capacity = 0;
+    int status = SUCCESS;
+    struct dirent *item;
+    while ((item = readdir(directory)) != NULL) {
+        size_t length = strlen(item->d_name);
+        size_t suffix_length = strlen(MANIFEST_SUFFIX);
+        if (length <= suffix_length || strcmp(item->d_name + length - suffix_length, MANIFEST_SUFFIX) != 0) {
+            continue;
+        }
+        char name[BACKUP_STORE_NAME_LENGTH];
+        if (length - suffix_length >= sizeof(name)) {
+            continue;
+        }
+        memcpy(name, item->d_name, length - suffix_length);
+        name[length - suffix_length] = '\0';
+
+        BackupManifest manifest;
+        if (load_manifest(repository, name, &manifest, TRUE) != SUCCESS) {
+            continue;
+        }
+        if (*count == capacity) {
+            capacity = capacity ? capacity * 2 : 16;
+            ManifestEntry *grown = realloc(entries, sizeof(ManifestEntry) * (size_t)capacity);
+            if (!grown) {
+                status = FAILURE;
+                break;
+            }
+            entries = grown;
+        }
+        entries[*count].name = strdup(name);
+        if (!entries[*count].name) {
+            status = FAILURE;
+            break;
+        }
+        memcpy(entries[*count].created_at, manifest.created_at, sizeof(manifest.created_at));
+        (*count)++;
+    }
+    closedir(directory);
+
+    if (status == SUCCESS && *count > 0) {
+        qsort(entries, (size_t)*count, sizeof(ManifestEntry), compare_manifest_entry);
+        *names = malloc(sizeof(char*) * (size_t)*count);
+        if (!*names) {
+            status = FAILURE;
+        }
+    }
+    for (int i = 0; i < *count; i++) {
+        if (status == SUCCESS) {
+            (*names)[i] = entries[i].name;
+        } else {
+            free(entries[i].name);
+        }
+    }
+    free(entries);
+    if (status != SUCCESS) {
+        fprintf(stderr, "메모리 할당 실패\n");
+        *count = 0;
+    }
+    return status;
+}
+
+int backup_store_restore(const char *repository, const char *name, const char *output_path,
+                         BackupStoreStats *stats) {
+    BackupStoreStats result;
+    memset(&result, 0, sizeof(BackupStoreStats));
+    if (stats) {
+        *stats = result;
+    }
+    if (!output_path) {
+        fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
+        return FAILURE;
+    }
+
+    BackupManifest manifest;
+    if (backup_manifest_load(repository, name, &manifest) != SUCCESS) {
+        return FAILURE;
+    }
+
+    char partial_path[MAX_PATH_LENGTH];
+    snprintf(partial_path, sizeof(partial_path), "%s%s", output_path, BACKUP_PARTIAL_SUFFIX);
+    long long start_ns = timer_now_nanoseconds();
+    unsigned char *buffer = malloc((size_t)manifest.chunk_size);
+    FILE *output = fopen(partial_path, "wb");
+    int status = buffer && output ? SUCCESS : FAILURE;
+    if (status != SUCCESS) {
+        fprintf(stderr, "복원 파일을 만들 수 없습니다: %s\n", output_path);
+    }
+
+    for (int i = 0; status == SUCCESS && i < manifest.chunk_count; i++) {
+        const BackupChunkRef *chunk = &manifest.chunks[i];
+        char chunk_file[MAX_PATH_LENGTH];
+        chunk_path(repository, chunk->hash, chunk_file, sizeof(chunk_file));
+
+        FILE *input = fopen(chunk_file, "rb");
+        size_t length = input ? fread(buffer, 1, (size_t)manifest.chunk_size, input) : 0;
+        if (input) {
+            fclose(input);
+        }
+        unsigned char hash[BACKUP_STORE_HASH_SIZE];
+        backup_store_hash(buffer, length, hash);
+        if (!input || length != (size_t)chunk->length || memcmp(hash, chunk->hash, sizeof(hash)) != 0) {
+            fprintf(stderr, "조각이 없거나 손상되었습니다: %s\n", chunk_file);
+            status = FAILURE;
+            break;
+        }
+        if (fwrite(buffer, 1, length, output) != length) {
+            fprintf(stderr, "복원 파일 쓰기 실패: %s\n", output_path);
+            status = FAILURE;
+            break;
+        }
+        result.chunks++;
+        result.bytes += (long long)length;
+    }
+
+    if (output && fclose(output) != 0) {
+        status = FAILURE;
+    }
+    free(buffer);
+    backup_manifest_free(&manifest);
+
+    if (status == SUCCESS) {
+#ifdef _WIN32
+        // Windows의 rename은 대상 파일이 있으면 실패함
+        remove(output_path);
+#endif
+        if (rename(partial_path, output_path) != 0) {
+            fprintf(stderr, "복원 파일 이름 변경 실패: %s\n", output_path);
+            status = FAILURE;
+        }
+    }
+    if (status != SUCCESS) {
+        remove(partial_path);
+    }
+
+    result.elapsed_seconds = (timer_now_nanoseconds() - start_ns) / 1e9;
+    if (stats) {
+        *stats = result;
+    }
+    return status;
+}
+
+int backup_store_delete(const char *repository, const char *name) {
+    if (!repository || !name || !is_valid_name(name)) {
+        fprintf(stderr, "유효하지 않은 백업 이름입니다.\n");
+        return FAILURE;
+    }
+    char path[MAX_PATH_LENGTH];
+    manifest_path(repository, name, path, sizeof(path));
+    if (remove(path) != 0) {
+        fprintf(stderr, "백업 목록을 지울 수 없습니다: %s\n", name);
+        return FAILURE;
+    }
+    return SUCCESS;
+}
+
+static int compare_hash(const void *a, const void *b) {
+    return memcmp(a, b, BACKUP_STORE_HASH_SIZE);
+}
+
+int backup_store_gc(const char *repository, BackupStoreStats *stats) {
+    BackupStoreStats result;
+    memset(&result, 0, sizeof(BackupStoreStats));
+    if (stats) {
+        *stats = result;
+    }
+    if (!repository) {
+        fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
+        return FAILURE;
+    }
+
+    char **names = NULL;
+    int name_count = 0;
+    if (backup_store_list(repository, &names, &name_count) != SUCCESS) {
+        return FAILURE;
+    }
+
+    // 모든 목록이 쓰는 해시를 정렬해 두고 조각마다 이진 탐색
+    long long start_ns = timer_now_nanoseconds();
+    unsigned char *live = NULL;
+    size_t live_count = 0;
+    size_t live_capacity = 0;
+    int status = SUCCESS;
+    for (int i = 0; i < name_count; i++) {
+        BackupManifest manifest;
+        if (status == SUCCESS && backup_manifest_load(repository, names[i], &manifest) != SUCCESS) {
+            // 읽을 수 없는 목록이 쓰는 조각을 지우지 않도록 정리를 멈춤
+            status = FAILURE;
+        }
+        if (status == SUCCESS && live_count + (size_t)manifest.chunk_count > live_capacity) {
+            while (live_count + (size_t)manifest.chunk_count > live_capacity) {
+                live_capacity = live_capacity ? live_capacity * 2 : 4096;
+            }
+            unsigned char *grown = realloc(live, live_capacity * BACKUP_STORE_HASH_SIZE);
+            if (!grown) {
+                fprintf(stderr, "메모리 할당 실패\n");
+                status = FAILURE;
+            } else {
+                live = grown;
+            }
+        }
+        if (status == SUCCESS) {
+            for (int j = 0; j < manifest.chunk_count; j++) {
+                memcpy(live + live_count++ * BACKUP_STORE_HASH_SIZE, manifest.chunks[j].hash,
+                       BACKUP_STORE_HASH_SIZE);
+            }
+            backup_manifest_free(&manifest);
+        }
+        free(names[i]);
+    }
+    free(names);
+    if (live_count > 0) {
+        qsort(live, live_count, BACKUP_STORE_HASH_SIZE, compare_hash);
+    }
+
+    char chunks_path[MAX_PATH_LENGTH];
+    snprintf(chunks_path, sizeof(chunks_path), "%s/chunks", repository);
+    DIR *chunks = status == SUCCESS ? opendir(chunks_path) : NULL;
+    struct dirent *prefix;
+    while (chunks && (prefix = readdir(chunks)) != NULL) {
+        if (strlen(prefix->d_name) != 2 || hex_value(prefix->d_name[0]) < 0 || hex_value(prefix->d_name[1]) < 0) {
+            continue;
+        }
+        char prefix_path[MAX_PATH_LENGTH + 4];
+        snprintf(prefix_path, sizeof(prefix_path), "%s/%.2s", chunks_path, prefix->d_name);
+        DIR *directory = opendir(prefix_path);
+        struct dirent *item;
+        while (directory && (item = readdir(directory)) != NULL) {
+            if (item->d_name[0] == '.') {
+                continue;
+            }
+            char file_path[MAX_PATH_LENGTH * 2];
+            snprintf(file_path, sizeof(file_path), "%s/%s", prefix_path, item->d_name);
+
+            unsigned char hash[BACKUP_STORE_HASH_SIZE];
+            int is_chunk = strlen(item->d_name) == HASH_HEX_LENGTH && hex_to_hash(item->d_name, hash) == SUCCESS;
+            if (is_chunk && live_count > 0 && bsearch(hash, live, live_count, BACKUP_STORE_HASH_SIZE, compare_hash)) {
+                result.chunks++;
+                continue;
+            }
+            // 쓰지 않는 조각과 중간에 끊긴 임시 파일
+            struct stat info;
+            long long size = stat(file_path, &info) == 0 ? (long long)info.st_size : 0;
+            if (remove(file_path) == 0) {
+                result.new_chunks += is_chunk;
+                result.new_bytes += size;
+            }
+        }
+        if (directory) {
+            closedir(directory);
+        }
+    }
+    if (chunks) {
+        closedir(chunks);
+    }
+    free(live);
+
+    result.elapsed_seconds = (timer_now_nanoseconds() - start_ns) / 1e9;
+    if (stats) {
+        *stats = result;
+    }
+    return status;
+}
@@ -6,11 +6,37 @@
 #include "../include/book.h"
 #include "../include/database.h"
 #include "../include/constants.h"
+#include "../include/hangul.h"
+#include "../include/metrics.h"
+#include "../include/workload_trace.h"
 
 static int book_callback(void *data, int argc, char **argv, char **azColName);
 static int count_callback(void *data, int argc, char **argv, char **azColName);
+static int search_books_by_normalized_text(sqlite3 *db, const char *column, const char *order_by,
+                                           const char *text, BookSearchResult *result);
 
-int add_book(sqlite3 *db, const Book *book) {
+// 열 값을 버퍼에 복사 (NULL이면 빈 문자열: ISBN이 없는 도서는 isbn이 NULL로 저장됨)
+static void copy_column(char *dest, size_t dest_size, const unsigned char *value) {
+    snprintf(dest, dest_size, "%s", value ? (const char*)value : "");
+}
+
+// id, title, author, isbn, publisher, publication_year, total_copies, available_copies,
+// category, created_at, updated_at 순서로 조회한 행을 Book에 복사
+static void read_book_row(sqlite3_stmt *stmt, Book *book) {
+    book->id = sqlite3_column_int(stmt, 0);
+    copy_column(book->title, sizeof(book->title), sqlite3_column_text(stmt, 1));
+    copy_column(book->author, sizeof(book->author), sqlite3_column_text(stmt, 2));
+    copy_column(book->isbn, sizeof(book->isbn), sqlite3_column_text(stmt, 3));
+    copy_column(book->publisher, sizeof(book->publisher), sqlite3_column_text(stmt, 4));
+    book->publication_year = sqlite3_column_int(stmt, 5);
+    book->total_copies = sqlite3_column_int(stmt, 6);
+    book->available_copies = sqlite3_column_int(stmt, 7);
+    copy_column(book->category, sizeof(book->category), sqlite3_column_text(stmt, 8));
+    book->created_at = (time_t)sqlite3_column_int64(stmt, 9);
+    book->updated_at = (time_t)sqlite3_column_int64(stmt, 10);
+}
+
+static int add_book_impl(sqlite3 *db, const Book *book) {
     if (!db || !book) {
         fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
         return FAILURE;
@@ -23,8 +49,10 @@ int add_book(sqlite3 *db, const Book *book) {
     
     const char *sql = 
         "INSERT INTO books (title, author, isbn, publisher, publication_year, "
-        "total_copies, available_copies, category) "
-        "VALUES (?, ?, ?, ?, ?, ?, ?, ?);";
+        "total_copies, available_copies, category, "
+        "title_norm, title_chosung, author_norm, author_chosung) "
+        "VALUES (?1, ?2, ?3, ?4, ?5, ?6, ?7, ?8, "
+        "hangul_normalize(?1), hangul_chosung(?1), hangul_normalize(?2), hangul_chosung(?2));";
     
     sqlite3_stmt *stmt = NULL;
     int result = FAILURE;
@@ -53,7 +81,15 @@ int add_book(sqlite3 *db, const Book *book) {
     return result;
 }
 
-int get_book_by_id(sqlite3 *db, int book_id, Book *book) {
+int add_book(sqlite3 *db, const Book *book) {
+    long long start = metrics_start();
+    int status = add_book_impl(db, book);
+    metrics_record_since(METRIC_ADD_BOOK, start, status);
+    workload_trace_record(METRIC_ADD_BOOK, start, status, book);
+    return status;
+}
+
+static int get_book_by_id_impl(sqlite3 *db, int book_id, Book *book) {
     if (!db || !book || book_id <= 0) {
         fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
         return FAILURE;
@@ -74,22 +110,7 @@ int get_book_by_id(sqlite3 *db, int book_id, Book *book) {
     sqlite3_bind_int(stmt, 1, book_id);
     
     if (sqlite3_step(stmt) == SQLITE_ROW) {
-        book->id = sqlite3_column_int(stmt, 0);
-        strncpy(book->title, (const char*)sqlite3_column_text(stmt, 1), MAX_TITLE_LENGTH);
-        book->title[MAX_TITLE_LENGTH] = '\0';
-        strncpy(book->author, (const char*)sqlite3_column_text(stmt, 2), MAX_AUTHOR_LENGTH);
-        book->author[MAX_AUTHOR_LENGTH] = '\0';
-        strncpy(book->isbn, (const char*)sqlite3_column_text(stmt, 3), MAX_ISBN_LENGTH);
-        book->isbn[MAX_ISBN_LENGTH] = '\0';
-        strncpy(book->publisher, (const char*)sqlite3_column_text(stmt, 4), MAX_PUBLISHER_LENGTH);
-        book->publisher[MAX_PUBLISHER_LENGTH] = '\0';
-        book->publication_year = sqlite3_column_int(stmt, 5);
-        book->total_copies = sqlite3_column_int(stmt, 6);
-        book->available_copies = sqlite3_column_int(stmt, 7);
-        strncpy(book->category, (const char*)sqlite3_column_text(stmt, 8), MAX_CATEGORY_LENGTH);
-        book->category[MAX_CATEGORY_LENGTH] = '\0';
-        book->created_at = (time_t)sqlite3_column_int64(stmt, 9);
-        book->updated_at = (time_t)sqlite3_column_int64(stmt, 10);
+        read_book_row(stmt, book);
         
         result = SUCCESS;
     }
@@ -98,7 +119,15 @@ int get_book_by_id(sqlite3 *db, int book_id, Book *book) {
     return result;
 }
 
-int get_book_by_isbn(sqlite3 *db, const char *isbn, Book *book) {
+int get_book_by_id(sqlite3 *db, int book_id, Book *book) {
+    long long start = metrics_start();
+    int status = get_book_by_id_impl(db, book_id, book);
+    metrics_record_since(METRIC_GET_BOOK_BY_ID, start, status);
+    workload_trace_record(METRIC_GET_BOOK_BY_ID, start, status, book_id);
+    return status;
+}
+
+static int get_book_by_isbn_impl(sqlite3 *db, const char *isbn, Book *book) {
     if (!db || !isbn || !book) {
         fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
         return FAILURE;
@@ -119,22 +148,7 @@ int get_book_by_isbn(sqlite3 *db, const char *isbn, Book *book) {
     sqlite3_bind_text(stmt, 1, isbn, -1, SQLITE_STATIC);
     
     if (sqlite3_step(stmt) == SQLITE_ROW) {
-        book->id = sqlite3_column_int(stmt, 0);
-        strncpy(book->title, (const char*)sqlite3_column_text(stmt, 1), MAX_TITLE_LENGTH);
-        book->title[MAX_TITLE_LENGTH] = '\0';
-        strncpy(book->author, (const char*)sqlite3_column_text(stmt, 2), MAX_AUTHOR_LENGTH);
-        book->author[MAX_AUTHOR_LENGTH] = '\0';
-        strncpy(book->isbn, (const char*)sqlite3_column_text(stmt, 3), MAX_ISBN_LENGTH);
-        book->isbn[MAX_ISBN_LENGTH] = '\0';
-        strncpy(book->publisher, (const char*)sqlite3_column_text(stmt, 4), MAX_PUBLISHER_LENGTH);
-        book->publisher[MAX_PUBLISHER_LENGTH] = '\0';
-        book->publication_year = sqlite3_column_int(stmt, 5);
-        book->total_copies = sqlite3_column_int(stmt, 6);
-        book->available_copies = sqlite3_column_int(stmt, 7);
-        strncpy(book->category, (const char*)sqlite3_column_text(stmt, 8), MAX_CATEGORY_LENGTH);
-        book->category[MAX_CATEGORY_LENGTH] = '\0';
-        book->created_at = (time_t)sqlite3_column_int64(stmt, 9);
-        book->updated_at = (time_t)sqlite3_column_int64(stmt, 10);
+        read_book_row(stmt, book);
         
         result = SUCCESS;
     }
@@ -143,37 +157,49 @@ int get_book_by_isbn(sqlite3 *db, const char *isbn, Book *book) {
     return result;
 }
 
-int search_books_by_title(sqlite3 *db, const char *title, BookSearchResult *result) {
+int get_book_by_isbn(sqlite3 *db, const char *isbn, Book *book) {
+    long long start = metrics_start();
+    int status = get_book_by_isbn_impl(db, isbn, book);
+    metrics_record_since(METRIC_GET_BOOK_BY_ISBN, start, status);
+    workload_trace_record(METRIC_GET_BOOK_BY_ISBN, start, status, isbn);
+    return status;
+}
+
+static int search_books_by_title_impl(sqlite3 *db, const char *title, BookSearchResult *result) {
     if (!db || !title || !result) {
         fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
         return FAILURE;
     }
     
-    char sql[MAX_SQL_LENGTH];
-    snprintf(sql, sizeof(sql), 
-        "SELECT id, title, author, isbn, publisher, publication_year, "
-        "total_copies, available_copies, category, created_at, updated_at "
-        "FROM books WHERE title LIKE '%%%s%%' ORDER BY title;", title);
-    
-    return sqlite3_exec(db, sql, book_callback, result, NULL) == SQLITE_OK ? SUCCESS : FAILURE;
+    return search_books_by_normalized_text(db, "title", "title", title, result);
 }
 
-int search_books_by_author(sqlite3 *db, const char *author, BookSearchResult *result) {
+int search_books_by_title(sqlite3 *db, const char *title, BookSearchResult *result) {
+    long long start = metrics_start();
+    int status = search_books_by_title_impl(db, title, result);
+    metrics_record_since(METRIC_SEARCH_BOOKS_BY_TITLE, start, status);
+    workload_trace_record(METRIC_SEARCH_BOOKS_BY_TITLE, start, status, title);
+    return status;
+}
+
+static int search_books_by_author_impl(sqlite3 *db, const char *author, BookSearchResult *result) {
     if (!db || !author || !result) {
         fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
         return FAILURE;
     }
     
-    char sql[MAX_SQL_LENGTH];
-    snprintf(sql, sizeof(sql), 
-        "SELECT id, title, author, isbn, publisher, publication_year, "
-        "total_copies, available_copies, category, created_at, updated_at "
-        "FROM books WHERE author LIKE '%%%s%%' ORDER BY author, title;", author);
-    
-    return sqlite3_exec(db, sql, book_callback, result, NULL) == SQLITE_OK ? SUCCESS : FAILURE;
+    return search_books_by_normalized_text(db, "author", "author, title", author, result);
 }
 
-int search_books_by_category(sqlite3 *db, const char *category, BookSearchResult *result) {
+int search_books_by_author(sqlite3 *db, const char *author, BookSearchResult *result) {
+    long long start = metrics_start();
+    int status = search_books_by_author_impl(db, author, result);
+    metrics_record_since(METRIC_SEARCH_BOOKS_BY_AUTHOR, start, status);
+    workload_trace_record(METRIC_SEARCH_BOOKS_BY_AUTHOR, start, status, author);
+    return status;
+}
+
+static int search_books_by_category_impl(sqlite3 *db, const char *category, BookSearchResult *result) {
     if (!db || !category || !result) {
         fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
         return FAILURE;
@@ -188,7 +214,15 @@ int search_books_by_category(sqlite3 *db, const char *category, BookSearchResult
     return sqlite3_exec(db, sql, book_callback, result, NULL) == SQLITE_OK ? SUCCESS : FAILURE;
 }
 
-int update_book(sqlite3 *db, const Book *book) {
+int search_books_by_category(sqlite3 *db, const char *category, BookSearchResult *result) {
+    long long start = metrics_start();
+    int status = search_books_by_category_impl(db, category, result);
+    metrics_record_since(METRIC_SEARCH_BOOKS_BY_CATEGORY, start, status);
+    workload_trace_record(METRIC_SEARCH_BOOKS_BY_CATEGORY, start, status, category);
+    return status;
+}
+
+static int update_book_impl(sqlite3 *db, const Book *book) {
     if (!db || !book || book->id <= 0) {
         fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
         return FAILURE;
@@ -200,9 +234,11 @@ int update_book(sqlite3 *db, const Book *book) {
     }
     
     const char *sql = 
-        "UPDATE books SET title = ?, author = ?, isbn = ?, publisher = ?, "
-        "publication_year = ?, total_copies = ?, available_copies = ?, "
-        "category = ?, updated_at = CURRENT_TIMESTAMP WHERE id = ?;";
+        "UPDATE books SET title = ?1, author = ?2, isbn = ?3, publisher = ?4, "
+        "publication_year = ?5, total_copies = ?6, available_copies = ?7, "
+        "category = ?8, title_norm = hangul_normalize(?1), title_chosung = hangul_chosung(?1), "
+        "author_norm = hangul_normalize(?2), author_chosung = hangul_chosung(?2), "
+        "updated_at = CURRENT_TIMESTAMP WHERE id = ?9;";
     
     sqlite3_stmt *stmt = NULL;
     int result = FAILURE;
@@ -232,7 +268,15 @@ int update_book(sqlite3 *db, const Book *book) {
     return result;
 }
 
-int delete_book(sqlite3 *db, int book_id) {
+int update_book(sqlite3 *db, const Book *book) {
+    long long start = metrics_start();
+    int status = update_book_impl(db, book);
+    metrics_record_since(METRIC_UPDATE_BOOK, start, status);
+    workload_trace_record(METRIC_UPDATE_BOOK, start, status, book);
+    return status;
+}
+
+static int delete_book_impl(sqlite3 *db, int book_id) {
     if (!db || book_id <= 0) {
         fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
         return FAILURE;
@@ -283,7 +327,15 @@ int delete_book(sqlite3 *db, int book_id) {
     return result;
 }
 
-int list_all_books(sqlite3 *db, BookSearchResult *result, int limit, int offset) {
+int delete_book(sqlite3 *db, int book_id) {
+    long long start = metrics_start();
+    int status = delete_book_impl(db, book_id);
+    metrics_record_since(METRIC_DELETE_BOOK, start, status);
+    workload_trace_record(METRIC_DELETE_BOOK, start, status, book_id);
+    return status;
+}
+
+static int list_all_books_impl(sqlite3 *db, BookSearchResult *result, int limit, int offset) {
     if (!db || !result) {
         fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
         return FAILURE;
@@ -305,7 +357,15 @@ int list_all_books(sqlite3 *db, BookSearchResult *result, int limit, int offset)
     return sqlite3_exec(db, sql, book_callback, result, NULL) == SQLITE_OK ? SUCCESS : FAILURE;
 }
 
-int list_available_books(sqlite3 *db, BookSearchResult *result) {
+int list_all_books(sqlite3 *db, BookSearchResult *result, int limit, int offset) {
+    long long start = metrics_start();
+    int status = list_all_books_impl(db, result, limit, offset);
+    metrics_record_since(METRIC_LIST_ALL_BOOKS, start, status);
+    workload_trace_record(METRIC_LIST_ALL_BOOKS, start, status, limit, offset);
+    return status;
+}
+
+static int list_available_books_impl(sqlite3 *db, BookSearchResult *result) {
     if (!db || !result) {
         fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
         return FAILURE;
@@ -319,7 +379,15 @@ int list_available_books(sqlite3 *db, BookSearchResult *result) {
     return sqlite3_exec(db, sql, book_callback, result, NULL) == SQLITE_OK ? SUCCESS : FAILURE;
 }
 
-int get_popular_books(sqlite3 *db, BookSearchResult *result, int limit) {
+int list_available_books(sqlite3 *db, BookSearchResult *result) {
+    long long start = metrics_start();
+    int status = list_available_books_impl(db, result);
+    metrics_record_since(METRIC_LIST_AVAILABLE_BOOKS, start, status);
+    workload_trace_record(METRIC_LIST_AVAILABLE_BOOKS, start, status);
+    return status;
+}
+
+static int get_popular_books_impl(sqlite3 *db, BookSearchResult *result, int limit) {
     if (!db || !result || limit <= 0) {
         fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
         return FAILURE;
@@ -338,6 +406,14 @@ int get_popular_books(sqlite3 *db, BookSearchResult *result, int limit) {
     return sqlite3_exec(db, sql, book_callback, result, NULL) == SQLITE_OK ? SUCCESS : FAILURE;
 }
 
+int get_popular_books(sqlite3 *db, BookSearchResult *result, int limit) {
+    long long start = metrics_start();
+    int status = get_popular_books_impl(db, result, limit);
+    metrics_record_since(METRIC_GET_POPULAR_BOOKS, start, status);
+    workload_trace_record(METRIC_GET_POPULAR_BOOKS, start, status, limit);
+    return status;
+}
+
 int init_book_search_result(BookSearchResult *result) {
     if (!result) {
         fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
@@ -511,6 +587,134 @@ static int book_callback(void *data, int argc, char **argv, char **azColName) {
     return SQLITE_OK;
 }
 
+// UTF-8 문자열의 글자(코드 포인트) 수
+static int count_characters(const char *text) {
+    int count = 0;
+    for (const unsigned char *p = (const unsigned char*)text; *p; p++) {
+        if ((*p & 0xC0) != 0x80) {
+            count++;
+        }
+    }
+    return count;
+}
+
+// books_search 색인이 있으면 TRUE
+static int book_search_index_exists(sqlite3 *db) {
+    sqlite3_stmt *stmt = NULL;
+    int exists = FALSE;
+    
+    if (database_prepare_statement(db,
+            "SELECT 1 FROM sqlite_master WHERE type = 'table' AND name = 'books_search';", &stmt) != SUCCESS) {
+        return FAILURE;
+    }
+    
+    exists = sqlite3_step(stmt) == SQLITE_ROW ? TRUE : FALSE;
+    sqlite3_finalize(stmt);
+    return exists;
+}
+
+// 한 컬럼에서 검색어를 연속으로 포함하는 행을 찾는 FTS5 질의 (예: title_norm : "ㅈㅏㅂㅏ")
+static char *build_match_query(const char *column, const char *suffix, const char *key) {
+    size_t size = strlen(column) + strlen(suffix) + strlen(key) * 2 + 8;
+    char *match = malloc(size);
+    
+    if (!match) {
+        fprintf(stderr, "메모리 할당 실패\n");
+        return NULL;
+    }
+    
+    size_t length = (size_t)snprintf(match, size, "%s_%s : \"", column, suffix);
+    for (const char *p = key; *p; p++) {
+        // 따옴표는 두 번 써서 문자 그대로 찾음
+        if (*p == '"') {
+            match[length++] = '"';
+        }
+        match[length++] = *p;
+    }
+    match[length++] = '"';
+    match[length] = '\0';
+    return match;
+}
+
+// 제목/저자 부분 검색: 초성만 입력하면 초성 컬럼, 아니면 자모 분해된 컬럼에서 찾음
+static int search_books_by_normalized_text(sqlite3 *db, const char *column, const char *order_by,
+                                           const char *text, BookSearchResult *result) {
+    int chosung_query = hangul_is_chosung_query(text);
+    size_t key_size = strlen(text) * 3 + 1;
+    char *key = malloc(key_size);
+    
+    if (!key) {
+        fprintf(stderr, "메모리 할당 실패\n");
+        return FAILURE;
+    }
+    
+    int key_length = chosung_query ? hangul_extract_chosung(text, key, key_size)
+                                   : hangul_normalize(text, key, key_size);
+    if (key_length == FAILURE) {
+        free(key);
+        return FAILURE;
+    }
+    
+    const char *suffix = chosung_query ? "chosung" : "norm";
+    
+    // 세 글자 이상이면 trigram 색인(books_search)에서 후보를 찾음. trigram으로는 더 짧은 검색어를 찾을 수 없고,
+    // 색인은 FTS5가 있는 SQLite에서만 만들어지므로 그 밖의 경우에는 검색 컬럼을 훑음
+    char *match = NULL;
+    if (count_characters(key) >= BOOK_SEARCH_INDEX_MIN_CHARS && book_search_index_exists(db) == TRUE) {
+        match = build_match_query(column, suffix, key);
+        if (!match) {
+            free(key);
+            return FAILURE;
+        }
+    }
+    
+    // 검색어는 바인딩하고 instr()로 비교하여 %, _ 같은 LIKE 특수 문자 영향을 받지 않음
+    // (색인으로 찾은 후보도 instr()로 다시 확인)
+    char sql[MAX_SQL_LENGTH];
+    snprintf(sql, sizeof(sql),
+        "SELECT id, title, author, isbn, publisher, publication_year, "
+        "total_copies, available_copies, category, created_at, updated_at "
+        "FROM books WHERE %sinstr(%s_%s, ?1) > 0 ORDER BY %s;",
+        match ? "id IN (SELECT rowid FROM books_search WHERE books_search MATCH ?2) AND " : "",
+        column, suffix, order_by);
+    
+    sqlite3_stmt *stmt = NULL;
+    int status = FAILURE;
+    
+    if (database_prepare_statement(db, sql, &stmt) == SUCCESS) {
+        sqlite3_bind_text(stmt, 1, key, key_length, SQLITE_STATIC);
+        if (match) {
+            sqlite3_bind_text(stmt, 2, match, -1, SQLITE_STATIC);
+        }
+        
+        char *argv[11];
+        int step_result;
+        
+        status = SUCCESS;
+        while ((step_result = sqlite3_step(stmt)) == SQLITE_ROW) {
+            for (int i = 0; i < 11; i++) {
+                argv[i] = (char*)sqlite3_column_text(stmt, i);
+            }
+            
+            if (book_callback(result, 11, argv, NULL) != SQLITE_OK) {
+                status = FAILURE;
+                break;
+            }
+        }
+        
+        if (status == SUCCESS && step_result != SQLITE_DONE) {
+            fprintf(stderr, "도서 검색 실패: %s\n", sqlite3_errmsg(db));
+            status = FAILURE;
+        }
+        
+        sqlite3_finalize(stmt);
+    }
+    
+    free(match);
+    free(key);
+    return status;
+}
+
 static int count_callback(void *data, int argc, char **argv, char **azColName) {
     int *count = (int*)data;
     if (argc > 0 && argv[0]) {
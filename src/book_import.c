@@ -0,0 +1,1395 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+#include "../include/book_import.h"
+#include "../include/book.h"
+#include "../include/database.h"
+#include "../include/marc.h"
+#include "../include/utils.h"
+
+#define READ_BUFFER_SIZE 65536
+
+// 거부 사유 (거부 파일의 reject_reason 열에 그대로 기록)
+#define REASON_TOO_LONG "행이 너무 깁니다"
+#define REASON_BAD_QUOTES "따옴표 형식이 올바르지 않습니다"
+#define REASON_FIELD_COUNT "열 수가 머리글과 다릅니다"
+#define REASON_FIELD_LENGTH "필드 값이 너무 깁니다"
+#define REASON_BAD_NUMBER "숫자 필드 값이 올바르지 않습니다"
+#define REASON_INVALID_BOOK "필수 항목이 없거나 권수가 올바르지 않습니다"
+#define REASON_INVALID_ISBN "ISBN 형식이 올바르지 않습니다"
+#define REASON_DUPLICATE_ISBN "이미 있는 ISBN입니다"
+#define REASON_BAD_MARC "손상된 MARC 레코드입니다"
+
+// split_fields 반환값 (0 이상이면 필드 수)
+#define SPLIT_BAD_QUOTES -1
+#define SPLIT_TOO_MANY -2
+
+// ---------------------------------------------------------------------------
+// 머리글 열 이름
+// ---------------------------------------------------------------------------
+
+typedef enum {
+    COLUMN_TITLE = 0,
+    COLUMN_AUTHOR,
+    COLUMN_ISBN,
+    COLUMN_PUBLISHER,
+    COLUMN_PUBLICATION_YEAR,
+    COLUMN_TOTAL_COPIES,
+    COLUMN_AVAILABLE_COPIES,
+    COLUMN_CATEGORY,
+    COLUMN_COUNT
+} ImportColumn;
+
+static const struct {
+    ImportColumn column;
+    const char *name;
+} column_names[] = {
+    { COLUMN_TITLE, "title" },
+    { COLUMN_TITLE, "제목" },
+    { COLUMN_AUTHOR, "author" },
+    { COLUMN_AUTHOR, "저자" },
+    { COLUMN_ISBN, "isbn" },
+    { COLUMN_PUBLISHER, "publisher" },
+    { COLUMN_PUBLISHER, "출판사" },
+    { COLUMN_PUBLICATION_YEAR, "publication_year" },
+    { COLUMN_PUBLICATION_YEAR, "출판년도" },
+    { COLUMN_TOTAL_COPIES, "total_copies" },
+    { COLUMN_TOTAL_COPIES, "보유권수" },
+    { COLUMN_AVAILABLE_COPIES, "available_copies" },
+    { COLUMN_AVAILABLE_COPIES, "대출가능권수" },
+    { COLUMN_CATEGORY, "category" },
+    { COLUMN_CATEGORY, "카테고리" },
+};
+
+// ---------------------------------------------------------------------------
+// 행 묶음: 읽기 스레드가 원문을 채우고, 파싱 스레드가 도서와 거부 사유를 채움
+// ---------------------------------------------------------------------------
+
+typedef struct {
+    long long sequence;        // 파일 안에서의 묶음 순서
+    long long end_offset;      // 마지막 행 다음 바이트의 파일 위치
+    long long end_line;        // 마지막 행까지 읽은 줄 수
+    int last;                  // 파일의 마지막 묶음이면 TRUE
+    int count;
+    int capacity;
+    size_t *text_offsets;      // 행별 원문 시작 위치 (text 안, NUL로 끝남)
+    long long *lines;          // 행이 시작하는 줄 번호
+    const char **reasons;      // 거부 사유 (NULL이면 정상)
+    Book *books;
+    unsigned long long *isbn_keys;   // ISBN-13 숫자 값 (ISBN이 없으면 0)
+    MarcRecord *marc_records;  // MARC 원본이면 매핑한 파일 안의 레코드 (text는 쓰지 않음)
+    char *text;
+    size_t text_length;
+    size_t text_capacity;
+} ImportBatch;
+
+static void batch_free(ImportBatch *batch) {
+    if (!batch) {
+        return;
+    }
+    free(batch->text_offsets);
+    free(batch->lines);
+    free(batch->reasons);
+    free(batch->books);
+    free(batch->isbn_keys);
+    free(batch->marc_records);
+    free(batch->text);
+    free(batch);
+}
+
+static ImportBatch *batch_create(int capacity, int marc) {
+    ImportBatch *batch = calloc(1, sizeof(ImportBatch));
+    if (!batch) {
+        return NULL;
+    }
+    batch->capacity = capacity;
+    batch->text_capacity = (size_t)capacity * 128;
+    batch->text_offsets = malloc(sizeof(size_t) * (size_t)capacity);
+    batch->lines = malloc(sizeof(long long) * (size_t)capacity);
+    batch->reasons = calloc((size_t)capacity, sizeof(const char*));
+    batch->books = malloc(sizeof(Book) * (size_t)capacity);
+    batch->isbn_keys = calloc((size_t)capacity, sizeof(unsigned long long));
+    batch->text = malloc(batch->text_capacity);
+    if (marc) {
+        batch->marc_records = malloc(sizeof(MarcRecord) * (size_t)capacity);
+    }
+    if (!batch->text_offsets || !batch->lines || !batch->reasons || !batch->books ||
+        !batch->isbn_keys || !batch->text || (marc && !batch->marc_records)) {
+        batch_free(batch);
+        return NULL;
+    }
+    return batch;
+}
+
+static int batch_append_char(ImportBatch *batch, char c) {
+    if (batch->text_length == batch->text_capacity) {
+        size_t capacity = batch->text_capacity * 2;
+        char *text = realloc(batch->text, capacity);
+        if (!text) {
+            return FAILURE;
+        }
+        batch->text = text;
+        batch->text_capacity = capacity;
+    }
+    batch->text[batch->text_length++] = c;
+    return SUCCESS;
+}
+
+// ---------------------------------------------------------------------------
+// 단계 사이의 크기 제한 대기열 (가득 차면 넣는 쪽이 기다림)
+// ---------------------------------------------------------------------------
+
+typedef struct {
+    ImportBatch **items;
+    int capacity;
+    int head;
+    int count;
+    int closed;
+    pthread_mutex_t mutex;
+    pthread_cond_t not_empty;
+    pthread_cond_t not_full;
+} BatchQueue;
+
+static int queue_init(BatchQueue *queue, int capacity) {
+    memset(queue, 0, sizeof(BatchQueue));
+    queue->items = malloc(sizeof(ImportBatch*) * (size_t)capacity);
+    if (!queue->items) {
+        return FAILURE;
+    }
+    queue->capacity = capacity;
+    pthread_mutex_init(&queue->mutex, NULL);
+    pthread_cond_init(&queue->not_empty, NULL);
+    pthread_cond_init(&queue->not_full, NULL);
+    return SUCCESS;
+}
+
+// 남은 묶음까지 해제
+static void queue_destroy(BatchQueue *queue) {
+    if (!queue->items) {
+        return;
+    }
+    for (int i = 0; i < queue->count; i++) {
+        batch_free(queue->items[(queue->head + i) % queue->capacity]);
+    }
+    free(queue->items);
+    queue->items = NULL;
+    pthread_mutex_destroy(&queue->mutex);
+    pthread_cond_destroy(&queue->not_empty);
+    pthread_cond_destroy(&queue->not_full);
+}
+
+// 닫힌 대기열이면 FAILURE (묶음은 호출자가 해제)
+static int queue_push(BatchQueue *queue, ImportBatch *batch) {
+    pthread_mutex_lock(&queue->mutex);
+    while (queue->count == queue->capacity && !queue->closed) {
+        pthread_cond_wait(&queue->not_full, &queue->mutex);
+    }
+    if (queue->closed) {
+        pthread_mutex_unlock(&queue->mutex);
+        return FAILURE;
+    }
+    queue->items[(queue->head + queue->count) % queue->capacity] = batch;
+    queue->count++;
+    pthread_cond_signal(&queue->not_empty);
+    pthread_mutex_unlock(&queue->mutex);
+    return SUCCESS;
+}
+
+// 닫혔고 비어 있으면 NULL
+static ImportBatch *queue_pop(BatchQueue *queue) {
+    pthread_mutex_lock(&queue->mutex);
+    while (queue->count == 0 && !queue->closed) {
+        pthread_cond_wait(&queue->not_empty, &queue->mutex);
+    }
+    ImportBatch *batch = NULL;
+    if (queue->count > 0) {
+        batch = queue->items[queue->head];
+        queue->head = (queue->head + 1) % queue->capacity;
+        queue->count--;
+        pthread_cond_signal(&queue->not_full);
+    }
+    pthread_mutex_unlock(&queue->mutex);
+    return batch;
+}
+
+static void queue_close(BatchQueue *queue) {
+    pthread_mutex_lock(&queue->mutex);
+    queue->closed = TRUE;
+    pthread_cond_broadcast(&queue->not_empty);
+    pthread_cond_broadcast(&queue->not_full);
+    pthread_mutex_unlock(&queue->mutex);
+}
+
+// ---------------------------------------------------------------------------
+// ISBN 중복 확인용 해시 집합 (ISBN-13 숫자 값, 열린 주소법)
+// ---------------------------------------------------------------------------
+
+typedef struct {
+    unsigned long long *slots;   // 0은 빈 칸
+    size_t capacity;             // 2의 거듭제곱
+    size_t count;
+} IsbnSet;
+
+static size_t isbn_slot(unsigned long long key, size_t capacity) {
+    key ^= key >> 33;
+    key *= 0xFF51AFD7ED558CCDULL;
+    key ^= key >> 33;
+    return (size_t)key & (capacity - 1);
+}
+
+static int isbn_set_init(IsbnSet *set, size_t capacity) {
+    set->capacity = 1024;
+    while (set->capacity < capacity * 2) {
+        set->capacity *= 2;
+    }
+    set->count = 0;
+    set->slots = calloc(set->capacity, sizeof(unsigned long long));
+    return set->slots ? SUCCESS : FAILURE;
+}
+
+static int isbn_set_contains(const IsbnSet *set, unsigned long long key) {
+    for (size_t i = isbn_slot(key, set->capacity); set->slots[i] != 0; i = (i + 1) & (set->capacity - 1)) {
+        if (set->slots[i] == key) {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+static int isbn_set_add(IsbnSet *set, unsigned long long key) {
+    // 70%를 넘으면 두 배로 늘려 다시 넣음
+    if ((set->count + 1) * 10 > set->capacity * 7) {
+        IsbnSet grown = { NULL, set->capacity * 2, 0 };
+        grown.slots = calloc(grown.capacity, sizeof(unsigned long long));
+        if (!grown.slots) {
+            return FAILURE;
+        }
+        for (size_t i = 0; i < set->capacity; i++) {
+            if (set->slots[i] != 0) {
+                isbn_set_add(&grown, set->slots[i]);
+            }
+        }
+        free(set->slots);
+        *set = grown;
+    }
+
+    size_t i = isbn_slot(key, set->capacity);
+    while (set->slots[i] != 0) {
+        if (set->slots[i] == key) {
+            return SUCCESS;
+        }
+        i = (i + 1) & (set->capacity - 1);
+    }
+    set->slots[i] = key;
+    set->count++;
+    return SUCCESS;
+}
+
+// ISBN-10은 978을 붙인 ISBN-13으로 바꿔 같은 책이 같은 값이 되게 함 (형식이 다르면 0)
+static unsigned long long isbn_key(const char *isbn) {
+    int digits[13];
+    int count = 0;
+
+    for (const char *p = isbn; *p; p++) {
+        if (count == 13) {
+            return 0;
+        }
+        if (isdigit((unsigned char)*p)) {
+            digits[count++] = *p - '0';
+        } else if (*p == 'X' || *p == 'x') {
+            digits[count++] = 10;
+        } else if (*p != '-' && *p != ' ') {
+            return 0;
+        }
+    }
+
+    unsigned long long key = 0;
+    if (count == 13) {
+        for (int i = 0; i < 13; i++) {
+            if (digits[i] > 9) {
+                return 0;
+            }
+            key = key * 10 + (unsigned long long)digits[i];
+        }
+        return key;
+    }
+    if (count != 10) {
+        return 0;
+    }
+
+    int isbn13[13] = { 9, 7, 8 };
+    int sum = 9 + 7 * 3 + 8;
+    for (int i = 0; i < 9; i++) {
+        if (digits[i] > 9) {
+            return 0;
+        }
+        isbn13[3 + i] = digits[i];
+        sum += digits[i] * ((3 + i) % 2 == 0 ? 1 : 3);
+    }
+    isbn13[12] = (10 - sum % 10) % 10;
+    for (int i = 0; i < 13; i++) {
+        key = key * 10 + (unsigned long long)isbn13[i];
+    }
+    return key;
+}
+
+// ---------------------------------------------------------------------------
+// 파일 읽기 (행 경계는 따옴표 안의 줄바꿈을 건너뛰며 찾음)
+// ---------------------------------------------------------------------------
+
+typedef struct {
+    FILE *file;
+    char buffer[READ_BUFFER_SIZE];
+    size_t position;
+    size_t length;
+    long long offset;          // 다음에 읽을 바이트의 파일 위치
+    long long line;            // 지금까지 읽은 줄 수
+    int last_char;
+    int at_eof;
+    int error;
+} RecordReader;
+
+static int file_seek(FILE *file, long long offset, int whence) {
+#ifdef _WIN32
+    return _fseeki64(file, offset, whence);
+#else
+    return fseeko(file, (off_t)offset, whence);
+#endif
+}
+
+static long long file_tell(FILE *file) {
+#ifdef _WIN32
+    return _ftelli64(file);
+#else
+    return (long long)ftello(file);
+#endif
+}
+
+static void reader_reset(RecordReader *reader, long long offset, long long line) {
+    reader->position = 0;
+    reader->length = 0;
+    reader->offset = offset;
+    reader->line = line;
+    reader->last_char = '\n';
+    reader->at_eof = FALSE;
+}
+
+static int reader_getc(RecordReader *reader) {
+    if (reader->position == reader->length) {
+        reader->length = reader->at_eof ? 0 : fread(reader->buffer, 1, sizeof(reader->buffer), reader->file);
+        reader->position = 0;
+        if (reader->length == 0) {
+            if (!reader->at_eof) {
+                reader->at_eof = TRUE;
+                reader->error = ferror(reader->file);
+                // 줄바꿈 없이 끝난 마지막 줄도 한 줄로 셈
+                if (reader->last_char != '\n') {
+                    reader->line++;
+                }
+            }
+            return EOF;
+        }
+    }
+    int c = (unsigned char)reader->buffer[reader->position++];
+    reader->offset++;
+    reader->last_char = c;
+    if (c == '\n') {
+        reader->line++;
+    }
+    return c;
+}
+
+// 다음 행을 묶음에 추가. 추가하면 TRUE, 파일 끝이면 FALSE, 읽기/메모리 오류면 FAILURE (빈 줄은 건너뜀)
+static int read_record(RecordReader *reader, int quoted, ImportBatch *batch) {
+    for (;;) {
+        long long start_line = reader->line + 1;
+        size_t start = batch->text_length;
+        size_t length = 0;
+        int in_quotes = FALSE;
+        int too_long = FALSE;
+        int ended = FALSE;
+        int c;
+
+        while ((c = reader_getc(reader)) != EOF) {
+            if (c == '\n' && !in_quotes) {
+                ended = TRUE;
+                break;
+            }
+            if (quoted && c == '"') {
+                in_quotes = !in_quotes;
+            }
+            if (length < BOOK_IMPORT_MAX_RECORD_LENGTH) {
+                if (batch_append_char(batch, (char)c) != SUCCESS) {
+                    return FAILURE;
+                }
+                length++;
+            } else {
+                too_long = TRUE;
+            }
+        }
+        if (reader->error) {
+            fprintf(stderr, "가져올 파일을 읽는 중 오류가 발생했습니다.\n");
+            return FAILURE;
+        }
+
+        if (length > 0 && batch->text[start + length - 1] == '\r') {
+            batch->text_length--;
+            length--;
+        }
+        if (length == 0 && !too_long) {
+            if (!ended) {
+                return FALSE;
+            }
+            continue;
+        }
+
+        if (batch_append_char(batch, '\0') != SUCCESS) {
+            return FAILURE;
+        }
+        batch->text_offsets[batch->count] = start;
+        batch->lines[batch->count] = start_line;
+        batch->reasons[batch->count] = too_long ? REASON_TOO_LONG : NULL;
+        batch->count++;
+        return TRUE;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// 필드 파싱과 검증
+// ---------------------------------------------------------------------------
+
+// 행을 필드로 나눠 scratch에 NUL로 끝나는 문자열로 풀어 둠 (scratch는 행 길이의 2배 + 2 이상)
+static int split_fields(const char *record, char delimiter, int quoted, char *scratch,
+                        const char **fields, int max_fields) {
+    const char *p = record;
+    char *out = scratch;
+    int count = 0;
+
+    for (;;) {
+        if (count == max_fields) {
+            return SPLIT_TOO_MANY;
+        }
+        fields[count++] = out;
+
+        if (quoted && *p == '"') {
+            p++;
+            for (;;) {
+                if (*p == '\0') {
+                    return SPLIT_BAD_QUOTES;
+                }
+                if (*p == '"') {
+                    if (p[1] == '"') {
+                        *out++ = '"';
+                        p += 2;
+                        continue;
+                    }
+                    p++;
+                    break;
+                }
+                *out++ = *p++;
+            }
+            if (*p != delimiter && *p != '\0') {
+                return SPLIT_BAD_QUOTES;
+            }
+        } else {
+            while (*p && *p != delimiter) {
+                *out++ = *p++;
+            }
+        }
+        *out++ = '\0';
+
+        if (*p == '\0') {
+            return count;
+        }
+        p++;
+    }
+}
+
+// 앞뒤 공백을 뺀 값을 복사 (버퍼에 들어가지 않으면 FAILURE)
+static int copy_field(char *dest, size_t dest_size, const char *value) {
+    while (*value == ' ' || *value == '\t') {
+        value++;
+    }
+    size_t length = strlen(value);
+    while (length > 0 && (value[length - 1] == ' ' || value[length - 1] == '\t')) {
+        length--;
+    }
+    if (length >= dest_size) {
+        return FAILURE;
+    }
+    memcpy(dest, value, length);
+    dest[length] = '\0';
+    return SUCCESS;
+}
+
+// 빈 값이면 default_value, 0 이상의 정수가 아니면 FAILURE
+static int parse_count_field(const char *value, int default_value, int *result) {
+    char text[16];
+    if (copy_field(text, sizeof(text), value) != SUCCESS) {
+        return FAILURE;
+    }
+    if (text[0] == '\0') {
+        *result = default_value;
+        return SUCCESS;
+    }
+    char *end = NULL;
+    long parsed = strtol(text, &end, 10);
+    if (*end != '\0' || parsed < 0 || parsed > 1000000) {
+        return FAILURE;
+    }
+    *result = (int)parsed;
+    return SUCCESS;
+}
+
+typedef struct {
+    char delimiter;
+    int quoted;
+    int field_count;           // 머리글 열 수
+    int columns[COLUMN_COUNT]; // 항목별 열 위치 (-1이면 없음)
+} ImportLayout;
+
+// 형식과 관계없이 공통인 검증. 거부 사유를 반환하고 정상이면 NULL
+static const char *check_book(Book *book, unsigned long long *key) {
+    if (validate_book(book) != SUCCESS) {
+        return REASON_INVALID_BOOK;
+    }
+    *key = 0;
+    if (book->isbn[0] != '\0') {
+        if (!is_valid_isbn(book->isbn)) {
+            return REASON_INVALID_ISBN;
+        }
+        *key = isbn_key(book->isbn);
+    }
+    return NULL;
+}
+
+// 행 하나를 도서로 바꿈. 거부 사유를 반환하고 정상이면 NULL
+static const char *parse_row(const ImportLayout *layout, const char *record, char *scratch,
+                             const char **fields, Book *book, unsigned long long *key) {
+    int count = split_fields(record, layout->delimiter, layout->quoted, scratch, fields, layout->field_count);
+    if (count == SPLIT_BAD_QUOTES) {
+        return REASON_BAD_QUOTES;
+    }
+    if (count != layout->field_count) {
+        return REASON_FIELD_COUNT;
+    }
+
+    memset(book, 0, sizeof(Book));
+    struct {
+        ImportColumn column;
+        char *dest;
+        size_t size;
+    } text_fields[] = {
+        { COLUMN_TITLE, book->title, sizeof(book->title) },
+        { COLUMN_AUTHOR, book->author, sizeof(book->author) },
+        { COLUMN_ISBN, book->isbn, sizeof(book->isbn) },
+        { COLUMN_PUBLISHER, book->publisher, sizeof(book->publisher) },
+        { COLUMN_CATEGORY, book->category, sizeof(book->category) },
+    };
+    for (size_t i = 0; i < sizeof(text_fields) / sizeof(text_fields[0]); i++) {
+        int index = layout->columns[text_fields[i].column];
+        if (index >= 0 && copy_field(text_fields[i].dest, text_fields[i].size, fields[index]) != SUCCESS) {
+            return REASON_FIELD_LENGTH;
+        }
+    }
+
+    const char *empty = "";
+    int year_index = layout->columns[COLUMN_PUBLICATION_YEAR];
+    int total_index = layout->columns[COLUMN_TOTAL_COPIES];
+    int available_index = layout->columns[COLUMN_AVAILABLE_COPIES];
+    if (parse_count_field(year_index >= 0 ? fields[year_index] : empty, 0, &book->publication_year) != SUCCESS ||
+        parse_count_field(total_index >= 0 ? fields[total_index] : empty, 1, &book->total_copies) != SUCCESS ||
+        parse_count_field(available_index >= 0 ? fields[available_index] : empty, book->total_copies,
+                          &book->available_copies) != SUCCESS) {
+        return REASON_BAD_NUMBER;
+    }
+
+    return check_book(book, key);
+}
+
+// MARC 레코드 하나를 도서로 바꿈. 거부 사유를 반환하고 정상이면 NULL
+static const char *parse_marc_record(const MarcRecord *record, Book *book, unsigned long long *key) {
+    const char *reason = marc_record_to_book(record, book);
+    return reason ? reason : check_book(book, key);
+}
+
+// 머리글에서 항목별 열 위치를 찾음 (제목과 저자가 없으면 FAILURE)
+static int parse_header(ImportLayout *layout, char *header) {
+    char *scratch = malloc(strlen(header) * 2 + 2);
+    const char **fields = malloc(sizeof(const char*) * (strlen(header) + 1));
+    if (!scratch || !fields) {
+        free(scratch);
+        free(fields);
+        fprintf(stderr, "메모리 할당 실패\n");
+        return FAILURE;
+    }
+
+    // UTF-8 BOM 제거
+    if ((unsigned char)header[0] == 0xEF && (unsigned char)header[1] == 0xBB && (unsigned char)header[2] == 0xBF) {
+        memmove(header, header + 3, strlen(header + 3) + 1);
+    }
+
+    int count = split_fields(header, layout->delimiter, layout->quoted, scratch, fields, (int)strlen(header) + 1);
+    for (int column = 0; column < COLUMN_COUNT; column++) {
+        layout->columns[column] = -1;
+    }
+    for (int i = 0; i < count; i++) {
+        char name[64];
+        if (copy_field(name, sizeof(name), fields[i]) != SUCCESS) {
+            continue;
+        }
+        for (char *p = name; *p; p++) {
+            *p = (char)tolower((unsigned char)*p);
+        }
+        for (size_t j = 0; j < sizeof(column_names) / sizeof(column_names[0]); j++) {
+            if (strcmp(name, column_names[j].name) == 0 && layout->columns[column_names[j].column] < 0) {
+                layout->columns[column_names[j].column] = i;
+            }
+        }
+    }
+    layout->field_count = count;
+
+    free(scratch);
+    free(fields);
+
+    if (count < 0) {
+        fprintf(stderr, "머리글 형식이 올바르지 않습니다.\n");
+        return FAILURE;
+    }
+    if (layout->columns[COLUMN_TITLE] < 0 || layout->columns[COLUMN_AUTHOR] < 0) {
+        fprintf(stderr, "머리글에 제목(title)과 저자(author) 열이 필요합니다.\n");
+        return FAILURE;
+    }
+    return SUCCESS;
+}
+
+// ---------------------------------------------------------------------------
+// 파이프라인: 읽기 스레드 -> 파싱 스레드들 -> 쓰기(호출한 스레드)
+// ---------------------------------------------------------------------------
+
+typedef struct {
+    ImportLayout layout;
+    RecordReader reader;
+    int marc;                  // TRUE면 reader 대신 marc_reader로 읽음
+    MarcReader marc_reader;
+    int batch_rows;
+    BatchQueue parse_queue;
+    BatchQueue write_queue;
+    atomic_int active_workers;
+    atomic_int aborted;
+} ImportPipeline;
+
+// 다음 MARC 레코드를 묶음에 추가. 추가하면 TRUE, 파일 끝이면 FALSE (손상된 레코드는 거부 사유와 함께 추가)
+static int read_marc_record(MarcReader *reader, ImportBatch *batch) {
+    MarcRecord *record = &batch->marc_records[batch->count];
+    int status = marc_reader_next(reader, record);
+    if (status == FALSE) {
+        return FALSE;
+    }
+    batch->lines[batch->count] = reader->records;
+    batch->reasons[batch->count] = status == FAILURE ? REASON_BAD_MARC : NULL;
+    batch->count++;
+    return TRUE;
+}
+
+static void *reader_main(void *arg) {
+    ImportPipeline *pipeline = arg;
+    long long sequence = 0;
+    int last = FALSE;
+
+    while (!last && !atomic_load(&pipeline->aborted)) {
+        ImportBatch *batch = batch_create(pipeline->batch_rows, pipeline->marc);
+        if (!batch) {
+            fprintf(stderr, "메모리 할당 실패\n");
+            break;
+        }
+        int status = TRUE;
+        while (batch->count < batch->capacity) {
+            status = pipeline->marc ? read_marc_record(&pipeline->marc_reader, batch)
+                                    : read_record(&pipeline->reader, pipeline->layout.quoted, batch);
+            if (status != TRUE) {
+                break;
+            }
+        }
+        if (status == FAILURE) {
+            batch_free(batch);
+            break;
+        }
+        last = status == FALSE;
+        batch->sequence = sequence++;
+        if (pipeline->marc) {
+            batch->end_offset = (long long)pipeline->marc_reader.offset;
+            batch->end_line = pipeline->marc_reader.records;
+        } else {
+            batch->end_offset = pipeline->reader.offset;
+            batch->end_line = pipeline->reader.line;
+        }
+        batch->last = last;
+        if (queue_push(&pipeline->parse_queue, batch) != SUCCESS) {
+            batch_free(batch);
+            break;
+        }
+    }
+
+    // 마지막 묶음을 보내지 못했으면 쓰기 단계가 실패로 끝남
+    queue_close(&pipeline->parse_queue);
+    return NULL;
+}
+
+static void *worker_main(void *arg) {
+    ImportPipeline *pipeline = arg;
+    char *scratch = malloc(BOOK_IMPORT_MAX_RECORD_LENGTH * 2 + 2);
+    const char **fields = malloc(sizeof(const char*) * (size_t)(pipeline->marc ? 1 : pipeline->layout.field_count));
+    ImportBatch *batch;
+
+    while ((batch = queue_pop(&pipeline->parse_queue)) != NULL) {
+        if (!scratch || !fields || atomic_load(&pipeline->aborted)) {
+            batch_free(batch);
+            continue;
+        }
+        for (int i = 0; i < batch->count; i++) {
+            if (batch->reasons[i]) {
+                continue;
+            }
+            if (pipeline->marc) {
+                batch->reasons[i] = parse_marc_record(&batch->marc_records[i], &batch->books[i],
+                                                      &batch->isbn_keys[i]);
+            } else {
+                batch->reasons[i] = parse_row(&pipeline->layout, batch->text + batch->text_offsets[i],
+                                              scratch, fields, &batch->books[i], &batch->isbn_keys[i]);
+            }
+        }
+        if (queue_push(&pipeline->write_queue, batch) != SUCCESS) {
+            batch_free(batch);
+        }
+    }
+
+    // 할당에 실패한 스레드가 있으면 묶음이 빠지므로 전체를 중단
+    if (!scratch || !fields) {
+        fprintf(stderr, "메모리 할당 실패\n");
+        atomic_store(&pipeline->aborted, TRUE);
+        queue_close(&pipeline->parse_queue);
+    }
+    free(scratch);
+    free(fields);
+
+    if (atomic_fetch_sub(&pipeline->active_workers, 1) == 1) {
+        queue_close(&pipeline->write_queue);
+    }
+    return NULL;
+}
+
+// 쓰기 단계 상태
+typedef struct {
+    sqlite3 *db;
+    const char *source;
+    long long file_size;
+    long long total_lines;
+    int show_progress;
+    sqlite3_stmt *insert_stmt;
+    IsbnSet isbns;
+    FILE *reject_file;
+    int marc;                  // TRUE면 거부된 레코드를 MARC로 기록
+    MarcWriter marc_writer;
+    char delimiter;
+    int quoted;
+    BookImportStats *stats;
+} ImportWriter;
+
+// 원본 레코드의 필드를 그대로 옮기고 999 필드에 사유와 레코드 번호를 덧붙여 기록
+static void write_marc_reject(ImportWriter *writer, const MarcRecord *record, long long number, const char *reason) {
+    // 디렉터리를 읽을 수 없는 레코드는 원문 그대로
+    if (record->field_count == 0) {
+        fwrite(record->data, 1, record->length, writer->reject_file);
+        return;
+    }
+
+    MarcWriter *marc = &writer->marc_writer;
+    MarcField field;
+    char text[32];
+    marc_writer_begin_record(marc, record->data);
+    for (int i = 0; i < record->field_count; i++) {
+        if (marc_record_field(record, i, &field) == SUCCESS) {
+            marc_writer_add_field(marc, field.tag, field.data, field.length);
+        }
+    }
+    snprintf(text, sizeof(text), "%lld", number);
+    marc_writer_begin_field(marc, "999", ' ', ' ');
+    marc_writer_add_subfield(marc, 'a', reason);
+    marc_writer_add_subfield(marc, 'n', text);
+    if (marc_writer_end_record(marc) != SUCCESS) {
+        fwrite(record->data, 1, record->length, writer->reject_file);
+    }
+}
+
+// 거부 파일에 원문과 줄 번호, 사유를 덧붙여 기록
+static void write_reject(ImportWriter *writer, const ImportBatch *batch, int index, const char *reason) {
+    if (!writer->reject_file) {
+        return;
+    }
+    if (writer->marc) {
+        write_marc_reject(writer, &batch->marc_records[index], batch->lines[index], reason);
+        return;
+    }
+    const char *record = batch->text + batch->text_offsets[index];
+    long long line = batch->lines[index];
+    fprintf(writer->reject_file, "%s%c%lld%c", record, writer->delimiter, line, writer->delimiter);
+    if (writer->quoted) {
+        fputc('"', writer->reject_file);
+        for (const char *p = reason; *p; p++) {
+            if (*p == '"') {
+                fputc('"', writer->reject_file);
+            }
+            fputc(*p, writer->reject_file);
+        }
+        fputc('"', writer->reject_file);
+    } else {
+        for (const char *p = reason; *p; p++) {
+            fputc(*p == '\t' || *p == '\n' ? ' ' : *p, writer->reject_file);
+        }
+    }
+    fputc('\n', writer->reject_file);
+}
+
+static int insert_book(ImportWriter *writer, const Book *book) {
+    sqlite3_stmt *stmt = writer->insert_stmt;
+
+    sqlite3_bind_text(stmt, 1, book->title, -1, SQLITE_STATIC);
+    sqlite3_bind_text(stmt, 2, book->author, -1, SQLITE_STATIC);
+    // 빈 ISBN은 UNIQUE 제약에 걸리지 않도록 NULL로 저장
+    if (book->isbn[0] != '\0') {
+        sqlite3_bind_text(stmt, 3, book->isbn, -1, SQLITE_STATIC);
+    } else {
+        sqlite3_bind_null(stmt, 3);
+    }
+    sqlite3_bind_text(stmt, 4, book->publisher, -1, SQLITE_STATIC);
+    sqlite3_bind_int(stmt, 5, book->publication_year);
+    sqlite3_bind_int(stmt, 6, book->total_copies);
+    sqlite3_bind_int(stmt, 7, book->available_copies);
+    sqlite3_bind_text(stmt, 8, book->category, -1, SQLITE_STATIC);
+
+    int rc = sqlite3_step(stmt);
+    sqlite3_reset(stmt);
+    sqlite3_clear_bindings(stmt);
+    return rc;
+}
+
+static int write_batch(ImportWriter *writer, const ImportBatch *batch) {
+    for (int i = 0; i < batch->count; i++) {
+        const char *reason = batch->reasons[i];
+        writer->stats->rows++;
+
+        if (!reason && batch->isbn_keys[i] != 0 && isbn_set_contains(&writer->isbns, batch->isbn_keys[i])) {
+            writer->stats->duplicates++;
+            write_reject(writer, batch, i, REASON_DUPLICATE_ISBN);
+            continue;
+        }
+        if (reason) {
+            writer->stats->rejected++;
+            write_reject(writer, batch, i, reason);
+            continue;
+        }
+
+        int rc = insert_book(writer, &batch->books[i]);
+        if (rc == SQLITE_CONSTRAINT) {
+            writer->stats->rejected++;
+            write_reject(writer, batch, i, sqlite3_errmsg(writer->db));
+            continue;
+        }
+        if (rc != SQLITE_DONE) {
+            fprintf(stderr, "도서 추가 실패: %s\n", sqlite3_errmsg(writer->db));
+            return FAILURE;
+        }
+        if (batch->isbn_keys[i] != 0 && isbn_set_add(&writer->isbns, batch->isbn_keys[i]) != SUCCESS) {
+            fprintf(stderr, "메모리 할당 실패\n");
+            return FAILURE;
+        }
+        writer->stats->imported++;
+    }
+    return SUCCESS;
+}
+
+// 커밋할 트랜잭션 안에서 읽은 위치를 기록
+static int save_checkpoint(ImportWriter *writer, const ImportBatch *batch) {
+    const char *sql =
+        "INSERT OR REPLACE INTO book_import_checkpoints "
+        "(source, file_size, byte_offset, line_number, completed, updated_at) "
+        "VALUES (?, ?, ?, ?, ?, CURRENT_TIMESTAMP);";
+    sqlite3_stmt *stmt = NULL;
+
+    if (database_prepare_statement(writer->db, sql, &stmt) != SUCCESS) {
+        return FAILURE;
+    }
+    sqlite3_bind_text(stmt, 1, writer->source, -1, SQLITE_STATIC);
+    sqlite3_bind_int64(stmt, 2, writer->file_size);
+    sqlite3_bind_int64(stmt, 3, batch->end_offset);
+    sqlite3_bind_int64(stmt, 4, batch->end_line);
+    sqlite3_bind_int(stmt, 5, batch->last);
+
+    int status = sqlite3_step(stmt) == SQLITE_DONE ? SUCCESS : FAILURE;
+    if (status != SUCCESS) {
+        fprintf(stderr, "가져오기 체크포인트 저장 실패: %s\n", sqlite3_errmsg(writer->db));
+    }
+    sqlite3_finalize(stmt);
+    return status;
+}
+
+// 파싱이 끝난 묶음을 파일 순서대로 넣고 commit_rows마다 커밋
+static int run_writer(ImportWriter *writer, ImportPipeline *pipeline, int commit_rows) {
+    ImportBatch **pending = NULL;
+    int pending_count = 0;
+    int pending_capacity = 0;
+    long long next_sequence = 0;
+    long long rows_in_transaction = 0;
+    int finished = FALSE;
+
+    int status = database_begin_immediate_transaction(writer->db);
+
+    while (status == SUCCESS && !finished) {
+        // 다음 순서의 묶음이 올 때까지 먼저 도착한 묶음은 보관
+        ImportBatch *batch = NULL;
+        for (int i = 0; i < pending_count; i++) {
+            if (pending[i]->sequence == next_sequence) {
+                batch = pending[i];
+                pending[i] = pending[--pending_count];
+                break;
+            }
+        }
+        if (!batch) {
+            ImportBatch *arrived = queue_pop(&pipeline->write_queue);
+            if (!arrived) {
+                fprintf(stderr, "가져오기가 중간에 중단되었습니다.\n");
+                status = FAILURE;
+                break;
+            }
+            if (arrived->sequence != next_sequence) {
+                if (pending_count == pending_capacity) {
+                    int capacity = pending_capacity ? pending_capacity * 2 : 16;
+                    ImportBatch **grown = realloc(pending, sizeof(ImportBatch*) * (size_t)capacity);
+                    if (!grown) {
+                        batch_free(arrived);
+                        fprintf(stderr, "메모리 할당 실패\n");
+                        status = FAILURE;
+                        break;
+                    }
+                    pending = grown;
+                    pending_capacity = capacity;
+                }
+                pending[pending_count++] = arrived;
+                continue;
+            }
+            batch = arrived;
+        }
+
+        next_sequence++;
+        status = write_batch(writer, batch);
+        rows_in_transaction += batch->count;
+        finished = batch->last;
+
+        if (status == SUCCESS && (rows_in_transaction >= commit_rows || finished)) {
+            status = save_checkpoint(writer, batch);
+            if (status == SUCCESS) {
+                status = database_commit_transaction(writer->db);
+            }
+            if (status == SUCCESS && writer->reject_file) {
+                fflush(writer->reject_file);
+            }
+            if (status == SUCCESS && writer->show_progress && writer->total_lines > 0) {
+                print_progress_bar((int)batch->end_line, (int)writer->total_lines, BOOK_IMPORT_PROGRESS_WIDTH);
+            }
+            if (status == SUCCESS && !finished) {
+                status = database_begin_immediate_transaction(writer->db);
+            }
+            rows_in_transaction = 0;
+        }
+        batch_free(batch);
+    }
+
+    if (status != SUCCESS) {
+        database_rollback_transaction(writer->db);
+    }
+    for (int i = 0; i < pending_count; i++) {
+        batch_free(pending[i]);
+    }
+    free(pending);
+    return status;
+}
+
+// ---------------------------------------------------------------------------
+// 공개 함수
+// ---------------------------------------------------------------------------
+
+static int default_worker_count(void) {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    long count = (long)info.dwNumberOfProcessors;
+#else
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+    if (count < 1) {
+        return 1;
+    }
+    return count > BOOK_IMPORT_MAX_WORKERS ? BOOK_IMPORT_MAX_WORKERS : (int)count;
+}
+
+void book_import_default_config(BookImportConfig *config) {
+    if (!config) {
+        return;
+    }
+    memset(config, 0, sizeof(BookImportConfig));
+    config->format = BOOK_IMPORT_AUTO;
+    config->worker_threads = 0;
+    config->batch_rows = BOOK_IMPORT_BATCH_ROWS;
+    config->commit_rows = BOOK_IMPORT_COMMIT_ROWS;
+    config->resume = TRUE;
+    config->show_progress = FALSE;
+}
+
+// 진행 막대의 전체 길이로 쓸 줄 수
+static long long count_lines(FILE *file) {
+    char buffer[READ_BUFFER_SIZE];
+    long long lines = 0;
+    size_t length;
+    char last = '\n';
+
+    while ((length = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        for (const char *p = buffer; (p = memchr(p, '\n', length - (size_t)(p - buffer))) != NULL; p++) {
+            lines++;
+        }
+        last = buffer[length - 1];
+    }
+    return last != '\n' ? lines + 1 : lines;
+}
+
+// 진행 막대의 전체 길이로 쓸 MARC 레코드 수 (레코드 종단 기호 수)
+static long long count_marc_records(const MarcReader *reader) {
+    const unsigned char *p = reader->data;
+    const unsigned char *end = reader->data + reader->size;
+    long long records = 0;
+
+    while (p < end && (p = memchr(p, 0x1D, (size_t)(end - p))) != NULL) {
+        records++;
+        p++;
+    }
+    return records;
+}
+
+// 같은 원본의 체크포인트를 읽음. 이어서 가져올 위치가 있으면 TRUE, 없으면 FALSE
+static int load_checkpoint(sqlite3 *db, const char *source, long long file_size,
+                           long long *offset, long long *line, int *completed) {
+    const char *sql =
+        "SELECT file_size, byte_offset, line_number, completed "
+        "FROM book_import_checkpoints WHERE source = ?;";
+    sqlite3_stmt *stmt = NULL;
+    int found = FALSE;
+
+    if (database_prepare_statement(db, sql, &stmt) != SUCCESS) {
+        return FAILURE;
+    }
+    sqlite3_bind_text(stmt, 1, source, -1, SQLITE_STATIC);
+    if (sqlite3_step(stmt) == SQLITE_ROW) {
+        if (sqlite3_column_int64(stmt, 0) == file_size) {
+            *offset = sqlite3_column_int64(stmt, 1);
+            *line = sqlite3_column_int64(stmt, 2);
+            *completed = sqlite3_column_int(stmt, 3);
+            found = TRUE;
+        } else {
+            fprintf(stderr, "파일 크기가 체크포인트와 달라 처음부터 가져옵니다: %s\n", source);
+        }
+    }
+    sqlite3_finalize(stmt);
+    return found;
+}
+
+// 기존 도서의 ISBN을 중복 확인용 집합에 넣음
+static int load_existing_isbns(sqlite3 *db, IsbnSet *set) {
+    sqlite3_stmt *stmt = NULL;
+    int book_count = 0;
+
+    if (database_prepare_statement(db, "SELECT COUNT(*) FROM books;", &stmt) != SUCCESS) {
+        return FAILURE;
+    }
+    if (sqlite3_step(stmt) == SQLITE_ROW) {
+        book_count = sqlite3_column_int(stmt, 0);
+    }
+    sqlite3_finalize(stmt);
+
+    if (isbn_set_init(set, (size_t)book_count + BOOK_IMPORT_COMMIT_ROWS) != SUCCESS) {
+        fprintf(stderr, "메모리 할당 실패\n");
+        return FAILURE;
+    }
+    if (database_prepare_statement(db, "SELECT isbn FROM books WHERE isbn IS NOT NULL AND isbn <> '';",
+                                   &stmt) != SUCCESS) {
+        return FAILURE;
+    }
+    int status = SUCCESS;
+    while (status == SUCCESS && sqlite3_step(stmt) == SQLITE_ROW) {
+        const char *isbn = (const char*)sqlite3_column_text(stmt, 0);
+        unsigned long long key = isbn ? isbn_key(isbn) : 0;
+        if (key != 0) {
+            status = isbn_set_add(set, key);
+        }
+    }
+    sqlite3_finalize(stmt);
+    return status;
+}
+
+static int ends_with_ignore_case(const char *text, const char *suffix) {
+    size_t text_length = strlen(text);
+    size_t suffix_length = strlen(suffix);
+    if (text_length < suffix_length) {
+        return FALSE;
+    }
+    for (size_t i = 0; i < suffix_length; i++) {
+        if (tolower((unsigned char)text[text_length - suffix_length + i]) != tolower((unsigned char)suffix[i])) {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+int book_import_file(sqlite3 *db, const char *path, const BookImportConfig *config, BookImportStats *stats) {
+    if (!db || !path) {
+        fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
+        return FAILURE;
+    }
+
+    BookImportConfig effective;
+    if (config) {
+        effective = *config;
+    } else {
+        book_import_default_config(&effective);
+    }
+    if (effective.batch_rows <= 0) {
+        effective.batch_rows = BOOK_IMPORT_BATCH_ROWS;
+    }
+    if (effective.commit_rows <= 0) {
+        effective.commit_rows = BOOK_IMPORT_COMMIT_ROWS;
+    }
+    int workers = effective.worker_threads > 0 ? effective.worker_threads : default_worker_count();
+    if (workers > BOOK_IMPORT_MAX_WORKERS) {
+        workers = BOOK_IMPORT_MAX_WORKERS;
+    }
+
+    BookImportStats local_stats;
+    if (!stats) {
+        stats = &local_stats;
+    }
+    memset(stats, 0, sizeof(BookImportStats));
+    long long start_ns = timer_now_nanoseconds();
+
+    ImportPipeline *pipeline = calloc(1, sizeof(ImportPipeline));
+    if (!pipeline) {
+        fprintf(stderr, "메모리 할당 실패\n");
+        return FAILURE;
+    }
+
+    pipeline->marc = effective.format == BOOK_IMPORT_MARC ||
+                     (effective.format == BOOK_IMPORT_AUTO && (ends_with_ignore_case(path, ".mrc") ||
+                                                               ends_with_ignore_case(path, ".marc")));
+    FILE *file = NULL;
+    if (pipeline->marc) {
+        if (marc_reader_open(&pipeline->marc_reader, path) != SUCCESS) {
+            free(pipeline);
+            return FAILURE;
+        }
+    } else if ((file = fopen(path, "rb")) == NULL) {
+        fprintf(stderr, "가져올 파일을 열 수 없습니다: %s\n", path);
+        free(pipeline);
+        return FAILURE;
+    }
+
+    ImportWriter writer;
+    memset(&writer, 0, sizeof(ImportWriter));
+    writer.db = db;
+    writer.source = path;
+    writer.stats = stats;
+    writer.show_progress = effective.show_progress;
+    writer.marc = pipeline->marc;
+    if (pipeline->marc) {
+        writer.file_size = (long long)pipeline->marc_reader.size;
+        if (effective.show_progress) {
+            writer.total_lines = count_marc_records(&pipeline->marc_reader);
+        }
+    } else {
+        file_seek(file, 0, SEEK_END);
+        writer.file_size = file_tell(file);
+        file_seek(file, 0, SEEK_SET);
+        if (effective.show_progress) {
+            writer.total_lines = count_lines(file);
+            file_seek(file, 0, SEEK_SET);
+        }
+    }
+
+    ImportLayout *layout = &pipeline->layout;
+    int tsv = effective.format == BOOK_IMPORT_TSV ||
+              (effective.format == BOOK_IMPORT_AUTO && (ends_with_ignore_case(path, ".tsv") ||
+                                                        ends_with_ignore_case(path, ".tab")));
+    layout->delimiter = tsv ? '\t' : ',';
+    layout->quoted = !tsv;
+    writer.delimiter = layout->delimiter;
+    writer.quoted = layout->quoted;
+
+    // 머리글 (MARC는 레코드마다 디렉터리가 있으므로 없음)
+    RecordReader *reader = &pipeline->reader;
+    ImportBatch *header = NULL;
+    long long data_offset = 0;
+    int status = SUCCESS;
+    if (!pipeline->marc) {
+        reader->file = file;
+        reader_reset(reader, 0, 0);
+        header = batch_create(1, FALSE);
+        status = header && read_record(reader, layout->quoted, header) == TRUE ? SUCCESS : FAILURE;
+        if (header && status != SUCCESS) {
+            fprintf(stderr, "머리글이 없는 파일입니다: %s\n", path);
+        }
+        if (status == SUCCESS) {
+            status = parse_header(layout, header->text);
+        }
+        data_offset = reader->offset;
+    }
+
+    // 같은 파일의 체크포인트가 있으면 그 다음부터
+    long long resume_offset = 0;
+    long long resume_line = 0;
+    int completed = FALSE;
+    int resuming = FALSE;
+    if (status == SUCCESS && effective.resume) {
+        int found = load_checkpoint(db, path, writer.file_size, &resume_offset, &resume_line, &completed);
+        if (found == FAILURE) {
+            status = FAILURE;
+        }
+        resuming = found == TRUE && resume_offset >= data_offset;
+    }
+
+    if (status == SUCCESS && resuming && completed) {
+        stats->resumed_lines = resume_line;
+        batch_free(header);
+        if (file) {
+            fclose(file);
+        }
+        marc_reader_close(&pipeline->marc_reader);
+        free(pipeline);
+        stats->elapsed_seconds = (timer_now_nanoseconds() - start_ns) / 1e9;
+        return SUCCESS;
+    }
+    if (status == SUCCESS && resuming) {
+        stats->resumed_lines = resume_line;
+        if (pipeline->marc ? marc_reader_seek(&pipeline->marc_reader, (size_t)resume_offset, resume_line) != SUCCESS
+                           : file_seek(file, resume_offset, SEEK_SET) != 0) {
+            fprintf(stderr, "체크포인트 위치로 이동할 수 없습니다: %s\n", path);
+            status = FAILURE;
+        }
+        if (!pipeline->marc) {
+            reader_reset(reader, resume_offset, resume_line);
+        }
+    }
+
+    if (status == SUCCESS && effective.reject_path[0] != '\0') {
+        writer.reject_file = fopen(effective.reject_path, resuming ? "ab" : "wb");
+        if (!writer.reject_file) {
+            fprintf(stderr, "거부 파일을 열 수 없습니다: %s\n", effective.reject_path);
+            status = FAILURE;
+        } else if (pipeline->marc) {
+            status = marc_writer_init(&writer.marc_writer, writer.reject_file);
+        } else if (!resuming) {
+            fprintf(writer.reject_file, "%s%csource_line%creject_reason\n",
+                    header->text, layout->delimiter, layout->delimiter);
+        }
+    }
+    batch_free(header);
+
+    const char *insert_sql =
+        "INSERT INTO books (title, author, isbn, publisher, publication_year, "
+        "total_copies, available_copies, category, "
+        "title_norm, title_chosung, author_norm, author_chosung) "
+        "VALUES (?1, ?2, ?3, ?4, ?5, ?6, ?7, ?8, "
+        "hangul_normalize(?1), hangul_chosung(?1), hangul_normalize(?2), hangul_chosung(?2));";
+    if (status == SUCCESS) {
+        status = database_prepare_statement(db, insert_sql, &writer.insert_stmt);
+    }
+    if (status == SUCCESS) {
+        status = load_existing_isbns(db, &writer.isbns);
+    }
+
+    if (status == SUCCESS) {
+        pipeline->batch_rows = effective.batch_rows;
+        if (queue_init(&pipeline->parse_queue, BOOK_IMPORT_QUEUE_BATCHES) != SUCCESS ||
+            queue_init(&pipeline->write_queue, BOOK_IMPORT_QUEUE_BATCHES) != SUCCESS) {
+            fprintf(stderr, "메모리 할당 실패\n");
+            status = FAILURE;
+        }
+    }
+
+    if (status == SUCCESS) {
+        pthread_t reader_thread;
+        pthread_t worker_threads[BOOK_IMPORT_MAX_WORKERS];
+        int started = 0;
+
+        atomic_store(&pipeline->aborted, FALSE);
+        atomic_store(&pipeline->active_workers, workers);
+        int reader_started = pthread_create(&reader_thread, NULL, reader_main, pipeline) == 0;
+        for (int i = 0; reader_started && i < workers; i++) {
+            if (pthread_create(&worker_threads[i], NULL, worker_main, pipeline) != 0) {
+                break;
+            }
+            started++;
+        }
+        // 일부 스레드만 시작됐으면 남은 몫을 덜어 마지막 스레드가 쓰기 대기열을 닫게 함
+        if (started < workers) {
+            atomic_fetch_sub(&pipeline->active_workers, workers - started);
+            if (started == 0) {
+                queue_close(&pipeline->write_queue);
+            }
+        }
+
+        if (reader_started && started > 0) {
+            status = run_writer(&writer, pipeline, effective.commit_rows);
+        } else {
+            fprintf(stderr, "가져오기 스레드를 시작할 수 없습니다.\n");
+            status = FAILURE;
+        }
+
+        // 쓰기가 실패했으면 앞 단계가 대기열에서 멈추지 않도록 닫음
+        atomic_store(&pipeline->aborted, status != SUCCESS);
+        queue_close(&pipeline->parse_queue);
+        queue_close(&pipeline->write_queue);
+        if (reader_started) {
+            pthread_join(reader_thread, NULL);
+        }
+        for (int i = 0; i < started; i++) {
+            pthread_join(worker_threads[i], NULL);
+        }
+        if (effective.show_progress && writer.total_lines > 0) {
+            printf("\n");
+        }
+    }
+
+    queue_destroy(&pipeline->parse_queue);
+    queue_destroy(&pipeline->write_queue);
+    if (writer.insert_stmt) {
+        sqlite3_finalize(writer.insert_stmt);
+    }
+    if (writer.reject_file) {
+        fclose(writer.reject_file);
+    }
+    marc_writer_free(&writer.marc_writer);
+    free(writer.isbns.slots);
+    if (file) {
+        fclose(file);
+    }
+    marc_reader_close(&pipeline->marc_reader);
+    free(pipeline);
+
+    stats->elapsed_seconds = (timer_now_nanoseconds() - start_ns) / 1e9;
+    return status;
+}
@@ -0,0 +1,307 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sqlite3.h>
+#include "../include/calendar.h"
+#include "../include/database.h"
+#include "../include/utils.h"
+#include "../include/constants.h"
+
+// 연결별 휴관일 달력 캐시 (loan_book 경로에서 사용)
+static sqlite3 *cached_db = NULL;
+static ClosureCalendar cached_calendar;
+static int cached_valid = FALSE;
+
+static int to_local_tm(time_t time_val, struct tm *tm_out) {
+#ifdef _WIN32
+    return localtime_s(tm_out, &time_val) == 0 ? SUCCESS : FAILURE;
+#else
+    return localtime_r(&time_val, tm_out) ? SUCCESS : FAILURE;
+#endif
+}
+
+static int is_leap_year(int year) {
+    return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+}
+
+static int day_of_year(int year, int month, int day) {
+    static const int days_before_month[12] = {
+        0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334
+    };
+
+    int yday = days_before_month[month - 1] + day - 1;
+    if (month > 2 && is_leap_year(year)) {
+        yday++;
+    }
+    return yday;
+}
+
+static int parse_closure_date(const char *date_str, int *year, int *month, int *day) {
+    if (!date_str || sscanf(date_str, "%4d-%2d-%2d", year, month, day) != 3) {
+        return FAILURE;
+    }
+
+    static const int days_in_month[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+
+    if (*month < 1 || *month > 12 || *day < 1) {
+        return FAILURE;
+    }
+
+    int max_day = days_in_month[*month - 1] + ((*month == 2 && is_leap_year(*year)) ? 1 : 0);
+    return *day <= max_day ? SUCCESS : FAILURE;
+}
+
+static void mark_closed_day(ClosureCalendar *calendar, int year, int yday) {
+    int index = year - calendar->first_year;
+    if (index < 0 || index >= calendar->year_count) {
+        return;
+    }
+    calendar->closed_days[index][yday / 8] |= (unsigned char)(1u << (yday % 8));
+}
+
+int add_library_closure(sqlite3 *db, const char *closure_date, const char *reason) {
+    int year, month, day;
+
+    if (!db || parse_closure_date(closure_date, &year, &month, &day) != SUCCESS) {
+        fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
+        return FAILURE;
+    }
+
+    const char *sql =
+        "INSERT OR REPLACE INTO library_closures (closure_date, reason) VALUES (?, ?);";
+
+    sqlite3_stmt *stmt = NULL;
+    int result = FAILURE;
+
+    if (database_prepare_statement(db, sql, &stmt) != SUCCESS) {
+        return FAILURE;
+    }
+
+    char normalized[16];
+    snprintf(normalized, sizeof(normalized), "%04d-%02d-%02d", year, month, day);
+
+    sqlite3_bind_text(stmt, 1, normalized, -1, SQLITE_STATIC);
+    sqlite3_bind_text(stmt, 2, reason, -1, SQLITE_STATIC);
+
+    if (sqlite3_step(stmt) == SQLITE_DONE) {
+        result = SUCCESS;
+    } else {
+        fprintf(stderr, "휴관일 등록 실패: %s\n", sqlite3_errmsg(db));
+    }
+
+    sqlite3_finalize(stmt);
+    calendar_invalidate_cache();
+    return result;
+}
+
+int add_library_closure_range(sqlite3 *db, const DateRange *range, const char *reason) {
+    if (!db || !range || range->end < range->start) {
+        fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
+        return FAILURE;
+    }
+
+    struct tm current;
+    struct tm last;
+    if (to_local_tm(range->start, &current) != SUCCESS || to_local_tm(range->end, &last) != SUCCESS) {
+        return FAILURE;
+    }
+
+    const char *sql =
+        "INSERT OR REPLACE INTO library_closures (closure_date, reason) VALUES (?, ?);";
+
+    sqlite3_stmt *stmt = NULL;
+    int day_count = 0;
+
+    if (database_begin_immediate_transaction(db) != SUCCESS) {
+        return FAILURE;
+    }
+
+    if (database_prepare_statement(db, sql, &stmt) != SUCCESS) {
+        database_rollback_transaction(db);
+        return FAILURE;
+    }
+
+    // 서머타임 경계에서도 날짜가 밀리지 않도록 정오 기준으로 하루씩 이동
+    current.tm_hour = 12;
+    current.tm_min = 0;
+    current.tm_sec = 0;
+    current.tm_isdst = -1;
+
+    while (current.tm_year < last.tm_year ||
+           (current.tm_year == last.tm_year && current.tm_yday <= last.tm_yday)) {
+        char date_str[16];
+        strftime(date_str, sizeof(date_str), "%Y-%m-%d", &current);
+
+        sqlite3_bind_text(stmt, 1, date_str, -1, SQLITE_TRANSIENT);
+        sqlite3_bind_text(stmt, 2, reason, -1, SQLITE_STATIC);
+
+        if (sqlite3_step(stmt) != SQLITE_DONE) {
+            fprintf(stderr, "휴관일 등록 실패: %s\n", sqlite3_errmsg(db));
+            sqlite3_finalize(stmt);
+            database_rollback_transaction(db);
+            return FAILURE;
+        }
+        sqlite3_reset(stmt);
+        day_count++;
+
+        current.tm_mday++;
+        mktime(&current);
+    }
+
+    sqlite3_finalize(stmt);
+
+    if (database_commit_transaction(db) != SUCCESS) {
+        return FAILURE;
+    }
+
+    calendar_invalidate_cache();
+    return day_count;
+}
+
+int remove_library_closure(sqlite3 *db, const char *closure_date) {
+    if (!db || !closure_date) {
+        fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
+        return FAILURE;
+    }
+
+    const char *sql = "DELETE FROM library_closures WHERE closure_date = ?;";
+    sqlite3_stmt *stmt = NULL;
+    int result = FAILURE;
+
+    if (database_prepare_statement(db, sql, &stmt) != SUCCESS) {
+        return FAILURE;
+    }
+
+    sqlite3_bind_text(stmt, 1, closure_date, -1, SQLITE_STATIC);
+
+    if (sqlite3_step(stmt) == SQLITE_DONE) {
+        result = SUCCESS;
+    } else {
+        fprintf(stderr, "휴관일 삭제 실패: %s\n", sqlite3_errmsg(db));
+    }
+
+    sqlite3_finalize(stmt);
+    calendar_invalidate_cache();
+    return result;
+}
+
+int calendar_load(sqlite3 *db, int first_year, int year_count, ClosureCalendar *calendar) {
+    if (!db || !calendar || year_count <= 0 || year_count > CALENDAR_MAX_YEARS) {
+        fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
+        return FAILURE;
+    }
+
+    memset(calendar, 0, sizeof(ClosureCalendar));
+    calendar->first_year = first_year;
+    calendar->year_count = year_count;
+
+    // 기본키 범위 조회 한 번으로 해당 연도들의 휴관일을 모두 읽음
+    const char *sql =
+        "SELECT closure_date FROM library_closures "
+        "WHERE closure_date >= ? AND closure_date < ?;";
+
+    sqlite3_stmt *stmt = NULL;
+
+    if (database_prepare_statement(db, sql, &stmt) != SUCCESS) {
+        return FAILURE;
+    }
+
+    char lower_bound[32];
+    char upper_bound[32];
+    snprintf(lower_bound, sizeof(lower_bound), "%04d-01-01", first_year);
+    snprintf(upper_bound, sizeof(upper_bound), "%04d-01-01", first_year + year_count);
+
+    sqlite3_bind_text(stmt, 1, lower_bound, -1, SQLITE_STATIC);
+    sqlite3_bind_text(stmt, 2, upper_bound, -1, SQLITE_STATIC);
+
+    int step_result;
+    while ((step_result = sqlite3_step(stmt)) == SQLITE_ROW) {
+        int year, month, day;
+        const char *date_str = (const char*)sqlite3_column_text(stmt, 0);
+
+        if (parse_closure_date(date_str, &year, &month, &day) == SUCCESS) {
+            mark_closed_day(calendar, year, day_of_year(year, month, day));
+        }
+    }
+
+    sqlite3_finalize(stmt);
+
+    if (step_result != SQLITE_DONE) {
+        fprintf(stderr, "휴관일 조회 실패: %s\n", sqlite3_errmsg(db));
+        return FAILURE;
+    }
+
+    return SUCCESS;
+}
+
+int calendar_is_closed(const ClosureCalendar *calendar, time_t date) {
+    struct tm tm_info;
+
+    if (!calendar || to_local_tm(date, &tm_info) != SUCCESS) {
+        return FALSE;
+    }
+
+    int index = tm_info.tm_year + 1900 - calendar->first_year;
+    if (index < 0 || index >= calendar->year_count) {
+        return FALSE;
+    }
+
+    int yday = tm_info.tm_yday;
+    return (calendar->closed_days[index][yday / 8] >> (yday % 8)) & 1u ? TRUE : FALSE;
+}
+
+time_t calendar_next_open_day(const ClosureCalendar *calendar, time_t date) {
+    if (!calendar) {
+        return date;
+    }
+
+    // 적재 범위를 모두 휴관일로 채운 경우에도 반드시 종료
+    for (int i = 0; i < CALENDAR_MAX_YEARS * 366; i++) {
+        if (!calendar_is_closed(calendar, date)) {
+            return date;
+        }
+        date = add_days_to_time(date, 1);
+    }
+
+    return date;
+}
+
+time_t calendar_compute_due_date(sqlite3 *db, time_t loan_time, int loan_days) {
+    time_t due_date = add_days_to_time(loan_time, loan_days);
+
+    struct tm tm_info;
+    if (!db || to_local_tm(loan_time, &tm_info) != SUCCESS) {
+        return due_date;
+    }
+
+    int loan_year = tm_info.tm_year + 1900;
+    sqlite3_mutex *mutex = sqlite3_mutex_alloc(SQLITE_MUTEX_STATIC_APP1);
+
+    sqlite3_mutex_enter(mutex);
+
+    // 연결이 바뀌었거나 대출 연도가 캐시 범위를 벗어난 경우에만 다시 적재
+    if (!cached_valid || cached_db != db ||
+        loan_year < cached_calendar.first_year ||
+        loan_year >= cached_calendar.first_year + cached_calendar.year_count - 1) {
+        cached_valid = calendar_load(db, loan_year, CALENDAR_MAX_YEARS, &cached_calendar) == SUCCESS;
+        cached_db = db;
+    }
+
+    if (cached_valid) {
+        due_date = calendar_next_open_day(&cached_calendar, due_date);
+    }
+
+    sqlite3_mutex_leave(mutex);
+
+    return due_date;
+}
+
+void calendar_invalidate_cache(void) {
+    sqlite3_mutex *mutex = sqlite3_mutex_alloc(SQLITE_MUTEX_STATIC_APP1);
+
+    sqlite3_mutex_enter(mutex);
+    cached_valid = FALSE;
+    cached_db = NULL;
+    sqlite3_mutex_leave(mutex);
+}
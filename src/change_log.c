@@ -0,0 +1,1000 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dirent.h>
+#include "../include/change_log.h"
+#include "../include/database.h"
+#include "../include/backup.h"
+#include "../include/file_copy.h"
+#include "../include/utils.h"
+
+// 트리거 이름 접두사 (change_log_<테이블>_<insert|update|delete>)
+#define TRIGGER_PREFIX_PATTERN "change\\_log\\_%"
+
+static const char *operation_events[] = { "", "INSERT", "UPDATE", "DELETE" };
+static const char *operation_names[] = { "", "insert", "update", "delete" };
+
+/**
+ * @brief 기록하는 테이블의 컬럼 구성
+ */
+typedef struct {
+    char name[CHANGE_LOG_NAME_LENGTH];
+    char columns[CHANGE_LOG_MAX_COLUMNS][CHANGE_LOG_NAME_LENGTH];
+    int column_count;
+    int key_columns[CHANGE_LOG_MAX_COLUMNS];   // 기본 키 순서대로 columns 인덱스
+    int key_count;
+    int uses_rowid;                            // 기본 키가 없어 rowid로 행을 찾음
+} TableLayout;
+
+/**
+ * @brief 복구할 때 테이블마다 준비해 두는 문장
+ */
+typedef struct {
+    TableLayout layout;
+    sqlite3_stmt *statements[4];               // ChangeLogOperation 값으로 찾음
+} ReplayTable;
+
+// 'YYYY-MM-DD HH:MM:SS' 형식인지 확인 (change_log.changed_at과 문자열로 비교하므로 형식이 정확해야 함)
+static int is_valid_timestamp(const char *value) {
+    int year, month, day, hour, minute, second, length = 0;
+    if (!value || strlen(value) != 19 ||
+        sscanf(value, "%4d-%2d-%2d %2d:%2d:%2d%n", &year, &month, &day, &hour, &minute, &second, &length) != 6 ||
+        length != 19 || value[4] != '-' || value[7] != '-' || value[10] != ' ') {
+        return FALSE;
+    }
+    return month >= 1 && month <= 12 && day >= 1 && day <= 31 &&
+           hour <= 23 && minute <= 59 && second <= 59;
+}
+
+static int table_exists(sqlite3 *db, const char *name) {
+    sqlite3_stmt *stmt = NULL;
+    if (database_prepare_statement(db, "SELECT 1 FROM sqlite_master WHERE type = 'table' AND name = ?;",
+                                   &stmt) != SUCCESS) {
+        return FAILURE;
+    }
+    sqlite3_bind_text(stmt, 1, name, -1, SQLITE_STATIC);
+    int exists = sqlite3_step(stmt) == SQLITE_ROW ? TRUE : FALSE;
+    sqlite3_finalize(stmt);
+    return exists;
+}
+
+// 정수 하나를 돌려주는 질의 (결과가 없거나 NULL이면 *found = FALSE)
+static int query_int64(sqlite3 *db, const char *sql, long long bind_value, long long *value, int *found) {
+    sqlite3_stmt *stmt = NULL;
+    if (database_prepare_statement(db, sql, &stmt) != SUCCESS) {
+        return FAILURE;
+    }
+    if (sqlite3_bind_parameter_count(stmt) > 0) {
+        sqlite3_bind_int64(stmt, 1, bind_value);
+    }
+    int rc = sqlite3_step(stmt);
+    *found = rc == SQLITE_ROW && sqlite3_column_type(stmt, 0) != SQLITE_NULL;
+    *value = *found ? sqlite3_column_int64(stmt, 0) : 0;
+    sqlite3_finalize(stmt);
+    if (rc != SQLITE_ROW && rc != SQLITE_DONE) {
+        fprintf(stderr, "변경 기록 조회 실패: %s\n", sqlite3_errmsg(db));
+        return FAILURE;
+    }
+    return SUCCESS;
+}
+
+// 문자열 하나를 돌려주는 질의 (결과가 없으면 빈 문자열)
+static int query_text(sqlite3 *db, const char *sql, char *buffer, size_t buffer_size) {
+    sqlite3_stmt *stmt = NULL;
+    buffer[0] = '\0';
+    if (database_prepare_statement(db, sql, &stmt) != SUCCESS) {
+        return FAILURE;
+    }
+    int rc = sqlite3_step(stmt);
+    if (rc == SQLITE_ROW && sqlite3_column_text(stmt, 0)) {
+        safe_string_copy(buffer, (const char*)sqlite3_column_text(stmt, 0), buffer_size);
+    }
+    sqlite3_finalize(stmt);
+    if (rc != SQLITE_ROW && rc != SQLITE_DONE) {
+        fprintf(stderr, "변경 기록 조회 실패: %s\n", sqlite3_errmsg(db));
+        return FAILURE;
+    }
+    return SUCCESS;
+}
+
+static int load_layout(sqlite3 *db, const char *table, TableLayout *layout) {
+    memset(layout, 0, sizeof(TableLayout));
+    safe_string_copy(layout->name, table, sizeof(layout->name));
+
+    sqlite3_stmt *stmt = NULL;
+    if (database_prepare_statement(db, "SELECT name, pk FROM pragma_table_info(?) ORDER BY cid;", &stmt) != SUCCESS) {
+        return FAILURE;
+    }
+    sqlite3_bind_text(stmt, 1, table, -1, SQLITE_STATIC);
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+        if (layout->column_count >= CHANGE_LOG_MAX_COLUMNS) {
+            fprintf(stderr, "%s 테이블의 컬럼이 너무 많습니다 (최대 %d개).\n", table, CHANGE_LOG_MAX_COLUMNS);
+            sqlite3_finalize(stmt);
+            return FAILURE;
+        }
+        int index = layout->column_count++;
+        safe_string_copy(layout->columns[index], (const char*)sqlite3_column_text(stmt, 0), CHANGE_LOG_NAME_LENGTH);
+        int pk = sqlite3_column_int(stmt, 1);
+        if (pk > 0 && pk <= CHANGE_LOG_MAX_COLUMNS) {
+            layout->key_columns[pk - 1] = index;
+            if (pk > layout->key_count) {
+                layout->key_count = pk;
+            }
+        }
+    }
+    sqlite3_finalize(stmt);
+
+    if (layout->column_count == 0) {
+        fprintf(stderr, "%s 테이블을 찾을 수 없습니다.\n", table);
+        return FAILURE;
+    }
+    layout->uses_rowid = layout->key_count == 0;
+    return SUCCESS;
+}
+
+// 변경 기록 테이블, 가상 테이블과 그 내부 테이블(FTS5 색인 등)을 뺀 모든 테이블 이름
+static int list_tracked_tables(sqlite3 *db, char names[][CHANGE_LOG_NAME_LENGTH], int *count) {
+    const char *sql =
+        "SELECT name FROM pragma_table_list WHERE schema = 'main' AND type = 'table' "
+        "AND name NOT LIKE 'sqlite\\_%' ESCAPE '\\' "
+        "AND name NOT IN ('change_log', 'change_log_state') ORDER BY name;";
+    sqlite3_stmt *stmt = NULL;
+    *count = 0;
+    if (database_prepare_statement(db, sql, &stmt) != SUCCESS) {
+        return FAILURE;
+    }
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+        if (*count >= CHANGE_LOG_MAX_TABLES) {
+            fprintf(stderr, "기록할 테이블이 너무 많습니다 (최대 %d개).\n", CHANGE_LOG_MAX_TABLES);
+            sqlite3_finalize(stmt);
+            return FAILURE;
+        }
+        safe_string_copy(names[(*count)++], (const char*)sqlite3_column_text(stmt, 0), CHANGE_LOG_NAME_LENGTH);
+    }
+    sqlite3_finalize(stmt);
+    return SUCCESS;
+}
+
+// json_object('c1', PREFIX."c1", ...) (keys_only이면 기본 키 컬럼만)
+static void append_json_object(sqlite3_str *sql, const TableLayout *layout, const char *prefix, int keys_only) {
+    int first = TRUE;
+    sqlite3_str_appendall(sql, "json_object(");
+    if (layout->uses_rowid) {
+        sqlite3_str_appendf(sql, "'rowid', %s.rowid", prefix);
+        first = FALSE;
+    }
+    int count = keys_only ? layout->key_count : layout->column_count;
+    for (int i = 0; i < count; i++) {
+        const char *column = layout->columns[keys_only ? layout->key_columns[i] : i];
+        sqlite3_str_appendf(sql, "%s'%q', %s.\"%w\"", first ? "" : ", ", column, prefix, column);
+        first = FALSE;
+    }
+    sqlite3_str_appendall(sql, ")");
+}
+
+static char *build_trigger_sql(const TableLayout *layout, int operation) {
+    sqlite3_str *sql = sqlite3_str_new(NULL);
+    sqlite3_str_appendf(sql,
+                        "CREATE TRIGGER \"change_log_%w_%s\" AFTER %s ON \"%w\" BEGIN "
+                        "INSERT INTO change_log (changed_at, table_name, operation, row_key, row_data) "
+                        "VALUES (datetime('now'), '%q', %d, ",
+                        layout->name, operation_names[operation], operation_events[operation],
+                        layout->name, layout->name, operation);
+    if (operation == CHANGE_LOG_INSERT) {
+        sqlite3_str_appendall(sql, "NULL");
+    } else {
+        append_json_object(sql, layout, "OLD", TRUE);
+    }
+    sqlite3_str_appendall(sql, ", ");
+    if (operation == CHANGE_LOG_DELETE) {
+        sqlite3_str_appendall(sql, "NULL");
+    } else {
+        append_json_object(sql, layout, "NEW", FALSE);
+    }
+    sqlite3_str_appendall(sql, "); END");
+    return sqlite3_str_finish(sql);
+}
+
+static int drop_triggers(sqlite3 *db) {
+    sqlite3_stmt *stmt = NULL;
+    if (database_prepare_statement(db,
+            "SELECT name FROM sqlite_master WHERE type = 'trigger' AND name LIKE '" TRIGGER_PREFIX_PATTERN "' ESCAPE '\\';",
+            &stmt) != SUCCESS) {
+        return FAILURE;
+    }
+    sqlite3_str *sql = sqlite3_str_new(NULL);
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+        sqlite3_str_appendf(sql, "DROP TRIGGER \"%w\";", (const char*)sqlite3_column_text(stmt, 0));
+    }
+    sqlite3_finalize(stmt);
+
+    char *drop_sql = sqlite3_str_finish(sql);
+    int status = !drop_sql || database_execute_query(db, drop_sql) == SUCCESS ? SUCCESS : FAILURE;
+    sqlite3_free(drop_sql);
+    return status;
+}
+
+// 설치된 트리거가 만들 트리거와 같은지 확인
+static int triggers_match(sqlite3 *db, char **trigger_sql, int trigger_count) {
+    long long installed = 0;
+    int found = FALSE;
+    if (query_int64(db, "SELECT COUNT(*) FROM sqlite_master WHERE type = 'trigger' "
+                        "AND name LIKE '" TRIGGER_PREFIX_PATTERN "' ESCAPE '\\';", 0, &installed, &found) != SUCCESS) {
+        return FAILURE;
+    }
+    if (installed != trigger_count) {
+        return FALSE;
+    }
+
+    sqlite3_stmt *stmt = NULL;
+    if (database_prepare_statement(db, "SELECT 1 FROM sqlite_master WHERE type = 'trigger' AND sql = ?;",
+                                   &stmt) != SUCCESS) {
+        return FAILURE;
+    }
+    int match = TRUE;
+    for (int i = 0; i < trigger_count && match; i++) {
+        sqlite3_bind_text(stmt, 1, trigger_sql[i], -1, SQLITE_STATIC);
+        match = sqlite3_step(stmt) == SQLITE_ROW;
+        sqlite3_reset(stmt);
+    }
+    sqlite3_finalize(stmt);
+    return match ? TRUE : FALSE;
+}
+
+// 모든 테이블의 트리거를 현재 컬럼에 맞춰 설치 (이미 같으면 쓰지 않음)
+static int install_triggers(sqlite3 *db) {
+    char (*tables)[CHANGE_LOG_NAME_LENGTH] = malloc(sizeof(char[CHANGE_LOG_MAX_TABLES][CHANGE_LOG_NAME_LENGTH]));
+    char **trigger_sql = calloc(CHANGE_LOG_MAX_TABLES * 3, sizeof(char*));
+    TableLayout *layout = malloc(sizeof(TableLayout));
+    int table_count = 0;
+    int trigger_count = 0;
+    int status = FAILURE;
+
+    if (!tables || !trigger_sql || !layout) {
+        fprintf(stderr, "메모리 할당 실패\n");
+        goto cleanup;
+    }
+    if (list_tracked_tables(db, tables, &table_count) != SUCCESS) {
+        goto cleanup;
+    }
+    for (int i = 0; i < table_count; i++) {
+        if (load_layout(db, tables[i], layout) != SUCCESS) {
+            goto cleanup;
+        }
+        for (int operation = CHANGE_LOG_INSERT; operation <= CHANGE_LOG_DELETE; operation++) {
+            trigger_sql[trigger_count] = build_trigger_sql(layout, operation);
+            if (!trigger_sql[trigger_count++]) {
+                fprintf(stderr, "메모리 할당 실패\n");
+                goto cleanup;
+            }
+        }
+    }
+
+    int match = triggers_match(db, trigger_sql, trigger_count);
+    if (match != FALSE) {
+        status = match == TRUE ? SUCCESS : FAILURE;
+        goto cleanup;
+    }
+
+    // 기존 트리거를 지우고 다시 만드는 동안 다른 연결이 반쯤 바뀐 트리거를 보지 않도록 묶음
+    if (database_execute_query(db, "SAVEPOINT change_log_triggers;") != SUCCESS) {
+        goto cleanup;
+    }
+    status = drop_triggers(db);
+    for (int i = 0; i < trigger_count && status == SUCCESS; i++) {
+        status = database_execute_query(db, trigger_sql[i]);
+    }
+    if (status != SUCCESS) {
+        database_execute_query(db, "ROLLBACK TO change_log_triggers;");
+    }
+    database_execute_query(db, "RELEASE change_log_triggers;");
+
+cleanup:
+    if (trigger_sql) {
+        for (int i = 0; i < trigger_count; i++) {
+            sqlite3_free(trigger_sql[i]);
+        }
+    }
+    free(trigger_sql);
+    free(tables);
+    free(layout);
+    return status;
+}
+
+int change_log_is_enabled(sqlite3 *db) {
+    if (!db) {
+        fprintf(stderr, "유효하지 않은 데이터베이스 연결입니다.\n");
+        return FAILURE;
+    }
+    int exists = table_exists(db, "change_log_state");
+    if (exists != TRUE) {
+        return exists;
+    }
+    long long enabled = 0;
+    int found = FALSE;
+    if (query_int64(db, "SELECT enabled FROM change_log_state WHERE id = 1;", 0, &enabled, &found) != SUCCESS) {
+        return FAILURE;
+    }
+    return found && enabled ? TRUE : FALSE;
+}
+
+int change_log_enable(sqlite3 *db) {
+    if (!db) {
+        fprintf(stderr, "유효하지 않은 데이터베이스 연결입니다.\n");
+        return FAILURE;
+    }
+
+    const char *create_tables =
+        "CREATE TABLE IF NOT EXISTS change_log ("
+        "seq INTEGER PRIMARY KEY AUTOINCREMENT,"
+        "changed_at TEXT NOT NULL,"
+        "table_name TEXT NOT NULL,"
+        "operation INTEGER NOT NULL,"
+        "row_key TEXT,"
+        "row_data TEXT"
+        ");"
+        "CREATE TABLE IF NOT EXISTS change_log_state ("
+        "id INTEGER PRIMARY KEY CHECK (id = 1),"
+        "enabled INTEGER NOT NULL,"
+        "epoch TEXT NOT NULL,"
+        "enabled_at TEXT NOT NULL"
+        ");";
+
+    if (database_execute_query(db, "BEGIN IMMEDIATE;") != SUCCESS) {
+        return FAILURE;
+    }
+    int status = database_execute_query(db, create_tables);
+    if (status == SUCCESS) {
+        int enabled = change_log_is_enabled(db);
+        if (enabled == FAILURE) {
+            status = FAILURE;
+        } else if (enabled == FALSE) {
+            // 꺼져 있던 동안의 변경은 빠졌으므로 새 에포크로 시작
+            status = database_execute_query(db,
+                "INSERT INTO change_log_state (id, enabled, epoch, enabled_at) "
+                "VALUES (1, 1, lower(hex(randomblob(8))), datetime('now')) "
+                "ON CONFLICT(id) DO UPDATE SET enabled = 1, epoch = excluded.epoch, "
+                "enabled_at = excluded.enabled_at;");
+        }
+    }
+    if (status == SUCCESS) {
+        status = install_triggers(db);
+    }
+    if (status != SUCCESS) {
+        database_execute_query(db, "ROLLBACK;");
+        return FAILURE;
+    }
+    return database_execute_query(db, "COMMIT;");
+}
+
+int change_log_disable(sqlite3 *db) {
+    if (!db) {
+        fprintf(stderr, "유효하지 않은 데이터베이스 연결입니다.\n");
+        return FAILURE;
+    }
+    int exists = table_exists(db, "change_log_state");
+    if (exists != TRUE) {
+        return exists == FALSE ? SUCCESS : FAILURE;
+    }
+
+    if (database_execute_query(db, "BEGIN IMMEDIATE;") != SUCCESS) {
+        return FAILURE;
+    }
+    int status = database_execute_query(db, "UPDATE change_log_state SET enabled = 0;");
+    if (status == SUCCESS) {
+        status = drop_triggers(db);
+    }
+    if (status != SUCCESS) {
+        database_execute_query(db, "ROLLBACK;");
+        return FAILURE;
+    }
+    return database_execute_query(db, "COMMIT;");
+}
+
+int change_log_refresh_triggers(sqlite3 *db) {
+    int enabled = change_log_is_enabled(db);
+    if (enabled != TRUE) {
+        return enabled == FALSE ? SUCCESS : FAILURE;
+    }
+    return install_triggers(db);
+}
+
+int change_log_get_status(sqlite3 *db, ChangeLogStatus *status) {
+    if (!db || !status) {
+        fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
+        return FAILURE;
+    }
+    memset(status, 0, sizeof(ChangeLogStatus));
+
+    int enabled = change_log_is_enabled(db);
+    if (enabled == FAILURE) {
+        return FAILURE;
+    }
+    status->enabled = enabled;
+    if (table_exists(db, "change_log_state") == TRUE &&
+        (query_text(db, "SELECT epoch FROM change_log_state WHERE id = 1;",
+                    status->epoch, sizeof(status->epoch)) != SUCCESS ||
+         query_text(db, "SELECT enabled_at FROM change_log_state WHERE id = 1;",
+                    status->enabled_at, sizeof(status->enabled_at)) != SUCCESS)) {
+        return FAILURE;
+    }
+    if (table_exists(db, "change_log") != TRUE) {
+        return SUCCESS;
+    }
+
+    int found = FALSE;
+    if (query_int64(db, "SELECT COUNT(*) FROM change_log;", 0, &status->entries, &found) != SUCCESS ||
+        query_int64(db, "SELECT MIN(seq) FROM change_log;", 0, &status->first_seq, &found) != SUCCESS ||
+        query_int64(db, "SELECT MAX(seq) FROM change_log;", 0, &status->last_seq, &found) != SUCCESS ||
+        query_text(db, "SELECT changed_at FROM change_log ORDER BY seq LIMIT 1;",
+                   status->first_time, sizeof(status->first_time)) != SUCCESS ||
+        query_text(db, "SELECT changed_at FROM change_log ORDER BY seq DESC LIMIT 1;",
+                   status->last_time, sizeof(status->last_time)) != SUCCESS) {
+        return FAILURE;
+    }
+    return SUCCESS;
+}
+
+int change_log_prune(sqlite3 *db, const char *before_time, long long *deleted) {
+    if (deleted) {
+        *deleted = 0;
+    }
+    if (!db || !is_valid_timestamp(before_time)) {
+        fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
+        return FAILURE;
+    }
+    int exists = table_exists(db, "change_log");
+    if (exists != TRUE) {
+        return exists == FALSE ? SUCCESS : FAILURE;
+    }
+
+    // 순서 번호 기준으로 앞부분만 지워 남은 기록이 중간에 끊기지 않게 함
+    sqlite3_stmt *stmt = NULL;
+    if (database_prepare_statement(db,
+            "DELETE FROM change_log WHERE seq <= "
+            "(SELECT MAX(seq) FROM change_log WHERE changed_at < ?);", &stmt) != SUCCESS) {
+        return FAILURE;
+    }
+    sqlite3_bind_text(stmt, 1, before_time, -1, SQLITE_STATIC);
+    int rc = sqlite3_step(stmt);
+    sqlite3_finalize(stmt);
+    if (rc != SQLITE_DONE) {
+        fprintf(stderr, "변경 기록 정리 실패: %s\n", sqlite3_errmsg(db));
+        return FAILURE;
+    }
+    if (deleted) {
+        *deleted = sqlite3_changes64(db);
+    }
+    return SUCCESS;
+}
+
+void change_log_default_options(ChangeLogRecoverOptions *options) {
+    if (!options) {
+        return;
+    }
+    options->dry_run = FALSE;
+    options->batch_rows = CHANGE_LOG_BATCH_ROWS;
+    options->output_path = NULL;
+}
+
+// json_extract(?N, '$."c"')
+static void append_json_value(sqlite3_str *sql, int parameter, const char *column) {
+    sqlite3_str_appendf(sql, "json_extract(?%d, '$.\"%q\"')", parameter, column);
+}
+
+// WHERE 기본 키 = 변경 기록의 row_key (?1)
+static void append_key_condition(sqlite3_str *sql, const TableLayout *layout) {
+    if (layout->uses_rowid) {
+        sqlite3_str_appendall(sql, " WHERE rowid = ");
+        append_json_value(sql, 1, "rowid");
+        return;
+    }
+    for (int i = 0; i < layout->key_count; i++) {
+        const char *column = layout->columns[layout->key_columns[i]];
+        sqlite3_str_appendf(sql, "%s\"%w\" = ", i == 0 ? " WHERE " : " AND ", column);
+        append_json_value(sql, 1, column);
+    }
+}
+
+// row_key(?1)와 row_data(?2)로 변경을 다시 적용하는 문장
+static char *build_replay_sql(const TableLayout *layout, int operation) {
+    sqlite3_str *sql = sqlite3_str_new(NULL);
+    if (operation == CHANGE_LOG_INSERT) {
+        // REPLACE로 기존 행을 지운 경우 삭제가 기록되지 않으므로 똑같이 REPLACE로 적용
+        sqlite3_str_appendf(sql, "INSERT OR REPLACE INTO \"%w\" (%s", layout->name, layout->uses_rowid ? "rowid" : "");
+        for (int i = 0; i < layout->column_count; i++) {
+            sqlite3_str_appendf(sql, "%s\"%w\"", i > 0 || layout->uses_rowid ? ", " : "", layout->columns[i]);
+        }
+        sqlite3_str_appendall(sql, ") VALUES (");
+        if (layout->uses_rowid) {
+            append_json_value(sql, 2, "rowid");
+        }
+        for (int i = 0; i < layout->column_count; i++) {
+            sqlite3_str_appendall(sql, i > 0 || layout->uses_rowid ? ", " : "");
+            append_json_value(sql, 2, layout->columns[i]);
+        }
+        sqlite3_str_appendall(sql, ")");
+    } else if (operation == CHANGE_LOG_UPDATE) {
+        // 백업 뒤에 추가된 컬럼처럼 row_data에 없는 컬럼은 그대로 둠
+        sqlite3_str_appendf(sql, "UPDATE \"%w\" SET ", layout->name);
+        if (layout->uses_rowid) {
+            sqlite3_str_appendall(sql, "rowid = ");
+            append_json_value(sql, 2, "rowid");
+        }
+        for (int i = 0; i < layout->column_count; i++) {
+            const char *column = layout->columns[i];
+            sqlite3_str_appendf(sql, "%s\"%w\" = CASE WHEN json_type(?2, '$.\"%q\"') IS NULL THEN \"%w\" ELSE ",
+                                i > 0 || layout->uses_rowid ? ", " : "", column, column, column);
+            append_json_value(sql, 2, column);
+            sqlite3_str_appendall(sql, " END");
+        }
+        append_key_condition(sql, layout);
+    } else {
+        sqlite3_str_appendf(sql, "DELETE FROM \"%w\"", layout->name);
+        append_key_condition(sql, layout);
+    }
+    return sqlite3_str_finish(sql);
+}
+
+static ReplayTable *find_replay_table(sqlite3 *work_db, ReplayTable *tables, int *table_count, const char *name) {
+    for (int i = 0; i < *table_count; i++) {
+        if (strcmp(tables[i].layout.name, name) == 0) {
+            return &tables[i];
+        }
+    }
+    if (*table_count >= CHANGE_LOG_MAX_TABLES) {
+        fprintf(stderr, "복구할 테이블이 너무 많습니다 (최대 %d개).\n", CHANGE_LOG_MAX_TABLES);
+        return NULL;
+    }
+
+    ReplayTable *table = &tables[*table_count];
+    memset(table, 0, sizeof(ReplayTable));
+    if (load_layout(work_db, name, &table->layout) != SUCCESS) {
+        fprintf(stderr, "백업에 %s 테이블이 없어 변경을 적용할 수 없습니다.\n", name);
+        return NULL;
+    }
+    for (int operation = CHANGE_LOG_INSERT; operation <= CHANGE_LOG_DELETE; operation++) {
+        char *sql = build_replay_sql(&table->layout, operation);
+        int status = sql ? database_prepare_statement(work_db, sql, &table->statements[operation]) : FAILURE;
+        sqlite3_free(sql);
+        if (status != SUCCESS) {
+            for (int i = CHANGE_LOG_INSERT; i <= CHANGE_LOG_DELETE; i++) {
+                sqlite3_finalize(table->statements[i]);
+            }
+            return NULL;
+        }
+    }
+    (*table_count)++;
+    return table;
+}
+
+// 백업에 들어 있는 변경 기록의 에포크, 마지막 순서 번호와 시각
+static int read_backup_position(sqlite3 *backup_db, char *epoch, size_t epoch_size,
+                                long long *backup_seq, char *backup_time, size_t time_size) {
+    if (table_exists(backup_db, "change_log_state") != TRUE || table_exists(backup_db, "change_log") != TRUE) {
+        fprintf(stderr, "백업에 변경 기록이 없습니다. 변경 기록을 켠 뒤에 만든 백업이어야 합니다.\n");
+        return FAILURE;
+    }
+    if (query_text(backup_db, "SELECT epoch FROM change_log_state WHERE id = 1;", epoch, epoch_size) != SUCCESS) {
+        return FAILURE;
+    }
+    // 정리로 지워진 기록이 있어도 마지막 번호는 sqlite_sequence에 남아 있음
+    int found = FALSE;
+    if (query_int64(backup_db, "SELECT seq FROM sqlite_sequence WHERE name = 'change_log';", 0,
+                    backup_seq, &found) != SUCCESS ||
+        query_text(backup_db, "SELECT changed_at FROM change_log ORDER BY seq DESC LIMIT 1;",
+                   backup_time, time_size) != SUCCESS) {
+        return FAILURE;
+    }
+    if (backup_time[0] == '\0') {
+        return query_text(backup_db, "SELECT enabled_at FROM change_log_state WHERE id = 1;", backup_time, time_size);
+    }
+    return SUCCESS;
+}
+
+// 백업 이후의 변경이 현재 기록에 빠짐없이 남아 있는지 확인
+static int check_live_log(sqlite3 *db, const char *backup_epoch, long long backup_seq) {
+    char epoch[sizeof(((ChangeLogStatus*)0)->epoch)];
+    if (query_text(db, "SELECT epoch FROM change_log_state WHERE id = 1;", epoch, sizeof(epoch)) != SUCCESS) {
+        return FAILURE;
+    }
+    if (strcmp(epoch, backup_epoch) != 0) {
+        fprintf(stderr, "백업 이후에 변경 기록을 다시 켜서 기록이 이어지지 않습니다.\n");
+        return FAILURE;
+    }
+
+    long long live_seq = 0;
+    long long first_after = 0;
+    int has_live = FALSE;
+    int has_after = FALSE;
+    if (query_int64(db, "SELECT seq FROM sqlite_sequence WHERE name = 'change_log';", 0, &live_seq, &has_live) != SUCCESS ||
+        query_int64(db, "SELECT MIN(seq) FROM change_log WHERE seq > ?;", backup_seq, &first_after, &has_after) != SUCCESS) {
+        return FAILURE;
+    }
+    if (live_seq < backup_seq) {
+        fprintf(stderr, "백업이 현재 데이터베이스보다 나중의 것입니다.\n");
+        return FAILURE;
+    }
+    if (live_seq > backup_seq && (!has_after || first_after != backup_seq + 1)) {
+        fprintf(stderr, "백업 이후의 변경 기록 일부가 정리되어 복구할 수 없습니다.\n");
+        return FAILURE;
+    }
+    return SUCCESS;
+}
+
+int change_log_find_backup(sqlite3 *db, const char *directory, const char *target_time,
+                           char *backup_path, size_t path_size) {
+    if (!db || !directory || !is_valid_timestamp(target_time) || !backup_path || path_size == 0) {
+        fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
+        return FAILURE;
+    }
+    backup_path[0] = '\0';
+
+    char epoch[sizeof(((ChangeLogStatus*)0)->epoch)];
+    if (change_log_is_enabled(db) != TRUE ||
+        query_text(db, "SELECT epoch FROM change_log_state WHERE id = 1;", epoch, sizeof(epoch)) != SUCCESS) {
+        fprintf(stderr, "변경 기록이 켜져 있지 않아 시점 복구를 할 수 없습니다.\n");
+        return FAILURE;
+    }
+    DIR *dir = opendir(directory);
+    if (!dir) {
+        fprintf(stderr, "백업 디렉터리를 열 수 없습니다: %s\n", directory);
+        return FAILURE;
+    }
+
+    long long best_seq = -1;
+    struct dirent *item;
+    while ((item = readdir(dir)) != NULL) {
+        size_t length = strlen(item->d_name);
+        if (length <= 3 || strcmp(item->d_name + length - 3, ".db") != 0) {
+            continue;
+        }
+        char path[MAX_PATH_LENGTH];
+        if (snprintf(path, sizeof(path), "%s/%s", directory, item->d_name) >= (int)sizeof(path)) {
+            continue;
+        }
+
+        // 변경 기록을 켜기 전의 백업이나 다른 에포크의 백업은 건너뜀
+        sqlite3 *backup_db = NULL;
+        char backup_epoch[sizeof(epoch)];
+        char backup_time[20];
+        long long backup_seq = 0;
+        if (sqlite3_open_v2(path, &backup_db, SQLITE_OPEN_READONLY, NULL) == SQLITE_OK &&
+            table_exists(backup_db, "change_log_state") == TRUE &&
+            read_backup_position(backup_db, backup_epoch, sizeof(backup_epoch), &backup_seq,
+                                 backup_time, sizeof(backup_time)) == SUCCESS &&
+            strcmp(backup_epoch, epoch) == 0 && strcmp(backup_time, target_time) <= 0 && backup_seq > best_seq) {
+            best_seq = backup_seq;
+            safe_string_copy(backup_path, path, path_size);
+        }
+        sqlite3_close(backup_db);
+    }
+    closedir(dir);
+
+    if (best_seq < 0) {
+        fprintf(stderr, "%s에 %s 이전의 변경 기록이 있는 백업이 없습니다.\n", directory, target_time);
+        return FAILURE;
+    }
+    return SUCCESS;
+}
+
+static ChangeLogTableCount *report_table(ChangeLogRecoverReport *report, const char *name) {
+    for (int i = 0; i < report->table_count; i++) {
+        if (strcmp(report->tables[i].table_name, name) == 0) {
+            return &report->tables[i];
+        }
+    }
+    if (report->table_count >= CHANGE_LOG_MAX_TABLES) {
+        return NULL;
+    }
+    ChangeLogTableCount *table = &report->tables[report->table_count++];
+    safe_string_copy(table->table_name, name, sizeof(table->table_name));
+    return table;
+}
+
+// 적용할 범위 (backup_seq, stop_seq)의 테이블별 변경 수와 버리는 변경 수
+static int count_changes(sqlite3 *db, long long stop_seq, ChangeLogRecoverReport *report) {
+    sqlite3_stmt *stmt = NULL;
+    if (database_prepare_statement(db,
+            "SELECT table_name, operation, COUNT(*) FROM change_log "
+            "WHERE seq > ? AND seq < ? GROUP BY table_name, operation ORDER BY table_name;", &stmt) != SUCCESS) {
+        return FAILURE;
+    }
+    sqlite3_bind_int64(stmt, 1, report->backup_seq);
+    sqlite3_bind_int64(stmt, 2, stop_seq);
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+        ChangeLogTableCount *table = report_table(report, (const char*)sqlite3_column_text(stmt, 0));
+        int operation = sqlite3_column_int(stmt, 1);
+        long long count = sqlite3_column_int64(stmt, 2);
+        report->applied += count;
+        if (!table) {
+            continue;
+        }
+        if (operation == CHANGE_LOG_INSERT) {
+            table->inserts += count;
+        } else if (operation == CHANGE_LOG_UPDATE) {
+            table->updates += count;
+        } else if (operation == CHANGE_LOG_DELETE) {
+            table->deletes += count;
+        }
+    }
+    sqlite3_finalize(stmt);
+
+    int found = FALSE;
+    if (query_int64(db, "SELECT COUNT(*) FROM change_log WHERE seq >= ?;", stop_seq, &report->skipped, &found) != SUCCESS) {
+        return FAILURE;
+    }
+
+    if (database_prepare_statement(db,
+            "SELECT seq, changed_at FROM change_log WHERE seq > ? AND seq < ? ORDER BY seq DESC LIMIT 1;",
+            &stmt) != SUCCESS) {
+        return FAILURE;
+    }
+    sqlite3_bind_int64(stmt, 1, report->backup_seq);
+    sqlite3_bind_int64(stmt, 2, stop_seq);
+    if (sqlite3_step(stmt) == SQLITE_ROW) {
+        report->last_seq = sqlite3_column_int64(stmt, 0);
+        safe_string_copy(report->last_time, (const char*)sqlite3_column_text(stmt, 1), sizeof(report->last_time));
+    }
+    sqlite3_finalize(stmt);
+    return SUCCESS;
+}
+
+// 현재 기록에서 (backup_seq, stop_seq) 범위를 batch_rows개씩 읽어 작업 사본에 적용
+static int replay_changes(sqlite3 *db, sqlite3 *work_db, long long stop_seq, int batch_rows,
+                          ChangeLogRecoverReport *report) {
+    ReplayTable *tables = calloc(CHANGE_LOG_MAX_TABLES, sizeof(ReplayTable));
+    sqlite3_stmt *read_stmt = NULL;
+    sqlite3_stmt *copy_stmt = NULL;
+    int table_count = 0;
+    int status = FAILURE;
+
+    if (!tables) {
+        fprintf(stderr, "메모리 할당 실패\n");
+        return FAILURE;
+    }
+    if (database_prepare_statement(db,
+            "SELECT seq, changed_at, table_name, operation, row_key, row_data FROM change_log "
+            "WHERE seq > ? AND seq < ? ORDER BY seq LIMIT ?;", &read_stmt) != SUCCESS ||
+        database_prepare_statement(work_db,
+            "INSERT INTO change_log (seq, changed_at, table_name, operation, row_key, row_data) "
+            "VALUES (?, ?, ?, ?, ?, ?);", &copy_stmt) != SUCCESS) {
+        goto cleanup;
+    }
+
+    long long last_seq = report->backup_seq;
+    for (;;) {
+        // 배치마다 다시 읽어 현재 데이터베이스의 읽기 잠금을 오래 잡지 않음
+        sqlite3_bind_int64(read_stmt, 1, last_seq);
+        sqlite3_bind_int64(read_stmt, 2, stop_seq);
+        sqlite3_bind_int(read_stmt, 3, batch_rows);
+
+        int rows = 0;
+        int rc = SQLITE_ROW;
+        if (database_execute_query(work_db, "BEGIN;") != SUCCESS) {
+            goto cleanup;
+        }
+        while ((rc = sqlite3_step(read_stmt)) == SQLITE_ROW) {
+            long long seq = sqlite3_column_int64(read_stmt, 0);
+            const char *table_name = (const char*)sqlite3_column_text(read_stmt, 2);
+            int operation = sqlite3_column_int(read_stmt, 3);
+            if (operation < CHANGE_LOG_INSERT || operation > CHANGE_LOG_DELETE) {
+                fprintf(stderr, "변경 #%lld의 종류(%d)를 알 수 없습니다.\n", seq, operation);
+                goto cleanup;
+            }
+            ReplayTable *table = find_replay_table(work_db, tables, &table_count, table_name);
+            if (!table) {
+                goto cleanup;
+            }
+
+            sqlite3_stmt *apply_stmt = table->statements[operation];
+            sqlite3_bind_value(apply_stmt, 1, sqlite3_column_value(read_stmt, 4));
+            sqlite3_bind_value(apply_stmt, 2, sqlite3_column_value(read_stmt, 5));
+            int apply_rc = sqlite3_step(apply_stmt);
+            sqlite3_reset(apply_stmt);
+            if (apply_rc != SQLITE_DONE) {
+                fprintf(stderr, "변경 #%lld 적용 실패 (%s): %s\n", seq, table_name, sqlite3_errmsg(work_db));
+                goto cleanup;
+            }
+            if (operation != CHANGE_LOG_INSERT && sqlite3_changes(work_db) != 1) {
+                fprintf(stderr, "변경 #%lld를 적용할 %s 행이 백업에 없습니다. 백업과 기록이 맞지 않습니다.\n",
+                        seq, table_name);
+                goto cleanup;
+            }
+
+            // 복구한 데이터베이스에서도 기록이 이어지도록 원래 번호와 시각 그대로 옮김
+            for (int column = 0; column < 6; column++) {
+                sqlite3_bind_value(copy_stmt, column + 1, sqlite3_column_value(read_stmt, column));
+            }
+            int copy_rc = sqlite3_step(copy_stmt);
+            sqlite3_reset(copy_stmt);
+            if (copy_rc != SQLITE_DONE) {
+                fprintf(stderr, "변경 #%lld 기록 실패: %s\n", seq, sqlite3_errmsg(work_db));
+                goto cleanup;
+            }
+            last_seq = seq;
+            rows++;
+        }
+        sqlite3_reset(read_stmt);
+        if (rc != SQLITE_DONE) {
+            fprintf(stderr, "변경 기록 읽기 실패: %s\n", sqlite3_errmsg(db));
+            goto cleanup;
+        }
+        if (database_execute_query(work_db, "COMMIT;") != SUCCESS) {
+            goto cleanup;
+        }
+        if (rows == 0) {
+            break;
+        }
+        report->batches++;
+        if (rows < batch_rows) {
+            break;
+        }
+    }
+    status = SUCCESS;
+
+cleanup:
+    if (status != SUCCESS && !sqlite3_get_autocommit(work_db)) {
+        database_execute_query(work_db, "ROLLBACK;");
+    }
+    sqlite3_finalize(read_stmt);
+    sqlite3_finalize(copy_stmt);
+    for (int i = 0; i < table_count; i++) {
+        for (int operation = CHANGE_LOG_INSERT; operation <= CHANGE_LOG_DELETE; operation++) {
+            sqlite3_finalize(tables[i].statements[operation]);
+        }
+    }
+    free(tables);
+    return status;
+}
+
+int change_log_recover(sqlite3 *db, const char *backup_path, const char *target_time,
+                       const ChangeLogRecoverOptions *options, ChangeLogRecoverReport *report) {
+    ChangeLogRecoverReport current;
+    memset(&current, 0, sizeof(ChangeLogRecoverReport));
+    if (report) {
+        *report = current;
+    }
+    if (!db || !backup_path || !is_valid_timestamp(target_time)) {
+        fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
+        return FAILURE;
+    }
+
+    ChangeLogRecoverOptions effective;
+    change_log_default_options(&effective);
+    if (options) {
+        effective = *options;
+        if (effective.batch_rows <= 0) {
+            effective.batch_rows = CHANGE_LOG_BATCH_ROWS;
+        }
+    }
+
+    if (change_log_is_enabled(db) != TRUE) {
+        fprintf(stderr, "변경 기록이 켜져 있지 않아 시점 복구를 할 수 없습니다.\n");
+        return FAILURE;
+    }
+
+    const char *live_path = sqlite3_db_filename(db, "main");
+    const char *base_path = effective.output_path ? effective.output_path : live_path;
+    char work_path[MAX_PATH_LENGTH];
+    if (!base_path || base_path[0] == '\0' ||
+        snprintf(work_path, sizeof(work_path), "%s%s", base_path, CHANGE_LOG_WORK_SUFFIX) >= (int)sizeof(work_path)) {
+        fprintf(stderr, "복구할 데이터베이스 경로가 올바르지 않습니다.\n");
+        return FAILURE;
+    }
+
+    long long start_ns = timer_now_nanoseconds();
+    sqlite3 *work_db = NULL;
+    int work_created = FALSE;
+    int status = FAILURE;
+
+    if (effective.dry_run) {
+        // 미리 보기는 백업을 읽기만 함
+        if (sqlite3_open_v2(backup_path, &work_db, SQLITE_OPEN_READONLY, NULL) != SQLITE_OK) {
+            fprintf(stderr, "백업 데이터베이스 열기 실패: %s\n", sqlite3_errmsg(work_db));
+            goto cleanup;
+        }
+    } else {
+        // 체크섬 목록이 있는 백업은 복사하기 전에 손상 여부를 먼저 검사
+        char checksum_path[MAX_PATH_LENGTH + sizeof(BACKUP_CHECKSUM_SUFFIX)];
+        snprintf(checksum_path, sizeof(checksum_path), "%s%s", backup_path, BACKUP_CHECKSUM_SUFFIX);
+        FILE *checksum_file = fopen(checksum_path, "r");
+        if (checksum_file) {
+            fclose(checksum_file);
+            if (backup_verify(backup_path, FALSE, NULL) != SUCCESS) {
+                fprintf(stderr, "백업 검사에 실패해 복구하지 않습니다: %s\n", backup_path);
+                goto cleanup;
+            }
+        }
+
+        if (file_copy(backup_path, work_path, FILE_COPY_AUTO, NULL) != SUCCESS) {
+            fprintf(stderr, "작업용 사본을 만들 수 없습니다: %s\n", work_path);
+            goto cleanup;
+        }
+        work_created = TRUE;
+        if (sqlite3_open(work_path, &work_db) != SQLITE_OK) {
+            fprintf(stderr, "작업용 사본 열기 실패: %s\n", sqlite3_errmsg(work_db));
+            goto cleanup;
+        }
+        // 실패하면 사본을 버리므로 저널과 동기화 없이 적용하고, 외래 키는 기록된 순서를 그대로 따름
+        if (database_execute_query(work_db,
+                "PRAGMA journal_mode = OFF; PRAGMA synchronous = OFF; PRAGMA foreign_keys = OFF;") != SUCCESS) {
+            goto cleanup;
+        }
+    }
+
+    char backup_epoch[sizeof(((ChangeLogStatus*)0)->epoch)];
+    if (read_backup_position(work_db, backup_epoch, sizeof(backup_epoch), &current.backup_seq,
+                             current.backup_time, sizeof(current.backup_time)) != SUCCESS ||
+        check_live_log(db, backup_epoch, current.backup_seq) != SUCCESS) {
+        goto cleanup;
+    }
+    if (strcmp(target_time, current.backup_time) < 0) {
+        fprintf(stderr, "목표 시각이 백업 시점(%s)보다 앞섭니다. 더 오래된 백업을 사용하세요.\n", current.backup_time);
+        goto cleanup;
+    }
+
+    // 목표 시각을 넘는 첫 변경에서 멈춤 (그 뒤의 변경은 시각과 관계없이 버림)
+    long long stop_seq = 0;
+    int found = FALSE;
+    sqlite3_stmt *stmt = NULL;
+    if (database_prepare_statement(db, "SELECT MIN(seq) FROM change_log WHERE seq > ? AND changed_at > ?;",
+                                   &stmt) != SUCCESS) {
+        goto cleanup;
+    }
+    sqlite3_bind_int64(stmt, 1, current.backup_seq);
+    sqlite3_bind_text(stmt, 2, target_time, -1, SQLITE_STATIC);
+    found = sqlite3_step(stmt) == SQLITE_ROW && sqlite3_column_type(stmt, 0) != SQLITE_NULL;
+    stop_seq = found ? sqlite3_column_int64(stmt, 0) : 0;
+    sqlite3_finalize(stmt);
+    if (!found && query_int64(db, "SELECT MAX(seq) + 1 FROM change_log;", 0, &stop_seq, &found) != SUCCESS) {
+        goto cleanup;
+    }
+    if (!found || stop_seq <= current.backup_seq) {
+        stop_seq = current.backup_seq + 1;
+    }
+
+    current.last_seq = current.backup_seq;
+    safe_string_copy(current.last_time, current.backup_time, sizeof(current.last_time));
+    if (count_changes(db, stop_seq, &current) != SUCCESS) {
+        goto cleanup;
+    }
+    if (effective.dry_run) {
+        status = SUCCESS;
+        goto cleanup;
+    }
+
+    // 백업 시점의 트리거는 적용 중에 기록을 중복시키므로 지우고, 끝나면 현재 스키마로 다시 설치
+    if (drop_triggers(work_db) != SUCCESS ||
+        replay_changes(db, work_db, stop_seq, effective.batch_rows, &current) != SUCCESS ||
+        install_triggers(work_db) != SUCCESS) {
+        goto cleanup;
+    }
+    sqlite3_close(work_db);
+    work_db = NULL;
+
+    if (effective.output_path) {
+        remove(effective.output_path);
+        if (rename(work_path, effective.output_path) != 0) {
+            fprintf(stderr, "복구한 데이터베이스를 저장할 수 없습니다: %s\n", effective.output_path);
+            goto cleanup;
+        }
+        work_created = FALSE;
+    } else if (database_restore(db, work_path) != SUCCESS) {
+        goto cleanup;
+    }
+    status = SUCCESS;
+
+cleanup:
+    if (work_db) {
+        sqlite3_close(work_db);
+    }
+    if (work_created) {
+        remove(work_path);
+    }
+    current.elapsed_seconds = (timer_now_nanoseconds() - start_ns) / 1e9;
+    if (report) {
+        *report = current;
+    }
+    return status;
+}
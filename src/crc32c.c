@@ -0,0 +1,170 @@
+#include <stdint.h>
+#include <string.h>
+#include <pthread.h>
+#include "../include/crc32c.h"
+
+/*
+ * 하드웨어 구현은 컴파일러가 지원할 때만 넣고, 실제로 쓸지는 처음 호출할 때 CPU를 확인해 정합니다.
+ * 함수 단위 target 속성을 쓰므로 라이브러리 전체를 -msse4.2 등으로 빌드할 필요가 없습니다.
+ */
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define CRC32C_HAVE_SSE42 1
+#define CRC32C_TARGET_SSE42 __attribute__((target("sse4.2")))
+#include <nmmintrin.h>
+#elif defined(_MSC_VER) && defined(_M_X64)
+#define CRC32C_HAVE_SSE42 1
+#define CRC32C_TARGET_SSE42
+#include <nmmintrin.h>
+#include <intrin.h>
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+#define CRC32C_HAVE_ARMV8 1
+#define CRC32C_TARGET_ARMV8
+#include <arm_acle.h>
+#elif defined(__aarch64__) && defined(__GNUC__) && !defined(__clang__) && defined(__linux__)
+#define CRC32C_HAVE_ARMV8 1
+#define CRC32C_TARGET_ARMV8 __attribute__((target("+crc")))
+#include <arm_acle.h>
+#include <sys/auxv.h>
+#ifndef HWCAP_CRC32
+#define HWCAP_CRC32 (1 << 7)
+#endif
+#endif
+
+#define CRC32C_POLYNOMIAL 0x82F63B78u   // 0x1EDC6F41을 비트 순서를 뒤집은 값
+
+typedef uint32_t (*Crc32cFunction)(uint32_t crc, const unsigned char *data, size_t length);
+
+static uint32_t crc_table[8][256];
+static Crc32cFunction crc_function = NULL;
+static const char *crc_name = "software";
+static pthread_once_t crc_once = PTHREAD_ONCE_INIT;
+
+// 리틀 엔디언 8바이트 읽기 (엔디언과 정렬에 관계없이 동작)
+static uint64_t read_u64_le(const unsigned char *p) {
+    return (uint64_t)p[0] | (uint64_t)p[1] << 8 | (uint64_t)p[2] << 16 | (uint64_t)p[3] << 24 |
+           (uint64_t)p[4] << 32 | (uint64_t)p[5] << 40 | (uint64_t)p[6] << 48 | (uint64_t)p[7] << 56;
+}
+
+// 8바이트를 표 8개로 한 번에 처리 (slicing-by-8)
+static uint32_t update_software(uint32_t crc, const unsigned char *p, size_t length) {
+    crc = ~crc;
+    while (length >= 8) {
+        uint64_t word = read_u64_le(p) ^ crc;
+        crc = crc_table[7][word & 0xff] ^ crc_table[6][(word >> 8) & 0xff] ^
+              crc_table[5][(word >> 16) & 0xff] ^ crc_table[4][(word >> 24) & 0xff] ^
+              crc_table[3][(word >> 32) & 0xff] ^ crc_table[2][(word >> 40) & 0xff] ^
+              crc_table[1][(word >> 48) & 0xff] ^ crc_table[0][word >> 56];
+        p += 8;
+        length -= 8;
+    }
+    while (length-- > 0) {
+        crc = crc_table[0][(crc ^ *p++) & 0xff] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+#ifdef CRC32C_HAVE_SSE42
+CRC32C_TARGET_SSE42
+static uint32_t update_sse42(uint32_t crc, const unsigned char *p, size_t length) {
+    uint64_t value = ~crc;
+    while (length >= 8) {
+        uint64_t word;
+        memcpy(&word, p, sizeof(word));
+        value = _mm_crc32_u64(value, word);
+        p += 8;
+        length -= 8;
+    }
+    uint32_t value32 = (uint32_t)value;
+    while (length-- > 0) {
+        value32 = _mm_crc32_u8(value32, *p++);
+    }
+    return ~value32;
+}
+
+static int cpu_has_sse42(void) {
+#ifdef _MSC_VER
+    int info[4];
+    __cpuid(info, 1);
+    return (info[2] & (1 << 20)) != 0;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("sse4.2");
+#endif
+}
+#endif
+
+#ifdef CRC32C_HAVE_ARMV8
+CRC32C_TARGET_ARMV8
+static uint32_t update_armv8(uint32_t crc, const unsigned char *p, size_t length) {
+    crc = ~crc;
+    while (length >= 8) {
+        uint64_t word;
+        memcpy(&word, p, sizeof(word));
+        crc = __crc32cd(crc, word);
+        p += 8;
+        length -= 8;
+    }
+    while (length-- > 0) {
+        crc = __crc32cb(crc, *p++);
+    }
+    return ~crc;
+}
+
+static int cpu_has_armv8_crc(void) {
+#ifdef __ARM_FEATURE_CRC32
+    return 1;
+#else
+    return (getauxval(AT_HWCAP) & HWCAP_CRC32) != 0;
+#endif
+}
+#endif
+
+static void crc32c_init(void) {
+    for (uint32_t i = 0; i < 256; i++) {
+        uint32_t crc = i;
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (CRC32C_POLYNOMIAL & (0u - (crc & 1)));
+        }
+        crc_table[0][i] = crc;
+    }
+    for (int k = 1; k < 8; k++) {
+        for (int i = 0; i < 256; i++) {
+            uint32_t previous = crc_table[k - 1][i];
+            crc_table[k][i] = (previous >> 8) ^ crc_table[0][previous & 0xff];
+        }
+    }
+
+    crc_function = update_software;
+#if defined(CRC32C_HAVE_SSE42)
+    if (cpu_has_sse42()) {
+        crc_function = update_sse42;
+        crc_name = "sse4.2";
+    }
+#elif defined(CRC32C_HAVE_ARMV8)
+    if (cpu_has_armv8_crc()) {
+        crc_function = update_armv8;
+        crc_name = "armv8-crc";
+    }
+#endif
+}
+
+uint32_t crc32c_update(uint32_t crc, const void *data, size_t length) {
+    pthread_once(&crc_once, crc32c_init);
+    if (!data || length == 0) {
+        return crc;
+    }
+    return crc_function(crc, (const unsigned char*)data, length);
+}
+
+uint32_t crc32c_update_software(uint32_t crc, const void *data, size_t length) {
+    pthread_once(&crc_once, crc32c_init);
+    if (!data || length == 0) {
+        return crc;
+    }
+    return update_software(crc, (const unsigned char*)data, length);
+}
+
+const char *crc32c_implementation(void) {
+    pthread_once(&crc_once, crc32c_init);
+    return crc_name;
+}
@@ -0,0 +1,608 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <time.h>
+#include "../include/data_export.h"
+#include "../include/database.h"
+#include "../include/arrow_ipc.h"
+#include "../include/utils.h"
+
+// ---------------------------------------------------------------------------
+// 대상별 조회문
+// ---------------------------------------------------------------------------
+
+// Arrow 열 정의 (조회문의 열 순서와 같음, category는 사전 인코딩)
+static const ArrowColumnSpec book_columns[] = {
+    { "id", ARROW_COLUMN_INT64, FALSE },
+    { "title", ARROW_COLUMN_UTF8, TRUE },
+    { "author", ARROW_COLUMN_UTF8, TRUE },
+    { "isbn", ARROW_COLUMN_UTF8, TRUE },
+    { "publisher", ARROW_COLUMN_UTF8, TRUE },
+    { "publication_year", ARROW_COLUMN_INT32, TRUE },
+    { "total_copies", ARROW_COLUMN_INT32, TRUE },
+    { "available_copies", ARROW_COLUMN_INT32, TRUE },
+    { "category", ARROW_COLUMN_DICTIONARY, TRUE },
+    { "created_at", ARROW_COLUMN_TIMESTAMP, TRUE },
+    { "updated_at", ARROW_COLUMN_TIMESTAMP, TRUE },
+};
+
+static const ArrowColumnSpec member_columns[] = {
+    { "id", ARROW_COLUMN_INT64, FALSE },
+    { "name", ARROW_COLUMN_UTF8, TRUE },
+    { "email", ARROW_COLUMN_UTF8, TRUE },
+    { "phone", ARROW_COLUMN_UTF8, TRUE },
+    { "address", ARROW_COLUMN_UTF8, TRUE },
+    { "registration_date", ARROW_COLUMN_TIMESTAMP, TRUE },
+    { "is_active", ARROW_COLUMN_BOOL, TRUE },
+    { "created_at", ARROW_COLUMN_TIMESTAMP, TRUE },
+    { "updated_at", ARROW_COLUMN_TIMESTAMP, TRUE },
+};
+
+static const ArrowColumnSpec loan_columns[] = {
+    { "id", ARROW_COLUMN_INT64, FALSE },
+    { "book_id", ARROW_COLUMN_INT64, TRUE },
+    { "member_id", ARROW_COLUMN_INT64, TRUE },
+    { "loan_date", ARROW_COLUMN_TIMESTAMP, TRUE },
+    { "due_date", ARROW_COLUMN_TIMESTAMP, TRUE },
+    { "return_date", ARROW_COLUMN_TIMESTAMP, TRUE },
+    { "is_returned", ARROW_COLUMN_BOOL, TRUE },
+    { "renewal_count", ARROW_COLUMN_INT32, TRUE },
+};
+
+static const ArrowColumnSpec loan_detail_columns[] = {
+    { "loan_id", ARROW_COLUMN_INT64, FALSE },
+    { "loan_date", ARROW_COLUMN_TIMESTAMP, TRUE },
+    { "due_date", ARROW_COLUMN_TIMESTAMP, TRUE },
+    { "return_date", ARROW_COLUMN_TIMESTAMP, TRUE },
+    { "is_returned", ARROW_COLUMN_BOOL, TRUE },
+    { "renewal_count", ARROW_COLUMN_INT32, TRUE },
+    { "book_id", ARROW_COLUMN_INT64, FALSE },
+    { "title", ARROW_COLUMN_UTF8, TRUE },
+    { "author", ARROW_COLUMN_UTF8, TRUE },
+    { "isbn", ARROW_COLUMN_UTF8, TRUE },
+    { "category", ARROW_COLUMN_DICTIONARY, TRUE },
+    { "member_id", ARROW_COLUMN_INT64, FALSE },
+    { "member_name", ARROW_COLUMN_UTF8, TRUE },
+    { "member_email", ARROW_COLUMN_UTF8, TRUE },
+};
+
+#define COLUMN_COUNT(columns) ((int)(sizeof(columns) / sizeof(columns[0])))
+
+static const struct {
+    const char *name;
+    const char *select;        // SELECT ... FROM ... (WHERE와 ORDER BY는 붙여서 씀)
+    const char *date_column;   // 기간 필터를 거는 열
+    const char *id_order;      // 기간 필터가 없을 때의 정렬
+    const char *range_order;   // 기간 필터가 있을 때의 정렬 (색인 순서를 따라 정렬용 임시 테이블을 만들지 않음)
+    const ArrowColumnSpec *arrow_columns;
+    int arrow_column_count;
+} entities[] = {
+    [DATA_EXPORT_BOOKS] = {
+        "books",
+        "SELECT id, title, author, isbn, publisher, publication_year, total_copies, available_copies, "
+        "category, created_at, updated_at FROM books",
+        "created_at", "id", "id",
+        book_columns, COLUMN_COUNT(book_columns)
+    },
+    [DATA_EXPORT_MEMBERS] = {
+        "members",
+        "SELECT id, name, email, phone, address, registration_date, is_active, created_at, updated_at "
+        "FROM members",
+        "registration_date", "id", "id",
+        member_columns, COLUMN_COUNT(member_columns)
+    },
+    [DATA_EXPORT_LOANS] = {
+        "loans",
+        "SELECT id, book_id, member_id, loan_date, due_date, return_date, is_returned, renewal_count "
+        "FROM loans",
+        "loan_date", "id", "loan_date, id",
+        loan_columns, COLUMN_COUNT(loan_columns)
+    },
+    [DATA_EXPORT_LOAN_DETAILS] = {
+        "loan_details",
+        "SELECT l.id AS loan_id, l.loan_date, l.due_date, l.return_date, l.is_returned, l.renewal_count, "
+        "b.id AS book_id, b.title, b.author, b.isbn, b.category, "
+        "m.id AS member_id, m.name AS member_name, m.email AS member_email "
+        "FROM loans l JOIN books b ON b.id = l.book_id JOIN members m ON m.id = l.member_id",
+        "l.loan_date", "l.id", "l.loan_date, l.id",
+        loan_detail_columns, COLUMN_COUNT(loan_detail_columns)
+    },
+};
+
+#define ENTITY_COUNT ((int)(sizeof(entities) / sizeof(entities[0])))
+
+int data_export_parse_entity(const char *name, DataExportEntity *entity) {
+    if (!name || !entity) {
+        return FAILURE;
+    }
+    for (int i = 0; i < ENTITY_COUNT; i++) {
+        if (strcmp(name, entities[i].name) == 0) {
+            *entity = (DataExportEntity)i;
+            return SUCCESS;
+        }
+    }
+    return FAILURE;
+}
+
+int data_export_parse_format(const char *name, DataExportFormat *format) {
+    if (!name || !format) {
+        return FAILURE;
+    }
+    if (strcmp(name, "csv") == 0) {
+        *format = DATA_EXPORT_CSV;
+    } else if (strcmp(name, "ndjson") == 0 || strcmp(name, "jsonl") == 0) {
+        *format = DATA_EXPORT_NDJSON;
+    } else if (strcmp(name, "arrow") == 0) {
+        *format = DATA_EXPORT_ARROW;
+    } else {
+        return FAILURE;
+    }
+    return SUCCESS;
+}
+
+// ---------------------------------------------------------------------------
+// 출력 버퍼
+// ---------------------------------------------------------------------------
+
+typedef struct {
+    FILE *output;
+    char *data;
+    size_t length;
+    int error;
+} ExportBuffer;
+
+static void buffer_flush(ExportBuffer *buffer) {
+    if (buffer->length > 0 && !buffer->error &&
+        fwrite(buffer->data, 1, buffer->length, buffer->output) != buffer->length) {
+        buffer->error = TRUE;
+    }
+    buffer->length = 0;
+}
+
+static void buffer_write(ExportBuffer *buffer, const char *data, size_t length) {
+    while (length > 0) {
+        if (buffer->length == DATA_EXPORT_BUFFER_SIZE) {
+            buffer_flush(buffer);
+        }
+        size_t chunk = DATA_EXPORT_BUFFER_SIZE - buffer->length;
+        if (chunk > length) {
+            chunk = length;
+        }
+        memcpy(buffer->data + buffer->length, data, chunk);
+        buffer->length += chunk;
+        data += chunk;
+        length -= chunk;
+    }
+}
+
+static void buffer_put(ExportBuffer *buffer, char c) {
+    if (buffer->length == DATA_EXPORT_BUFFER_SIZE) {
+        buffer_flush(buffer);
+    }
+    buffer->data[buffer->length++] = c;
+}
+
+// ---------------------------------------------------------------------------
+// CSV
+// ---------------------------------------------------------------------------
+
+// 구분자, 따옴표, 줄바꿈이 있거나 앞뒤가 공백인 값만 큰따옴표로 감싸고 안의 따옴표는 두 번 씀
+static void write_csv_value(ExportBuffer *buffer, const char *value, size_t length) {
+    int quote = length > 0 && (value[0] == ' ' || value[length - 1] == ' ');
+    for (size_t i = 0; !quote && i < length; i++) {
+        char c = value[i];
+        quote = c == ',' || c == '"' || c == '\n' || c == '\r';
+    }
+    if (!quote) {
+        buffer_write(buffer, value, length);
+        return;
+    }
+
+    buffer_put(buffer, '"');
+    const char *end = value + length;
+    while (value < end) {
+        const char *mark = memchr(value, '"', (size_t)(end - value));
+        if (!mark) {
+            buffer_write(buffer, value, (size_t)(end - value));
+            break;
+        }
+        buffer_write(buffer, value, (size_t)(mark - value) + 1);
+        buffer_put(buffer, '"');
+        value = mark + 1;
+    }
+    buffer_put(buffer, '"');
+}
+
+static void write_csv_header(ExportBuffer *buffer, sqlite3_stmt *stmt) {
+    int columns = sqlite3_column_count(stmt);
+    for (int i = 0; i < columns; i++) {
+        const char *name = sqlite3_column_name(stmt, i);
+        if (i > 0) {
+            buffer_put(buffer, ',');
+        }
+        write_csv_value(buffer, name, strlen(name));
+    }
+    buffer_put(buffer, '\n');
+}
+
+static void write_csv_row(ExportBuffer *buffer, sqlite3_stmt *stmt, int columns) {
+    for (int i = 0; i < columns; i++) {
+        if (i > 0) {
+            buffer_put(buffer, ',');
+        }
+        if (sqlite3_column_type(stmt, i) != SQLITE_NULL) {
+            const char *value = (const char*)sqlite3_column_text(stmt, i);
+            write_csv_value(buffer, value, (size_t)sqlite3_column_bytes(stmt, i));
+        }
+    }
+    buffer_put(buffer, '\n');
+}
+
+// ---------------------------------------------------------------------------
+// NDJSON
+// ---------------------------------------------------------------------------
+
+static void write_json_string(ExportBuffer *buffer, const char *value, size_t length) {
+    static const char hex[] = "0123456789abcdef";
+    const char *end = value + length;
+    const char *run = value;
+
+    buffer_put(buffer, '"');
+    for (const char *p = value; p < end; p++) {
+        unsigned char c = (unsigned char)*p;
+        if (c >= 0x20 && c != '"' && c != '\\') {
+            continue;
+        }
+        // 이스케이프가 필요 없는 구간은 한 번에 복사
+        buffer_write(buffer, run, (size_t)(p - run));
+        run = p + 1;
+
+        char escaped[6] = { '\\', 0, 0, 0, 0, 0 };
+        size_t escaped_length = 2;
+        switch (c) {
+            case '"':  escaped[1] = '"'; break;
+            case '\\': escaped[1] = '\\'; break;
+            case '\n': escaped[1] = 'n'; break;
+            case '\r': escaped[1] = 'r'; break;
+            case '\t': escaped[1] = 't'; break;
+            default:
+                escaped[1] = 'u';
+                escaped[2] = '0';
+                escaped[3] = '0';
+                escaped[4] = hex[c >> 4];
+                escaped[5] = hex[c & 0x0F];
+                escaped_length = 6;
+                break;
+        }
+        buffer_write(buffer, escaped, escaped_length);
+    }
+    buffer_write(buffer, run, (size_t)(end - run));
+    buffer_put(buffer, '"');
+}
+
+static void write_json_row(ExportBuffer *buffer, sqlite3_stmt *stmt, int columns) {
+    buffer_put(buffer, '{');
+    for (int i = 0; i < columns; i++) {
+        const char *name = sqlite3_column_name(stmt, i);
+        if (i > 0) {
+            buffer_put(buffer, ',');
+        }
+        write_json_string(buffer, name, strlen(name));
+        buffer_put(buffer, ':');
+
+        switch (sqlite3_column_type(stmt, i)) {
+            case SQLITE_NULL:
+                buffer_write(buffer, "null", 4);
+                break;
+            case SQLITE_INTEGER:
+            case SQLITE_FLOAT: {
+                const char *value = (const char*)sqlite3_column_text(stmt, i);
+                buffer_write(buffer, value, (size_t)sqlite3_column_bytes(stmt, i));
+                break;
+            }
+            default: {
+                const char *value = (const char*)sqlite3_column_text(stmt, i);
+                write_json_string(buffer, value, (size_t)sqlite3_column_bytes(stmt, i));
+                break;
+            }
+        }
+    }
+    buffer_write(buffer, "}\n", 2);
+}
+
+// ---------------------------------------------------------------------------
+// Arrow IPC
+// ---------------------------------------------------------------------------
+
+// 분류 값을 정렬해 미리 모아 사전으로 지정 (행마다 이진 탐색으로 인덱스를 찾음)
+static int set_category_dictionary(sqlite3 *db, ArrowWriter *writer, int column) {
+    sqlite3_stmt *stmt = NULL;
+    if (database_prepare_statement(db, "SELECT DISTINCT category FROM books WHERE category IS NOT NULL "
+                                       "ORDER BY category;", &stmt) != SUCCESS) {
+        return FAILURE;
+    }
+
+    char **values = NULL;
+    int count = 0;
+    int capacity = 0;
+    int status = SUCCESS;
+    int rc;
+    while (status == SUCCESS && (rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+        if (count == capacity) {
+            capacity = capacity ? capacity * 2 : 64;
+            char **grown = realloc(values, sizeof(char*) * (size_t)capacity);
+            if (!grown) {
+                status = FAILURE;
+                break;
+            }
+            values = grown;
+        }
+        values[count] = strdup((const char*)sqlite3_column_text(stmt, 0));
+        if (!values[count]) {
+            status = FAILURE;
+            break;
+        }
+        count++;
+    }
+    if (status != SUCCESS) {
+        fprintf(stderr, "메모리 할당 실패\n");
+    } else if (rc != SQLITE_DONE) {
+        fprintf(stderr, "분류 조회 실패: %s\n", sqlite3_errmsg(db));
+        status = FAILURE;
+    }
+    sqlite3_finalize(stmt);
+
+    if (status == SUCCESS) {
+        status = arrow_writer_set_dictionary(writer, column, (const char *const *)values, count);
+    }
+    for (int i = 0; i < count; i++) {
+        free(values[i]);
+    }
+    free(values);
+    return status;
+}
+
+// 조회 결과를 열 묶음으로 모아 Arrow IPC 파일로 씀
+static int write_arrow(sqlite3 *db, DataExportEntity entity, sqlite3_stmt *stmt, FILE *output,
+                       long long *written) {
+    ArrowWriter writer;
+    if (arrow_writer_open(&writer, output, entities[entity].arrow_columns, entities[entity].arrow_column_count,
+                          ARROW_BATCH_ROWS) != SUCCESS) {
+        return FAILURE;
+    }
+
+    int status = SUCCESS;
+    for (int i = 0; status == SUCCESS && i < writer.column_count; i++) {
+        if (writer.columns[i].spec.type == ARROW_COLUMN_DICTIONARY) {
+            status = set_category_dictionary(db, &writer, i);
+        }
+    }
+
+    int rc = SQLITE_DONE;
+    while (status == SUCCESS && (rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+        status = arrow_writer_append_row(&writer, stmt);
+    }
+    if (status == SUCCESS && rc != SQLITE_DONE) {
+        fprintf(stderr, "내보내기 조회 실패: %s\n", sqlite3_errmsg(db));
+        status = FAILURE;
+    }
+    if (status == SUCCESS) {
+        status = arrow_writer_finish(&writer);
+    }
+    *written = writer.total_rows;
+    arrow_writer_free(&writer);
+    return status;
+}
+
+// ---------------------------------------------------------------------------
+// 공개 함수
+// ---------------------------------------------------------------------------
+
+// 'YYYY-MM-DD' 형식이고 실제 날짜인지 확인
+static int is_valid_filter_date(const char *date) {
+    if (strlen(date) != 10 || date[4] != '-' || date[7] != '-') {
+        return FALSE;
+    }
+    for (int i = 0; i < 10; i++) {
+        if (i != 4 && i != 7 && !isdigit((unsigned char)date[i])) {
+            return FALSE;
+        }
+    }
+    // mktime은 2025-13-01 같은 날짜도 다음 해로 넘겨 받아들이므로 되돌린 값과 비교
+    struct tm parsed = {0};
+    parsed.tm_year = atoi(date) - 1900;
+    parsed.tm_mon = atoi(date + 5) - 1;
+    parsed.tm_mday = atoi(date + 8);
+    parsed.tm_hour = 12;
+    parsed.tm_isdst = -1;
+    int month = parsed.tm_mon;
+    int day = parsed.tm_mday;
+    return mktime(&parsed) != (time_t)-1 && parsed.tm_mon == month && parsed.tm_mday == day;
+}
+
+int data_export(sqlite3 *db, const DataExportOptions *options, FILE *output, long long *rows) {
+    if (!db || !options || !output || (int)options->entity < 0 || (int)options->entity >= ENTITY_COUNT) {
+        fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
+        return FAILURE;
+    }
+    if (rows) {
+        *rows = 0;
+    }
+
+    int has_from = options->from_date[0] != '\0';
+    int has_to = options->to_date[0] != '\0';
+    if ((has_from && !is_valid_filter_date(options->from_date)) ||
+        (has_to && !is_valid_filter_date(options->to_date))) {
+        fprintf(stderr, "기간은 YYYY-MM-DD 형식이어야 합니다.\n");
+        return FAILURE;
+    }
+
+    // 날짜 열은 'YYYY-MM-DD HH:MM:SS' 문자열이므로 끝 날짜는 다음 날 0시 미만으로 비교
+    const char *date_column = entities[options->entity].date_column;
+    char where[160] = "";
+    if (has_from && has_to) {
+        snprintf(where, sizeof(where), " WHERE %s >= ?1 AND %s < date(?2, '+1 day')", date_column, date_column);
+    } else if (has_from) {
+        snprintf(where, sizeof(where), " WHERE %s >= ?1", date_column);
+    } else if (has_to) {
+        snprintf(where, sizeof(where), " WHERE %s < date(?2, '+1 day')", date_column);
+    }
+
+    char sql[1024];
+    snprintf(sql, sizeof(sql), "%s%s ORDER BY %s;", entities[options->entity].select, where,
+             has_from || has_to ? entities[options->entity].range_order : entities[options->entity].id_order);
+
+    sqlite3_stmt *stmt = NULL;
+    if (database_prepare_statement(db, sql, &stmt) != SUCCESS) {
+        return FAILURE;
+    }
+    if (has_from) {
+        sqlite3_bind_text(stmt, 1, options->from_date, -1, SQLITE_STATIC);
+    }
+    if (has_to) {
+        sqlite3_bind_text(stmt, 2, options->to_date, -1, SQLITE_STATIC);
+    }
+
+    long long written = 0;
+    if (options->format == DATA_EXPORT_ARROW) {
+        // 사전 조회와 본 조회가 같은 시점의 데이터를 보도록 읽기 트랜잭션으로 묶음
+        int own_transaction = sqlite3_get_autocommit(db) && database_begin_transaction(db) == SUCCESS;
+        int status = write_arrow(db, options->entity, stmt, output, &written);
+        sqlite3_finalize(stmt);
+        if (own_transaction) {
+            database_commit_transaction(db);
+        }
+        if (status == SUCCESS && fflush(output) != 0) {
+            fprintf(stderr, "내보내기 출력 쓰기 실패\n");
+            status = FAILURE;
+        }
+        if (rows) {
+            *rows = written;
+        }
+        return status;
+    }
+
+    ExportBuffer buffer;
+    memset(&buffer, 0, sizeof(ExportBuffer));
+    buffer.output = output;
+    buffer.data = malloc(DATA_EXPORT_BUFFER_SIZE);
+    if (!buffer.data) {
+        fprintf(stderr, "메모리 할당 실패\n");
+        sqlite3_finalize(stmt);
+        return FAILURE;
+    }
+
+    int columns = sqlite3_column_count(stmt);
+    int rc = SQLITE_DONE;
+    if (options->format == DATA_EXPORT_CSV) {
+        write_csv_header(&buffer, stmt);
+    }
+    while (!buffer.error && (rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+        if (options->format == DATA_EXPORT_CSV) {
+            write_csv_row(&buffer, stmt, columns);
+        } else {
+            write_json_row(&buffer, stmt, columns);
+        }
+        written++;
+    }
+    buffer_flush(&buffer);
+
+    int status = SUCCESS;
+    if (buffer.error || fflush(output) != 0) {
+        fprintf(stderr, "내보내기 출력 쓰기 실패\n");
+        status = FAILURE;
+    } else if (rc != SQLITE_DONE) {
+        fprintf(stderr, "내보내기 조회 실패: %s\n", sqlite3_errmsg(db));
+        status = FAILURE;
+    }
+
+    free(buffer.data);
+    sqlite3_finalize(stmt);
+    if (rows) {
+        *rows = written;
+    }
+    return status;
+}
+
+int data_export_to_path(sqlite3 *db, const DataExportOptions *options, const char *path, long long *rows) {
+    if (!path) {
+        fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
+        return FAILURE;
+    }
+    if (strcmp(path, "-") == 0) {
+        return data_export(db, options, stdout, rows);
+    }
+
+    FILE *output = fopen(path, "wb");
+    if (!output) {
+        fprintf(stderr, "내보낼 파일을 열 수 없습니다: %s\n", path);
+        return FAILURE;
+    }
+    // CSV/NDJSON은 자체 버퍼로 모아 쓰므로 stdio 버퍼는 거치지 않음 (Arrow는 작은 메타데이터 쓰기가 많아 그대로 둠)
+    if (options && options->format != DATA_EXPORT_ARROW) {
+        setvbuf(output, NULL, _IONBF, 0);
+    }
+
+    int status = data_export(db, options, output, rows);
+    if (fclose(output) != 0) {
+        fprintf(stderr, "내보낼 파일을 닫을 수 없습니다: %s\n", path);
+        status = FAILURE;
+    }
+    return status;
+}
+
+int data_export_snapshot(sqlite3 *db, DataExportFormat format, const char *directory, long long *rows) {
+    static const char *const extensions[] = {
+        [DATA_EXPORT_CSV] = "csv", [DATA_EXPORT_NDJSON] = "ndjson", [DATA_EXPORT_ARROW] = "arrow"
+    };
+    static const DataExportEntity snapshot_entities[] = {
+        DATA_EXPORT_BOOKS, DATA_EXPORT_MEMBERS, DATA_EXPORT_LOANS
+    };
+
+    if (!db || !directory || (int)format < 0 || (int)format > DATA_EXPORT_ARROW) {
+        fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
+        return FAILURE;
+    }
+    if (rows) {
+        *rows = 0;
+    }
+    if (create_directory_if_not_exists(directory) != SUCCESS) {
+        fprintf(stderr, "내보낼 디렉터리를 만들 수 없습니다: %s\n", directory);
+        return FAILURE;
+    }
+
+    // 세 파일이 같은 시점의 데이터가 되도록 하나의 읽기 트랜잭션에서 씀
+    int own_transaction = sqlite3_get_autocommit(db);
+    if (own_transaction && database_begin_transaction(db) != SUCCESS) {
+        return FAILURE;
+    }
+
+    int status = SUCCESS;
+    int count = (int)(sizeof(snapshot_entities) / sizeof(snapshot_entities[0]));
+    for (int i = 0; status == SUCCESS && i < count; i++) {
+        DataExportOptions options;
+        memset(&options, 0, sizeof(DataExportOptions));
+        options.entity = snapshot_entities[i];
+        options.format = format;
+
+        char path[MAX_PATH_LENGTH];
+        if (snprintf(path, sizeof(path), "%s/%s.%s", directory, entities[options.entity].name,
+                     extensions[format]) >= (int)sizeof(path)) {
+            fprintf(stderr, "경로가 너무 깁니다: %s\n", directory);
+            status = FAILURE;
+            break;
+        }
+
+        long long written = 0;
+        status = data_export_to_path(db, &options, path, &written);
+        if (rows) {
+            *rows += written;
+        }
+    }
+
+    if (own_transaction) {
+        database_commit_transaction(db);
+    }
+    return status;
+}
@@ -4,6 +4,42 @@
 #include <sqlite3.h>
 #include "../include/database.h"
 #include "../include/constants.h"
+#include "../include/hangul.h"
+#include "../include/query_profiler.h"
+#include "../include/backup.h"
+#include "../include/change_log.h"
+
+// 잠금 대기 재시도 누적 횟수 (모든 연결 합계)
+static long long busy_retry_count = 0;
+
+// SQLITE_BUSY 발생 시 지수 백오프로 대기 후 재시도 (0을 반환하면 재시도 중단)
+static int database_busy_handler(void *user_data, int attempt) {
+    DatabaseBusyStats *stats = (DatabaseBusyStats*)user_data;
+    
+    if (attempt >= DATABASE_BUSY_MAX_RETRIES) {
+        if (stats) {
+            stats->timeouts++;
+        }
+        return 0;
+    }
+    
+    if (stats) {
+        stats->retries++;
+    }
+    
+    int delay_ms = DATABASE_BUSY_BASE_DELAY_MS << (attempt < 16 ? attempt : 16);
+    if (delay_ms > DATABASE_BUSY_MAX_DELAY_MS) {
+        delay_ms = DATABASE_BUSY_MAX_DELAY_MS;
+    }
+    
+    sqlite3_mutex *mutex = sqlite3_mutex_alloc(SQLITE_MUTEX_STATIC_APP2);
+    sqlite3_mutex_enter(mutex);
+    busy_retry_count++;
+    sqlite3_mutex_leave(mutex);
+    
+    sqlite3_sleep(delay_ms);
+    return 1;
+}
 
 sqlite3* database_init(const char *db_path) {
     sqlite3 *db = NULL;
@@ -20,6 +56,20 @@ sqlite3* database_init(const char *db_path) {
     // 외래키 제약 조건 활성화
     database_execute_query(db, "PRAGMA foreign_keys = ON;");
     
+    // 다른 프로세스가 잠금을 잡고 있으면 바로 실패하지 않고 재시도
+    sqlite3_busy_handler(db, database_busy_handler, NULL);
+    
+    // 검색 컬럼 생성에 쓰이는 한글 정규화 함수 등록
+    if (hangul_register_functions(db) != SUCCESS) {
+        sqlite3_close(db);
+        return NULL;
+    }
+    
+    // 설정된 경우 SQL 문장별 실행 통계 수집 (시작 시 변환 작업도 포함)
+    if (query_profiler_is_enabled()) {
+        query_profiler_attach(db);
+    }
+    
     // 테이블 생성
     if (database_create_tables(db) != SUCCESS) {
         fprintf(stderr, "테이블 생성 실패\n");
@@ -36,6 +86,318 @@ void database_close(sqlite3 *db) {
     }
 }
 
+// 회원 테이블 컬럼 정의 (이메일 비교 규칙 변경 시 테이블 재생성에도 사용)
+// 이메일은 NOCASE 비교 규칙의 UNIQUE 제약 하나로 고유성 보장과 조회를 함께 처리
+#define MEMBERS_TABLE_COLUMNS \
+    "id INTEGER PRIMARY KEY AUTOINCREMENT," \
+    "name TEXT NOT NULL," \
+    "email TEXT NOT NULL COLLATE NOCASE UNIQUE," \
+    "phone TEXT," \
+    "address TEXT," \
+    "registration_date TIMESTAMP DEFAULT CURRENT_TIMESTAMP," \
+    "is_active INTEGER DEFAULT 1," \
+    "name_norm TEXT," \
+    "name_chosung TEXT," \
+    "phone_digits TEXT," \
+    "phone_digits_reversed TEXT," \
+    "created_at TIMESTAMP DEFAULT CURRENT_TIMESTAMP," \
+    "updated_at TIMESTAMP DEFAULT CURRENT_TIMESTAMP"
+
+#define MEMBERS_COLUMN_LIST \
+    "id, name, email, phone, address, registration_date, is_active, name_norm, name_chosung, " \
+    "phone_digits, phone_digits_reversed, created_at, updated_at"
+
+// 도서/회원 검색 컬럼 추가 및 기존 행 채우기 (컬럼을 새로 추가한 경우에만 채움)
+static int database_add_search_columns(sqlite3 *db) {
+    const char *book_columns[] = { "title_norm", "title_chosung", "author_norm", "author_chosung", NULL };
+    const char *member_columns[] = { "name_norm", "name_chosung", NULL };
+    int books_added = 0;
+    int members_added = 0;
+    
+    for (int i = 0; book_columns[i] != NULL; i++) {
+        int added = database_add_column_if_missing(db, TABLE_BOOKS, book_columns[i], "TEXT");
+        if (added == FAILURE) {
+            return FAILURE;
+        }
+        books_added += added;
+    }
+    
+    for (int i = 0; member_columns[i] != NULL; i++) {
+        int added = database_add_column_if_missing(db, TABLE_MEMBERS, member_columns[i], "TEXT");
+        if (added == FAILURE) {
+            return FAILURE;
+        }
+        members_added += added;
+    }
+    
+    // 전화번호 검색 컬럼은 backfill_member_phone_digits()가 나누어 채움
+    if (database_add_column_if_missing(db, TABLE_MEMBERS, "phone_digits", "TEXT") == FAILURE ||
+        database_add_column_if_missing(db, TABLE_MEMBERS, "phone_digits_reversed", "TEXT") == FAILURE) {
+        return FAILURE;
+    }
+    
+    if (books_added > 0 &&
+        database_execute_query(db,
+            "UPDATE books SET title_norm = hangul_normalize(title), "
+            "title_chosung = hangul_chosung(title), "
+            "author_norm = hangul_normalize(author), "
+            "author_chosung = hangul_chosung(author);") != SUCCESS) {
+        return FAILURE;
+    }
+    
+    if (members_added > 0 &&
+        database_execute_query(db,
+            "UPDATE members SET name_norm = hangul_normalize(name), "
+            "name_chosung = hangul_chosung(name);") != SUCCESS) {
+        return FAILURE;
+    }
+    
+    return SUCCESS;
+}
+
+// 대소문자만 다른 중복 이메일을 찾아 보고 (중복 그룹 수 반환)
+static int database_report_email_conflicts(sqlite3 *db) {
+    const char *sql = 
+        "SELECT lower(trim(email)), COUNT(*), group_concat(id, ', ') FROM members "
+        "GROUP BY lower(trim(email)) HAVING COUNT(*) > 1 ORDER BY 1;";
+    sqlite3_stmt *stmt = NULL;
+    int conflict_count = 0;
+    int step_result;
+    
+    if (database_prepare_statement(db, sql, &stmt) != SUCCESS) {
+        return FAILURE;
+    }
+    
+    while ((step_result = sqlite3_step(stmt)) == SQLITE_ROW) {
+        fprintf(stderr, "중복 이메일: %s (%d명, 회원 ID: %s)\n",
+                (const char*)sqlite3_column_text(stmt, 0),
+                sqlite3_column_int(stmt, 1),
+                (const char*)sqlite3_column_text(stmt, 2));
+        conflict_count++;
+    }
+    
+    if (step_result != SQLITE_DONE) {
+        fprintf(stderr, "중복 이메일 조회 실패: %s\n", sqlite3_errmsg(db));
+        conflict_count = FAILURE;
+    }
+    
+    sqlite3_finalize(stmt);
+    return conflict_count;
+}
+
+// 이메일 UNIQUE 제약이 NOCASE 비교 규칙을 쓰는지 확인
+static int database_member_email_is_nocase(sqlite3 *db) {
+    const char *sql = 
+        "SELECT COUNT(*) FROM pragma_index_list('members') AS il "
+        "JOIN pragma_index_xinfo(il.name) AS ix "
+        "WHERE il.\"unique\" = 1 AND ix.key = 1 AND ix.name = 'email' AND ix.coll = 'NOCASE' "
+        "AND (SELECT COUNT(*) FROM pragma_index_info(il.name)) = 1;";
+    sqlite3_stmt *stmt = NULL;
+    int result = FAILURE;
+    
+    if (database_prepare_statement(db, sql, &stmt) != SUCCESS) {
+        return FAILURE;
+    }
+    
+    if (sqlite3_step(stmt) == SQLITE_ROW) {
+        result = sqlite3_column_int(stmt, 0) > 0 ? TRUE : FALSE;
+    } else {
+        fprintf(stderr, "회원 테이블 구조 조회 실패: %s\n", sqlite3_errmsg(db));
+    }
+    
+    sqlite3_finalize(stmt);
+    return result;
+}
+
+int database_migrate_member_email(sqlite3 *db) {
+    if (!db) {
+        fprintf(stderr, "유효하지 않은 데이터베이스 연결입니다.\n");
+        return FAILURE;
+    }
+    
+    int is_nocase = database_member_email_is_nocase(db);
+    if (is_nocase != FALSE) {
+        return is_nocase == TRUE ? 0 : FAILURE;
+    }
+    
+    // 대소문자만 다른 중복이 있으면 정리될 때까지 기존 구조를 유지
+    int conflict_count = database_report_email_conflicts(db);
+    if (conflict_count != 0) {
+        if (conflict_count > 0) {
+            fprintf(stderr, "중복 이메일 %d건을 정리해야 이메일 고유 제약을 대소문자 구분 없이 적용할 수 있습니다.\n",
+                    conflict_count);
+        }
+        return conflict_count;
+    }
+    
+    // 컬럼 비교 규칙은 ALTER로 바꿀 수 없으므로 테이블을 새로 만들어 옮김
+    // 기존 테이블 삭제 시 대출 등이 연쇄 삭제되지 않도록 외래키 검사를 잠시 끔
+    // 삭제된 회원 ID가 다시 쓰이지 않도록 AUTOINCREMENT 최댓값(sqlite_sequence)도 새 테이블로 옮김
+    const char *rebuild_statements[] = {
+        "CREATE TABLE members_rebuild (" MEMBERS_TABLE_COLUMNS ");",
+        "INSERT INTO members_rebuild (" MEMBERS_COLUMN_LIST ") "
+        "SELECT id, name, lower(trim(email)), phone, address, registration_date, is_active, "
+        "name_norm, name_chosung, phone_digits, phone_digits_reversed, created_at, updated_at "
+        "FROM members;",
+        "DELETE FROM sqlite_sequence WHERE name = 'members_rebuild' "
+        "AND EXISTS (SELECT 1 FROM sqlite_sequence WHERE name = 'members');",
+        "INSERT INTO sqlite_sequence (name, seq) SELECT 'members_rebuild', seq FROM sqlite_sequence "
+        "WHERE name = 'members';",
+        "DROP TABLE members;",
+        "ALTER TABLE members_rebuild RENAME TO members;",
+        NULL
+    };
+    
+    if (database_execute_query(db, "PRAGMA foreign_keys = OFF;") != SUCCESS) {
+        return FAILURE;
+    }
+    
+    int status = database_begin_immediate_transaction(db);
+    
+    for (int i = 0; status == SUCCESS && rebuild_statements[i] != NULL; i++) {
+        status = database_execute_query(db, rebuild_statements[i]);
+    }
+    
+    if (status == SUCCESS) {
+        status = database_commit_transaction(db);
+    }
+    
+    if (status != SUCCESS) {
+        database_rollback_transaction(db);
+    }
+    
+    database_execute_query(db, "PRAGMA foreign_keys = ON;");
+    return status == SUCCESS ? 0 : FAILURE;
+}
+
+int database_add_column_if_missing(sqlite3 *db, const char *table, const char *column, const char *definition) {
+    if (!db || !table || !column || !definition) {
+        fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
+        return FAILURE;
+    }
+    
+    const char *sql = "SELECT COUNT(*) FROM pragma_table_info(?) WHERE name = ?;";
+    sqlite3_stmt *stmt = NULL;
+    int exists = 0;
+    
+    if (database_prepare_statement(db, sql, &stmt) != SUCCESS) {
+        return FAILURE;
+    }
+    
+    sqlite3_bind_text(stmt, 1, table, -1, SQLITE_STATIC);
+    sqlite3_bind_text(stmt, 2, column, -1, SQLITE_STATIC);
+    
+    if (sqlite3_step(stmt) != SQLITE_ROW) {
+        fprintf(stderr, "테이블 구조 조회 실패: %s\n", sqlite3_errmsg(db));
+        sqlite3_finalize(stmt);
+        return FAILURE;
+    }
+    
+    exists = sqlite3_column_int(stmt, 0);
+    sqlite3_finalize(stmt);
+    
+    if (exists) {
+        return 0;
+    }
+    
+    char alter_sql[MAX_SQL_LENGTH];
+    snprintf(alter_sql, sizeof(alter_sql), "ALTER TABLE %s ADD COLUMN %s %s;", table, column, definition);
+    
+    if (database_execute_query(db, alter_sql) != SUCCESS) {
+        return FAILURE;
+    }
+    
+    return 1;
+}
+
+// 도서 검색 색인을 books와 맞추는 트리거 (검색 컬럼이 바뀔 때만 동작하므로 대출/반납에는 영향 없음)
+static const char *book_search_triggers[] = {
+    "CREATE TRIGGER IF NOT EXISTS trg_books_search_insert AFTER INSERT ON books BEGIN "
+    "INSERT INTO books_search (rowid, title_norm, title_chosung, author_norm, author_chosung) "
+    "VALUES (new.id, new.title_norm, new.title_chosung, new.author_norm, new.author_chosung); END;",
+    "CREATE TRIGGER IF NOT EXISTS trg_books_search_delete AFTER DELETE ON books BEGIN "
+    "INSERT INTO books_search (books_search, rowid, title_norm, title_chosung, author_norm, author_chosung) "
+    "VALUES ('delete', old.id, old.title_norm, old.title_chosung, old.author_norm, old.author_chosung); END;",
+    "CREATE TRIGGER IF NOT EXISTS trg_books_search_update "
+    "AFTER UPDATE OF id, title_norm, title_chosung, author_norm, author_chosung ON books BEGIN "
+    "INSERT INTO books_search (books_search, rowid, title_norm, title_chosung, author_norm, author_chosung) "
+    "VALUES ('delete', old.id, old.title_norm, old.title_chosung, old.author_norm, old.author_chosung); "
+    "INSERT INTO books_search (rowid, title_norm, title_chosung, author_norm, author_chosung) "
+    "VALUES (new.id, new.title_norm, new.title_chosung, new.author_norm, new.author_chosung); END;",
+    NULL
+};
+
+// sqlite_master에서 종류가 같고 이름이 LIKE 패턴에 맞는 항목 수 (실패 시 FAILURE)
+static int database_count_schema_objects(sqlite3 *db, const char *type, const char *name_pattern) {
+    const char *sql = "SELECT COUNT(*) FROM sqlite_master WHERE type = ? AND name LIKE ? ESCAPE '\\';";
+    sqlite3_stmt *stmt = NULL;
+    int count = FAILURE;
+    
+    if (database_prepare_statement(db, sql, &stmt) != SUCCESS) {
+        return FAILURE;
+    }
+    
+    sqlite3_bind_text(stmt, 1, type, -1, SQLITE_STATIC);
+    sqlite3_bind_text(stmt, 2, name_pattern, -1, SQLITE_STATIC);
+    if (sqlite3_step(stmt) == SQLITE_ROW) {
+        count = sqlite3_column_int(stmt, 0);
+    }
+    
+    sqlite3_finalize(stmt);
+    return count;
+}
+
+int database_create_book_search_index(sqlite3 *db) {
+    if (!db) {
+        fprintf(stderr, "유효하지 않은 데이터베이스 연결입니다.\n");
+        return FAILURE;
+    }
+    
+    int table_count = database_count_schema_objects(db, "table", "books\\_search");
+    if (table_count == FAILURE) {
+        return FAILURE;
+    }
+    
+    // FTS5나 trigram 토크나이저가 없는 SQLite이면 만들지 않음 (검색은 검색 컬럼을 훑어서 처리)
+    if (table_count == 0 &&
+        sqlite3_exec(db,
+            "CREATE VIRTUAL TABLE books_search USING fts5("
+            "title_norm, title_chosung, author_norm, author_chosung, "
+            "content = 'books', content_rowid = 'id', tokenize = 'trigram');",
+            NULL, NULL, NULL) != SQLITE_OK) {
+        return SUCCESS;
+    }
+    
+    int trigger_count = database_count_schema_objects(db, "trigger", "trg\\_books\\_search\\_%");
+    if (trigger_count == FAILURE) {
+        return FAILURE;
+    }
+    if (trigger_count == (int)(sizeof(book_search_triggers) / sizeof(book_search_triggers[0])) - 1) {
+        return SUCCESS;
+    }
+    
+    // 새로 만들었거나 트리거를 잠시 지운 동안 바뀐 도서가 있을 수 있으므로 색인을 다시 만듦
+    for (int i = 0; book_search_triggers[i] != NULL; i++) {
+        if (database_execute_query(db, book_search_triggers[i]) != SUCCESS) {
+            return FAILURE;
+        }
+    }
+    
+    return database_execute_query(db, "INSERT INTO books_search (books_search) VALUES ('rebuild');");
+}
+
+int database_pause_book_search_index(sqlite3 *db) {
+    if (!db) {
+        fprintf(stderr, "유효하지 않은 데이터베이스 연결입니다.\n");
+        return FAILURE;
+    }
+    
+    return database_execute_query(db,
+        "DROP TRIGGER IF EXISTS trg_books_search_insert;"
+        "DROP TRIGGER IF EXISTS trg_books_search_delete;"
+        "DROP TRIGGER IF EXISTS trg_books_search_update;");
+}
+
 int database_create_tables(sqlite3 *db) {
     if (!db) {
         fprintf(stderr, "유효하지 않은 데이터베이스 연결입니다.\n");
@@ -54,6 +416,10 @@ int database_create_tables(sqlite3 *db) {
         "total_copies INTEGER DEFAULT 1,"
         "available_copies INTEGER DEFAULT 1,"
         "category TEXT,"
+        "title_norm TEXT,"
+        "title_chosung TEXT,"
+        "author_norm TEXT,"
+        "author_chosung TEXT,"
         "created_at TIMESTAMP DEFAULT CURRENT_TIMESTAMP,"
         "updated_at TIMESTAMP DEFAULT CURRENT_TIMESTAMP"
         ");";
@@ -64,17 +430,7 @@ int database_create_tables(sqlite3 *db) {
     
     // 회원 테이블 생성
     const char *create_members_table = 
-        "CREATE TABLE IF NOT EXISTS members ("
-        "id INTEGER PRIMARY KEY AUTOINCREMENT,"
-        "name TEXT NOT NULL,"
-        "email TEXT UNIQUE NOT NULL,"
-        "phone TEXT,"
-        "address TEXT,"
-        "registration_date TIMESTAMP DEFAULT CURRENT_TIMESTAMP,"
-        "is_active INTEGER DEFAULT 1,"
-        "created_at TIMESTAMP DEFAULT CURRENT_TIMESTAMP,"
-        "updated_at TIMESTAMP DEFAULT CURRENT_TIMESTAMP"
-        ");";
+        "CREATE TABLE IF NOT EXISTS members (" MEMBERS_TABLE_COLUMNS ");";
     
     if (database_execute_query(db, create_members_table) != SUCCESS) {
         return FAILURE;
@@ -101,15 +457,164 @@ int database_create_tables(sqlite3 *db) {
         return FAILURE;
     }
     
+    // 휴관일 테이블 생성 (closure_date: 'YYYY-MM-DD')
+    const char *create_closures_table = 
+        "CREATE TABLE IF NOT EXISTS library_closures ("
+        "closure_date TEXT PRIMARY KEY,"
+        "reason TEXT,"
+        "created_at TIMESTAMP DEFAULT CURRENT_TIMESTAMP"
+        ") WITHOUT ROWID;";
+    
+    if (database_execute_query(db, create_closures_table) != SUCCESS) {
+        return FAILURE;
+    }
+    
+    // 연체료 정책 테이블 생성 (카테고리별 일일 연체료와 상한액, 단위: 원)
+    const char *create_fee_policies_table = 
+        "CREATE TABLE IF NOT EXISTS fee_policies ("
+        "category TEXT PRIMARY KEY,"
+        "daily_rate INTEGER NOT NULL CHECK (daily_rate >= 0),"
+        "max_fine INTEGER NOT NULL CHECK (max_fine >= 0),"
+        "updated_at TIMESTAMP DEFAULT CURRENT_TIMESTAMP"
+        ") WITHOUT ROWID;";
+    
+    if (database_execute_query(db, create_fee_policies_table) != SUCCESS) {
+        return FAILURE;
+    }
+    
+    // 대출별 연체료 원장 테이블 생성 (마지막 정산 시점 기준 금액)
+    const char *create_loan_fines_table = 
+        "CREATE TABLE IF NOT EXISTS loan_fines ("
+        "loan_id INTEGER PRIMARY KEY,"
+        "member_id INTEGER NOT NULL,"
+        "overdue_days INTEGER NOT NULL DEFAULT 0,"
+        "amount INTEGER NOT NULL DEFAULT 0,"
+        "accrued_at TIMESTAMP NOT NULL,"
+        "FOREIGN KEY (loan_id) REFERENCES loans(id) ON DELETE CASCADE"
+        ");";
+    
+    if (database_execute_query(db, create_loan_fines_table) != SUCCESS) {
+        return FAILURE;
+    }
+    
+    // 연체료 납부 이력 테이블 생성
+    const char *create_fine_payments_table = 
+        "CREATE TABLE IF NOT EXISTS fine_payments ("
+        "id INTEGER PRIMARY KEY AUTOINCREMENT,"
+        "member_id INTEGER NOT NULL,"
+        "amount INTEGER NOT NULL CHECK (amount > 0),"
+        "paid_at TIMESTAMP DEFAULT CURRENT_TIMESTAMP,"
+        "FOREIGN KEY (member_id) REFERENCES members(id) ON DELETE CASCADE"
+        ");";
+    
+    if (database_execute_query(db, create_fine_payments_table) != SUCCESS) {
+        return FAILURE;
+    }
+    
+    // 회원별 미납 잔액 테이블 생성 (정산/납부 시 증분 갱신)
+    const char *create_member_balances_table = 
+        "CREATE TABLE IF NOT EXISTS member_balances ("
+        "member_id INTEGER PRIMARY KEY,"
+        "balance INTEGER NOT NULL DEFAULT 0,"
+        "updated_at TIMESTAMP DEFAULT CURRENT_TIMESTAMP,"
+        "FOREIGN KEY (member_id) REFERENCES members(id) ON DELETE CASCADE"
+        ");";
+    
+    if (database_execute_query(db, create_member_balances_table) != SUCCESS) {
+        return FAILURE;
+    }
+    
+    // 대출 이벤트 로그 테이블 생성 (추가 전용, 정수 코드 행 형식)
+    // event_type: 1=대출, 2=반납, 3=연장, 4=반납일 조정 / arg: 이벤트 직후 반납 예정 유닉스 시각
+    const char *create_loan_events_table = 
+        "CREATE TABLE IF NOT EXISTS loan_events ("
+        "seq INTEGER PRIMARY KEY,"
+        "event_time INTEGER NOT NULL,"
+        "event_type INTEGER NOT NULL,"
+        "loan_id INTEGER NOT NULL,"
+        "book_id INTEGER NOT NULL,"
+        "member_id INTEGER NOT NULL,"
+        "arg INTEGER NOT NULL DEFAULT 0"
+        ");"
+        "CREATE TRIGGER IF NOT EXISTS trg_loan_events_no_update BEFORE UPDATE ON loan_events "
+        "BEGIN SELECT RAISE(ABORT, 'loan_events is append-only'); END;"
+        "CREATE TRIGGER IF NOT EXISTS trg_loan_events_no_delete BEFORE DELETE ON loan_events "
+        "BEGIN SELECT RAISE(ABORT, 'loan_events is append-only'); END;";
+    
+    if (database_execute_query(db, create_loan_events_table) != SUCCESS) {
+        return FAILURE;
+    }
+    
+    // 이벤트 소비자별 처리 위치(high-water mark) 테이블 생성
+    const char *create_event_cursors_table = 
+        "CREATE TABLE IF NOT EXISTS loan_event_cursors ("
+        "consumer TEXT PRIMARY KEY,"
+        "last_seq INTEGER NOT NULL DEFAULT 0,"
+        "updated_at TIMESTAMP DEFAULT CURRENT_TIMESTAMP"
+        ") WITHOUT ROWID;";
+    
+    if (database_execute_query(db, create_event_cursors_table) != SUCCESS) {
+        return FAILURE;
+    }
+    
+    // 클라이언트 요청 ID 중복 처리 방지 테이블 생성 (created_at: 유닉스 시각)
+    const char *create_request_dedupe_table = 
+        "CREATE TABLE IF NOT EXISTS request_dedupe ("
+        "request_id TEXT PRIMARY KEY,"
+        "operation TEXT NOT NULL,"
+        "result INTEGER NOT NULL,"
+        "created_at INTEGER NOT NULL"
+        ") WITHOUT ROWID;";
+    
+    if (database_execute_query(db, create_request_dedupe_table) != SUCCESS) {
+        return FAILURE;
+    }
+    
+    // 도서 일괄 가져오기 체크포인트 테이블 생성 (원본 파일별 마지막으로 커밋한 위치)
+    const char *create_import_checkpoints_table = 
+        "CREATE TABLE IF NOT EXISTS book_import_checkpoints ("
+        "source TEXT PRIMARY KEY,"
+        "file_size INTEGER NOT NULL,"
+        "byte_offset INTEGER NOT NULL,"
+        "line_number INTEGER NOT NULL,"
+        "completed INTEGER NOT NULL DEFAULT 0,"
+        "updated_at TIMESTAMP DEFAULT CURRENT_TIMESTAMP"
+        ") WITHOUT ROWID;";
+    
+    if (database_execute_query(db, create_import_checkpoints_table) != SUCCESS) {
+        return FAILURE;
+    }
+    
+    // 검색 컬럼이 없던 기존 데이터베이스는 컬럼을 추가하고 한 번만 채움
+    if (database_add_search_columns(db) != SUCCESS) {
+        return FAILURE;
+    }
+    
+    // 대소문자를 구분하던 기존 이메일 제약을 NOCASE로 변경 (중복이 있으면 보고만 하고 유지)
+    if (database_migrate_member_email(db) == FAILURE) {
+        return FAILURE;
+    }
+    
     // 인덱스 생성
     const char *create_indexes[] = {
         "CREATE INDEX IF NOT EXISTS idx_books_title ON books(title);",
         "CREATE INDEX IF NOT EXISTS idx_books_author ON books(author);",
         "CREATE INDEX IF NOT EXISTS idx_books_isbn ON books(isbn);",
-        "CREATE INDEX IF NOT EXISTS idx_members_email ON members(email);",
+        "DROP INDEX IF EXISTS idx_members_email;",
+        "CREATE INDEX IF NOT EXISTS idx_members_name_norm ON members(name_norm);",
+        "CREATE INDEX IF NOT EXISTS idx_members_name_chosung ON members(name_chosung);",
+        "CREATE INDEX IF NOT EXISTS idx_members_phone_reversed ON members(phone_digits_reversed);",
+        "CREATE INDEX IF NOT EXISTS idx_members_phone_pending ON members(id) WHERE phone_digits IS NULL;",
         "CREATE INDEX IF NOT EXISTS idx_loans_book_id ON loans(book_id);",
         "CREATE INDEX IF NOT EXISTS idx_loans_member_id ON loans(member_id);",
         "CREATE INDEX IF NOT EXISTS idx_loans_return_date ON loans(return_date);",
+        "CREATE INDEX IF NOT EXISTS idx_loans_open_due_date ON loans(due_date) WHERE is_returned = 0;",
+        "CREATE INDEX IF NOT EXISTS idx_loans_loan_date ON loans(loan_date);",
+        "CREATE INDEX IF NOT EXISTS idx_loan_fines_member_id ON loan_fines(member_id);",
+        "CREATE INDEX IF NOT EXISTS idx_fine_payments_member_id ON fine_payments(member_id);",
+        "CREATE INDEX IF NOT EXISTS idx_loan_events_loan_id ON loan_events(loan_id);",
+        "CREATE INDEX IF NOT EXISTS idx_loan_events_time ON loan_events(event_time);",
+        "CREATE INDEX IF NOT EXISTS idx_request_dedupe_created_at ON request_dedupe(created_at);",
         NULL
     };
     
@@ -119,6 +624,16 @@ int database_create_tables(sqlite3 *db) {
         }
     }
     
+    // 도서 제목/저자 부분 검색용 trigram 색인
+    if (database_create_book_search_index(db) != SUCCESS) {
+        return FAILURE;
+    }
+    
+    // 변경 기록이 켜져 있으면 새로 생긴 테이블과 컬럼도 기록하도록 트리거를 맞춤
+    if (change_log_refresh_triggers(db) != SUCCESS) {
+        return FAILURE;
+    }
+    
     return SUCCESS;
 }
 
@@ -131,6 +646,35 @@ int database_begin_transaction(sqlite3 *db) {
     return database_execute_query(db, "BEGIN TRANSACTION;");
 }
 
+int database_begin_immediate_transaction(sqlite3 *db) {
+    if (!db) {
+        fprintf(stderr, "유효하지 않은 데이터베이스 연결입니다.\n");
+        return FAILURE;
+    }
+    
+    return database_execute_query(db, "BEGIN IMMEDIATE TRANSACTION;");
+}
+
+long long database_get_busy_retry_count(void) {
+    sqlite3_mutex *mutex = sqlite3_mutex_alloc(SQLITE_MUTEX_STATIC_APP2);
+    
+    sqlite3_mutex_enter(mutex);
+    long long count = busy_retry_count;
+    sqlite3_mutex_leave(mutex);
+    
+    return count;
+}
+
+int database_track_busy(sqlite3 *db, DatabaseBusyStats *stats) {
+    if (!db) {
+        fprintf(stderr, "유효하지 않은 데이터베이스 연결입니다.\n");
+        return FAILURE;
+    }
+    
+    // 같은 처리기를 통계 구조체와 함께 다시 등록 (재시도 방식은 그대로)
+    return sqlite3_busy_handler(db, database_busy_handler, stats) == SQLITE_OK ? SUCCESS : FAILURE;
+}
+
 int database_commit_transaction(sqlite3 *db) {
     if (!db) {
         fprintf(stderr, "유효하지 않은 데이터베이스 연결입니다.\n");
@@ -221,6 +765,11 @@ cleanup:
         sqlite3_close(backup_db);
     }
     
+    // 파일을 닫은 뒤 페이지별 체크섬 목록을 남김 (복원할 때 검사)
+    if (result == SUCCESS) {
+        result = backup_write_checksums(backup_path);
+    }
+    
     return result;
 }
 
@@ -230,6 +779,18 @@ int database_restore(sqlite3 *db, const char *backup_path) {
         return FAILURE;
     }
     
+    // 체크섬 목록이 있는 백업은 덮어쓰기 전에 손상 여부를 먼저 검사
+    char checksum_path[MAX_PATH_LENGTH];
+    snprintf(checksum_path, sizeof(checksum_path), "%s%s", backup_path, BACKUP_CHECKSUM_SUFFIX);
+    FILE *checksum_file = fopen(checksum_path, "r");
+    if (checksum_file) {
+        fclose(checksum_file);
+        if (backup_verify(backup_path, FALSE, NULL) != SUCCESS) {
+            fprintf(stderr, "백업 검사에 실패해 복원하지 않습니다: %s\n", backup_path);
+            return FAILURE;
+        }
+    }
+    
     sqlite3 *backup_db = NULL;
     sqlite3_backup *backup = NULL;
     int result = FAILURE;
@@ -0,0 +1,945 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <limits.h>
+#include "../include/dataset_generator.h"
+#include "../include/database.h"
+#include "../include/loan_event.h"
+#include "../include/utils.h"
+
+#define SECONDS_PER_DAY 86400LL
+#define MAX_GENERATED_COPIES 5
+#define PICK_ATTEMPTS 8
+#define NEVER_RETURNED LLONG_MAX
+#define LOST_PER_MILLE 2              // 끝내 반납되지 않는 대출 비율 (천분율)
+#define MEMBER_ZIPF_EXPONENT 0.6     // 회원별 대출 빈도의 치우침 (도서보다 완만)
+#define OPENING_HOUR 9               // 대출/반납 시각은 개관 시간(UTC 09~21시) 안에 둠
+#define OPENING_SECONDS (12 * 3600LL)
+
+// ---------------------------------------------------------------------------
+// 난수 (splitmix64: 시드만 같으면 플랫폼과 관계없이 같은 수열)
+// ---------------------------------------------------------------------------
+
+typedef struct {
+    unsigned long long state;
+} GeneratorRandom;
+
+static unsigned long long random_next(GeneratorRandom *random) {
+    unsigned long long z = (random->state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+// [0, 1) 구간의 실수
+static double random_unit(GeneratorRandom *random) {
+    return (double)(random_next(random) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+static int random_below(GeneratorRandom *random, int bound) {
+    return (int)(random_unit(random) * bound);
+}
+
+// ---------------------------------------------------------------------------
+// Zipf 분포: 순위별 누적 가중치와 순위 -> 항목 번호 대응 (인기 항목이 ID 순서와 무관하게 흩어짐)
+// ---------------------------------------------------------------------------
+
+typedef struct {
+    double *cumulative;
+    int *items;
+    int count;
+} ZipfTable;
+
+static int zipf_init(ZipfTable *table, int count, double exponent, GeneratorRandom *random) {
+    table->count = count;
+    table->cumulative = malloc(sizeof(double) * (size_t)count);
+    table->items = malloc(sizeof(int) * (size_t)count);
+    if (!table->cumulative || !table->items) {
+        return FAILURE;
+    }
+
+    double total = 0.0;
+    for (int rank = 0; rank < count; rank++) {
+        total += 1.0 / pow(rank + 1.0, exponent);
+        table->cumulative[rank] = total;
+        table->items[rank] = rank;
+    }
+
+    for (int i = count - 1; i > 0; i--) {
+        int j = random_below(random, i + 1);
+        int temp = table->items[i];
+        table->items[i] = table->items[j];
+        table->items[j] = temp;
+    }
+    return SUCCESS;
+}
+
+static int zipf_sample(const ZipfTable *table, GeneratorRandom *random) {
+    double target = random_unit(random) * table->cumulative[table->count - 1];
+    int low = 0;
+    int high = table->count - 1;
+
+    while (low < high) {
+        int mid = low + (high - low) / 2;
+        if (table->cumulative[mid] > target) {
+            high = mid;
+        } else {
+            low = mid + 1;
+        }
+    }
+    return table->items[low];
+}
+
+static void zipf_free(ZipfTable *table) {
+    free(table->cumulative);
+    free(table->items);
+    table->cumulative = NULL;
+    table->items = NULL;
+}
+
+// ---------------------------------------------------------------------------
+// 이름/제목 재료
+// ---------------------------------------------------------------------------
+
+typedef struct {
+    const char *hangul;
+    const char *roman;
+    int weight;                // 대략적인 인구 비율 (천분율)
+} Surname;
+
+static const Surname SURNAMES[] = {
+    {"김", "kim", 215}, {"이", "lee", 147}, {"박", "park", 84}, {"최", "choi", 47}, {"정", "jung", 43},
+    {"강", "kang", 23}, {"조", "cho", 21}, {"윤", "yoon", 21}, {"장", "jang", 20}, {"임", "lim", 17},
+    {"한", "han", 15}, {"오", "oh", 15}, {"서", "seo", 15}, {"신", "shin", 15}, {"권", "kwon", 14},
+    {"황", "hwang", 14}, {"안", "ahn", 13}, {"송", "song", 13}, {"전", "jeon", 11}, {"홍", "hong", 11},
+    {"유", "yoo", 10}, {"고", "ko", 9}, {"문", "moon", 9}, {"양", "yang", 8}, {"손", "son", 8}
+};
+
+static const char *GIVEN_FIRST[] = {
+    "민", "서", "도", "하", "시", "지", "주", "예", "건", "수", "현", "유",
+    "채", "정", "승", "다", "윤", "태", "우", "은", "소", "준", "영", "재"
+};
+
+static const char *GIVEN_SECOND[] = {
+    "준", "연", "윤", "은", "우", "아", "원", "서", "민", "호", "린", "율",
+    "빈", "진", "희", "현", "영", "수", "훈", "경", "혁", "인", "안", "람"
+};
+
+static const char *ADJECTIVES[] = {
+    "새로운", "쉽게 배우는", "실전", "처음 만나는", "한국의", "세계의", "작은", "위대한",
+    "숨겨진", "오래된", "모두의", "즐거운", "조용한", "뜨거운", "느린", "다정한"
+};
+
+static const char *SUBJECTS[] = {
+    "자료구조", "알고리즘", "데이터베이스", "역사", "경제학", "철학", "심리학", "요리",
+    "여행", "소설", "시", "과학", "음악", "미술", "건축", "수학", "정원", "고양이",
+    "바다", "우주", "도시", "기억", "시간", "언어", "사랑", "전쟁", "여름", "겨울"
+};
+
+static const char *FORMS[] = {
+    "입문", "완성", "노트", "이야기", "사전", "강의", "연습", "핸드북", "에세이", "도감", "수업", "산책"
+};
+
+static const char *PLACES[] = {
+    "서울", "제주", "부산", "숲", "교실", "바닷가", "골목", "부엌", "도서관", "기차"
+};
+
+static const char *PUBLISHERS[] = {
+    "한빛나래", "바다숲", "푸른글방", "열린책터", "새벽빛출판", "도서출판 길벗",
+    "마음나무", "누리출판", "별빛서가", "고래책방", "하늘소", "솔빛문고"
+};
+
+// 한국십진분류 대분류와 대략적인 장서 비율
+static const char *CATEGORIES[] = {
+    "총류", "철학", "종교", "사회과학", "자연과학", "기술과학", "예술", "언어", "문학", "역사"
+};
+static const int CATEGORY_WEIGHTS[] = { 3, 6, 3, 18, 8, 14, 7, 4, 28, 9 };
+
+static const char *CITIES[] = {
+    "서울특별시 강남구", "서울특별시 마포구", "서울특별시 노원구", "부산광역시 해운대구",
+    "인천광역시 연수구", "대전광역시 유성구", "대구광역시 수성구", "광주광역시 북구",
+    "경기도 수원시", "경기도 성남시", "경기도 고양시", "제주특별자치도 제주시"
+};
+
+static const char *ROADS[] = {
+    "중앙로", "학교로", "공원로", "시장길", "은행나무길", "강변로", "역전로", "도서관길"
+};
+
+static const char *EMAIL_DOMAINS[] = {
+    "example.com", "example.net", "example.org", "mail.example.kr"
+};
+
+#define COUNT_OF(array) ((int)(sizeof(array) / sizeof((array)[0])))
+
+static const char *pick(GeneratorRandom *random, const char *const *words, int count) {
+    return words[random_below(random, count)];
+}
+
+static const Surname *pick_surname(GeneratorRandom *random) {
+    int total = 0;
+    for (int i = 0; i < COUNT_OF(SURNAMES); i++) {
+        total += SURNAMES[i].weight;
+    }
+
+    int target = random_below(random, total);
+    for (int i = 0; i < COUNT_OF(SURNAMES); i++) {
+        target -= SURNAMES[i].weight;
+        if (target < 0) {
+            return &SURNAMES[i];
+        }
+    }
+    return &SURNAMES[0];
+}
+
+static void make_person_name(GeneratorRandom *random, char *name, size_t name_size, const Surname **surname) {
+    const Surname *chosen = pick_surname(random);
+    snprintf(name, name_size, "%s%s%s", chosen->hangul,
+             pick(random, GIVEN_FIRST, COUNT_OF(GIVEN_FIRST)),
+             pick(random, GIVEN_SECOND, COUNT_OF(GIVEN_SECOND)));
+    if (surname) {
+        *surname = chosen;
+    }
+}
+
+static void make_title(GeneratorRandom *random, char *title, size_t title_size) {
+    const char *subject = pick(random, SUBJECTS, COUNT_OF(SUBJECTS));
+    int length;
+
+    switch (random_below(random, 5)) {
+        case 0:
+            length = snprintf(title, title_size, "%s %s", pick(random, ADJECTIVES, COUNT_OF(ADJECTIVES)), subject);
+            break;
+        case 1:
+            length = snprintf(title, title_size, "%s %s", subject, pick(random, FORMS, COUNT_OF(FORMS)));
+            break;
+        case 2:
+            length = snprintf(title, title_size, "%s %s %s", pick(random, ADJECTIVES, COUNT_OF(ADJECTIVES)),
+                              subject, pick(random, FORMS, COUNT_OF(FORMS)));
+            break;
+        case 3:
+            length = snprintf(title, title_size, "%s 그리고 %s", subject, pick(random, SUBJECTS, COUNT_OF(SUBJECTS)));
+            break;
+        default:
+            length = snprintf(title, title_size, "%s에서 읽는 %s", pick(random, PLACES, COUNT_OF(PLACES)), subject);
+            break;
+    }
+
+    // 일부는 시리즈 권차나 개정판
+    double series = random_unit(random);
+    if (length > 0 && (size_t)length < title_size) {
+        if (series < 0.10) {
+            snprintf(title + length, title_size - (size_t)length, " %d권", 1 + random_below(random, 5));
+        } else if (series < 0.15) {
+            snprintf(title + length, title_size - (size_t)length, " 개정%d판", 2 + random_below(random, 4));
+        }
+    }
+}
+
+static const char *pick_category(GeneratorRandom *random) {
+    int total = 0;
+    for (int i = 0; i < COUNT_OF(CATEGORY_WEIGHTS); i++) {
+        total += CATEGORY_WEIGHTS[i];
+    }
+
+    int target = random_below(random, total);
+    for (int i = 0; i < COUNT_OF(CATEGORY_WEIGHTS); i++) {
+        target -= CATEGORY_WEIGHTS[i];
+        if (target < 0) {
+            return CATEGORIES[i];
+        }
+    }
+    return CATEGORIES[0];
+}
+
+// 979 + 9자리 일련번호 + 검사 숫자
+static void make_isbn(long long serial, char *isbn, size_t isbn_size) {
+    char digits[16];
+    snprintf(digits, sizeof(digits), "979%09lld", serial % 1000000000LL);
+
+    int sum = 0;
+    for (int i = 0; i < 12; i++) {
+        sum += (digits[i] - '0') * (i % 2 == 0 ? 1 : 3);
+    }
+    snprintf(isbn, isbn_size, "%s%d", digits, (10 - sum % 10) % 10);
+}
+
+// 인기 순위가 높을수록 사본을 많이 둠
+static int copies_for_rank(int rank, int count) {
+    if (rank < count / 100 + 1) {
+        return 5;
+    }
+    if (rank < count / 10) {
+        return 3;
+    }
+    if (rank < count * 2 / 5) {
+        return 2;
+    }
+    return 1;
+}
+
+// 날짜 안의 위치(0~1)를 개관 시간 안의 시각으로 옮김
+static long long opening_time(long long day_start, double fraction) {
+    return day_start + OPENING_HOUR * 3600LL + (long long)(fraction * OPENING_SECONDS);
+}
+
+static void to_sql_time(long long seconds, char *buffer, size_t buffer_size) {
+    time_to_sql_string((time_t)seconds, buffer, buffer_size);
+}
+
+// ---------------------------------------------------------------------------
+// 데이터베이스 보조 함수
+// ---------------------------------------------------------------------------
+
+static int query_int(sqlite3 *db, const char *sql, int *value) {
+    sqlite3_stmt *stmt = NULL;
+    if (database_prepare_statement(db, sql, &stmt) != SUCCESS) {
+        return FAILURE;
+    }
+
+    int status = FAILURE;
+    if (sqlite3_step(stmt) == SQLITE_ROW) {
+        *value = sqlite3_column_int(stmt, 0);
+        status = SUCCESS;
+    }
+    sqlite3_finalize(stmt);
+    return status;
+}
+
+typedef struct {
+    char **names;
+    char **statements;
+    int count;
+} SavedIndexes;
+
+static char *duplicate_string(const char *text) {
+    size_t length = strlen(text) + 1;
+    char *copy = malloc(length);
+    if (copy) {
+        memcpy(copy, text, length);
+    }
+    return copy;
+}
+
+// 대량 입력 동안 보조 인덱스를 지우고 정의를 보관 (UNIQUE 제약의 자동 인덱스는 남음)
+static int drop_secondary_indexes(sqlite3 *db, SavedIndexes *saved) {
+    const char *sql =
+        "SELECT name, sql FROM sqlite_master WHERE type = 'index' AND sql IS NOT NULL "
+        "AND tbl_name IN ('books', 'members', 'loans', 'loan_events') ORDER BY name;";
+    sqlite3_stmt *stmt = NULL;
+
+    memset(saved, 0, sizeof(SavedIndexes));
+
+    if (database_prepare_statement(db, sql, &stmt) != SUCCESS) {
+        return FAILURE;
+    }
+
+    // 조회 중에는 스키마를 바꿀 수 없으므로 목록을 먼저 모두 읽음
+    int status = SUCCESS;
+    while (status == SUCCESS && sqlite3_step(stmt) == SQLITE_ROW) {
+        char **names = realloc(saved->names, sizeof(char*) * (size_t)(saved->count + 1));
+        if (names) {
+            saved->names = names;
+        }
+        char **statements = realloc(saved->statements, sizeof(char*) * (size_t)(saved->count + 1));
+        if (statements) {
+            saved->statements = statements;
+        }
+        if (!names || !statements) {
+            status = FAILURE;
+            break;
+        }
+
+        saved->names[saved->count] = duplicate_string((const char*)sqlite3_column_text(stmt, 0));
+        saved->statements[saved->count] = duplicate_string((const char*)sqlite3_column_text(stmt, 1));
+        saved->count++;
+        if (!saved->names[saved->count - 1] || !saved->statements[saved->count - 1]) {
+            status = FAILURE;
+        }
+    }
+    sqlite3_finalize(stmt);
+
+    for (int i = 0; i < saved->count && status == SUCCESS; i++) {
+        char drop_sql[MAX_SQL_LENGTH];
+        snprintf(drop_sql, sizeof(drop_sql), "DROP INDEX \"%s\";", saved->names[i]);
+        status = database_execute_query(db, drop_sql);
+    }
+    return status;
+}
+
+static int restore_secondary_indexes(sqlite3 *db, const SavedIndexes *saved) {
+    for (int i = 0; i < saved->count; i++) {
+        if (database_execute_query(db, saved->statements[i]) != SUCCESS) {
+            return FAILURE;
+        }
+    }
+    return SUCCESS;
+}
+
+static void free_saved_indexes(SavedIndexes *saved) {
+    for (int i = 0; i < saved->count; i++) {
+        free(saved->names[i]);
+        free(saved->statements[i]);
+    }
+    free(saved->names);
+    free(saved->statements);
+    memset(saved, 0, sizeof(SavedIndexes));
+}
+
+// ---------------------------------------------------------------------------
+// 생성 단계
+// ---------------------------------------------------------------------------
+
+typedef struct {
+    sqlite3 *db;
+    const DatasetGeneratorConfig *config;
+    DatasetGeneratorStats *stats;
+    GeneratorRandom random;
+    long long window_start;
+
+    ZipfTable book_popularity;
+    ZipfTable member_activity;
+    int *book_ids;
+    unsigned char *book_copies;
+    unsigned char *book_open_loans;
+    long long *copy_busy_until;    // 도서 x 사본별 반납 시각
+    int *member_ids;
+    long long *member_busy_until;  // 회원 x 대출 한도별 반납 시각
+} Generator;
+
+static int generate_books(Generator *gen) {
+    const char *sql =
+        "INSERT INTO books (title, author, isbn, publisher, publication_year, "
+        "total_copies, available_copies, category, "
+        "title_norm, title_chosung, author_norm, author_chosung, created_at, updated_at) "
+        "VALUES (?1, ?2, ?3, ?4, ?5, ?6, ?6, ?7, "
+        "hangul_normalize(?1), hangul_chosung(?1), hangul_normalize(?2), hangul_chosung(?2), ?8, ?8);";
+    sqlite3_stmt *stmt = NULL;
+
+    if (database_prepare_statement(gen->db, sql, &stmt) != SUCCESS) {
+        return FAILURE;
+    }
+
+    int count = gen->config->book_count;
+    for (int rank = 0; rank < count; rank++) {
+        gen->book_copies[gen->book_popularity.items[rank]] = (unsigned char)copies_for_rank(rank, count);
+    }
+
+    struct tm as_of_tm;
+    time_t as_of = gen->config->as_of;
+#ifdef _WIN32
+    gmtime_s(&as_of_tm, &as_of);
+#else
+    gmtime_r(&as_of, &as_of_tm);
+#endif
+    int current_year = as_of_tm.tm_year + 1900;
+
+    int status = SUCCESS;
+    for (int i = 0; i < count && status == SUCCESS; i++) {
+        char title[MAX_TITLE_LENGTH + 1];
+        char author[MAX_AUTHOR_LENGTH + 1];
+        char isbn[MAX_ISBN_LENGTH + 1];
+        char created_at[32];
+
+        make_title(&gen->random, title, sizeof(title));
+        make_person_name(&gen->random, author, sizeof(author), NULL);
+        if (random_unit(&gen->random) < 0.08) {
+            strncat(author, " 외", sizeof(author) - strlen(author) - 1);
+        }
+        make_isbn(i + 1, isbn, sizeof(isbn));
+
+        // 출판 연도는 최근일수록 많음 (평균 8년 전)
+        int age = (int)(-log(1.0 - random_unit(&gen->random)) * 8.0);
+        int year = current_year - (age > 60 ? 60 : age);
+
+        // 입고일은 이력 시작 전 1년 안
+        to_sql_time(gen->window_start - (long long)(random_unit(&gen->random) * 365 * SECONDS_PER_DAY),
+                    created_at, sizeof(created_at));
+
+        sqlite3_bind_text(stmt, 1, title, -1, SQLITE_STATIC);
+        sqlite3_bind_text(stmt, 2, author, -1, SQLITE_STATIC);
+        sqlite3_bind_text(stmt, 3, isbn, -1, SQLITE_STATIC);
+        sqlite3_bind_text(stmt, 4, pick(&gen->random, PUBLISHERS, COUNT_OF(PUBLISHERS)), -1, SQLITE_STATIC);
+        sqlite3_bind_int(stmt, 5, year);
+        sqlite3_bind_int(stmt, 6, gen->book_copies[i]);
+        sqlite3_bind_text(stmt, 7, pick_category(&gen->random), -1, SQLITE_STATIC);
+        sqlite3_bind_text(stmt, 8, created_at, -1, SQLITE_STATIC);
+
+        if (sqlite3_step(stmt) != SQLITE_DONE) {
+            fprintf(stderr, "도서 생성 실패: %s\n", sqlite3_errmsg(gen->db));
+            status = FAILURE;
+        } else {
+            gen->book_ids[i] = (int)sqlite3_last_insert_rowid(gen->db);
+        }
+        sqlite3_reset(stmt);
+    }
+
+    sqlite3_finalize(stmt);
+    if (status == SUCCESS) {
+        gen->stats->books = count;
+    }
+    return status;
+}
+
+static int generate_members(Generator *gen) {
+    const char *sql =
+        "INSERT INTO members (name, email, phone, address, registration_date, is_active, "
+        "name_norm, name_chosung, phone_digits, phone_digits_reversed, created_at, updated_at) "
+        "VALUES (?1, ?2, ?3, ?4, ?5, ?6, hangul_normalize(?1), hangul_chosung(?1), ?7, ?8, ?5, ?5);";
+    sqlite3_stmt *stmt = NULL;
+
+    if (database_prepare_statement(gen->db, sql, &stmt) != SUCCESS) {
+        return FAILURE;
+    }
+
+    int status = SUCCESS;
+    for (int i = 0; i < gen->config->member_count && status == SUCCESS; i++) {
+        char name[MAX_NAME_LENGTH + 1];
+        char email[MAX_EMAIL_LENGTH + 1];
+        char phone[MAX_PHONE_LENGTH + 1];
+        char address[MAX_ADDRESS_LENGTH + 1];
+        char registered_at[32];
+        char digits[MAX_PHONE_LENGTH + 1];
+        char reversed[MAX_PHONE_LENGTH + 1];
+        const Surname *surname = NULL;
+
+        make_person_name(&gen->random, name, sizeof(name), &surname);
+        snprintf(email, sizeof(email), "%s%d@%s", surname->roman, i + 1,
+                 pick(&gen->random, EMAIL_DOMAINS, COUNT_OF(EMAIL_DOMAINS)));
+
+        int middle = random_below(&gen->random, 10000);
+        int last = random_below(&gen->random, 10000);
+        snprintf(phone, sizeof(phone), "010-%04d-%04d", middle, last);
+        snprintf(digits, sizeof(digits), "010%04d%04d", middle, last);
+        size_t length = strlen(digits);
+        for (size_t j = 0; j < length; j++) {
+            reversed[j] = digits[length - 1 - j];
+        }
+        reversed[length] = '\0';
+
+        snprintf(address, sizeof(address), "%s %s %d", pick(&gen->random, CITIES, COUNT_OF(CITIES)),
+                 pick(&gen->random, ROADS, COUNT_OF(ROADS)), 1 + random_below(&gen->random, 300));
+
+        to_sql_time(gen->window_start - (long long)(random_unit(&gen->random) * 365 * SECONDS_PER_DAY),
+                    registered_at, sizeof(registered_at));
+
+        sqlite3_bind_text(stmt, 1, name, -1, SQLITE_STATIC);
+        sqlite3_bind_text(stmt, 2, email, -1, SQLITE_STATIC);
+        sqlite3_bind_text(stmt, 3, phone, -1, SQLITE_STATIC);
+        sqlite3_bind_text(stmt, 4, address, -1, SQLITE_STATIC);
+        sqlite3_bind_text(stmt, 5, registered_at, -1, SQLITE_STATIC);
+        sqlite3_bind_int(stmt, 6, random_unit(&gen->random) < 0.98 ? TRUE : FALSE);
+        sqlite3_bind_text(stmt, 7, digits, -1, SQLITE_STATIC);
+        sqlite3_bind_text(stmt, 8, reversed, -1, SQLITE_STATIC);
+
+        if (sqlite3_step(stmt) != SQLITE_DONE) {
+            fprintf(stderr, "회원 생성 실패: %s\n", sqlite3_errmsg(gen->db));
+            status = FAILURE;
+        } else {
+            gen->member_ids[i] = (int)sqlite3_last_insert_rowid(gen->db);
+        }
+        sqlite3_reset(stmt);
+    }
+
+    sqlite3_finalize(stmt);
+    if (status == SUCCESS) {
+        gen->stats->members = gen->config->member_count;
+    }
+    return status;
+}
+
+// 시각 when에 비어 있는 칸 번호 (없으면 -1)
+static int find_free_slot(const long long *busy_until, int slots, long long when) {
+    for (int i = 0; i < slots; i++) {
+        if (busy_until[i] <= when) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// 인기도에 따라 도서를 고르고, 사본이 모두 대출 중이면 다시 고름 (끝내 없으면 아무 도서)
+static int pick_book(Generator *gen, long long when, int *slot) {
+    for (int pass = 0; pass < 2; pass++) {
+        for (int attempt = 0; attempt < PICK_ATTEMPTS; attempt++) {
+            int book = pass == 0 ? zipf_sample(&gen->book_popularity, &gen->random)
+                                 : random_below(&gen->random, gen->config->book_count);
+            *slot = find_free_slot(&gen->copy_busy_until[(size_t)book * MAX_GENERATED_COPIES],
+                                   gen->book_copies[book], when);
+            if (*slot >= 0) {
+                return book;
+            }
+        }
+    }
+    return -1;
+}
+
+static int pick_member(Generator *gen, long long when, int *slot) {
+    for (int pass = 0; pass < 2; pass++) {
+        for (int attempt = 0; attempt < PICK_ATTEMPTS; attempt++) {
+            int member = pass == 0 ? zipf_sample(&gen->member_activity, &gen->random)
+                                   : random_below(&gen->random, gen->config->member_count);
+            *slot = find_free_slot(&gen->member_busy_until[(size_t)member * MAX_BOOKS_PER_MEMBER],
+                                   MAX_BOOKS_PER_MEMBER, when);
+            if (*slot >= 0) {
+                return member;
+            }
+        }
+    }
+    return -1;
+}
+
+static int insert_event(sqlite3_stmt *stmt, long long event_time, int event_type, int loan_id,
+                        int book_id, int member_id, long long due) {
+    sqlite3_bind_int64(stmt, 1, event_time);
+    sqlite3_bind_int(stmt, 2, event_type);
+    sqlite3_bind_int(stmt, 3, loan_id);
+    sqlite3_bind_int(stmt, 4, book_id);
+    sqlite3_bind_int(stmt, 5, member_id);
+    sqlite3_bind_int64(stmt, 6, due);
+
+    int status = sqlite3_step(stmt) == SQLITE_DONE ? SUCCESS : FAILURE;
+    sqlite3_reset(stmt);
+    return status;
+}
+
+static int generate_loans(Generator *gen) {
+    const char *loan_sql =
+        "INSERT INTO loans (book_id, member_id, loan_date, due_date, return_date, is_returned, "
+        "renewal_count, created_at, updated_at) "
+        "VALUES (?1, ?2, ?3, ?4, ?5, ?6, ?7, ?3, ?8);";
+    const char *event_sql =
+        "INSERT INTO temp.generated_loan_events VALUES (?1, ?2, ?3, ?4, ?5, ?6);";
+    sqlite3_stmt *loan_stmt = NULL;
+    sqlite3_stmt *event_stmt = NULL;
+
+    // 이벤트는 대출 순서로 만들어지므로 임시 테이블에 모았다가 발생 시각 순으로 옮김
+    if (gen->config->write_events &&
+        (database_execute_query(gen->db,
+            "CREATE TEMP TABLE generated_loan_events (event_time INTEGER, event_type INTEGER, "
+            "loan_id INTEGER, book_id INTEGER, member_id INTEGER, arg INTEGER);") != SUCCESS ||
+         database_prepare_statement(gen->db, event_sql, &event_stmt) != SUCCESS)) {
+        return FAILURE;
+    }
+    if (database_prepare_statement(gen->db, loan_sql, &loan_stmt) != SUCCESS) {
+        sqlite3_finalize(event_stmt);
+        return FAILURE;
+    }
+
+    const DatasetGeneratorConfig *config = gen->config;
+    long long as_of = (long long)config->as_of;
+    long long loan_period = DEFAULT_LOAN_DAYS * SECONDS_PER_DAY;
+    double days = (double)(as_of - gen->window_start) / SECONDS_PER_DAY;
+    int status = SUCCESS;
+
+    for (long long k = 0; k < config->loan_count && status == SUCCESS; k++) {
+        // 기간을 대출 수만큼 나눈 구간마다 하나씩: 시간순이면서 고르게 퍼짐
+        double position = ((double)k + random_unit(&gen->random)) / (double)config->loan_count * days;
+        long long day_start = gen->window_start + (long long)position * SECONDS_PER_DAY;
+        long long loan_time = opening_time(day_start, position - floor(position));
+
+        int book_slot;
+        int member_slot;
+        int book = pick_book(gen, loan_time, &book_slot);
+        int member = book >= 0 ? pick_member(gen, loan_time, &member_slot) : -1;
+        if (book < 0 || member < 0) {
+            gen->stats->skipped_loans++;
+            continue;
+        }
+
+        // 연장은 반납 예정일 직전 3일 안에 신청 (20%는 한 번, 8%는 두 번)
+        long long due = loan_time + loan_period;
+        long long renew_times[MAX_RENEWAL_COUNT];
+        int planned = 0;
+        double renew_roll = random_unit(&gen->random);
+        int wanted = renew_roll < 0.08 ? 2 : (renew_roll < 0.28 ? 1 : 0);
+        long long planned_due = due;
+        for (int r = 0; r < wanted && r < MAX_RENEWAL_COUNT; r++) {
+            renew_times[planned++] = planned_due - (long long)(random_unit(&gen->random) * 3 * SECONDS_PER_DAY);
+            planned_due += loan_period;
+        }
+
+        // 반납: 대부분 예정일 전, 일부는 긴 꼬리를 가진 연체 후 반납, 극소수는 분실로 미반납
+        long long earliest = planned > 0 ? renew_times[planned - 1] + 3600 : loan_time + 3600;
+        long long return_time;
+        double return_roll = random_unit(&gen->random);
+        if (return_roll * 1000.0 < LOST_PER_MILLE) {
+            return_time = NEVER_RETURNED;
+        } else if (random_unit(&gen->random) * 100.0 < config->overdue_percent) {
+            double late_days = ceil(pow(1.0 - random_unit(&gen->random), -1.0 / 1.3));
+            if (late_days > 365) {
+                late_days = 365;
+            }
+            return_time = planned_due + (long long)late_days * SECONDS_PER_DAY;
+        } else {
+            return_time = earliest + (long long)(random_unit(&gen->random) * (double)(planned_due - earliest));
+        }
+
+        // 기준 시각 이후의 연장/반납은 아직 일어나지 않은 것으로 처리
+        int renewals = 0;
+        while (renewals < planned && renew_times[renewals] <= as_of) {
+            due += loan_period;
+            renewals++;
+        }
+        int is_open = return_time > as_of;
+        long long busy_until = is_open ? NEVER_RETURNED : return_time;
+
+        gen->copy_busy_until[(size_t)book * MAX_GENERATED_COPIES + book_slot] = busy_until;
+        gen->member_busy_until[(size_t)member * MAX_BOOKS_PER_MEMBER + member_slot] = busy_until;
+
+        char loan_date[32];
+        char due_date[32];
+        char return_date[32];
+        char updated_at[32];
+        to_sql_time(loan_time, loan_date, sizeof(loan_date));
+        to_sql_time(due, due_date, sizeof(due_date));
+        to_sql_time(is_open ? (renewals > 0 ? renew_times[renewals - 1] : loan_time) : return_time,
+                    updated_at, sizeof(updated_at));
+
+        int book_id = gen->book_ids[book];
+        int member_id = gen->member_ids[member];
+
+        sqlite3_bind_int(loan_stmt, 1, book_id);
+        sqlite3_bind_int(loan_stmt, 2, member_id);
+        sqlite3_bind_text(loan_stmt, 3, loan_date, -1, SQLITE_STATIC);
+        sqlite3_bind_text(loan_stmt, 4, due_date, -1, SQLITE_STATIC);
+        if (is_open) {
+            sqlite3_bind_null(loan_stmt, 5);
+        } else {
+            to_sql_time(return_time, return_date, sizeof(return_date));
+            sqlite3_bind_text(loan_stmt, 5, return_date, -1, SQLITE_STATIC);
+        }
+        sqlite3_bind_int(loan_stmt, 6, is_open ? 0 : 1);
+        sqlite3_bind_int(loan_stmt, 7, renewals);
+        sqlite3_bind_text(loan_stmt, 8, updated_at, -1, SQLITE_STATIC);
+
+        if (sqlite3_step(loan_stmt) != SQLITE_DONE) {
+            fprintf(stderr, "대출 기록 생성 실패: %s\n", sqlite3_errmsg(gen->db));
+            status = FAILURE;
+            break;
+        }
+        sqlite3_reset(loan_stmt);
+        int loan_id = (int)sqlite3_last_insert_rowid(gen->db);
+
+        gen->stats->loans++;
+        gen->stats->renewals += renewals;
+        if (is_open) {
+            gen->stats->open_loans++;
+            gen->book_open_loans[book]++;
+            if (due < as_of) {
+                gen->stats->overdue_loans++;
+            }
+        }
+
+        if (event_stmt) {
+            long long event_due = loan_time + loan_period;
+            status = insert_event(event_stmt, loan_time, LOAN_EVENT_CHECKOUT, loan_id, book_id, member_id, event_due);
+            for (int r = 0; r < renewals && status == SUCCESS; r++) {
+                event_due += loan_period;
+                status = insert_event(event_stmt, renew_times[r], LOAN_EVENT_RENEW, loan_id, book_id, member_id, event_due);
+            }
+            if (status == SUCCESS && !is_open) {
+                status = insert_event(event_stmt, return_time, LOAN_EVENT_RETURN, loan_id, book_id, member_id, event_due);
+            }
+            if (status != SUCCESS) {
+                fprintf(stderr, "대출 이벤트 생성 실패: %s\n", sqlite3_errmsg(gen->db));
+            }
+        }
+    }
+
+    sqlite3_finalize(loan_stmt);
+    sqlite3_finalize(event_stmt);
+
+    if (status == SUCCESS && config->write_events) {
+        status = database_execute_query(gen->db,
+            "INSERT INTO loan_events (event_time, event_type, loan_id, book_id, member_id, arg) "
+            "SELECT event_time, event_type, loan_id, book_id, member_id, arg "
+            "FROM temp.generated_loan_events ORDER BY event_time, loan_id, event_type;");
+        if (status == SUCCESS) {
+            gen->stats->events = sqlite3_changes(gen->db);
+        }
+    }
+    if (config->write_events) {
+        database_execute_query(gen->db, "DROP TABLE IF EXISTS temp.generated_loan_events;");
+    }
+    return status;
+}
+
+// 대출 중인 사본 수만큼 대출 가능 권수를 줄임
+static int update_availability(Generator *gen) {
+    const char *sql = "UPDATE books SET available_copies = total_copies - ?1 WHERE id = ?2;";
+    sqlite3_stmt *stmt = NULL;
+
+    if (database_prepare_statement(gen->db, sql, &stmt) != SUCCESS) {
+        return FAILURE;
+    }
+
+    int status = SUCCESS;
+    for (int i = 0; i < gen->config->book_count && status == SUCCESS; i++) {
+        if (gen->book_open_loans[i] == 0) {
+            continue;
+        }
+        sqlite3_bind_int(stmt, 1, gen->book_open_loans[i]);
+        sqlite3_bind_int(stmt, 2, gen->book_ids[i]);
+        if (sqlite3_step(stmt) != SQLITE_DONE) {
+            fprintf(stderr, "대출 가능 권수 갱신 실패: %s\n", sqlite3_errmsg(gen->db));
+            status = FAILURE;
+        }
+        sqlite3_reset(stmt);
+    }
+
+    sqlite3_finalize(stmt);
+    return status;
+}
+
+static void free_generator(Generator *gen) {
+    zipf_free(&gen->book_popularity);
+    zipf_free(&gen->member_activity);
+    free(gen->book_ids);
+    free(gen->book_copies);
+    free(gen->book_open_loans);
+    free(gen->copy_busy_until);
+    free(gen->member_ids);
+    free(gen->member_busy_until);
+}
+
+static int init_generator(Generator *gen) {
+    size_t books = (size_t)gen->config->book_count;
+    size_t members = (size_t)gen->config->member_count;
+
+    gen->book_ids = malloc(sizeof(int) * books);
+    gen->book_copies = calloc(books, 1);
+    gen->book_open_loans = calloc(books, 1);
+    gen->copy_busy_until = calloc(books * MAX_GENERATED_COPIES, sizeof(long long));
+    gen->member_ids = malloc(sizeof(int) * members);
+    gen->member_busy_until = calloc(members * MAX_BOOKS_PER_MEMBER, sizeof(long long));
+
+    if (!gen->book_ids || !gen->book_copies || !gen->book_open_loans || !gen->copy_busy_until ||
+        !gen->member_ids || !gen->member_busy_until ||
+        zipf_init(&gen->book_popularity, gen->config->book_count, gen->config->zipf_exponent, &gen->random) != SUCCESS ||
+        zipf_init(&gen->member_activity, gen->config->member_count, MEMBER_ZIPF_EXPONENT, &gen->random) != SUCCESS) {
+        fprintf(stderr, "메모리 할당 실패\n");
+        return FAILURE;
+    }
+    return SUCCESS;
+}
+
+void dataset_generator_default_config(DatasetGeneratorConfig *config, int book_count) {
+    if (!config) {
+        return;
+    }
+
+    memset(config, 0, sizeof(DatasetGeneratorConfig));
+    config->seed = 1;
+    config->book_count = book_count > 0 ? book_count : DATASET_DEFAULT_BOOKS;
+    config->member_count = config->book_count / DATASET_MEMBERS_PER_BOOK_RATIO;
+    if (config->member_count < 1) {
+        config->member_count = 1;
+    }
+    config->loan_count = (long long)config->book_count * DATASET_LOANS_PER_BOOK;
+    config->years = DATASET_DEFAULT_YEARS;
+    config->zipf_exponent = DATASET_DEFAULT_ZIPF_EXPONENT;
+    config->overdue_percent = DATASET_DEFAULT_OVERDUE_PERCENT;
+    config->write_events = TRUE;
+}
+
+int dataset_generate(sqlite3 *db, const DatasetGeneratorConfig *config, DatasetGeneratorStats *stats) {
+    if (!db || !config || config->book_count <= 0 || config->member_count <= 0 || config->loan_count < 0 ||
+        config->years <= 0 || config->zipf_exponent < 0 ||
+        config->overdue_percent < 0 || config->overdue_percent > 100) {
+        fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
+        return FAILURE;
+    }
+
+    int existing = 0;
+    if (query_int(db, "SELECT EXISTS (SELECT 1 FROM books) OR EXISTS (SELECT 1 FROM members) "
+                      "OR EXISTS (SELECT 1 FROM loans);", &existing) != SUCCESS) {
+        return FAILURE;
+    }
+    if (existing) {
+        fprintf(stderr, "대상 데이터베이스에 이미 도서/회원/대출 데이터가 있습니다.\n");
+        return FAILURE;
+    }
+
+    DatasetGeneratorStats local_stats;
+    DatasetGeneratorConfig effective = *config;
+    if (effective.as_of == 0) {
+        effective.as_of = time(NULL);
+    }
+
+    Generator gen;
+    memset(&gen, 0, sizeof(Generator));
+    gen.db = db;
+    gen.config = &effective;
+    gen.stats = stats ? stats : &local_stats;
+    gen.random.state = effective.seed;
+    memset(gen.stats, 0, sizeof(DatasetGeneratorStats));
+
+    // 이력 시작일의 0시 (UTC)
+    long long span = (long long)effective.years * 365 * SECONDS_PER_DAY;
+    gen.window_start = ((long long)effective.as_of - span) / SECONDS_PER_DAY * SECONDS_PER_DAY;
+
+    long long start_ns = timer_now_nanoseconds();
+
+    if (init_generator(&gen) != SUCCESS) {
+        free_generator(&gen);
+        return FAILURE;
+    }
+
+    // 한 번에 넣고 끝에 커밋하므로 중간 동기화는 생략하고, 인덱스 페이지가 캐시에 남도록 캐시를 키움
+    int synchronous = 2;
+    int cache_size = -2000;
+    query_int(db, "PRAGMA synchronous;", &synchronous);
+    query_int(db, "PRAGMA cache_size;", &cache_size);
+    database_execute_query(db, "PRAGMA synchronous = OFF;");
+    database_execute_query(db, "PRAGMA cache_size = -262144;");
+
+    SavedIndexes saved;
+    memset(&saved, 0, sizeof(SavedIndexes));
+
+    int status = database_begin_immediate_transaction(db);
+    if (status == SUCCESS) {
+        status = drop_secondary_indexes(db, &saved);
+    }
+    if (status == SUCCESS) {
+        status = database_pause_book_search_index(db);
+    }
+    if (status == SUCCESS) {
+        status = generate_books(&gen);
+    }
+    if (status == SUCCESS) {
+        status = generate_members(&gen);
+    }
+    if (status == SUCCESS) {
+        status = generate_loans(&gen);
+    }
+    if (status == SUCCESS) {
+        status = update_availability(&gen);
+    }
+    if (status == SUCCESS) {
+        status = restore_secondary_indexes(db, &saved);
+    }
+    if (status == SUCCESS) {
+        status = database_create_book_search_index(db);
+    }
+
+    if (status == SUCCESS) {
+        status = database_commit_transaction(db);
+    }
+    if (status != SUCCESS) {
+        database_rollback_transaction(db);
+        memset(gen.stats, 0, sizeof(DatasetGeneratorStats));
+    }
+
+    char pragma[64];
+    snprintf(pragma, sizeof(pragma), "PRAGMA synchronous = %d;", synchronous);
+    database_execute_query(db, pragma);
+    snprintf(pragma, sizeof(pragma), "PRAGMA cache_size = %d;", cache_size);
+    database_execute_query(db, pragma);
+
+    free_saved_indexes(&saved);
+    free_generator(&gen);
+
+    gen.stats->elapsed_seconds = (timer_now_nanoseconds() - start_ns) / 1e9;
+    return status;
+}
@@ -0,0 +1,341 @@
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE                     // copy_file_range, sync_file_range
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#endif
+#ifdef __linux__
+#include <sys/ioctl.h>
+#include <sys/sendfile.h>
+#include <linux/fs.h>
+#ifndef FICLONE
+#define FICLONE _IOW(0x94, 9, int)
+#endif
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 27))
+#define FILE_COPY_HAVE_COPY_FILE_RANGE 1
+#endif
+#endif
+#include "../include/file_copy.h"
+#include "../include/utils.h"
+
+// 이 방법을 쓸 수 없어 다음 방법으로 넘어가야 함 (아직 아무것도 쓰지 않음)
+#define COPY_UNSUPPORTED 1
+
+const char *file_copy_method_name(FileCopyMethod method) {
+    switch (method) {
+        case FILE_COPY_REFLINK: return "reflink";
+        case FILE_COPY_RANGE: return "copy_file_range";
+        case FILE_COPY_SENDFILE: return "sendfile";
+        case FILE_COPY_BUFFER: return "buffer";
+        default: return "auto";
+    }
+}
+
+#ifndef _WIN32
+
+// 쓴 내용을 디스크로 내려 쓰고 페이지 캐시에서 내보내는 상태
+typedef struct {
+    int fd;
+    long long flushed;             // 여기까지는 내려 쓰기를 시작함
+    long long pending_offset;      // 내려 쓰는 중인 이전 범위
+    long long pending_length;
+} WriteBehind;
+
+// offset까지 쓴 내용이 FILE_COPY_CHUNK_SIZE만큼 쌓이면 내려 쓰기를 시작하고, 이전 범위는 끝나기를 기다려
+// 캐시에서 내보냄. 쓰는 동안 다음 범위를 복사할 수 있도록 한 범위씩 늦춰 기다림
+static void write_behind(WriteBehind *state, long long offset, int force) {
+    long long length = offset - state->flushed;
+    if (length <= 0 || (!force && length < FILE_COPY_CHUNK_SIZE)) {
+        return;
+    }
+#ifdef __linux__
+    sync_file_range(state->fd, state->flushed, length, SYNC_FILE_RANGE_WRITE);
+    if (state->pending_length > 0) {
+        sync_file_range(state->fd, state->pending_offset, state->pending_length,
+                        SYNC_FILE_RANGE_WAIT_BEFORE | SYNC_FILE_RANGE_WRITE | SYNC_FILE_RANGE_WAIT_AFTER);
+        posix_fadvise(state->fd, state->pending_offset, state->pending_length, POSIX_FADV_DONTNEED);
+    }
+#endif
+    state->pending_offset = state->flushed;
+    state->pending_length = length;
+    state->flushed = offset;
+}
+
+#ifdef __linux__
+static int copy_reflink(int in, int out, long long size, long long *copied) {
+    if (ioctl(out, FICLONE, in) != 0) {
+        return COPY_UNSUPPORTED;
+    }
+    *copied = size;
+    return SUCCESS;
+}
+
+#ifdef FILE_COPY_HAVE_COPY_FILE_RANGE
+static int copy_range(int in, int out, long long size, long long *copied, WriteBehind *behind) {
+    while (*copied < size) {
+        long long remaining = size - *copied;
+        ssize_t written = copy_file_range(in, NULL, out, NULL,
+                                          (size_t)(remaining < FILE_COPY_CHUNK_SIZE ? remaining : FILE_COPY_CHUNK_SIZE), 0);
+        if (written < 0 && errno == EINTR) {
+            continue;
+        }
+        if (written <= 0) {
+            // 처음부터 안 되면 파일 시스템이나 커널이 지원하지 않는 것 (EXDEV, ENOSYS, EOPNOTSUPP 등)
+            if (*copied == 0) {
+                return COPY_UNSUPPORTED;
+            }
+            if (written == 0) {
+                break;                  // 복사하는 사이에 원본이 줄어듦
+            }
+            fprintf(stderr, "copy_file_range 실패: %s\n", strerror(errno));
+            return FAILURE;
+        }
+        *copied += written;
+        write_behind(behind, *copied, FALSE);
+    }
+    return SUCCESS;
+}
+#endif
+
+static int copy_sendfile(int in, int out, long long size, long long *copied, WriteBehind *behind) {
+    off_t offset = 0;
+    while (*copied < size) {
+        long long remaining = size - *copied;
+        ssize_t written = sendfile(out, in, &offset,
+                                   (size_t)(remaining < FILE_COPY_CHUNK_SIZE ? remaining : FILE_COPY_CHUNK_SIZE));
+        if (written < 0 && errno == EINTR) {
+            continue;
+        }
+        if (written <= 0) {
+            if (*copied == 0) {
+                return COPY_UNSUPPORTED;
+            }
+            if (written == 0) {
+                break;
+            }
+            fprintf(stderr, "sendfile 실패: %s\n", strerror(errno));
+            return FAILURE;
+        }
+        *copied += written;
+        write_behind(behind, *copied, FALSE);
+    }
+    return SUCCESS;
+}
+#endif
+
+static int copy_buffered(int in, int out, long long *copied, WriteBehind *behind) {
+    // 앞선 방법이 실패했을 수 있으므로 처음부터 다시 씀
+    if (lseek(in, 0, SEEK_SET) != 0 || lseek(out, 0, SEEK_SET) != 0 || ftruncate(out, 0) != 0) {
+        fprintf(stderr, "파일 위치 초기화 실패: %s\n", strerror(errno));
+        return FAILURE;
+    }
+    *copied = 0;
+
+    char *buffer = malloc(FILE_COPY_BUFFER_SIZE);
+    if (!buffer) {
+        fprintf(stderr, "메모리 할당 실패\n");
+        return FAILURE;
+    }
+    int result = SUCCESS;
+    while (1) {
+        ssize_t read_bytes = read(in, buffer, FILE_COPY_BUFFER_SIZE);
+        if (read_bytes < 0 && errno == EINTR) {
+            continue;
+        }
+        if (read_bytes <= 0) {
+            if (read_bytes < 0) {
+                fprintf(stderr, "원본 파일 읽기 실패: %s\n", strerror(errno));
+                result = FAILURE;
+            }
+            break;
+        }
+        for (ssize_t done = 0; done < read_bytes;) {
+            ssize_t written = write(out, buffer + done, (size_t)(read_bytes - done));
+            if (written < 0 && errno == EINTR) {
+                continue;
+            }
+            if (written <= 0) {
+                fprintf(stderr, "대상 파일 쓰기 실패: %s\n", strerror(errno));
+                result = FAILURE;
+                break;
+            }
+            done += written;
+        }
+        if (result != SUCCESS) {
+            break;
+        }
+        *copied += read_bytes;
+        write_behind(behind, *copied, FALSE);
+    }
+    free(buffer);
+    return result;
+}
+
+static int copy_posix(const char *source_path, const char *dest_path, FileCopyMethod method,
+                      FileCopyStats *stats, int *created) {
+    int in = open(source_path, O_RDONLY);
+    if (in < 0) {
+        fprintf(stderr, "원본 파일을 열 수 없습니다: %s\n", source_path);
+        return FAILURE;
+    }
+    struct stat source_info;
+    struct stat dest_info;
+    if (fstat(in, &source_info) != 0 || !S_ISREG(source_info.st_mode)) {
+        fprintf(stderr, "일반 파일이 아닙니다: %s\n", source_path);
+        close(in);
+        return FAILURE;
+    }
+    // 같은 파일을 O_TRUNC로 열면 원본이 지워짐
+    if (stat(dest_path, &dest_info) == 0 && dest_info.st_dev == source_info.st_dev &&
+        dest_info.st_ino == source_info.st_ino) {
+        fprintf(stderr, "원본과 대상이 같은 파일입니다: %s\n", dest_path);
+        close(in);
+        return FAILURE;
+    }
+    int out = open(dest_path, O_WRONLY | O_CREAT | O_TRUNC, source_info.st_mode & 0777);
+    if (out < 0) {
+        fprintf(stderr, "대상 파일을 만들 수 없습니다: %s\n", dest_path);
+        close(in);
+        return FAILURE;
+    }
+    *created = TRUE;
+
+    // 한 번만 순서대로 읽는다고 알려 미리 읽기를 늘림
+#ifdef POSIX_FADV_SEQUENTIAL
+    posix_fadvise(in, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+#ifdef POSIX_FADV_NOREUSE
+    posix_fadvise(in, 0, 0, POSIX_FADV_NOREUSE);
+#endif
+
+    long long size = source_info.st_size;
+    WriteBehind behind = { out, 0, 0, 0 };
+    int result = COPY_UNSUPPORTED;
+#ifdef __linux__
+    if (method == FILE_COPY_AUTO || method == FILE_COPY_REFLINK) {
+        stats->method = FILE_COPY_REFLINK;
+        result = copy_reflink(in, out, size, &stats->bytes);
+    }
+#ifdef FILE_COPY_HAVE_COPY_FILE_RANGE
+    if (result == COPY_UNSUPPORTED && (method == FILE_COPY_AUTO || method == FILE_COPY_RANGE)) {
+        stats->method = FILE_COPY_RANGE;
+        result = copy_range(in, out, size, &stats->bytes, &behind);
+    }
+#endif
+    if (result == COPY_UNSUPPORTED && (method == FILE_COPY_AUTO || method == FILE_COPY_SENDFILE)) {
+        stats->method = FILE_COPY_SENDFILE;
+        result = copy_sendfile(in, out, size, &stats->bytes, &behind);
+    }
+#endif
+    if (result == COPY_UNSUPPORTED && (method == FILE_COPY_AUTO || method == FILE_COPY_BUFFER)) {
+        stats->method = FILE_COPY_BUFFER;
+        result = copy_buffered(in, out, &stats->bytes, &behind);
+    }
+
+    if (result == SUCCESS) {
+        write_behind(&behind, stats->bytes, TRUE);
+#ifdef __linux__
+        if (fdatasync(out) != 0) {
+#else
+        if (fsync(out) != 0) {
+#endif
+            fprintf(stderr, "대상 파일을 디스크에 쓰지 못했습니다: %s\n", dest_path);
+            result = FAILURE;
+        }
+#ifdef POSIX_FADV_DONTNEED
+        // 백업 사본은 다시 읽지 않으므로 캐시에 남기지 않음
+        posix_fadvise(out, 0, 0, POSIX_FADV_DONTNEED);
+#endif
+    }
+    close(in);
+    if (close(out) != 0 && result == SUCCESS) {
+        fprintf(stderr, "대상 파일 닫기 실패: %s\n", dest_path);
+        result = FAILURE;
+    }
+    return result;
+}
+
+#else
+
+static int copy_stdio(const char *source_path, const char *dest_path, FileCopyMethod method,
+                      FileCopyStats *stats, int *created) {
+    if (method != FILE_COPY_AUTO && method != FILE_COPY_BUFFER) {
+        return COPY_UNSUPPORTED;
+    }
+    FILE *source = fopen(source_path, "rb");
+    if (!source) {
+        fprintf(stderr, "원본 파일을 열 수 없습니다: %s\n", source_path);
+        return FAILURE;
+    }
+    FILE *dest = fopen(dest_path, "wb");
+    if (!dest) {
+        fprintf(stderr, "대상 파일을 만들 수 없습니다: %s\n", dest_path);
+        fclose(source);
+        return FAILURE;
+    }
+    *created = TRUE;
+    stats->method = FILE_COPY_BUFFER;
+
+    char *buffer = malloc(FILE_COPY_BUFFER_SIZE);
+    int result = buffer ? SUCCESS : FAILURE;
+    size_t bytes;
+    while (result == SUCCESS && (bytes = fread(buffer, 1, FILE_COPY_BUFFER_SIZE, source)) > 0) {
+        if (fwrite(buffer, 1, bytes, dest) != bytes) {
+            fprintf(stderr, "대상 파일 쓰기 실패: %s\n", dest_path);
+            result = FAILURE;
+        }
+        stats->bytes += bytes;
+    }
+    if (ferror(source)) {
+        fprintf(stderr, "원본 파일 읽기 실패: %s\n", source_path);
+        result = FAILURE;
+    }
+    free(buffer);
+    fclose(source);
+    if (fclose(dest) != 0) {
+        result = FAILURE;
+    }
+    return result;
+}
+
+#endif
+
+int file_copy(const char *source_path, const char *dest_path, FileCopyMethod method, FileCopyStats *stats) {
+    FileCopyStats current;
+    memset(&current, 0, sizeof(FileCopyStats));
+    current.method = method;
+    if (stats) {
+        *stats = current;
+    }
+    if (!source_path || !dest_path || method < FILE_COPY_AUTO || method > FILE_COPY_BUFFER) {
+        fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
+        return FAILURE;
+    }
+
+    long long start_ns = timer_now_nanoseconds();
+    int created = FALSE;
+#ifndef _WIN32
+    int result = copy_posix(source_path, dest_path, method, &current, &created);
+#else
+    int result = copy_stdio(source_path, dest_path, method, &current, &created);
+#endif
+    if (result == COPY_UNSUPPORTED) {
+        fprintf(stderr, "이 시스템에서 쓸 수 없는 복사 방법입니다: %s\n", file_copy_method_name(method));
+        result = FAILURE;
+    }
+    if (result != SUCCESS && created) {
+        remove(dest_path);
+    }
+
+    current.elapsed_seconds = (timer_now_nanoseconds() - start_ns) / 1e9;
+    if (stats) {
+        *stats = current;
+    }
+    return result;
+}
@@ -0,0 +1,310 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sqlite3.h>
+#include "../include/fine.h"
+#include "../include/database.h"
+#include "../include/utils.h"
+#include "../include/constants.h"
+
+// 기준 시각(?1) 현재 연체 중인 대출의 연체료와 이전 정산액과의 차액을 계산하는 질의
+// 미반납 대출만 대상으로 하므로 idx_loans_open_due_date 부분 인덱스 범위 조회로 처리됨
+#define FINE_DELTA_SELECT \
+    "INSERT INTO temp.fine_delta (loan_id, member_id, overdue_days, amount, delta) " \
+    "SELECT loan_id, member_id, overdue_days, amount, amount - previous_amount FROM (" \
+    "SELECT l.id AS loan_id, l.member_id AS member_id, " \
+    "CAST(julianday(?1) - julianday(l.due_date) AS INTEGER) AS overdue_days, " \
+    "MIN(CAST(julianday(?1) - julianday(l.due_date) AS INTEGER) * COALESCE(p.daily_rate, ?2), " \
+    "COALESCE(p.max_fine, ?3)) AS amount, " \
+    "COALESCE(f.amount, 0) AS previous_amount " \
+    "FROM loans l " \
+    "JOIN books b ON b.id = l.book_id " \
+    "LEFT JOIN fee_policies p ON p.category = b.category " \
+    "LEFT JOIN loan_fines f ON f.loan_id = l.id " \
+    "WHERE l.is_returned = 0 AND l.due_date < ?1"
+
+static int prepare_fine_delta_table(sqlite3 *db) {
+    const char *sql =
+        "CREATE TEMP TABLE IF NOT EXISTS fine_delta ("
+        "loan_id INTEGER PRIMARY KEY,"
+        "member_id INTEGER NOT NULL,"
+        "overdue_days INTEGER NOT NULL,"
+        "amount INTEGER NOT NULL,"
+        "delta INTEGER NOT NULL"
+        ");"
+        "DELETE FROM temp.fine_delta;";
+
+    return database_execute_query(db, sql);
+}
+
+// 차액 테이블을 연체료 원장과 회원 잔액에 반영 (호출자가 트랜잭션을 관리)
+static int apply_fine_delta(sqlite3 *db, const char *fill_sql, const char *as_of_str, int loan_id) {
+    sqlite3_stmt *stmt = NULL;
+
+    if (prepare_fine_delta_table(db) != SUCCESS) {
+        return FAILURE;
+    }
+
+    if (database_prepare_statement(db, fill_sql, &stmt) != SUCCESS) {
+        return FAILURE;
+    }
+
+    sqlite3_bind_text(stmt, 1, as_of_str, -1, SQLITE_STATIC);
+    sqlite3_bind_int(stmt, 2, DEFAULT_DAILY_FINE);
+    sqlite3_bind_int(stmt, 3, DEFAULT_MAX_FINE);
+    if (loan_id > 0) {
+        sqlite3_bind_int(stmt, 4, loan_id);
+    }
+
+    if (sqlite3_step(stmt) != SQLITE_DONE) {
+        fprintf(stderr, "연체료 계산 실패: %s\n", sqlite3_errmsg(db));
+        sqlite3_finalize(stmt);
+        return FAILURE;
+    }
+
+    sqlite3_finalize(stmt);
+
+    int changed_count = sqlite3_changes(db);
+    if (changed_count == 0) {
+        return 0;
+    }
+
+    const char *ledger_sql =
+        "INSERT INTO loan_fines (loan_id, member_id, overdue_days, amount, accrued_at) "
+        "SELECT loan_id, member_id, overdue_days, amount, ?1 FROM temp.fine_delta WHERE true "
+        "ON CONFLICT(loan_id) DO UPDATE SET overdue_days = excluded.overdue_days, "
+        "amount = excluded.amount, accrued_at = excluded.accrued_at;";
+
+    if (database_prepare_statement(db, ledger_sql, &stmt) != SUCCESS) {
+        return FAILURE;
+    }
+
+    sqlite3_bind_text(stmt, 1, as_of_str, -1, SQLITE_STATIC);
+
+    if (sqlite3_step(stmt) != SQLITE_DONE) {
+        fprintf(stderr, "연체료 원장 갱신 실패: %s\n", sqlite3_errmsg(db));
+        sqlite3_finalize(stmt);
+        return FAILURE;
+    }
+
+    sqlite3_finalize(stmt);
+
+    const char *balance_sql =
+        "INSERT INTO member_balances (member_id, balance, updated_at) "
+        "SELECT member_id, SUM(delta), CURRENT_TIMESTAMP FROM temp.fine_delta "
+        "WHERE true GROUP BY member_id "
+        "ON CONFLICT(member_id) DO UPDATE SET balance = balance + excluded.balance, "
+        "updated_at = excluded.updated_at;";
+
+    if (database_execute_query(db, balance_sql) != SUCCESS) {
+        return FAILURE;
+    }
+
+    return changed_count;
+}
+
+int set_fee_policy(sqlite3 *db, const char *category, int daily_rate, int max_fine) {
+    if (!db || is_empty_string(category) || daily_rate < 0 || max_fine < 0) {
+        fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
+        return FAILURE;
+    }
+
+    const char *sql =
+        "INSERT INTO fee_policies (category, daily_rate, max_fine) VALUES (?, ?, ?) "
+        "ON CONFLICT(category) DO UPDATE SET daily_rate = excluded.daily_rate, "
+        "max_fine = excluded.max_fine, updated_at = CURRENT_TIMESTAMP;";
+
+    sqlite3_stmt *stmt = NULL;
+    int result = FAILURE;
+
+    if (database_prepare_statement(db, sql, &stmt) != SUCCESS) {
+        return FAILURE;
+    }
+
+    sqlite3_bind_text(stmt, 1, category, -1, SQLITE_STATIC);
+    sqlite3_bind_int(stmt, 2, daily_rate);
+    sqlite3_bind_int(stmt, 3, max_fine);
+
+    if (sqlite3_step(stmt) == SQLITE_DONE) {
+        result = SUCCESS;
+    } else {
+        fprintf(stderr, "연체료 정책 저장 실패: %s\n", sqlite3_errmsg(db));
+    }
+
+    sqlite3_finalize(stmt);
+    return result;
+}
+
+int accrue_fines(sqlite3 *db, time_t as_of) {
+    if (!db) {
+        fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
+        return FAILURE;
+    }
+
+    char as_of_str[32];
+    time_to_sql_string(as_of, as_of_str, sizeof(as_of_str));
+
+    if (database_begin_immediate_transaction(db) != SUCCESS) {
+        return FAILURE;
+    }
+
+    int changed_count = apply_fine_delta(db, FINE_DELTA_SELECT ") WHERE amount <> previous_amount;",
+                                         as_of_str, 0);
+
+    if (changed_count == FAILURE) {
+        database_rollback_transaction(db);
+        return FAILURE;
+    }
+
+    if (database_commit_transaction(db) != SUCCESS) {
+        return FAILURE;
+    }
+
+    return changed_count;
+}
+
+int accrue_loan_fine(sqlite3 *db, int loan_id, time_t as_of) {
+    if (!db || loan_id <= 0) {
+        fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
+        return FAILURE;
+    }
+
+    char as_of_str[32];
+    time_to_sql_string(as_of, as_of_str, sizeof(as_of_str));
+
+    int changed_count = apply_fine_delta(db,
+                                         FINE_DELTA_SELECT " AND l.id = ?4) WHERE amount <> previous_amount;",
+                                         as_of_str, loan_id);
+
+    return changed_count == FAILURE ? FAILURE : SUCCESS;
+}
+
+int get_member_balance(sqlite3 *db, int member_id, int *balance) {
+    if (!db || member_id <= 0 || !balance) {
+        fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
+        return FAILURE;
+    }
+
+    const char *sql = "SELECT balance FROM member_balances WHERE member_id = ?;";
+    sqlite3_stmt *stmt = NULL;
+    int result = FAILURE;
+
+    if (database_prepare_statement(db, sql, &stmt) != SUCCESS) {
+        return FAILURE;
+    }
+
+    sqlite3_bind_int(stmt, 1, member_id);
+
+    int step_result = sqlite3_step(stmt);
+    if (step_result == SQLITE_ROW) {
+        *balance = sqlite3_column_int(stmt, 0);
+        result = SUCCESS;
+    } else if (step_result == SQLITE_DONE) {
+        *balance = 0;
+        result = SUCCESS;
+    } else {
+        fprintf(stderr, "미납 잔액 조회 실패: %s\n", sqlite3_errmsg(db));
+    }
+
+    sqlite3_finalize(stmt);
+    return result;
+}
+
+int pay_fine(sqlite3 *db, int member_id, int amount) {
+    if (!db || member_id <= 0 || amount <= 0) {
+        fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
+        return FAILURE;
+    }
+
+    if (database_begin_immediate_transaction(db) != SUCCESS) {
+        return FAILURE;
+    }
+
+    int balance = 0;
+    if (get_member_balance(db, member_id, &balance) != SUCCESS) {
+        database_rollback_transaction(db);
+        return FAILURE;
+    }
+
+    if (amount > balance) {
+        fprintf(stderr, "납부 금액이 미납 잔액(%d원)보다 큽니다.\n", balance);
+        database_rollback_transaction(db);
+        return FAILURE;
+    }
+
+    const char *payment_sql = "INSERT INTO fine_payments (member_id, amount) VALUES (?, ?);";
+    sqlite3_stmt *stmt = NULL;
+
+    if (database_prepare_statement(db, payment_sql, &stmt) != SUCCESS) {
+        database_rollback_transaction(db);
+        return FAILURE;
+    }
+
+    sqlite3_bind_int(stmt, 1, member_id);
+    sqlite3_bind_int(stmt, 2, amount);
+
+    if (sqlite3_step(stmt) != SQLITE_DONE) {
+        fprintf(stderr, "납부 기록 저장 실패: %s\n", sqlite3_errmsg(db));
+        sqlite3_finalize(stmt);
+        database_rollback_transaction(db);
+        return FAILURE;
+    }
+
+    sqlite3_finalize(stmt);
+
+    const char *balance_sql =
+        "UPDATE member_balances SET balance = balance - ?, updated_at = CURRENT_TIMESTAMP "
+        "WHERE member_id = ?;";
+
+    if (database_prepare_statement(db, balance_sql, &stmt) != SUCCESS) {
+        database_rollback_transaction(db);
+        return FAILURE;
+    }
+
+    sqlite3_bind_int(stmt, 1, amount);
+    sqlite3_bind_int(stmt, 2, member_id);
+
+    if (sqlite3_step(stmt) != SQLITE_DONE) {
+        fprintf(stderr, "미납 잔액 갱신 실패: %s\n", sqlite3_errmsg(db));
+        sqlite3_finalize(stmt);
+        database_rollback_transaction(db);
+        return FAILURE;
+    }
+
+    sqlite3_finalize(stmt);
+
+    if (database_commit_transaction(db) != SUCCESS) {
+        return FAILURE;
+    }
+
+    return SUCCESS;
+}
+
+int get_loan_fine(sqlite3 *db, int loan_id, int *amount) {
+    if (!db || loan_id <= 0 || !amount) {
+        fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
+        return FAILURE;
+    }
+
+    const char *sql = "SELECT amount FROM loan_fines WHERE loan_id = ?;";
+    sqlite3_stmt *stmt = NULL;
+    int result = FAILURE;
+
+    if (database_prepare_statement(db, sql, &stmt) != SUCCESS) {
+        return FAILURE;
+    }
+
+    sqlite3_bind_int(stmt, 1, loan_id);
+
+    int step_result = sqlite3_step(stmt);
+    if (step_result == SQLITE_ROW || step_result == SQLITE_DONE) {
+        *amount = step_result == SQLITE_ROW ? sqlite3_column_int(stmt, 0) : 0;
+        result = SUCCESS;
+    } else {
+        fprintf(stderr, "연체료 조회 실패: %s\n", sqlite3_errmsg(db));
+    }
+
+    sqlite3_finalize(stmt);
+    return result;
+}
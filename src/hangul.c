@@ -0,0 +1,271 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <sqlite3.h>
+#include "../include/hangul.h"
+
+// 한글 음절 영역 (가 ~ 힣)
+#define HANGUL_SYLLABLE_BASE 0xAC00
+#define HANGUL_SYLLABLE_LAST 0xD7A3
+#define HANGUL_JUNG_COUNT 21
+#define HANGUL_JONG_COUNT 28
+
+// 호환 자모 중 자음 영역 (ㄱ ~ ㅎ)
+#define HANGUL_CONSONANT_FIRST 0x3131
+#define HANGUL_CONSONANT_LAST 0x314E
+
+// 모음 호환 자모 시작 (ㅏ), 중성은 ㅏ ~ ㅣ 순서대로 연속
+#define HANGUL_VOWEL_FIRST 0x314F
+
+// 초성 인덱스 → 호환 자모
+static const unsigned int chosung_table[] = {
+    0x3131, 0x3132, 0x3134, 0x3137, 0x3138, 0x3139, 0x3141, 0x3142, 0x3143, 0x3145,
+    0x3146, 0x3147, 0x3148, 0x3149, 0x314A, 0x314B, 0x314C, 0x314D, 0x314E
+};
+
+// 종성 인덱스 → 호환 자모 (0은 종성 없음)
+static const unsigned int jongsung_table[] = {
+    0,      0x3131, 0x3132, 0x3133, 0x3134, 0x3135, 0x3136, 0x3137, 0x3139, 0x313A,
+    0x313B, 0x313C, 0x313D, 0x313E, 0x313F, 0x3140, 0x3141, 0x3142, 0x3144, 0x3145,
+    0x3146, 0x3147, 0x3148, 0x314A, 0x314B, 0x314C, 0x314D, 0x314E
+};
+
+// UTF-8 한 글자를 해석하여 코드 포인트와 바이트 수를 반환 (잘못된 바이트는 1바이트 그대로)
+static int utf8_decode(const unsigned char *s, unsigned int *code_point) {
+    if (s[0] < 0x80) {
+        *code_point = s[0];
+        return 1;
+    }
+    if ((s[0] & 0xE0) == 0xC0 && (s[1] & 0xC0) == 0x80) {
+        *code_point = ((s[0] & 0x1F) << 6) | (s[1] & 0x3F);
+        return 2;
+    }
+    if ((s[0] & 0xF0) == 0xE0 && (s[1] & 0xC0) == 0x80 && (s[2] & 0xC0) == 0x80) {
+        *code_point = ((s[0] & 0x0F) << 12) | ((s[1] & 0x3F) << 6) | (s[2] & 0x3F);
+        return 3;
+    }
+    if ((s[0] & 0xF8) == 0xF0 && (s[1] & 0xC0) == 0x80 && (s[2] & 0xC0) == 0x80 &&
+        (s[3] & 0xC0) == 0x80) {
+        *code_point = ((s[0] & 0x07) << 18) | ((s[1] & 0x3F) << 12) |
+                      ((s[2] & 0x3F) << 6) | (s[3] & 0x3F);
+        return 4;
+    }
+    *code_point = 0;
+    return 1;
+}
+
+// 코드 포인트를 UTF-8로 출력 버퍼에 추가
+static int utf8_append(char *dst, size_t dst_size, size_t *length, unsigned int code_point) {
+    unsigned char bytes[4];
+    int count;
+
+    if (code_point < 0x80) {
+        bytes[0] = (unsigned char)code_point;
+        count = 1;
+    } else if (code_point < 0x800) {
+        bytes[0] = (unsigned char)(0xC0 | (code_point >> 6));
+        bytes[1] = (unsigned char)(0x80 | (code_point & 0x3F));
+        count = 2;
+    } else if (code_point < 0x10000) {
+        bytes[0] = (unsigned char)(0xE0 | (code_point >> 12));
+        bytes[1] = (unsigned char)(0x80 | ((code_point >> 6) & 0x3F));
+        bytes[2] = (unsigned char)(0x80 | (code_point & 0x3F));
+        count = 3;
+    } else {
+        bytes[0] = (unsigned char)(0xF0 | (code_point >> 18));
+        bytes[1] = (unsigned char)(0x80 | ((code_point >> 12) & 0x3F));
+        bytes[2] = (unsigned char)(0x80 | ((code_point >> 6) & 0x3F));
+        bytes[3] = (unsigned char)(0x80 | (code_point & 0x3F));
+        count = 4;
+    }
+
+    if (*length + count >= dst_size) {
+        return FAILURE;
+    }
+
+    memcpy(dst + *length, bytes, count);
+    *length += count;
+    return SUCCESS;
+}
+
+// 원본 바이트를 그대로 출력 버퍼에 추가 (잘못된 UTF-8 보존용)
+static int raw_append(char *dst, size_t dst_size, size_t *length, const char *src, int count) {
+    if (*length + count >= dst_size) {
+        return FAILURE;
+    }
+
+    memcpy(dst + *length, src, count);
+    *length += count;
+    return SUCCESS;
+}
+
+static int is_hangul_syllable(unsigned int code_point) {
+    return code_point >= HANGUL_SYLLABLE_BASE && code_point <= HANGUL_SYLLABLE_LAST;
+}
+
+static int is_hangul_consonant(unsigned int code_point) {
+    return code_point >= HANGUL_CONSONANT_FIRST && code_point <= HANGUL_CONSONANT_LAST;
+}
+
+// 검색 키에서 제외할 공백 문자
+static int is_search_space(unsigned int code_point) {
+    return code_point == ' ' || code_point == '\t' || code_point == '\n' ||
+           code_point == '\r' || code_point == 0x3000;
+}
+
+// 문자열을 한 글자씩 변환 (chosung_only가 TRUE면 초성만 남김)
+static int transform(const char *src, char *dst, size_t dst_size, int chosung_only) {
+    if (!src || !dst || dst_size == 0) {
+        return FAILURE;
+    }
+
+    const unsigned char *p = (const unsigned char*)src;
+    size_t length = 0;
+
+    while (*p) {
+        unsigned int code_point;
+        int byte_count = utf8_decode(p, &code_point);
+        int status = SUCCESS;
+
+        if (code_point == 0) {
+            status = raw_append(dst, dst_size, &length, (const char*)p, byte_count);
+        } else if (is_search_space(code_point)) {
+            // 공백 제거
+        } else if (is_hangul_syllable(code_point)) {
+            unsigned int index = code_point - HANGUL_SYLLABLE_BASE;
+            unsigned int cho = index / (HANGUL_JUNG_COUNT * HANGUL_JONG_COUNT);
+            unsigned int jung = (index % (HANGUL_JUNG_COUNT * HANGUL_JONG_COUNT)) / HANGUL_JONG_COUNT;
+            unsigned int jong = index % HANGUL_JONG_COUNT;
+
+            status = utf8_append(dst, dst_size, &length, chosung_table[cho]);
+            if (!chosung_only) {
+                if (status == SUCCESS) {
+                    status = utf8_append(dst, dst_size, &length, HANGUL_VOWEL_FIRST + jung);
+                }
+                if (status == SUCCESS && jong != 0) {
+                    status = utf8_append(dst, dst_size, &length, jongsung_table[jong]);
+                }
+            }
+        } else if (code_point < 0x80) {
+            if (!chosung_only || isalnum((int)code_point)) {
+                status = utf8_append(dst, dst_size, &length, (unsigned int)tolower((int)code_point));
+            }
+        } else if (!chosung_only || is_hangul_consonant(code_point)) {
+            status = utf8_append(dst, dst_size, &length, code_point);
+        }
+
+        if (status != SUCCESS) {
+            dst[0] = '\0';
+            return FAILURE;
+        }
+
+        p += byte_count;
+    }
+
+    dst[length] = '\0';
+    return (int)length;
+}
+
+int hangul_normalize(const char *src, char *dst, size_t dst_size) {
+    return transform(src, dst, dst_size, FALSE);
+}
+
+int hangul_extract_chosung(const char *src, char *dst, size_t dst_size) {
+    return transform(src, dst, dst_size, TRUE);
+}
+
+int hangul_is_chosung_query(const char *src) {
+    if (!src) {
+        return FALSE;
+    }
+
+    const unsigned char *p = (const unsigned char*)src;
+    int consonant_count = 0;
+
+    while (*p) {
+        unsigned int code_point;
+        p += utf8_decode(p, &code_point);
+
+        if (is_search_space(code_point)) {
+            continue;
+        }
+        if (!is_hangul_consonant(code_point)) {
+            return FALSE;
+        }
+        consonant_count++;
+    }
+
+    return consonant_count > 0 ? TRUE : FALSE;
+}
+
+int hangul_prefix_upper_bound(const char *prefix, char *dst, size_t dst_size) {
+    if (!prefix || !dst) {
+        return FAILURE;
+    }
+
+    size_t length = strlen(prefix);
+    if (length + 5 > dst_size) {
+        return FAILURE;
+    }
+
+    memcpy(dst, prefix, length);
+    memcpy(dst + length, "\xF4\x8F\xBF\xBF", 5);
+    return SUCCESS;
+}
+
+// SQL 함수 공통 처리: 입력의 3배 크기 버퍼에 변환 후 결과로 반환
+static void sql_transform(sqlite3_context *context, sqlite3_value *value, int chosung_only) {
+    if (sqlite3_value_type(value) == SQLITE_NULL) {
+        sqlite3_result_null(context);
+        return;
+    }
+
+    const char *text = (const char*)sqlite3_value_text(value);
+    int text_length = sqlite3_value_bytes(value);
+    size_t buffer_size = (size_t)text_length * 3 + 1;
+    char *buffer = sqlite3_malloc64(buffer_size);
+
+    if (!buffer) {
+        sqlite3_result_error_nomem(context);
+        return;
+    }
+
+    int length = transform(text ? text : "", buffer, buffer_size, chosung_only);
+    if (length == FAILURE) {
+        sqlite3_free(buffer);
+        sqlite3_result_error(context, "검색어 정규화 실패", -1);
+        return;
+    }
+
+    sqlite3_result_text(context, buffer, length, sqlite3_free);
+}
+
+static void sql_hangul_normalize(sqlite3_context *context, int argc, sqlite3_value **argv) {
+    (void)argc;
+    sql_transform(context, argv[0], FALSE);
+}
+
+static void sql_hangul_chosung(sqlite3_context *context, int argc, sqlite3_value **argv) {
+    (void)argc;
+    sql_transform(context, argv[0], TRUE);
+}
+
+int hangul_register_functions(sqlite3 *db) {
+    if (!db) {
+        fprintf(stderr, "유효하지 않은 데이터베이스 연결입니다.\n");
+        return FAILURE;
+    }
+
+    int flags = SQLITE_UTF8 | SQLITE_DETERMINISTIC;
+
+    if (sqlite3_create_function(db, "hangul_normalize", 1, flags, NULL,
+                                sql_hangul_normalize, NULL, NULL) != SQLITE_OK ||
+        sqlite3_create_function(db, "hangul_chosung", 1, flags, NULL,
+                                sql_hangul_chosung, NULL, NULL) != SQLITE_OK) {
+        fprintf(stderr, "검색 함수 등록 실패: %s\n", sqlite3_errmsg(db));
+        return FAILURE;
+    }
+
+    return SUCCESS;
+}
@@ -7,6 +7,12 @@
 #include "../include/book.h"
 #include "../include/member.h"
 #include "../include/database.h"
+#include "../include/calendar.h"
+#include "../include/fine.h"
+#include "../include/loan_event.h"
+#include "../include/metrics.h"
+#include "../include/workload_trace.h"
+#include "../include/utils.h"
 #include "../include/constants.h"
 
 static int loan_callback(void *data, int argc, char **argv, char **azColName);
@@ -20,51 +26,55 @@ typedef struct {
     int current_count;
 } PopularBooksData;
 
-int loan_book(sqlite3 *db, int book_id, int member_id, int loan_days) {
-    if (!db || book_id <= 0 || member_id <= 0) {
-        fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
-        return FAILURE;
-    }
-    
-    if (loan_days <= 0) {
-        loan_days = DEFAULT_LOAN_DAYS;
-    }
+static int to_local_tm(time_t time_val, struct tm *tm_out) {
+#ifdef _WIN32
+    return localtime_s(tm_out, &time_val) == 0 ? SUCCESS : FAILURE;
+#else
+    return localtime_r(&time_val, tm_out) ? SUCCESS : FAILURE;
+#endif
+}
+
+// 대출/반납/연장 처리 본문 (호출자가 연 트랜잭션 안에서 실행)
+// args는 연산별 정수 인자 배열이며, 성공 시 연산 결과(대출 ID 또는 SUCCESS)를 반환
+typedef int (*LoanOperation)(sqlite3 *db, const int *args);
+
+static int loan_book_in_transaction(sqlite3 *db, const int *args) {
+    int book_id = args[0];
+    int member_id = args[1];
+    int loan_days = args[2];
     
-    // 대출 가능 여부 확인
+    // 대출 가능 여부 확인 (쓰기 잠금을 잡은 상태에서 확인하여 동시 대출 방지)
     if (check_loan_availability(db, book_id, member_id) != SUCCESS) {
         return FAILURE;
     }
     
-    // 트랜잭션 시작
-    if (database_begin_transaction(db) != SUCCESS) {
-        return FAILURE;
-    }
+    // 반납 예정일 계산 (휴관일은 건너뜀)
+    char due_date_str[32];
+    time_t loan_time = time(NULL);
+    time_t due_date = calendar_compute_due_date(db, loan_time, loan_days);
+    time_to_sql_string(due_date, due_date_str, sizeof(due_date_str));
     
     // 대출 기록 추가
     const char *loan_sql = 
         "INSERT INTO loans (book_id, member_id, due_date) "
-        "VALUES (?, ?, datetime('now', '+%d days'));";
-    
-    char sql_buffer[MAX_SQL_LENGTH];
-    snprintf(sql_buffer, sizeof(sql_buffer), loan_sql, loan_days);
+        "VALUES (?, ?, ?);";
     
     sqlite3_stmt *loan_stmt = NULL;
     int loan_id = FAILURE;
     
-    if (database_prepare_statement(db, sql_buffer, &loan_stmt) != SUCCESS) {
-        database_rollback_transaction(db);
+    if (database_prepare_statement(db, loan_sql, &loan_stmt) != SUCCESS) {
         return FAILURE;
     }
     
     sqlite3_bind_int(loan_stmt, 1, book_id);
     sqlite3_bind_int(loan_stmt, 2, member_id);
+    sqlite3_bind_text(loan_stmt, 3, due_date_str, -1, SQLITE_STATIC);
     
     if (sqlite3_step(loan_stmt) == SQLITE_DONE) {
         loan_id = database_get_last_insert_id(db);
     } else {
         fprintf(stderr, "대출 기록 추가 실패: %s\n", sqlite3_errmsg(db));
         sqlite3_finalize(loan_stmt);
-        database_rollback_transaction(db);
         return FAILURE;
     }
     
@@ -78,7 +88,6 @@ int loan_book(sqlite3 *db, int book_id, int member_id, int loan_days) {
     sqlite3_stmt *update_stmt = NULL;
     
     if (database_prepare_statement(db, update_book_sql, &update_stmt) != SUCCESS) {
-        database_rollback_transaction(db);
         return FAILURE;
     }
     
@@ -87,25 +96,21 @@ int loan_book(sqlite3 *db, int book_id, int member_id, int loan_days) {
     if (sqlite3_step(update_stmt) != SQLITE_DONE) {
         fprintf(stderr, "도서 대출 가능 권수 업데이트 실패: %s\n", sqlite3_errmsg(db));
         sqlite3_finalize(update_stmt);
-        database_rollback_transaction(db);
         return FAILURE;
     }
     
     sqlite3_finalize(update_stmt);
     
-    // 트랜잭션 커밋
-    if (database_commit_transaction(db) != SUCCESS) {
+    // 대출 이벤트 기록
+    if (loan_event_append(db, LOAN_EVENT_CHECKOUT, loan_id, loan_time) != SUCCESS) {
         return FAILURE;
     }
     
     return loan_id;
 }
 
-int return_book(sqlite3 *db, int loan_id) {
-    if (!db || loan_id <= 0) {
-        fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
-        return FAILURE;
-    }
+static int return_book_in_transaction(sqlite3 *db, const int *args) {
+    int loan_id = args[0];
     
     // 대출 정보 조회
     Loan loan;
@@ -119,8 +124,9 @@ int return_book(sqlite3 *db, int loan_id) {
         return FAILURE;
     }
     
-    // 트랜잭션 시작
-    if (database_begin_transaction(db) != SUCCESS) {
+    // 반납 시점 기준으로 연체료 최종 정산
+    time_t return_time = time(NULL);
+    if (accrue_loan_fine(db, loan_id, return_time) != SUCCESS) {
         return FAILURE;
     }
     
@@ -132,7 +138,6 @@ int return_book(sqlite3 *db, int loan_id) {
     sqlite3_stmt *return_stmt = NULL;
     
     if (database_prepare_statement(db, return_sql, &return_stmt) != SUCCESS) {
-        database_rollback_transaction(db);
         return FAILURE;
     }
     
@@ -141,7 +146,6 @@ int return_book(sqlite3 *db, int loan_id) {
     if (sqlite3_step(return_stmt) != SQLITE_DONE) {
         fprintf(stderr, "반납 처리 실패: %s\n", sqlite3_errmsg(db));
         sqlite3_finalize(return_stmt);
-        database_rollback_transaction(db);
         return FAILURE;
     }
     
@@ -155,7 +159,6 @@ int return_book(sqlite3 *db, int loan_id) {
     sqlite3_stmt *update_stmt = NULL;
     
     if (database_prepare_statement(db, update_book_sql, &update_stmt) != SUCCESS) {
-        database_rollback_transaction(db);
         return FAILURE;
     }
     
@@ -164,25 +167,22 @@ int return_book(sqlite3 *db, int loan_id) {
     if (sqlite3_step(update_stmt) != SQLITE_DONE) {
         fprintf(stderr, "도서 대출 가능 권수 업데이트 실패: %s\n", sqlite3_errmsg(db));
         sqlite3_finalize(update_stmt);
-        database_rollback_transaction(db);
         return FAILURE;
     }
     
     sqlite3_finalize(update_stmt);
     
-    // 트랜잭션 커밋
-    if (database_commit_transaction(db) != SUCCESS) {
+    // 반납 이벤트 기록
+    if (loan_event_append(db, LOAN_EVENT_RETURN, loan_id, return_time) != SUCCESS) {
         return FAILURE;
     }
     
     return SUCCESS;
 }
 
-int return_book_by_ids(sqlite3 *db, int book_id, int member_id) {
-    if (!db || book_id <= 0 || member_id <= 0) {
-        fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
-        return FAILURE;
-    }
+static int return_book_by_ids_in_transaction(sqlite3 *db, const int *args) {
+    int book_id = args[0];
+    int member_id = args[1];
     
     // 해당 대출 기록 찾기
     const char *find_sql = 
@@ -210,14 +210,12 @@ int return_book_by_ids(sqlite3 *db, int book_id, int member_id) {
         return FAILURE;
     }
     
-    return return_book(db, loan_id);
+    return return_book_in_transaction(db, &loan_id);
 }
 
-int extend_loan(sqlite3 *db, int loan_id, int extend_days) {
-    if (!db || loan_id <= 0 || extend_days <= 0) {
-        fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
-        return FAILURE;
-    }
+static int extend_loan_in_transaction(sqlite3 *db, const int *args) {
+    int loan_id = args[0];
+    int extend_days = args[1];
     
     // 대출 정보 조회
     Loan loan;
@@ -261,25 +259,395 @@ int extend_loan(sqlite3 *db, int loan_id, int extend_days) {
     
     sqlite3_bind_int(extend_stmt, 1, loan_id);
     
-    if (sqlite3_step(extend_stmt) == SQLITE_DONE) {
-        sqlite3_finalize(extend_stmt);
-        return SUCCESS;
-    } else {
+    if (sqlite3_step(extend_stmt) != SQLITE_DONE) {
         fprintf(stderr, "대출 연장 실패: %s\n", sqlite3_errmsg(db));
         sqlite3_finalize(extend_stmt);
         return FAILURE;
     }
+    
+    sqlite3_finalize(extend_stmt);
+    
+    // 연장 이벤트 기록
+    if (loan_event_append(db, LOAN_EVENT_RENEW, loan_id, current_time) != SUCCESS) {
+        return FAILURE;
+    }
+    
+    return SUCCESS;
 }
 
-int get_loan_by_id(sqlite3 *db, int loan_id, Loan *loan) {
+// 유효 기간 내에 같은 요청 ID로 처리된 결과 조회 (찾으면 TRUE)
+static int find_request_result(sqlite3 *db, const char *request_id, const char *operation, int *result) {
+    const char *sql = 
+        "SELECT operation, result FROM request_dedupe "
+        "WHERE request_id = ? AND created_at >= ?;";
+    
+    sqlite3_stmt *stmt = NULL;
+    int found = FALSE;
+    
+    if (database_prepare_statement(db, sql, &stmt) != SUCCESS) {
+        return FALSE;
+    }
+    
+    sqlite3_bind_text(stmt, 1, request_id, -1, SQLITE_STATIC);
+    sqlite3_bind_int64(stmt, 2, (sqlite3_int64)(time(NULL) - REQUEST_DEDUPE_TTL_SECONDS));
+    
+    if (sqlite3_step(stmt) == SQLITE_ROW) {
+        const char *stored_operation = (const char*)sqlite3_column_text(stmt, 0);
+        
+        // 같은 요청 ID를 다른 작업에 재사용한 경우 실패로 처리
+        if (stored_operation && strcmp(stored_operation, operation) == 0) {
+            *result = sqlite3_column_int(stmt, 1);
+        } else {
+            fprintf(stderr, "요청 ID '%s'는 다른 작업(%s)에 이미 사용되었습니다.\n",
+                    request_id, stored_operation ? stored_operation : "");
+            *result = FAILURE;
+        }
+        found = TRUE;
+    }
+    
+    sqlite3_finalize(stmt);
+    return found;
+}
+
+static int record_request_result(sqlite3 *db, const char *request_id, const char *operation, int result) {
+    const char *sql = 
+        "INSERT OR REPLACE INTO request_dedupe (request_id, operation, result, created_at) "
+        "VALUES (?, ?, ?, ?);";
+    
+    sqlite3_stmt *stmt = NULL;
+    int status = FAILURE;
+    
+    if (database_prepare_statement(db, sql, &stmt) != SUCCESS) {
+        return FAILURE;
+    }
+    
+    sqlite3_bind_text(stmt, 1, request_id, -1, SQLITE_STATIC);
+    sqlite3_bind_text(stmt, 2, operation, -1, SQLITE_STATIC);
+    sqlite3_bind_int(stmt, 3, result);
+    sqlite3_bind_int64(stmt, 4, (sqlite3_int64)time(NULL));
+    
+    if (sqlite3_step(stmt) == SQLITE_DONE) {
+        status = SUCCESS;
+    } else {
+        fprintf(stderr, "요청 ID 기록 실패: %s\n", sqlite3_errmsg(db));
+    }
+    
+    sqlite3_finalize(stmt);
+    return status;
+}
+
+// 쓰기 잠금을 먼저 잡고(BEGIN IMMEDIATE) 중복 요청 확인, 처리, 요청 기록을 한 트랜잭션으로 실행
+// 성공한 결과만 기록하므로 실패한 요청은 같은 ID로 다시 시도할 수 있음
+static int execute_loan_operation(sqlite3 *db, const char *request_id, const char *operation,
+                                  LoanOperation loan_operation, const int *args) {
+    if (database_begin_immediate_transaction(db) != SUCCESS) {
+        return FAILURE;
+    }
+    
+    int result;
+    int has_request_id = !is_empty_string(request_id);
+    
+    if (has_request_id && find_request_result(db, request_id, operation, &result)) {
+        database_rollback_transaction(db);
+        return result;
+    }
+    
+    result = loan_operation(db, args);
+    
+    if (result == FAILURE ||
+        (has_request_id && record_request_result(db, request_id, operation, result) != SUCCESS)) {
+        database_rollback_transaction(db);
+        return FAILURE;
+    }
+    
+    if (database_commit_transaction(db) != SUCCESS) {
+        database_rollback_transaction(db);
+        return FAILURE;
+    }
+    
+    return result;
+}
+
+static int loan_book_impl(sqlite3 *db, int book_id, int member_id, int loan_days) {
+    return loan_book_idempotent(db, NULL, book_id, member_id, loan_days);
+}
+
+int loan_book(sqlite3 *db, int book_id, int member_id, int loan_days) {
+    long long start = metrics_start();
+    int status = loan_book_impl(db, book_id, member_id, loan_days);
+    metrics_record_since(METRIC_LOAN_BOOK, start, status);
+    workload_trace_record(METRIC_LOAN_BOOK, start, status, book_id, member_id, loan_days);
+    return status;
+}
+
+static int loan_book_idempotent_impl(sqlite3 *db, const char *request_id, int book_id, int member_id, int loan_days) {
+    if (!db || book_id <= 0 || member_id <= 0) {
+        fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
+        return FAILURE;
+    }
+    
+    if (loan_days <= 0) {
+        loan_days = DEFAULT_LOAN_DAYS;
+    }
+    
+    int args[3] = { book_id, member_id, loan_days };
+    return execute_loan_operation(db, request_id, "loan_book", loan_book_in_transaction, args);
+}
+
+int loan_book_idempotent(sqlite3 *db, const char *request_id, int book_id, int member_id, int loan_days) {
+    long long start = metrics_start();
+    int status = loan_book_idempotent_impl(db, request_id, book_id, member_id, loan_days);
+    metrics_record_since(METRIC_LOAN_BOOK_IDEMPOTENT, start, status);
+    workload_trace_record(METRIC_LOAN_BOOK_IDEMPOTENT, start, status, request_id, book_id, member_id, loan_days);
+    return status;
+}
+
+static int return_book_impl(sqlite3 *db, int loan_id) {
+    return return_book_idempotent(db, NULL, loan_id);
+}
+
+int return_book(sqlite3 *db, int loan_id) {
+    long long start = metrics_start();
+    int status = return_book_impl(db, loan_id);
+    metrics_record_since(METRIC_RETURN_BOOK, start, status);
+    workload_trace_record(METRIC_RETURN_BOOK, start, status, loan_id);
+    return status;
+}
+
+static int return_book_idempotent_impl(sqlite3 *db, const char *request_id, int loan_id) {
+    if (!db || loan_id <= 0) {
+        fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
+        return FAILURE;
+    }
+    
+    int args[1] = { loan_id };
+    return execute_loan_operation(db, request_id, "return_book", return_book_in_transaction, args);
+}
+
+int return_book_idempotent(sqlite3 *db, const char *request_id, int loan_id) {
+    long long start = metrics_start();
+    int status = return_book_idempotent_impl(db, request_id, loan_id);
+    metrics_record_since(METRIC_RETURN_BOOK_IDEMPOTENT, start, status);
+    workload_trace_record(METRIC_RETURN_BOOK_IDEMPOTENT, start, status, request_id, loan_id);
+    return status;
+}
+
+static int return_book_by_ids_impl(sqlite3 *db, int book_id, int member_id) {
+    return return_book_by_ids_idempotent(db, NULL, book_id, member_id);
+}
+
+int return_book_by_ids(sqlite3 *db, int book_id, int member_id) {
+    long long start = metrics_start();
+    int status = return_book_by_ids_impl(db, book_id, member_id);
+    metrics_record_since(METRIC_RETURN_BOOK_BY_IDS, start, status);
+    workload_trace_record(METRIC_RETURN_BOOK_BY_IDS, start, status, book_id, member_id);
+    return status;
+}
+
+static int return_book_by_ids_idempotent_impl(sqlite3 *db, const char *request_id, int book_id, int member_id) {
+    if (!db || book_id <= 0 || member_id <= 0) {
+        fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
+        return FAILURE;
+    }
+    
+    int args[2] = { book_id, member_id };
+    return execute_loan_operation(db, request_id, "return_book_by_ids", return_book_by_ids_in_transaction, args);
+}
+
+int return_book_by_ids_idempotent(sqlite3 *db, const char *request_id, int book_id, int member_id) {
+    long long start = metrics_start();
+    int status = return_book_by_ids_idempotent_impl(db, request_id, book_id, member_id);
+    metrics_record_since(METRIC_RETURN_BOOK_BY_IDS_IDEMPOTENT, start, status);
+    workload_trace_record(METRIC_RETURN_BOOK_BY_IDS_IDEMPOTENT, start, status, request_id, book_id, member_id);
+    return status;
+}
+
+static int extend_loan_impl(sqlite3 *db, int loan_id, int extend_days) {
+    return extend_loan_idempotent(db, NULL, loan_id, extend_days);
+}
+
+int extend_loan(sqlite3 *db, int loan_id, int extend_days) {
+    long long start = metrics_start();
+    int status = extend_loan_impl(db, loan_id, extend_days);
+    metrics_record_since(METRIC_EXTEND_LOAN, start, status);
+    workload_trace_record(METRIC_EXTEND_LOAN, start, status, loan_id, extend_days);
+    return status;
+}
+
+static int extend_loan_idempotent_impl(sqlite3 *db, const char *request_id, int loan_id, int extend_days) {
+    if (!db || loan_id <= 0 || extend_days <= 0) {
+        fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
+        return FAILURE;
+    }
+    
+    int args[2] = { loan_id, extend_days };
+    return execute_loan_operation(db, request_id, "extend_loan", extend_loan_in_transaction, args);
+}
+
+int extend_loan_idempotent(sqlite3 *db, const char *request_id, int loan_id, int extend_days) {
+    long long start = metrics_start();
+    int status = extend_loan_idempotent_impl(db, request_id, loan_id, extend_days);
+    metrics_record_since(METRIC_EXTEND_LOAN_IDEMPOTENT, start, status);
+    workload_trace_record(METRIC_EXTEND_LOAN_IDEMPOTENT, start, status, request_id, loan_id, extend_days);
+    return status;
+}
+
+static int purge_expired_loan_requests_impl(sqlite3 *db) {
+    if (!db) {
+        fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
+        return FAILURE;
+    }
+    
+    const char *sql = "DELETE FROM request_dedupe WHERE created_at < ?;";
+    sqlite3_stmt *stmt = NULL;
+    int purged_count = FAILURE;
+    
+    if (database_prepare_statement(db, sql, &stmt) != SUCCESS) {
+        return FAILURE;
+    }
+    
+    sqlite3_bind_int64(stmt, 1, (sqlite3_int64)(time(NULL) - REQUEST_DEDUPE_TTL_SECONDS));
+    
+    if (sqlite3_step(stmt) == SQLITE_DONE) {
+        purged_count = sqlite3_changes(db);
+    } else {
+        fprintf(stderr, "만료된 요청 ID 삭제 실패: %s\n", sqlite3_errmsg(db));
+    }
+    
+    sqlite3_finalize(stmt);
+    return purged_count;
+}
+
+int purge_expired_loan_requests(sqlite3 *db) {
+    long long start = metrics_start();
+    int status = purge_expired_loan_requests_impl(db);
+    metrics_record_since(METRIC_PURGE_EXPIRED_LOAN_REQUESTS, start, status);
+    workload_trace_record(METRIC_PURGE_EXPIRED_LOAN_REQUESTS, start, status);
+    return status;
+}
+
+// ?3(첫 개관일 0시) 이후로 옮긴 반납 예정일: 하루 단위로 옮겨 반납 시각의 시:분:초를 유지
+#define SHIFTED_DUE_DATE_SQL \
+    "datetime(due_date, '+' || " \
+    "((CAST(round((julianday(?3) - julianday(due_date)) * 86400) AS INTEGER) + 86399) / 86400) " \
+    "|| ' days')"
+
+static int shift_due_dates_impl(sqlite3 *db, const DateRange *range, const ClosureCalendar *calendar) {
+    if (!db || !range || !calendar || range->end < range->start) {
+        fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
+        return FAILURE;
+    }
+    
+    // 휴관 기간 [첫날 0시, 마지막 날 다음날 0시)와 그 뒤 첫 개관일 0시를 현지 시각으로 계산
+    struct tm start_tm, end_tm;
+    if (to_local_tm(range->start, &start_tm) != SUCCESS || to_local_tm(range->end, &end_tm) != SUCCESS) {
+        fprintf(stderr, "휴관 기간을 현지 시각으로 변환하지 못했습니다.\n");
+        return FAILURE;
+    }
+    
+    start_tm.tm_hour = 0;
+    start_tm.tm_min = 0;
+    start_tm.tm_sec = 0;
+    start_tm.tm_isdst = -1;
+    
+    end_tm.tm_mday++;
+    end_tm.tm_hour = 0;
+    end_tm.tm_min = 0;
+    end_tm.tm_sec = 0;
+    end_tm.tm_isdst = -1;
+    
+    time_t window_start = mktime(&start_tm);
+    time_t window_end = mktime(&end_tm);
+    time_t target_day = calendar_next_open_day(calendar, window_end);
+    
+    char start_str[32], end_str[32], target_str[32];
+    time_to_sql_string(window_start, start_str, sizeof(start_str));
+    time_to_sql_string(window_end, end_str, sizeof(end_str));
+    time_to_sql_string(target_day, target_str, sizeof(target_str));
+    
+    // 조정될 대출마다 반납일 조정 이벤트(인자는 옮긴 뒤의 반납 예정일)를 한 번의 INSERT로 기록
+    // (UPDATE 뒤에는 옮긴 대출이 기간을 벗어나므로 같은 트랜잭션에서 먼저 기록)
+    const char *event_sql = 
+        "INSERT INTO loan_events (event_time, event_type, loan_id, book_id, member_id, arg) "
+        "SELECT ?4, ?5, id, book_id, member_id, "
+        "COALESCE(CAST(strftime('%s', " SHIFTED_DUE_DATE_SQL ") AS INTEGER), 0) "
+        "FROM loans WHERE is_returned = 0 AND due_date >= ?1 AND due_date < ?2 ORDER BY id;";
+    
+    // 기간 내에 반납 예정인 미반납 대출 전체를 한 번의 UPDATE로 첫 개관일로 이동
+    // (반납 시각의 시:분:초는 유지하고, 연장 횟수는 소모하지 않음)
+    const char *shift_sql = 
+        "UPDATE loans SET due_date = " SHIFTED_DUE_DATE_SQL ", updated_at = CURRENT_TIMESTAMP "
+        "WHERE is_returned = 0 AND due_date >= ?1 AND due_date < ?2;";
+    
+    const char *sqls[] = { event_sql, shift_sql };
+    int changes[2] = { 0, 0 };
+    time_t shift_time = time(NULL);
+    
+    if (database_begin_immediate_transaction(db) != SUCCESS) {
+        return FAILURE;
+    }
+    
+    for (int i = 0; i < 2; i++) {
+        sqlite3_stmt *stmt = NULL;
+        
+        if (database_prepare_statement(db, sqls[i], &stmt) != SUCCESS) {
+            database_rollback_transaction(db);
+            return FAILURE;
+        }
+        
+        sqlite3_bind_text(stmt, 1, start_str, -1, SQLITE_STATIC);
+        sqlite3_bind_text(stmt, 2, end_str, -1, SQLITE_STATIC);
+        sqlite3_bind_text(stmt, 3, target_str, -1, SQLITE_STATIC);
+        if (i == 0) {
+            sqlite3_bind_int64(stmt, 4, (sqlite3_int64)shift_time);
+            sqlite3_bind_int(stmt, 5, (int)LOAN_EVENT_DUE_SHIFT);
+        }
+        
+        int step_result = sqlite3_step(stmt);
+        sqlite3_finalize(stmt);
+        
+        if (step_result != SQLITE_DONE) {
+            fprintf(stderr, "반납 예정일 일괄 조정 실패: %s\n", sqlite3_errmsg(db));
+            database_rollback_transaction(db);
+            return FAILURE;
+        }
+        changes[i] = sqlite3_changes(db);
+    }
+    
+    // 두 문장이 같은 조건이므로 기록한 이벤트 수와 옮긴 대출 수가 같아야 함
+    if (changes[0] != changes[1]) {
+        fprintf(stderr, "반납 예정일 일괄 조정 실패: 이벤트 %d건, 대출 %d건\n", changes[0], changes[1]);
+        database_rollback_transaction(db);
+        return FAILURE;
+    }
+    
+    if (database_commit_transaction(db) != SUCCESS) {
+        return FAILURE;
+    }
+    
+    return changes[1];
+}
+
+int shift_due_dates(sqlite3 *db, const DateRange *range, const ClosureCalendar *calendar) {
+    long long start = metrics_start();
+    int status = shift_due_dates_impl(db, range, calendar);
+    metrics_record_since(METRIC_SHIFT_DUE_DATES, start, status);
+    workload_trace_record(METRIC_SHIFT_DUE_DATES, start, status, range);
+    return status;
+}
+
+static int get_loan_by_id_impl(sqlite3 *db, int loan_id, Loan *loan) {
     if (!db || !loan || loan_id <= 0) {
         fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
         return FAILURE;
     }
     
+    // 날짜 컬럼은 UTC 텍스트로 저장되므로 유닉스 시각으로 변환하여 조회
     const char *sql = 
-        "SELECT id, book_id, member_id, loan_date, due_date, return_date, "
-        "is_returned, renewal_count, created_at, updated_at "
+        "SELECT id, book_id, member_id, "
+        "CAST(strftime('%s', loan_date) AS INTEGER), CAST(strftime('%s', due_date) AS INTEGER), "
+        "CAST(strftime('%s', return_date) AS INTEGER), is_returned, renewal_count, "
+        "CAST(strftime('%s', created_at) AS INTEGER), CAST(strftime('%s', updated_at) AS INTEGER) "
         "FROM loans WHERE id = ?;";
     
     sqlite3_stmt *stmt = NULL;
@@ -317,7 +685,15 @@ int get_loan_by_id(sqlite3 *db, int loan_id, Loan *loan) {
     return result;
 }
 
-int get_member_loan_history(sqlite3 *db, int member_id, LoanSearchResult *result, int include_returned) {
+int get_loan_by_id(sqlite3 *db, int loan_id, Loan *loan) {
+    long long start = metrics_start();
+    int status = get_loan_by_id_impl(db, loan_id, loan);
+    metrics_record_since(METRIC_GET_LOAN_BY_ID, start, status);
+    workload_trace_record(METRIC_GET_LOAN_BY_ID, start, status, loan_id);
+    return status;
+}
+
+static int get_member_loan_history_impl(sqlite3 *db, int member_id, LoanSearchResult *result, int include_returned) {
     if (!db || member_id <= 0 || !result) {
         fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
         return FAILURE;
@@ -339,11 +715,27 @@ int get_member_loan_history(sqlite3 *db, int member_id, LoanSearchResult *result
     return sqlite3_exec(db, sql, loan_callback, result, NULL) == SQLITE_OK ? SUCCESS : FAILURE;
 }
 
-int get_member_current_loans(sqlite3 *db, int member_id, LoanSearchResult *result) {
+int get_member_loan_history(sqlite3 *db, int member_id, LoanSearchResult *result, int include_returned) {
+    long long start = metrics_start();
+    int status = get_member_loan_history_impl(db, member_id, result, include_returned);
+    metrics_record_since(METRIC_GET_MEMBER_LOAN_HISTORY, start, status);
+    workload_trace_record(METRIC_GET_MEMBER_LOAN_HISTORY, start, status, member_id, include_returned);
+    return status;
+}
+
+static int get_member_current_loans_impl(sqlite3 *db, int member_id, LoanSearchResult *result) {
     return get_member_loan_history(db, member_id, result, FALSE);
 }
 
-int get_book_loan_history(sqlite3 *db, int book_id, LoanSearchResult *result, int include_returned) {
+int get_member_current_loans(sqlite3 *db, int member_id, LoanSearchResult *result) {
+    long long start = metrics_start();
+    int status = get_member_current_loans_impl(db, member_id, result);
+    metrics_record_since(METRIC_GET_MEMBER_CURRENT_LOANS, start, status);
+    workload_trace_record(METRIC_GET_MEMBER_CURRENT_LOANS, start, status, member_id);
+    return status;
+}
+
+static int get_book_loan_history_impl(sqlite3 *db, int book_id, LoanSearchResult *result, int include_returned) {
     if (!db || book_id <= 0 || !result) {
         fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
         return FAILURE;
@@ -365,7 +757,15 @@ int get_book_loan_history(sqlite3 *db, int book_id, LoanSearchResult *result, in
     return sqlite3_exec(db, sql, loan_callback, result, NULL) == SQLITE_OK ? SUCCESS : FAILURE;
 }
 
-int get_overdue_loans(sqlite3 *db, LoanSearchResult *result) {
+int get_book_loan_history(sqlite3 *db, int book_id, LoanSearchResult *result, int include_returned) {
+    long long start = metrics_start();
+    int status = get_book_loan_history_impl(db, book_id, result, include_returned);
+    metrics_record_since(METRIC_GET_BOOK_LOAN_HISTORY, start, status);
+    workload_trace_record(METRIC_GET_BOOK_LOAN_HISTORY, start, status, book_id, include_returned);
+    return status;
+}
+
+static int get_overdue_loans_impl(sqlite3 *db, LoanSearchResult *result) {
     if (!db || !result) {
         fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
         return FAILURE;
@@ -380,15 +780,27 @@ int get_overdue_loans(sqlite3 *db, LoanSearchResult *result) {
     return sqlite3_exec(db, sql, loan_callback, result, NULL) == SQLITE_OK ? SUCCESS : FAILURE;
 }
 
-int get_loans_due_on_date(sqlite3 *db, time_t due_date, LoanSearchResult *result) {
+int get_overdue_loans(sqlite3 *db, LoanSearchResult *result) {
+    long long start = metrics_start();
+    int status = get_overdue_loans_impl(db, result);
+    metrics_record_since(METRIC_GET_OVERDUE_LOANS, start, status);
+    workload_trace_record(METRIC_GET_OVERDUE_LOANS, start, status);
+    return status;
+}
+
+static int get_loans_due_on_date_impl(sqlite3 *db, time_t due_date, LoanSearchResult *result) {
     if (!db || !result) {
         fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
         return FAILURE;
     }
     
     char date_str[32];
-    struct tm *tm_info = localtime(&due_date);
-    strftime(date_str, sizeof(date_str), "%Y-%m-%d", tm_info);
+    struct tm tm_info;
+    if (to_local_tm(due_date, &tm_info) != SUCCESS) {
+        fprintf(stderr, "반납 예정일을 현지 시각으로 변환하지 못했습니다.\n");
+        return FAILURE;
+    }
+    strftime(date_str, sizeof(date_str), "%Y-%m-%d", &tm_info);
     
     char sql[MAX_SQL_LENGTH];
     snprintf(sql, sizeof(sql), 
@@ -400,7 +812,15 @@ int get_loans_due_on_date(sqlite3 *db, time_t due_date, LoanSearchResult *result
     return sqlite3_exec(db, sql, loan_callback, result, NULL) == SQLITE_OK ? SUCCESS : FAILURE;
 }
 
-int get_current_loans(sqlite3 *db, LoanSearchResult *result) {
+int get_loans_due_on_date(sqlite3 *db, time_t due_date, LoanSearchResult *result) {
+    long long start = metrics_start();
+    int status = get_loans_due_on_date_impl(db, due_date, result);
+    metrics_record_since(METRIC_GET_LOANS_DUE_ON_DATE, start, status);
+    workload_trace_record(METRIC_GET_LOANS_DUE_ON_DATE, start, status, due_date);
+    return status;
+}
+
+static int get_current_loans_impl(sqlite3 *db, LoanSearchResult *result) {
     if (!db || !result) {
         fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
         return FAILURE;
@@ -414,8 +834,16 @@ int get_current_loans(sqlite3 *db, LoanSearchResult *result) {
     return sqlite3_exec(db, sql, loan_callback, result, NULL) == SQLITE_OK ? SUCCESS : FAILURE;
 }
 
-int get_loan_statistics(sqlite3 *db, int *total_loans, int *current_loans, 
-                       int *overdue_loans, int *returned_loans) {
+int get_current_loans(sqlite3 *db, LoanSearchResult *result) {
+    long long start = metrics_start();
+    int status = get_current_loans_impl(db, result);
+    metrics_record_since(METRIC_GET_CURRENT_LOANS, start, status);
+    workload_trace_record(METRIC_GET_CURRENT_LOANS, start, status);
+    return status;
+}
+
+static int get_loan_statistics_impl(sqlite3 *db, int *total_loans, int *current_loans, 
+                                   int *overdue_loans, int *returned_loans) {
     if (!db || !total_loans || !current_loans || !overdue_loans || !returned_loans) {
         fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
         return FAILURE;
@@ -446,7 +874,16 @@ int get_loan_statistics(sqlite3 *db, int *total_loans, int *current_loans,
     return SUCCESS;
 }
 
-int get_popular_books_by_loans(sqlite3 *db, int *book_ids, int *loan_counts, int max_books) {
+int get_loan_statistics(sqlite3 *db, int *total_loans, int *current_loans, 
+                       int *overdue_loans, int *returned_loans) {
+    long long start = metrics_start();
+    int status = get_loan_statistics_impl(db, total_loans, current_loans, overdue_loans, returned_loans);
+    metrics_record_since(METRIC_GET_LOAN_STATISTICS, start, status);
+    workload_trace_record(METRIC_GET_LOAN_STATISTICS, start, status);
+    return status;
+}
+
+static int get_popular_books_by_loans_impl(sqlite3 *db, int *book_ids, int *loan_counts, int max_books) {
     if (!db || !book_ids || !loan_counts || max_books <= 0) {
         fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
         return FAILURE;
@@ -471,7 +908,15 @@ int get_popular_books_by_loans(sqlite3 *db, int *book_ids, int *loan_counts, int
     return FAILURE;
 }
 
-int check_loan_availability(sqlite3 *db, int book_id, int member_id) {
+int get_popular_books_by_loans(sqlite3 *db, int *book_ids, int *loan_counts, int max_books) {
+    long long start = metrics_start();
+    int status = get_popular_books_by_loans_impl(db, book_ids, loan_counts, max_books);
+    metrics_record_since(METRIC_GET_POPULAR_BOOKS_BY_LOANS, start, status);
+    workload_trace_record(METRIC_GET_POPULAR_BOOKS_BY_LOANS, start, status, max_books);
+    return status;
+}
+
+static int check_loan_availability_impl(sqlite3 *db, int book_id, int member_id) {
     if (!db || book_id <= 0 || member_id <= 0) {
         fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
         return FAILURE;
@@ -502,7 +947,15 @@ int check_loan_availability(sqlite3 *db, int book_id, int member_id) {
     return SUCCESS;
 }
 
-int check_duplicate_loan(sqlite3 *db, int book_id, int member_id) {
+int check_loan_availability(sqlite3 *db, int book_id, int member_id) {
+    long long start = metrics_start();
+    int status = check_loan_availability_impl(db, book_id, member_id);
+    metrics_record_since(METRIC_CHECK_LOAN_AVAILABILITY, start, status);
+    workload_trace_record(METRIC_CHECK_LOAN_AVAILABILITY, start, status, book_id, member_id);
+    return status;
+}
+
+static int check_duplicate_loan_impl(sqlite3 *db, int book_id, int member_id) {
     if (!db || book_id <= 0 || member_id <= 0) {
         fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
         return FAILURE;
@@ -535,11 +988,23 @@ int check_duplicate_loan(sqlite3 *db, int book_id, int member_id) {
     return SUCCESS;
 }
 
+int check_duplicate_loan(sqlite3 *db, int book_id, int member_id) {
+    long long start = metrics_start();
+    int status = check_duplicate_loan_impl(db, book_id, member_id);
+    metrics_record_since(METRIC_CHECK_DUPLICATE_LOAN, start, status);
+    workload_trace_record(METRIC_CHECK_DUPLICATE_LOAN, start, status, book_id, member_id);
+    return status;
+}
+
 int calculate_overdue_days(time_t due_date, time_t return_date) {
     time_t current_time = (return_date == 0) ? time(NULL) : return_date;
     
-    // 일 단위로 계산
-    double diff_seconds = difftime(current_time, due_date);
+    return calculate_overdue_days_as_of(due_date, current_time);
+}
+
+int calculate_overdue_days_as_of(time_t due_date, time_t as_of) {
+    // 일 단위로 계산 (연체료 정산과 같은 절사 규칙)
+    double diff_seconds = difftime(as_of, due_date);
     int diff_days = (int)(diff_seconds / (24 * 60 * 60));
     
     return diff_days;
@@ -660,6 +1125,11 @@ void print_loan(sqlite3 *db, const Loan *loan) {
     }
     
     printf("연장횟수: %d회\n", loan->renewal_count);
+    
+    int fine_amount = 0;
+    if (db && get_loan_fine(db, loan->id, &fine_amount) == SUCCESS && fine_amount > 0) {
+        printf("정산된 연체료: %d원\n", fine_amount);
+    }
     printf("==========================================\n");
 }
 
@@ -0,0 +1,360 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sqlite3.h>
+#include "../include/loan_event.h"
+#include "../include/database.h"
+#include "../include/utils.h"
+#include "../include/constants.h"
+
+// 시점 재구성용 처리 함수 컨텍스트
+typedef struct {
+    sqlite3 *db;
+    sqlite3_stmt *upsert_stmt;
+} SnapshotContext;
+
+int loan_event_append(sqlite3 *db, LoanEventType event_type, int loan_id, time_t event_time) {
+    if (!db || loan_id <= 0) {
+        fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
+        return FAILURE;
+    }
+
+    // 도서/회원 ID와 반납 예정일은 loans 행에서 그대로 복사
+    const char *sql =
+        "INSERT INTO loan_events (event_time, event_type, loan_id, book_id, member_id, arg) "
+        "SELECT ?1, ?2, id, book_id, member_id, "
+        "COALESCE(CAST(strftime('%s', due_date) AS INTEGER), 0) "
+        "FROM loans WHERE id = ?3;";
+
+    sqlite3_stmt *stmt = NULL;
+    int result = FAILURE;
+
+    if (database_prepare_statement(db, sql, &stmt) != SUCCESS) {
+        return FAILURE;
+    }
+
+    sqlite3_bind_int64(stmt, 1, (sqlite3_int64)event_time);
+    sqlite3_bind_int(stmt, 2, (int)event_type);
+    sqlite3_bind_int(stmt, 3, loan_id);
+
+    if (sqlite3_step(stmt) != SQLITE_DONE) {
+        fprintf(stderr, "대출 이벤트 기록 실패: %s\n", sqlite3_errmsg(db));
+    } else if (sqlite3_changes(db) != 1) {
+        fprintf(stderr, "대출 이벤트 기록 실패: 대출 ID %d를 찾을 수 없습니다.\n", loan_id);
+    } else {
+        result = SUCCESS;
+    }
+
+    sqlite3_finalize(stmt);
+    return result;
+}
+
+int loan_event_replay(sqlite3 *db, long long after_seq, time_t until,
+                      LoanEventHandler handler, void *user_data, long long *last_seq) {
+    if (!db || !handler || after_seq < 0) {
+        fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
+        return FAILURE;
+    }
+
+    const char *sql =
+        "SELECT seq, event_time, event_type, loan_id, book_id, member_id, arg "
+        "FROM loan_events WHERE seq > ?1 AND (?2 = 0 OR event_time <= ?2) "
+        "ORDER BY seq;";
+
+    sqlite3_stmt *stmt = NULL;
+    int replayed_count = 0;
+    long long current_seq = after_seq;
+
+    if (database_prepare_statement(db, sql, &stmt) != SUCCESS) {
+        return FAILURE;
+    }
+
+    sqlite3_bind_int64(stmt, 1, (sqlite3_int64)after_seq);
+    sqlite3_bind_int64(stmt, 2, (sqlite3_int64)until);
+
+    int step_result;
+    while ((step_result = sqlite3_step(stmt)) == SQLITE_ROW) {
+        LoanEvent event;
+        event.seq = sqlite3_column_int64(stmt, 0);
+        event.event_time = (time_t)sqlite3_column_int64(stmt, 1);
+        event.event_type = sqlite3_column_int(stmt, 2);
+        event.loan_id = sqlite3_column_int(stmt, 3);
+        event.book_id = sqlite3_column_int(stmt, 4);
+        event.member_id = sqlite3_column_int(stmt, 5);
+        event.due_date = (time_t)sqlite3_column_int64(stmt, 6);
+
+        if (handler(&event, user_data) != SUCCESS) {
+            sqlite3_finalize(stmt);
+            return FAILURE;
+        }
+
+        current_seq = event.seq;
+        replayed_count++;
+    }
+
+    sqlite3_finalize(stmt);
+
+    if (step_result != SQLITE_DONE) {
+        fprintf(stderr, "대출 이벤트 조회 실패: %s\n", sqlite3_errmsg(db));
+        return FAILURE;
+    }
+
+    if (last_seq) {
+        *last_seq = current_seq;
+    }
+
+    return replayed_count;
+}
+
+static int snapshot_handler(const LoanEvent *event, void *user_data) {
+    SnapshotContext *context = (SnapshotContext*)user_data;
+    sqlite3_stmt *stmt = context->upsert_stmt;
+
+    sqlite3_bind_int(stmt, 1, event->loan_id);
+    sqlite3_bind_int(stmt, 2, event->book_id);
+    sqlite3_bind_int(stmt, 3, event->member_id);
+    sqlite3_bind_int(stmt, 4, event->event_type);
+    sqlite3_bind_int64(stmt, 5, (sqlite3_int64)event->event_time);
+    sqlite3_bind_int64(stmt, 6, (sqlite3_int64)event->due_date);
+
+    int step_result = sqlite3_step(stmt);
+    sqlite3_reset(stmt);
+
+    if (step_result != SQLITE_DONE) {
+        fprintf(stderr, "대출 현황 재구성 실패: %s\n", sqlite3_errmsg(context->db));
+        return FAILURE;
+    }
+
+    return SUCCESS;
+}
+
+int loan_event_build_snapshot(sqlite3 *db, time_t as_of) {
+    if (!db) {
+        fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
+        return FAILURE;
+    }
+
+    const char *create_sql =
+        "DROP TABLE IF EXISTS temp.loan_snapshot;"
+        "CREATE TEMP TABLE loan_snapshot ("
+        "loan_id INTEGER PRIMARY KEY,"
+        "book_id INTEGER NOT NULL,"
+        "member_id INTEGER NOT NULL,"
+        "loan_time INTEGER,"
+        "due_date INTEGER,"
+        "return_time INTEGER,"
+        "renewal_count INTEGER NOT NULL DEFAULT 0"
+        ");";
+
+    // 이벤트 한 건을 한 번의 upsert로 반영 (?4: 이벤트 종류, ?5: 발생 시각, ?6: 반납 예정일)
+    const char *upsert_sql =
+        "INSERT INTO temp.loan_snapshot "
+        "(loan_id, book_id, member_id, loan_time, due_date, return_time, renewal_count) "
+        "VALUES (?1, ?2, ?3, CASE WHEN ?4 = 1 THEN ?5 END, ?6, "
+        "CASE WHEN ?4 = 2 THEN ?5 END, CASE WHEN ?4 = 3 THEN 1 ELSE 0 END) "
+        "ON CONFLICT(loan_id) DO UPDATE SET "
+        "loan_time = COALESCE(loan_time, excluded.loan_time), "
+        "due_date = excluded.due_date, "
+        "return_time = COALESCE(excluded.return_time, return_time), "
+        "renewal_count = renewal_count + excluded.renewal_count;";
+
+    if (database_begin_transaction(db) != SUCCESS) {
+        return FAILURE;
+    }
+
+    if (database_execute_query(db, create_sql) != SUCCESS) {
+        database_rollback_transaction(db);
+        return FAILURE;
+    }
+
+    SnapshotContext context = { db, NULL };
+
+    if (database_prepare_statement(db, upsert_sql, &context.upsert_stmt) != SUCCESS) {
+        database_rollback_transaction(db);
+        return FAILURE;
+    }
+
+    int replayed_count = loan_event_replay(db, 0, as_of, snapshot_handler, &context, NULL);
+    sqlite3_finalize(context.upsert_stmt);
+
+    if (replayed_count == FAILURE) {
+        database_rollback_transaction(db);
+        return FAILURE;
+    }
+
+    if (database_commit_transaction(db) != SUCCESS) {
+        return FAILURE;
+    }
+
+    sqlite3_stmt *count_stmt = NULL;
+    int loan_count = FAILURE;
+
+    if (database_prepare_statement(db, "SELECT COUNT(*) FROM temp.loan_snapshot;", &count_stmt) != SUCCESS) {
+        return FAILURE;
+    }
+
+    if (sqlite3_step(count_stmt) == SQLITE_ROW) {
+        loan_count = sqlite3_column_int(count_stmt, 0);
+    }
+
+    sqlite3_finalize(count_stmt);
+    return loan_count;
+}
+
+int loan_event_get_cursor(sqlite3 *db, const char *consumer, long long *last_seq) {
+    if (!db || is_empty_string(consumer) || !last_seq) {
+        fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
+        return FAILURE;
+    }
+
+    const char *sql = "SELECT last_seq FROM loan_event_cursors WHERE consumer = ?;";
+    sqlite3_stmt *stmt = NULL;
+    int result = FAILURE;
+
+    if (database_prepare_statement(db, sql, &stmt) != SUCCESS) {
+        return FAILURE;
+    }
+
+    sqlite3_bind_text(stmt, 1, consumer, -1, SQLITE_STATIC);
+
+    int step_result = sqlite3_step(stmt);
+    if (step_result == SQLITE_ROW || step_result == SQLITE_DONE) {
+        *last_seq = step_result == SQLITE_ROW ? sqlite3_column_int64(stmt, 0) : 0;
+        result = SUCCESS;
+    } else {
+        fprintf(stderr, "이벤트 처리 위치 조회 실패: %s\n", sqlite3_errmsg(db));
+    }
+
+    sqlite3_finalize(stmt);
+    return result;
+}
+
+static int set_cursor(sqlite3 *db, const char *consumer, long long last_seq) {
+    const char *sql =
+        "INSERT INTO loan_event_cursors (consumer, last_seq) VALUES (?, ?) "
+        "ON CONFLICT(consumer) DO UPDATE SET last_seq = excluded.last_seq, "
+        "updated_at = CURRENT_TIMESTAMP;";
+
+    sqlite3_stmt *stmt = NULL;
+    int result = FAILURE;
+
+    if (database_prepare_statement(db, sql, &stmt) != SUCCESS) {
+        return FAILURE;
+    }
+
+    sqlite3_bind_text(stmt, 1, consumer, -1, SQLITE_STATIC);
+    sqlite3_bind_int64(stmt, 2, (sqlite3_int64)last_seq);
+
+    if (sqlite3_step(stmt) == SQLITE_DONE) {
+        result = SUCCESS;
+    } else {
+        fprintf(stderr, "이벤트 처리 위치 저장 실패: %s\n", sqlite3_errmsg(db));
+    }
+
+    sqlite3_finalize(stmt);
+    return result;
+}
+
+int loan_event_consume(sqlite3 *db, const char *consumer, LoanEventHandler handler, void *user_data) {
+    if (!db || is_empty_string(consumer) || !handler) {
+        fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
+        return FAILURE;
+    }
+
+    if (database_begin_immediate_transaction(db) != SUCCESS) {
+        return FAILURE;
+    }
+
+    long long after_seq = 0;
+    long long last_seq = 0;
+
+    if (loan_event_get_cursor(db, consumer, &after_seq) != SUCCESS) {
+        database_rollback_transaction(db);
+        return FAILURE;
+    }
+
+    int consumed_count = loan_event_replay(db, after_seq, 0, handler, user_data, &last_seq);
+
+    if (consumed_count == FAILURE ||
+        (consumed_count > 0 && set_cursor(db, consumer, last_seq) != SUCCESS)) {
+        database_rollback_transaction(db);
+        return FAILURE;
+    }
+
+    if (database_commit_transaction(db) != SUCCESS) {
+        return FAILURE;
+    }
+
+    return consumed_count;
+}
+
+int loan_event_backfill(sqlite3 *db) {
+    if (!db) {
+        fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
+        return FAILURE;
+    }
+
+    // 이벤트가 없는 대출만 골라 대출/반납 이벤트를 생성
+    // (과거 연장 이력은 남아 있지 않으므로 최종 반납 예정일로 기록)
+    const char *backfill_sql =
+        "DROP TABLE IF EXISTS temp.backfill_loans;"
+        "CREATE TEMP TABLE backfill_loans (loan_id INTEGER PRIMARY KEY);"
+        "INSERT INTO temp.backfill_loans SELECT l.id FROM loans l "
+        "WHERE NOT EXISTS (SELECT 1 FROM loan_events e WHERE e.loan_id = l.id);"
+        "INSERT INTO loan_events (event_time, event_type, loan_id, book_id, member_id, arg) "
+        "SELECT COALESCE(CAST(strftime('%s', l.loan_date) AS INTEGER), 0), 1, "
+        "l.id, l.book_id, l.member_id, COALESCE(CAST(strftime('%s', l.due_date) AS INTEGER), 0) "
+        "FROM loans l JOIN temp.backfill_loans b ON b.loan_id = l.id "
+        "ORDER BY l.loan_date, l.id;"
+        "INSERT INTO loan_events (event_time, event_type, loan_id, book_id, member_id, arg) "
+        "SELECT COALESCE(CAST(strftime('%s', l.return_date) AS INTEGER), 0), 2, "
+        "l.id, l.book_id, l.member_id, COALESCE(CAST(strftime('%s', l.due_date) AS INTEGER), 0) "
+        "FROM loans l JOIN temp.backfill_loans b ON b.loan_id = l.id "
+        "WHERE l.is_returned = 1 ORDER BY l.return_date, l.id;";
+
+    if (database_begin_immediate_transaction(db) != SUCCESS) {
+        return FAILURE;
+    }
+
+    int before_changes = sqlite3_total_changes(db);
+
+    if (database_execute_query(db, backfill_sql) != SUCCESS) {
+        database_rollback_transaction(db);
+        return FAILURE;
+    }
+
+    // 임시 테이블 적재분을 제외한 이벤트 행 수
+    sqlite3_stmt *stmt = NULL;
+    int backfill_loan_count = 0;
+
+    if (database_prepare_statement(db, "SELECT COUNT(*) FROM temp.backfill_loans;", &stmt) == SUCCESS) {
+        if (sqlite3_step(stmt) == SQLITE_ROW) {
+            backfill_loan_count = sqlite3_column_int(stmt, 0);
+        }
+        sqlite3_finalize(stmt);
+    }
+
+    int event_count = sqlite3_total_changes(db) - before_changes - backfill_loan_count;
+
+    if (database_commit_transaction(db) != SUCCESS) {
+        return FAILURE;
+    }
+
+    return event_count;
+}
+
+const char* loan_event_type_to_string(int event_type) {
+    switch (event_type) {
+        case LOAN_EVENT_CHECKOUT:
+            return "대출";
+        case LOAN_EVENT_RETURN:
+            return "반납";
+        case LOAN_EVENT_RENEW:
+            return "연장";
+        case LOAN_EVENT_DUE_SHIFT:
+            return "반납일 조정";
+        default:
+            return "알 수 없음";
+    }
+}
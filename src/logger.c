@@ -0,0 +1,838 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <sys/stat.h>
+#include <zlib.h>
+#include "../include/logger.h"
+#include "../include/constants.h"
+
+// 기록 스레드와 로그 디렉터리 탐색은 POSIX API(pthread, dirent)를 쓰므로
+// Windows에서는 이를 함께 제공하는 MinGW-w64로만 빌드할 수 있음
+#if defined(_WIN32) && !defined(__MINGW32__)
+    #error "Windows에서는 MinGW-w64(winpthreads, dirent.h 포함)로 빌드해야 합니다."
+#endif
+#include <pthread.h>
+#include <dirent.h>
+
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <unistd.h>
+#endif
+
+// 링 버퍼 한 칸 (형식화가 끝난 메시지)
+typedef struct {
+    time_t timestamp;
+    int level;
+    char message[LOGGER_MESSAGE_LENGTH];
+} LogEntry;
+
+// 스레드별 링 버퍼: 소유 스레드만 head를, 기록 스레드만 tail을 증가시킴
+typedef struct LogRing {
+    LogEntry entries[LOGGER_RING_CAPACITY];
+    atomic_ullong head;            // 다음에 쓸 위치 (생산자)
+    atomic_ullong tail;            // 다음에 읽을 위치 (기록 스레드)
+    atomic_llong dropped;          // 버퍼가 가득 차 버린 수
+    long long dropped_reported;    // 기록 스레드가 이미 보고한 유실 수
+    atomic_int in_use;             // 소유 스레드가 살아 있으면 1
+    struct LogRing *next;          // 등록 목록 (추가만 하고 제거하지 않음)
+} LogRing;
+
+// 링 목록은 추가만 하므로 기록 스레드가 잠금 없이 순회할 수 있음
+static _Atomic(LogRing*) ring_list = NULL;
+static atomic_int ring_count = 0;
+static _Thread_local LogRing *thread_ring = NULL;
+
+static atomic_int min_level = LOG_INFO;
+static atomic_int running = 0;
+static atomic_llong written_count = 0;
+static atomic_llong filtered_count = 0;
+static atomic_llong rotation_count = 0;
+static atomic_llong compressed_count = 0;
+
+static pthread_t flusher_thread;
+static pthread_mutex_t flusher_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t flusher_cond = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t flushed_cond = PTHREAD_COND_INITIALIZER;
+static int stop_requested = 0;
+static int rotate_requested = 0;
+static long long flush_requested = 0;
+static long long flush_completed = 0;
+static LoggerRotation rotation_config = {
+    LOGGER_DEFAULT_MAX_BYTES, TRUE, LOGGER_DEFAULT_MAX_ARCHIVES, TRUE
+};
+
+// 압축 스레드: 교체된 파일을 압축하고 보관 개수를 넘는 파일을 지움
+static pthread_t archiver_thread;
+static int archiver_started = 0;
+static pthread_mutex_t archiver_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t archiver_cond = PTHREAD_COND_INITIALIZER;
+static int archiver_pending = 0;
+static int archiver_stop = 0;
+
+static pthread_once_t ring_key_once = PTHREAD_ONCE_INIT;
+static pthread_key_t ring_key;
+
+// 기록 스레드 전용 상태
+static FILE *output_file = NULL;
+static char log_path[MAX_PATH_LENGTH];
+static LoggerRotation active_rotation;
+static long long segment_bytes = 0;     // 현재 파일 크기
+static int segment_day = -1;            // 현재 파일의 날짜 (YYYYMMDD, 비어 있으면 -1)
+static char batch_buffer[LOGGER_BATCH_BUFFER_SIZE];
+static size_t batch_length = 0;
+static time_t cached_second = (time_t)-1;
+static char cached_time_str[32];
+static int cached_day = -1;
+static char last_rotation_stamp[16];
+static int last_rotation_sequence = 0;
+
+static const char *level_to_string(int level) {
+    switch (level) {
+        case LOG_DEBUG:   return "DEBUG";
+        case LOG_INFO:    return "INFO";
+        case LOG_WARNING: return "WARNING";
+        case LOG_ERROR:   return "ERROR";
+        default:          return "UNKNOWN";
+    }
+}
+
+// 스레드 종료 시 링을 반납하여 다른 스레드가 재사용하게 함 (남은 로그는 계속 기록됨)
+static void release_thread_ring(void *ring) {
+    atomic_store_explicit(&((LogRing*)ring)->in_use, 0, memory_order_release);
+}
+
+static void create_ring_key(void) {
+    pthread_key_create(&ring_key, release_thread_ring);
+}
+
+// 호출 스레드의 링을 구함 (반납된 링을 먼저 재사용하고 없으면 새로 등록)
+static LogRing *acquire_thread_ring(void) {
+    if (thread_ring) {
+        return thread_ring;
+    }
+
+    pthread_once(&ring_key_once, create_ring_key);
+
+    LogRing *ring = atomic_load_explicit(&ring_list, memory_order_acquire);
+    for (; ring; ring = ring->next) {
+        int expected = 0;
+        if (atomic_compare_exchange_strong(&ring->in_use, &expected, 1)) {
+            break;
+        }
+    }
+
+    if (!ring) {
+        ring = calloc(1, sizeof(LogRing));
+        if (!ring) {
+            return NULL;
+        }
+        atomic_init(&ring->in_use, 1);
+
+        LogRing *head = atomic_load_explicit(&ring_list, memory_order_relaxed);
+        do {
+            ring->next = head;
+        } while (!atomic_compare_exchange_weak_explicit(&ring_list, &head, ring,
+                                                        memory_order_release, memory_order_relaxed));
+        atomic_fetch_add(&ring_count, 1);
+    }
+
+    pthread_setspecific(ring_key, ring);
+    thread_ring = ring;
+    return ring;
+}
+
+// 초 단위로 캐시한 시각 문자열 (기록 스레드 전용)
+static const char *format_timestamp(time_t timestamp) {
+    if (timestamp != cached_second) {
+        struct tm tm_info;
+#ifdef _WIN32
+        localtime_s(&tm_info, &timestamp);
+#else
+        localtime_r(&timestamp, &tm_info);
+#endif
+        strftime(cached_time_str, sizeof(cached_time_str), "%Y-%m-%d %H:%M:%S", &tm_info);
+        cached_second = timestamp;
+        cached_day = (tm_info.tm_year + 1900) * 10000 + (tm_info.tm_mon + 1) * 100 + tm_info.tm_mday;
+    }
+    return cached_time_str;
+}
+
+static int day_of(time_t timestamp) {
+    format_timestamp(timestamp);
+    return cached_day;
+}
+
+// 로그 파일 경로를 디렉토리와 파일 이름으로 나눔
+static void split_log_path(const char *path, char *dir, size_t dir_size, const char **base) {
+    const char *slash = strrchr(path, '/');
+    const char *backslash = strrchr(path, '\\');
+    if (backslash && (!slash || backslash > slash)) {
+        slash = backslash;
+    }
+
+    if (slash) {
+        size_t length = (size_t)(slash - path);
+        if (length == 0) {
+            length = 1;   // 루트 디렉토리
+        }
+        if (length >= dir_size) {
+            length = dir_size - 1;
+        }
+        memcpy(dir, path, length);
+        dir[length] = '\0';
+        *base = slash + 1;
+    } else {
+        snprintf(dir, dir_size, ".");
+        *base = path;
+    }
+}
+
+// 교체된 파일 이름인지 확인: <로그 파일 이름>.<YYYYMMDD-HHMMSS-NN>[.gz]
+static int is_archive_name(const char *name, const char *base) {
+    size_t base_length = strlen(base);
+    return strncmp(name, base, base_length) == 0 && name[base_length] == '.' &&
+           name[base_length + 1] >= '0' && name[base_length + 1] <= '9';
+}
+
+static int ends_with(const char *text, const char *suffix) {
+    size_t text_length = strlen(text);
+    size_t suffix_length = strlen(suffix);
+    return text_length >= suffix_length && strcmp(text + text_length - suffix_length, suffix) == 0;
+}
+
+static int compare_names(const void *a, const void *b) {
+    return strcmp(*(char * const *)a, *(char * const *)b);
+}
+
+// 교체된 파일 하나를 gzip으로 압축 (임시 파일에 쓴 뒤 이름을 바꾸므로 중간에 끊겨도 원본은 남음)
+static int compress_archive(const char *path) {
+    char gz_path[MAX_PATH_LENGTH + 8];
+    char tmp_path[MAX_PATH_LENGTH + 16];
+    snprintf(gz_path, sizeof(gz_path), "%s.gz", path);
+    snprintf(tmp_path, sizeof(tmp_path), "%s.gz.tmp", path);
+
+    FILE *input = fopen(path, "rb");
+    if (!input) {
+        return FAILURE;
+    }
+
+    gzFile output = gzopen(tmp_path, "wb6");
+    if (!output) {
+        fclose(input);
+        return FAILURE;
+    }
+
+    char buffer[LOGGER_BATCH_BUFFER_SIZE];
+    size_t length;
+    int result = SUCCESS;
+    while ((length = fread(buffer, 1, sizeof(buffer), input)) > 0) {
+        if (gzwrite(output, buffer, (unsigned)length) != (int)length) {
+            result = FAILURE;
+            break;
+        }
+    }
+    if (ferror(input)) {
+        result = FAILURE;
+    }
+    fclose(input);
+
+    if (gzclose(output) != Z_OK) {
+        result = FAILURE;
+    }
+
+    if (result != SUCCESS || rename(tmp_path, gz_path) != 0) {
+        fprintf(stderr, "로그 파일 압축 실패: %s\n", path);
+        remove(tmp_path);
+        return FAILURE;
+    }
+
+    remove(path);
+    return SUCCESS;
+}
+
+// 교체된 파일을 모두 압축하고 오래된 것부터 보관 개수를 넘는 만큼 지움 (압축 스레드 전용)
+static void process_archives(const char *path, const LoggerRotation *rotation) {
+    char dir[MAX_PATH_LENGTH];
+    const char *base;
+    split_log_path(path, dir, sizeof(dir), &base);
+
+    DIR *directory = opendir(dir);
+    if (!directory) {
+        return;
+    }
+
+    char **names = NULL;
+    int count = 0;
+    int capacity = 0;
+    struct dirent *item;
+
+    while ((item = readdir(directory)) != NULL) {
+        if (!is_archive_name(item->d_name, base)) {
+            continue;
+        }
+
+        char full_path[MAX_PATH_LENGTH * 2];
+        snprintf(full_path, sizeof(full_path), "%s/%s", dir, item->d_name);
+
+        // 이전 실행에서 압축 중에 끊긴 임시 파일
+        if (ends_with(item->d_name, ".tmp")) {
+            remove(full_path);
+            continue;
+        }
+
+        if (count == capacity) {
+            int new_capacity = capacity ? capacity * 2 : 16;
+            char **new_names = realloc(names, sizeof(char*) * (size_t)new_capacity);
+            if (!new_names) {
+                break;
+            }
+            names = new_names;
+            capacity = new_capacity;
+        }
+
+        if (rotation->compress && !ends_with(item->d_name, ".gz") &&
+            compress_archive(full_path) == SUCCESS) {
+            atomic_fetch_add(&compressed_count, 1);
+            strncat(full_path, ".gz", sizeof(full_path) - strlen(full_path) - 1);
+        }
+
+        names[count] = malloc(strlen(full_path) + 1);
+        if (!names[count]) {
+            break;
+        }
+        strcpy(names[count], full_path);
+        count++;
+    }
+    closedir(directory);
+
+    // 이름에 교체 시각이 들어 있으므로 이름순이 오래된 순
+    qsort(names, (size_t)count, sizeof(char*), compare_names);
+    for (int i = 0; i < count; i++) {
+        if (rotation->max_archives > 0 && i < count - rotation->max_archives) {
+            remove(names[i]);
+        }
+        free(names[i]);
+    }
+    free(names);
+}
+
+static void *archiver_main(void *arg) {
+    (void)arg;
+
+    pthread_mutex_lock(&archiver_mutex);
+    while (1) {
+        while (!archiver_pending && !archiver_stop) {
+            pthread_cond_wait(&archiver_cond, &archiver_mutex);
+        }
+        if (!archiver_pending && archiver_stop) {
+            break;
+        }
+        archiver_pending = 0;
+
+        char path[MAX_PATH_LENGTH];
+        LoggerRotation rotation;
+        memcpy(path, log_path, sizeof(path));
+        rotation = active_rotation;
+        pthread_mutex_unlock(&archiver_mutex);
+
+        process_archives(path, &rotation);
+
+        pthread_mutex_lock(&archiver_mutex);
+    }
+    pthread_mutex_unlock(&archiver_mutex);
+
+    return NULL;
+}
+
+static void wake_archiver(void) {
+    pthread_mutex_lock(&archiver_mutex);
+    archiver_pending = 1;
+    pthread_cond_signal(&archiver_cond);
+    pthread_mutex_unlock(&archiver_mutex);
+}
+
+// 현재 로그 파일을 열고 크기와 날짜를 확인
+static int open_segment(void) {
+    output_file = fopen(log_path, "a");
+    if (!output_file) {
+        return FAILURE;
+    }
+
+    struct stat info;
+    segment_bytes = 0;
+    segment_day = -1;
+    if (stat(log_path, &info) == 0 && info.st_size > 0) {
+        segment_bytes = (long long)info.st_size;
+        segment_day = day_of(info.st_mtime);
+    }
+    return SUCCESS;
+}
+
+// 현재 로그 파일을 <이름>.<시각-순번>으로 바꾸고 새 파일을 엶 (기록 스레드 전용)
+static void rotate_segment(void) {
+    if (!output_file || segment_bytes == 0) {
+        return;
+    }
+
+    fclose(output_file);
+    output_file = NULL;
+
+    char archive_path[MAX_PATH_LENGTH + 32];
+    char gz_path[MAX_PATH_LENGTH + 40];
+    char stamp[16];
+    time_t now = time(NULL);
+    struct tm tm_info;
+#ifdef _WIN32
+    localtime_s(&tm_info, &now);
+#else
+    localtime_r(&now, &tm_info);
+#endif
+    strftime(stamp, sizeof(stamp), "%Y%m%d-%H%M%S", &tm_info);
+
+    // 같은 초에 여러 번 교체되어도 이름순이 교체 순서가 되도록 순번을 붙임
+    // (보관 개수 제한으로 지워진 이름을 다시 쓰지 않도록 순번은 줄어들지 않음)
+    if (strcmp(stamp, last_rotation_stamp) != 0) {
+        strcpy(last_rotation_stamp, stamp);
+        last_rotation_sequence = 0;
+    }
+    struct stat info;
+    do {
+        snprintf(archive_path, sizeof(archive_path), "%s.%s-%02d", log_path, stamp, last_rotation_sequence);
+        snprintf(gz_path, sizeof(gz_path), "%s.gz", archive_path);
+        last_rotation_sequence++;
+    } while ((stat(archive_path, &info) == 0 || stat(gz_path, &info) == 0) && last_rotation_sequence < 100);
+
+    if (rename(log_path, archive_path) == 0) {
+        atomic_fetch_add(&rotation_count, 1);
+        wake_archiver();
+    } else {
+        fprintf(stderr, "로그 파일 교체 실패: %s\n", log_path);
+    }
+
+    if (open_segment() != SUCCESS) {
+        fprintf(stderr, "로그 파일을 열 수 없습니다: %s\n", log_path);
+    }
+}
+
+static void write_batch(void) {
+    if (batch_length == 0) {
+        return;
+    }
+
+    FILE *output = output_file ? output_file : stdout;
+    fwrite(batch_buffer, 1, batch_length, output);
+    fflush(output);
+    if (output_file) {
+        segment_bytes += (long long)batch_length;
+    }
+    batch_length = 0;
+}
+
+// 이 줄을 현재 파일에 쓰기 전에 교체해야 하는지 확인
+static int rotation_due(time_t timestamp) {
+    long long pending = segment_bytes + (long long)batch_length;
+
+    if (!output_file || pending == 0) {
+        return FALSE;
+    }
+    if (active_rotation.rotate_daily && segment_day != -1 && day_of(timestamp) != segment_day) {
+        return TRUE;
+    }
+    return active_rotation.max_bytes > 0 &&
+           pending + LOGGER_MESSAGE_LENGTH + 64 > active_rotation.max_bytes;
+}
+
+static void append_line(time_t timestamp, const char *level_str, const char *message) {
+    if (rotation_due(timestamp)) {
+        write_batch();
+        rotate_segment();
+    }
+
+    // 한 줄의 최대 길이: 시각(19) + 수준(7) + 메시지 + 구분 문자
+    if (batch_length + LOGGER_MESSAGE_LENGTH + 64 > sizeof(batch_buffer)) {
+        write_batch();
+    }
+
+    int length = snprintf(batch_buffer + batch_length, sizeof(batch_buffer) - batch_length,
+                          "[%s] %s: %s\n", format_timestamp(timestamp), level_str, message);
+    if (length > 0) {
+        batch_length += (size_t)length;
+        if (batch_length >= sizeof(batch_buffer)) {
+            batch_length = sizeof(batch_buffer) - 1;
+        }
+    }
+
+    if (segment_day == -1) {
+        segment_day = cached_day;
+    }
+}
+
+// 모든 링의 로그를 한 번 비움 (기록 스레드 전용)
+static void drain_rings(void) {
+    LogRing *ring = atomic_load_explicit(&ring_list, memory_order_acquire);
+
+    for (; ring; ring = ring->next) {
+        unsigned long long tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+        unsigned long long head = atomic_load_explicit(&ring->head, memory_order_acquire);
+
+        for (; tail != head; tail++) {
+            LogEntry *entry = &ring->entries[tail & (LOGGER_RING_CAPACITY - 1)];
+            append_line(entry->timestamp, level_to_string(entry->level), entry->message);
+            atomic_fetch_add_explicit(&written_count, 1, memory_order_relaxed);
+        }
+        atomic_store_explicit(&ring->tail, tail, memory_order_release);
+
+        long long dropped = atomic_load_explicit(&ring->dropped, memory_order_relaxed);
+        if (dropped != ring->dropped_reported) {
+            char message[128];
+            snprintf(message, sizeof(message), "로그 버퍼가 가득 차 %lld건이 유실되었습니다.",
+                     dropped - ring->dropped_reported);
+            append_line(time(NULL), level_to_string(LOG_WARNING), message);
+            ring->dropped_reported = dropped;
+        }
+    }
+
+    write_batch();
+}
+
+static void *flusher_main(void *arg) {
+    (void)arg;
+
+    pthread_mutex_lock(&flusher_mutex);
+    while (1) {
+        long long target = flush_requested;
+        int stopping = stop_requested;
+        int rotating = rotate_requested;
+        rotate_requested = 0;
+        pthread_mutex_unlock(&flusher_mutex);
+
+        drain_rings();
+        if (rotating) {
+            rotate_segment();
+        }
+
+        pthread_mutex_lock(&flusher_mutex);
+        flush_completed = target;
+        pthread_cond_broadcast(&flushed_cond);
+
+        if (stopping) {
+            break;
+        }
+
+        if (flush_requested == target && !stop_requested && !rotate_requested) {
+            struct timespec deadline;
+            clock_gettime(CLOCK_REALTIME, &deadline);
+            deadline.tv_nsec += (long)LOGGER_FLUSH_INTERVAL_MS * 1000000L;
+            if (deadline.tv_nsec >= 1000000000L) {
+                deadline.tv_sec += 1;
+                deadline.tv_nsec -= 1000000000L;
+            }
+            pthread_cond_timedwait(&flusher_cond, &flusher_mutex, &deadline);
+        }
+    }
+    pthread_mutex_unlock(&flusher_mutex);
+
+    return NULL;
+}
+
+// 압축 스레드가 남은 작업을 마치고 끝나기를 기다림
+static void logger_stop_archiver(void) {
+    if (!archiver_started) {
+        return;
+    }
+
+    pthread_mutex_lock(&archiver_mutex);
+    archiver_stop = 1;
+    pthread_cond_signal(&archiver_cond);
+    pthread_mutex_unlock(&archiver_mutex);
+
+    pthread_join(archiver_thread, NULL);
+    archiver_started = 0;
+}
+
+int logger_start(const char *log_file_path) {
+    logger_stop();
+
+    pthread_mutex_lock(&flusher_mutex);
+    stop_requested = 0;
+    rotate_requested = 0;
+    flush_requested = 0;
+    flush_completed = 0;
+    active_rotation = rotation_config;
+    pthread_mutex_unlock(&flusher_mutex);
+
+    log_path[0] = '\0';
+    if (log_file_path) {
+        if (strlen(log_file_path) >= sizeof(log_path)) {
+            fprintf(stderr, "로그 파일 경로가 너무 깁니다: %s\n", log_file_path);
+            return FAILURE;
+        }
+        strcpy(log_path, log_file_path);
+
+        if (open_segment() != SUCCESS) {
+            fprintf(stderr, "로그 파일을 열 수 없습니다: %s\n", log_file_path);
+            log_path[0] = '\0';
+            return FAILURE;
+        }
+
+        // 이전 실행에서 압축하지 못한 파일도 시작하자마자 정리
+        archiver_stop = 0;
+        archiver_pending = 1;
+        archiver_started = pthread_create(&archiver_thread, NULL, archiver_main, NULL) == 0;
+        if (!archiver_started) {
+            fprintf(stderr, "로그 압축 스레드 생성 실패\n");
+        }
+    }
+
+    if (pthread_create(&flusher_thread, NULL, flusher_main, NULL) != 0) {
+        fprintf(stderr, "로그 기록 스레드 생성 실패\n");
+        logger_stop_archiver();
+        if (output_file) {
+            fclose(output_file);
+            output_file = NULL;
+        }
+        return FAILURE;
+    }
+
+    atomic_store_explicit(&running, 1, memory_order_release);
+    return SUCCESS;
+}
+
+void logger_stop(void) {
+    if (!atomic_exchange(&running, 0)) {
+        return;
+    }
+
+    pthread_mutex_lock(&flusher_mutex);
+    stop_requested = 1;
+    pthread_cond_signal(&flusher_cond);
+    pthread_mutex_unlock(&flusher_mutex);
+
+    pthread_join(flusher_thread, NULL);
+    logger_stop_archiver();
+
+    if (output_file) {
+        fclose(output_file);
+        output_file = NULL;
+    }
+}
+
+void logger_set_rotation(const LoggerRotation *rotation) {
+    if (!rotation) {
+        return;
+    }
+
+    pthread_mutex_lock(&flusher_mutex);
+    rotation_config = *rotation;
+    pthread_mutex_unlock(&flusher_mutex);
+}
+
+int logger_rotate(void) {
+    if (!atomic_load_explicit(&running, memory_order_acquire) || log_path[0] == '\0') {
+        return FAILURE;
+    }
+
+    pthread_mutex_lock(&flusher_mutex);
+    rotate_requested = 1;
+    long long target = ++flush_requested;
+    pthread_cond_signal(&flusher_cond);
+    while (flush_completed < target && !stop_requested) {
+        pthread_cond_wait(&flushed_cond, &flusher_mutex);
+    }
+    pthread_mutex_unlock(&flusher_mutex);
+
+    return SUCCESS;
+}
+
+void logger_set_level(LogLevel level) {
+    atomic_store_explicit(&min_level, (int)level, memory_order_relaxed);
+}
+
+LogLevel logger_get_level(void) {
+    return (LogLevel)atomic_load_explicit(&min_level, memory_order_relaxed);
+}
+
+void logger_write(LogLevel level, const char *format, va_list args) {
+    // 수준 확인이 먼저: 걸러지는 로그는 링을 만들거나 시각 조회, 형식화를 하지 않음
+    if ((int)level < atomic_load_explicit(&min_level, memory_order_relaxed)) {
+        atomic_fetch_add_explicit(&filtered_count, 1, memory_order_relaxed);
+        return;
+    }
+
+    LogRing *ring = acquire_thread_ring();
+
+    // 로거가 시작되지 않았으면 기존처럼 표준 출력에 바로 씀
+    if (!ring || !atomic_load_explicit(&running, memory_order_acquire)) {
+        char time_str[32];
+        time_t now = time(NULL);
+        struct tm tm_info;
+#ifdef _WIN32
+        localtime_s(&tm_info, &now);
+#else
+        localtime_r(&now, &tm_info);
+#endif
+        strftime(time_str, sizeof(time_str), "%Y-%m-%d %H:%M:%S", &tm_info);
+        fprintf(stdout, "[%s] %s: ", time_str, level_to_string(level));
+        vfprintf(stdout, format, args);
+        fprintf(stdout, "\n");
+        fflush(stdout);
+        return;
+    }
+
+    unsigned long long head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    unsigned long long tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+
+    if (head - tail >= LOGGER_RING_CAPACITY) {
+        atomic_fetch_add_explicit(&ring->dropped, 1, memory_order_relaxed);
+        return;
+    }
+
+    LogEntry *entry = &ring->entries[head & (LOGGER_RING_CAPACITY - 1)];
+    entry->timestamp = time(NULL);
+    entry->level = (int)level;
+    vsnprintf(entry->message, sizeof(entry->message), format, args);
+
+    atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+}
+
+void logger_flush(void) {
+    if (!atomic_load_explicit(&running, memory_order_acquire)) {
+        return;
+    }
+
+    pthread_mutex_lock(&flusher_mutex);
+    long long target = ++flush_requested;
+    pthread_cond_signal(&flusher_cond);
+    while (flush_completed < target && !stop_requested) {
+        pthread_cond_wait(&flushed_cond, &flusher_mutex);
+    }
+    pthread_mutex_unlock(&flusher_mutex);
+}
+
+void logger_get_stats(LoggerStats *stats) {
+    if (!stats) {
+        return;
+    }
+
+    memset(stats, 0, sizeof(LoggerStats));
+    stats->written = atomic_load(&written_count);
+    stats->filtered = atomic_load(&filtered_count);
+    stats->ring_count = atomic_load(&ring_count);
+    stats->rotations = atomic_load(&rotation_count);
+    stats->compressed = atomic_load(&compressed_count);
+
+    LogRing *ring = atomic_load_explicit(&ring_list, memory_order_acquire);
+    for (; ring; ring = ring->next) {
+        stats->dropped += atomic_load_explicit(&ring->dropped, memory_order_relaxed);
+    }
+}
+
+int logger_read_tail(const char *log_file_path, int max_lines, LogTailCallback callback, void *user_data) {
+    if (!log_file_path || max_lines <= 0 || !callback) {
+        return FAILURE;
+    }
+
+    const char *data = NULL;
+    size_t size = 0;
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(log_file_path, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                              NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        return FAILURE;
+    }
+    LARGE_INTEGER file_size;
+    HANDLE mapping = NULL;
+    if (!GetFileSizeEx(file, &file_size)) {
+        CloseHandle(file);
+        return FAILURE;
+    }
+    size = (size_t)file_size.QuadPart;
+    if (size > 0) {
+        mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+        data = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, size) : NULL;
+        if (!data) {
+            if (mapping) CloseHandle(mapping);
+            CloseHandle(file);
+            return FAILURE;
+        }
+    }
+#else
+    int fd = open(log_file_path, O_RDONLY);
+    if (fd < 0) {
+        return FAILURE;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        close(fd);
+        return FAILURE;
+    }
+    size = (size_t)info.st_size;
+    if (size > 0) {
+        void *mapped = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapped == MAP_FAILED) {
+            close(fd);
+            return FAILURE;
+        }
+        data = mapped;
+    }
+#endif
+
+    // 파일 끝에서부터 줄 시작 위치를 찾으므로 앞부분은 읽지 않음
+    size_t *starts = malloc(sizeof(size_t) * (size_t)max_lines);
+    int count = 0;
+
+    if (starts && size > 0) {
+        size_t end = size;
+        if (data[end - 1] == '\n') {
+            end--;
+        }
+
+        size_t position = end;
+        while (count < max_lines && end > 0) {
+            while (position > 0 && data[position - 1] != '\n') {
+                position--;
+            }
+            starts[count++] = position;
+            if (position == 0) {
+                break;
+            }
+            position--;
+        }
+
+        for (int i = count - 1; i >= 0; i--) {
+            const char *line = data + starts[i];
+            const char *newline = memchr(line, '\n', size - starts[i]);
+            size_t length = newline ? (size_t)(newline - line) : size - starts[i];
+            if (length > 0 && line[length - 1] == '\r') {
+                length--;
+            }
+            callback(line, length, user_data);
+        }
+    }
+
+#ifdef _WIN32
+    if (data) {
+        UnmapViewOfFile(data);
+        CloseHandle(mapping);
+    }
+    CloseHandle(file);
+#else
+    if (data) {
+        munmap((void*)data, size);
+    }
+    close(fd);
+#endif
+
+    if (!starts) {
+        return FAILURE;
+    }
+    free(starts);
+    return count;
+}
@@ -48,13 +48,25 @@ int initialize_application(void) {
         print_warning_message("설정 파일을 찾을 수 없습니다. 기본 설정을 사용합니다.");
     }
     
-    // 로깅 초기화
+    // 로깅 초기화 (설정된 수준 미만의 로그는 형식화 전에 걸러짐)
+    set_log_level((LogLevel)g_config.log_level);
+    LoggerRotation rotation = {
+        (long long)g_config.log_max_size_kb * 1024, g_config.log_rotate_daily,
+        g_config.log_retention_count, TRUE
+    };
+    logger_set_rotation(&rotation);
     if (init_logging("library.log") != SUCCESS) {
         print_warning_message("로그 파일 초기화 실패");
     }
     
     log_message(LOG_INFO, "애플리케이션 시작");
     
+    // SQL 프로파일러는 연결을 열 때 등록되므로 데이터베이스보다 먼저 설정
+    if (query_profiler_configure(g_config.sql_profile_enabled, g_config.slow_query_threshold_ms,
+                                 g_config.slow_query_log_path) != SUCCESS) {
+        print_warning_message("느린 쿼리 로그 파일을 열 수 없어 애플리케이션 로그에 기록합니다.");
+    }
+    
     // 데이터베이스 초기화
     if ((g_database = database_init(g_config.database_path)) == NULL) {
         log_message(LOG_ERROR, "데이터베이스 초기화 실패: %s", g_config.database_path);
@@ -63,16 +75,79 @@ int initialize_application(void) {
     
     log_message(LOG_INFO, "데이터베이스 연결 성공: %s", g_config.database_path);
     
+    // 호출 기록 (시작 시점 데이터베이스 사본도 함께 남겨 재실행할 수 있게 함)
+    if (g_config.workload_trace_path[0] != '\0') {
+        if (workload_trace_start(g_config.workload_trace_path, g_database) == SUCCESS) {
+            log_message(LOG_INFO, "호출 기록 시작: %s", g_config.workload_trace_path);
+        } else {
+            print_warning_message("호출 기록을 시작하지 못했습니다.");
+        }
+    }
+    
+    // 유효 기간이 지난 요청 ID 정리
+    purge_expired_loan_requests(g_database);
+    
+    // 전화번호 검색 컬럼 도입 이전 회원 보충
+    int phone_backfilled_count = backfill_member_phone_digits(g_database);
+    if (phone_backfilled_count > 0) {
+        log_message(LOG_INFO, "전화번호 검색 컬럼 보충: %d명", phone_backfilled_count);
+    }
+    
+    // 이벤트 로그 도입 이전 대출 기록 보충
+    int backfilled_count = loan_event_backfill(g_database);
+    if (backfilled_count > 0) {
+        log_message(LOG_INFO, "대출 이벤트 보충: %d건", backfilled_count);
+    }
+    
+    // 지표 내보내기 (설정된 경로가 없으면 아무것도 하지 않음)
+    MetricsExporterConfig exporter_config;
+    memset(&exporter_config, 0, sizeof(exporter_config));
+    safe_string_copy(exporter_config.textfile_path, g_config.metrics_textfile_path, sizeof(exporter_config.textfile_path));
+    safe_string_copy(exporter_config.socket_path, g_config.metrics_socket_path, sizeof(exporter_config.socket_path));
+    exporter_config.interval_seconds = g_config.metrics_interval_seconds;
+    if (metrics_exporter_start(g_database, &exporter_config) != SUCCESS) {
+        log_message(LOG_WARNING, "지표 내보내기를 시작하지 못했습니다.");
+    }
+    
     return SUCCESS;
 }
 
 void cleanup_application(void) {
+    long long busy_retries = database_get_busy_retry_count();
+    if (busy_retries > 0) {
+        log_message(LOG_INFO, "잠금 대기 재시도: %lld회", busy_retries);
+    }
+    
+    metrics_exporter_stop();
+    
+    // 백그라운드 백업이 데이터베이스 연결을 쓰고 있으면 멈춘 뒤 닫음
+    BackupProgress backup_progress;
+    backup_job_get_progress(&backup_progress);
+    if (backup_progress.state == BACKUP_STATE_RUNNING) {
+        backup_job_cancel();
+        log_message(LOG_WARNING, "종료로 백업을 취소했습니다: %s", backup_progress.backup_path);
+    }
+    backup_job_wait(NULL);
+    
+    if (workload_trace_is_active()) {
+        long long dropped = 0;
+        long long recorded = workload_trace_get_count(&dropped);
+        workload_trace_stop();
+        log_message(LOG_INFO, "호출 기록 종료: %lld건 (기록하지 못함 %lld건)", recorded, dropped);
+    }
+    
     if (g_database) {
         database_close(g_database);
         g_database = NULL;
         log_message(LOG_INFO, "데이터베이스 연결 종료");
     }
     
+    LoggerStats log_stats;
+    logger_get_stats(&log_stats);
+    if (log_stats.dropped > 0) {
+        log_message(LOG_WARNING, "로그 버퍼 부족으로 유실된 로그: %lld건", log_stats.dropped);
+    }
+    
     close_logging();
 }
 
@@ -96,7 +171,7 @@ void handle_main_menu(void) {
     while (1) {
         show_main_menu();
         
-        choice = get_menu_choice(0, 5, "메뉴를 선택하세요");
+        choice = get_menu_choice(0, 6, "메뉴를 선택하세요");
         
         switch (choice) {
             case MAIN_BOOK_MANAGEMENT:
@@ -163,6 +238,8 @@ void show_book_menu(void) {
     printf("3. 도서 수정\n");
     printf("4. 도서 삭제\n");
     printf("5. 전체 도서 목록\n");
+    printf("6. 도서 일괄 가져오기 (CSV/TSV/MARC21)\n");
+    printf("7. 도서 내보내기 (MARC21)\n");
     printf("0. 메인 메뉴로 돌아가기\n");
     
     print_separator();
@@ -174,7 +251,7 @@ void handle_book_menu(void) {
     while (1) {
         show_book_menu();
         
-        choice = get_menu_choice(0, 5, "메뉴를 선택하세요");
+        choice = get_menu_choice(0, 7, "메뉴를 선택하세요");
         
         switch (choice) {
             case BOOK_ADD:
@@ -192,6 +269,12 @@ void handle_book_menu(void) {
             case BOOK_LIST_ALL:
                 list_all_books_interactive();
                 break;
+            case BOOK_IMPORT:
+                import_books_interactive();
+                break;
+            case BOOK_EXPORT:
+                export_books_interactive();
+                break;
             case BOOK_BACK:
                 return;
             default:
@@ -343,6 +426,73 @@ void list_all_books_interactive(void) {
     pause_for_user();
 }
 
+void import_books_interactive(void) {
+    clear_screen();
+    print_header("도서 일괄 가져오기");
+    
+    printf("CSV/TSV는 첫 줄이 머리글이어야 하며 title, author 열이 필요합니다.\n");
+    printf("isbn, publisher, publication_year, total_copies, available_copies, category 열은 선택입니다.\n");
+    printf("MARC21 파일(.mrc)은 020, 100, 245, 260/264, 650 필드를 읽습니다.\n\n");
+    
+    char path[MAX_PATH_LENGTH];
+    if (get_user_input(path, sizeof(path), "가져올 파일 경로 (.csv, .tsv 또는 .mrc): ") != SUCCESS || is_empty_string(path)) {
+        print_error_message("파일 경로를 입력하세요.");
+        pause_for_user();
+        return;
+    }
+    
+    BookImportConfig config;
+    book_import_default_config(&config);
+    config.show_progress = TRUE;
+    if (snprintf(config.reject_path, sizeof(config.reject_path), "%s.rejects", path) >= (int)sizeof(config.reject_path)) {
+        print_error_message("파일 경로가 너무 깁니다.");
+        pause_for_user();
+        return;
+    }
+    
+    BookImportStats stats;
+    if (book_import_file(g_database, path, &config, &stats) == SUCCESS) {
+        print_success_message("도서 가져오기가 완료되었습니다.");
+        if (stats.resumed_lines > 0) {
+            printf("이전에 가져온 %lld줄은 건너뛰었습니다.\n", stats.resumed_lines);
+        }
+        printf("읽은 행: %lld, 추가: %lld, 거부: %lld, 중복 ISBN: %lld (%.1f초)\n",
+               stats.rows, stats.imported, stats.rejected, stats.duplicates, stats.elapsed_seconds);
+        if (stats.rejected + stats.duplicates > 0) {
+            printf("거부된 행: %s\n", config.reject_path);
+        }
+        log_message(LOG_INFO, "도서 일괄 가져오기: %s (추가 %lld, 거부 %lld, 중복 %lld)",
+                    path, stats.imported, stats.rejected, stats.duplicates);
+    } else {
+        print_error_message("도서 가져오기에 실패했습니다. 다시 실행하면 마지막으로 저장한 곳부터 이어집니다.");
+    }
+    
+    pause_for_user();
+}
+
+void export_books_interactive(void) {
+    clear_screen();
+    print_header("도서 내보내기");
+    
+    char path[MAX_PATH_LENGTH];
+    if (get_user_input(path, sizeof(path), "저장할 파일 경로 (.mrc): ") != SUCCESS || is_empty_string(path)) {
+        print_error_message("파일 경로를 입력하세요.");
+        pause_for_user();
+        return;
+    }
+    
+    long long exported = 0;
+    if (marc_export_books(g_database, path, &exported) == SUCCESS) {
+        print_success_message("도서 내보내기가 완료되었습니다.");
+        printf("내보낸 도서: %lld권\n", exported);
+        log_message(LOG_INFO, "도서 MARC21 내보내기: %s (%lld권)", path, exported);
+    } else {
+        print_error_message("도서 내보내기에 실패했습니다.");
+    }
+    
+    pause_for_user();
+}
+
 void update_book_interactive(void) {
     clear_screen();
     print_header("도서 정보 수정");
@@ -454,7 +604,7 @@ void handle_member_menu(void) {
     while (1) {
         show_member_menu();
         
-        choice = get_menu_choice(0, 5, "메뉴를 선택하세요");
+        choice = get_menu_choice(0, 6, "메뉴를 선택하세요");
         
         switch (choice) {
             case MEMBER_ADD:
@@ -718,6 +868,8 @@ void show_loan_menu(void) {
     printf("3. 대출 연장\n");
     printf("4. 대출 이력 조회\n");
     printf("5. 연체 도서 목록\n");
+    printf("6. 휴관일 등록 및 반납일 일괄 조정\n");
+    printf("7. 연체료 정산 및 납부\n");
     printf("0. 메인 메뉴로 돌아가기\n");
     
     print_separator();
@@ -729,7 +881,7 @@ void handle_loan_menu(void) {
     while (1) {
         show_loan_menu();
         
-        choice = get_menu_choice(0, 5, "메뉴를 선택하세요");
+        choice = get_menu_choice(0, 7, "메뉴를 선택하세요");
         
         switch (choice) {
             case LOAN_BORROW:
@@ -747,6 +899,12 @@ void handle_loan_menu(void) {
             case LOAN_OVERDUE:
                 show_overdue_loans();
                 break;
+            case LOAN_CLOSURE:
+                register_closure_interactive();
+                break;
+            case LOAN_FINES:
+                manage_fines_interactive();
+                break;
             case LOAN_BACK:
                 return;
             default:
@@ -954,6 +1112,153 @@ void show_overdue_loans(void) {
     pause_for_user();
 }
 
+void register_closure_interactive(void) {
+    clear_screen();
+    print_header("휴관일 등록 및 반납일 일괄 조정");
+    
+    char input[64];
+    DateRange range;
+    
+    if (get_user_input(input, sizeof(input), "휴관 시작일 (YYYY-MM-DD): ") != SUCCESS ||
+        (range.start = string_to_time(input, "%Y-%m-%d")) == 0) {
+        print_error_message("올바른 날짜 형식이 아닙니다.");
+        pause_for_user();
+        return;
+    }
+    
+    if (get_user_input(input, sizeof(input), "휴관 종료일 (YYYY-MM-DD): ") != SUCCESS ||
+        (range.end = string_to_time(input, "%Y-%m-%d")) == 0 || range.end < range.start) {
+        print_error_message("올바른 날짜 형식이 아니거나 시작일보다 앞선 날짜입니다.");
+        pause_for_user();
+        return;
+    }
+    
+    char reason[256];
+    get_user_input(reason, sizeof(reason), "휴관 사유: ");
+    
+    int day_count = add_library_closure_range(g_database, &range, reason);
+    if (day_count == FAILURE) {
+        print_error_message("휴관일 등록에 실패했습니다.");
+        pause_for_user();
+        return;
+    }
+    printf("휴관일 %d일이 등록되었습니다.\n", day_count);
+    
+    if (!get_yes_no_input("이 기간에 반납 예정인 대출의 반납일을 조정하시겠습니까? (y/n): ")) {
+        pause_for_user();
+        return;
+    }
+    
+    // 휴관 기간 이후 첫 개관일 계산을 위해 해당 연도부터 달력을 적재
+    ClosureCalendar calendar;
+    struct tm *start_tm = localtime(&range.start);
+    if (calendar_load(g_database, start_tm->tm_year + 1900, CALENDAR_MAX_YEARS, &calendar) != SUCCESS) {
+        print_error_message("휴관일 달력을 불러오지 못했습니다.");
+        pause_for_user();
+        return;
+    }
+    
+    Timer timer;
+    timer_start(&timer);
+    int shifted_count = shift_due_dates(g_database, &range, &calendar);
+    timer_stop(&timer);
+    
+    if (shifted_count >= 0) {
+        print_success_message("반납 예정일이 일괄 조정되었습니다.");
+        printf("조정된 대출: %d건 (%.1f ms)\n", shifted_count, timer_get_elapsed_milliseconds(&timer));
+        log_message(LOG_INFO, "휴관 반납일 조정: %d건", shifted_count);
+    } else {
+        print_error_message("반납 예정일 조정에 실패했습니다.");
+    }
+    
+    pause_for_user();
+}
+
+void manage_fines_interactive(void) {
+    clear_screen();
+    print_header("연체료 정산 및 납부");
+    
+    printf("1. 연체료 일괄 정산\n");
+    printf("2. 회원 미납 잔액 조회\n");
+    printf("3. 연체료 납부\n");
+    printf("4. 카테고리별 연체료 정책 설정\n");
+    printf("0. 돌아가기\n");
+    
+    int choice = get_menu_choice(0, 4, "작업을 선택하세요");
+    if (choice == 0) return;
+    
+    switch (choice) {
+        case 1: {
+            Timer timer;
+            timer_start(&timer);
+            int accrued_count = accrue_fines(g_database, time(NULL));
+            timer_stop(&timer);
+            
+            if (accrued_count >= 0) {
+                print_success_message("연체료 정산이 완료되었습니다.");
+                printf("연체료가 변경된 대출: %d건 (%.1f ms)\n", accrued_count, timer_get_elapsed_milliseconds(&timer));
+                log_message(LOG_INFO, "연체료 일괄 정산: %d건", accrued_count);
+            } else {
+                print_error_message("연체료 정산에 실패했습니다.");
+            }
+            break;
+        }
+        case 2: {
+            int member_id, balance;
+            if (get_integer_input(&member_id, "회원 ID: ", 1, 999999) != SUCCESS) {
+                return;
+            }
+            if (get_member_balance(g_database, member_id, &balance) == SUCCESS) {
+                printf("회원 ID %d의 미납 잔액: %d원\n", member_id, balance);
+            } else {
+                print_error_message("미납 잔액 조회에 실패했습니다.");
+            }
+            break;
+        }
+        case 3: {
+            int member_id, amount, balance;
+            if (get_integer_input(&member_id, "회원 ID: ", 1, 999999) != SUCCESS) {
+                return;
+            }
+            if (get_member_balance(g_database, member_id, &balance) != SUCCESS || balance <= 0) {
+                print_info_message("납부할 연체료가 없습니다.");
+                break;
+            }
+            printf("현재 미납 잔액: %d원\n", balance);
+            if (get_integer_input(&amount, "납부 금액: ", 1, balance) != SUCCESS) {
+                return;
+            }
+            if (pay_fine(g_database, member_id, amount) == SUCCESS) {
+                print_success_message("연체료가 납부되었습니다.");
+                log_message(LOG_INFO, "연체료 납부: 회원ID=%d, 금액=%d", member_id, amount);
+            } else {
+                print_error_message("연체료 납부에 실패했습니다.");
+            }
+            break;
+        }
+        case 4: {
+            char category[MAX_CATEGORY_LENGTH + 1];
+            int daily_rate, max_fine;
+            if (get_user_input(category, sizeof(category), "카테고리: ") != SUCCESS || is_empty_string(category)) {
+                print_error_message("카테고리를 입력해야 합니다.");
+                break;
+            }
+            if (get_integer_input(&daily_rate, "하루당 연체료 (원): ", 0, 100000) != SUCCESS ||
+                get_integer_input(&max_fine, "연체료 상한액 (원): ", 0, 10000000) != SUCCESS) {
+                return;
+            }
+            if (set_fee_policy(g_database, category, daily_rate, max_fine) == SUCCESS) {
+                print_success_message("연체료 정책이 저장되었습니다.");
+            } else {
+                print_error_message("연체료 정책 저장에 실패했습니다.");
+            }
+            break;
+        }
+    }
+    
+    pause_for_user();
+}
+
 void show_report_menu(void) {
     clear_screen();
     print_header("보고서");
@@ -962,6 +1267,7 @@ void show_report_menu(void) {
     printf("2. 인기 도서 순위\n");  
     printf("3. 회원 활동 보고서\n");
     printf("4. 연체 현황 보고서\n");
+    printf("5. 특정 시점 대출 현황\n");
     printf("0. 메인 메뉴로 돌아가기\n");
     
     print_separator();
@@ -973,7 +1279,7 @@ void handle_report_menu(void) {
     while (1) {
         show_report_menu();
         
-        choice = get_menu_choice(0, 4, "메뉴를 선택하세요");
+        choice = get_menu_choice(0, 6, "메뉴를 선택하세요");
         
         switch (choice) {
             case REPORT_STATISTICS:
@@ -988,6 +1294,9 @@ void handle_report_menu(void) {
             case REPORT_OVERDUE_LIST:
                 show_overdue_report();
                 break;
+            case REPORT_POINT_IN_TIME:
+                show_point_in_time_report();
+                break;
             case REPORT_BACK:
                 return;
             default:
@@ -1105,6 +1414,59 @@ void show_overdue_report(void) {
     show_overdue_loans();
 }
 
+void show_point_in_time_report(void) {
+    clear_screen();
+    print_header("특정 시점 대출 현황");
+    
+    char input[64];
+    if (get_user_input(input, sizeof(input), "기준 날짜 (YYYY-MM-DD): ") != SUCCESS) {
+        return;
+    }
+    
+    // 입력한 날짜의 하루가 끝나는 시점 기준
+    time_t as_of = string_to_time(input, "%Y-%m-%d");
+    if (as_of == 0) {
+        print_error_message("올바른 날짜 형식이 아닙니다.");
+        pause_for_user();
+        return;
+    }
+    as_of = add_days_to_time(as_of, 1) - 1;
+    
+    Timer timer;
+    timer_start(&timer);
+    int loan_count = loan_event_build_snapshot(g_database, as_of);
+    timer_stop(&timer);
+    
+    if (loan_count == FAILURE) {
+        print_error_message("대출 현황 재구성에 실패했습니다.");
+        pause_for_user();
+        return;
+    }
+    
+    const char *sql = 
+        "SELECT COUNT(*), "
+        "COALESCE(SUM(return_time IS NULL), 0), "
+        "COALESCE(SUM(return_time IS NULL AND due_date < ?1), 0), "
+        "COALESCE(SUM(renewal_count), 0) "
+        "FROM temp.loan_snapshot;";
+    
+    sqlite3_stmt *stmt = NULL;
+    if (database_prepare_statement(g_database, sql, &stmt) == SUCCESS) {
+        sqlite3_bind_int64(stmt, 1, (sqlite3_int64)as_of);
+        
+        if (sqlite3_step(stmt) == SQLITE_ROW) {
+            printf("\n%s 기준 (이벤트 재생 %.1f ms)\n", input, timer_get_elapsed_milliseconds(&timer));
+            printf("누적 대출 건수: %d건\n", sqlite3_column_int(stmt, 0));
+            printf("대출 중: %d건\n", sqlite3_column_int(stmt, 1));
+            printf("연체 중: %d건\n", sqlite3_column_int(stmt, 2));
+            printf("누적 연장 횟수: %d회\n", sqlite3_column_int(stmt, 3));
+        }
+        sqlite3_finalize(stmt);
+    }
+    
+    pause_for_user();
+}
+
 void show_system_menu(void) {
     clear_screen();
     print_header("시스템 설정");
@@ -1113,6 +1475,10 @@ void show_system_menu(void) {
     printf("2. 데이터베이스 복원\n");
     printf("3. 시스템 설정 변경\n");
     printf("4. 시스템 로그 보기\n");
+    printf("5. API 응답 시간 보기\n");
+    printf("6. SQL 실행 통계 보기\n");
+    printf("7. 백업 진행 상황 보기\n");
+    printf("8. 특정 시점으로 복구\n");
     printf("0. 메인 메뉴로 돌아가기\n");
     
     print_separator();
@@ -1124,7 +1490,7 @@ void handle_system_menu(void) {
     while (1) {
         show_system_menu();
         
-        choice = get_menu_choice(0, 4, "메뉴를 선택하세요");
+        choice = get_menu_choice(0, 8, "메뉴를 선택하세요");
         
         switch (choice) {
             case SYSTEM_BACKUP:
@@ -1139,6 +1505,18 @@ void handle_system_menu(void) {
             case SYSTEM_LOG:
                 show_system_log();
                 break;
+            case SYSTEM_METRICS:
+                show_metrics_interactive();
+                break;
+            case SYSTEM_SQL_PROFILE:
+                show_sql_profile_interactive();
+                break;
+            case SYSTEM_BACKUP_STATUS:
+                show_backup_status_interactive();
+                break;
+            case SYSTEM_POINT_IN_TIME:
+                recover_point_in_time_interactive();
+                break;
             case SYSTEM_BACK:
                 return;
             default:
@@ -1149,6 +1527,13 @@ void handle_system_menu(void) {
     }
 }
 
+// 백업 진행 막대 (온라인 백업 콜백)
+static int print_backup_progress(const BackupProgress *progress, void *user_data) {
+    (void)user_data;
+    print_progress_bar(progress->page_count - progress->remaining, progress->page_count, BACKUP_PROGRESS_WIDTH);
+    return TRUE;
+}
+
 void backup_database_interactive(void) {
     clear_screen();
     print_header("데이터베이스 백업");
@@ -1172,17 +1557,149 @@ void backup_database_interactive(void) {
     // 백업 디렉토리 생성
     create_directory_if_not_exists("./backups");
     
-    if (database_backup(g_database, backup_path) == SUCCESS) {
+    // 페이지를 나누어 복사하므로 백업 중에도 대출/반납 처리가 막히지 않음
+    if (get_yes_no_input("백그라운드에서 백업하시겠습니까? (y/n): ")) {
+        if (backup_job_start(g_database, backup_path, NULL) == SUCCESS) {
+            print_success_message("백업을 시작했습니다. 진행 상황은 시스템 설정 메뉴 7번에서 볼 수 있습니다.");
+            log_message(LOG_INFO, "백그라운드 백업 시작: %s", backup_path);
+        } else {
+            print_error_message("백업을 시작할 수 없습니다.");
+        }
+        pause_for_user();
+        return;
+    }
+    
+    BackupProgress progress;
+    if (backup_database_online(g_database, backup_path, NULL, print_backup_progress, NULL, &progress) == SUCCESS) {
+        printf("\n");
         print_success_message("데이터베이스 백업이 완료되었습니다.");
-        printf("백업 파일: %s\n", backup_path);
+        printf("백업 파일: %s (%d페이지, %.2f초, 다시 시작 %d회)\n", backup_path, progress.page_count,
+               progress.elapsed_seconds, progress.restarts);
         log_message(LOG_INFO, "데이터베이스 백업 성공: %s", backup_path);
     } else {
+        printf("\n");
         print_error_message("데이터베이스 백업에 실패했습니다.");
     }
     
     pause_for_user();
 }
 
+void show_backup_status_interactive(void) {
+    clear_screen();
+    print_header("백업 진행 상황");
+    
+    BackupProgress progress;
+    backup_job_get_progress(&progress);
+    if (progress.state == BACKUP_STATE_IDLE) {
+        printf("실행한 백그라운드 백업이 없습니다.\n");
+        pause_for_user();
+        return;
+    }
+    
+    static const char *state_names[] = { "대기", "진행 중", "완료", "실패", "취소됨" };
+    printf("백업 파일: %s\n", progress.backup_path);
+    printf("상태: %s (%.1f초, 다시 시작 %d회, 잠금 재시도 %lld회)\n", state_names[progress.state],
+           progress.elapsed_seconds, progress.restarts, progress.busy_retries);
+    if (progress.page_count > 0) {
+        print_backup_progress(&progress, NULL);
+        printf("\n");
+    }
+    
+    if (progress.state == BACKUP_STATE_RUNNING) {
+        if (get_yes_no_input("\n백업을 취소하시겠습니까? (y/n): ")) {
+            backup_job_cancel();
+            backup_job_wait(&progress);
+            print_warning_message("백업을 취소했습니다.");
+            log_message(LOG_INFO, "백그라운드 백업 취소: %s", progress.backup_path);
+        }
+        pause_for_user();
+        return;
+    }
+    
+    // 끝난 작업의 스레드를 정리
+    backup_job_wait(NULL);
+    pause_for_user();
+}
+
+void recover_point_in_time_interactive(void) {
+    clear_screen();
+    print_header("특정 시점으로 복구");
+    
+    ChangeLogStatus status;
+    if (change_log_get_status(g_database, &status) != SUCCESS) {
+        print_error_message("변경 기록 상태를 확인할 수 없습니다.");
+        pause_for_user();
+        return;
+    }
+    
+    if (!status.enabled) {
+        printf("변경 기록이 꺼져 있습니다.\n");
+        printf("켜면 모든 변경을 기록해 두었다가 백업에 다시 적용해 원하는 시점으로 되돌릴 수 있습니다.\n");
+        printf("변경 기록을 켠 뒤에 만든 백업부터 사용할 수 있으며, 쓰기마다 기록이 한 건씩 더 저장됩니다.\n");
+        if (get_yes_no_input("\n변경 기록을 켜시겠습니까? (y/n): ")) {
+            if (change_log_enable(g_database) == SUCCESS) {
+                print_success_message("변경 기록을 켰습니다. 지금 백업을 만들어 두세요.");
+                log_message(LOG_INFO, "변경 기록 켬");
+            } else {
+                print_error_message("변경 기록을 켜지 못했습니다.");
+            }
+        }
+        pause_for_user();
+        return;
+    }
+    
+    printf("변경 기록: %lld건", status.entries);
+    if (status.entries > 0) {
+        printf(" (%s ~ %s UTC)", status.first_time, status.last_time);
+    }
+    printf("\n백업 디렉토리: %s\n\n", g_config.backup_directory);
+    
+    char target_time[32];
+    if (get_user_input(target_time, sizeof(target_time), "복구할 시각 (YYYY-MM-DD HH:MM:SS, UTC): ") != SUCCESS ||
+        is_empty_string(target_time)) {
+        print_error_message("복구할 시각을 입력해주세요.");
+        pause_for_user();
+        return;
+    }
+    
+    // 목표 시각에 가장 가까운 백업으로 먼저 미리 보기
+    char backup_path[MAX_PATH_LENGTH];
+    ChangeLogRecoverOptions options;
+    ChangeLogRecoverReport report;
+    change_log_default_options(&options);
+    options.dry_run = TRUE;
+    if (change_log_find_backup(g_database, g_config.backup_directory, target_time, backup_path,
+                               sizeof(backup_path)) != SUCCESS ||
+        change_log_recover(g_database, backup_path, target_time, &options, &report) != SUCCESS) {
+        print_error_message("이 시각으로 복구할 수 없습니다.");
+        pause_for_user();
+        return;
+    }
+    
+    printf("\n백업 파일: %s (%s UTC)\n", backup_path, report.backup_time);
+    for (int i = 0; i < report.table_count; i++) {
+        printf("  %-20s 추가 %lld, 수정 %lld, 삭제 %lld\n", report.tables[i].table_name,
+               report.tables[i].inserts, report.tables[i].updates, report.tables[i].deletes);
+    }
+    printf("적용할 변경 %lld건, 버릴 변경 %lld건\n\n", report.applied, report.skipped);
+    
+    print_warning_message("주의: 현재 데이터베이스가 입력한 시각의 상태로 바뀌고 그 이후의 변경은 사라집니다.");
+    if (!get_yes_no_input("정말 복구하시겠습니까? (y/n): ")) {
+        return;
+    }
+    
+    options.dry_run = FALSE;
+    if (change_log_recover(g_database, backup_path, target_time, &options, &report) == SUCCESS) {
+        print_success_message("특정 시점으로 복구를 완료했습니다.");
+        log_message(LOG_INFO, "시점 복구 성공: %s에 %s까지 변경 %lld건 적용 (%.2f초)", backup_path, target_time,
+                    report.applied, report.elapsed_seconds);
+    } else {
+        print_error_message("특정 시점으로 복구하지 못했습니다.");
+    }
+    
+    pause_for_user();
+}
+
 void restore_database_interactive(void) {
     clear_screen();
     print_header("데이터베이스 복원");
@@ -1226,6 +1743,8 @@ void configure_system_interactive(void) {
     printf("4. 최대 대출 권수: %d권\n", g_config.max_loan_count);
     printf("5. 최대 연장 횟수: %d회\n", g_config.max_renewal_count);
     printf("6. 자동 백업: %s\n", g_config.auto_backup_enabled ? "사용" : "사용 안 함");
+    printf("7. 로그 파일 교체: %dKB 초과%s, 최근 %d개 보관\n", g_config.log_max_size_kb,
+           g_config.log_rotate_daily ? " 또는 날짜 변경 시" : "", g_config.log_retention_count);
     
     if (get_yes_no_input("\n설정을 변경하시겠습니까? (y/n): ")) {
         if (save_config("config.ini", &g_config) == SUCCESS) {
@@ -1238,17 +1757,79 @@ void configure_system_interactive(void) {
     pause_for_user();
 }
 
+static void print_log_line(const char *line, size_t length, void *user_data) {
+    (void)user_data;
+    printf("%.*s\n", (int)length, line);
+}
+
 void show_system_log(void) {
     clear_screen();
     print_header("시스템 로그");
     
+    // 아직 버퍼에 있는 로그까지 파일에 쓴 뒤 끝부분만 읽음
+    logger_flush();
+    
     if (file_exists("library.log")) {
-        printf("최근 로그 항목들:\n\n");
-        // 간단한 로그 표시 (실제로는 파일을 읽어서 표시)
-        printf("로그 파일을 확인하세요: library.log\n");
+        printf("최근 로그 항목들 (최대 %d건):\n\n", SYSTEM_LOG_TAIL_LINES);
+        if (logger_read_tail("library.log", SYSTEM_LOG_TAIL_LINES, print_log_line, NULL) == FAILURE) {
+            print_error_message("로그 파일을 읽을 수 없습니다.");
+        }
     } else {
         print_info_message("로그 파일이 없습니다.");
     }
     
     pause_for_user();
 }
+
+void show_metrics_interactive(void) {
+    clear_screen();
+    print_header("API 응답 시간");
+    
+    printf("프로그램 시작 후 API별 응답 시간 분포입니다 (I/O 대기 포함).\n\n");
+    if (metrics_print(stdout) == 0) {
+        print_info_message("아직 기록된 호출이 없습니다.");
+        pause_for_user();
+        return;
+    }
+    
+    if (get_yes_no_input("\n파일로 저장하시겠습니까? (y/n): ")) {
+        char dump_path[512];
+        time_t now = time(NULL);
+        struct tm *tm_info = localtime(&now);
+        
+        snprintf(dump_path, sizeof(dump_path), "metrics_%04d%02d%02d_%02d%02d%02d.txt",
+                 tm_info->tm_year + 1900, tm_info->tm_mon + 1, tm_info->tm_mday,
+                 tm_info->tm_hour, tm_info->tm_min, tm_info->tm_sec);
+        
+        if (metrics_dump(dump_path) == SUCCESS) {
+            print_success_message("응답 시간 지표를 저장했습니다.");
+            printf("저장 파일: %s\n", dump_path);
+        } else {
+            print_error_message("응답 시간 지표 저장에 실패했습니다.");
+        }
+    }
+    
+    pause_for_user();
+}
+
+void show_sql_profile_interactive(void) {
+    clear_screen();
+    print_header("SQL 실행 통계");
+    
+    if (!query_profiler_is_enabled()) {
+        print_info_message("SQL 프로파일러가 꺼져 있습니다. config.ini에서 sql_profile_enabled=true로 설정하세요.");
+        pause_for_user();
+        return;
+    }
+    
+    printf("총 실행 시간이 긴 SQL 문장 (최대 %d개, 느린 쿼리 기준 %dms):\n\n",
+           QUERY_PROFILER_REPORT_TOP, g_config.slow_query_threshold_ms);
+    if (query_profiler_report(stdout, QUERY_PROFILER_REPORT_TOP) == 0) {
+        print_info_message("아직 실행된 SQL이 없습니다.");
+    } else if (get_yes_no_input("\n통계를 초기화하시겠습니까? (y/n): ")) {
+        query_profiler_reset();
+        print_success_message("SQL 실행 통계를 초기화했습니다.");
+    }
+    
+    pause_for_user();
+}
@@ -0,0 +1,716 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "../include/marc.h"
+#include "../include/database.h"
+
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#define RECORD_TERMINATOR 0x1D
+#define FIELD_TERMINATOR 0x1E
+#define SUBFIELD_DELIMITER 0x1F
+#define DIRECTORY_ENTRY_LENGTH 12
+#define MAX_FIELD_LENGTH 9999        // 디렉터리의 필드 길이 자리수(4자리)
+#define DEFAULT_LEADER "00000nam a2200000   4500"
+#define FIXED_FIELD_LENGTH 40        // 008 고정 길이 필드
+
+// ---------------------------------------------------------------------------
+// 읽기
+// ---------------------------------------------------------------------------
+
+// 자리수가 정해진 십진수 (숫자가 아닌 문자가 있으면 FAILURE)
+static int parse_digits(const unsigned char *text, int digits, size_t *value) {
+    size_t result = 0;
+    for (int i = 0; i < digits; i++) {
+        if (!isdigit(text[i])) {
+            return FAILURE;
+        }
+        result = result * 10 + (size_t)(text[i] - '0');
+    }
+    *value = result;
+    return SUCCESS;
+}
+
+int marc_reader_open(MarcReader *reader, const char *path) {
+    if (!reader || !path) {
+        fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
+        return FAILURE;
+    }
+    memset(reader, 0, sizeof(MarcReader));
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        fprintf(stderr, "MARC 파일을 열 수 없습니다: %s\n", path);
+        return FAILURE;
+    }
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size)) {
+        CloseHandle(file);
+        return FAILURE;
+    }
+    reader->size = (size_t)file_size.QuadPart;
+    if (reader->size > 0) {
+        HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+        reader->data = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, reader->size) : NULL;
+        if (!reader->data) {
+            if (mapping) CloseHandle(mapping);
+            CloseHandle(file);
+            fprintf(stderr, "MARC 파일을 메모리에 매핑할 수 없습니다: %s\n", path);
+            return FAILURE;
+        }
+        reader->mapping = mapping;
+    }
+    CloseHandle(file);
+#else
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        fprintf(stderr, "MARC 파일을 열 수 없습니다: %s\n", path);
+        return FAILURE;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        close(fd);
+        return FAILURE;
+    }
+    reader->size = (size_t)info.st_size;
+    if (reader->size > 0) {
+        void *mapped = mmap(NULL, reader->size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapped == MAP_FAILED) {
+            close(fd);
+            fprintf(stderr, "MARC 파일을 메모리에 매핑할 수 없습니다: %s\n", path);
+            return FAILURE;
+        }
+#ifdef MADV_SEQUENTIAL
+        // 처음부터 끝까지 한 번 읽으므로 미리 읽기를 크게 잡음
+        madvise(mapped, reader->size, MADV_SEQUENTIAL);
+#endif
+        reader->data = mapped;
+    }
+    close(fd);
+#endif
+    return SUCCESS;
+}
+
+void marc_reader_close(MarcReader *reader) {
+    if (!reader) {
+        return;
+    }
+#ifdef _WIN32
+    if (reader->data) {
+        UnmapViewOfFile(reader->data);
+    }
+    if (reader->mapping) {
+        CloseHandle((HANDLE)reader->mapping);
+    }
+#else
+    if (reader->data) {
+        munmap((void*)reader->data, reader->size);
+    }
+#endif
+    memset(reader, 0, sizeof(MarcReader));
+}
+
+int marc_reader_seek(MarcReader *reader, size_t offset, long long records) {
+    if (!reader || offset > reader->size) {
+        return FAILURE;
+    }
+    reader->offset = offset;
+    reader->records = records;
+    return SUCCESS;
+}
+
+// 리더와 디렉터리가 레코드 안에서 맞는지 확인
+static int check_record(const unsigned char *data, size_t length, size_t *base_address, int *field_count) {
+    size_t base;
+    if (parse_digits(data + 12, 5, &base) != SUCCESS ||
+        base < MARC_LEADER_LENGTH + 1 || base >= length ||
+        data[base - 1] != FIELD_TERMINATOR ||
+        (base - 1 - MARC_LEADER_LENGTH) % DIRECTORY_ENTRY_LENGTH != 0) {
+        return FAILURE;
+    }
+
+    int count = (int)((base - 1 - MARC_LEADER_LENGTH) / DIRECTORY_ENTRY_LENGTH);
+    size_t data_length = length - 1 - base;
+    for (int i = 0; i < count; i++) {
+        const unsigned char *entry = data + MARC_LEADER_LENGTH + (size_t)i * DIRECTORY_ENTRY_LENGTH;
+        size_t field_length;
+        size_t start;
+        if (parse_digits(entry + 3, 4, &field_length) != SUCCESS ||
+            parse_digits(entry + 7, 5, &start) != SUCCESS ||
+            field_length == 0 || start + field_length > data_length) {
+            return FAILURE;
+        }
+    }
+
+    *base_address = base;
+    *field_count = count;
+    return SUCCESS;
+}
+
+int marc_reader_next(MarcReader *reader, MarcRecord *record) {
+    if (!reader || !record) {
+        return FAILURE;
+    }
+
+    // 레코드 사이에 줄바꿈을 넣어 보내는 공급처가 있으므로 건너뜀
+    while (reader->offset < reader->size &&
+           (reader->data[reader->offset] == '\n' || reader->data[reader->offset] == '\r')) {
+        reader->offset++;
+    }
+    if (reader->offset >= reader->size) {
+        return FALSE;
+    }
+
+    const unsigned char *start = reader->data + reader->offset;
+    size_t remaining = reader->size - reader->offset;
+    size_t length = 0;
+    memset(record, 0, sizeof(MarcRecord));
+    record->data = start;
+    record->offset = reader->offset;
+    reader->records++;
+
+    if (remaining >= MARC_LEADER_LENGTH && parse_digits(start, 5, &length) == SUCCESS &&
+        length > MARC_LEADER_LENGTH && length <= remaining && start[length - 1] == RECORD_TERMINATOR &&
+        check_record(start, length, &record->base_address, &record->field_count) == SUCCESS) {
+        record->length = length;
+        reader->offset += length;
+        return TRUE;
+    }
+
+    // 손상된 레코드: 다음 레코드 종단 기호까지 건너뜀
+    const unsigned char *end = memchr(start, RECORD_TERMINATOR, remaining);
+    record->length = end ? (size_t)(end - start) + 1 : remaining;
+    reader->offset += record->length;
+    return FAILURE;
+}
+
+int marc_record_field(const MarcRecord *record, int index, MarcField *field) {
+    if (!record || !field || index < 0 || index >= record->field_count) {
+        return FAILURE;
+    }
+
+    const unsigned char *entry = record->data + MARC_LEADER_LENGTH + (size_t)index * DIRECTORY_ENTRY_LENGTH;
+    size_t length = 0;
+    size_t start = 0;
+    if (parse_digits(entry + 3, 4, &length) != SUCCESS || parse_digits(entry + 7, 5, &start) != SUCCESS) {
+        return FAILURE;
+    }
+
+    memcpy(field->tag, entry, 3);
+    field->tag[3] = '\0';
+    field->data = record->data + record->base_address + start;
+    field->length = length;
+    if (field->length > 0 && field->data[field->length - 1] == FIELD_TERMINATOR) {
+        field->length--;
+    }
+    return SUCCESS;
+}
+
+int marc_record_find_field(const MarcRecord *record, const char *tag, MarcField *field) {
+    if (!record || !tag || !field) {
+        return FALSE;
+    }
+    for (int i = 0; i < record->field_count; i++) {
+        const unsigned char *entry = record->data + MARC_LEADER_LENGTH + (size_t)i * DIRECTORY_ENTRY_LENGTH;
+        if (memcmp(entry, tag, 3) == 0) {
+            return marc_record_field(record, i, field) == SUCCESS;
+        }
+    }
+    return FALSE;
+}
+
+int marc_field_subfield(const MarcField *field, char code, const char **value, size_t *length) {
+    if (!field || !value || !length || field->length < 2) {
+        return FALSE;
+    }
+
+    const unsigned char *p = field->data + 2;
+    const unsigned char *end = field->data + field->length;
+    while (p < end) {
+        const unsigned char *delimiter = memchr(p, SUBFIELD_DELIMITER, (size_t)(end - p));
+        if (!delimiter || delimiter + 1 >= end) {
+            return FALSE;
+        }
+        const unsigned char *start = delimiter + 2;
+        const unsigned char *next = start < end ? memchr(start, SUBFIELD_DELIMITER, (size_t)(end - start)) : NULL;
+        if (!next) {
+            next = end;
+        }
+        if (delimiter[1] == (unsigned char)code) {
+            *value = (const char*)(start < end ? start : end);
+            *length = start < next ? (size_t)(next - start) : 0;
+            return TRUE;
+        }
+        p = next;
+    }
+    return FALSE;
+}
+
+// ---------------------------------------------------------------------------
+// 도서 정보로 바꾸기
+// ---------------------------------------------------------------------------
+
+// 앞뒤 공백과 ISBD 구두점(" /", " :", " ;", " =", ",", ".")을 뗀 구간
+static void trim_punctuation(const char **value, size_t *length) {
+    const char *text = *value;
+    size_t n = *length;
+
+    while (n > 0 && (*text == ' ' || *text == '[')) {
+        text++;
+        n--;
+    }
+    while (n > 0) {
+        char last = text[n - 1];
+        if (last == ' ' || last == '/' || last == ':' || last == ';' || last == '=' || last == ',' || last == ']') {
+            n--;
+        } else if (last == '.' && !(n >= 2 && isupper((unsigned char)text[n - 2]) &&
+                                    (n == 2 || text[n - 3] == ' '))) {
+            // "J." 같은 이니셜의 마침표는 남김
+            n--;
+        } else {
+            break;
+        }
+    }
+    *value = text;
+    *length = n;
+}
+
+// 구간을 버퍼에 이어 붙임 (넘치면 FAILURE)
+static int append_value(char *dest, size_t dest_size, const char *value, size_t length) {
+    size_t used = strlen(dest);
+    if (used + length >= dest_size) {
+        return FAILURE;
+    }
+    memcpy(dest + used, value, length);
+    dest[used + length] = '\0';
+    return SUCCESS;
+}
+
+// 하위 필드를 구두점을 떼고 복사. 없거나 비어 있으면 FALSE, 넘치면 FAILURE
+static int copy_subfield(const MarcField *field, char code, char *dest, size_t dest_size) {
+    const char *value;
+    size_t length;
+    if (!marc_field_subfield(field, code, &value, &length)) {
+        return FALSE;
+    }
+    trim_punctuation(&value, &length);
+    if (length == 0) {
+        return FALSE;
+    }
+    dest[0] = '\0';
+    return append_value(dest, dest_size, value, length) == SUCCESS ? TRUE : FAILURE;
+}
+
+// 하위 필드 값 앞쪽의 숫자 (없으면 FALSE)
+static int subfield_number(const MarcField *field, char code, int digits_required, int *number) {
+    const char *value;
+    size_t length;
+    if (!marc_field_subfield(field, code, &value, &length)) {
+        return FALSE;
+    }
+    for (size_t i = 0; i < length; i++) {
+        if (!isdigit((unsigned char)value[i])) {
+            continue;
+        }
+        size_t end = i;
+        int result = 0;
+        while (end < length && isdigit((unsigned char)value[end]) && end - i < 9) {
+            result = result * 10 + (value[end] - '0');
+            end++;
+        }
+        if (digits_required == 0 || (int)(end - i) == digits_required) {
+            *number = result;
+            return TRUE;
+        }
+        i = end;
+    }
+    return FALSE;
+}
+
+const char *marc_record_to_book(const MarcRecord *record, Book *book) {
+    if (!record || !book || record->field_count == 0) {
+        return "손상된 MARC 레코드입니다";
+    }
+    memset(book, 0, sizeof(Book));
+
+    // UTF-8이 아닌 MARC-8 레코드는 한글 등이 깨지므로 ASCII만 있는 경우에만 받음
+    if (record->data[9] != 'a') {
+        for (size_t i = 0; i < record->length; i++) {
+            if (record->data[i] >= 0x80) {
+                return "MARC-8 문자 인코딩은 지원하지 않습니다";
+            }
+        }
+    }
+
+    MarcField field;
+    int status;
+
+    // 020: 여러 개면 $a가 있는 첫 필드 ("9788966260959 (pbk.)"처럼 붙은 설명은 뗌)
+    for (int i = 0; i < record->field_count; i++) {
+        const char *value;
+        size_t length;
+        if (marc_record_field(record, i, &field) != SUCCESS || strcmp(field.tag, "020") != 0 ||
+            !marc_field_subfield(&field, 'a', &value, &length)) {
+            continue;
+        }
+        size_t n = 0;
+        while (n < length && (isdigit((unsigned char)value[n]) || value[n] == '-' ||
+                              value[n] == 'X' || value[n] == 'x')) {
+            n++;
+        }
+        if (n >= sizeof(book->isbn)) {
+            return "ISBN이 너무 깁니다";
+        }
+        memcpy(book->isbn, value, n);
+        book->isbn[n] = '\0';
+        for (char *p = book->isbn; *p; p++) {
+            if (*p == 'x') {
+                *p = 'X';
+            }
+        }
+        break;
+    }
+
+    if (!marc_record_find_field(record, "245", &field)) {
+        return "245 필드(표제)가 없습니다";
+    }
+    status = copy_subfield(&field, 'a', book->title, sizeof(book->title));
+    if (status == FAILURE) {
+        return "표제가 너무 깁니다";
+    }
+    if (status == TRUE) {
+        char subtitle[sizeof(book->title)];
+        status = copy_subfield(&field, 'b', subtitle, sizeof(subtitle));
+        if (status == FAILURE ||
+            (status == TRUE && (append_value(book->title, sizeof(book->title), " : ", 3) != SUCCESS ||
+                                append_value(book->title, sizeof(book->title), subtitle, strlen(subtitle)) != SUCCESS))) {
+            return "표제가 너무 깁니다";
+        }
+    }
+
+    // 주표목이 없는 편저 등은 부출표목이나 책임표시로 대신함
+    static const struct {
+        const char *tag;
+        char code;
+    } author_sources[] = { { "100", 'a' }, { "110", 'a' }, { "700", 'a' }, { "245", 'c' } };
+    for (size_t i = 0; i < sizeof(author_sources) / sizeof(author_sources[0]); i++) {
+        if (!marc_record_find_field(record, author_sources[i].tag, &field)) {
+            continue;
+        }
+        status = copy_subfield(&field, author_sources[i].code, book->author, sizeof(book->author));
+        if (status == FAILURE) {
+            return "저자가 너무 깁니다";
+        }
+        if (status == TRUE) {
+            break;
+        }
+    }
+
+    if (marc_record_find_field(record, "260", &field) || marc_record_find_field(record, "264", &field)) {
+        if (copy_subfield(&field, 'b', book->publisher, sizeof(book->publisher)) == FAILURE) {
+            return "출판사가 너무 깁니다";
+        }
+        subfield_number(&field, 'c', 4, &book->publication_year);
+    }
+
+    if (marc_record_find_field(record, "650", &field) &&
+        copy_subfield(&field, 'a', book->category, sizeof(book->category)) == FAILURE) {
+        return "주제명이 너무 깁니다";
+    }
+
+    book->total_copies = 1;
+    if (marc_record_find_field(record, "949", &field)) {
+        subfield_number(&field, 't', 0, &book->total_copies);
+    }
+    book->available_copies = book->total_copies;
+    if (marc_record_find_field(record, "949", &field)) {
+        subfield_number(&field, 'v', 0, &book->available_copies);
+    }
+    return NULL;
+}
+
+// ---------------------------------------------------------------------------
+// 쓰기
+// ---------------------------------------------------------------------------
+
+static int ensure_capacity(unsigned char **buffer, size_t *capacity, size_t needed) {
+    if (needed <= *capacity) {
+        return SUCCESS;
+    }
+    size_t grown = *capacity ? *capacity : 256;
+    while (grown < needed) {
+        grown *= 2;
+    }
+    unsigned char *resized = realloc(*buffer, grown);
+    if (!resized) {
+        return FAILURE;
+    }
+    *buffer = resized;
+    *capacity = grown;
+    return SUCCESS;
+}
+
+static void append_bytes(MarcWriter *writer, const void *data, size_t length) {
+    if (ensure_capacity(&writer->fields, &writer->fields_capacity, writer->fields_length + length) != SUCCESS) {
+        writer->overflow = TRUE;
+        return;
+    }
+    memcpy(writer->fields + writer->fields_length, data, length);
+    writer->fields_length += length;
+}
+
+// 데이터 영역의 start부터 끝까지를 필드 하나로 디렉터리에 등록
+static void add_directory_entry(MarcWriter *writer, const char *tag, size_t start) {
+    size_t length = writer->fields_length - start;
+    if (length > MAX_FIELD_LENGTH || start > MARC_MAX_RECORD_LENGTH ||
+        ensure_capacity(&writer->directory, &writer->directory_capacity,
+                        writer->directory_length + DIRECTORY_ENTRY_LENGTH + 1) != SUCCESS) {
+        writer->overflow = TRUE;
+        return;
+    }
+    char entry[DIRECTORY_ENTRY_LENGTH + 1];
+    snprintf(entry, sizeof(entry), "%.3s%04zu%05zu", tag, length, start);
+    memcpy(writer->directory + writer->directory_length, entry, DIRECTORY_ENTRY_LENGTH);
+    writer->directory_length += DIRECTORY_ENTRY_LENGTH;
+}
+
+static void close_field(MarcWriter *writer) {
+    if (!writer->field_open) {
+        return;
+    }
+    unsigned char terminator = FIELD_TERMINATOR;
+    append_bytes(writer, &terminator, 1);
+    add_directory_entry(writer, writer->field_tag, writer->field_start);
+    writer->field_open = FALSE;
+}
+
+int marc_writer_init(MarcWriter *writer, FILE *file) {
+    if (!writer || !file) {
+        fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
+        return FAILURE;
+    }
+    memset(writer, 0, sizeof(MarcWriter));
+    writer->file = file;
+    if (ensure_capacity(&writer->fields, &writer->fields_capacity, 4096) != SUCCESS ||
+        ensure_capacity(&writer->directory, &writer->directory_capacity, 512) != SUCCESS) {
+        marc_writer_free(writer);
+        fprintf(stderr, "메모리 할당 실패\n");
+        return FAILURE;
+    }
+    return SUCCESS;
+}
+
+void marc_writer_begin_record(MarcWriter *writer, const unsigned char *leader) {
+    memcpy(writer->leader, leader ? leader : (const unsigned char*)DEFAULT_LEADER, MARC_LEADER_LENGTH);
+    writer->directory_length = 0;
+    writer->fields_length = 0;
+    writer->field_open = FALSE;
+    writer->overflow = FALSE;
+}
+
+void marc_writer_add_field(MarcWriter *writer, const char *tag, const void *data, size_t length) {
+    close_field(writer);
+    size_t start = writer->fields_length;
+    unsigned char terminator = FIELD_TERMINATOR;
+    append_bytes(writer, data, length);
+    append_bytes(writer, &terminator, 1);
+    add_directory_entry(writer, tag, start);
+}
+
+void marc_writer_begin_field(MarcWriter *writer, const char *tag, char indicator1, char indicator2) {
+    close_field(writer);
+    memcpy(writer->field_tag, tag, 3);
+    writer->field_tag[3] = '\0';
+    writer->field_start = writer->fields_length;
+    writer->field_open = TRUE;
+    char indicators[2] = { indicator1, indicator2 };
+    append_bytes(writer, indicators, 2);
+}
+
+void marc_writer_add_subfield(MarcWriter *writer, char code, const char *value) {
+    if (!writer->field_open || !value) {
+        return;
+    }
+    unsigned char header[2] = { SUBFIELD_DELIMITER, (unsigned char)code };
+    append_bytes(writer, header, 2);
+    append_bytes(writer, value, strlen(value));
+}
+
+int marc_writer_end_record(MarcWriter *writer) {
+    close_field(writer);
+
+    size_t base = MARC_LEADER_LENGTH + writer->directory_length + 1;
+    size_t length = base + writer->fields_length + 1;
+    if (writer->overflow || length > MARC_MAX_RECORD_LENGTH) {
+        fprintf(stderr, "MARC 레코드가 너무 큽니다 (%zu바이트).\n", length);
+        return FAILURE;
+    }
+
+    char number[6];
+    snprintf(number, sizeof(number), "%05zu", length);
+    memcpy(writer->leader, number, 5);
+    snprintf(number, sizeof(number), "%05zu", base);
+    memcpy(writer->leader + 12, number, 5);
+
+    unsigned char field_terminator = FIELD_TERMINATOR;
+    unsigned char record_terminator = RECORD_TERMINATOR;
+    fwrite(writer->leader, 1, MARC_LEADER_LENGTH, writer->file);
+    fwrite(writer->directory, 1, writer->directory_length, writer->file);
+    fwrite(&field_terminator, 1, 1, writer->file);
+    fwrite(writer->fields, 1, writer->fields_length, writer->file);
+    if (fwrite(&record_terminator, 1, 1, writer->file) != 1 || ferror(writer->file)) {
+        fprintf(stderr, "MARC 레코드 쓰기 실패\n");
+        return FAILURE;
+    }
+    writer->records++;
+    return SUCCESS;
+}
+
+int marc_writer_write_book(MarcWriter *writer, const Book *book) {
+    if (!writer || !book) {
+        fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
+        return FAILURE;
+    }
+
+    char number[32];
+    marc_writer_begin_record(writer, NULL);
+
+    snprintf(number, sizeof(number), "%d", book->id);
+    marc_writer_add_field(writer, "001", number, strlen(number));
+
+    // 008: 발행 연도(07-10)와 미상 언어 코드(35-37)만 채운 고정 길이 필드
+    char fixed[FIXED_FIELD_LENGTH + 1];
+    memset(fixed, ' ', FIXED_FIELD_LENGTH);
+    fixed[FIXED_FIELD_LENGTH] = '\0';
+    if (book->publication_year > 0 && book->publication_year <= 9999) {
+        fixed[6] = 's';
+        snprintf(number, sizeof(number), "%04d", book->publication_year);
+        memcpy(fixed + 7, number, 4);
+    } else {
+        fixed[6] = 'n';
+        memcpy(fixed + 7, "uuuu", 4);
+    }
+    memcpy(fixed + 35, "und", 3);
+    marc_writer_add_field(writer, "008", fixed, FIXED_FIELD_LENGTH);
+
+    if (book->isbn[0] != '\0') {
+        marc_writer_begin_field(writer, "020", ' ', ' ');
+        marc_writer_add_subfield(writer, 'a', book->isbn);
+    }
+    marc_writer_begin_field(writer, "100", '1', ' ');
+    marc_writer_add_subfield(writer, 'a', book->author);
+    marc_writer_begin_field(writer, "245", '1', '0');
+    marc_writer_add_subfield(writer, 'a', book->title);
+    if (book->publisher[0] != '\0' || book->publication_year > 0) {
+        marc_writer_begin_field(writer, "260", ' ', ' ');
+        if (book->publisher[0] != '\0') {
+            marc_writer_add_subfield(writer, 'b', book->publisher);
+        }
+        if (book->publication_year > 0) {
+            snprintf(number, sizeof(number), "%d", book->publication_year);
+            marc_writer_add_subfield(writer, 'c', number);
+        }
+    }
+    if (book->category[0] != '\0') {
+        marc_writer_begin_field(writer, "650", ' ', '4');
+        marc_writer_add_subfield(writer, 'a', book->category);
+    }
+
+    // 로컬 소장 필드: 보유 권수와 대출 가능 권수
+    marc_writer_begin_field(writer, "949", ' ', ' ');
+    snprintf(number, sizeof(number), "%d", book->total_copies);
+    marc_writer_add_subfield(writer, 't', number);
+    snprintf(number, sizeof(number), "%d", book->available_copies);
+    marc_writer_add_subfield(writer, 'v', number);
+
+    return marc_writer_end_record(writer);
+}
+
+void marc_writer_free(MarcWriter *writer) {
+    if (!writer) {
+        return;
+    }
+    free(writer->directory);
+    free(writer->fields);
+    writer->directory = NULL;
+    writer->fields = NULL;
+    writer->directory_capacity = 0;
+    writer->fields_capacity = 0;
+}
+
+// 열 값을 버퍼에 복사 (NULL이면 빈 문자열)
+static void copy_column(char *dest, size_t dest_size, const unsigned char *value) {
+    snprintf(dest, dest_size, "%s", value ? (const char*)value : "");
+}
+
+int marc_export_books(sqlite3 *db, const char *path, long long *exported) {
+    if (!db || !path) {
+        fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
+        return FAILURE;
+    }
+    if (exported) {
+        *exported = 0;
+    }
+
+    const char *sql =
+        "SELECT id, title, author, isbn, publisher, publication_year, "
+        "total_copies, available_copies, category FROM books ORDER BY id;";
+    sqlite3_stmt *stmt = NULL;
+    if (database_prepare_statement(db, sql, &stmt) != SUCCESS) {
+        return FAILURE;
+    }
+
+    FILE *file = fopen(path, "wb");
+    if (!file) {
+        fprintf(stderr, "내보낼 파일을 열 수 없습니다: %s\n", path);
+        sqlite3_finalize(stmt);
+        return FAILURE;
+    }
+    char *buffer = malloc(MARC_WRITE_BUFFER_SIZE);
+    if (buffer) {
+        setvbuf(file, buffer, _IOFBF, MARC_WRITE_BUFFER_SIZE);
+    }
+
+    MarcWriter writer;
+    int status = marc_writer_init(&writer, file);
+    int rc = SQLITE_DONE;
+    while (status == SUCCESS && (rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+        Book book;
+        memset(&book, 0, sizeof(Book));
+        book.id = sqlite3_column_int(stmt, 0);
+        copy_column(book.title, sizeof(book.title), sqlite3_column_text(stmt, 1));
+        copy_column(book.author, sizeof(book.author), sqlite3_column_text(stmt, 2));
+        copy_column(book.isbn, sizeof(book.isbn), sqlite3_column_text(stmt, 3));
+        copy_column(book.publisher, sizeof(book.publisher), sqlite3_column_text(stmt, 4));
+        book.publication_year = sqlite3_column_int(stmt, 5);
+        book.total_copies = sqlite3_column_int(stmt, 6);
+        book.available_copies = sqlite3_column_int(stmt, 7);
+        copy_column(book.category, sizeof(book.category), sqlite3_column_text(stmt, 8));
+
+        status = marc_writer_write_book(&writer, &book);
+    }
+    if (status == SUCCESS && rc != SQLITE_DONE) {
+        fprintf(stderr, "도서 조회 실패: %s\n", sqlite3_errmsg(db));
+        status = FAILURE;
+    }
+    if (exported) {
+        *exported = writer.records;
+    }
+
+    marc_writer_free(&writer);
+    sqlite3_finalize(stmt);
+    if (fclose(file) != 0) {
+        status = FAILURE;
+    }
+    free(buffer);
+    return status;
+}
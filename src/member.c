@@ -7,11 +7,16 @@
 #include "../include/member.h"
 #include "../include/database.h"
 #include "../include/constants.h"
+#include "../include/hangul.h"
+#include "../include/metrics.h"
+#include "../include/workload_trace.h"
 
 static int member_callback(void *data, int argc, char **argv, char **azColName);
 static int count_callback(void *data, int argc, char **argv, char **azColName);
+static int collect_member_rows(sqlite3 *db, sqlite3_stmt *stmt, MemberSearchResult *result);
+static void make_phone_search_keys(const char *phone, char *digits, char *reversed);
 
-int add_member(sqlite3 *db, const Member *member) {
+static int add_member_impl(sqlite3 *db, const Member *member) {
     if (!db || !member) {
         fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
         return FAILURE;
@@ -22,16 +27,28 @@ int add_member(sqlite3 *db, const Member *member) {
         return FAILURE;
     }
     
-    // 이메일 중복 확인
+    // 이메일은 앞뒤 공백을 없애고 소문자로 저장
+    char email[MAX_EMAIL_LENGTH + 1];
+    if (normalize_email(member->email, email, sizeof(email)) != SUCCESS) {
+        fprintf(stderr, "유효하지 않은 회원 정보입니다.\n");
+        return FAILURE;
+    }
+    
+    // 이메일 중복 확인 (대소문자 구분 없음)
     Member existing_member;
-    if (get_member_by_email(db, member->email, &existing_member) == SUCCESS) {
-        fprintf(stderr, "이미 등록된 이메일입니다: %s\n", member->email);
+    if (get_member_by_email(db, email, &existing_member) == SUCCESS) {
+        fprintf(stderr, "이미 등록된 이메일입니다: %s\n", email);
         return FAILURE;
     }
     
     const char *sql = 
-        "INSERT INTO members (name, email, phone, address, is_active) "
-        "VALUES (?, ?, ?, ?, ?);";
+        "INSERT INTO members (name, email, phone, address, is_active, name_norm, name_chosung, "
+        "phone_digits, phone_digits_reversed) "
+        "VALUES (?1, ?2, ?3, ?4, ?5, hangul_normalize(?1), hangul_chosung(?1), ?6, ?7);";
+    
+    char phone_digits[MAX_PHONE_LENGTH + 1];
+    char phone_reversed[MAX_PHONE_LENGTH + 1];
+    make_phone_search_keys(member->phone, phone_digits, phone_reversed);
     
     sqlite3_stmt *stmt = NULL;
     int result = FAILURE;
@@ -42,10 +59,12 @@ int add_member(sqlite3 *db, const Member *member) {
     
     // 매개변수 바인딩
     sqlite3_bind_text(stmt, 1, member->name, -1, SQLITE_STATIC);
-    sqlite3_bind_text(stmt, 2, member->email, -1, SQLITE_STATIC);
+    sqlite3_bind_text(stmt, 2, email, -1, SQLITE_STATIC);
     sqlite3_bind_text(stmt, 3, member->phone, -1, SQLITE_STATIC);
     sqlite3_bind_text(stmt, 4, member->address, -1, SQLITE_STATIC);
     sqlite3_bind_int(stmt, 5, member->is_active);
+    sqlite3_bind_text(stmt, 6, phone_digits, -1, SQLITE_STATIC);
+    sqlite3_bind_text(stmt, 7, phone_reversed, -1, SQLITE_STATIC);
     
     if (sqlite3_step(stmt) == SQLITE_DONE) {
         result = database_get_last_insert_id(db);
@@ -57,7 +76,15 @@ int add_member(sqlite3 *db, const Member *member) {
     return result;
 }
 
-int get_member_by_id(sqlite3 *db, int member_id, Member *member) {
+int add_member(sqlite3 *db, const Member *member) {
+    long long start = metrics_start();
+    int status = add_member_impl(db, member);
+    metrics_record_since(METRIC_ADD_MEMBER, start, status);
+    workload_trace_record(METRIC_ADD_MEMBER, start, status, member);
+    return status;
+}
+
+static int get_member_by_id_impl(sqlite3 *db, int member_id, Member *member) {
     if (!db || !member || member_id <= 0) {
         fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
         return FAILURE;
@@ -99,16 +126,31 @@ int get_member_by_id(sqlite3 *db, int member_id, Member *member) {
     return result;
 }
 
-int get_member_by_email(sqlite3 *db, const char *email, Member *member) {
+int get_member_by_id(sqlite3 *db, int member_id, Member *member) {
+    long long start = metrics_start();
+    int status = get_member_by_id_impl(db, member_id, member);
+    metrics_record_since(METRIC_GET_MEMBER_BY_ID, start, status);
+    workload_trace_record(METRIC_GET_MEMBER_BY_ID, start, status, member_id);
+    return status;
+}
+
+static int get_member_by_email_impl(sqlite3 *db, const char *email, Member *member) {
     if (!db || !email || !member) {
         fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
         return FAILURE;
     }
     
+    // 비교 규칙을 NOCASE로 지정해 변환된 테이블에서는 UNIQUE 인덱스 한 번 조회로 찾고,
+    // 대소문자만 다른 중복 때문에 변환하지 못한 기존 테이블에서도 대소문자가 섞인 이메일을 찾음
+    char normalized_email[MAX_EMAIL_LENGTH + 1];
+    if (normalize_email(email, normalized_email, sizeof(normalized_email)) != SUCCESS) {
+        return FAILURE;
+    }
+    
     const char *sql = 
         "SELECT id, name, email, phone, address, registration_date, "
         "is_active, created_at, updated_at "
-        "FROM members WHERE email = ?;";
+        "FROM members WHERE email = ? COLLATE NOCASE ORDER BY id LIMIT 1;";
     
     sqlite3_stmt *stmt = NULL;
     int result = FAILURE;
@@ -117,7 +159,7 @@ int get_member_by_email(sqlite3 *db, const char *email, Member *member) {
         return FAILURE;
     }
     
-    sqlite3_bind_text(stmt, 1, email, -1, SQLITE_STATIC);
+    sqlite3_bind_text(stmt, 1, normalized_email, -1, SQLITE_STATIC);
     
     if (sqlite3_step(stmt) == SQLITE_ROW) {
         member->id = sqlite3_column_int(stmt, 0);
@@ -141,37 +183,212 @@ int get_member_by_email(sqlite3 *db, const char *email, Member *member) {
     return result;
 }
 
-int search_members_by_name(sqlite3 *db, const char *name, MemberSearchResult *result) {
+int get_member_by_email(sqlite3 *db, const char *email, Member *member) {
+    long long start = metrics_start();
+    int status = get_member_by_email_impl(db, email, member);
+    metrics_record_since(METRIC_GET_MEMBER_BY_EMAIL, start, status);
+    workload_trace_record(METRIC_GET_MEMBER_BY_EMAIL, start, status, email);
+    return status;
+}
+
+static int search_members_by_name_impl(sqlite3 *db, const char *name, MemberSearchResult *result) {
     if (!db || !name || !result) {
         fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
         return FAILURE;
     }
     
-    char sql[MAX_SQL_LENGTH];
-    snprintf(sql, sizeof(sql), 
-        "SELECT id, name, email, phone, address, registration_date, "
-        "is_active, created_at, updated_at "
-        "FROM members WHERE name LIKE '%%%s%%' ORDER BY name;", name);
+    // 초성만 입력하면 초성 컬럼, 아니면 자모 분해된 이름 컬럼에서 접두어 범위 조회
+    int chosung_query = hangul_is_chosung_query(name);
+    size_t key_size = strlen(name) * 3 + 1;
+    size_t bound_size = key_size + 4;
+    char *key = malloc(key_size);
+    char *upper_bound = malloc(bound_size);
     
-    return sqlite3_exec(db, sql, member_callback, result, NULL) == SQLITE_OK ? SUCCESS : FAILURE;
+    if (!key || !upper_bound) {
+        fprintf(stderr, "메모리 할당 실패\n");
+        free(key);
+        free(upper_bound);
+        return FAILURE;
+    }
+    
+    int key_length = chosung_query ? hangul_extract_chosung(name, key, key_size)
+                                   : hangul_normalize(name, key, key_size);
+    if (key_length == FAILURE ||
+        hangul_prefix_upper_bound(key, upper_bound, bound_size) != SUCCESS) {
+        free(key);
+        free(upper_bound);
+        return FAILURE;
+    }
+    
+    const char *sql = chosung_query
+        ? "SELECT id, name, email, phone, address, registration_date, "
+          "is_active, created_at, updated_at "
+          "FROM members WHERE name_chosung >= ?1 AND name_chosung < ?2 ORDER BY name;"
+        : "SELECT id, name, email, phone, address, registration_date, "
+          "is_active, created_at, updated_at "
+          "FROM members WHERE name_norm >= ?1 AND name_norm < ?2 ORDER BY name;";
+    
+    sqlite3_stmt *stmt = NULL;
+    int status = FAILURE;
+    
+    if (database_prepare_statement(db, sql, &stmt) == SUCCESS) {
+        sqlite3_bind_text(stmt, 1, key, -1, SQLITE_STATIC);
+        sqlite3_bind_text(stmt, 2, upper_bound, -1, SQLITE_STATIC);
+        status = collect_member_rows(db, stmt, result);
+        sqlite3_finalize(stmt);
+    }
+    
+    free(key);
+    free(upper_bound);
+    return status;
 }
 
-int search_members_by_phone(sqlite3 *db, const char *phone, MemberSearchResult *result) {
+int search_members_by_name(sqlite3 *db, const char *name, MemberSearchResult *result) {
+    long long start = metrics_start();
+    int status = search_members_by_name_impl(db, name, result);
+    metrics_record_since(METRIC_SEARCH_MEMBERS_BY_NAME, start, status);
+    workload_trace_record(METRIC_SEARCH_MEMBERS_BY_NAME, start, status, name);
+    return status;
+}
+
+static int search_members_by_phone_impl(sqlite3 *db, const char *phone, MemberSearchResult *result) {
     if (!db || !phone || !result) {
         fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
         return FAILURE;
     }
     
-    char sql[MAX_SQL_LENGTH];
-    snprintf(sql, sizeof(sql), 
+    // 입력한 숫자를 뒤집어 phone_digits_reversed의 접두어로 범위 조회 (끝자리 검색)
+    char digits[MAX_PHONE_LENGTH + 1];
+    char reversed[MAX_PHONE_LENGTH + 1];
+    char upper_bound[MAX_PHONE_LENGTH + 2];
+    
+    make_phone_search_keys(phone, digits, reversed);
+    if (digits[0] == '\0') {
+        fprintf(stderr, "전화번호 검색어에 숫자가 없습니다.\n");
+        return FAILURE;
+    }
+    
+    // 숫자 뒤에 오는 ':' 문자를 붙여 접두어 범위의 상한으로 사용
+    snprintf(upper_bound, sizeof(upper_bound), "%s:", reversed);
+    
+    const char *sql = 
         "SELECT id, name, email, phone, address, registration_date, "
         "is_active, created_at, updated_at "
-        "FROM members WHERE phone LIKE '%%%s%%' ORDER BY name;", phone);
+        "FROM members WHERE phone_digits_reversed >= ?1 AND phone_digits_reversed < ?2 "
+        "ORDER BY name;";
     
-    return sqlite3_exec(db, sql, member_callback, result, NULL) == SQLITE_OK ? SUCCESS : FAILURE;
+    sqlite3_stmt *stmt = NULL;
+    
+    if (database_prepare_statement(db, sql, &stmt) != SUCCESS) {
+        return FAILURE;
+    }
+    
+    sqlite3_bind_text(stmt, 1, reversed, -1, SQLITE_STATIC);
+    sqlite3_bind_text(stmt, 2, upper_bound, -1, SQLITE_STATIC);
+    
+    int status = collect_member_rows(db, stmt, result);
+    sqlite3_finalize(stmt);
+    return status;
 }
 
-int update_member(sqlite3 *db, const Member *member) {
+int search_members_by_phone(sqlite3 *db, const char *phone, MemberSearchResult *result) {
+    long long start = metrics_start();
+    int status = search_members_by_phone_impl(db, phone, result);
+    metrics_record_since(METRIC_SEARCH_MEMBERS_BY_PHONE, start, status);
+    workload_trace_record(METRIC_SEARCH_MEMBERS_BY_PHONE, start, status, phone);
+    return status;
+}
+
+static int backfill_member_phone_digits_impl(sqlite3 *db) {
+    if (!db) {
+        fprintf(stderr, "유효하지 않은 데이터베이스 연결입니다.\n");
+        return FAILURE;
+    }
+    
+    // 보충 대상은 idx_members_phone_pending 부분 인덱스로 찾으며, 배치마다 커밋하여 잠금을 짧게 유지
+    const char *select_sql = 
+        "SELECT id, phone FROM members WHERE phone_digits IS NULL ORDER BY id LIMIT ?;";
+    const char *update_sql = 
+        "UPDATE members SET phone_digits = ?, phone_digits_reversed = ? WHERE id = ?;";
+    int total_count = 0;
+    
+    while (1) {
+        sqlite3_stmt *select_stmt = NULL;
+        sqlite3_stmt *update_stmt = NULL;
+        int batch_count = 0;
+        int status = SUCCESS;
+        
+        if (database_begin_immediate_transaction(db) != SUCCESS) {
+            return FAILURE;
+        }
+        
+        if (database_prepare_statement(db, select_sql, &select_stmt) != SUCCESS ||
+            database_prepare_statement(db, update_sql, &update_stmt) != SUCCESS) {
+            sqlite3_finalize(select_stmt);
+            database_rollback_transaction(db);
+            return FAILURE;
+        }
+        
+        sqlite3_bind_int(select_stmt, 1, PHONE_BACKFILL_BATCH_SIZE);
+        
+        int step_result;
+        while ((step_result = sqlite3_step(select_stmt)) == SQLITE_ROW) {
+            char digits[MAX_PHONE_LENGTH + 1];
+            char reversed[MAX_PHONE_LENGTH + 1];
+            
+            // 기존 데이터는 형식이 제각각이므로 검증 없이 숫자만 추출
+            make_phone_search_keys((const char*)sqlite3_column_text(select_stmt, 1), digits, reversed);
+            
+            sqlite3_bind_text(update_stmt, 1, digits, -1, SQLITE_TRANSIENT);
+            sqlite3_bind_text(update_stmt, 2, reversed, -1, SQLITE_TRANSIENT);
+            sqlite3_bind_int(update_stmt, 3, sqlite3_column_int(select_stmt, 0));
+            
+            if (sqlite3_step(update_stmt) != SQLITE_DONE) {
+                fprintf(stderr, "전화번호 검색 컬럼 갱신 실패: %s\n", sqlite3_errmsg(db));
+                status = FAILURE;
+                break;
+            }
+            
+            sqlite3_reset(update_stmt);
+            batch_count++;
+        }
+        
+        if (status == SUCCESS && step_result != SQLITE_ROW && step_result != SQLITE_DONE) {
+            fprintf(stderr, "전화번호 보충 대상 조회 실패: %s\n", sqlite3_errmsg(db));
+            status = FAILURE;
+        }
+        
+        sqlite3_finalize(select_stmt);
+        sqlite3_finalize(update_stmt);
+        
+        if (status != SUCCESS) {
+            database_rollback_transaction(db);
+            return FAILURE;
+        }
+        
+        if (database_commit_transaction(db) != SUCCESS) {
+            database_rollback_transaction(db);
+            return FAILURE;
+        }
+        
+        total_count += batch_count;
+        if (batch_count < PHONE_BACKFILL_BATCH_SIZE) {
+            break;
+        }
+    }
+    
+    return total_count;
+}
+
+int backfill_member_phone_digits(sqlite3 *db) {
+    long long start = metrics_start();
+    int status = backfill_member_phone_digits_impl(db);
+    metrics_record_since(METRIC_BACKFILL_MEMBER_PHONE_DIGITS, start, status);
+    workload_trace_record(METRIC_BACKFILL_MEMBER_PHONE_DIGITS, start, status);
+    return status;
+}
+
+static int update_member_impl(sqlite3 *db, const Member *member) {
     if (!db || !member || member->id <= 0) {
         fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
         return FAILURE;
@@ -182,18 +399,30 @@ int update_member(sqlite3 *db, const Member *member) {
         return FAILURE;
     }
     
-    // 이메일 중복 확인 (자신 제외)
+    char email[MAX_EMAIL_LENGTH + 1];
+    if (normalize_email(member->email, email, sizeof(email)) != SUCCESS) {
+        fprintf(stderr, "유효하지 않은 회원 정보입니다.\n");
+        return FAILURE;
+    }
+    
+    // 이메일 중복 확인 (자신 제외, 대소문자 구분 없음)
     Member existing_member;
-    if (get_member_by_email(db, member->email, &existing_member) == SUCCESS) {
+    if (get_member_by_email(db, email, &existing_member) == SUCCESS) {
         if (existing_member.id != member->id) {
-            fprintf(stderr, "이미 등록된 이메일입니다: %s\n", member->email);
+            fprintf(stderr, "이미 등록된 이메일입니다: %s\n", email);
             return FAILURE;
         }
     }
     
     const char *sql = 
-        "UPDATE members SET name = ?, email = ?, phone = ?, address = ?, "
-        "is_active = ?, updated_at = CURRENT_TIMESTAMP WHERE id = ?;";
+        "UPDATE members SET name = ?1, email = ?2, phone = ?3, address = ?4, "
+        "is_active = ?5, name_norm = hangul_normalize(?1), name_chosung = hangul_chosung(?1), "
+        "phone_digits = ?7, phone_digits_reversed = ?8, "
+        "updated_at = CURRENT_TIMESTAMP WHERE id = ?6;";
+    
+    char phone_digits[MAX_PHONE_LENGTH + 1];
+    char phone_reversed[MAX_PHONE_LENGTH + 1];
+    make_phone_search_keys(member->phone, phone_digits, phone_reversed);
     
     sqlite3_stmt *stmt = NULL;
     int result = FAILURE;
@@ -204,11 +433,13 @@ int update_member(sqlite3 *db, const Member *member) {
     
     // 매개변수 바인딩
     sqlite3_bind_text(stmt, 1, member->name, -1, SQLITE_STATIC);
-    sqlite3_bind_text(stmt, 2, member->email, -1, SQLITE_STATIC);
+    sqlite3_bind_text(stmt, 2, email, -1, SQLITE_STATIC);
     sqlite3_bind_text(stmt, 3, member->phone, -1, SQLITE_STATIC);
     sqlite3_bind_text(stmt, 4, member->address, -1, SQLITE_STATIC);
     sqlite3_bind_int(stmt, 5, member->is_active);
     sqlite3_bind_int(stmt, 6, member->id);
+    sqlite3_bind_text(stmt, 7, phone_digits, -1, SQLITE_STATIC);
+    sqlite3_bind_text(stmt, 8, phone_reversed, -1, SQLITE_STATIC);
     
     if (sqlite3_step(stmt) == SQLITE_DONE) {
         result = SUCCESS;
@@ -220,7 +451,15 @@ int update_member(sqlite3 *db, const Member *member) {
     return result;
 }
 
-int delete_member(sqlite3 *db, int member_id) {
+int update_member(sqlite3 *db, const Member *member) {
+    long long start = metrics_start();
+    int status = update_member_impl(db, member);
+    metrics_record_since(METRIC_UPDATE_MEMBER, start, status);
+    workload_trace_record(METRIC_UPDATE_MEMBER, start, status, member);
+    return status;
+}
+
+static int delete_member_impl(sqlite3 *db, int member_id) {
     if (!db || member_id <= 0) {
         fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
         return FAILURE;
@@ -271,7 +510,15 @@ int delete_member(sqlite3 *db, int member_id) {
     return result;
 }
 
-int deactivate_member(sqlite3 *db, int member_id) {
+int delete_member(sqlite3 *db, int member_id) {
+    long long start = metrics_start();
+    int status = delete_member_impl(db, member_id);
+    metrics_record_since(METRIC_DELETE_MEMBER, start, status);
+    workload_trace_record(METRIC_DELETE_MEMBER, start, status, member_id);
+    return status;
+}
+
+static int deactivate_member_impl(sqlite3 *db, int member_id) {
     if (!db || member_id <= 0) {
         fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
         return FAILURE;
@@ -299,7 +546,15 @@ int deactivate_member(sqlite3 *db, int member_id) {
     return result;
 }
 
-int activate_member(sqlite3 *db, int member_id) {
+int deactivate_member(sqlite3 *db, int member_id) {
+    long long start = metrics_start();
+    int status = deactivate_member_impl(db, member_id);
+    metrics_record_since(METRIC_DEACTIVATE_MEMBER, start, status);
+    workload_trace_record(METRIC_DEACTIVATE_MEMBER, start, status, member_id);
+    return status;
+}
+
+static int activate_member_impl(sqlite3 *db, int member_id) {
     if (!db || member_id <= 0) {
         fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
         return FAILURE;
@@ -327,7 +582,15 @@ int activate_member(sqlite3 *db, int member_id) {
     return result;
 }
 
-int list_all_members(sqlite3 *db, MemberSearchResult *result, int limit, int offset) {
+int activate_member(sqlite3 *db, int member_id) {
+    long long start = metrics_start();
+    int status = activate_member_impl(db, member_id);
+    metrics_record_since(METRIC_ACTIVATE_MEMBER, start, status);
+    workload_trace_record(METRIC_ACTIVATE_MEMBER, start, status, member_id);
+    return status;
+}
+
+static int list_all_members_impl(sqlite3 *db, MemberSearchResult *result, int limit, int offset) {
     if (!db || !result) {
         fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
         return FAILURE;
@@ -349,7 +612,15 @@ int list_all_members(sqlite3 *db, MemberSearchResult *result, int limit, int off
     return sqlite3_exec(db, sql, member_callback, result, NULL) == SQLITE_OK ? SUCCESS : FAILURE;
 }
 
-int list_active_members(sqlite3 *db, MemberSearchResult *result) {
+int list_all_members(sqlite3 *db, MemberSearchResult *result, int limit, int offset) {
+    long long start = metrics_start();
+    int status = list_all_members_impl(db, result, limit, offset);
+    metrics_record_since(METRIC_LIST_ALL_MEMBERS, start, status);
+    workload_trace_record(METRIC_LIST_ALL_MEMBERS, start, status, limit, offset);
+    return status;
+}
+
+static int list_active_members_impl(sqlite3 *db, MemberSearchResult *result) {
     if (!db || !result) {
         fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
         return FAILURE;
@@ -363,8 +634,16 @@ int list_active_members(sqlite3 *db, MemberSearchResult *result) {
     return sqlite3_exec(db, sql, member_callback, result, NULL) == SQLITE_OK ? SUCCESS : FAILURE;
 }
 
-int get_member_loan_stats(sqlite3 *db, int member_id, int *total_loans, 
-                         int *current_loans, int *overdue_loans) {
+int list_active_members(sqlite3 *db, MemberSearchResult *result) {
+    long long start = metrics_start();
+    int status = list_active_members_impl(db, result);
+    metrics_record_since(METRIC_LIST_ACTIVE_MEMBERS, start, status);
+    workload_trace_record(METRIC_LIST_ACTIVE_MEMBERS, start, status);
+    return status;
+}
+
+static int get_member_loan_stats_impl(sqlite3 *db, int member_id, int *total_loans, 
+                                     int *current_loans, int *overdue_loans) {
     if (!db || member_id <= 0 || !total_loans || !current_loans || !overdue_loans) {
         fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
         return FAILURE;
@@ -416,7 +695,16 @@ int get_member_loan_stats(sqlite3 *db, int member_id, int *total_loans,
     return SUCCESS;
 }
 
-int check_member_loan_eligibility(sqlite3 *db, int member_id) {
+int get_member_loan_stats(sqlite3 *db, int member_id, int *total_loans, 
+                         int *current_loans, int *overdue_loans) {
+    long long start = metrics_start();
+    int status = get_member_loan_stats_impl(db, member_id, total_loans, current_loans, overdue_loans);
+    metrics_record_since(METRIC_GET_MEMBER_LOAN_STATS, start, status);
+    workload_trace_record(METRIC_GET_MEMBER_LOAN_STATS, start, status, member_id);
+    return status;
+}
+
+static int check_member_loan_eligibility_impl(sqlite3 *db, int member_id) {
     if (!db || member_id <= 0) {
         fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
         return FAILURE;
@@ -477,6 +765,14 @@ int check_member_loan_eligibility(sqlite3 *db, int member_id) {
     return SUCCESS;
 }
 
+int check_member_loan_eligibility(sqlite3 *db, int member_id) {
+    long long start = metrics_start();
+    int status = check_member_loan_eligibility_impl(db, member_id);
+    metrics_record_since(METRIC_CHECK_MEMBER_LOAN_ELIGIBILITY, start, status);
+    workload_trace_record(METRIC_CHECK_MEMBER_LOAN_ELIGIBILITY, start, status, member_id);
+    return status;
+}
+
 int init_member_search_result(MemberSearchResult *result) {
     if (!result) {
         fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
@@ -562,19 +858,61 @@ int validate_email(const char *email) {
     return SUCCESS;
 }
 
+int normalize_email(const char *email, char *normalized, size_t normalized_size) {
+    if (!email || !normalized || normalized_size == 0) {
+        return FAILURE;
+    }
+    
+    // 앞뒤 공백 제거
+    const char *start = email;
+    const char *end = email + strlen(email);
+    while (start < end && isspace((unsigned char)*start)) {
+        start++;
+    }
+    while (end > start && isspace((unsigned char)*(end - 1))) {
+        end--;
+    }
+    
+    size_t length = (size_t)(end - start);
+    if (length == 0 || length >= normalized_size) {
+        return FAILURE;
+    }
+    
+    // 영문은 소문자로 저장
+    for (size_t i = 0; i < length; i++) {
+        normalized[i] = (char)tolower((unsigned char)start[i]);
+    }
+    normalized[length] = '\0';
+    
+    return SUCCESS;
+}
+
 int validate_phone(const char *phone) {
-    if (!phone || strlen(phone) == 0 || strlen(phone) > MAX_PHONE_LENGTH) {
+    char digits[MAX_PHONE_LENGTH + 1];
+    return normalize_phone(phone, digits, sizeof(digits));
+}
+
+int normalize_phone(const char *phone, char *digits, size_t digits_size) {
+    if (!phone || !digits || digits_size == 0 || strlen(phone) == 0 || strlen(phone) > MAX_PHONE_LENGTH) {
         return FAILURE;
     }
     
-    // 숫자, 하이픈, 공백만 허용
+    size_t length = 0;
+    
+    // 숫자, 하이픈, 공백, 괄호만 허용하고 숫자만 남김
     for (int i = 0; phone[i] != '\0'; i++) {
-        if (!isdigit(phone[i]) && phone[i] != '-' && phone[i] != ' ' && phone[i] != '(' && phone[i] != ')') {
+        if (isdigit((unsigned char)phone[i])) {
+            if (length + 1 >= digits_size) {
+                return FAILURE;
+            }
+            digits[length++] = phone[i];
+        } else if (phone[i] != '-' && phone[i] != ' ' && phone[i] != '(' && phone[i] != ')') {
             return FAILURE;
         }
     }
     
-    return SUCCESS;
+    digits[length] = '\0';
+    return length > 0 ? SUCCESS : FAILURE;
 }
 
 void print_member(const Member *member) {
@@ -675,6 +1013,46 @@ static int member_callback(void *data, int argc, char **argv, char **azColName)
     return SQLITE_OK;
 }
 
+// 전화번호에서 숫자만 뽑은 값과 그 역순 값을 만듦 (버퍼 크기는 MAX_PHONE_LENGTH + 1)
+static void make_phone_search_keys(const char *phone, char *digits, char *reversed) {
+    size_t length = 0;
+    
+    for (int i = 0; phone && phone[i] != '\0' && length < MAX_PHONE_LENGTH; i++) {
+        if (isdigit((unsigned char)phone[i])) {
+            digits[length++] = phone[i];
+        }
+    }
+    digits[length] = '\0';
+    
+    for (size_t i = 0; i < length; i++) {
+        reversed[i] = digits[length - 1 - i];
+    }
+    reversed[length] = '\0';
+}
+
+// 준비된 문장의 결과 행을 member_callback으로 검색 결과에 담음
+static int collect_member_rows(sqlite3 *db, sqlite3_stmt *stmt, MemberSearchResult *result) {
+    char *argv[9];
+    int step_result;
+    
+    while ((step_result = sqlite3_step(stmt)) == SQLITE_ROW) {
+        for (int i = 0; i < 9; i++) {
+            argv[i] = (char*)sqlite3_column_text(stmt, i);
+        }
+        
+        if (member_callback(result, 9, argv, NULL) != SQLITE_OK) {
+            return FAILURE;
+        }
+    }
+    
+    if (step_result != SQLITE_DONE) {
+        fprintf(stderr, "회원 검색 실패: %s\n", sqlite3_errmsg(db));
+        return FAILURE;
+    }
+    
+    return SUCCESS;
+}
+
 static int count_callback(void *data, int argc, char **argv, char **azColName) {
     int *count = (int*)data;
     if (argc > 0 && argv[0]) {
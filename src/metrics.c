@@ -0,0 +1,290 @@
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <stdatomic.h>
+#include "../include/metrics.h"
+#include "../include/utils.h"
+
+#define SUB_BUCKETS (1 << METRICS_SUB_BUCKET_BITS)
+#define BUCKET_COUNT ((METRICS_MAX_EXPONENT - METRICS_SUB_BUCKET_BITS + 2) * SUB_BUCKETS)
+
+// API 하나의 히스토그램: 호출 스레드가 잠금 없이 원자적으로 더함
+typedef struct {
+    atomic_llong buckets[BUCKET_COUNT];
+    atomic_llong count;
+    atomic_llong failures;
+    atomic_llong sum;
+    atomic_llong max;
+} Histogram;
+
+static Histogram histograms[METRIC_COUNT];
+
+// 현재 스레드에서 진행 중인 API 호출 깊이 (공개 API 안에서 다른 공개 API를 부르면 2 이상)
+static _Thread_local int call_depth = 0;
+
+static const char *metric_names[METRIC_COUNT] = {
+    [METRIC_ADD_BOOK] = "add_book",
+    [METRIC_GET_BOOK_BY_ID] = "get_book_by_id",
+    [METRIC_GET_BOOK_BY_ISBN] = "get_book_by_isbn",
+    [METRIC_SEARCH_BOOKS_BY_TITLE] = "search_books_by_title",
+    [METRIC_SEARCH_BOOKS_BY_AUTHOR] = "search_books_by_author",
+    [METRIC_SEARCH_BOOKS_BY_CATEGORY] = "search_books_by_category",
+    [METRIC_UPDATE_BOOK] = "update_book",
+    [METRIC_DELETE_BOOK] = "delete_book",
+    [METRIC_LIST_ALL_BOOKS] = "list_all_books",
+    [METRIC_LIST_AVAILABLE_BOOKS] = "list_available_books",
+    [METRIC_GET_POPULAR_BOOKS] = "get_popular_books",
+
+    [METRIC_ADD_MEMBER] = "add_member",
+    [METRIC_GET_MEMBER_BY_ID] = "get_member_by_id",
+    [METRIC_GET_MEMBER_BY_EMAIL] = "get_member_by_email",
+    [METRIC_SEARCH_MEMBERS_BY_NAME] = "search_members_by_name",
+    [METRIC_SEARCH_MEMBERS_BY_PHONE] = "search_members_by_phone",
+    [METRIC_UPDATE_MEMBER] = "update_member",
+    [METRIC_DELETE_MEMBER] = "delete_member",
+    [METRIC_DEACTIVATE_MEMBER] = "deactivate_member",
+    [METRIC_ACTIVATE_MEMBER] = "activate_member",
+    [METRIC_LIST_ALL_MEMBERS] = "list_all_members",
+    [METRIC_LIST_ACTIVE_MEMBERS] = "list_active_members",
+    [METRIC_GET_MEMBER_LOAN_STATS] = "get_member_loan_stats",
+    [METRIC_CHECK_MEMBER_LOAN_ELIGIBILITY] = "check_member_loan_eligibility",
+    [METRIC_BACKFILL_MEMBER_PHONE_DIGITS] = "backfill_member_phone_digits",
+
+    [METRIC_LOAN_BOOK] = "loan_book",
+    [METRIC_LOAN_BOOK_IDEMPOTENT] = "loan_book_idempotent",
+    [METRIC_RETURN_BOOK] = "return_book",
+    [METRIC_RETURN_BOOK_IDEMPOTENT] = "return_book_idempotent",
+    [METRIC_RETURN_BOOK_BY_IDS] = "return_book_by_ids",
+    [METRIC_RETURN_BOOK_BY_IDS_IDEMPOTENT] = "return_book_by_ids_idempotent",
+    [METRIC_EXTEND_LOAN] = "extend_loan",
+    [METRIC_EXTEND_LOAN_IDEMPOTENT] = "extend_loan_idempotent",
+    [METRIC_PURGE_EXPIRED_LOAN_REQUESTS] = "purge_expired_loan_requests",
+    [METRIC_SHIFT_DUE_DATES] = "shift_due_dates",
+    [METRIC_GET_LOAN_BY_ID] = "get_loan_by_id",
+    [METRIC_GET_MEMBER_LOAN_HISTORY] = "get_member_loan_history",
+    [METRIC_GET_MEMBER_CURRENT_LOANS] = "get_member_current_loans",
+    [METRIC_GET_BOOK_LOAN_HISTORY] = "get_book_loan_history",
+    [METRIC_GET_OVERDUE_LOANS] = "get_overdue_loans",
+    [METRIC_GET_LOANS_DUE_ON_DATE] = "get_loans_due_on_date",
+    [METRIC_GET_CURRENT_LOANS] = "get_current_loans",
+    [METRIC_GET_LOAN_STATISTICS] = "get_loan_statistics",
+    [METRIC_GET_POPULAR_BOOKS_BY_LOANS] = "get_popular_books_by_loans",
+    [METRIC_CHECK_LOAN_AVAILABILITY] = "check_loan_availability",
+    [METRIC_CHECK_DUPLICATE_LOAN] = "check_duplicate_loan",
+};
+
+static int highest_bit(unsigned long long value) {
+    int bit = 0;
+    while (value >>= 1) {
+        bit++;
+    }
+    return bit;
+}
+
+// 값이 들어갈 칸: 16 미만은 값 그대로, 그 이상은 최상위 비트 구간을 16등분
+static int bucket_index(long long value) {
+    if (value < SUB_BUCKETS) {
+        return value < 0 ? 0 : (int)value;
+    }
+
+    int exponent = highest_bit((unsigned long long)value);
+    if (exponent > METRICS_MAX_EXPONENT) {
+        return BUCKET_COUNT - 1;
+    }
+
+    int shift = exponent - METRICS_SUB_BUCKET_BITS;
+    int sub_bucket = (int)((value >> shift) & (SUB_BUCKETS - 1));
+    return (shift + 1) * SUB_BUCKETS + sub_bucket;
+}
+
+// 칸에 들어가는 가장 큰 값
+static long long bucket_upper_bound(int index) {
+    if (index < SUB_BUCKETS) {
+        return index;
+    }
+
+    int shift = index / SUB_BUCKETS - 1;
+    long long lower = (long long)(SUB_BUCKETS + index % SUB_BUCKETS) << shift;
+    return lower + (1LL << shift) - 1;
+}
+
+long long metrics_start(void) {
+    call_depth++;
+    return timer_now_nanoseconds();
+}
+
+void metrics_record_since(MetricId id, long long start_ns, int status) {
+    if (call_depth > 0) {
+        call_depth--;
+    }
+    // 다른 공개 API 안에서 불린 호출은 바깥 호출 시간에 이미 들어가므로 따로 세지 않음
+    if (call_depth > 0) {
+        return;
+    }
+    metrics_record(id, timer_now_nanoseconds() - start_ns);
+    if (status == FAILURE && id >= 0 && id < METRIC_COUNT) {
+        atomic_fetch_add_explicit(&histograms[id].failures, 1, memory_order_relaxed);
+    }
+}
+
+int metrics_call_depth(void) {
+    return call_depth;
+}
+
+void metrics_record(MetricId id, long long elapsed_ns) {
+    if (id < 0 || id >= METRIC_COUNT) {
+        return;
+    }
+    if (elapsed_ns < 0) {
+        elapsed_ns = 0;
+    }
+
+    Histogram *histogram = &histograms[id];
+    atomic_fetch_add_explicit(&histogram->buckets[bucket_index(elapsed_ns)], 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&histogram->count, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&histogram->sum, elapsed_ns, memory_order_relaxed);
+
+    long long current = atomic_load_explicit(&histogram->max, memory_order_relaxed);
+    while (elapsed_ns > current &&
+           !atomic_compare_exchange_weak_explicit(&histogram->max, &current, elapsed_ns,
+                                                  memory_order_relaxed, memory_order_relaxed)) {
+    }
+}
+
+const char *metrics_name(MetricId id) {
+    if (id < 0 || id >= METRIC_COUNT) {
+        return NULL;
+    }
+    return metric_names[id];
+}
+
+int metrics_get_summary(MetricId id, MetricSummary *summary) {
+    if (id < 0 || id >= METRIC_COUNT || !summary) {
+        return FAILURE;
+    }
+
+    Histogram *histogram = &histograms[id];
+    memset(summary, 0, sizeof(MetricSummary));
+    summary->name = metric_names[id];
+
+    // 기록 중에도 읽을 수 있도록 칸을 먼저 복사하고 그 합을 호출 수로 사용
+    static _Thread_local long long snapshot[BUCKET_COUNT];
+    long long count = 0;
+    for (int i = 0; i < BUCKET_COUNT; i++) {
+        snapshot[i] = atomic_load_explicit(&histogram->buckets[i], memory_order_relaxed);
+        count += snapshot[i];
+    }
+    if (count == 0) {
+        return SUCCESS;
+    }
+
+    summary->count = count;
+    long long recorded = atomic_load_explicit(&histogram->count, memory_order_relaxed);
+    summary->failures = atomic_load_explicit(&histogram->failures, memory_order_relaxed);
+    summary->sum = atomic_load_explicit(&histogram->sum, memory_order_relaxed);
+    if (recorded > 0) {
+        summary->mean = summary->sum / recorded;
+    }
+    summary->max = atomic_load_explicit(&histogram->max, memory_order_relaxed);
+
+    const int percentiles[3] = { 50, 95, 99 };
+    long long *targets[3] = { &summary->p50, &summary->p95, &summary->p99 };
+    long long cumulative = 0;
+    int next = 0;
+
+    for (int i = 0; i < BUCKET_COUNT && next < 3; i++) {
+        cumulative += snapshot[i];
+        // 순위는 올림: 100건 중 p99는 99번째 값
+        while (next < 3 && cumulative * 100 >= (long long)percentiles[next] * count) {
+            long long value = bucket_upper_bound(i);
+            *targets[next] = value < summary->max ? value : summary->max;
+            next++;
+        }
+    }
+
+    return SUCCESS;
+}
+
+int metrics_get_cumulative_counts(MetricId id, const long long *bounds_ns, int bound_count, long long *counts) {
+    if (id < 0 || id >= METRIC_COUNT || !bounds_ns || !counts || bound_count < 0) {
+        return FAILURE;
+    }
+
+    Histogram *histogram = &histograms[id];
+    long long cumulative = 0;
+    int next = 0;
+
+    for (int i = 0; i < BUCKET_COUNT && next < bound_count; i++) {
+        long long upper = bucket_upper_bound(i);
+        while (next < bound_count && upper > bounds_ns[next]) {
+            counts[next++] = cumulative;
+        }
+        cumulative += atomic_load_explicit(&histogram->buckets[i], memory_order_relaxed);
+    }
+    while (next < bound_count) {
+        counts[next++] = cumulative;
+    }
+
+    return SUCCESS;
+}
+
+void metrics_reset(void) {
+    for (int id = 0; id < METRIC_COUNT; id++) {
+        Histogram *histogram = &histograms[id];
+        for (int i = 0; i < BUCKET_COUNT; i++) {
+            atomic_store_explicit(&histogram->buckets[i], 0, memory_order_relaxed);
+        }
+        atomic_store_explicit(&histogram->count, 0, memory_order_relaxed);
+        atomic_store_explicit(&histogram->failures, 0, memory_order_relaxed);
+        atomic_store_explicit(&histogram->sum, 0, memory_order_relaxed);
+        atomic_store_explicit(&histogram->max, 0, memory_order_relaxed);
+    }
+}
+
+int metrics_print(FILE *output) {
+    if (!output) {
+        return 0;
+    }
+
+    int printed = 0;
+    fprintf(output, "%-32s %10s %10s %10s %10s %10s %10s\n",
+            "API", "호출 수", "평균(ms)", "p50(ms)", "p95(ms)", "p99(ms)", "최대(ms)");
+
+    for (int id = 0; id < METRIC_COUNT; id++) {
+        MetricSummary summary;
+        if (metrics_get_summary((MetricId)id, &summary) != SUCCESS || summary.count == 0) {
+            continue;
+        }
+
+        fprintf(output, "%-32s %10lld %10.3f %10.3f %10.3f %10.3f %10.3f\n",
+                summary.name, summary.count,
+                summary.mean / 1e6, summary.p50 / 1e6, summary.p95 / 1e6,
+                summary.p99 / 1e6, summary.max / 1e6);
+        printed++;
+    }
+
+    return printed;
+}
+
+int metrics_dump(const char *file_path) {
+    if (!file_path) {
+        return FAILURE;
+    }
+
+    FILE *file = fopen(file_path, "w");
+    if (!file) {
+        fprintf(stderr, "성능 지표 파일을 열 수 없습니다: %s\n", file_path);
+        return FAILURE;
+    }
+
+    char time_str[32];
+    time_t now = time(NULL);
+    strftime(time_str, sizeof(time_str), "%Y-%m-%d %H:%M:%S", localtime(&now));
+    fprintf(file, "# API 지연 시간 (%s 기준, 백분위수 상대 오차 1/%d 이내)\n", time_str, SUB_BUCKETS);
+    metrics_print(file);
+
+    if (fclose(file) != 0) {
+        return FAILURE;
+    }
+    return SUCCESS;
+}
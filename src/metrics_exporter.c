@@ -0,0 +1,457 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#include <sqlite3.h>
+#include "../include/metrics_exporter.h"
+#include "../include/metrics.h"
+#include "../include/logger.h"
+
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <poll.h>
+    #include <unistd.h>
+    #include <sys/socket.h>
+    #include <sys/un.h>
+    #ifndef MSG_NOSIGNAL
+        #define MSG_NOSIGNAL 0   /* macOS는 연결 단위 SO_NOSIGPIPE로 대신함 */
+    #endif
+#endif
+
+// Prometheus 히스토그램 경계 (초)
+static const double latency_bounds[] = {
+    0.0001, 0.00025, 0.0005, 0.001, 0.0025, 0.005, 0.01, 0.025, 0.05, 0.1, 0.25, 0.5, 1, 2.5, 5, 10
+};
+#define LATENCY_BOUND_COUNT ((int)(sizeof(latency_bounds) / sizeof(latency_bounds[0])))
+
+// 늘어나는 출력 버퍼
+typedef struct {
+    char *data;
+    size_t length;
+    size_t capacity;
+    int failed;
+} TextBuffer;
+
+static void text_append(TextBuffer *buffer, const char *format, ...) {
+    if (buffer->failed) {
+        return;
+    }
+
+    while (1) {
+        size_t available = buffer->capacity - buffer->length;
+        va_list args;
+        va_start(args, format);
+        int written = vsnprintf(buffer->data + buffer->length, available, format, args);
+        va_end(args);
+
+        if (written < 0) {
+            buffer->failed = 1;
+            return;
+        }
+        if ((size_t)written < available) {
+            buffer->length += (size_t)written;
+            return;
+        }
+
+        size_t new_capacity = buffer->capacity * 2 + (size_t)written;
+        char *new_data = realloc(buffer->data, new_capacity);
+        if (!new_data) {
+            buffer->failed = 1;
+            return;
+        }
+        buffer->data = new_data;
+        buffer->capacity = new_capacity;
+    }
+}
+
+static void append_api_metrics(TextBuffer *buffer) {
+    MetricSummary summaries[METRIC_COUNT];
+    for (int id = 0; id < METRIC_COUNT; id++) {
+        metrics_get_summary((MetricId)id, &summaries[id]);
+    }
+
+    text_append(buffer, "# HELP library_api_calls_total 공개 API 호출 수 (결과별)\n");
+    text_append(buffer, "# TYPE library_api_calls_total counter\n");
+    for (int id = 0; id < METRIC_COUNT; id++) {
+        const MetricSummary *summary = &summaries[id];
+        if (summary->count == 0) {
+            continue;
+        }
+        text_append(buffer, "library_api_calls_total{api=\"%s\",outcome=\"success\"} %lld\n",
+                    summary->name, summary->count - summary->failures);
+        text_append(buffer, "library_api_calls_total{api=\"%s\",outcome=\"failure\"} %lld\n",
+                    summary->name, summary->failures);
+    }
+
+    long long bounds_ns[LATENCY_BOUND_COUNT];
+    long long counts[LATENCY_BOUND_COUNT];
+    for (int i = 0; i < LATENCY_BOUND_COUNT; i++) {
+        bounds_ns[i] = (long long)(latency_bounds[i] * 1e9 + 0.5);
+    }
+
+    text_append(buffer, "# HELP library_api_latency_seconds 공개 API 응답 시간\n");
+    text_append(buffer, "# TYPE library_api_latency_seconds histogram\n");
+    for (int id = 0; id < METRIC_COUNT; id++) {
+        const MetricSummary *summary = &summaries[id];
+        if (summary->count == 0 ||
+            metrics_get_cumulative_counts((MetricId)id, bounds_ns, LATENCY_BOUND_COUNT, counts) != SUCCESS) {
+            continue;
+        }
+
+        for (int i = 0; i < LATENCY_BOUND_COUNT; i++) {
+            text_append(buffer, "library_api_latency_seconds_bucket{api=\"%s\",le=\"%g\"} %lld\n",
+                        summary->name, latency_bounds[i], counts[i]);
+        }
+        text_append(buffer, "library_api_latency_seconds_bucket{api=\"%s\",le=\"+Inf\"} %lld\n",
+                    summary->name, summary->count);
+        text_append(buffer, "library_api_latency_seconds_sum{api=\"%s\"} %.9f\n",
+                    summary->name, summary->sum / 1e9);
+        text_append(buffer, "library_api_latency_seconds_count{api=\"%s\"} %lld\n",
+                    summary->name, summary->count);
+    }
+}
+
+static void append_gauge(TextBuffer *buffer, const char *name, const char *help, long long value) {
+    text_append(buffer, "# HELP %s %s\n# TYPE %s gauge\n%s %lld\n", name, help, name, name, value);
+}
+
+static void append_counter(TextBuffer *buffer, const char *name, const char *help, long long value) {
+    text_append(buffer, "# HELP %s %s\n# TYPE %s counter\n%s %lld\n", name, help, name, name, value);
+}
+
+static int query_count(sqlite3 *db, const char *sql, long long *value) {
+    sqlite3_stmt *stmt = NULL;
+    int result = FAILURE;
+
+    if (sqlite3_prepare_v2(db, sql, -1, &stmt, NULL) == SQLITE_OK && sqlite3_step(stmt) == SQLITE_ROW) {
+        *value = sqlite3_column_int64(stmt, 0);
+        result = SUCCESS;
+    }
+    sqlite3_finalize(stmt);
+    return result;
+}
+
+static long long file_size_or_zero(const char *path) {
+    struct stat info;
+    return stat(path, &info) == 0 ? (long long)info.st_size : 0;
+}
+
+static void append_database_metrics(TextBuffer *buffer, sqlite3 *db) {
+    int current = 0;
+    int highwater = 0;
+
+    // 연결별 캐시 사용량은 연결 뮤텍스 아래에서 읽으므로 다른 스레드에서 조회해도 안전
+    if (sqlite3_db_status(db, SQLITE_DBSTATUS_CACHE_USED, &current, &highwater, 0) == SQLITE_OK) {
+        append_gauge(buffer, "library_sqlite_page_cache_bytes", "SQLite 연결의 페이지 캐시 사용량", current);
+    }
+    if (sqlite3_db_status(db, SQLITE_DBSTATUS_SCHEMA_USED, &current, &highwater, 0) == SQLITE_OK) {
+        append_gauge(buffer, "library_sqlite_schema_bytes", "SQLite 스키마 캐시 사용량", current);
+    }
+    if (sqlite3_db_status(db, SQLITE_DBSTATUS_STMT_USED, &current, &highwater, 0) == SQLITE_OK) {
+        append_gauge(buffer, "library_sqlite_statement_bytes", "SQLite 준비된 문장 사용량", current);
+    }
+
+    const char *path = sqlite3_db_filename(db, "main");
+    if (!path || path[0] == '\0') {
+        return;   // 메모리 데이터베이스
+    }
+
+    char wal_path[MAX_PATH_LENGTH + 8];
+    snprintf(wal_path, sizeof(wal_path), "%s-wal", path);
+    append_gauge(buffer, "library_database_file_bytes", "데이터베이스 파일 크기", file_size_or_zero(path));
+    append_gauge(buffer, "library_database_wal_bytes", "WAL 파일 크기 (없으면 0)", file_size_or_zero(wal_path));
+
+    // 애플리케이션 연결의 트랜잭션/오류 상태에 섞이지 않도록 읽기 전용 연결을 따로 엶
+    sqlite3 *reader = NULL;
+    if (sqlite3_open_v2(path, &reader, SQLITE_OPEN_READONLY, NULL) != SQLITE_OK) {
+        sqlite3_close(reader);
+        return;
+    }
+    sqlite3_busy_timeout(reader, 1000);
+
+    long long value;
+    if (query_count(reader, "SELECT COUNT(*) FROM loans WHERE is_returned = 0;", &value) == SUCCESS) {
+        append_gauge(buffer, "library_open_loans", "반납되지 않은 대출 수", value);
+    }
+    if (query_count(reader, "SELECT COUNT(*) FROM loans WHERE is_returned = 0 AND due_date < datetime('now');",
+                    &value) == SUCCESS) {
+        append_gauge(buffer, "library_overdue_loans", "연체 중인 대출 수", value);
+    }
+    if (query_count(reader, "SELECT COUNT(*) FROM books;", &value) == SUCCESS) {
+        append_gauge(buffer, "library_books", "등록된 도서 수", value);
+    }
+    if (query_count(reader, "SELECT COUNT(*) FROM members WHERE is_active = 1;", &value) == SUCCESS) {
+        append_gauge(buffer, "library_active_members", "활성 회원 수", value);
+    }
+
+    sqlite3_close(reader);
+}
+
+int metrics_format_prometheus(sqlite3 *db, char **text, size_t *length) {
+    if (!text) {
+        return FAILURE;
+    }
+
+    TextBuffer buffer = { malloc(16384), 0, 16384, 0 };
+    if (!buffer.data) {
+        return FAILURE;
+    }
+    buffer.data[0] = '\0';
+
+    append_api_metrics(&buffer);
+
+    sqlite3_int64 current = 0;
+    sqlite3_int64 highwater = 0;
+    if (sqlite3_status64(SQLITE_STATUS_MEMORY_USED, &current, &highwater, 0) == SQLITE_OK) {
+        append_gauge(&buffer, "library_sqlite_memory_used_bytes", "SQLite 전체 메모리 사용량", current);
+        append_gauge(&buffer, "library_sqlite_memory_highwater_bytes", "SQLite 최대 메모리 사용량", highwater);
+    }
+
+    if (db) {
+        append_database_metrics(&buffer, db);
+    }
+
+    LoggerStats log_stats;
+    logger_get_stats(&log_stats);
+    append_counter(&buffer, "library_log_written_total", "기록된 로그 수", log_stats.written);
+    append_counter(&buffer, "library_log_dropped_total", "버퍼 부족으로 유실된 로그 수", log_stats.dropped);
+    append_counter(&buffer, "library_log_rotations_total", "로그 파일 교체 횟수", log_stats.rotations);
+
+    if (buffer.failed) {
+        free(buffer.data);
+        return FAILURE;
+    }
+
+    *text = buffer.data;
+    if (length) {
+        *length = buffer.length;
+    }
+    return SUCCESS;
+}
+
+int metrics_write_textfile(sqlite3 *db, const char *file_path) {
+    if (!file_path) {
+        return FAILURE;
+    }
+
+    char *text = NULL;
+    size_t length = 0;
+    if (metrics_format_prometheus(db, &text, &length) != SUCCESS) {
+        return FAILURE;
+    }
+
+    char tmp_path[MAX_PATH_LENGTH + 8];
+    snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", file_path);
+
+    FILE *file = fopen(tmp_path, "w");
+    if (!file) {
+        fprintf(stderr, "지표 파일을 열 수 없습니다: %s\n", tmp_path);
+        free(text);
+        return FAILURE;
+    }
+
+    int result = fwrite(text, 1, length, file) == length ? SUCCESS : FAILURE;
+    free(text);
+    if (fclose(file) != 0) {
+        result = FAILURE;
+    }
+
+#ifdef _WIN32
+    // Windows의 rename은 대상 파일이 있으면 실패함
+    remove(file_path);
+#endif
+    if (result != SUCCESS || rename(tmp_path, file_path) != 0) {
+        fprintf(stderr, "지표 파일 저장 실패: %s\n", file_path);
+        remove(tmp_path);
+        return FAILURE;
+    }
+
+    return SUCCESS;
+}
+
+// 내보내기 스레드 상태
+static pthread_t exporter_thread;
+static atomic_int exporter_running = 0;
+static atomic_int exporter_stop_requested = 0;
+static sqlite3 *exporter_db = NULL;
+static MetricsExporterConfig exporter_config;
+static int listen_fd = -1;
+
+#ifndef _WIN32
+static int open_listen_socket(const char *socket_path) {
+    struct sockaddr_un address;
+    if (strlen(socket_path) >= sizeof(address.sun_path)) {
+        fprintf(stderr, "소켓 경로가 너무 깁니다: %s\n", socket_path);
+        return -1;
+    }
+
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) {
+        return -1;
+    }
+
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    strcpy(address.sun_path, socket_path);
+
+    // 이전 실행이 남긴 소켓 파일
+    unlink(socket_path);
+    if (bind(fd, (struct sockaddr*)&address, sizeof(address)) != 0 || listen(fd, 8) != 0) {
+        fprintf(stderr, "지표 소켓을 열 수 없습니다: %s\n", socket_path);
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+// 연결 하나에 현재 지표를 보내고 닫음
+static void serve_connection(int fd) {
+#ifdef SO_NOSIGPIPE
+    int no_sigpipe = 1;
+    setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &no_sigpipe, sizeof(no_sigpipe));
+#endif
+    char request[1024];
+    ssize_t received = 0;
+    struct pollfd poll_fd = { fd, POLLIN, 0 };
+
+    // HTTP 클라이언트면 요청을 먼저 보내므로 잠시 기다려 봄
+    if (poll(&poll_fd, 1, METRICS_SOCKET_READ_TIMEOUT_MS) > 0) {
+        received = recv(fd, request, sizeof(request) - 1, 0);
+    }
+    int is_http = received >= 4 && strncmp(request, "GET ", 4) == 0;
+
+    char *text = NULL;
+    size_t length = 0;
+    if (metrics_format_prometheus(exporter_db, &text, &length) == SUCCESS) {
+        if (is_http) {
+            char header[256];
+            int header_length = snprintf(header, sizeof(header),
+                "HTTP/1.0 200 OK\r\nContent-Type: text/plain; version=0.0.4; charset=utf-8\r\n"
+                "Content-Length: %zu\r\nConnection: close\r\n\r\n", length);
+            send(fd, header, (size_t)header_length, MSG_NOSIGNAL);
+        }
+
+        size_t sent = 0;
+        while (sent < length) {
+            ssize_t written = send(fd, text + sent, length - sent, MSG_NOSIGNAL);
+            if (written <= 0) {
+                break;
+            }
+            sent += (size_t)written;
+        }
+        free(text);
+    }
+
+    close(fd);
+}
+#endif
+
+static void *exporter_main(void *arg) {
+    (void)arg;
+    long long interval_ms = (long long)exporter_config.interval_seconds * 1000;
+    long long until_next_write = 0;
+
+    while (!atomic_load(&exporter_stop_requested)) {
+        if (until_next_write <= 0) {
+            if (exporter_config.textfile_path[0] != '\0') {
+                metrics_write_textfile(exporter_db, exporter_config.textfile_path);
+            }
+            until_next_write = interval_ms;
+        }
+
+        // 종료 요청에 빨리 반응하도록 짧게 나누어 기다림
+        int wait_ms = until_next_write < METRICS_EXPORTER_POLL_MS ? (int)until_next_write : METRICS_EXPORTER_POLL_MS;
+#ifdef _WIN32
+        Sleep((DWORD)wait_ms);
+#else
+        if (listen_fd >= 0) {
+            struct pollfd poll_fd = { listen_fd, POLLIN, 0 };
+            if (poll(&poll_fd, 1, wait_ms) > 0) {
+                int client = accept(listen_fd, NULL, NULL);
+                if (client >= 0) {
+                    serve_connection(client);
+                }
+                continue;   // 연결 처리에 걸린 시간은 따로 재지 않음
+            }
+        } else {
+            poll(NULL, 0, wait_ms);
+        }
+#endif
+        until_next_write -= wait_ms;
+    }
+
+    return NULL;
+}
+
+int metrics_exporter_start(sqlite3 *db, const MetricsExporterConfig *config) {
+    if (!config) {
+        return FAILURE;
+    }
+
+    metrics_exporter_stop();
+
+    exporter_db = db;
+    exporter_config = *config;
+    if (exporter_config.interval_seconds <= 0) {
+        exporter_config.interval_seconds = METRICS_EXPORT_INTERVAL_SECONDS;
+    }
+
+    if (exporter_config.textfile_path[0] == '\0' && exporter_config.socket_path[0] == '\0') {
+        return SUCCESS;   // 내보낼 곳이 없음
+    }
+
+#ifdef _WIN32
+    if (exporter_config.socket_path[0] != '\0') {
+        fprintf(stderr, "Windows에서는 지표 소켓을 지원하지 않습니다.\n");
+        exporter_config.socket_path[0] = '\0';
+    }
+#else
+    if (exporter_config.socket_path[0] != '\0') {
+        listen_fd = open_listen_socket(exporter_config.socket_path);
+        if (listen_fd < 0) {
+            return FAILURE;
+        }
+    }
+#endif
+
+    atomic_store(&exporter_stop_requested, 0);
+    if (pthread_create(&exporter_thread, NULL, exporter_main, NULL) != 0) {
+        fprintf(stderr, "지표 내보내기 스레드 생성 실패\n");
+#ifndef _WIN32
+        if (listen_fd >= 0) {
+            close(listen_fd);
+            unlink(exporter_config.socket_path);
+            listen_fd = -1;
+        }
+#endif
+        return FAILURE;
+    }
+
+    atomic_store(&exporter_running, 1);
+    return SUCCESS;
+}
+
+void metrics_exporter_stop(void) {
+    if (!atomic_exchange(&exporter_running, 0)) {
+        return;
+    }
+
+    atomic_store(&exporter_stop_requested, 1);
+    pthread_join(exporter_thread, NULL);
+
+#ifndef _WIN32
+    if (listen_fd >= 0) {
+        close(listen_fd);
+        unlink(exporter_config.socket_path);
+        listen_fd = -1;
+    }
+#endif
+
+    if (exporter_config.textfile_path[0] != '\0') {
+        metrics_write_textfile(exporter_db, exporter_config.textfile_path);
+    }
+}
@@ -0,0 +1,319 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <time.h>
+#include <pthread.h>
+#include "../include/query_profiler.h"
+#include "../include/utils.h"
+
+#define OTHER_SLOT QUERY_PROFILER_MAX_STATEMENTS
+#define RUNNING_CAPACITY 16
+
+// 정규화한 SQL별 통계 (마지막 칸은 자리가 모자랄 때 쓰는 "(기타)")
+static QueryProfileEntry profile_entries[QUERY_PROFILER_MAX_STATEMENTS + 1];
+static pthread_mutex_t profiler_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static int profiler_enabled = FALSE;
+static long long slow_threshold_ns = QUERY_PROFILER_SLOW_THRESHOLD_MS * 1000000LL;
+static FILE *slow_log_file = NULL;
+
+// 실행 중인 문장의 시작 시각 (SQLite의 PROFILE 시간은 플랫폼에 따라 ms 단위라 직접 잼)
+typedef struct {
+    sqlite3_stmt *stmt;
+    long long start_ns;
+} RunningStatement;
+
+static _Thread_local RunningStatement running[RUNNING_CAPACITY];
+static _Thread_local int running_count = 0;
+
+int query_profiler_configure(int enabled, long long slow_threshold_ms, const char *slow_log_path) {
+    pthread_mutex_lock(&profiler_mutex);
+
+    profiler_enabled = enabled ? TRUE : FALSE;
+    slow_threshold_ns = slow_threshold_ms < 0 ? -1 : slow_threshold_ms * 1000000LL;
+
+    if (slow_log_file) {
+        fclose(slow_log_file);
+        slow_log_file = NULL;
+    }
+
+    int result = SUCCESS;
+    if (enabled && slow_log_path && slow_log_path[0] != '\0') {
+        slow_log_file = fopen(slow_log_path, "a");
+        if (!slow_log_file) {
+            fprintf(stderr, "느린 쿼리 로그 파일을 열 수 없습니다: %s\n", slow_log_path);
+            result = FAILURE;
+        }
+    }
+
+    pthread_mutex_unlock(&profiler_mutex);
+    return result;
+}
+
+int query_profiler_is_enabled(void) {
+    pthread_mutex_lock(&profiler_mutex);
+    int enabled = profiler_enabled;
+    pthread_mutex_unlock(&profiler_mutex);
+    return enabled;
+}
+
+void query_profiler_normalize(const char *sql, char *normalized, size_t normalized_size) {
+    if (!normalized || normalized_size == 0) {
+        return;
+    }
+
+    size_t length = 0;
+    int pending_space = FALSE;
+    const char *p = sql ? sql : "";
+
+    while (*p && length + 1 < normalized_size) {
+        unsigned char c = (unsigned char)*p;
+
+        if (isspace(c)) {
+            pending_space = length > 0;
+            p++;
+            continue;
+        }
+        if (pending_space) {
+            normalized[length++] = ' ';
+            pending_space = FALSE;
+            if (length + 1 >= normalized_size) {
+                break;
+            }
+        }
+
+        int previous_is_word = length > 0 &&
+            (isalnum((unsigned char)normalized[length - 1]) || normalized[length - 1] == '_');
+
+        if (c == '\'') {
+            // 문자열 리터럴 ('' 는 따옴표 문자)
+            p++;
+            while (*p) {
+                if (*p == '\'' && p[1] == '\'') {
+                    p += 2;
+                } else if (*p == '\'') {
+                    p++;
+                    break;
+                } else {
+                    p++;
+                }
+            }
+            normalized[length++] = '?';
+        } else if (isdigit(c) && !previous_is_word) {
+            // 숫자 리터럴 (식별자 안의 숫자는 그대로 둠)
+            while (isalnum((unsigned char)*p) || *p == '.') {
+                p++;
+            }
+            normalized[length++] = '?';
+        } else {
+            normalized[length++] = (char)c;
+            p++;
+        }
+    }
+
+    // 끝의 세미콜론과 공백은 통계를 나누지 않도록 제거
+    while (length > 0 && (normalized[length - 1] == ';' || normalized[length - 1] == ' ')) {
+        length--;
+    }
+    normalized[length] = '\0';
+}
+
+static unsigned int hash_sql(const char *sql) {
+    unsigned int hash = 2166136261u;
+    for (; *sql; sql++) {
+        hash = (hash ^ (unsigned char)*sql) * 16777619u;
+    }
+    return hash;
+}
+
+// 정규화한 SQL의 칸을 찾거나 새로 만듦 (profiler_mutex를 잡은 상태에서 호출)
+static QueryProfileEntry *find_entry(const char *sql) {
+    unsigned int start = hash_sql(sql) % QUERY_PROFILER_MAX_STATEMENTS;
+
+    for (unsigned int i = 0; i < QUERY_PROFILER_MAX_STATEMENTS; i++) {
+        QueryProfileEntry *entry = &profile_entries[(start + i) % QUERY_PROFILER_MAX_STATEMENTS];
+        if (entry->sql[0] == '\0') {
+            safe_string_copy(entry->sql, sql, sizeof(entry->sql));
+            return entry;
+        }
+        if (strcmp(entry->sql, sql) == 0) {
+            return entry;
+        }
+    }
+
+    QueryProfileEntry *other = &profile_entries[OTHER_SLOT];
+    if (other->sql[0] == '\0') {
+        safe_string_copy(other->sql, "(기타)", sizeof(other->sql));
+    }
+    return other;
+}
+
+static void write_slow_query(sqlite3_stmt *stmt, long long elapsed_ns, int fullscan, int sorts, int autoindex) {
+    char *expanded = sqlite3_expanded_sql(stmt);
+    const char *sql = expanded ? expanded : sqlite3_sql(stmt);
+
+    if (slow_log_file) {
+        char time_str[32];
+        time_t now = time(NULL);
+        struct tm tm_info;
+#ifdef _WIN32
+        localtime_s(&tm_info, &now);
+#else
+        localtime_r(&now, &tm_info);
+#endif
+        strftime(time_str, sizeof(time_str), "%Y-%m-%d %H:%M:%S", &tm_info);
+        fprintf(slow_log_file, "[%s] %.3fms fullscan=%d sort=%d autoindex=%d | %s\n",
+                time_str, elapsed_ns / 1e6, fullscan, sorts, autoindex, sql ? sql : "");
+        fflush(slow_log_file);
+    } else {
+        log_message(LOG_WARNING, "느린 쿼리 %.3fms (fullscan=%d sort=%d autoindex=%d): %s",
+                    elapsed_ns / 1e6, fullscan, sorts, autoindex, sql ? sql : "");
+    }
+
+    sqlite3_free(expanded);
+}
+
+static void record_statement(sqlite3_stmt *stmt, long long elapsed_ns) {
+    // 재사용되는 문장도 실행마다 따로 세도록 읽으면서 0으로 되돌림
+    int fullscan = sqlite3_stmt_status(stmt, SQLITE_STMTSTATUS_FULLSCAN_STEP, 1);
+    int sorts = sqlite3_stmt_status(stmt, SQLITE_STMTSTATUS_SORT, 1);
+    int autoindex = sqlite3_stmt_status(stmt, SQLITE_STMTSTATUS_AUTOINDEX, 1);
+    int vm_steps = sqlite3_stmt_status(stmt, SQLITE_STMTSTATUS_VM_STEP, 1);
+
+    char normalized[QUERY_PROFILER_SQL_LENGTH];
+    query_profiler_normalize(sqlite3_sql(stmt), normalized, sizeof(normalized));
+
+    pthread_mutex_lock(&profiler_mutex);
+
+    QueryProfileEntry *entry = find_entry(normalized);
+    entry->count++;
+    entry->total_time += elapsed_ns;
+    if (elapsed_ns > entry->max_time) {
+        entry->max_time = elapsed_ns;
+    }
+    entry->fullscan_steps += fullscan;
+    entry->sorts += sorts;
+    entry->autoindex_rows += autoindex;
+    entry->vm_steps += vm_steps;
+
+    if (slow_threshold_ns >= 0 && elapsed_ns >= slow_threshold_ns) {
+        entry->slow_count++;
+        write_slow_query(stmt, elapsed_ns, fullscan, sorts, autoindex);
+    }
+
+    pthread_mutex_unlock(&profiler_mutex);
+}
+
+static int profiler_trace_callback(unsigned int type, void *context, void *p, void *x) {
+    (void)context;
+    sqlite3_stmt *stmt = (sqlite3_stmt*)p;
+
+    if (type == SQLITE_TRACE_STMT) {
+        // 트리거 실행 시에도 같은 문장으로 호출되므로 처음 시작한 시각만 남김
+        for (int i = 0; i < running_count; i++) {
+            if (running[i].stmt == stmt) {
+                return 0;
+            }
+        }
+        if (running_count < RUNNING_CAPACITY) {
+            running[running_count].stmt = stmt;
+            running[running_count].start_ns = timer_now_nanoseconds();
+            running_count++;
+        }
+    } else if (type == SQLITE_TRACE_PROFILE) {
+        long long elapsed_ns = *(sqlite3_int64*)x;
+        for (int i = 0; i < running_count; i++) {
+            if (running[i].stmt == stmt) {
+                elapsed_ns = timer_now_nanoseconds() - running[i].start_ns;
+                running[i] = running[--running_count];
+                break;
+            }
+        }
+        record_statement(stmt, elapsed_ns);
+    }
+
+    return 0;
+}
+
+int query_profiler_attach(sqlite3 *db) {
+    if (!db) {
+        return FAILURE;
+    }
+
+    if (sqlite3_trace_v2(db, SQLITE_TRACE_STMT | SQLITE_TRACE_PROFILE, profiler_trace_callback, NULL) != SQLITE_OK) {
+        fprintf(stderr, "SQL 프로파일러 등록 실패: %s\n", sqlite3_errmsg(db));
+        return FAILURE;
+    }
+    return SUCCESS;
+}
+
+static int compare_total_time(const void *a, const void *b) {
+    const QueryProfileEntry *left = (const QueryProfileEntry*)a;
+    const QueryProfileEntry *right = (const QueryProfileEntry*)b;
+
+    if (left->total_time != right->total_time) {
+        return left->total_time < right->total_time ? 1 : -1;
+    }
+    return strcmp(left->sql, right->sql);
+}
+
+int query_profiler_get_top(QueryProfileEntry *entries, int max_entries) {
+    if (!entries || max_entries <= 0) {
+        return 0;
+    }
+
+    QueryProfileEntry *all = malloc(sizeof(profile_entries));
+    if (!all) {
+        return 0;
+    }
+
+    int count = 0;
+    pthread_mutex_lock(&profiler_mutex);
+    for (int i = 0; i <= OTHER_SLOT; i++) {
+        if (profile_entries[i].count > 0) {
+            all[count++] = profile_entries[i];
+        }
+    }
+    pthread_mutex_unlock(&profiler_mutex);
+
+    qsort(all, (size_t)count, sizeof(QueryProfileEntry), compare_total_time);
+    if (count > max_entries) {
+        count = max_entries;
+    }
+    memcpy(entries, all, sizeof(QueryProfileEntry) * (size_t)count);
+
+    free(all);
+    return count;
+}
+
+int query_profiler_report(FILE *output, int top_n) {
+    if (!output || top_n <= 0) {
+        return 0;
+    }
+
+    QueryProfileEntry *entries = malloc(sizeof(QueryProfileEntry) * (size_t)top_n);
+    if (!entries) {
+        return 0;
+    }
+
+    int count = query_profiler_get_top(entries, top_n);
+    for (int i = 0; i < count; i++) {
+        const QueryProfileEntry *entry = &entries[i];
+        fprintf(output, "%2d. 총 %.3fms / %lld회 (평균 %.3fms, 최대 %.3fms, 느림 %lld회)\n",
+                i + 1, entry->total_time / 1e6, entry->count,
+                entry->total_time / 1e6 / (double)entry->count, entry->max_time / 1e6, entry->slow_count);
+        fprintf(output, "    전체 스캔 %lld행, 정렬 %lld회, 자동 인덱스 %lld행, VM 단계 %lld\n",
+                entry->fullscan_steps, entry->sorts, entry->autoindex_rows, entry->vm_steps);
+        fprintf(output, "    %.160s\n", entry->sql);
+    }
+
+    free(entries);
+    return count;
+}
+
+void query_profiler_reset(void) {
+    pthread_mutex_lock(&profiler_mutex);
+    memset(profile_entries, 0, sizeof(profile_entries));
+    pthread_mutex_unlock(&profiler_mutex);
+}
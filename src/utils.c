@@ -4,9 +4,12 @@
 #include <time.h>
 #include <ctype.h>
 #include <stdarg.h>
+#include <errno.h>
 #include <math.h>
 #include "../include/utils.h"
 #include "../include/constants.h"
+#include "../include/logger.h"
+#include "../include/file_copy.h"
 
 #ifdef _WIN32
     #include <direct.h>
@@ -18,7 +21,6 @@
 #endif
 
 // 전역 변수들
-static FILE *log_file = NULL;
 static SystemConfig current_config;
 
 // 문자열 유틸리티 함수들
@@ -185,6 +187,23 @@ int is_past_date(time_t date) {
     return date < time(NULL);
 }
 
+void time_to_sql_string(time_t time_val, char *buffer, size_t buffer_size) {
+    if (!buffer || buffer_size == 0) return;
+    
+    // SQLite의 CURRENT_TIMESTAMP와 같은 UTC 'YYYY-MM-DD HH:MM:SS' 형식
+    struct tm tm_info;
+#ifdef _WIN32
+    if (gmtime_s(&tm_info, &time_val) != 0) {
+#else
+    if (!gmtime_r(&time_val, &tm_info)) {
+#endif
+        buffer[0] = '\0';
+        return;
+    }
+    
+    strftime(buffer, buffer_size, "%Y-%m-%d %H:%M:%S", &tm_info);
+}
+
 // 메모리 관리 유틸리티 함수들
 void* safe_malloc(size_t size) {
     if (size == 0) return NULL;
@@ -259,28 +278,16 @@ int create_directory_if_not_exists(const char *dir_path) {
 int backup_file(const char *source_path, const char *backup_path) {
     if (!source_path || !backup_path) return FAILURE;
     
-    FILE *source = fopen(source_path, "rb");
-    if (!source) return FAILURE;
-    
-    FILE *backup = fopen(backup_path, "wb");
-    if (!backup) {
-        fclose(source);
+    // reflink나 커널 안 복사를 쓸 수 있으면 쓰고, 안 되면 큰 버퍼로 복사
+    FileCopyStats stats;
+    if (file_copy(source_path, backup_path, FILE_COPY_AUTO, &stats) != SUCCESS) {
         return FAILURE;
     }
     
-    char buffer[4096];
-    size_t bytes;
-    
-    while ((bytes = fread(buffer, 1, sizeof(buffer), source)) > 0) {
-        if (fwrite(buffer, 1, bytes, backup) != bytes) {
-            fclose(source);
-            fclose(backup);
-            return FAILURE;
-        }
-    }
-    
-    fclose(source);
-    fclose(backup);
+    double mb = stats.bytes / (1024.0 * 1024.0);
+    log_message(LOG_INFO, "파일 복사 완료: %s -> %s (%.1f MB, %.2f초, %.1f MB/s, %s)", source_path, backup_path,
+                mb, stats.elapsed_seconds, stats.elapsed_seconds > 0 ? mb / stats.elapsed_seconds : 0.0,
+                file_copy_method_name(stats.method));
     return SUCCESS;
 }
 
@@ -524,58 +531,26 @@ int compare_strings_secure(const char *str1, const char *str2) {
     return result == 0;
 }
 
-// 로깅 유틸리티 함수들
+// 로깅 유틸리티 함수들 (실제 기록은 logger.c의 비동기 로거가 담당)
 int init_logging(const char *log_file_path) {
-    if (log_file) {
-        fclose(log_file);
-        log_file = NULL;
-    }
-    
-    if (log_file_path) {
-        log_file = fopen(log_file_path, "a");
-        if (!log_file) {
-            fprintf(stderr, "로그 파일을 열 수 없습니다: %s\n", log_file_path);
-            return FAILURE;
-        }
-    }
-    
-    return SUCCESS;
+    return logger_start(log_file_path);
 }
 
 void log_message(LogLevel level, const char *format, ...) {
     if (!format) return;
     
-    FILE *output = log_file ? log_file : stdout;
-    
-    time_t now = time(NULL);
-    char time_str[64];
-    time_to_string(now, time_str, sizeof(time_str), "%Y-%m-%d %H:%M:%S");
-    
-    const char *level_str;
-    switch (level) {
-        case LOG_DEBUG:   level_str = "DEBUG"; break;
-        case LOG_INFO:    level_str = "INFO"; break;
-        case LOG_WARNING: level_str = "WARNING"; break;
-        case LOG_ERROR:   level_str = "ERROR"; break;
-        default:          level_str = "UNKNOWN"; break;
-    }
-    
-    fprintf(output, "[%s] %s: ", time_str, level_str);
-    
     va_list args;
     va_start(args, format);
-    vfprintf(output, format, args);
+    logger_write(level, format, args);
     va_end(args);
-    
-    fprintf(output, "\n");
-    fflush(output);
+}
+
+void set_log_level(LogLevel level) {
+    logger_set_level(level);
 }
 
 void close_logging(void) {
-    if (log_file) {
-        fclose(log_file);
-        log_file = NULL;
-    }
+    logger_stop();
 }
 
 // 설정 관리 유틸리티 함수들
@@ -618,6 +593,26 @@ int load_config(const char *config_file, SystemConfig *config) {
             config->auto_backup_enabled = (strcmp(value, "true") == 0) ? TRUE : FALSE;
         } else if (strcmp(key, "log_level") == 0) {
             parse_integer(value, &config->log_level);
+        } else if (strcmp(key, "log_max_size_kb") == 0) {
+            parse_integer(value, &config->log_max_size_kb);
+        } else if (strcmp(key, "log_rotate_daily") == 0) {
+            config->log_rotate_daily = (strcmp(value, "true") == 0) ? TRUE : FALSE;
+        } else if (strcmp(key, "log_retention_count") == 0) {
+            parse_integer(value, &config->log_retention_count);
+        } else if (strcmp(key, "metrics_textfile_path") == 0) {
+            safe_string_copy(config->metrics_textfile_path, value, sizeof(config->metrics_textfile_path));
+        } else if (strcmp(key, "metrics_socket_path") == 0) {
+            safe_string_copy(config->metrics_socket_path, value, sizeof(config->metrics_socket_path));
+        } else if (strcmp(key, "metrics_interval_seconds") == 0) {
+            parse_integer(value, &config->metrics_interval_seconds);
+        } else if (strcmp(key, "sql_profile_enabled") == 0) {
+            config->sql_profile_enabled = (strcmp(value, "true") == 0) ? TRUE : FALSE;
+        } else if (strcmp(key, "slow_query_threshold_ms") == 0) {
+            parse_integer(value, &config->slow_query_threshold_ms);
+        } else if (strcmp(key, "slow_query_log_path") == 0) {
+            safe_string_copy(config->slow_query_log_path, value, sizeof(config->slow_query_log_path));
+        } else if (strcmp(key, "workload_trace_path") == 0) {
+            safe_string_copy(config->workload_trace_path, value, sizeof(config->workload_trace_path));
         }
     }
     
@@ -639,6 +634,16 @@ int save_config(const char *config_file, const SystemConfig *config) {
     fprintf(file, "max_renewal_count=%d\n", config->max_renewal_count);
     fprintf(file, "auto_backup_enabled=%s\n", config->auto_backup_enabled ? "true" : "false");
     fprintf(file, "log_level=%d\n", config->log_level);
+    fprintf(file, "log_max_size_kb=%d\n", config->log_max_size_kb);
+    fprintf(file, "log_rotate_daily=%s\n", config->log_rotate_daily ? "true" : "false");
+    fprintf(file, "log_retention_count=%d\n", config->log_retention_count);
+    fprintf(file, "metrics_textfile_path=%s\n", config->metrics_textfile_path);
+    fprintf(file, "metrics_socket_path=%s\n", config->metrics_socket_path);
+    fprintf(file, "metrics_interval_seconds=%d\n", config->metrics_interval_seconds);
+    fprintf(file, "sql_profile_enabled=%s\n", config->sql_profile_enabled ? "true" : "false");
+    fprintf(file, "slow_query_threshold_ms=%d\n", config->slow_query_threshold_ms);
+    fprintf(file, "slow_query_log_path=%s\n", config->slow_query_log_path);
+    fprintf(file, "workload_trace_path=%s\n", config->workload_trace_path);
     
     fclose(file);
     return SUCCESS;
@@ -654,20 +659,52 @@ void init_default_config(SystemConfig *config) {
     config->max_renewal_count = MAX_RENEWAL_COUNT;
     config->auto_backup_enabled = TRUE;
     config->log_level = LOG_INFO;
+    config->log_max_size_kb = LOGGER_DEFAULT_MAX_BYTES / 1024;
+    config->log_rotate_daily = TRUE;
+    config->log_retention_count = LOGGER_DEFAULT_MAX_ARCHIVES;
+    config->metrics_textfile_path[0] = '\0';
+    config->metrics_socket_path[0] = '\0';
+    config->metrics_interval_seconds = METRICS_EXPORT_INTERVAL_SECONDS;
+    config->sql_profile_enabled = FALSE;
+    config->slow_query_threshold_ms = QUERY_PROFILER_SLOW_THRESHOLD_MS;
+    safe_string_copy(config->slow_query_log_path, "slow_query.log", sizeof(config->slow_query_log_path));
+    config->workload_trace_path[0] = '\0';
 }
 
 // 성능 측정 유틸리티 함수들
+long long timer_now_nanoseconds(void) {
+#ifdef _WIN32
+    static LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+    
+    if (frequency.QuadPart == 0) {
+        QueryPerformanceFrequency(&frequency);
+    }
+    QueryPerformanceCounter(&counter);
+    
+    // 곱셈 넘침을 피하려고 초와 나머지를 나누어 계산
+    long long seconds = counter.QuadPart / frequency.QuadPart;
+    long long remainder = counter.QuadPart % frequency.QuadPart;
+    return seconds * 1000000000LL + remainder * 1000000000LL / frequency.QuadPart;
+#else
+    struct timespec now;
+    
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (long long)now.tv_sec * 1000000000LL + now.tv_nsec;
+#endif
+}
+
 void timer_start(Timer *timer) {
     if (!timer) return;
     
-    timer->start_time = clock();
+    timer->start_time = timer_now_nanoseconds();
 }
 
 void timer_stop(Timer *timer) {
     if (!timer) return;
     
-    timer->end_time = clock();
-    timer->elapsed_time = ((double)(timer->end_time - timer->start_time)) / CLOCKS_PER_SEC;
+    timer->end_time = timer_now_nanoseconds();
+    timer->elapsed_time = (double)(timer->end_time - timer->start_time) / 1e9;
 }
 
 double timer_get_elapsed_seconds(const Timer *timer) {
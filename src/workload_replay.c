@@ -0,0 +1,462 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../include/workload_replay.h"
+#include "../include/workload_trace.h"
+#include "../include/book.h"
+#include "../include/member.h"
+#include "../include/loan.h"
+#include "../include/calendar.h"
+#include "../include/utils.h"
+
+#define POPULAR_BOOKS_MAX 1000
+
+// API 하나의 지연 시간 표본
+typedef struct {
+    long long *values;
+    size_t count;
+    size_t capacity;
+    long long failures;
+} LatencySamples;
+
+static int add_sample(LatencySamples *samples, long long value, int status) {
+    if (samples->count == samples->capacity) {
+        size_t capacity = samples->capacity ? samples->capacity * 2 : 64;
+        long long *values = realloc(samples->values, capacity * sizeof(long long));
+        if (!values) {
+            return FAILURE;
+        }
+        samples->values = values;
+        samples->capacity = capacity;
+    }
+    samples->values[samples->count++] = value;
+    if (status == FAILURE) {
+        samples->failures++;
+    }
+    return SUCCESS;
+}
+
+static int compare_long_long(const void *a, const void *b) {
+    long long left = *(const long long*)a;
+    long long right = *(const long long*)b;
+    return (left > right) - (left < right);
+}
+
+// 정렬한 표본에서 q 백분위수 (nearest-rank)
+static long long sample_percentile(const LatencySamples *samples, double q) {
+    size_t rank = (size_t)(q * (double)samples->count + 0.999999);
+    if (rank == 0) {
+        rank = 1;
+    }
+    return samples->values[(rank > samples->count ? samples->count : rank) - 1];
+}
+
+static void summarize_samples(LatencySamples *samples, MetricId api, MetricSummary *summary) {
+    memset(summary, 0, sizeof(MetricSummary));
+    summary->name = metrics_name(api);
+    if (samples->count == 0) {
+        return;
+    }
+
+    qsort(samples->values, samples->count, sizeof(long long), compare_long_long);
+    for (size_t i = 0; i < samples->count; i++) {
+        summary->sum += samples->values[i];
+    }
+    summary->count = (long long)samples->count;
+    summary->failures = samples->failures;
+    summary->mean = summary->sum / summary->count;
+    summary->p50 = sample_percentile(samples, 0.50);
+    summary->p95 = sample_percentile(samples, 0.95);
+    summary->p99 = sample_percentile(samples, 0.99);
+    summary->max = samples->values[samples->count - 1];
+}
+
+static int arg_int(const TraceRecord *record, int index) {
+    return index < record->arg_count ? (int)record->args[index].integer : 0;
+}
+
+static const char *arg_string(const TraceRecord *record, int index) {
+    return index < record->arg_count ? record->args[index].string : NULL;
+}
+
+// 기록된 필드로 도서 구조체를 만듦 (필드가 없으면 NULL 인자였던 호출)
+static const Book *book_from_args(const TraceRecord *record, Book *book) {
+    if (record->arg_count < 9) {
+        return NULL;
+    }
+    init_book(book);
+    book->id = arg_int(record, 0);
+    safe_string_copy(book->title, arg_string(record, 1) ? arg_string(record, 1) : "", sizeof(book->title));
+    safe_string_copy(book->author, arg_string(record, 2) ? arg_string(record, 2) : "", sizeof(book->author));
+    safe_string_copy(book->isbn, arg_string(record, 3) ? arg_string(record, 3) : "", sizeof(book->isbn));
+    safe_string_copy(book->publisher, arg_string(record, 4) ? arg_string(record, 4) : "", sizeof(book->publisher));
+    book->publication_year = arg_int(record, 5);
+    book->total_copies = arg_int(record, 6);
+    book->available_copies = arg_int(record, 7);
+    safe_string_copy(book->category, arg_string(record, 8) ? arg_string(record, 8) : "", sizeof(book->category));
+    return book;
+}
+
+static const Member *member_from_args(const TraceRecord *record, Member *member) {
+    if (record->arg_count < 7) {
+        return NULL;
+    }
+    init_member(member);
+    member->id = arg_int(record, 0);
+    safe_string_copy(member->name, arg_string(record, 1) ? arg_string(record, 1) : "", sizeof(member->name));
+    safe_string_copy(member->email, arg_string(record, 2) ? arg_string(record, 2) : "", sizeof(member->email));
+    safe_string_copy(member->phone, arg_string(record, 3) ? arg_string(record, 3) : "", sizeof(member->phone));
+    safe_string_copy(member->address, arg_string(record, 4) ? arg_string(record, 4) : "", sizeof(member->address));
+    member->registration_date = (time_t)record->args[5].integer;
+    member->is_active = arg_int(record, 6);
+    return member;
+}
+
+static int replay_book_search(sqlite3 *db, const TraceRecord *record) {
+    BookSearchResult result;
+    if (init_book_search_result(&result) != SUCCESS) {
+        return FAILURE;
+    }
+
+    int status = FAILURE;
+    switch (record->api) {
+        case METRIC_SEARCH_BOOKS_BY_TITLE:
+            status = search_books_by_title(db, arg_string(record, 0), &result);
+            break;
+        case METRIC_SEARCH_BOOKS_BY_AUTHOR:
+            status = search_books_by_author(db, arg_string(record, 0), &result);
+            break;
+        case METRIC_SEARCH_BOOKS_BY_CATEGORY:
+            status = search_books_by_category(db, arg_string(record, 0), &result);
+            break;
+        case METRIC_LIST_ALL_BOOKS:
+            status = list_all_books(db, &result, arg_int(record, 0), arg_int(record, 1));
+            break;
+        case METRIC_LIST_AVAILABLE_BOOKS:
+            status = list_available_books(db, &result);
+            break;
+        case METRIC_GET_POPULAR_BOOKS:
+            status = get_popular_books(db, &result, arg_int(record, 0));
+            break;
+        default:
+            break;
+    }
+
+    free_book_search_result(&result);
+    return status;
+}
+
+static int replay_member_search(sqlite3 *db, const TraceRecord *record) {
+    MemberSearchResult result;
+    if (init_member_search_result(&result) != SUCCESS) {
+        return FAILURE;
+    }
+
+    int status = FAILURE;
+    switch (record->api) {
+        case METRIC_SEARCH_MEMBERS_BY_NAME:
+            status = search_members_by_name(db, arg_string(record, 0), &result);
+            break;
+        case METRIC_SEARCH_MEMBERS_BY_PHONE:
+            status = search_members_by_phone(db, arg_string(record, 0), &result);
+            break;
+        case METRIC_LIST_ALL_MEMBERS:
+            status = list_all_members(db, &result, arg_int(record, 0), arg_int(record, 1));
+            break;
+        case METRIC_LIST_ACTIVE_MEMBERS:
+            status = list_active_members(db, &result);
+            break;
+        default:
+            break;
+    }
+
+    free_member_search_result(&result);
+    return status;
+}
+
+static int replay_loan_search(sqlite3 *db, const TraceRecord *record) {
+    LoanSearchResult result;
+    if (init_loan_search_result(&result) != SUCCESS) {
+        return FAILURE;
+    }
+
+    int status = FAILURE;
+    switch (record->api) {
+        case METRIC_GET_MEMBER_LOAN_HISTORY:
+            status = get_member_loan_history(db, arg_int(record, 0), &result, arg_int(record, 1));
+            break;
+        case METRIC_GET_MEMBER_CURRENT_LOANS:
+            status = get_member_current_loans(db, arg_int(record, 0), &result);
+            break;
+        case METRIC_GET_BOOK_LOAN_HISTORY:
+            status = get_book_loan_history(db, arg_int(record, 0), &result, arg_int(record, 1));
+            break;
+        case METRIC_GET_OVERDUE_LOANS:
+            status = get_overdue_loans(db, &result);
+            break;
+        case METRIC_GET_LOANS_DUE_ON_DATE:
+            status = get_loans_due_on_date(db, record->arg_count > 0 ? (time_t)record->args[0].integer : 0, &result);
+            break;
+        case METRIC_GET_CURRENT_LOANS:
+            status = get_current_loans(db, &result);
+            break;
+        default:
+            break;
+    }
+
+    free_loan_search_result(&result);
+    return status;
+}
+
+static int replay_shift_due_dates(sqlite3 *db, const TraceRecord *record) {
+    if (record->arg_count < 2) {
+        return shift_due_dates(db, NULL, NULL);
+    }
+
+    // 달력은 기록에 없으므로 main과 같이 구간 시작 연도부터 다시 적재
+    DateRange range = { (time_t)record->args[0].integer, (time_t)record->args[1].integer };
+    ClosureCalendar calendar;
+    struct tm start_tm;
+#ifdef _WIN32
+    localtime_s(&start_tm, &range.start);
+#else
+    localtime_r(&range.start, &start_tm);
+#endif
+    if (calendar_load(db, start_tm.tm_year + 1900, CALENDAR_MAX_YEARS, &calendar) != SUCCESS) {
+        return FAILURE;
+    }
+    return shift_due_dates(db, &range, &calendar);
+}
+
+// 기록 하나를 해당 API로 실행하고 반환값을 돌려줌
+static int replay_record(sqlite3 *db, const TraceRecord *record) {
+    Book book;
+    Member member;
+    Loan loan;
+    int counts[4];
+
+    switch (record->api) {
+        case METRIC_ADD_BOOK:
+            return add_book(db, book_from_args(record, &book));
+        case METRIC_UPDATE_BOOK:
+            return update_book(db, book_from_args(record, &book));
+        case METRIC_GET_BOOK_BY_ID:
+            return get_book_by_id(db, arg_int(record, 0), &book);
+        case METRIC_GET_BOOK_BY_ISBN:
+            return get_book_by_isbn(db, arg_string(record, 0), &book);
+        case METRIC_DELETE_BOOK:
+            return delete_book(db, arg_int(record, 0));
+        case METRIC_SEARCH_BOOKS_BY_TITLE:
+        case METRIC_SEARCH_BOOKS_BY_AUTHOR:
+        case METRIC_SEARCH_BOOKS_BY_CATEGORY:
+        case METRIC_LIST_ALL_BOOKS:
+        case METRIC_LIST_AVAILABLE_BOOKS:
+        case METRIC_GET_POPULAR_BOOKS:
+            return replay_book_search(db, record);
+
+        case METRIC_ADD_MEMBER:
+            return add_member(db, member_from_args(record, &member));
+        case METRIC_UPDATE_MEMBER:
+            return update_member(db, member_from_args(record, &member));
+        case METRIC_GET_MEMBER_BY_ID:
+            return get_member_by_id(db, arg_int(record, 0), &member);
+        case METRIC_GET_MEMBER_BY_EMAIL:
+            return get_member_by_email(db, arg_string(record, 0), &member);
+        case METRIC_DELETE_MEMBER:
+            return delete_member(db, arg_int(record, 0));
+        case METRIC_DEACTIVATE_MEMBER:
+            return deactivate_member(db, arg_int(record, 0));
+        case METRIC_ACTIVATE_MEMBER:
+            return activate_member(db, arg_int(record, 0));
+        case METRIC_SEARCH_MEMBERS_BY_NAME:
+        case METRIC_SEARCH_MEMBERS_BY_PHONE:
+        case METRIC_LIST_ALL_MEMBERS:
+        case METRIC_LIST_ACTIVE_MEMBERS:
+            return replay_member_search(db, record);
+        case METRIC_GET_MEMBER_LOAN_STATS:
+            return get_member_loan_stats(db, arg_int(record, 0), &counts[0], &counts[1], &counts[2]);
+        case METRIC_CHECK_MEMBER_LOAN_ELIGIBILITY:
+            return check_member_loan_eligibility(db, arg_int(record, 0));
+        case METRIC_BACKFILL_MEMBER_PHONE_DIGITS:
+            return backfill_member_phone_digits(db);
+
+        case METRIC_LOAN_BOOK:
+            return loan_book(db, arg_int(record, 0), arg_int(record, 1), arg_int(record, 2));
+        case METRIC_LOAN_BOOK_IDEMPOTENT:
+            return loan_book_idempotent(db, arg_string(record, 0), arg_int(record, 1),
+                                        arg_int(record, 2), arg_int(record, 3));
+        case METRIC_RETURN_BOOK:
+            return return_book(db, arg_int(record, 0));
+        case METRIC_RETURN_BOOK_IDEMPOTENT:
+            return return_book_idempotent(db, arg_string(record, 0), arg_int(record, 1));
+        case METRIC_RETURN_BOOK_BY_IDS:
+            return return_book_by_ids(db, arg_int(record, 0), arg_int(record, 1));
+        case METRIC_RETURN_BOOK_BY_IDS_IDEMPOTENT:
+            return return_book_by_ids_idempotent(db, arg_string(record, 0), arg_int(record, 1), arg_int(record, 2));
+        case METRIC_EXTEND_LOAN:
+            return extend_loan(db, arg_int(record, 0), arg_int(record, 1));
+        case METRIC_EXTEND_LOAN_IDEMPOTENT:
+            return extend_loan_idempotent(db, arg_string(record, 0), arg_int(record, 1), arg_int(record, 2));
+        case METRIC_PURGE_EXPIRED_LOAN_REQUESTS:
+            return purge_expired_loan_requests(db);
+        case METRIC_SHIFT_DUE_DATES:
+            return replay_shift_due_dates(db, record);
+        case METRIC_GET_LOAN_BY_ID:
+            return get_loan_by_id(db, arg_int(record, 0), &loan);
+        case METRIC_GET_MEMBER_LOAN_HISTORY:
+        case METRIC_GET_MEMBER_CURRENT_LOANS:
+        case METRIC_GET_BOOK_LOAN_HISTORY:
+        case METRIC_GET_OVERDUE_LOANS:
+        case METRIC_GET_LOANS_DUE_ON_DATE:
+        case METRIC_GET_CURRENT_LOANS:
+            return replay_loan_search(db, record);
+        case METRIC_GET_LOAN_STATISTICS:
+            return get_loan_statistics(db, &counts[0], &counts[1], &counts[2], &counts[3]);
+        case METRIC_GET_POPULAR_BOOKS_BY_LOANS: {
+            int max_books = arg_int(record, 0);
+            if (max_books > POPULAR_BOOKS_MAX) {
+                max_books = POPULAR_BOOKS_MAX;
+            }
+            int book_ids[POPULAR_BOOKS_MAX];
+            int loan_counts[POPULAR_BOOKS_MAX];
+            return get_popular_books_by_loans(db, book_ids, loan_counts, max_books);
+        }
+        case METRIC_CHECK_LOAN_AVAILABILITY:
+            return check_loan_availability(db, arg_int(record, 0), arg_int(record, 1));
+        case METRIC_CHECK_DUPLICATE_LOAN:
+            return check_duplicate_loan(db, arg_int(record, 0), arg_int(record, 1));
+        default:
+            return FAILURE;
+    }
+}
+
+// 기록된 간격을 지키도록 목표 시각까지 기다림
+static void wait_until(long long target_ns) {
+    long long remaining = target_ns - timer_now_nanoseconds();
+    while (remaining > 1000000LL) {
+        sqlite3_sleep((int)(remaining / 1000000LL));
+        remaining = target_ns - timer_now_nanoseconds();
+    }
+}
+
+int workload_replay(sqlite3 *db, const char *trace_path, WorkloadReplayMode mode, double speed,
+                    WorkloadReplayReport *report) {
+    if (!db || !trace_path || !report) {
+        fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
+        return FAILURE;
+    }
+
+    TraceReader reader;
+    if (workload_trace_open(&reader, trace_path) != SUCCESS) {
+        return FAILURE;
+    }
+
+    TraceRecord *record = malloc(sizeof(TraceRecord));
+    LatencySamples *captured = calloc(METRIC_COUNT, sizeof(LatencySamples));
+    LatencySamples *replayed = calloc(METRIC_COUNT, sizeof(LatencySamples));
+    if (!record || !captured || !replayed) {
+        fprintf(stderr, "메모리 할당 실패\n");
+        free(record);
+        free(captured);
+        free(replayed);
+        workload_trace_close(&reader);
+        return FAILURE;
+    }
+
+    memset(report, 0, sizeof(WorkloadReplayReport));
+    if (speed <= 0) {
+        speed = 1.0;
+    }
+
+    int status = SUCCESS;
+    int has_first = FALSE;
+    long long first_start_ns = 0;
+    long long earliest_start_ns = 0;
+    long long last_end_ns = 0;
+    long long replay_start_ns = timer_now_nanoseconds();
+    int read_status;
+
+    while ((read_status = workload_trace_next(&reader, record)) == TRUE) {
+        // 기록은 호출이 끝난 순서이므로 가장 이른 시작 시각은 따로 추적
+        if (!has_first) {
+            first_start_ns = record->start_offset_ns;
+            earliest_start_ns = record->start_offset_ns;
+            has_first = TRUE;
+        } else if (record->start_offset_ns < earliest_start_ns) {
+            earliest_start_ns = record->start_offset_ns;
+        }
+        if (record->start_offset_ns + record->latency_ns > last_end_ns) {
+            last_end_ns = record->start_offset_ns + record->latency_ns;
+        }
+
+        if (mode == WORKLOAD_REPLAY_ORIGINAL) {
+            wait_until(replay_start_ns + (long long)((record->start_offset_ns - first_start_ns) / speed));
+        }
+
+        long long start = timer_now_nanoseconds();
+        int result = replay_record(db, record);
+        long long elapsed = timer_now_nanoseconds() - start;
+
+        if (add_sample(&captured[record->api], record->latency_ns, record->result) != SUCCESS ||
+            add_sample(&replayed[record->api], elapsed, result) != SUCCESS) {
+            fprintf(stderr, "메모리 할당 실패\n");
+            status = FAILURE;
+            break;
+        }
+        if (result != record->result) {
+            report->apis[record->api].result_mismatches++;
+            report->result_mismatches++;
+        }
+        report->replayed++;
+    }
+
+    if (read_status == FAILURE) {
+        status = FAILURE;
+    }
+    report->replay_seconds = (timer_now_nanoseconds() - replay_start_ns) / 1e9;
+    report->captured_seconds = has_first ? (last_end_ns - earliest_start_ns) / 1e9 : 0.0;
+
+    for (int api = 0; api < METRIC_COUNT; api++) {
+        summarize_samples(&captured[api], (MetricId)api, &report->apis[api].captured);
+        summarize_samples(&replayed[api], (MetricId)api, &report->apis[api].replayed);
+        free(captured[api].values);
+        free(replayed[api].values);
+    }
+
+    free(record);
+    free(captured);
+    free(replayed);
+    workload_trace_close(&reader);
+    return status;
+}
+
+int workload_replay_print_report(FILE *output, const WorkloadReplayReport *report) {
+    if (!output || !report) {
+        return 0;
+    }
+
+    fprintf(output, "%-32s %10s %12s %12s %12s %12s %10s %10s\n",
+            "API", "호출 수", "기록 p50(ms)", "재실행 p50", "기록 p99(ms)", "재실행 p99", "p99 배율", "결과 차이");
+
+    int printed = 0;
+    for (int api = 0; api < METRIC_COUNT; api++) {
+        const WorkloadReplayComparison *comparison = &report->apis[api];
+        if (comparison->captured.count == 0) {
+            continue;
+        }
+
+        double ratio = comparison->captured.p99 > 0
+            ? (double)comparison->replayed.p99 / (double)comparison->captured.p99 : 0.0;
+        fprintf(output, "%-32s %10lld %12.3f %12.3f %12.3f %12.3f %9.2fx %10lld\n",
+                comparison->captured.name, comparison->captured.count,
+                comparison->captured.p50 / 1e6, comparison->replayed.p50 / 1e6,
+                comparison->captured.p99 / 1e6, comparison->replayed.p99 / 1e6,
+                ratio, comparison->result_mismatches);
+        printed++;
+    }
+
+    fprintf(output, "호출 %lld건: 기록 %.3f초, 재실행 %.3f초, 반환값이 다른 호출 %lld건\n",
+            report->replayed, report->captured_seconds, report->replay_seconds, report->result_mismatches);
+    return printed;
+}
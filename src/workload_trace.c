@@ -0,0 +1,454 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <time.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include "../include/workload_trace.h"
+#include "../include/database.h"
+#include "../include/types.h"
+#include "../include/utils.h"
+
+#define TRACE_MAGIC "LMSTRACE"
+#define TRACE_MAGIC_LENGTH 8
+
+// API별 인자 형식: i=int, t=time_t, s=문자열, B=const Book*, M=const Member*, R=const DateRange*
+static const char *trace_formats[METRIC_COUNT] = {
+    [METRIC_ADD_BOOK] = "B",
+    [METRIC_GET_BOOK_BY_ID] = "i",
+    [METRIC_GET_BOOK_BY_ISBN] = "s",
+    [METRIC_SEARCH_BOOKS_BY_TITLE] = "s",
+    [METRIC_SEARCH_BOOKS_BY_AUTHOR] = "s",
+    [METRIC_SEARCH_BOOKS_BY_CATEGORY] = "s",
+    [METRIC_UPDATE_BOOK] = "B",
+    [METRIC_DELETE_BOOK] = "i",
+    [METRIC_LIST_ALL_BOOKS] = "ii",
+    [METRIC_LIST_AVAILABLE_BOOKS] = "",
+    [METRIC_GET_POPULAR_BOOKS] = "i",
+
+    [METRIC_ADD_MEMBER] = "M",
+    [METRIC_GET_MEMBER_BY_ID] = "i",
+    [METRIC_GET_MEMBER_BY_EMAIL] = "s",
+    [METRIC_SEARCH_MEMBERS_BY_NAME] = "s",
+    [METRIC_SEARCH_MEMBERS_BY_PHONE] = "s",
+    [METRIC_UPDATE_MEMBER] = "M",
+    [METRIC_DELETE_MEMBER] = "i",
+    [METRIC_DEACTIVATE_MEMBER] = "i",
+    [METRIC_ACTIVATE_MEMBER] = "i",
+    [METRIC_LIST_ALL_MEMBERS] = "ii",
+    [METRIC_LIST_ACTIVE_MEMBERS] = "",
+    [METRIC_GET_MEMBER_LOAN_STATS] = "i",
+    [METRIC_CHECK_MEMBER_LOAN_ELIGIBILITY] = "i",
+    [METRIC_BACKFILL_MEMBER_PHONE_DIGITS] = "",
+
+    [METRIC_LOAN_BOOK] = "iii",
+    [METRIC_LOAN_BOOK_IDEMPOTENT] = "siii",
+    [METRIC_RETURN_BOOK] = "i",
+    [METRIC_RETURN_BOOK_IDEMPOTENT] = "si",
+    [METRIC_RETURN_BOOK_BY_IDS] = "ii",
+    [METRIC_RETURN_BOOK_BY_IDS_IDEMPOTENT] = "sii",
+    [METRIC_EXTEND_LOAN] = "ii",
+    [METRIC_EXTEND_LOAN_IDEMPOTENT] = "sii",
+    [METRIC_PURGE_EXPIRED_LOAN_REQUESTS] = "",
+    [METRIC_SHIFT_DUE_DATES] = "R",
+    [METRIC_GET_LOAN_BY_ID] = "i",
+    [METRIC_GET_MEMBER_LOAN_HISTORY] = "ii",
+    [METRIC_GET_MEMBER_CURRENT_LOANS] = "i",
+    [METRIC_GET_BOOK_LOAN_HISTORY] = "ii",
+    [METRIC_GET_OVERDUE_LOANS] = "",
+    [METRIC_GET_LOANS_DUE_ON_DATE] = "t",
+    [METRIC_GET_CURRENT_LOANS] = "",
+    [METRIC_GET_LOAN_STATISTICS] = "",
+    [METRIC_GET_POPULAR_BOOKS_BY_LOANS] = "i",
+    [METRIC_CHECK_LOAN_AVAILABILITY] = "ii",
+    [METRIC_CHECK_DUPLICATE_LOAN] = "ii",
+};
+
+// 기록 상태 (trace_file과 last_start_offset_ns는 trace_mutex를 잡고 사용)
+static atomic_int trace_active = 0;
+static pthread_mutex_t trace_mutex = PTHREAD_MUTEX_INITIALIZER;
+static FILE *trace_file = NULL;
+static char *trace_buffer = NULL;
+static long long trace_start_ns = 0;
+static long long last_start_offset_ns = 0;
+static atomic_llong recorded_count = 0;
+static atomic_llong dropped_count = 0;
+
+static atomic_int next_thread_number = 0;
+static _Thread_local int thread_number = 0;
+
+// 가변 길이 정수로 인코딩하는 버퍼 (넘치면 overflow만 표시)
+typedef struct {
+    unsigned char data[WORKLOAD_TRACE_RECORD_SIZE];
+    size_t length;
+    int overflow;
+} EncodeBuffer;
+
+static void put_bytes(EncodeBuffer *buffer, const void *bytes, size_t length) {
+    if (buffer->overflow || length > sizeof(buffer->data) - buffer->length) {
+        buffer->overflow = TRUE;
+        return;
+    }
+    memcpy(buffer->data + buffer->length, bytes, length);
+    buffer->length += length;
+}
+
+static void put_varint(EncodeBuffer *buffer, unsigned long long value) {
+    unsigned char bytes[10];
+    size_t length = 0;
+
+    while (value >= 0x80) {
+        bytes[length++] = (unsigned char)(value | 0x80);
+        value >>= 7;
+    }
+    bytes[length++] = (unsigned char)value;
+    put_bytes(buffer, bytes, length);
+}
+
+// 음수도 짧게 들어가도록 지그재그 인코딩
+static void put_signed(EncodeBuffer *buffer, long long value) {
+    put_varint(buffer, ((unsigned long long)value << 1) ^ (unsigned long long)(value >> 63));
+}
+
+static void put_int_arg(EncodeBuffer *buffer, long long value) {
+    unsigned char tag = TRACE_ARG_INT;
+    put_bytes(buffer, &tag, 1);
+    put_signed(buffer, value);
+}
+
+// 문자열 길이는 +1 해서 기록 (0은 NULL)
+static void put_string_arg(EncodeBuffer *buffer, const char *value) {
+    unsigned char tag = TRACE_ARG_STRING;
+    put_bytes(buffer, &tag, 1);
+    if (!value) {
+        put_varint(buffer, 0);
+        return;
+    }
+    size_t length = strlen(value);
+    put_varint(buffer, (unsigned long long)length + 1);
+    put_bytes(buffer, value, length);
+}
+
+// 형식에 따라 가변 인자를 인코딩하고 기록한 인자 수를 반환
+static int encode_args(EncodeBuffer *buffer, const char *format, va_list args) {
+    int count = 0;
+
+    for (const char *f = format; *f; f++) {
+        if (*f == 'i') {
+            put_int_arg(buffer, va_arg(args, int));
+            count++;
+        } else if (*f == 't') {
+            put_int_arg(buffer, (long long)va_arg(args, time_t));
+            count++;
+        } else if (*f == 's') {
+            put_string_arg(buffer, va_arg(args, const char*));
+            count++;
+        } else if (*f == 'B') {
+            const Book *book = va_arg(args, const Book*);
+            if (book) {
+                put_int_arg(buffer, book->id);
+                put_string_arg(buffer, book->title);
+                put_string_arg(buffer, book->author);
+                put_string_arg(buffer, book->isbn);
+                put_string_arg(buffer, book->publisher);
+                put_int_arg(buffer, book->publication_year);
+                put_int_arg(buffer, book->total_copies);
+                put_int_arg(buffer, book->available_copies);
+                put_string_arg(buffer, book->category);
+                count += 9;
+            }
+        } else if (*f == 'M') {
+            const Member *member = va_arg(args, const Member*);
+            if (member) {
+                put_int_arg(buffer, member->id);
+                put_string_arg(buffer, member->name);
+                put_string_arg(buffer, member->email);
+                put_string_arg(buffer, member->phone);
+                put_string_arg(buffer, member->address);
+                put_int_arg(buffer, (long long)member->registration_date);
+                put_int_arg(buffer, member->is_active);
+                count += 7;
+            }
+        } else if (*f == 'R') {
+            const DateRange *range = va_arg(args, const DateRange*);
+            if (range) {
+                put_int_arg(buffer, (long long)range->start);
+                put_int_arg(buffer, (long long)range->end);
+                count += 2;
+            }
+        }
+    }
+    return count;
+}
+
+int workload_trace_start(const char *trace_path, sqlite3 *snapshot_db) {
+    if (!trace_path || trace_path[0] == '\0') {
+        fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
+        return FAILURE;
+    }
+
+    pthread_mutex_lock(&trace_mutex);
+
+    if (trace_file) {
+        pthread_mutex_unlock(&trace_mutex);
+        fprintf(stderr, "이미 호출을 기록하는 중입니다.\n");
+        return FAILURE;
+    }
+
+    // 기록 시작 시점의 데이터베이스 사본 (재실행의 시작 상태)
+    if (snapshot_db) {
+        char snapshot_path[MAX_PATH_LENGTH];
+        snprintf(snapshot_path, sizeof(snapshot_path), "%s%s", trace_path, WORKLOAD_TRACE_SNAPSHOT_SUFFIX);
+        remove(snapshot_path);
+        if (database_backup(snapshot_db, snapshot_path) != SUCCESS) {
+            pthread_mutex_unlock(&trace_mutex);
+            fprintf(stderr, "트레이스 시작 시점 데이터베이스 사본 생성 실패: %s\n", snapshot_path);
+            return FAILURE;
+        }
+    }
+
+    trace_file = fopen(trace_path, "wb");
+    if (!trace_file) {
+        pthread_mutex_unlock(&trace_mutex);
+        fprintf(stderr, "트레이스 파일을 열 수 없습니다: %s\n", trace_path);
+        return FAILURE;
+    }
+    trace_buffer = malloc(WORKLOAD_TRACE_BUFFER_SIZE);
+    if (trace_buffer) {
+        setvbuf(trace_file, trace_buffer, _IOFBF, WORKLOAD_TRACE_BUFFER_SIZE);
+    }
+
+    EncodeBuffer header = { .length = 0, .overflow = FALSE };
+    put_bytes(&header, TRACE_MAGIC, TRACE_MAGIC_LENGTH);
+    put_varint(&header, WORKLOAD_TRACE_VERSION);
+    put_varint(&header, (unsigned long long)time(NULL) * 1000000000ULL);
+    fwrite(header.data, 1, header.length, trace_file);
+
+    trace_start_ns = timer_now_nanoseconds();
+    last_start_offset_ns = 0;
+    atomic_store(&recorded_count, 0);
+    atomic_store(&dropped_count, 0);
+    atomic_store(&trace_active, TRUE);
+
+    pthread_mutex_unlock(&trace_mutex);
+    return SUCCESS;
+}
+
+int workload_trace_stop(void) {
+    pthread_mutex_lock(&trace_mutex);
+
+    atomic_store(&trace_active, FALSE);
+    if (!trace_file) {
+        pthread_mutex_unlock(&trace_mutex);
+        return FAILURE;
+    }
+
+    int result = ferror(trace_file) ? FAILURE : SUCCESS;
+    if (fclose(trace_file) != 0) {
+        result = FAILURE;
+    }
+    trace_file = NULL;
+    free(trace_buffer);
+    trace_buffer = NULL;
+
+    pthread_mutex_unlock(&trace_mutex);
+
+    if (result != SUCCESS) {
+        fprintf(stderr, "트레이스 파일 쓰기 실패\n");
+    }
+    return result;
+}
+
+int workload_trace_is_active(void) {
+    return atomic_load_explicit(&trace_active, memory_order_relaxed) ? TRUE : FALSE;
+}
+
+void workload_trace_record(MetricId api, long long start_ns, int result, ...) {
+    // 기록 중이 아니면 가능한 한 빨리 돌아감
+    if (!atomic_load_explicit(&trace_active, memory_order_relaxed) ||
+        metrics_call_depth() > 0 || api < 0 || api >= METRIC_COUNT) {
+        return;
+    }
+
+    long long latency_ns = timer_now_nanoseconds() - start_ns;
+    if (thread_number == 0) {
+        thread_number = atomic_fetch_add(&next_thread_number, 1) + 1;
+    }
+
+    EncodeBuffer args_buffer;
+    args_buffer.length = 0;
+    args_buffer.overflow = FALSE;
+
+    va_list args;
+    va_start(args, result);
+    int arg_count = encode_args(&args_buffer, trace_formats[api] ? trace_formats[api] : "", args);
+    va_end(args);
+
+    if (args_buffer.overflow) {
+        atomic_fetch_add_explicit(&dropped_count, 1, memory_order_relaxed);
+        return;
+    }
+
+    pthread_mutex_lock(&trace_mutex);
+
+    if (trace_file) {
+        // 시작 시각은 직전 레코드와의 차이로 기록 (레코드는 호출이 끝난 순서로 쓰이므로 음수일 수 있음)
+        long long start_offset_ns = start_ns - trace_start_ns;
+        EncodeBuffer header;
+        header.length = 0;
+        header.overflow = FALSE;
+        put_varint(&header, (unsigned long long)api);
+        put_varint(&header, (unsigned long long)thread_number);
+        put_signed(&header, start_offset_ns - last_start_offset_ns);
+        put_varint(&header, (unsigned long long)(latency_ns > 0 ? latency_ns : 0));
+        put_signed(&header, result);
+        put_varint(&header, (unsigned long long)arg_count);
+
+        fwrite(header.data, 1, header.length, trace_file);
+        fwrite(args_buffer.data, 1, args_buffer.length, trace_file);
+        last_start_offset_ns = start_offset_ns;
+        atomic_fetch_add_explicit(&recorded_count, 1, memory_order_relaxed);
+    }
+
+    pthread_mutex_unlock(&trace_mutex);
+}
+
+long long workload_trace_get_count(long long *dropped) {
+    if (dropped) {
+        *dropped = atomic_load(&dropped_count);
+    }
+    return atomic_load(&recorded_count);
+}
+
+// 가변 길이 정수 읽기 (파일 끝이면 FALSE, 손상되었으면 FAILURE)
+static int read_varint(FILE *file, unsigned long long *value) {
+    *value = 0;
+
+    for (int shift = 0; shift < 64; shift += 7) {
+        int c = fgetc(file);
+        if (c == EOF) {
+            return shift == 0 ? FALSE : FAILURE;
+        }
+        *value |= (unsigned long long)(c & 0x7F) << shift;
+        if (!(c & 0x80)) {
+            return TRUE;
+        }
+    }
+    return FAILURE;
+}
+
+static int read_signed(FILE *file, long long *value) {
+    unsigned long long raw;
+    int status = read_varint(file, &raw);
+    *value = (long long)(raw >> 1) ^ -(long long)(raw & 1);
+    return status;
+}
+
+int workload_trace_open(TraceReader *reader, const char *trace_path) {
+    if (!reader || !trace_path) {
+        fprintf(stderr, "유효하지 않은 매개변수입니다.\n");
+        return FAILURE;
+    }
+
+    memset(reader, 0, sizeof(TraceReader));
+    reader->file = fopen(trace_path, "rb");
+    if (!reader->file) {
+        fprintf(stderr, "트레이스 파일을 열 수 없습니다: %s\n", trace_path);
+        return FAILURE;
+    }
+
+    char magic[TRACE_MAGIC_LENGTH];
+    unsigned long long version = 0;
+    unsigned long long start_time = 0;
+    if (fread(magic, 1, sizeof(magic), reader->file) != sizeof(magic) ||
+        memcmp(magic, TRACE_MAGIC, TRACE_MAGIC_LENGTH) != 0 ||
+        read_varint(reader->file, &version) != TRUE || version != WORKLOAD_TRACE_VERSION ||
+        read_varint(reader->file, &start_time) != TRUE) {
+        fprintf(stderr, "트레이스 파일 형식이 올바르지 않습니다: %s\n", trace_path);
+        workload_trace_close(reader);
+        return FAILURE;
+    }
+
+    reader->version = (int)version;
+    reader->start_time_ns = (long long)start_time;
+    return SUCCESS;
+}
+
+int workload_trace_next(TraceReader *reader, TraceRecord *record) {
+    if (!reader || !reader->file || !record) {
+        return FAILURE;
+    }
+
+    unsigned long long api, thread, latency, arg_count;
+    long long start_delta, result;
+
+    int status = read_varint(reader->file, &api);
+    if (status != TRUE) {
+        return status;
+    }
+    if (read_varint(reader->file, &thread) != TRUE ||
+        read_signed(reader->file, &start_delta) != TRUE ||
+        read_varint(reader->file, &latency) != TRUE ||
+        read_signed(reader->file, &result) != TRUE ||
+        read_varint(reader->file, &arg_count) != TRUE ||
+        api >= METRIC_COUNT || arg_count > WORKLOAD_TRACE_MAX_ARGS) {
+        fprintf(stderr, "트레이스 레코드가 손상되었습니다.\n");
+        return FAILURE;
+    }
+
+    record->api = (MetricId)api;
+    record->thread = (int)thread;
+    reader->last_start_offset_ns += start_delta;
+    record->start_offset_ns = reader->last_start_offset_ns;
+    record->latency_ns = (long long)latency;
+    record->result = (int)result;
+    record->arg_count = (int)arg_count;
+
+    size_t pool_used = 0;
+    for (int i = 0; i < record->arg_count; i++) {
+        TraceArg *arg = &record->args[i];
+        int tag = fgetc(reader->file);
+
+        arg->integer = 0;
+        arg->string = NULL;
+
+        if (tag == TRACE_ARG_INT) {
+            arg->type = TRACE_ARG_INT;
+            if (read_signed(reader->file, &arg->integer) != TRUE) {
+                fprintf(stderr, "트레이스 레코드가 손상되었습니다.\n");
+                return FAILURE;
+            }
+        } else if (tag == TRACE_ARG_STRING) {
+            unsigned long long length;
+            arg->type = TRACE_ARG_STRING;
+            if (read_varint(reader->file, &length) != TRUE ||
+                length > sizeof(record->string_pool) - pool_used) {
+                fprintf(stderr, "트레이스 레코드가 손상되었습니다.\n");
+                return FAILURE;
+            }
+            if (length > 0) {
+                char *string = record->string_pool + pool_used;
+                if (fread(string, 1, (size_t)length - 1, reader->file) != (size_t)length - 1) {
+                    fprintf(stderr, "트레이스 레코드가 손상되었습니다.\n");
+                    return FAILURE;
+                }
+                string[length - 1] = '\0';
+                arg->string = string;
+                pool_used += (size_t)length;
+            }
+        } else {
+            fprintf(stderr, "트레이스 레코드가 손상되었습니다.\n");
+            return FAILURE;
+        }
+    }
+
+    return TRUE;
+}
+
+void workload_trace_close(TraceReader *reader) {
+    if (reader && reader->file) {
+        fclose(reader->file);
+        reader->file = NULL;
+    }
+}
@@ -0,0 +1,726 @@
+/**
+ * @file library_bench.cpp
+ * @brief 공개 API 성능 측정 (Google Benchmark)
+ *
+ * 도서 1만/10만/100만 권(대출 기록은 도서 수의 10배, 최대 1000만 건) 규모의 데이터로
+ * 도서 등록/조회/검색, 깊은 오프셋 목록 조회, 대출/반납/연장, 통계, 백업/복원을 측정합니다.
+ *
+ * 기본으로는 10만 권까지만 측정하며, LIBRARY_BENCH_MAX_BOOKS 환경 변수로 최대 규모를 바꿉니다.
+ * 만든 데이터베이스는 library_bench_<도서 수>.db로 남겨 다음 실행에 재사용합니다.
+ *
+ * 빌드 간 비교용 결과는 JSON으로 저장합니다:
+ *   ./library_bench --benchmark_out=bench.json --benchmark_out_format=json
+ */
+
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <cstdlib>
+#include <cstring>
+#include <cstdio>
+#include <map>
+#include <random>
+#include <string>
+
+extern "C" {
+    #include "database.h"
+    #include "book.h"
+    #include "member.h"
+    #include "loan.h"
+    #include "utils.h"
+    #include "constants.h"
+}
+
+namespace {
+
+// 데이터 생성 방식이 바뀌면 올려서 이전에 만든 데이터베이스를 다시 만들게 함
+constexpr int BENCH_SEED_VERSION = 2;
+
+// 도서 한 권당 대출 기록 수
+constexpr int LOANS_PER_BOOK = 10;
+
+// 대출 기록이 없는 회원 수 (대출/반납/연장 측정용)
+constexpr int FREE_MEMBER_COUNT = 64;
+
+constexpr int LIST_PAGE_SIZE = 20;
+constexpr int DEFAULT_MAX_BOOKS = 100000;
+
+struct Dataset {
+    sqlite3 *db = nullptr;
+    int books = 0;
+    int members = 0;
+    long long loans = 0;
+    std::string path;
+    std::string backup_path;
+};
+
+std::map<int, Dataset> datasets;
+
+int max_books() {
+    const char *value = std::getenv("LIBRARY_BENCH_MAX_BOOKS");
+    int books = value ? std::atoi(value) : DEFAULT_MAX_BOOKS;
+    return books > 0 ? books : DEFAULT_MAX_BOOKS;
+}
+
+int member_count_for(int books) {
+    int members = books / 10;
+    return members < FREE_MEMBER_COUNT * 2 ? FREE_MEMBER_COUNT * 2 : members;
+}
+
+// 검색 API는 MAX_SEARCH_RESULTS건까지만 돌려주므로, 측정에 쓰는 검색어가 100만 권에서도
+// 그 이하로 맞도록 이름/제목 조각의 조합 수를 정함
+#define NAME_PARTS_CTE \
+    "surnames(k, w) AS (VALUES (0,'김'),(1,'이'),(2,'박'),(3,'최'),(4,'정'),(5,'강'),(6,'조'),(7,'윤')," \
+    "(8,'장'),(9,'임')), " \
+    "first_syllables(k, w) AS (VALUES (0,'민'),(1,'서'),(2,'도'),(3,'하'),(4,'시'),(5,'지'),(6,'주'),(7,'예')," \
+    "(8,'건'),(9,'수'),(10,'현'),(11,'유'),(12,'채'),(13,'정'),(14,'승'),(15,'다'),(16,'윤'),(17,'태')," \
+    "(18,'우'),(19,'은')), " \
+    "second_syllables(k, w) AS (VALUES (0,'준'),(1,'연'),(2,'윤'),(3,'은'),(4,'우'),(5,'아'),(6,'원'),(7,'서')," \
+    "(8,'민'),(9,'호'),(10,'린'),(11,'율'),(12,'빈'),(13,'진'),(14,'희'),(15,'현'),(16,'영'),(17,'수')," \
+    "(18,'훈'),(19,'경')), "
+
+// 이름은 성 10 x 이름 첫 글자 20 x 둘째 글자 20 = 4000가지
+#define NAME_EXPRESSION \
+    "(SELECT w FROM surnames WHERE k = i % 10) || (SELECT w FROM first_syllables WHERE k = (i / 10) % 20) " \
+    "|| (SELECT w FROM second_syllables WHERE k = (i / 200) % 20)"
+
+// 제목은 수식어 12 x 주제 16 x 형식 10 + 번호, 분류는 대분류 10 x 세부 200
+const char *SEED_BOOKS_SQL =
+    "INSERT INTO books (title, author, isbn, publisher, publication_year, total_copies, "
+    "available_copies, category, title_norm, title_chosung, author_norm, author_chosung) "
+    "WITH RECURSIVE seq(i) AS (SELECT 1 UNION ALL SELECT i + 1 FROM seq WHERE i < ?1), "
+    "adjectives(k, w) AS (VALUES (0,'새로운'),(1,'쉽게 배우는'),(2,'실전'),(3,'처음 만나는'),"
+    "(4,'한국의'),(5,'세계의'),(6,'작은'),(7,'위대한'),(8,'숨겨진'),(9,'오래된'),(10,'모두의'),(11,'즐거운')), "
+    "subjects(k, w) AS (VALUES (0,'자료구조'),(1,'알고리즘'),(2,'데이터베이스'),(3,'역사'),(4,'경제학'),"
+    "(5,'철학'),(6,'심리학'),(7,'요리'),(8,'여행'),(9,'소설'),(10,'시집'),(11,'과학'),(12,'음악'),"
+    "(13,'미술'),(14,'건축'),(15,'수학')), "
+    "forms(k, w) AS (VALUES (0,'입문'),(1,'완성'),(2,'노트'),(3,'이야기'),(4,'사전'),(5,'강의'),(6,'연습'),"
+    "(7,'핸드북'),(8,'에세이'),(9,'도감')), "
+    "categories(k, w) AS (VALUES (0,'소설'),(1,'과학'),(2,'역사'),(3,'컴퓨터'),(4,'경제'),(5,'예술'),"
+    "(6,'철학'),(7,'여행'),(8,'요리'),(9,'아동')), "
+    NAME_PARTS_CTE
+    "generated AS (SELECT i, "
+    "(SELECT w FROM adjectives WHERE k = i % 12) || ' ' || (SELECT w FROM subjects WHERE k = (i / 12) % 16) "
+    "|| ' ' || (SELECT w FROM forms WHERE k = (i / 192) % 10) || ' ' || i AS title, "
+    NAME_EXPRESSION " AS author, "
+    "(SELECT w FROM categories WHERE k = (i / 7) % 10) || '-' || ((i / 70) % 200) AS category FROM seq) "
+    "SELECT title, author, printf('979%010d', i), '벤치출판', 1950 + i % 75, 3, 3, category, "
+    "hangul_normalize(title), hangul_chosung(title), hangul_normalize(author), hangul_chosung(author) "
+    "FROM generated;";
+
+const char *SEED_MEMBERS_SQL =
+    "INSERT INTO members (name, email, phone, address, is_active, name_norm, name_chosung) "
+    "WITH RECURSIVE seq(i) AS (SELECT 1 UNION ALL SELECT i + 1 FROM seq WHERE i < ?1), "
+    NAME_PARTS_CTE
+    "generated AS (SELECT i, " NAME_EXPRESSION " AS name FROM seq) "
+    "SELECT name, printf('member%d@example.com', i), printf('010-%04d-%04d', (i / 10000) % 10000, i % 10000), "
+    "printf('서울시 벤치구 %d번길', i % 500), 1, hangul_normalize(name), hangul_chosung(name) "
+    "FROM generated;";
+
+// 대출은 약 3년에 걸쳐 고르게 분포하고, 마지막 (도서 수 / 20)건만 대출 중 (그중 1/64는 연체)
+// 연속한 대출은 서로 다른 도서/회원을 가리키므로 대출 중 기록이 한 도서나 회원에 몰리지 않음
+const char *SEED_LOANS_SQL =
+    "INSERT INTO loans (book_id, member_id, loan_date, due_date, return_date, is_returned) "
+    "WITH RECURSIVE seq(i) AS (SELECT 1 UNION ALL SELECT i + 1 FROM seq WHERE i < ?1), "
+    "generated AS (SELECT i, (i * 7919) % ?2 + 1 AS book_id, (i * 104729) % ?3 + 1 AS member_id, "
+    "datetime('now', printf('-%d minutes', (?1 - i) * 1576800 / ?1 + 60)) AS loan_date, "
+    "i > ?1 - ?4 AS is_open FROM seq) "
+    "SELECT book_id, member_id, loan_date, "
+    "CASE WHEN is_open AND i % 64 = 0 THEN datetime('now', '-3 days') ELSE datetime(loan_date, '+14 days') END, "
+    "CASE WHEN is_open THEN NULL ELSE datetime(loan_date, '+7 days') END, "
+    "CASE WHEN is_open THEN 0 ELSE 1 END "
+    "FROM generated;";
+
+const char *SEED_AVAILABILITY_SQL =
+    "UPDATE books SET available_copies = total_copies - "
+    "(SELECT COUNT(*) FROM loans WHERE loans.book_id = books.id AND is_returned = 0) "
+    "WHERE id IN (SELECT book_id FROM loans WHERE is_returned = 0);";
+
+int run_seed_statement(sqlite3 *db, const char *sql, long long a, long long b, long long c, long long d) {
+    sqlite3_stmt *stmt = nullptr;
+    if (database_prepare_statement(db, sql, &stmt) != SUCCESS) {
+        return FAILURE;
+    }
+
+    // 바인딩하지 않는 번호는 무시됨
+    sqlite3_bind_int64(stmt, 1, a);
+    sqlite3_bind_int64(stmt, 2, b);
+    sqlite3_bind_int64(stmt, 3, c);
+    sqlite3_bind_int64(stmt, 4, d);
+
+    int status = sqlite3_step(stmt) == SQLITE_DONE ? SUCCESS : FAILURE;
+    if (status != SUCCESS) {
+        fprintf(stderr, "벤치마크 데이터 생성 실패: %s\n", sqlite3_errmsg(db));
+    }
+    sqlite3_finalize(stmt);
+    return status;
+}
+
+int seed_database(sqlite3 *db, int books) {
+    int members = member_count_for(books);
+    long long loans = (long long)books * LOANS_PER_BOOK;
+
+    database_execute_query(db, "PRAGMA synchronous = OFF;");
+
+    int status = database_begin_transaction(db);
+    if (status == SUCCESS) {
+        status = run_seed_statement(db, SEED_BOOKS_SQL, books, 0, 0, 0);
+    }
+    if (status == SUCCESS) {
+        status = run_seed_statement(db, SEED_MEMBERS_SQL, members, 0, 0, 0);
+    }
+    if (status == SUCCESS) {
+        // 마지막 FREE_MEMBER_COUNT명은 대출 기록 없이 남겨 둠
+        status = run_seed_statement(db, SEED_LOANS_SQL, loans, books, members - FREE_MEMBER_COUNT, books / 20);
+    }
+    if (status == SUCCESS) {
+        status = database_execute_query(db, SEED_AVAILABILITY_SQL);
+    }
+
+    if (status == SUCCESS) {
+        status = database_commit_transaction(db);
+    } else {
+        database_rollback_transaction(db);
+    }
+
+    // 전화번호 검색 키는 애플리케이션과 같은 방식으로 채움
+    if (status == SUCCESS && backfill_member_phone_digits(db) == FAILURE) {
+        status = FAILURE;
+    }
+    if (status == SUCCESS) {
+        char sql[64];
+        snprintf(sql, sizeof(sql), "PRAGMA user_version = %d;", BENCH_SEED_VERSION);
+        status = database_execute_query(db, sql);
+    }
+    if (status == SUCCESS) {
+        status = database_execute_query(db, "ANALYZE;");
+    }
+
+    database_execute_query(db, "PRAGMA synchronous = FULL;");
+    return status;
+}
+
+int read_user_version(const std::string &path) {
+    sqlite3 *db = nullptr;
+    int version = -1;
+
+    if (sqlite3_open_v2(path.c_str(), &db, SQLITE_OPEN_READONLY, nullptr) == SQLITE_OK) {
+        sqlite3_stmt *stmt = nullptr;
+        if (sqlite3_prepare_v2(db, "PRAGMA user_version;", -1, &stmt, nullptr) == SQLITE_OK &&
+            sqlite3_step(stmt) == SQLITE_ROW) {
+            version = sqlite3_column_int(stmt, 0);
+        }
+        sqlite3_finalize(stmt);
+    }
+    sqlite3_close(db);
+    return version;
+}
+
+// 원본 데이터베이스를 만들거나 재사용하고, 측정은 복사본에서 하여 원본이 바뀌지 않게 함
+Dataset *get_dataset(int books) {
+    auto found = datasets.find(books);
+    if (found != datasets.end()) {
+        return found->second.db ? &found->second : nullptr;
+    }
+
+    Dataset &dataset = datasets[books];
+    std::string template_path = "library_bench_" + std::to_string(books) + ".db";
+
+    if (!std::filesystem::exists(template_path) || read_user_version(template_path) != BENCH_SEED_VERSION) {
+        std::filesystem::remove(template_path);
+        fprintf(stderr, "벤치마크 데이터 생성 중: 도서 %d권, 대출 %lld건...\n",
+                books, (long long)books * LOANS_PER_BOOK);
+
+        sqlite3 *db = database_init(template_path.c_str());
+        int status = db ? seed_database(db, books) : FAILURE;
+        if (db) {
+            database_close(db);
+        }
+        if (status != SUCCESS) {
+            std::filesystem::remove(template_path);
+            return nullptr;
+        }
+    }
+
+    dataset.path = "library_bench_" + std::to_string(books) + ".work.db";
+    dataset.backup_path = "library_bench_" + std::to_string(books) + ".backup.db";
+    std::filesystem::copy_file(template_path, dataset.path, std::filesystem::copy_options::overwrite_existing);
+
+    dataset.db = database_init(dataset.path.c_str());
+    if (!dataset.db) {
+        return nullptr;
+    }
+    dataset.books = books;
+    dataset.members = member_count_for(books);
+    dataset.loans = (long long)books * LOANS_PER_BOOK;
+    return &dataset;
+}
+
+void close_datasets() {
+    for (auto &entry : datasets) {
+        Dataset &dataset = entry.second;
+        if (dataset.db) {
+            database_close(dataset.db);
+            dataset.db = nullptr;
+        }
+        std::filesystem::remove(dataset.path);
+        std::filesystem::remove(dataset.backup_path);
+    }
+    datasets.clear();
+}
+
+// 대출 기록이 없는 회원 ID (대출 한도에 걸리지 않도록 돌아가며 사용)
+int free_member_id(const Dataset *dataset, int index) {
+    return dataset->members - FREE_MEMBER_COUNT + 1 + index % FREE_MEMBER_COUNT;
+}
+
+#define REQUIRE_DATASET(state, dataset)                                  \
+    Dataset *dataset = get_dataset((int)(state).range(0));               \
+    if (!dataset) {                                                      \
+        (state).SkipWithError("벤치마크 데이터베이스를 준비하지 못했습니다"); \
+        return;                                                          \
+    }
+
+void dataset_sizes(benchmark::internal::Benchmark *bench) {
+    bench->ArgName("books");
+    for (int books : { 10000, 100000, 1000000 }) {
+        if (books <= max_books()) {
+            bench->Arg(books);
+        }
+    }
+}
+
+void list_offsets(benchmark::internal::Benchmark *bench) {
+    bench->ArgNames({ "books", "offset" });
+    for (int books : { 10000, 100000, 1000000 }) {
+        if (books <= max_books()) {
+            bench->Args({ books, 0 });
+            bench->Args({ books, books / 2 });
+            bench->Args({ books, books - LIST_PAGE_SIZE });
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// 도서
+// ---------------------------------------------------------------------------
+
+void BM_AddBook(benchmark::State &state) {
+    REQUIRE_DATASET(state, dataset);
+    static long long next_isbn = 0;
+
+    Book book;
+    memset(&book, 0, sizeof(Book));
+    strncpy(book.title, "새로 들어온 도서", sizeof(book.title) - 1);
+    strncpy(book.author, "김민준", sizeof(book.author) - 1);
+    strncpy(book.publisher, "벤치출판", sizeof(book.publisher) - 1);
+    strncpy(book.category, "과학", sizeof(book.category) - 1);
+    book.publication_year = 2024;
+    book.total_copies = 1;
+    book.available_copies = 1;
+
+    for (auto _ : state) {
+        snprintf(book.isbn, sizeof(book.isbn), "978%010lld", next_isbn++);
+        if (add_book(dataset->db, &book) <= 0) {
+            state.SkipWithError("add_book 실패");
+            break;
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_GetBookById(benchmark::State &state) {
+    REQUIRE_DATASET(state, dataset);
+    std::mt19937 random(42);
+    std::uniform_int_distribution<int> ids(1, dataset->books);
+    Book book;
+
+    for (auto _ : state) {
+        if (get_book_by_id(dataset->db, ids(random), &book) != SUCCESS) {
+            state.SkipWithError("get_book_by_id 실패");
+            break;
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_GetBookByIsbn(benchmark::State &state) {
+    REQUIRE_DATASET(state, dataset);
+    std::mt19937 random(42);
+    std::uniform_int_distribution<int> ids(1, dataset->books);
+    char isbn[MAX_ISBN_LENGTH + 1];
+    Book book;
+
+    for (auto _ : state) {
+        snprintf(isbn, sizeof(isbn), "979%010d", ids(random));
+        if (get_book_by_isbn(dataset->db, isbn, &book) != SUCCESS) {
+            state.SkipWithError("get_book_by_isbn 실패");
+            break;
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+typedef int (*BookSearchFunction)(sqlite3*, const char*, BookSearchResult*);
+
+void run_book_search(benchmark::State &state, BookSearchFunction search, const char *query) {
+    REQUIRE_DATASET(state, dataset);
+    long long rows = 0;
+
+    for (auto _ : state) {
+        BookSearchResult result;
+        init_book_search_result(&result);
+        if (search(dataset->db, query, &result) != SUCCESS) {
+            free_book_search_result(&result);
+            state.SkipWithError("도서 검색 실패");
+            break;
+        }
+        rows += result.count;
+        free_book_search_result(&result);
+    }
+    state.SetItemsProcessed(rows);
+    state.counters["rows"] = state.iterations() ? (double)rows / (double)state.iterations() : 0;
+}
+
+void BM_SearchBooksByTitle(benchmark::State &state) {
+    run_book_search(state, search_books_by_title, "입문 777");
+}
+
+void BM_SearchBooksByTitleChosung(benchmark::State &state) {
+    run_book_search(state, search_books_by_title, "ㅅㄹㅇ ㅈㄹㄱㅈ ㅇㅁ");
+}
+
+void BM_SearchBooksByAuthor(benchmark::State &state) {
+    run_book_search(state, search_books_by_author, "김민준");
+}
+
+void BM_SearchBooksByCategory(benchmark::State &state) {
+    run_book_search(state, search_books_by_category, "과학-12");
+}
+
+void BM_ListAllBooks(benchmark::State &state) {
+    REQUIRE_DATASET(state, dataset);
+    int offset = (int)state.range(1);
+
+    for (auto _ : state) {
+        BookSearchResult result;
+        init_book_search_result(&result);
+        if (list_all_books(dataset->db, &result, LIST_PAGE_SIZE, offset) != SUCCESS) {
+            free_book_search_result(&result);
+            state.SkipWithError("list_all_books 실패");
+            break;
+        }
+        free_book_search_result(&result);
+    }
+    state.SetItemsProcessed(state.iterations() * LIST_PAGE_SIZE);
+}
+
+void BM_GetPopularBooks(benchmark::State &state) {
+    REQUIRE_DATASET(state, dataset);
+
+    for (auto _ : state) {
+        BookSearchResult result;
+        init_book_search_result(&result);
+        if (get_popular_books(dataset->db, &result, 10) != SUCCESS) {
+            free_book_search_result(&result);
+            state.SkipWithError("get_popular_books 실패");
+            break;
+        }
+        free_book_search_result(&result);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// 회원 검색
+// ---------------------------------------------------------------------------
+
+typedef int (*MemberSearchFunction)(sqlite3*, const char*, MemberSearchResult*);
+
+void run_member_search(benchmark::State &state, MemberSearchFunction search, const char *query) {
+    REQUIRE_DATASET(state, dataset);
+    long long rows = 0;
+
+    for (auto _ : state) {
+        MemberSearchResult result;
+        init_member_search_result(&result);
+        if (search(dataset->db, query, &result) != SUCCESS) {
+            free_member_search_result(&result);
+            state.SkipWithError("회원 검색 실패");
+            break;
+        }
+        rows += result.count;
+        free_member_search_result(&result);
+    }
+    state.SetItemsProcessed(rows);
+    state.counters["rows"] = state.iterations() ? (double)rows / (double)state.iterations() : 0;
+}
+
+void BM_SearchMembersByName(benchmark::State &state) {
+    run_member_search(state, search_members_by_name, "이민준");
+}
+
+void BM_SearchMembersByNameChosung(benchmark::State &state) {
+    run_member_search(state, search_members_by_name, "ㄱㅁㅈ");
+}
+
+void BM_SearchMembersByPhone(benchmark::State &state) {
+    run_member_search(state, search_members_by_phone, "101");
+}
+
+void BM_GetMemberByEmail(benchmark::State &state) {
+    REQUIRE_DATASET(state, dataset);
+    std::mt19937 random(42);
+    std::uniform_int_distribution<int> ids(1, dataset->members);
+    char email[MAX_EMAIL_LENGTH + 1];
+    Member member;
+
+    for (auto _ : state) {
+        snprintf(email, sizeof(email), "member%d@example.com", ids(random));
+        if (get_member_by_email(dataset->db, email, &member) != SUCCESS) {
+            state.SkipWithError("get_member_by_email 실패");
+            break;
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// ---------------------------------------------------------------------------
+// 대출/반납/연장 (측정하지 않는 짝 작업은 타이머를 멈추고 실행)
+// ---------------------------------------------------------------------------
+
+void BM_LoanBook(benchmark::State &state) {
+    REQUIRE_DATASET(state, dataset);
+    int index = 0;
+
+    for (auto _ : state) {
+        int loan_id = loan_book(dataset->db, index % dataset->books + 1, free_member_id(dataset, index), 0);
+
+        state.PauseTiming();
+        index++;
+        if (loan_id <= 0 || return_book(dataset->db, loan_id) != SUCCESS) {
+            state.SkipWithError("loan_book 실패");
+            break;
+        }
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_ReturnBook(benchmark::State &state) {
+    REQUIRE_DATASET(state, dataset);
+    int index = 0;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        int loan_id = loan_book(dataset->db, index % dataset->books + 1, free_member_id(dataset, index), 0);
+        index++;
+        if (loan_id <= 0) {
+            state.SkipWithError("loan_book 실패");
+            break;
+        }
+        state.ResumeTiming();
+
+        if (return_book(dataset->db, loan_id) != SUCCESS) {
+            state.SkipWithError("return_book 실패");
+            break;
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_ExtendLoan(benchmark::State &state) {
+    REQUIRE_DATASET(state, dataset);
+    int index = 0;
+    int loan_id = 0;
+    int extensions = MAX_RENEWAL_COUNT;
+
+    for (auto _ : state) {
+        // 연장 한도를 다 쓰면 반납하고 새로 대출
+        if (extensions == MAX_RENEWAL_COUNT) {
+            state.PauseTiming();
+            if (loan_id > 0) {
+                return_book(dataset->db, loan_id);
+            }
+            loan_id = loan_book(dataset->db, index % dataset->books + 1, free_member_id(dataset, index), 0);
+            index++;
+            extensions = 0;
+            if (loan_id <= 0) {
+                state.SkipWithError("loan_book 실패");
+                break;
+            }
+            state.ResumeTiming();
+        }
+
+        if (extend_loan(dataset->db, loan_id, 7) != SUCCESS) {
+            state.SkipWithError("extend_loan 실패");
+            break;
+        }
+        extensions++;
+    }
+
+    if (loan_id > 0) {
+        return_book(dataset->db, loan_id);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// ---------------------------------------------------------------------------
+// 통계
+// ---------------------------------------------------------------------------
+
+void BM_GetLoanStatistics(benchmark::State &state) {
+    REQUIRE_DATASET(state, dataset);
+    int total = 0, current = 0, overdue = 0, returned = 0;
+
+    for (auto _ : state) {
+        if (get_loan_statistics(dataset->db, &total, &current, &overdue, &returned) != SUCCESS) {
+            state.SkipWithError("get_loan_statistics 실패");
+            break;
+        }
+    }
+    state.counters["loans"] = total;
+}
+
+void BM_GetPopularBooksByLoans(benchmark::State &state) {
+    REQUIRE_DATASET(state, dataset);
+    int book_ids[10];
+    int loan_counts[10];
+
+    for (auto _ : state) {
+        if (get_popular_books_by_loans(dataset->db, book_ids, loan_counts, 10) == FAILURE) {
+            state.SkipWithError("get_popular_books_by_loans 실패");
+            break;
+        }
+    }
+}
+
+void BM_GetMemberLoanStats(benchmark::State &state) {
+    REQUIRE_DATASET(state, dataset);
+    std::mt19937 random(42);
+    std::uniform_int_distribution<int> ids(1, dataset->members - FREE_MEMBER_COUNT);
+    int total = 0, current = 0, overdue = 0;
+
+    for (auto _ : state) {
+        if (get_member_loan_stats(dataset->db, ids(random), &total, &current, &overdue) != SUCCESS) {
+            state.SkipWithError("get_member_loan_stats 실패");
+            break;
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_GetMemberLoanHistory(benchmark::State &state) {
+    REQUIRE_DATASET(state, dataset);
+    std::mt19937 random(42);
+    std::uniform_int_distribution<int> ids(1, dataset->members - FREE_MEMBER_COUNT);
+    long long rows = 0;
+
+    for (auto _ : state) {
+        LoanSearchResult result;
+        init_loan_search_result(&result);
+        if (get_member_loan_history(dataset->db, ids(random), &result, TRUE) != SUCCESS) {
+            free_loan_search_result(&result);
+            state.SkipWithError("get_member_loan_history 실패");
+            break;
+        }
+        rows += result.count;
+        free_loan_search_result(&result);
+    }
+    state.SetItemsProcessed(rows);
+}
+
+void BM_GetOverdueLoans(benchmark::State &state) {
+    REQUIRE_DATASET(state, dataset);
+    long long rows = 0;
+
+    for (auto _ : state) {
+        LoanSearchResult result;
+        init_loan_search_result(&result);
+        if (get_overdue_loans(dataset->db, &result) != SUCCESS) {
+            free_loan_search_result(&result);
+            state.SkipWithError("get_overdue_loans 실패");
+            break;
+        }
+        rows += result.count;
+        free_loan_search_result(&result);
+    }
+    state.SetItemsProcessed(rows);
+}
+
+// ---------------------------------------------------------------------------
+// 백업/복원
+// ---------------------------------------------------------------------------
+
+void BM_DatabaseBackup(benchmark::State &state) {
+    REQUIRE_DATASET(state, dataset);
+
+    for (auto _ : state) {
+        if (database_backup(dataset->db, dataset->backup_path.c_str()) != SUCCESS) {
+            state.SkipWithError("database_backup 실패");
+            break;
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * (long long)std::filesystem::file_size(dataset->path));
+}
+
+void BM_DatabaseRestore(benchmark::State &state) {
+    REQUIRE_DATASET(state, dataset);
+
+    if (database_backup(dataset->db, dataset->backup_path.c_str()) != SUCCESS) {
+        state.SkipWithError("복원할 백업을 만들지 못했습니다");
+        return;
+    }
+
+    for (auto _ : state) {
+        if (database_restore(dataset->db, dataset->backup_path.c_str()) != SUCCESS) {
+            state.SkipWithError("database_restore 실패");
+            break;
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * (long long)std::filesystem::file_size(dataset->backup_path));
+}
+
+} // namespace
+
+BENCHMARK(BM_AddBook)->Apply(dataset_sizes);
+BENCHMARK(BM_GetBookById)->Apply(dataset_sizes);
+BENCHMARK(BM_GetBookByIsbn)->Apply(dataset_sizes);
+BENCHMARK(BM_SearchBooksByTitle)->Apply(dataset_sizes)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_SearchBooksByTitleChosung)->Apply(dataset_sizes)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_SearchBooksByAuthor)->Apply(dataset_sizes)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_SearchBooksByCategory)->Apply(dataset_sizes)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ListAllBooks)->Apply(list_offsets)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_GetPopularBooks)->Apply(dataset_sizes)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_SearchMembersByName)->Apply(dataset_sizes)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_SearchMembersByNameChosung)->Apply(dataset_sizes)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_SearchMembersByPhone)->Apply(dataset_sizes)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_GetMemberByEmail)->Apply(dataset_sizes);
+BENCHMARK(BM_LoanBook)->Apply(dataset_sizes)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ReturnBook)->Apply(dataset_sizes)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ExtendLoan)->Apply(dataset_sizes)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_GetLoanStatistics)->Apply(dataset_sizes)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_GetPopularBooksByLoans)->Apply(dataset_sizes)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_GetMemberLoanStats)->Apply(dataset_sizes)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_GetMemberLoanHistory)->Apply(dataset_sizes)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_GetOverdueLoans)->Apply(dataset_sizes)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_DatabaseBackup)->Apply(dataset_sizes)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_DatabaseRestore)->Apply(dataset_sizes)->Unit(benchmark::kMillisecond);
+
+int main(int argc, char **argv) {
+    // 대출/반납마다 남기는 정보 로그가 결과 출력에 섞이지 않도록 오류만 출력
+    set_log_level(LOG_ERROR);
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+
+    // JSON 결과의 context에 남겨 빌드 간 비교 시 데이터/라이브러리 차이를 구분
+    benchmark::AddCustomContext("sqlite_version", sqlite3_libversion());
+    benchmark::AddCustomContext("seed_version", std::to_string(BENCH_SEED_VERSION));
+    benchmark::AddCustomContext("loans_per_book", std::to_string(LOANS_PER_BOOK));
+
+    benchmark::RunSpecifiedBenchmarks();
+    close_datasets();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,617 @@
+/**
+ * @file library_load.cpp
+ * @brief 여러 대출 창구가 동시에 쓰는 상황의 부하 시험
+ *
+ * 창구마다 스레드 하나와 연결 하나를 두고 검색/대출/반납/연장을 정해진 비율로 반복하며,
+ * 그동안 통계 보고서와 백업 작업을 주기적으로 함께 실행합니다.
+ * 끝나면 작업별 처리량, p50/p99 지연 시간, 잠금 대기(SQLITE_BUSY) 재시도/포기 횟수를 출력하고
+ * 대출 가능 수량과 회원 대출 한도가 어긋나지 않았는지 확인합니다.
+ *
+ * 실행 예:
+ *   ./library_load --desks 30 --seconds 60 --books 100000
+ *   ./library_load --db library.db --mix 50,25,20,5 --slo-p99-ms 200
+ *
+ * 반환값: 0 정상, 1 준비 실패 또는 데이터 불일치, 2 지연 시간 목표(SLO) 초과
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include <fcntl.h>
+#ifdef _WIN32
+#include <io.h>
+#define dup _dup
+#define dup2 _dup2
+#define close _close
+#define open _open
+#define NULL_DEVICE "NUL"
+#else
+#include <unistd.h>
+#define NULL_DEVICE "/dev/null"
+#endif
+
+extern "C" {
+    #include "database.h"
+    #include "book.h"
+    #include "loan.h"
+    #include "dataset_generator.h"
+    #include "utils.h"
+    #include "constants.h"
+}
+
+namespace {
+
+enum LoadOperation {
+    OP_SEARCH = 0,
+    OP_CHECKOUT,
+    OP_RETURN,
+    OP_RENEW,
+    OP_REPORT,
+    OP_BACKUP,
+    OP_COUNT
+};
+
+const char *const OPERATION_NAMES[OP_COUNT] = { "검색", "대출", "반납", "연장", "보고서", "백업" };
+const int DESK_OPERATION_COUNT = OP_REPORT;   // 창구가 직접 하는 작업 수
+
+struct LoadOptions {
+    std::string db_path = "library_load.db";
+    int books = 10000;
+    int desks = 8;
+    double seconds = 10.0;
+    int mix[DESK_OPERATION_COUNT] = { 60, 20, 15, 5 };
+    int think_ms = 0;
+    int report_interval_ms = 1000;
+    int backup_interval_ms = 5000;
+    unsigned long long seed = 1;
+    double slo_p99_ms = 0.0;
+    bool fresh = false;
+    bool verbose = false;
+};
+
+// 작업 하나의 결과 (스레드마다 따로 모은 뒤 합침)
+struct OperationStats {
+    std::vector<long long> latencies;
+    long long succeeded = 0;
+    long long rejected = 0;       // 대출 불가, 연장 한도 등 업무 규칙에 따른 실패
+    long long busy_failures = 0;  // 잠금을 끝내 얻지 못한 실패
+    long long busy_retries = 0;
+
+    void merge(const OperationStats &other) {
+        latencies.insert(latencies.end(), other.latencies.begin(), other.latencies.end());
+        succeeded += other.succeeded;
+        rejected += other.rejected;
+        busy_failures += other.busy_failures;
+        busy_retries += other.busy_retries;
+    }
+};
+
+struct Worker {
+    sqlite3 *db = nullptr;
+    DatabaseBusyStats busy = { 0, 0 };
+    OperationStats stats[OP_COUNT];
+    std::mt19937_64 random;
+    std::vector<int> members;     // 이 창구에서 처리하는 회원
+    std::vector<int> open_loans;  // 이 창구 회원의 대출 중 기록
+};
+
+// 시험 대상 데이터 (시작 전에 한 번 읽고 이후에는 읽기만 함)
+struct LoadData {
+    std::vector<int> book_ids;
+    std::vector<std::string> titles;
+};
+
+std::atomic<bool> running(false);
+
+// 작업 하나를 실행하며 지연 시간과 잠금 대기를 기록
+template <typename Operation>
+int run_operation(Worker &worker, LoadOperation op, Operation operation) {
+    DatabaseBusyStats before = worker.busy;
+    long long start = timer_now_nanoseconds();
+    int status = operation();
+    long long elapsed = timer_now_nanoseconds() - start;
+
+    OperationStats &stats = worker.stats[op];
+    stats.latencies.push_back(elapsed);
+    stats.busy_retries += worker.busy.retries - before.retries;
+    if (status != FAILURE) {
+        stats.succeeded++;
+    } else if (worker.busy.timeouts > before.timeouts) {
+        stats.busy_failures++;
+    } else {
+        stats.rejected++;
+    }
+    return status;
+}
+
+template <typename T>
+const T &pick(std::mt19937_64 &random, const std::vector<T> &items) {
+    return items[std::uniform_int_distribution<size_t>(0, items.size() - 1)(random)];
+}
+
+int pick_operation(Worker &worker, const LoadOptions &options) {
+    int total = 0;
+    for (int weight : options.mix) {
+        total += weight;
+    }
+
+    int roll = std::uniform_int_distribution<int>(0, total - 1)(worker.random);
+    for (int op = 0; op < DESK_OPERATION_COUNT; op++) {
+        if (roll < options.mix[op]) {
+            return op;
+        }
+        roll -= options.mix[op];
+    }
+    return OP_SEARCH;
+}
+
+void run_desk(Worker &worker, const LoadOptions &options, const LoadData &data) {
+    while (running.load(std::memory_order_relaxed)) {
+        int op = pick_operation(worker, options);
+
+        // 반납/연장할 대출이 없으면 대출로 대신함
+        if ((op == OP_RETURN || op == OP_RENEW) && worker.open_loans.empty()) {
+            op = OP_CHECKOUT;
+        }
+
+        if (op == OP_SEARCH) {
+            const std::string &title = pick(worker.random, data.titles);
+            run_operation(worker, OP_SEARCH, [&]() {
+                BookSearchResult result;
+                if (init_book_search_result(&result) != SUCCESS) {
+                    return FAILURE;
+                }
+                int status = search_books_by_title(worker.db, title.c_str(), &result);
+                free_book_search_result(&result);
+                return status;
+            });
+        } else if (op == OP_CHECKOUT) {
+            int book_id = pick(worker.random, data.book_ids);
+            int member_id = pick(worker.random, worker.members);
+            int loan_id = run_operation(worker, OP_CHECKOUT, [&]() {
+                return loan_book(worker.db, book_id, member_id, DEFAULT_LOAN_DAYS);
+            });
+            if (loan_id != FAILURE) {
+                worker.open_loans.push_back(loan_id);
+            }
+        } else if (op == OP_RETURN) {
+            size_t index = std::uniform_int_distribution<size_t>(0, worker.open_loans.size() - 1)(worker.random);
+            int loan_id = worker.open_loans[index];
+            long long busy_failures = worker.stats[OP_RETURN].busy_failures;
+            run_operation(worker, OP_RETURN, [&]() {
+                return return_book(worker.db, loan_id);
+            });
+            // 잠금 때문에 실패한 경우만 다시 시도할 수 있도록 남김
+            if (worker.stats[OP_RETURN].busy_failures == busy_failures) {
+                worker.open_loans[index] = worker.open_loans.back();
+                worker.open_loans.pop_back();
+            }
+        } else {
+            int loan_id = pick(worker.random, worker.open_loans);
+            run_operation(worker, OP_RENEW, [&]() {
+                return extend_loan(worker.db, loan_id, DEFAULT_LOAN_DAYS);
+            });
+        }
+
+        if (options.think_ms > 0) {
+            int pause = std::uniform_int_distribution<int>(0, options.think_ms * 2)(worker.random);
+            std::this_thread::sleep_for(std::chrono::milliseconds(pause));
+        }
+    }
+}
+
+// 간격마다 작업을 실행하되 종료 요청에는 바로 반응
+template <typename Job>
+void run_periodic(int interval_ms, Job job) {
+    while (running.load(std::memory_order_relaxed)) {
+        job();
+        for (int waited = 0; waited < interval_ms && running.load(std::memory_order_relaxed); waited += 10) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    }
+}
+
+void run_reports(Worker &worker, const LoadOptions &options) {
+    run_periodic(options.report_interval_ms, [&]() {
+        run_operation(worker, OP_REPORT, [&]() {
+            int total = 0, current = 0, overdue = 0, returned = 0;
+            int book_ids[10], loan_counts[10];
+            if (get_loan_statistics(worker.db, &total, &current, &overdue, &returned) != SUCCESS) {
+                return FAILURE;
+            }
+            return get_popular_books_by_loans(worker.db, book_ids, loan_counts, 10) == FAILURE ? FAILURE : SUCCESS;
+        });
+    });
+}
+
+void run_backups(Worker &worker, const LoadOptions &options, const std::string &backup_path) {
+    run_periodic(options.backup_interval_ms, [&]() {
+        run_operation(worker, OP_BACKUP, [&]() {
+            return database_backup(worker.db, backup_path.c_str());
+        });
+    });
+}
+
+long long query_int(sqlite3 *db, const char *sql) {
+    sqlite3_stmt *stmt = nullptr;
+    long long value = -1;
+    if (database_prepare_statement(db, sql, &stmt) == SUCCESS && sqlite3_step(stmt) == SQLITE_ROW) {
+        value = sqlite3_column_int64(stmt, 0);
+    }
+    sqlite3_finalize(stmt);
+    return value;
+}
+
+// 빈 데이터베이스면 합성 데이터를 채움
+int prepare_database(const LoadOptions &options) {
+    if (options.fresh) {
+        std::filesystem::remove(options.db_path);
+    }
+
+    sqlite3 *db = database_init(options.db_path.c_str());
+    if (!db) {
+        return FAILURE;
+    }
+
+    int status = SUCCESS;
+    if (query_int(db, "SELECT COUNT(*) FROM books;") == 0) {
+        DatasetGeneratorConfig config;
+        dataset_generator_default_config(&config, options.books);
+        config.seed = options.seed;
+
+        DatasetGeneratorStats stats;
+        printf("%s 생성 중: 도서 %d권, 회원 %d명, 대출 %lld건\n",
+               options.db_path.c_str(), config.book_count, config.member_count, config.loan_count);
+        status = dataset_generate(db, &config, &stats);
+        if (status == SUCCESS) {
+            printf("생성 완료 (%.1f초)\n", stats.elapsed_seconds);
+        }
+    }
+
+    database_close(db);
+    return status;
+}
+
+int load_data(sqlite3 *db, const LoadOptions &options, LoadData *data, std::vector<Worker> &desks) {
+    sqlite3_stmt *stmt = nullptr;
+
+    if (database_prepare_statement(db, "SELECT id FROM books;", &stmt) != SUCCESS) {
+        return FAILURE;
+    }
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+        data->book_ids.push_back(sqlite3_column_int(stmt, 0));
+    }
+    sqlite3_finalize(stmt);
+
+    // 검색어는 실제 제목에서 골라 결과가 검색 상한을 넘지 않도록 함
+    if (database_prepare_statement(db, "SELECT title FROM books ORDER BY random() LIMIT 512;", &stmt) != SUCCESS) {
+        return FAILURE;
+    }
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+        data->titles.emplace_back((const char*)sqlite3_column_text(stmt, 0));
+    }
+    sqlite3_finalize(stmt);
+
+    // 회원은 ID로 창구에 나누어, 같은 회원의 대출 중 기록은 한 창구만 다룸
+    if (database_prepare_statement(db, "SELECT id FROM members WHERE is_active = 1;", &stmt) != SUCCESS) {
+        return FAILURE;
+    }
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+        int member_id = sqlite3_column_int(stmt, 0);
+        desks[(size_t)member_id % desks.size()].members.push_back(member_id);
+    }
+    sqlite3_finalize(stmt);
+
+    if (database_prepare_statement(db, "SELECT id, member_id FROM loans WHERE is_returned = 0;", &stmt) != SUCCESS) {
+        return FAILURE;
+    }
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+        int member_id = sqlite3_column_int(stmt, 1);
+        desks[(size_t)member_id % desks.size()].open_loans.push_back(sqlite3_column_int(stmt, 0));
+    }
+    sqlite3_finalize(stmt);
+
+    if (data->book_ids.empty() || data->titles.empty()) {
+        fprintf(stderr, "시험할 도서가 없습니다.\n");
+        return FAILURE;
+    }
+    for (const Worker &desk : desks) {
+        if (desk.members.empty()) {
+            fprintf(stderr, "창구 %d개에 나눌 회원이 부족합니다.\n", options.desks);
+            return FAILURE;
+        }
+    }
+    return SUCCESS;
+}
+
+// 동시 실행 후에도 재고와 대출 한도가 맞는지 확인
+int check_consistency(sqlite3 *db) {
+    long long mismatched_books = query_int(db,
+        "SELECT COUNT(*) FROM books b WHERE b.available_copies != b.total_copies - "
+        "(SELECT COUNT(*) FROM loans l WHERE l.book_id = b.id AND l.is_returned = 0);");
+    std::string over_limit_sql =
+        "SELECT COUNT(*) FROM (SELECT member_id FROM loans WHERE is_returned = 0 "
+        "GROUP BY member_id HAVING COUNT(*) > " + std::to_string(MAX_BOOKS_PER_MEMBER) + ");";
+    long long over_limit_members = query_int(db, over_limit_sql.c_str());
+
+    printf("\n데이터 확인: 대출 가능 수량 불일치 도서 %lld권, 대출 한도 초과 회원 %lld명\n",
+           mismatched_books, over_limit_members);
+    return mismatched_books == 0 && over_limit_members == 0 ? SUCCESS : FAILURE;
+}
+
+// 한글은 화면에서 두 칸을 차지하므로 바이트 수가 아닌 표시 폭으로 맞춤
+void print_column(const char *text, int width, bool align_right) {
+    int display_width = 0;
+    for (const unsigned char *p = (const unsigned char*)text; *p; p++) {
+        if ((*p & 0xC0) != 0x80) {
+            display_width += *p >= 0xE0 ? 2 : 1;
+        }
+    }
+    int padding = std::max(width - display_width, 0);
+    if (align_right) {
+        printf("%*s%s", padding, "", text);
+    } else {
+        printf("%s%*s", text, padding, "");
+    }
+}
+
+double percentile_ms(const std::vector<long long> &sorted, double fraction) {
+    if (sorted.empty()) {
+        return 0.0;
+    }
+    size_t rank = (size_t)(fraction * (double)sorted.size());
+    return sorted[std::min(rank, sorted.size() - 1)] / 1e6;
+}
+
+// 작업별 결과 표를 출력하고 창구 작업이 p99 목표를 넘었는지 반환
+bool print_report(OperationStats *totals, double elapsed_seconds, const LoadOptions &options) {
+    bool slo_met = true;
+    long long desk_operations = 0;
+
+    const char *headers[] = { "호출", "성공", "거절", "잠금실패", "초당", "p50(ms)", "p99(ms)", "최대(ms)", "잠금재시도" };
+    printf("\n");
+    print_column("작업", 8, false);
+    for (const char *header : headers) {
+        printf(" ");
+        print_column(header, 10, true);
+    }
+    printf("\n");
+    for (int op = 0; op < OP_COUNT; op++) {
+        OperationStats &stats = totals[op];
+        std::sort(stats.latencies.begin(), stats.latencies.end());
+
+        long long calls = (long long)stats.latencies.size();
+        double p99 = percentile_ms(stats.latencies, 0.99);
+        const char *verdict = "";
+        if (options.slo_p99_ms > 0 && op < DESK_OPERATION_COUNT && calls > 0) {
+            verdict = p99 <= options.slo_p99_ms ? "  SLO 충족" : "  SLO 초과";
+            slo_met = slo_met && p99 <= options.slo_p99_ms;
+        }
+        if (op < DESK_OPERATION_COUNT) {
+            desk_operations += calls;
+        }
+
+        print_column(OPERATION_NAMES[op], 8, false);
+        printf(" %10lld %10lld %10lld %10lld %10.1f %10.3f %10.3f %10.3f %10lld%s\n",
+               calls, stats.succeeded, stats.rejected, stats.busy_failures,
+               calls / elapsed_seconds, percentile_ms(stats.latencies, 0.50), p99,
+               calls > 0 ? stats.latencies.back() / 1e6 : 0.0, stats.busy_retries, verdict);
+    }
+
+    printf("\n창구 %d개, %.1f초, 창구 작업 초당 %.1f건\n",
+           options.desks, elapsed_seconds, desk_operations / elapsed_seconds);
+    if (options.slo_p99_ms > 0) {
+        printf("창구 작업 p99 목표 %.1fms: %s\n", options.slo_p99_ms, slo_met ? "충족" : "초과");
+    }
+    return slo_met;
+}
+
+void print_usage(const char *program) {
+    printf("사용법: %s [옵션]\n", program);
+    printf("  --db PATH                 시험할 데이터베이스 (기본: library_load.db, 비어 있으면 합성 데이터 생성)\n");
+    printf("  --books N                 합성 데이터 도서 수 (기본: 10000)\n");
+    printf("  --fresh                   시작 전에 데이터베이스를 지우고 새로 생성\n");
+    printf("  --desks N                 동시에 일하는 창구 수 (기본: 8)\n");
+    printf("  --seconds S               실행 시간 (기본: 10)\n");
+    printf("  --mix S,C,R,E             검색,대출,반납,연장 비율 (기본: 60,20,15,5)\n");
+    printf("  --think-ms N              창구 작업 사이 평균 대기 시간 (기본: 0)\n");
+    printf("  --report-interval-ms N    통계 보고서 실행 간격, 0이면 끔 (기본: 1000)\n");
+    printf("  --backup-interval-ms N    백업 실행 간격, 0이면 끔 (기본: 5000)\n");
+    printf("  --seed N                  난수 시드 (기본: 1)\n");
+    printf("  --slo-p99-ms MS           창구 작업 p99 목표, 넘으면 종료 코드 2\n");
+    printf("  --verbose                 실행 중 라이브러리 오류 메시지 출력\n");
+}
+
+int parse_options(int argc, char *argv[], LoadOptions *options) {
+    for (int i = 1; i < argc; i++) {
+        std::string option = argv[i];
+        const char *value = i + 1 < argc ? argv[i + 1] : nullptr;
+
+        if (option == "--fresh") {
+            options->fresh = true;
+            continue;
+        }
+        if (option == "--verbose") {
+            options->verbose = true;
+            continue;
+        }
+        if (option == "-h" || option == "--help") {
+            print_usage(argv[0]);
+            exit(EXIT_SUCCESS);
+        }
+        if (!value) {
+            fprintf(stderr, "%s 옵션에 값이 필요합니다.\n", option.c_str());
+            return FAILURE;
+        }
+        i++;
+
+        if (option == "--db") {
+            options->db_path = value;
+        } else if (option == "--books") {
+            options->books = atoi(value);
+        } else if (option == "--desks") {
+            options->desks = atoi(value);
+        } else if (option == "--seconds") {
+            options->seconds = atof(value);
+        } else if (option == "--mix") {
+            if (sscanf(value, "%d,%d,%d,%d", &options->mix[OP_SEARCH], &options->mix[OP_CHECKOUT],
+                       &options->mix[OP_RETURN], &options->mix[OP_RENEW]) != 4) {
+                fprintf(stderr, "--mix 형식은 검색,대출,반납,연장 비율입니다: %s\n", value);
+                return FAILURE;
+            }
+        } else if (option == "--think-ms") {
+            options->think_ms = atoi(value);
+        } else if (option == "--report-interval-ms") {
+            options->report_interval_ms = atoi(value);
+        } else if (option == "--backup-interval-ms") {
+            options->backup_interval_ms = atoi(value);
+        } else if (option == "--seed") {
+            options->seed = strtoull(value, nullptr, 10);
+        } else if (option == "--slo-p99-ms") {
+            options->slo_p99_ms = atof(value);
+        } else {
+            fprintf(stderr, "알 수 없는 옵션입니다: %s\n", option.c_str());
+            print_usage(argv[0]);
+            return FAILURE;
+        }
+    }
+
+    int mix_total = 0;
+    for (int weight : options->mix) {
+        if (weight < 0) {
+            mix_total = -1;
+            break;
+        }
+        mix_total += weight;
+    }
+    if (options->desks <= 0 || options->books <= 0 || options->seconds <= 0 || mix_total <= 0 ||
+        options->think_ms < 0 || options->report_interval_ms < 0 || options->backup_interval_ms < 0) {
+        fprintf(stderr, "옵션 값이 올바르지 않습니다.\n");
+        return FAILURE;
+    }
+    return SUCCESS;
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    LoadOptions options;
+    if (parse_options(argc, argv, &options) != SUCCESS) {
+        return EXIT_FAILURE;
+    }
+
+    set_log_level(LOG_ERROR);
+
+    if (prepare_database(options) != SUCCESS) {
+        fprintf(stderr, "시험용 데이터베이스를 준비하지 못했습니다: %s\n", options.db_path.c_str());
+        return EXIT_FAILURE;
+    }
+
+    // 창구 + 보고서 + 백업 (각자 자기 연결을 씀)
+    std::vector<Worker> desks((size_t)options.desks);
+    Worker reporter, backup;
+    std::vector<Worker*> workers;
+    for (Worker &desk : desks) {
+        workers.push_back(&desk);
+    }
+    workers.push_back(&reporter);
+    workers.push_back(&backup);
+
+    int status = SUCCESS;
+    for (size_t i = 0; i < workers.size() && status == SUCCESS; i++) {
+        workers[i]->random.seed(options.seed * 1000003ULL + i);
+        workers[i]->db = database_init(options.db_path.c_str());
+        status = workers[i]->db ? database_track_busy(workers[i]->db, &workers[i]->busy) : FAILURE;
+    }
+
+    LoadData data;
+    if (status == SUCCESS) {
+        status = load_data(reporter.db, options, &data, desks);
+    }
+    if (status != SUCCESS) {
+        for (Worker *worker : workers) {
+            database_close(worker->db);
+        }
+        return EXIT_FAILURE;
+    }
+
+    long long retries_before = database_get_busy_retry_count();
+    std::string backup_path = options.db_path + ".load-backup";
+
+    printf("창구 %d개로 %.1f초 실행 (검색/대출/반납/연장 = %d/%d/%d/%d, 보고서 %dms, 백업 %dms 간격)\n",
+           options.desks, options.seconds, options.mix[OP_SEARCH], options.mix[OP_CHECKOUT],
+           options.mix[OP_RETURN], options.mix[OP_RENEW], options.report_interval_ms, options.backup_interval_ms);
+    fflush(stdout);
+
+    // 대출 거절 같은 정상적인 실패도 라이브러리가 stderr에 출력하므로 실행 중에는 숨김
+    int saved_stderr = -1;
+    if (!options.verbose) {
+        fflush(stderr);
+        saved_stderr = dup(fileno(stderr));
+        int null_fd = open(NULL_DEVICE, O_WRONLY);
+        if (saved_stderr >= 0 && null_fd >= 0) {
+            dup2(null_fd, fileno(stderr));
+        }
+        if (null_fd >= 0) {
+            close(null_fd);
+        }
+    }
+
+    running.store(true);
+    long long start = timer_now_nanoseconds();
+
+    std::vector<std::thread> threads;
+    for (Worker &desk : desks) {
+        threads.emplace_back(run_desk, std::ref(desk), std::cref(options), std::cref(data));
+    }
+    if (options.report_interval_ms > 0) {
+        threads.emplace_back(run_reports, std::ref(reporter), std::cref(options));
+    }
+    if (options.backup_interval_ms > 0) {
+        threads.emplace_back(run_backups, std::ref(backup), std::cref(options), std::cref(backup_path));
+    }
+
+    std::this_thread::sleep_for(std::chrono::duration<double>(options.seconds));
+    running.store(false);
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+    double elapsed_seconds = (timer_now_nanoseconds() - start) / 1e9;
+
+    if (saved_stderr >= 0) {
+        fflush(stderr);
+        dup2(saved_stderr, fileno(stderr));
+        close(saved_stderr);
+    }
+
+    OperationStats totals[OP_COUNT];
+    for (Worker *worker : workers) {
+        for (int op = 0; op < OP_COUNT; op++) {
+            totals[op].merge(worker->stats[op]);
+        }
+    }
+
+    bool slo_met = print_report(totals, elapsed_seconds, options);
+    printf("잠금 대기 재시도 합계: %lld회\n", database_get_busy_retry_count() - retries_before);
+
+    int consistency = check_consistency(reporter.db);
+
+    for (Worker *worker : workers) {
+        database_close(worker->db);
+    }
+    std::filesystem::remove(backup_path);
+
+    if (consistency != SUCCESS) {
+        fprintf(stderr, "동시 실행 후 데이터가 일치하지 않습니다.\n");
+        return EXIT_FAILURE;
+    }
+    return slo_met ? EXIT_SUCCESS : 2;
+}
@@ -108,7 +108,7 @@ echo }
 echo 테스트 프로그램을 컴파일합니다...
 
 REM 테스트 프로그램 컴파일
-gcc -o test_build\simple_test.exe test_build\simple_test.c ..\src\database.c ..\src\book.c ..\src\member.c ..\src\loan.c ..\src\utils.c ..\src\external\sqlite\sqlite3.c -I..\include -I..\src\external\sqlite
+gcc -o test_build\simple_test.exe test_build\simple_test.c ..\src\database.c ..\src\book.c ..\src\member.c ..\src\loan.c ..\src\utils.c ..\src\calendar.c ..\src\fine.c ..\src\loan_event.c ..\src\hangul.c ..\src\logger.c ..\src\metrics.c ..\src\metrics_exporter.c ..\src\query_profiler.c ..\src\dataset_generator.c ..\src\workload_trace.c ..\src\workload_replay.c ..\src\book_import.c ..\src\marc.c ..\src\data_export.c ..\src\arrow_ipc.c ..\src\backup.c ..\src\backup_store.c ..\src\crc32c.c ..\src\file_copy.c ..\src\change_log.c ..\src\external\sqlite\sqlite3.c -I..\include -I..\src\external\sqlite -lpthread -lz
 
 if %errorlevel% neq 0 (
     echo 컴파일 실패!
@@ -22,6 +22,26 @@ $SOURCES = @(
     "src/member.c",
     "src/loan.c",
     "src/utils.c",
+    "src/calendar.c",
+    "src/fine.c",
+    "src/loan_event.c",
+    "src/hangul.c",
+    "src/logger.c",
+    "src/metrics.c",
+    "src/metrics_exporter.c",
+    "src/query_profiler.c",
+    "src/dataset_generator.c",
+    "src/workload_trace.c",
+    "src/workload_replay.c",
+    "src/book_import.c",
+    "src/marc.c",
+    "src/data_export.c",
+    "src/arrow_ipc.c",
+    "src/backup.c",
+    "src/backup_store.c",
+    "src/crc32c.c",
+    "src/file_copy.c",
+    "src/change_log.c",
     "src/external/sqlite/sqlite3.c"
 )
 
@@ -173,7 +193,7 @@ Write-Host "간단한 테스트 프로그램을 컴파일합니다..."
 # 테스트 프로그램 컴파일
 $gcc_command = "gcc -o test_build/simple_test.exe test_build/simple_test.c " + 
                ($SOURCES -join " ") + " " +
-               ($INCLUDE_DIRS -join " ")
+               ($INCLUDE_DIRS -join " ") + " -lpthread -lz"
 
 try {
     Invoke-Expression $gcc_command
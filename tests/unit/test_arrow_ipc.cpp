@@ -0,0 +1,359 @@
+/**
+ * @file test_arrow_ipc.cpp
+ * @brief Arrow IPC 파일 쓰기 단위 테스트
+ *
+ * 파일 구조(매직 바이트, 푸터, 블록 위치), 묶음 나누기, NULL 비트맵, 사전 인코딩, timestamp 변환,
+ * 내보내기와 스냅숏 연동을 테스트합니다. 파일은 테스트 안의 작은 FlatBuffers 읽기 함수로 확인합니다.
+ */
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+extern "C" {
+    #include "database.h"
+    #include "data_export.h"
+    #include "arrow_ipc.h"
+    #include "constants.h"
+}
+
+namespace {
+
+// 쓴 파일을 읽어 메시지 위치와 버퍼를 찾는 최소한의 읽기 도구
+struct ArrowFile {
+    std::vector<unsigned char> data;
+
+    uint64_t read(size_t position, int size) const {
+        uint64_t value = 0;
+        for (int i = size - 1; i >= 0; i--) {
+            value = (value << 8) | data.at(position + i);
+        }
+        return value;
+    }
+
+    size_t deref(size_t position) const {
+        return position + (size_t)read(position, 4);
+    }
+
+    // 테이블의 index번째 필드 위치 (없으면 0)
+    size_t field(size_t table, int index) const {
+        size_t vtable = table - (size_t)(int32_t)read(table, 4);
+        size_t vtable_size = read(vtable, 2);
+        if (4 + 2 * (size_t)index >= vtable_size) {
+            return 0;
+        }
+        size_t offset = read(vtable + 4 + 2 * index, 2);
+        return offset ? table + offset : 0;
+    }
+
+    size_t footer() const {
+        size_t length = read(data.size() - 10, 4);
+        size_t start = data.size() - 10 - length;
+        return deref(start);
+    }
+
+    // 푸터 Block 벡터 (index 2: 사전, 3: 레코드 묶음)
+    size_t block_count(int index) const {
+        return read(deref(field(footer(), index)), 4);
+    }
+
+    size_t block(int index, size_t i) const {
+        return deref(field(footer(), index)) + 4 + 24 * i;
+    }
+
+    // 블록의 메시지 header 테이블과 본문 시작 위치
+    size_t header(size_t block_position, int *header_type = nullptr) const {
+        size_t offset = read(block_position, 8);
+        EXPECT_EQ(read(offset, 4), 0xFFFFFFFFu);
+        size_t message = deref(offset + 8);
+        if (header_type) {
+            *header_type = (int)read(field(message, 1), 1);
+        }
+        return deref(field(message, 2));
+    }
+
+    size_t body(size_t block_position) const {
+        return read(block_position, 8) + read(block_position + 8, 4);
+    }
+
+    // RecordBatch의 노드 (length, null_count)와 버퍼 (offset, length)
+    uint64_t node(size_t batch, size_t column, int part) const {
+        return read(deref(field(batch, 1)) + 4 + 16 * column + 8 * part, 8);
+    }
+
+    uint64_t buffer(size_t batch, size_t index, int part) const {
+        return read(deref(field(batch, 2)) + 4 + 16 * index + 8 * part, 8);
+    }
+
+    int64_t value(size_t block_position, size_t batch, size_t buffer_index, size_t row, int size) const {
+        size_t position = body(block_position) + buffer(batch, buffer_index, 0) + row * size;
+        uint64_t raw = read(position, size);
+        return size == 4 ? (int64_t)(int32_t)raw : (int64_t)raw;
+    }
+
+    bool bit(size_t block_position, size_t batch, size_t buffer_index, size_t row) const {
+        size_t position = body(block_position) + buffer(batch, buffer_index, 0) + row / 8;
+        return (data.at(position) >> (row % 8)) & 1;
+    }
+};
+
+}  // namespace
+
+class ArrowIpcTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        test_db_path = "test_arrow_ipc_library.db";
+        output_path = "test_arrow_ipc.arrow";
+        snapshot_directory = "test_arrow_ipc_snapshot";
+        remove_test_files();
+
+        db = database_init(test_db_path);
+        ASSERT_NE(db, nullptr);
+    }
+
+    void TearDown() override {
+        if (db) {
+            database_close(db);
+        }
+        remove_test_files();
+    }
+
+    void remove_test_files() {
+        for (const char *path : { test_db_path, output_path, snapshot_directory }) {
+            if (std::filesystem::exists(path)) {
+                std::filesystem::remove_all(path);
+            }
+        }
+    }
+
+    void execute(const std::string &sql) {
+        char *error = nullptr;
+        ASSERT_EQ(sqlite3_exec(db, sql.c_str(), nullptr, nullptr, &error), SQLITE_OK) << (error ? error : "");
+    }
+
+    // 조회 결과 전체를 writer로 파일에 씀
+    void write_query(const ArrowColumnSpec *columns, int count, int batch_rows, const char *sql,
+                     const std::vector<const char*> &dictionary = {}) {
+        FILE *file = fopen(output_path, "wb");
+        ASSERT_NE(file, nullptr);
+        ArrowWriter writer;
+        ASSERT_EQ(arrow_writer_open(&writer, file, columns, count, batch_rows), SUCCESS);
+        for (int i = 0; i < count; i++) {
+            if (columns[i].type == ARROW_COLUMN_DICTIONARY && !dictionary.empty()) {
+                ASSERT_EQ(arrow_writer_set_dictionary(&writer, i, dictionary.data(), (int)dictionary.size()),
+                          SUCCESS);
+            }
+        }
+
+        sqlite3_stmt *stmt = nullptr;
+        ASSERT_EQ(sqlite3_prepare_v2(db, sql, -1, &stmt, nullptr), SQLITE_OK);
+        while (sqlite3_step(stmt) == SQLITE_ROW) {
+            ASSERT_EQ(arrow_writer_append_row(&writer, stmt), SUCCESS);
+        }
+        sqlite3_finalize(stmt);
+        ASSERT_EQ(arrow_writer_finish(&writer), SUCCESS);
+        arrow_writer_free(&writer);
+        fclose(file);
+    }
+
+    static ArrowFile load(const std::string &path) {
+        std::ifstream file(path, std::ios::binary);
+        ArrowFile arrow;
+        arrow.data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        return arrow;
+    }
+
+    sqlite3 *db = nullptr;
+    const char *test_db_path;
+    const char *output_path;
+    const char *snapshot_directory;
+};
+
+// 앞뒤 매직 바이트와 8바이트 정렬된 블록, 묶음 크기만큼 나뉜 레코드 묶음을 써야 함
+TEST_F(ArrowIpcTest, SplitsRowsIntoAlignedBatches) {
+    const ArrowColumnSpec columns[] = {
+        { "id", ARROW_COLUMN_INT64, FALSE },
+        { "score", ARROW_COLUMN_INT32, TRUE },
+    };
+    write_query(columns, 2, 3,
+                "WITH RECURSIVE n(i) AS (SELECT 1 UNION ALL SELECT i + 1 FROM n WHERE i < 7) "
+                "SELECT i * 1000000000000, CASE WHEN i % 3 = 0 THEN NULL ELSE -i END FROM n;");
+    ArrowFile arrow = load(output_path);
+
+    ASSERT_GT(arrow.data.size(), 16u);
+    EXPECT_EQ(std::memcmp(arrow.data.data(), "ARROW1\0\0", 8), 0);
+    EXPECT_EQ(std::memcmp(arrow.data.data() + arrow.data.size() - 6, "ARROW1", 6), 0);
+    EXPECT_EQ(arrow.block_count(2), 0u);
+    ASSERT_EQ(arrow.block_count(3), 3u);
+
+    const uint64_t expected_lengths[] = { 3, 3, 1 };
+    for (size_t i = 0; i < 3; i++) {
+        size_t block = arrow.block(3, i);
+        EXPECT_EQ(arrow.read(block, 8) % 8, 0u);
+        EXPECT_EQ(arrow.body(block) % 8, 0u);
+        int header_type = 0;
+        size_t batch = arrow.header(block, &header_type);
+        EXPECT_EQ(header_type, 3);
+        EXPECT_EQ(arrow.read(arrow.field(batch, 0), 8), expected_lengths[i]);
+    }
+
+    // 두 번째 묶음: 4, 5, 6행 (6행의 score는 NULL)
+    size_t block = arrow.block(3, 1);
+    size_t batch = arrow.header(block);
+    EXPECT_EQ(arrow.node(batch, 0, 1), 0u);
+    EXPECT_EQ(arrow.buffer(batch, 0, 1), 0u);            // NULL이 없으면 비트맵 생략
+    EXPECT_EQ(arrow.value(block, batch, 1, 0, 8), 4000000000000LL);
+    EXPECT_EQ(arrow.value(block, batch, 1, 2, 8), 6000000000000LL);
+    EXPECT_EQ(arrow.node(batch, 1, 1), 1u);
+    EXPECT_TRUE(arrow.bit(block, batch, 2, 0));
+    EXPECT_TRUE(arrow.bit(block, batch, 2, 1));
+    EXPECT_FALSE(arrow.bit(block, batch, 2, 2));
+    EXPECT_EQ(arrow.value(block, batch, 3, 1, 4), -5);
+}
+
+// 사전 인코딩 열은 정렬된 값의 인덱스로, 사전에 없는 값은 NULL로 써야 함
+TEST_F(ArrowIpcTest, EncodesDictionaryIndices) {
+    const ArrowColumnSpec columns[] = { { "category", ARROW_COLUMN_DICTIONARY, TRUE } };
+    write_query(columns, 1, 0,
+                "SELECT column1 FROM (VALUES ('역사'), (NULL), ('없는 분류'), ('과학'), ('역사'));",
+                { "과학", "문학", "역사" });
+    ArrowFile arrow = load(output_path);
+
+    ASSERT_EQ(arrow.block_count(2), 1u);
+    size_t dictionary_block = arrow.block(2, 0);
+    int header_type = 0;
+    size_t dictionary = arrow.header(dictionary_block, &header_type);
+    EXPECT_EQ(header_type, 2);
+    size_t values = arrow.deref(arrow.field(dictionary, 1));
+    EXPECT_EQ(arrow.read(arrow.field(values, 0), 8), 3u);
+    // 오프셋 [0, 6, 12, 18] 다음에 값이 이어 붙어 있음
+    EXPECT_EQ(arrow.value(dictionary_block, values, 1, 3, 4), 18);
+    size_t text = arrow.body(dictionary_block) + arrow.buffer(values, 2, 0);
+    EXPECT_EQ(std::string(arrow.data.begin() + text, arrow.data.begin() + text + 18), "과학문학역사");
+
+    ASSERT_EQ(arrow.block_count(3), 1u);
+    size_t block = arrow.block(3, 0);
+    size_t batch = arrow.header(block);
+    EXPECT_EQ(arrow.node(batch, 0, 1), 2u);
+    EXPECT_EQ(arrow.value(block, batch, 1, 0, 4), 2);
+    EXPECT_FALSE(arrow.bit(block, batch, 0, 1));
+    EXPECT_FALSE(arrow.bit(block, batch, 0, 2));
+    EXPECT_EQ(arrow.value(block, batch, 1, 3, 4), 0);
+    EXPECT_EQ(arrow.value(block, batch, 1, 4, 4), 2);
+}
+
+// 날짜 문자열은 UTC 초로, 읽을 수 없는 값은 NULL로 쓰고 문자열과 bool은 열 버퍼에 모아야 함
+TEST_F(ArrowIpcTest, ConvertsTimestampsStringsAndBooleans) {
+    const ArrowColumnSpec columns[] = {
+        { "at", ARROW_COLUMN_TIMESTAMP, TRUE },
+        { "name", ARROW_COLUMN_UTF8, TRUE },
+        { "active", ARROW_COLUMN_BOOL, TRUE },
+    };
+    write_query(columns, 3, 0,
+                "SELECT column1, column2, column3 FROM (VALUES "
+                "('1970-01-02 00:00:01', '', 1), ('2025-01-15', '한글', 0), "
+                "('yesterday', NULL, 1), (1700000000, 'abc', NULL));");
+    ArrowFile arrow = load(output_path);
+
+    ASSERT_EQ(arrow.block_count(3), 1u);
+    size_t block = arrow.block(3, 0);
+    size_t batch = arrow.header(block);
+
+    // 버퍼 순서: at(비트맵, 값), name(비트맵, 오프셋, 문자열), active(비트맵, 값)
+    EXPECT_EQ(arrow.node(batch, 0, 1), 1u);
+    EXPECT_EQ(arrow.value(block, batch, 1, 0, 8), 86401);
+    EXPECT_EQ(arrow.value(block, batch, 1, 1, 8), 1736899200);
+    EXPECT_FALSE(arrow.bit(block, batch, 0, 2));
+    EXPECT_EQ(arrow.value(block, batch, 1, 3, 8), 1700000000);
+
+    EXPECT_EQ(arrow.node(batch, 1, 1), 1u);
+    EXPECT_EQ(arrow.value(block, batch, 3, 1, 4), 0);
+    EXPECT_EQ(arrow.value(block, batch, 3, 2, 4), 6);
+    EXPECT_EQ(arrow.value(block, batch, 3, 3, 4), 6);
+    EXPECT_EQ(arrow.value(block, batch, 3, 4, 4), 9);
+    EXPECT_EQ(arrow.buffer(batch, 4, 1), 9u);
+
+    EXPECT_EQ(arrow.node(batch, 2, 1), 1u);
+    EXPECT_TRUE(arrow.bit(block, batch, 6, 0));
+    EXPECT_FALSE(arrow.bit(block, batch, 6, 1));
+    EXPECT_TRUE(arrow.bit(block, batch, 6, 2));
+    EXPECT_FALSE(arrow.bit(block, batch, 5, 3));
+}
+
+// 사전은 첫 행 전에만 지정할 수 있어야 함
+TEST_F(ArrowIpcTest, RejectsLateDictionary) {
+    const ArrowColumnSpec columns[] = {
+        { "id", ARROW_COLUMN_INT64, FALSE },
+        { "category", ARROW_COLUMN_DICTIONARY, TRUE },
+    };
+    FILE *file = fopen(output_path, "wb");
+    ASSERT_NE(file, nullptr);
+    ArrowWriter writer;
+    ASSERT_EQ(arrow_writer_open(&writer, file, columns, 2, 0), SUCCESS);
+    const char *values[] = { "문학" };
+    EXPECT_EQ(arrow_writer_set_dictionary(&writer, 0, values, 1), FAILURE);
+
+    sqlite3_stmt *stmt = nullptr;
+    ASSERT_EQ(sqlite3_prepare_v2(db, "SELECT 1, '문학';", -1, &stmt, nullptr), SQLITE_OK);
+    ASSERT_EQ(sqlite3_step(stmt), SQLITE_ROW);
+    EXPECT_EQ(arrow_writer_append_row(&writer, stmt), SUCCESS);
+    sqlite3_finalize(stmt);
+    EXPECT_EQ(arrow_writer_set_dictionary(&writer, 1, values, 1), FAILURE);
+
+    // 사전 없이 마치면 빈 사전을 쓰고 값은 NULL
+    EXPECT_EQ(arrow_writer_finish(&writer), SUCCESS);
+    arrow_writer_free(&writer);
+    fclose(file);
+    EXPECT_EQ(load(output_path).block_count(2), 1u);
+}
+
+// 도서 내보내기는 분류를 사전으로 모으고, 스냅숏은 세 파일을 모두 써야 함
+TEST_F(ArrowIpcTest, ExportsBooksAndSnapshot) {
+    execute("INSERT INTO books (id, title, author, category, created_at) VALUES "
+            "(1, '토지', '박경리', '문학', '2025-01-01 09:00:00'), "
+            "(2, '코스모스', '칼 세이건', '과학', '2025-01-02 09:00:00'), "
+            "(3, '무제', '작자 미상', NULL, '2025-01-03 09:00:00');");
+    execute("INSERT INTO members (id, name, email) VALUES (1, '홍길동', 'hong@example.com');");
+    execute("INSERT INTO loans (id, book_id, member_id, loan_date, due_date) VALUES "
+            "(1, 1, 1, '2025-01-05 10:00:00', '2025-01-19 10:00:00');");
+
+    DataExportFormat format;
+    ASSERT_EQ(data_export_parse_format("arrow", &format), SUCCESS);
+    DataExportOptions options;
+    memset(&options, 0, sizeof(DataExportOptions));
+    options.entity = DATA_EXPORT_BOOKS;
+    options.format = format;
+    long long rows = 0;
+    ASSERT_EQ(data_export_to_path(db, &options, output_path, &rows), SUCCESS);
+    EXPECT_EQ(rows, 3);
+    EXPECT_TRUE(sqlite3_get_autocommit(db));
+
+    ArrowFile arrow = load(output_path);
+    ASSERT_EQ(arrow.block_count(2), 1u);
+    ASSERT_EQ(arrow.block_count(3), 1u);
+    size_t block = arrow.block(3, 0);
+    size_t batch = arrow.header(block);
+    EXPECT_EQ(arrow.read(arrow.field(batch, 0), 8), 3u);
+    // category는 9번째 열: 앞 열들의 버퍼 2 + 3 * 4 + 2 * 3 = 20개 다음
+    EXPECT_EQ(arrow.node(batch, 8, 1), 1u);
+    EXPECT_EQ(arrow.value(block, batch, 21, 0, 4), 1);
+    EXPECT_EQ(arrow.value(block, batch, 21, 1, 4), 0);
+
+    rows = 0;
+    ASSERT_EQ(data_export_snapshot(db, DATA_EXPORT_ARROW, snapshot_directory, &rows), SUCCESS);
+    EXPECT_EQ(rows, 5);
+    for (const char *name : { "books.arrow", "members.arrow", "loans.arrow" }) {
+        ArrowFile file = load(std::string(snapshot_directory) + "/" + name);
+        ASSERT_GT(file.data.size(), 16u) << name;
+        EXPECT_EQ(std::memcmp(file.data.data(), "ARROW1\0\0", 8), 0) << name;
+    }
+    EXPECT_EQ(load(std::string(snapshot_directory) + "/loans.arrow").block_count(3), 1u);
+
+    ASSERT_EQ(data_export_snapshot(db, DATA_EXPORT_CSV, snapshot_directory, &rows), SUCCESS);
+    EXPECT_TRUE(std::filesystem::exists(std::string(snapshot_directory) + "/members.csv"));
+}
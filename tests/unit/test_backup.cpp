@@ -0,0 +1,295 @@
+/**
+ * @file test_backup.cpp
+ * @brief 온라인 백업 단위 테스트
+ *
+ * 단계별 복사와 진행 상황, 복사 중 다른 연결과 같은 연결의 쓰기, 취소 시 임시 파일 정리,
+ * 백그라운드 작업의 진행 조회와 취소, 페이지별 체크섬 목록을 이용한 백업 검사를 테스트합니다.
+ */
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <functional>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+extern "C" {
+    #include "database.h"
+    #include "backup.h"
+    #include "constants.h"
+}
+
+class BackupTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        test_db_path = "test_backup_library.db";
+        backup_path = "test_backup_copy.db";
+        partial_path = std::string(backup_path) + BACKUP_PARTIAL_SUFFIX;
+        checksum_path = std::string(backup_path) + BACKUP_CHECKSUM_SUFFIX;
+        remove_test_files();
+
+        db = database_init(test_db_path);
+        ASSERT_NE(db, nullptr);
+
+        // 수백 페이지가 되도록 도서를 채움
+        execute("WITH RECURSIVE n(i) AS (SELECT 1 UNION ALL SELECT i + 1 FROM n WHERE i < 3000) "
+                "INSERT INTO books (title, author) SELECT printf('%s %d', hex(randomblob(100)), i), 'author' FROM n;");
+
+        backup_default_config(&config);
+        config.pages_per_step = 16;
+        config.sleep_ms = 0;
+    }
+
+    void TearDown() override {
+        backup_job_cancel();
+        backup_job_wait(nullptr);
+        if (db) {
+            database_close(db);
+        }
+        remove_test_files();
+    }
+
+    void remove_test_files() {
+        for (const std::string &path : { std::string(test_db_path), std::string(backup_path), partial_path,
+                                         checksum_path }) {
+            for (const char *suffix : { "", "-journal" }) {
+                if (std::filesystem::exists(path + suffix)) {
+                    std::filesystem::remove(path + suffix);
+                }
+            }
+        }
+    }
+
+    void execute(const std::string &sql, sqlite3 *connection = nullptr) {
+        char *error = nullptr;
+        ASSERT_EQ(sqlite3_exec(connection ? connection : db, sql.c_str(), nullptr, nullptr, &error), SQLITE_OK)
+            << (error ? error : "");
+    }
+
+    static long long count_books(const char *path) {
+        sqlite3 *copy = nullptr;
+        sqlite3_stmt *stmt = nullptr;
+        long long count = -1;
+        if (sqlite3_open_v2(path, &copy, SQLITE_OPEN_READONLY, nullptr) == SQLITE_OK &&
+            sqlite3_prepare_v2(copy, "SELECT COUNT(*) FROM books;", -1, &stmt, nullptr) == SQLITE_OK &&
+            sqlite3_step(stmt) == SQLITE_ROW) {
+            count = sqlite3_column_int64(stmt, 0);
+        }
+        sqlite3_finalize(stmt);
+        sqlite3_close(copy);
+        return count;
+    }
+
+    sqlite3 *db = nullptr;
+    const char *test_db_path;
+    const char *backup_path;
+    std::string partial_path;
+    std::string checksum_path;
+    BackupConfig config;
+};
+
+namespace {
+
+struct StepRecorder {
+    int calls = 0;
+    int last_copied = 0;
+    bool monotonic = true;
+    bool saw_partial = false;
+    std::string partial_path;
+    int cancel_at = 0;                          // 이 번째 호출에서 취소 (0이면 안 함)
+    std::function<void(int)> on_step;           // 단계 사이에 할 일
+};
+
+int record_step(const BackupProgress *progress, void *user_data) {
+    StepRecorder *recorder = static_cast<StepRecorder*>(user_data);
+    if (progress->state != BACKUP_STATE_RUNNING) {
+        return TRUE;
+    }
+    recorder->calls++;
+    int copied = progress->page_count - progress->remaining;
+    recorder->monotonic = recorder->monotonic && copied >= recorder->last_copied;
+    recorder->last_copied = copied;
+    recorder->saw_partial = recorder->saw_partial || std::filesystem::exists(recorder->partial_path);
+    if (recorder->on_step) {
+        recorder->on_step(recorder->calls);
+    }
+    return recorder->cancel_at == 0 || recorder->calls < recorder->cancel_at;
+}
+
+}  // namespace
+
+// 여러 단계로 나누어 복사하고 진행 상황을 보고한 뒤 임시 파일 이름을 바꿔야 함
+TEST_F(BackupTest, CopiesInStepsWithProgress) {
+    StepRecorder recorder;
+    recorder.partial_path = partial_path;
+    BackupProgress progress;
+    ASSERT_EQ(backup_database_online(db, backup_path, &config, record_step, &recorder, &progress), SUCCESS);
+
+    EXPECT_EQ(progress.state, BACKUP_STATE_DONE);
+    EXPECT_GT(progress.page_count, config.pages_per_step * 4);
+    EXPECT_EQ(progress.remaining, 0);
+    EXPECT_EQ(progress.steps, (progress.page_count + config.pages_per_step - 1) / config.pages_per_step);
+    EXPECT_EQ(recorder.calls, progress.steps - 1);
+    EXPECT_TRUE(recorder.monotonic);
+    EXPECT_TRUE(recorder.saw_partial);
+    EXPECT_FALSE(std::filesystem::exists(partial_path));
+    EXPECT_EQ(count_books(backup_path), 3000);
+}
+
+// 단계 사이에는 잠금을 풀어 다른 연결이 쓸 수 있고, 바뀐 원본은 다시 복사해 반영해야 함
+TEST_F(BackupTest, AllowsOtherWritersBetweenSteps) {
+    sqlite3 *writer = nullptr;
+    ASSERT_EQ(sqlite3_open(test_db_path, &writer), SQLITE_OK);
+    sqlite3_busy_timeout(writer, 0);
+
+    int write_result = SQLITE_ERROR;
+    StepRecorder recorder;
+    recorder.on_step = [&](int call) {
+        if (call == 3) {
+            write_result = sqlite3_exec(writer, "INSERT INTO books (title, author) VALUES ('다른 연결', 'x');",
+                                        nullptr, nullptr, nullptr);
+        }
+    };
+
+    BackupProgress progress;
+    ASSERT_EQ(backup_database_online(db, backup_path, &config, record_step, &recorder, &progress), SUCCESS);
+    sqlite3_close(writer);
+
+    EXPECT_EQ(write_result, SQLITE_OK);
+    EXPECT_GE(progress.restarts, 1);
+    EXPECT_EQ(count_books(backup_path), 3001);
+}
+
+// 같은 연결에서 쓴 내용은 다시 시작하지 않고 백업에 반영되어야 함
+TEST_F(BackupTest, IncludesWritesFromSameConnection) {
+    StepRecorder recorder;
+    recorder.on_step = [&](int call) {
+        if (call == 2) {
+            execute("INSERT INTO books (title, author) VALUES ('같은 연결', 'x');");
+        }
+    };
+
+    BackupProgress progress;
+    ASSERT_EQ(backup_database_online(db, backup_path, &config, record_step, &recorder, &progress), SUCCESS);
+    EXPECT_EQ(progress.restarts, 0);
+    EXPECT_EQ(count_books(backup_path), 3001);
+}
+
+// 취소하면 실패를 반환하고 임시 파일과 백업 파일을 남기지 않아야 함
+TEST_F(BackupTest, CancelRemovesPartialCopy) {
+    StepRecorder recorder;
+    recorder.cancel_at = 2;
+    BackupProgress progress;
+    EXPECT_EQ(backup_database_online(db, backup_path, &config, record_step, &recorder, &progress), FAILURE);
+    EXPECT_EQ(progress.state, BACKUP_STATE_CANCELLED);
+    EXPECT_GT(progress.remaining, 0);
+    EXPECT_FALSE(std::filesystem::exists(partial_path));
+    EXPECT_FALSE(std::filesystem::exists(backup_path));
+
+    EXPECT_EQ(backup_database_online(db, "no_such_directory/copy.db", &config, nullptr, nullptr, &progress),
+              FAILURE);
+    EXPECT_EQ(progress.state, BACKUP_STATE_FAILED);
+}
+
+// 백그라운드 작업은 진행 상황을 보여 주고 취소하거나 끝까지 기다릴 수 있어야 함
+TEST_F(BackupTest, RunsAsBackgroundJob) {
+    BackupConfig slow = config;
+    slow.pages_per_step = 4;
+    slow.sleep_ms = 20;
+    ASSERT_EQ(backup_job_start(db, backup_path, &slow), SUCCESS);
+    EXPECT_EQ(backup_job_start(db, backup_path, &slow), FAILURE);
+
+    BackupProgress progress;
+    backup_job_get_progress(&progress);
+    EXPECT_EQ(progress.state, BACKUP_STATE_RUNNING);
+    EXPECT_EQ(std::string(progress.backup_path), backup_path);
+
+    // 백업 중에도 같은 연결로 계속 쓸 수 있음
+    execute("INSERT INTO books (title, author) VALUES ('백업 중', 'x');");
+    backup_job_cancel();
+    EXPECT_EQ(backup_job_wait(&progress), FAILURE);
+    EXPECT_EQ(progress.state, BACKUP_STATE_CANCELLED);
+    EXPECT_FALSE(std::filesystem::exists(partial_path));
+
+    ASSERT_EQ(backup_job_start(db, backup_path, &config), SUCCESS);
+    EXPECT_EQ(backup_job_wait(&progress), SUCCESS);
+    EXPECT_EQ(progress.state, BACKUP_STATE_DONE);
+    EXPECT_EQ(progress.remaining, 0);
+    EXPECT_EQ(count_books(backup_path), 3001);
+}
+
+namespace {
+
+// 파일의 offset 위치 바이트를 뒤집음
+void flip_byte(const std::string &path, long offset) {
+    std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+    ASSERT_TRUE(file.is_open());
+    file.seekg(offset);
+    char value = 0;
+    file.get(value);
+    file.seekp(offset);
+    file.put(static_cast<char>(~value));
+}
+
+}  // namespace
+
+// 백업마다 체크섬 목록을 만들고, 그대로인 백업은 검사와 quick_check를 통과해야 함
+TEST_F(BackupTest, VerifiesBackupAgainstChecksums) {
+    BackupProgress progress;
+    ASSERT_EQ(backup_database_online(db, backup_path, &config, nullptr, nullptr, &progress), SUCCESS);
+    ASSERT_TRUE(std::filesystem::exists(checksum_path));
+
+    BackupVerifyResult result;
+    ASSERT_EQ(backup_verify(backup_path, TRUE, &result), SUCCESS);
+    EXPECT_EQ(result.page_count, progress.page_count);
+    EXPECT_EQ(result.bad_pages, 0);
+    EXPECT_EQ(result.first_bad_page, 0);
+    EXPECT_EQ(result.quick_check, TRUE);
+    EXPECT_EQ(result.bytes, static_cast<long long>(std::filesystem::file_size(backup_path)));
+
+    ASSERT_EQ(backup_verify(backup_path, FALSE, &result), SUCCESS);
+    EXPECT_EQ(result.quick_check, -1);
+}
+
+// 바뀐 페이지나 잘린 파일은 그 페이지 번호와 함께 검사에 실패하고, 복원도 거부되어야 함
+TEST_F(BackupTest, DetectsCorruptAndTruncatedPages) {
+    // database_backup()도 체크섬 목록을 함께 만듦
+    ASSERT_EQ(database_backup(db, backup_path), SUCCESS);
+    ASSERT_TRUE(std::filesystem::exists(checksum_path));
+    BackupVerifyResult result;
+    ASSERT_EQ(backup_verify(backup_path, FALSE, &result), SUCCESS);
+    int page_size = result.page_size;
+    int page_count = result.page_count;
+
+    flip_byte(backup_path, static_cast<long>(page_size) * 4 + 123);
+    EXPECT_EQ(backup_verify(backup_path, FALSE, &result), FAILURE);
+    EXPECT_EQ(result.bad_pages, 1);
+    EXPECT_EQ(result.first_bad_page, 5);
+    EXPECT_EQ(database_restore(db, backup_path), FAILURE);
+    EXPECT_EQ(count_books(test_db_path), 3000);
+
+    flip_byte(backup_path, static_cast<long>(page_size) * 4 + 123);
+    std::filesystem::resize_file(backup_path, static_cast<std::uintmax_t>(page_size) * (page_count - 2));
+    EXPECT_EQ(backup_verify(backup_path, FALSE, &result), FAILURE);
+    EXPECT_EQ(result.bad_pages, 2);
+    EXPECT_EQ(result.first_bad_page, page_count - 1);
+
+    // 체크섬 목록이 없으면 검사할 수 없음
+    std::filesystem::remove(checksum_path);
+    EXPECT_EQ(backup_verify(backup_path, FALSE, &result), FAILURE);
+}
+
+// 체크섬은 맞지만 내용이 잘못된 데이터베이스는 quick_check에서 걸러야 함
+TEST_F(BackupTest, QuickCheckCatchesInconsistentCopy) {
+    ASSERT_EQ(database_backup(db, backup_path), SUCCESS);
+    BackupVerifyResult result;
+    ASSERT_EQ(backup_verify(backup_path, FALSE, &result), SUCCESS);
+
+    // 마지막 페이지를 망가뜨린 뒤 체크섬 목록을 다시 만들어 체크섬 검사는 통과하게 함
+    flip_byte(backup_path, static_cast<long>(result.page_size) * (result.page_count - 1) + 8);
+    ASSERT_EQ(backup_write_checksums(backup_path), SUCCESS);
+    EXPECT_EQ(backup_verify(backup_path, FALSE, &result), SUCCESS);
+    EXPECT_EQ(backup_verify(backup_path, TRUE, &result), FAILURE);
+    EXPECT_EQ(result.bad_pages, 0);
+    EXPECT_EQ(result.quick_check, FALSE);
+}
@@ -0,0 +1,212 @@
+/**
+ * @file test_backup_store.cpp
+ * @brief 중복 제거 백업 저장소 단위 테스트
+ *
+ * 조각 해시, 백업과 복원의 왕복, 바뀐 조각만 새로 저장하는지, 가비지 수집,
+ * 손상된 조각과 잘못된 이름의 처리를 테스트합니다.
+ */
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+extern "C" {
+    #include "database.h"
+    #include "backup_store.h"
+    #include "constants.h"
+}
+
+class BackupStoreTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        test_db_path = "test_backup_store_library.db";
+        repository = "test_backup_store_repo";
+        restore_path = "test_backup_store_restored.db";
+        remove_test_files();
+
+        db = database_init(test_db_path);
+        ASSERT_NE(db, nullptr);
+
+        // 조각 여러 개가 되도록 도서를 채움 (실행마다 페이지 배치가 같도록 고정된 제목)
+        execute("WITH RECURSIVE n(i) AS (SELECT 1 UNION ALL SELECT i + 1 FROM n WHERE i < 3000) "
+                "INSERT INTO books (title, author) SELECT printf('%0200d %d', i * 7919, i), 'author' FROM n;");
+    }
+
+    void TearDown() override {
+        if (db) {
+            database_close(db);
+        }
+        remove_test_files();
+    }
+
+    void remove_test_files() {
+        std::filesystem::remove_all(repository);
+        for (const char *path : { test_db_path, restore_path }) {
+            for (const char *suffix : { "", "-journal" }) {
+                std::filesystem::remove(std::string(path) + suffix);
+            }
+        }
+    }
+
+    void execute(const std::string &sql) {
+        char *error = nullptr;
+        ASSERT_EQ(sqlite3_exec(db, sql.c_str(), nullptr, nullptr, &error), SQLITE_OK) << (error ? error : "");
+    }
+
+    static std::vector<char> read_file(const std::string &path) {
+        std::ifstream file(path, std::ios::binary);
+        return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    static std::string hex(const unsigned char *hash) {
+        static const char digits[] = "0123456789abcdef";
+        std::string text;
+        for (int i = 0; i < BACKUP_STORE_HASH_SIZE; i++) {
+            text += digits[hash[i] >> 4];
+            text += digits[hash[i] & 0x0f];
+        }
+        return text;
+    }
+
+    size_t count_chunk_files() const {
+        size_t count = 0;
+        for (const auto &entry : std::filesystem::recursive_directory_iterator(std::string(repository) + "/chunks")) {
+            count += entry.is_regular_file() ? 1 : 0;
+        }
+        return count;
+    }
+
+    sqlite3 *db = nullptr;
+    const char *test_db_path;
+    const char *repository;
+    const char *restore_path;
+};
+
+// 참조 구현과 같은 MurmurHash3 x64-128 값을 내야 함 (꼬리 처리 포함)
+TEST_F(BackupStoreTest, HashMatchesReferenceVectors) {
+    unsigned char hash[BACKUP_STORE_HASH_SIZE];
+
+    backup_store_hash("", 0, hash);
+    EXPECT_EQ(hex(hash), "00000000000000000000000000000000");
+    backup_store_hash("hello", 5, hash);
+    EXPECT_EQ(hex(hash), "029bbd41b3a7d8cb191dae486a901e5b");
+
+    const char *fox = "The quick brown fox jumps over the lazy dog";
+    backup_store_hash(fox, strlen(fox), hash);
+    EXPECT_EQ(hex(hash), "6c1b07bc7bbc4be347939ac4a93c437a");
+
+    std::vector<unsigned char> bytes;
+    for (int repeat = 0; repeat < 3; repeat++) {
+        for (int i = 0; i < 256; i++) {
+            bytes.push_back(static_cast<unsigned char>(i));
+        }
+    }
+    bytes.insert(bytes.end(), { 'a', 'b', 'c' });
+    backup_store_hash(bytes.data(), bytes.size(), hash);
+    EXPECT_EQ(hex(hash), "f9aaf4715940241f43a5baedf5d94c95");
+}
+
+// 백업을 복원하면 원본 파일과 바이트 단위로 같아야 함
+TEST_F(BackupStoreTest, RestoreReproducesDatabase) {
+    BackupStoreStats stats;
+    ASSERT_EQ(backup_store_create(db, repository, "first", &stats), SUCCESS);
+    EXPECT_GT(stats.chunks, 1);
+    EXPECT_EQ(stats.bytes, static_cast<long long>(std::filesystem::file_size(test_db_path)));
+    EXPECT_EQ(static_cast<size_t>(stats.new_chunks), count_chunk_files());
+
+    BackupManifest manifest;
+    ASSERT_EQ(backup_manifest_load(repository, "first", &manifest), SUCCESS);
+    EXPECT_EQ(manifest.chunk_count, stats.chunks);
+    EXPECT_EQ(manifest.file_size, stats.bytes);
+    EXPECT_EQ(manifest.chunk_size % manifest.page_size, 0);
+    backup_manifest_free(&manifest);
+
+    ASSERT_EQ(backup_store_restore(repository, "first", restore_path, &stats), SUCCESS);
+    EXPECT_EQ(read_file(restore_path), read_file(test_db_path));
+    EXPECT_FALSE(std::filesystem::exists(std::string(restore_path) + BACKUP_PARTIAL_SUFFIX));
+
+    // 같은 이름으로는 다시 만들 수 없음
+    EXPECT_EQ(backup_store_create(db, repository, "first", nullptr), FAILURE);
+}
+
+// 몇 행만 바꾼 뒤의 백업은 바뀐 조각만 새로 저장해야 함
+TEST_F(BackupStoreTest, SecondBackupStoresOnlyChangedChunks) {
+    BackupStoreStats first;
+    ASSERT_EQ(backup_store_create(db, repository, "day1", &first), SUCCESS);
+
+    execute("UPDATE books SET author = 'changed' WHERE id = 1500;");
+
+    BackupStoreStats second;
+    ASSERT_EQ(backup_store_create(db, repository, "day2", &second), SUCCESS);
+    EXPECT_EQ(second.chunks, first.chunks);
+    EXPECT_GE(second.new_chunks, 1);
+    EXPECT_LE(second.new_chunks * 4, second.chunks);
+    EXPECT_EQ(count_chunk_files(), static_cast<size_t>(first.new_chunks + second.new_chunks));
+
+    char **names = nullptr;
+    int count = 0;
+    ASSERT_EQ(backup_store_list(repository, &names, &count), SUCCESS);
+    ASSERT_EQ(count, 2);
+    EXPECT_STREQ(names[0], "day1");
+    EXPECT_STREQ(names[1], "day2");
+    for (int i = 0; i < count; i++) {
+        free(names[i]);
+    }
+    free(names);
+
+    ASSERT_EQ(backup_store_restore(repository, "day2", restore_path, nullptr), SUCCESS);
+    EXPECT_EQ(read_file(restore_path), read_file(test_db_path));
+}
+
+// 백업을 지우고 가비지 수집하면 그 백업만 쓰던 조각만 지워져야 함
+TEST_F(BackupStoreTest, GarbageCollectionKeepsSharedChunks) {
+    ASSERT_EQ(backup_store_create(db, repository, "day1", nullptr), SUCCESS);
+    std::vector<char> day1 = read_file(test_db_path);
+    execute("UPDATE books SET author = 'changed' WHERE id = 10;");
+    BackupStoreStats second;
+    ASSERT_EQ(backup_store_create(db, repository, "day2", &second), SUCCESS);
+    size_t before = count_chunk_files();
+
+    ASSERT_EQ(backup_store_delete(repository, "day2"), SUCCESS);
+    EXPECT_EQ(backup_store_delete(repository, "day2"), FAILURE);
+
+    BackupStoreStats gc;
+    ASSERT_EQ(backup_store_gc(repository, &gc), SUCCESS);
+    EXPECT_EQ(gc.new_chunks, second.new_chunks);
+    EXPECT_EQ(count_chunk_files(), before - static_cast<size_t>(second.new_chunks));
+    EXPECT_EQ(static_cast<size_t>(gc.chunks), count_chunk_files());
+
+    // 남은 백업은 여전히 복원할 수 있음
+    ASSERT_EQ(backup_store_restore(repository, "day1", restore_path, nullptr), SUCCESS);
+    EXPECT_EQ(read_file(restore_path), day1);
+}
+
+// 손상된 조각은 복원을 실패시키고, 경로를 벗어나는 이름은 거부해야 함
+TEST_F(BackupStoreTest, RejectsCorruptChunksAndInvalidNames) {
+    ASSERT_EQ(backup_store_create(db, repository, "good", nullptr), SUCCESS);
+
+    BackupManifest manifest;
+    ASSERT_EQ(backup_manifest_load(repository, "good", &manifest), SUCCESS);
+    std::string digest = hex(manifest.chunks[0].hash);
+    backup_manifest_free(&manifest);
+
+    std::string chunk = std::string(repository) + "/chunks/" + digest.substr(0, 2) + "/" + digest;
+    {
+        std::fstream file(chunk, std::ios::binary | std::ios::in | std::ios::out);
+        ASSERT_TRUE(file.is_open());
+        file.seekp(100);
+        file.put('\x7f');
+    }
+    EXPECT_EQ(backup_store_restore(repository, "good", restore_path, nullptr), FAILURE);
+    EXPECT_FALSE(std::filesystem::exists(restore_path));
+    EXPECT_FALSE(std::filesystem::exists(std::string(restore_path) + BACKUP_PARTIAL_SUFFIX));
+
+    for (const char *name : { "../escape", ".hidden", "a/b", "공백 이름" }) {
+        EXPECT_EQ(backup_store_create(db, repository, name, nullptr), FAILURE) << name;
+        EXPECT_EQ(backup_store_restore(repository, name, restore_path, nullptr), FAILURE) << name;
+    }
+}
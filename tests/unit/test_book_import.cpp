@@ -0,0 +1,276 @@
+/**
+ * @file test_book_import.cpp
+ * @brief 도서 일괄 가져오기 단위 테스트
+ *
+ * CSV/TSV 파싱, 행 거부와 거부 파일, ISBN 중복 확인, 파일 순서 보존, 체크포인트 재개를 테스트합니다.
+ */
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+extern "C" {
+    #include "database.h"
+    #include "book.h"
+    #include "book_import.h"
+    #include "constants.h"
+}
+
+class BookImportTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        test_db_path = "test_book_import_library.db";
+        csv_path = "test_book_import.csv";
+        tsv_path = "test_book_import.tsv";
+        reject_path = "test_book_import.rejects";
+        remove_test_files();
+
+        db = database_init(test_db_path);
+        ASSERT_NE(db, nullptr);
+
+        book_import_default_config(&config);
+        config.worker_threads = 3;
+        config.batch_rows = 4;
+        config.commit_rows = 8;
+    }
+
+    void TearDown() override {
+        if (db) {
+            database_close(db);
+        }
+        remove_test_files();
+    }
+
+    void remove_test_files() {
+        for (const char *path : { test_db_path, csv_path, tsv_path, reject_path }) {
+            if (std::filesystem::exists(path)) {
+                std::filesystem::remove(path);
+            }
+        }
+    }
+
+    static void write_file(const char *path, const std::string &content) {
+        std::ofstream file(path, std::ios::binary);
+        file << content;
+    }
+
+    static std::string read_file(const char *path) {
+        std::ifstream file(path, std::ios::binary);
+        std::stringstream content;
+        content << file.rdbuf();
+        return content.str();
+    }
+
+    long long query_int(const char *sql) {
+        sqlite3_stmt *stmt = nullptr;
+        long long value = -1;
+        if (sqlite3_prepare_v2(db, sql, -1, &stmt, nullptr) == SQLITE_OK && sqlite3_step(stmt) == SQLITE_ROW) {
+            value = sqlite3_column_int64(stmt, 0);
+        }
+        sqlite3_finalize(stmt);
+        return value;
+    }
+
+    sqlite3 *db = nullptr;
+    const char *test_db_path;
+    const char *csv_path;
+    const char *tsv_path;
+    const char *reject_path;
+    BookImportConfig config;
+};
+
+// 따옴표 필드, 한국어 머리글, BOM, CRLF를 처리하고 빠진 열은 기본값으로 채워야 함
+TEST_F(BookImportTest, ImportsQuotedCsv) {
+    write_file(csv_path,
+               "\xEF\xBB\xBF제목,저자,ISBN,보유권수,출판년도,메모\r\n"
+               "\"토지, 1부\",박경리,978-89-7012-001-3,3,1994,\"여러 줄\n메모\"\r\n"
+               "\"\"\"따옴표\"\" 제목\",저자,,,,\r\n"
+               "\r\n");
+
+    BookImportStats stats;
+    ASSERT_EQ(book_import_file(db, csv_path, &config, &stats), SUCCESS);
+    EXPECT_EQ(stats.rows, 2);
+    EXPECT_EQ(stats.imported, 2);
+    EXPECT_EQ(stats.rejected, 0);
+
+    Book book;
+    ASSERT_EQ(get_book_by_isbn(db, "978-89-7012-001-3", &book), SUCCESS);
+    EXPECT_STREQ(book.title, "토지, 1부");
+    EXPECT_STREQ(book.author, "박경리");
+    EXPECT_EQ(book.total_copies, 3);
+    EXPECT_EQ(book.available_copies, 3);
+    EXPECT_EQ(book.publication_year, 1994);
+
+    EXPECT_EQ(query_int("SELECT COUNT(*) FROM books WHERE title = '\"따옴표\" 제목' "
+                        "AND isbn IS NULL AND total_copies = 1 AND available_copies = 1;"), 1);
+
+    // 검색 컬럼도 add_book과 같이 채워져야 함
+    BookSearchResult result;
+    init_book_search_result(&result);
+    ASSERT_EQ(search_books_by_title(db, "토지", &result), SUCCESS);
+    EXPECT_EQ(result.count, 1);
+    free_book_search_result(&result);
+}
+
+// 잘못된 행은 사유와 함께 거부 파일에 남기고 나머지는 넣어야 함
+TEST_F(BookImportTest, WritesRejectedRows) {
+    write_file(csv_path,
+               "title,author,isbn,total_copies,available_copies\n"
+               "정상 도서,저자,9788966260959,2,1\n"
+               ",저자 없음 제목,,1,1\n"
+               "잘못된 ISBN,저자,12-34,1,1\n"
+               "권수 오류,저자,,two,1\n"
+               "대출 가능 초과,저자,,1,5\n"
+               "열 부족,저자\n"
+               "\"닫히지 않음,저자,,1,1\n");
+    snprintf(config.reject_path, sizeof(config.reject_path), "%s", reject_path);
+
+    BookImportStats stats;
+    ASSERT_EQ(book_import_file(db, csv_path, &config, &stats), SUCCESS);
+    EXPECT_EQ(stats.rows, 7);
+    EXPECT_EQ(stats.imported, 1);
+    EXPECT_EQ(stats.rejected, 6);
+    EXPECT_EQ(query_int("SELECT COUNT(*) FROM books;"), 1);
+
+    std::string rejects = read_file(reject_path);
+    EXPECT_EQ(rejects.rfind("title,author,isbn,total_copies,available_copies,source_line,reject_reason\n", 0), 0u);
+    EXPECT_NE(rejects.find("잘못된 ISBN,저자,12-34,1,1,4,\"ISBN 형식이 올바르지 않습니다\""), std::string::npos);
+    EXPECT_NE(rejects.find("권수 오류,저자,,two,1,5,"), std::string::npos);
+    EXPECT_NE(rejects.find("열 부족,저자,7,\"열 수가 머리글과 다릅니다\""), std::string::npos);
+    EXPECT_NE(rejects.find("따옴표 형식이 올바르지 않습니다"), std::string::npos);
+    EXPECT_EQ(rejects.find("정상 도서"), std::string::npos);
+}
+
+// 기존 도서, 앞 행, 같은 책의 ISBN-10 표기와 겹치면 중복으로 거부해야 함
+TEST_F(BookImportTest, RejectsDuplicateIsbns) {
+    Book existing;
+    memset(&existing, 0, sizeof(Book));
+    strncpy(existing.title, "기존 도서", sizeof(existing.title) - 1);
+    strncpy(existing.author, "저자", sizeof(existing.author) - 1);
+    strncpy(existing.isbn, "9788966260959", sizeof(existing.isbn) - 1);
+    existing.total_copies = 1;
+    existing.available_copies = 1;
+    ASSERT_GT(add_book(db, &existing), 0);
+
+    write_file(csv_path,
+               "title,author,isbn\n"
+               "기존과 중복,저자,978-89-6626-095-9\n"
+               "새 도서,저자,9780306406157\n"
+               "앞 행과 중복,저자,9780306406157\n"
+               "ISBN-10 표기,저자,0306406152\n"
+               "ISBN 없음 1,저자,\n"
+               "ISBN 없음 2,저자,\n");
+
+    BookImportStats stats;
+    ASSERT_EQ(book_import_file(db, csv_path, &config, &stats), SUCCESS);
+    EXPECT_EQ(stats.imported, 3);
+    EXPECT_EQ(stats.duplicates, 3);
+    EXPECT_EQ(stats.rejected, 0);
+    EXPECT_EQ(query_int("SELECT COUNT(*) FROM books;"), 4);
+}
+
+// ISBN이 없어 NULL로 저장된 도서도 다시 읽을 수 있어야 함
+TEST_F(BookImportTest, ReadsBackBookWithoutIsbn) {
+    write_file(csv_path,
+               "title,author,isbn\n"
+               "No ISBN Book,Some Author,\n");
+
+    BookImportStats stats;
+    ASSERT_EQ(book_import_file(db, csv_path, &config, &stats), SUCCESS);
+    ASSERT_EQ(stats.imported, 1);
+
+    Book book;
+    ASSERT_EQ(get_book_by_id(db, 1, &book), SUCCESS);
+    EXPECT_STREQ(book.title, "No ISBN Book");
+    EXPECT_STREQ(book.author, "Some Author");
+    EXPECT_STREQ(book.isbn, "");
+    EXPECT_STREQ(book.publisher, "");
+    EXPECT_STREQ(book.category, "");
+}
+
+// 여러 스레드가 파싱해도 파일 순서대로 들어가야 함
+TEST_F(BookImportTest, PreservesFileOrderAcrossWorkers) {
+    std::string content = "title\tauthor\tisbn\tcategory\n";
+    for (int i = 0; i < 2000; i++) {
+        char isbn[16];
+        snprintf(isbn, sizeof(isbn), "979%010d", i);
+        content += "도서 " + std::to_string(i) + "\t저자\t" + isbn + "\t소설\n";
+    }
+    write_file(tsv_path, content);
+    config.worker_threads = 4;
+    config.batch_rows = 50;
+    config.commit_rows = 300;
+    config.show_progress = FALSE;
+
+    BookImportStats stats;
+    ASSERT_EQ(book_import_file(db, tsv_path, &config, &stats), SUCCESS);
+    EXPECT_EQ(stats.imported, 2000);
+
+    sqlite3_stmt *stmt = nullptr;
+    ASSERT_EQ(sqlite3_prepare_v2(db, "SELECT title FROM books ORDER BY id;", -1, &stmt, nullptr), SQLITE_OK);
+    int index = 0;
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+        std::string expected = "도서 " + std::to_string(index++);
+        ASSERT_STREQ(reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0)), expected.c_str());
+    }
+    sqlite3_finalize(stmt);
+    EXPECT_EQ(index, 2000);
+    EXPECT_EQ(query_int("SELECT completed FROM book_import_checkpoints;"), 1);
+}
+
+// 체크포인트가 있으면 커밋된 다음 행부터 이어서 가져와야 함
+TEST_F(BookImportTest, ResumesFromCheckpoint) {
+    std::string header = "title,author\n";
+    std::string first_half;
+    std::string second_half;
+    for (int i = 0; i < 5; i++) {
+        first_half += "앞 도서 " + std::to_string(i) + ",저자\n";
+        second_half += "뒤 도서 " + std::to_string(i) + ",저자\n";
+    }
+    write_file(csv_path, header + first_half + second_half);
+
+    BookImportStats stats;
+    ASSERT_EQ(book_import_file(db, csv_path, &config, &stats), SUCCESS);
+    EXPECT_EQ(stats.imported, 10);
+
+    // 다시 실행하면 아무것도 넣지 않음
+    ASSERT_EQ(book_import_file(db, csv_path, &config, &stats), SUCCESS);
+    EXPECT_EQ(stats.imported, 0);
+    EXPECT_EQ(stats.resumed_lines, 11);
+
+    // 앞 절반만 커밋하고 멈춘 상태를 만듦
+    std::string sql = "UPDATE book_import_checkpoints SET completed = 0, line_number = 6, byte_offset = " +
+                      std::to_string(header.size() + first_half.size()) + ";";
+    ASSERT_EQ(database_execute_query(db, sql.c_str()), SUCCESS);
+    ASSERT_EQ(database_execute_query(db, "DELETE FROM books WHERE title LIKE '뒤 도서%';"), SUCCESS);
+
+    snprintf(config.reject_path, sizeof(config.reject_path), "%s", reject_path);
+    ASSERT_EQ(book_import_file(db, csv_path, &config, &stats), SUCCESS);
+    EXPECT_EQ(stats.resumed_lines, 6);
+    EXPECT_EQ(stats.rows, 5);
+    EXPECT_EQ(stats.imported, 5);
+    EXPECT_EQ(query_int("SELECT COUNT(*) FROM books;"), 10);
+
+    // 재개하지 않으면 처음부터 다시 읽음 (ISBN이 없으므로 모두 새 도서로 들어감)
+    config.resume = FALSE;
+    ASSERT_EQ(book_import_file(db, csv_path, &config, &stats), SUCCESS);
+    EXPECT_EQ(stats.rows, 10);
+    EXPECT_EQ(stats.imported, 10);
+    EXPECT_EQ(stats.resumed_lines, 0);
+}
+
+// 제목/저자 열이 없거나 파일이 없으면 실패해야 함
+TEST_F(BookImportTest, RejectsUnusableFiles) {
+    EXPECT_EQ(book_import_file(db, "no_such_file.csv", &config, nullptr), FAILURE);
+    EXPECT_EQ(book_import_file(nullptr, csv_path, &config, nullptr), FAILURE);
+
+    write_file(csv_path, "name,isbn\n도서,9788966260959\n");
+    EXPECT_EQ(book_import_file(db, csv_path, &config, nullptr), FAILURE);
+
+    write_file(csv_path, "");
+    EXPECT_EQ(book_import_file(db, csv_path, &config, nullptr), FAILURE);
+    EXPECT_EQ(query_int("SELECT COUNT(*) FROM books;"), 0);
+}
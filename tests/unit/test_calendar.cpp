@@ -0,0 +1,203 @@
+/**
+ * @file test_calendar.cpp
+ * @brief 휴관일 달력 모듈 단위 테스트
+ *
+ * 휴관일 비트맵 적재, 반납 예정일 계산, 반납일 일괄 조정 기능을 테스트합니다.
+ */
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <cstring>
+#include <ctime>
+#include <string>
+
+extern "C" {
+    #include "database.h"
+    #include "book.h"
+    #include "member.h"
+    #include "loan.h"
+    #include "calendar.h"
+    #include "constants.h"
+}
+
+class CalendarTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        test_db_path = "test_calendar_library.db";
+
+        if (std::filesystem::exists(test_db_path)) {
+            std::filesystem::remove(test_db_path);
+        }
+
+        db = database_init(test_db_path);
+        ASSERT_NE(db, nullptr);
+        calendar_invalidate_cache();
+
+        Book book;
+        memset(&book, 0, sizeof(Book));
+        strncpy(book.title, "테스트 도서", sizeof(book.title) - 1);
+        strncpy(book.author, "테스트 저자", sizeof(book.author) - 1);
+        strncpy(book.isbn, "9788966260959", sizeof(book.isbn) - 1);
+        strncpy(book.publisher, "테스트 출판사", sizeof(book.publisher) - 1);
+        strncpy(book.category, "컴퓨터", sizeof(book.category) - 1);
+        book.publication_year = 2023;
+        book.total_copies = 5;
+        book.available_copies = 5;
+        book_id = add_book(db, &book);
+        ASSERT_GT(book_id, 0);
+
+        Member member;
+        memset(&member, 0, sizeof(Member));
+        strncpy(member.name, "홍길동", sizeof(member.name) - 1);
+        strncpy(member.email, "hong@example.com", sizeof(member.email) - 1);
+        strncpy(member.phone, "010-1234-5678", sizeof(member.phone) - 1);
+        strncpy(member.address, "서울시 강남구", sizeof(member.address) - 1);
+        member.is_active = TRUE;
+        member_id = add_member(db, &member);
+        ASSERT_GT(member_id, 0);
+    }
+
+    void TearDown() override {
+        calendar_invalidate_cache();
+        if (db) {
+            database_close(db);
+        }
+        if (std::filesystem::exists(test_db_path)) {
+            std::filesystem::remove(test_db_path);
+        }
+    }
+
+    // 현지 시각 기준 정오의 time_t 값
+    static time_t local_noon(int year, int month, int day) {
+        struct tm tm_info;
+        memset(&tm_info, 0, sizeof(tm_info));
+        tm_info.tm_year = year - 1900;
+        tm_info.tm_mon = month - 1;
+        tm_info.tm_mday = day;
+        tm_info.tm_hour = 12;
+        tm_info.tm_isdst = -1;
+        return mktime(&tm_info);
+    }
+
+    std::string query_text(const char *sql, int loan_id) {
+        sqlite3_stmt *stmt = nullptr;
+        std::string value;
+        if (sqlite3_prepare_v2(db, sql, -1, &stmt, nullptr) == SQLITE_OK) {
+            sqlite3_bind_int(stmt, 1, loan_id);
+            if (sqlite3_step(stmt) == SQLITE_ROW && sqlite3_column_text(stmt, 0)) {
+                value = (const char*)sqlite3_column_text(stmt, 0);
+            }
+        }
+        sqlite3_finalize(stmt);
+        return value;
+    }
+
+    sqlite3 *db = nullptr;
+    const char *test_db_path;
+    int book_id = 0;
+    int member_id = 0;
+};
+
+// 휴관일 비트맵 적재 테스트
+TEST_F(CalendarTest, LoadMarksClosedDays) {
+    ASSERT_EQ(add_library_closure(db, "2030-01-01", "신정"), SUCCESS);
+    ASSERT_EQ(add_library_closure(db, "2032-12-31", "연말"), SUCCESS);
+
+    DateRange range = { local_noon(2030, 2, 28), local_noon(2030, 3, 2) };
+    EXPECT_EQ(add_library_closure_range(db, &range, "시설 점검"), 3);
+
+    ClosureCalendar calendar;
+    ASSERT_EQ(calendar_load(db, 2030, 3, &calendar), SUCCESS);
+
+    EXPECT_TRUE(calendar_is_closed(&calendar, local_noon(2030, 1, 1)));
+    EXPECT_FALSE(calendar_is_closed(&calendar, local_noon(2030, 1, 2)));
+    EXPECT_TRUE(calendar_is_closed(&calendar, local_noon(2030, 2, 28)));
+    EXPECT_TRUE(calendar_is_closed(&calendar, local_noon(2030, 3, 1)));
+    EXPECT_TRUE(calendar_is_closed(&calendar, local_noon(2030, 3, 2)));
+    EXPECT_FALSE(calendar_is_closed(&calendar, local_noon(2030, 3, 3)));
+    EXPECT_TRUE(calendar_is_closed(&calendar, local_noon(2032, 12, 31)));
+
+    // 적재 범위 밖의 연도는 개관일로 간주
+    EXPECT_FALSE(calendar_is_closed(&calendar, local_noon(2033, 1, 1)));
+
+    // 휴관일 취소
+    ASSERT_EQ(remove_library_closure(db, "2030-01-01"), SUCCESS);
+    ASSERT_EQ(calendar_load(db, 2030, 3, &calendar), SUCCESS);
+    EXPECT_FALSE(calendar_is_closed(&calendar, local_noon(2030, 1, 1)));
+}
+
+// 잘못된 날짜 형식 테스트
+TEST_F(CalendarTest, RejectsInvalidDates) {
+    EXPECT_EQ(add_library_closure(db, "2030-02-30", NULL), FAILURE);
+    EXPECT_EQ(add_library_closure(db, "2030-13-01", NULL), FAILURE);
+    EXPECT_EQ(add_library_closure(db, "invalid", NULL), FAILURE);
+
+    DateRange reversed = { local_noon(2030, 3, 2), local_noon(2030, 3, 1) };
+    EXPECT_EQ(add_library_closure_range(db, &reversed, NULL), FAILURE);
+}
+
+// 반납 예정일 계산 시 휴관일 건너뛰기 테스트
+TEST_F(CalendarTest, ComputeDueDateSkipsClosures) {
+    time_t loan_time = local_noon(2030, 5, 1);
+
+    EXPECT_EQ(calendar_compute_due_date(db, loan_time, 14), local_noon(2030, 5, 15));
+
+    DateRange range = { local_noon(2030, 5, 15), local_noon(2030, 5, 16) };
+    ASSERT_EQ(add_library_closure_range(db, &range, "개관 기념 휴관"), 2);
+
+    EXPECT_EQ(calendar_compute_due_date(db, loan_time, 14), local_noon(2030, 5, 17));
+}
+
+// 반납일 일괄 조정 테스트
+TEST_F(CalendarTest, ShiftDueDatesMovesOnlyOpenLoans) {
+    int open_loan_id = loan_book(db, book_id, member_id, DEFAULT_LOAN_DAYS);
+    ASSERT_GT(open_loan_id, 0);
+
+    // 두 번째 회원의 반납 완료된 대출 준비
+    Member other;
+    memset(&other, 0, sizeof(Member));
+    strncpy(other.name, "김철수", sizeof(other.name) - 1);
+    strncpy(other.email, "kim@example.com", sizeof(other.email) - 1);
+    strncpy(other.phone, "010-9876-5432", sizeof(other.phone) - 1);
+    other.is_active = TRUE;
+    int other_id = add_member(db, &other);
+    ASSERT_GT(other_id, 0);
+    int returned_loan_id = loan_book(db, book_id, other_id, DEFAULT_LOAN_DAYS);
+    ASSERT_GT(returned_loan_id, 0);
+    ASSERT_EQ(return_book(db, returned_loan_id), SUCCESS);
+
+    // 두 대출의 반납 예정일을 휴관 기간 안으로 고정
+    ASSERT_EQ(database_execute_query(db,
+        "UPDATE loans SET due_date = '2030-06-10 03:00:00';"), SUCCESS);
+
+    std::string before_due = query_text("SELECT due_date FROM loans WHERE id = ?;", open_loan_id);
+    std::string before_returned = query_text("SELECT due_date FROM loans WHERE id = ?;", returned_loan_id);
+
+    DateRange range = { local_noon(2030, 6, 9), local_noon(2030, 6, 12) };
+    ASSERT_EQ(add_library_closure_range(db, &range, "정기 휴관"), 4);
+
+    ClosureCalendar calendar;
+    ASSERT_EQ(calendar_load(db, 2030, 1, &calendar), SUCCESS);
+
+    EXPECT_EQ(shift_due_dates(db, &range, &calendar), 1);
+
+    std::string after_due = query_text("SELECT due_date FROM loans WHERE id = ?;", open_loan_id);
+    EXPECT_GT(after_due, before_due);
+
+    // 시각 성분은 유지되고 휴관 기간 이후로 이동
+    EXPECT_EQ(after_due.substr(10), before_due.substr(10));
+
+    EXPECT_EQ(query_text("SELECT renewal_count FROM loans WHERE id = ?;", open_loan_id), "0");
+    EXPECT_EQ(query_text("SELECT due_date FROM loans WHERE id = ?;", returned_loan_id), before_returned);
+
+    // 옮긴 대출에만 반납일 조정 이벤트(event_type 4)가 남고, 인자는 옮긴 뒤의 반납 예정일
+    const char *shift_events = "SELECT COUNT(*) FROM loan_events WHERE event_type = 4 AND loan_id = ?;";
+    EXPECT_EQ(query_text(shift_events, open_loan_id), "1");
+    EXPECT_EQ(query_text(shift_events, returned_loan_id), "0");
+    EXPECT_EQ(query_text("SELECT datetime(arg, 'unixepoch') FROM loan_events "
+                         "WHERE event_type = 4 AND loan_id = ?;", open_loan_id), after_due);
+
+    // 이미 조정된 대출은 다시 이동하지 않음
+    EXPECT_EQ(shift_due_dates(db, &range, &calendar), 0);
+    EXPECT_EQ(query_text(shift_events, open_loan_id), "1");
+}
@@ -0,0 +1,275 @@
+/**
+ * @file test_change_log.cpp
+ * @brief 변경 기록과 시점 복구 단위 테스트
+ *
+ * 백업 이후 변경을 목표 시각까지 다시 적용하는 복구, 미리 보기, 배치 적용과 별도 파일 저장,
+ * 기록이 끊긴 경우의 거부, 스키마 변경에 맞춘 트리거 갱신을 테스트합니다.
+ */
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <cstring>
+#include <string>
+
+extern "C" {
+    #include "database.h"
+    #include "loan.h"
+    #include "calendar.h"
+    #include "change_log.h"
+    #include "backup.h"
+    #include "constants.h"
+}
+
+static const char *BACKUP_TIME = "2026-01-01 09:00:00";
+static const char *GOOD_TIME = "2026-01-01 10:00:00";
+static const char *BAD_TIME = "2026-01-01 11:00:00";
+
+class ChangeLogTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        test_db_path = "test_change_log_library.db";
+        backup_path = "test_change_log_backup.db";
+        output_path = "test_change_log_output.db";
+        remove_test_files();
+
+        db = database_init(test_db_path);
+        ASSERT_NE(db, nullptr);
+        calendar_invalidate_cache();
+        ASSERT_EQ(change_log_enable(db), SUCCESS);
+
+        // 백업 전: 도서 20권과 회원 5명
+        execute("WITH RECURSIVE n(i) AS (SELECT 1 UNION ALL SELECT i + 1 FROM n WHERE i < 20) "
+                "INSERT INTO books (title, author, isbn, publisher, category, total_copies, available_copies) "
+                "SELECT printf('도서 %d', i), '저자', printf('978%010d', i), '출판사', '소설', 2, 2 FROM n;");
+        execute("WITH RECURSIVE n(i) AS (SELECT 1 UNION ALL SELECT i + 1 FROM n WHERE i < 5) "
+                "INSERT INTO members (name, email, phone, address) "
+                "SELECT printf('회원 %d', i), printf('m%d@example.com', i), printf('010-1234-%04d', i), '서울' FROM n;");
+        stamp(BACKUP_TIME);
+        ASSERT_EQ(database_backup(db, backup_path), SUCCESS);
+
+        // 백업 후 목표 시각까지: 도서 추가, 수정, 삭제와 대출 (대출 이벤트 포함)
+        execute("INSERT INTO books (title, author, isbn) VALUES ('새 도서', '새 저자', '9780000000100');");
+        execute("UPDATE books SET title = '고친 제목' WHERE id = 3;");
+        execute("DELETE FROM books WHERE id = 4;");
+        ASSERT_GT(loan_book(db, 1, 1, DEFAULT_LOAN_DAYS), 0);
+        ASSERT_GT(loan_book(db, 2, 2, DEFAULT_LOAN_DAYS), 0);
+        stamp(GOOD_TIME);
+        good_state = snapshot(db);
+        good_seq = scalar("SELECT MAX(seq) FROM change_log;");
+
+        // 목표 시각 뒤의 잘못된 일괄 변경
+        execute("UPDATE members SET name = '잘못된 이름';");
+        execute("DELETE FROM books WHERE id > 10;");
+        stamp(BAD_TIME);
+        bad_state = snapshot(db);
+        ASSERT_NE(good_state, bad_state);
+    }
+
+    void TearDown() override {
+        if (db) {
+            database_close(db);
+        }
+        remove_test_files();
+    }
+
+    void remove_test_files() {
+        for (const std::string &path : { std::string(test_db_path), std::string(backup_path), std::string(output_path) }) {
+            for (const char *suffix : { "", "-journal", BACKUP_CHECKSUM_SUFFIX, CHANGE_LOG_WORK_SUFFIX }) {
+                if (std::filesystem::exists(path + suffix)) {
+                    std::filesystem::remove(path + suffix);
+                }
+            }
+        }
+    }
+
+    void execute(const std::string &sql, sqlite3 *connection = nullptr) {
+        char *error = nullptr;
+        ASSERT_EQ(sqlite3_exec(connection ? connection : db, sql.c_str(), nullptr, nullptr, &error), SQLITE_OK)
+            << (error ? error : "");
+    }
+
+    // 아직 시각을 정하지 않은 최근 변경에 시각을 붙임 (테스트는 몇 초 안에 끝나므로 구간을 직접 나눔)
+    void stamp(const char *time) {
+        execute(std::string("UPDATE change_log SET changed_at = '") + time +
+                "' WHERE changed_at > '" + BAD_TIME + "';");
+    }
+
+    long long scalar(const std::string &sql, sqlite3 *connection = nullptr) {
+        sqlite3_stmt *stmt = nullptr;
+        long long value = -1;
+        if (sqlite3_prepare_v2(connection ? connection : db, sql.c_str(), -1, &stmt, nullptr) == SQLITE_OK &&
+            sqlite3_step(stmt) == SQLITE_ROW) {
+            value = sqlite3_column_int64(stmt, 0);
+        }
+        sqlite3_finalize(stmt);
+        return value;
+    }
+
+    static std::string snapshot(sqlite3 *connection) {
+        const char *sql =
+            "SELECT (SELECT group_concat(id || ':' || title || ':' || available_copies, ',') FROM books) || '|' || "
+            "(SELECT group_concat(id || ':' || name, ',') FROM members) || '|' || "
+            "(SELECT group_concat(id || ':' || book_id || ':' || member_id, ',') FROM loans) || '|' || "
+            "(SELECT group_concat(seq || ':' || event_type || ':' || loan_id, ',') FROM loan_events);";
+        sqlite3_stmt *stmt = nullptr;
+        std::string state;
+        if (sqlite3_prepare_v2(connection, sql, -1, &stmt, nullptr) == SQLITE_OK &&
+            sqlite3_step(stmt) == SQLITE_ROW && sqlite3_column_text(stmt, 0)) {
+            state = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0));
+        }
+        sqlite3_finalize(stmt);
+        return state;
+    }
+
+    sqlite3 *db = nullptr;
+    const char *test_db_path;
+    const char *backup_path;
+    const char *output_path;
+    std::string good_state;
+    std::string bad_state;
+    long long good_seq = 0;
+};
+
+TEST_F(ChangeLogTest, RecoversToTargetTime) {
+    ChangeLogRecoverReport report;
+    ASSERT_EQ(change_log_recover(db, backup_path, GOOD_TIME, nullptr, &report), SUCCESS);
+
+    EXPECT_EQ(snapshot(db), good_state);
+    EXPECT_EQ(report.last_seq, good_seq);
+    EXPECT_EQ(report.applied, good_seq - report.backup_seq);
+    EXPECT_GT(report.skipped, 0);
+    EXPECT_STREQ(report.backup_time, BACKUP_TIME);
+    EXPECT_STREQ(report.last_time, GOOD_TIME);
+    EXPECT_EQ(report.batches, 1);
+    EXPECT_FALSE(std::filesystem::exists(std::string(test_db_path) + CHANGE_LOG_WORK_SUFFIX));
+
+    // 목표 시각 뒤의 기록은 사라지고, 이후 변경은 이어지는 번호로 기록됨
+    EXPECT_EQ(scalar("SELECT MAX(seq) FROM change_log;"), good_seq);
+    EXPECT_EQ(change_log_is_enabled(db), TRUE);
+    execute("INSERT INTO books (title, author) VALUES ('복구 후 도서', '저자');");
+    EXPECT_EQ(scalar("SELECT MAX(seq) FROM change_log;"), good_seq + 1);
+}
+
+TEST_F(ChangeLogTest, DryRunReportsCountsWithoutChanges) {
+    ChangeLogRecoverOptions options;
+    change_log_default_options(&options);
+    options.dry_run = TRUE;
+    long long log_rows = scalar("SELECT COUNT(*) FROM change_log;");
+
+    ChangeLogRecoverReport report;
+    ASSERT_EQ(change_log_recover(db, backup_path, GOOD_TIME, &options, &report), SUCCESS);
+
+    EXPECT_EQ(report.applied, good_seq - report.backup_seq);
+    EXPECT_EQ(report.skipped, scalar("SELECT COUNT(*) FROM change_log WHERE seq > " + std::to_string(good_seq)));
+    EXPECT_EQ(report.batches, 0);
+
+    const ChangeLogTableCount *books = nullptr;
+    for (int i = 0; i < report.table_count; i++) {
+        if (strcmp(report.tables[i].table_name, "books") == 0) {
+            books = &report.tables[i];
+        }
+    }
+    ASSERT_NE(books, nullptr);
+    EXPECT_EQ(books->inserts, 1);
+    EXPECT_EQ(books->deletes, 1);
+    EXPECT_GE(books->updates, 3);
+
+    // 현재 데이터베이스와 기록은 그대로이고 작업용 사본도 만들지 않음
+    EXPECT_EQ(snapshot(db), bad_state);
+    EXPECT_EQ(scalar("SELECT COUNT(*) FROM change_log;"), log_rows);
+    EXPECT_FALSE(std::filesystem::exists(std::string(test_db_path) + CHANGE_LOG_WORK_SUFFIX));
+}
+
+TEST_F(ChangeLogTest, AppliesInBatchesToSeparateFile) {
+    ChangeLogRecoverOptions options;
+    change_log_default_options(&options);
+    options.batch_rows = 3;
+    options.output_path = output_path;
+
+    ChangeLogRecoverReport report;
+    ASSERT_EQ(change_log_recover(db, backup_path, GOOD_TIME, &options, &report), SUCCESS);
+    EXPECT_EQ(report.batches, (report.applied + 2) / 3);
+
+    sqlite3 *output = nullptr;
+    ASSERT_EQ(sqlite3_open(output_path, &output), SQLITE_OK);
+    EXPECT_EQ(snapshot(output), good_state);
+    EXPECT_EQ(scalar("SELECT MAX(seq) FROM change_log;", output), good_seq);
+    sqlite3_close(output);
+
+    // 현재 데이터베이스는 바꾸지 않음
+    EXPECT_EQ(snapshot(db), bad_state);
+}
+
+TEST_F(ChangeLogTest, RefusesWhenLogDoesNotContinueBackup) {
+    // 백업보다 앞선 시각
+    EXPECT_EQ(change_log_recover(db, backup_path, "2026-01-01 08:00:00", nullptr, nullptr), FAILURE);
+    EXPECT_EQ(change_log_recover(db, backup_path, "2026-01-01", nullptr, nullptr), FAILURE);
+
+    // 백업에 이미 들어 있는 기록만 정리하면 복구할 수 있음
+    ChangeLogRecoverOptions options;
+    change_log_default_options(&options);
+    options.dry_run = TRUE;
+    long long deleted = 0;
+    ASSERT_EQ(change_log_prune(db, "2026-01-01 09:30:00", &deleted), SUCCESS);
+    EXPECT_GT(deleted, 0);
+    EXPECT_EQ(change_log_recover(db, backup_path, GOOD_TIME, &options, nullptr), SUCCESS);
+
+    // 백업 이후의 기록 일부가 정리됨
+    ASSERT_EQ(change_log_prune(db, "2026-01-01 10:30:00", &deleted), SUCCESS);
+    EXPECT_GT(deleted, 0);
+    EXPECT_EQ(change_log_recover(db, backup_path, GOOD_TIME, &options, nullptr), FAILURE);
+    EXPECT_EQ(change_log_recover(db, backup_path, GOOD_TIME, nullptr, nullptr), FAILURE);
+    EXPECT_EQ(snapshot(db), bad_state);
+
+    // 기록을 껐다 켜면 새 에포크라 이전 백업과 이어지지 않음
+    ASSERT_EQ(change_log_disable(db), SUCCESS);
+    EXPECT_EQ(change_log_is_enabled(db), FALSE);
+    ASSERT_EQ(change_log_enable(db), SUCCESS);
+    EXPECT_EQ(change_log_recover(db, backup_path, BAD_TIME, nullptr, nullptr), FAILURE);
+}
+
+TEST_F(ChangeLogTest, FindsNearestBackup) {
+    const std::string directory = "test_change_log_backups";
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directory(directory);
+    std::filesystem::copy_file(backup_path, directory + "/early.db");
+    ASSERT_EQ(database_backup(db, (directory + "/late.db").c_str()), SUCCESS);
+
+    // 변경 기록이 없는 오래된 백업은 건너뜀
+    sqlite3 *old_backup = nullptr;
+    ASSERT_EQ(sqlite3_open((directory + "/old.db").c_str(), &old_backup), SQLITE_OK);
+    execute("CREATE TABLE books (id INTEGER PRIMARY KEY);", old_backup);
+    sqlite3_close(old_backup);
+
+    char path[MAX_PATH_LENGTH];
+    ASSERT_EQ(change_log_find_backup(db, directory.c_str(), GOOD_TIME, path, sizeof(path)), SUCCESS);
+    EXPECT_EQ(std::string(path), directory + "/early.db");
+    ASSERT_EQ(change_log_find_backup(db, directory.c_str(), "2099-01-01 00:00:00", path, sizeof(path)), SUCCESS);
+    EXPECT_EQ(std::string(path), directory + "/late.db");
+    EXPECT_EQ(change_log_find_backup(db, directory.c_str(), "2026-01-01 08:00:00", path, sizeof(path)), FAILURE);
+
+    std::filesystem::remove_all(directory);
+}
+
+TEST_F(ChangeLogTest, TriggersFollowSchemaChanges) {
+    long long schema_version = scalar("PRAGMA schema_version;");
+    ASSERT_EQ(change_log_refresh_triggers(db), SUCCESS);
+    EXPECT_EQ(scalar("PRAGMA schema_version;"), schema_version);
+
+    execute("ALTER TABLE books ADD COLUMN shelf TEXT;");
+    ASSERT_EQ(change_log_refresh_triggers(db), SUCCESS);
+    execute("UPDATE books SET shelf = 'A-1' WHERE id = 1;");
+    EXPECT_EQ(scalar("SELECT COUNT(*) FROM change_log WHERE seq = (SELECT MAX(seq) FROM change_log) "
+                     "AND json_extract(row_data, '$.shelf') = 'A-1';"), 1);
+
+    ChangeLogStatus status;
+    ASSERT_EQ(change_log_get_status(db, &status), SUCCESS);
+    EXPECT_EQ(status.enabled, TRUE);
+    EXPECT_EQ(strlen(status.epoch), 16u);
+    EXPECT_EQ(status.last_seq, scalar("SELECT MAX(seq) FROM change_log;"));
+
+    // 끄면 더 이상 기록하지 않음
+    ASSERT_EQ(change_log_disable(db), SUCCESS);
+    execute("UPDATE books SET shelf = 'B-2' WHERE id = 1;");
+    EXPECT_EQ(scalar("SELECT MAX(seq) FROM change_log;"), status.last_seq);
+}
@@ -0,0 +1,64 @@
+/**
+ * @file test_crc32c.cpp
+ * @brief CRC32C 단위 테스트
+ *
+ * 알려진 값, 나누어 계산한 결과, 하드웨어 구현과 소프트웨어 구현의 일치를 테스트합니다.
+ */
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <string>
+#include <vector>
+
+extern "C" {
+    #include "crc32c.h"
+}
+
+// RFC 3720 (iSCSI) 부록의 확인 값과 같아야 함
+TEST(Crc32cTest, MatchesKnownValues) {
+    EXPECT_EQ(crc32c_update(0, "123456789", 9), 0xE3069283u);
+    EXPECT_EQ(crc32c_update(0, "", 0), 0u);
+
+    std::vector<unsigned char> zeros(32, 0x00);
+    std::vector<unsigned char> ones(32, 0xff);
+    std::vector<unsigned char> ascending(32);
+    for (int i = 0; i < 32; i++) {
+        ascending[i] = static_cast<unsigned char>(i);
+    }
+    EXPECT_EQ(crc32c_update(0, zeros.data(), zeros.size()), 0x8A9136AAu);
+    EXPECT_EQ(crc32c_update(0, ones.data(), ones.size()), 0x62A8AB43u);
+    EXPECT_EQ(crc32c_update(0, ascending.data(), ascending.size()), 0x46DD794Eu);
+}
+
+// 어떻게 나누어 이어 계산해도 한 번에 계산한 값과 같아야 함
+TEST(Crc32cTest, IncrementalMatchesOneShot) {
+    std::vector<unsigned char> data(10000);
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = static_cast<unsigned char>(i * 131 + 7);
+    }
+    uint32_t whole = crc32c_update(0, data.data(), data.size());
+
+    for (size_t split : { 1, 3, 7, 8, 9, 4096, 9999 }) {
+        uint32_t crc = crc32c_update(0, data.data(), split);
+        crc = crc32c_update(crc, data.data() + split, data.size() - split);
+        EXPECT_EQ(crc, whole) << split;
+    }
+}
+
+// 어떤 구현이 선택되어도 정렬되지 않은 주소와 여러 길이에서 소프트웨어 구현과 같아야 함
+TEST(Crc32cTest, HardwareMatchesSoftware) {
+    std::string name = crc32c_implementation();
+    EXPECT_TRUE(name == "sse4.2" || name == "armv8-crc" || name == "software") << name;
+
+    std::vector<unsigned char> data(70000);
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = static_cast<unsigned char>((i * 2654435761u) >> 13);
+    }
+    for (size_t offset = 0; offset < 8; offset++) {
+        for (size_t length : { 0, 1, 7, 15, 16, 17, 100, 4096, 65536 }) {
+            EXPECT_EQ(crc32c_update(0x12345678u, data.data() + offset, length),
+                      crc32c_update_software(0x12345678u, data.data() + offset, length))
+                << offset << " " << length;
+        }
+    }
+}
@@ -0,0 +1,212 @@
+/**
+ * @file test_data_export.cpp
+ * @brief CSV/NDJSON 내보내기 단위 테스트
+ *
+ * CSV 따옴표 처리, NDJSON 자료형과 이스케이프, 기간 필터, 대출 상세 조인, 버퍼보다 큰 출력을 테스트합니다.
+ */
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+extern "C" {
+    #include "database.h"
+    #include "data_export.h"
+    #include "constants.h"
+}
+
+class DataExportTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        test_db_path = "test_data_export_library.db";
+        output_path = "test_data_export.out";
+        remove_test_files();
+
+        db = database_init(test_db_path);
+        ASSERT_NE(db, nullptr);
+
+        memset(&options, 0, sizeof(DataExportOptions));
+    }
+
+    void TearDown() override {
+        if (db) {
+            database_close(db);
+        }
+        remove_test_files();
+    }
+
+    void remove_test_files() {
+        for (const char *path : { test_db_path, output_path }) {
+            if (std::filesystem::exists(path)) {
+                std::filesystem::remove(path);
+            }
+        }
+    }
+
+    void execute(const std::string &sql) {
+        char *error = nullptr;
+        ASSERT_EQ(sqlite3_exec(db, sql.c_str(), nullptr, nullptr, &error), SQLITE_OK) << (error ? error : "");
+    }
+
+    // 도서 2권, 회원 1명, 날짜가 다른 대출 3건
+    void insert_sample_rows() {
+        execute("INSERT INTO books (id, title, author, isbn, publisher, publication_year) VALUES "
+                "(1, '토지, 1부', '박경리', '9788966260959', NULL, 1994), "
+                "(2, 'Say \"hi\"', 'Back\\slash', NULL, 'Line\nBreak', 2001);");
+        execute("INSERT INTO members (id, name, email, phone) VALUES (1, '홍길동', 'hong@example.com', NULL);");
+        execute("INSERT INTO loans (id, book_id, member_id, loan_date, due_date, is_returned) VALUES "
+                "(1, 1, 1, '2025-01-31 23:59:59', '2025-02-14 23:59:59', 1), "
+                "(2, 2, 1, '2025-01-15 10:00:00', '2025-01-29 10:00:00', 0), "
+                "(3, 1, 1, '2025-02-01 00:00:00', '2025-02-15 00:00:00', 0);");
+    }
+
+    std::string export_to_string(long long *rows = nullptr) {
+        long long written = -1;
+        EXPECT_EQ(data_export_to_path(db, &options, output_path, &written), SUCCESS);
+        if (rows) {
+            *rows = written;
+        }
+        std::ifstream file(output_path, std::ios::binary);
+        std::stringstream content;
+        content << file.rdbuf();
+        return content.str();
+    }
+
+    sqlite3 *db = nullptr;
+    const char *test_db_path;
+    const char *output_path;
+    DataExportOptions options;
+};
+
+// 쉼표, 따옴표, 줄바꿈이 있는 값만 큰따옴표로 감싸고 NULL은 빈 값이어야 함
+TEST_F(DataExportTest, WritesEscapedCsv) {
+    insert_sample_rows();
+    options.entity = DATA_EXPORT_BOOKS;
+    options.format = DATA_EXPORT_CSV;
+
+    long long rows = 0;
+    std::string csv = export_to_string(&rows);
+    EXPECT_EQ(rows, 2);
+
+    std::istringstream lines(csv);
+    std::string header;
+    std::getline(lines, header);
+    EXPECT_EQ(header, "id,title,author,isbn,publisher,publication_year,total_copies,available_copies,"
+                      "category,created_at,updated_at");
+    EXPECT_NE(csv.find("\n1,\"토지, 1부\",박경리,9788966260959,,1994,1,1,,"), std::string::npos);
+    EXPECT_NE(csv.find("\n2,\"Say \"\"hi\"\"\",Back\\slash,,\"Line\nBreak\",2001,"), std::string::npos);
+}
+
+// 정수는 숫자, NULL은 null, 문자열은 JSON 이스케이프로 한 줄에 하나씩 써야 함
+TEST_F(DataExportTest, WritesTypedNdjson) {
+    insert_sample_rows();
+    options.entity = DATA_EXPORT_BOOKS;
+    options.format = DATA_EXPORT_NDJSON;
+
+    std::string json = export_to_string();
+    std::istringstream lines(json);
+    std::string first;
+    std::string second;
+    std::getline(lines, first);
+    std::getline(lines, second);
+
+    EXPECT_EQ(first.rfind("{\"id\":1,\"title\":\"토지, 1부\",\"author\":\"박경리\",\"isbn\":\"9788966260959\","
+                          "\"publisher\":null,\"publication_year\":1994,", 0), 0u);
+    EXPECT_NE(second.find("\"title\":\"Say \\\"hi\\\"\",\"author\":\"Back\\\\slash\",\"isbn\":null,"
+                          "\"publisher\":\"Line\\nBreak\""), std::string::npos);
+    EXPECT_EQ(second.back(), '}');
+    EXPECT_EQ(json.back(), '\n');
+}
+
+// 기간은 양 끝 날짜를 포함하고 기간 필터가 있는 대출은 대출일 순서여야 함
+TEST_F(DataExportTest, FiltersLoansByDate) {
+    insert_sample_rows();
+    options.entity = DATA_EXPORT_LOANS;
+    options.format = DATA_EXPORT_CSV;
+    strcpy(options.from_date, "2025-01-15");
+    strcpy(options.to_date, "2025-01-31");
+
+    long long rows = 0;
+    std::string csv = export_to_string(&rows);
+    EXPECT_EQ(rows, 2);
+    size_t loan2 = csv.find("\n2,2,1,2025-01-15");
+    size_t loan1 = csv.find("\n1,1,1,2025-01-31");
+    ASSERT_NE(loan2, std::string::npos);
+    ASSERT_NE(loan1, std::string::npos);
+    EXPECT_LT(loan2, loan1);
+    EXPECT_EQ(csv.find("\n3,"), std::string::npos);
+
+    // 한쪽만 지정
+    options.to_date[0] = '\0';
+    strcpy(options.from_date, "2025-02-01");
+    export_to_string(&rows);
+    EXPECT_EQ(rows, 1);
+}
+
+// 대출 상세는 도서와 회원 정보를 붙인 열 이름으로 써야 함
+TEST_F(DataExportTest, JoinsLoanDetails) {
+    insert_sample_rows();
+    options.entity = DATA_EXPORT_LOAN_DETAILS;
+    options.format = DATA_EXPORT_NDJSON;
+    strcpy(options.to_date, "2025-01-20");
+
+    long long rows = 0;
+    std::string json = export_to_string(&rows);
+    EXPECT_EQ(rows, 1);
+    EXPECT_EQ(json.rfind("{\"loan_id\":2,\"loan_date\":\"2025-01-15 10:00:00\",", 0), 0u);
+    EXPECT_NE(json.find("\"return_date\":null,\"is_returned\":0,\"renewal_count\":0,\"book_id\":2,"
+                        "\"title\":\"Say \\\"hi\\\"\""), std::string::npos);
+    EXPECT_NE(json.find("\"member_id\":1,\"member_name\":\"홍길동\",\"member_email\":\"hong@example.com\"}"),
+              std::string::npos);
+}
+
+// 출력이 버퍼보다 커도 빠짐없이 순서대로 써야 함
+TEST_F(DataExportTest, StreamsLargerThanBuffer) {
+    execute("WITH RECURSIVE n(i) AS (SELECT 1 UNION ALL SELECT i + 1 FROM n WHERE i < 20000) "
+            "INSERT INTO books (title, author) SELECT printf('%s %d', hex(zeroblob(40)), i), 'author' FROM n;");
+    options.entity = DATA_EXPORT_BOOKS;
+    options.format = DATA_EXPORT_CSV;
+
+    long long rows = 0;
+    std::string csv = export_to_string(&rows);
+    EXPECT_EQ(rows, 20000);
+    EXPECT_GT(csv.size(), (size_t)DATA_EXPORT_BUFFER_SIZE);
+
+    long long lines = 0;
+    long long previous_id = 0;
+    bool ordered = true;
+    std::istringstream stream(csv);
+    std::string line;
+    std::getline(stream, line);
+    while (std::getline(stream, line)) {
+        long long id = std::stoll(line.substr(0, line.find(',')));
+        ordered = ordered && id == previous_id + 1;
+        previous_id = id;
+        lines++;
+    }
+    EXPECT_EQ(lines, 20000);
+    EXPECT_TRUE(ordered);
+}
+
+// 잘못된 이름과 날짜는 거부해야 함
+TEST_F(DataExportTest, RejectsInvalidOptions) {
+    DataExportEntity entity;
+    DataExportFormat format;
+    EXPECT_EQ(data_export_parse_entity("loan_details", &entity), SUCCESS);
+    EXPECT_EQ(entity, DATA_EXPORT_LOAN_DETAILS);
+    EXPECT_EQ(data_export_parse_entity("fines", &entity), FAILURE);
+    EXPECT_EQ(data_export_parse_format("ndjson", &format), SUCCESS);
+    EXPECT_EQ(format, DATA_EXPORT_NDJSON);
+    EXPECT_EQ(data_export_parse_format("xml", &format), FAILURE);
+
+    options.entity = DATA_EXPORT_LOANS;
+    for (const char *date : { "2025-13-01", "2025-02-30", "2025-1-01", "20250101", "yesterday" }) {
+        strcpy(options.from_date, date);
+        EXPECT_EQ(data_export(db, &options, stdout, nullptr), FAILURE) << date;
+    }
+    options.from_date[0] = '\0';
+    EXPECT_EQ(data_export_to_path(db, &options, "no_such_directory/out.csv", nullptr), FAILURE);
+}
@@ -0,0 +1,90 @@
+/**
+ * @file test_database_busy.cpp
+ * @brief 잠금 대기 재시도 단위 테스트
+ *
+ * 다른 연결이 쓰기 잠금을 잡고 있을 때 BEGIN IMMEDIATE 재시도와 연결별·전체 대기 통계를 테스트합니다.
+ */
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <string>
+
+extern "C" {
+    #include "database.h"
+    #include "constants.h"
+}
+
+class DatabaseBusyTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        test_db_path = "test_database_busy.db";
+        remove_test_files();
+
+        db = database_init(test_db_path);
+        ASSERT_NE(db, nullptr);
+        other = database_init(test_db_path);
+        ASSERT_NE(other, nullptr);
+    }
+
+    void TearDown() override {
+        if (other) {
+            database_close(other);
+        }
+        if (db) {
+            database_close(db);
+        }
+        remove_test_files();
+    }
+
+    void remove_test_files() {
+        for (const char *suffix : { "", "-journal", "-wal", "-shm" }) {
+            std::string path = std::string(test_db_path) + suffix;
+            if (std::filesystem::exists(path)) {
+                std::filesystem::remove(path);
+            }
+        }
+    }
+
+    const char *test_db_path;
+    sqlite3 *db = nullptr;
+    sqlite3 *other = nullptr;
+};
+
+/**
+ * @brief 연결별 잠금 대기 통계 테스트
+ *
+ * 다른 연결이 쓰기 잠금을 잡고 있으면 재시도 횟수가 늘고, 끝내 얻지 못하면 포기 횟수가 느는지 확인합니다.
+ */
+TEST_F(DatabaseBusyTest, TrackBusyCountsRetriesAndTimeouts) {
+    DatabaseBusyStats stats = { 0, 0 };
+    ASSERT_EQ(database_track_busy(other, &stats), SUCCESS);
+
+    // 잠금이 없으면 재시도하지 않음
+    ASSERT_EQ(database_begin_immediate_transaction(other), SUCCESS);
+    ASSERT_EQ(database_rollback_transaction(other), SUCCESS);
+    EXPECT_EQ(stats.retries, 0);
+    EXPECT_EQ(stats.timeouts, 0);
+
+    // 다른 연결이 쓰기 잠금을 놓지 않으면 최대 횟수만큼 재시도한 뒤 포기
+    long long global_before = database_get_busy_retry_count();
+    ASSERT_EQ(database_begin_immediate_transaction(db), SUCCESS);
+    EXPECT_EQ(database_begin_immediate_transaction(other), FAILURE);
+    EXPECT_EQ(stats.retries, DATABASE_BUSY_MAX_RETRIES);
+    EXPECT_EQ(stats.timeouts, 1);
+    EXPECT_EQ(database_get_busy_retry_count() - global_before, DATABASE_BUSY_MAX_RETRIES);
+    ASSERT_EQ(database_rollback_transaction(db), SUCCESS);
+
+    // 누적을 멈춰도 재시도는 그대로 동작
+    ASSERT_EQ(database_track_busy(other, nullptr), SUCCESS);
+    ASSERT_EQ(database_begin_immediate_transaction(other), SUCCESS);
+    ASSERT_EQ(database_rollback_transaction(other), SUCCESS);
+    EXPECT_EQ(stats.timeouts, 1);
+}
+
+/**
+ * @brief 잘못된 인자 테스트
+ */
+TEST_F(DatabaseBusyTest, TrackBusyRejectsNullConnection) {
+    DatabaseBusyStats stats = { 0, 0 };
+    EXPECT_EQ(database_track_busy(nullptr, &stats), FAILURE);
+}
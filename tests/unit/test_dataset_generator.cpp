@@ -0,0 +1,227 @@
+/**
+ * @file test_dataset_generator.cpp
+ * @brief 합성 데이터 생성 단위 테스트
+ *
+ * 시드 재현성, 사본 수와 회원 대출 한도, 재고 일관성, 이벤트 기록, 인기도 편중을 테스트합니다.
+ */
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <string>
+
+extern "C" {
+    #include "database.h"
+    #include "dataset_generator.h"
+    #include "loan_event.h"
+    #include "utils.h"
+    #include "constants.h"
+}
+
+class DatasetGeneratorTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        test_db_path = "test_dataset_generator_library.db";
+        other_db_path = "test_dataset_generator_other.db";
+        remove_test_files();
+
+        db = database_init(test_db_path);
+        ASSERT_NE(db, nullptr);
+
+        dataset_generator_default_config(&config, 500);
+        config.seed = 7;
+        config.as_of = string_to_time("2025-01-01", "%Y-%m-%d");
+    }
+
+    void TearDown() override {
+        if (db) {
+            database_close(db);
+        }
+        remove_test_files();
+    }
+
+    void remove_test_files() {
+        for (const char *path : { test_db_path, other_db_path }) {
+            if (std::filesystem::exists(path)) {
+                std::filesystem::remove(path);
+            }
+        }
+    }
+
+    static long long query_int(sqlite3 *target, const char *sql) {
+        sqlite3_stmt *stmt = nullptr;
+        long long value = -1;
+        if (sqlite3_prepare_v2(target, sql, -1, &stmt, nullptr) == SQLITE_OK &&
+            sqlite3_step(stmt) == SQLITE_ROW) {
+            value = sqlite3_column_int64(stmt, 0);
+        }
+        sqlite3_finalize(stmt);
+        return value;
+    }
+
+    // 대출 기록 전체를 한 값으로 요약 (같은 데이터인지 비교용)
+    static long long loans_checksum(sqlite3 *target) {
+        return query_int(target,
+            "SELECT SUM((id * 31 + book_id) * 131 + member_id * 7 + renewal_count + is_returned "
+            "+ length(loan_date) + length(COALESCE(return_date, ''))) "
+            "+ SUM(unicode(substr(loan_date, 9, 2)) + unicode(substr(due_date, 6, 5))) FROM loans;");
+    }
+
+    sqlite3 *db = nullptr;
+    const char *test_db_path;
+    const char *other_db_path;
+    DatasetGeneratorConfig config;
+};
+
+// 기본 설정 테스트
+TEST_F(DatasetGeneratorTest, DefaultConfigScalesWithBooks) {
+    DatasetGeneratorConfig defaults;
+    dataset_generator_default_config(&defaults, 20000);
+
+    EXPECT_EQ(defaults.book_count, 20000);
+    EXPECT_EQ(defaults.member_count, 20000 / DATASET_MEMBERS_PER_BOOK_RATIO);
+    EXPECT_EQ(defaults.loan_count, 20000LL * DATASET_LOANS_PER_BOOK);
+    EXPECT_EQ(defaults.years, DATASET_DEFAULT_YEARS);
+    EXPECT_EQ(defaults.write_events, TRUE);
+}
+
+// 생성 개수와 결과 통계 테스트
+TEST_F(DatasetGeneratorTest, GeneratesRequestedRows) {
+    DatasetGeneratorStats stats;
+    ASSERT_EQ(dataset_generate(db, &config, &stats), SUCCESS);
+
+    EXPECT_EQ(stats.books, 500);
+    EXPECT_EQ(query_int(db, "SELECT COUNT(*) FROM books;"), 500);
+    EXPECT_EQ(stats.members, config.member_count);
+    EXPECT_EQ(query_int(db, "SELECT COUNT(*) FROM members;"), config.member_count);
+    EXPECT_EQ(stats.loans, query_int(db, "SELECT COUNT(*) FROM loans;"));
+    EXPECT_EQ(stats.loans + stats.skipped_loans, config.loan_count);
+    EXPECT_GT(stats.loans, config.loan_count * 9 / 10);
+    EXPECT_EQ(stats.open_loans, query_int(db, "SELECT COUNT(*) FROM loans WHERE is_returned = 0;"));
+    EXPECT_GT(stats.open_loans, 0);
+    EXPECT_GT(stats.overdue_loans, 0);
+    EXPECT_GT(stats.renewals, 0);
+
+    // ISBN은 모두 다르고 이름/제목 검색용 정규화 열도 채워짐
+    EXPECT_EQ(query_int(db, "SELECT COUNT(DISTINCT isbn) FROM books;"), 500);
+    EXPECT_EQ(query_int(db, "SELECT COUNT(*) FROM books WHERE title_chosung IS NULL OR title_chosung = '';"), 0);
+    EXPECT_EQ(query_int(db, "SELECT COUNT(*) FROM members WHERE name_norm IS NULL OR name_norm = '';"), 0);
+}
+
+// 같은 시드는 같은 데이터, 다른 시드는 다른 데이터 테스트
+TEST_F(DatasetGeneratorTest, SameSeedIsDeterministic) {
+    ASSERT_EQ(dataset_generate(db, &config, nullptr), SUCCESS);
+
+    sqlite3 *other = database_init(other_db_path);
+    ASSERT_NE(other, nullptr);
+    ASSERT_EQ(dataset_generate(other, &config, nullptr), SUCCESS);
+    EXPECT_EQ(loans_checksum(db), loans_checksum(other));
+    EXPECT_EQ(query_int(db, "SELECT SUM(length(title) * id) FROM books;"),
+              query_int(other, "SELECT SUM(length(title) * id) FROM books;"));
+    EXPECT_EQ(query_int(db, "SELECT SUM(event_time + event_type * loan_id) FROM loan_events;"),
+              query_int(other, "SELECT SUM(event_time + event_type * loan_id) FROM loan_events;"));
+    database_close(other);
+    std::filesystem::remove(other_db_path);
+
+    other = database_init(other_db_path);
+    ASSERT_NE(other, nullptr);
+    DatasetGeneratorConfig reseeded = config;
+    reseeded.seed = 8;
+    ASSERT_EQ(dataset_generate(other, &reseeded, nullptr), SUCCESS);
+    EXPECT_NE(loans_checksum(db), loans_checksum(other));
+    database_close(other);
+}
+
+// 사본 수, 회원 대출 한도, 재고 일관성 테스트
+TEST_F(DatasetGeneratorTest, RespectsCopiesAndMemberLimits) {
+    ASSERT_EQ(dataset_generate(db, &config, nullptr), SUCCESS);
+
+    // 대출 시작 시점마다 같은 도서의 대출 중 기록이 사본 수를 넘지 않음
+    EXPECT_EQ(query_int(db,
+        "SELECT COUNT(*) FROM loans a JOIN books b ON b.id = a.book_id "
+        "WHERE (SELECT COUNT(*) FROM loans c WHERE c.book_id = a.book_id "
+        "AND c.loan_date <= a.loan_date AND (c.return_date IS NULL OR c.return_date > a.loan_date)) > b.total_copies;"), 0);
+
+    const std::string member_limit_sql =
+        "SELECT COUNT(*) FROM loans a "
+        "WHERE (SELECT COUNT(*) FROM loans c WHERE c.member_id = a.member_id "
+        "AND c.loan_date <= a.loan_date AND (c.return_date IS NULL OR c.return_date > a.loan_date)) > " +
+        std::to_string(MAX_BOOKS_PER_MEMBER) + ";";
+    EXPECT_EQ(query_int(db, member_limit_sql.c_str()), 0);
+
+    // 대출 가능 수량은 사본 수에서 대출 중 기록을 뺀 값
+    EXPECT_EQ(query_int(db,
+        "SELECT COUNT(*) FROM books b WHERE b.available_copies != b.total_copies - "
+        "(SELECT COUNT(*) FROM loans l WHERE l.book_id = b.id AND l.is_returned = 0);"), 0);
+
+    // 반납 기록은 반납일을 갖고, 대출 중 기록은 갖지 않음
+    EXPECT_EQ(query_int(db,
+        "SELECT COUNT(*) FROM loans WHERE (is_returned = 1) != (return_date IS NOT NULL);"), 0);
+    EXPECT_EQ(query_int(db, "SELECT COUNT(*) FROM loans WHERE due_date <= loan_date;"), 0);
+    EXPECT_EQ(query_int(db, "SELECT COUNT(*) FROM loans WHERE loan_date >= '2025-01-01';"), 0);
+}
+
+// 대출 이벤트 기록 테스트
+TEST_F(DatasetGeneratorTest, WritesMatchingLoanEvents) {
+    DatasetGeneratorStats stats;
+    ASSERT_EQ(dataset_generate(db, &config, &stats), SUCCESS);
+
+    std::string count_sql = "SELECT COUNT(*) FROM loan_events WHERE event_type = " +
+                            std::to_string(LOAN_EVENT_CHECKOUT) + ";";
+    EXPECT_EQ(query_int(db, count_sql.c_str()), stats.loans);
+    count_sql = "SELECT COUNT(*) FROM loan_events WHERE event_type = " + std::to_string(LOAN_EVENT_RENEW) + ";";
+    EXPECT_EQ(query_int(db, count_sql.c_str()), stats.renewals);
+    count_sql = "SELECT COUNT(*) FROM loan_events WHERE event_type = " + std::to_string(LOAN_EVENT_RETURN) + ";";
+    EXPECT_EQ(query_int(db, count_sql.c_str()), stats.loans - stats.open_loans);
+    EXPECT_EQ(query_int(db, "SELECT COUNT(*) FROM loan_events;"), stats.events);
+
+    // 이벤트 순번은 시간순
+    EXPECT_EQ(query_int(db,
+        "SELECT COUNT(*) FROM loan_events a JOIN loan_events b ON b.seq = a.seq + 1 "
+        "WHERE b.event_time < a.event_time;"), 0);
+}
+
+// 이벤트 생략 테스트
+TEST_F(DatasetGeneratorTest, SkipsEventsWhenDisabled) {
+    DatasetGeneratorStats stats;
+    config.write_events = FALSE;
+    ASSERT_EQ(dataset_generate(db, &config, &stats), SUCCESS);
+
+    EXPECT_EQ(stats.events, 0);
+    EXPECT_EQ(query_int(db, "SELECT COUNT(*) FROM loan_events;"), 0);
+    EXPECT_GT(query_int(db, "SELECT COUNT(*) FROM loans;"), 0);
+}
+
+// 인기도 편중 테스트
+TEST_F(DatasetGeneratorTest, PopularityIsSkewed) {
+    ASSERT_EQ(dataset_generate(db, &config, nullptr), SUCCESS);
+
+    // 균등하면 상위 10% 도서가 대출의 10% 정도를 차지함
+    long long total = query_int(db, "SELECT COUNT(*) FROM loans;");
+    long long top = query_int(db,
+        "SELECT SUM(c) FROM (SELECT COUNT(*) AS c FROM loans GROUP BY book_id ORDER BY c DESC LIMIT 50);");
+    ASSERT_GT(total, 0);
+    EXPECT_GT(top * 100 / total, 25);
+}
+
+// 보조 인덱스 복원 테스트
+TEST_F(DatasetGeneratorTest, RestoresIndexes) {
+    const char *index_sql = "SELECT COUNT(*) FROM sqlite_master WHERE type = 'index' AND sql IS NOT NULL;";
+    long long before = query_int(db, index_sql);
+    ASSERT_GT(before, 0);
+
+    ASSERT_EQ(dataset_generate(db, &config, nullptr), SUCCESS);
+    EXPECT_EQ(query_int(db, index_sql), before);
+}
+
+// 비어 있지 않은 데이터베이스와 잘못된 설정 거부 테스트
+TEST_F(DatasetGeneratorTest, RejectsNonEmptyDatabaseAndInvalidConfig) {
+    ASSERT_EQ(dataset_generate(db, &config, nullptr), SUCCESS);
+    long long loans = query_int(db, "SELECT COUNT(*) FROM loans;");
+
+    EXPECT_EQ(dataset_generate(db, &config, nullptr), FAILURE);
+    EXPECT_EQ(query_int(db, "SELECT COUNT(*) FROM loans;"), loans);
+    EXPECT_EQ(query_int(db, "SELECT COUNT(*) FROM books;"), 500);
+
+    EXPECT_EQ(dataset_generate(nullptr, &config, nullptr), FAILURE);
+    EXPECT_EQ(dataset_generate(db, nullptr, nullptr), FAILURE);
+}
@@ -0,0 +1,130 @@
+/**
+ * @file test_file_copy.cpp
+ * @brief 파일 복사 단위 테스트
+ *
+ * 복사 방법별 결과, 빈 파일과 더 큰 기존 파일 덮어쓰기, 같은 파일과 없는 원본의 처리,
+ * backup_file 래퍼를 테스트합니다.
+ */
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+extern "C" {
+    #include "file_copy.h"
+    #include "utils.h"
+    #include "constants.h"
+}
+
+class FileCopyTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        source_path = "test_file_copy_source.bin";
+        dest_path = "test_file_copy_dest.bin";
+        remove_test_files();
+
+        // 버퍼 여러 번에 걸치고 페이지 크기로 나누어떨어지지 않는 크기
+        content.resize(FILE_COPY_BUFFER_SIZE * 3 + 123);
+        for (size_t i = 0; i < content.size(); i++) {
+            content[i] = static_cast<char>((i * 2654435761u) >> 11);
+        }
+        write_file(source_path, content);
+    }
+
+    void TearDown() override {
+        remove_test_files();
+    }
+
+    void remove_test_files() {
+        std::filesystem::remove(source_path);
+        std::filesystem::remove(dest_path);
+    }
+
+    static void write_file(const std::string &path, const std::vector<char> &data) {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(data.data(), static_cast<std::streamsize>(data.size()));
+    }
+
+    static std::vector<char> read_file(const std::string &path) {
+        std::ifstream file(path, std::ios::binary);
+        return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    const char *source_path;
+    const char *dest_path;
+    std::vector<char> content;
+};
+
+// 자동 선택과 버퍼 복사는 어디서나 되고, 내용이 같아야 함
+TEST_F(FileCopyTest, CopiesContentWithAutoAndBuffer) {
+    FileCopyStats stats;
+    ASSERT_EQ(file_copy(source_path, dest_path, FILE_COPY_AUTO, &stats), SUCCESS);
+    EXPECT_NE(stats.method, FILE_COPY_AUTO);
+    EXPECT_EQ(stats.bytes, static_cast<long long>(content.size()));
+    EXPECT_GE(stats.elapsed_seconds, 0.0);
+    EXPECT_EQ(read_file(dest_path), content);
+
+    std::filesystem::remove(dest_path);
+    ASSERT_EQ(file_copy(source_path, dest_path, FILE_COPY_BUFFER, &stats), SUCCESS);
+    EXPECT_EQ(stats.method, FILE_COPY_BUFFER);
+    EXPECT_EQ(stats.bytes, static_cast<long long>(content.size()));
+    EXPECT_EQ(read_file(dest_path), content);
+}
+
+// 방법을 지정하면 그 방법으로 복사하거나, 지원하지 않으면 대상 파일을 남기지 않고 실패해야 함
+TEST_F(FileCopyTest, ForcedMethodCopiesOrFailsCleanly) {
+    for (FileCopyMethod method : { FILE_COPY_REFLINK, FILE_COPY_RANGE, FILE_COPY_SENDFILE }) {
+        std::filesystem::remove(dest_path);
+        FileCopyStats stats;
+        if (file_copy(source_path, dest_path, method, &stats) == SUCCESS) {
+            EXPECT_EQ(stats.method, method) << file_copy_method_name(method);
+            EXPECT_EQ(stats.bytes, static_cast<long long>(content.size()));
+            EXPECT_EQ(read_file(dest_path), content) << file_copy_method_name(method);
+        } else {
+            EXPECT_FALSE(std::filesystem::exists(dest_path)) << file_copy_method_name(method);
+        }
+    }
+#ifdef __linux__
+    // 리눅스 커널은 일반 파일 사이의 sendfile을 항상 지원함
+    EXPECT_EQ(file_copy(source_path, dest_path, FILE_COPY_SENDFILE, nullptr), SUCCESS);
+#endif
+}
+
+// 빈 파일을 복사하고, 더 큰 기존 파일은 원본 크기로 잘라 덮어써야 함
+TEST_F(FileCopyTest, HandlesEmptySourceAndLargerDestination) {
+    std::vector<char> larger(content.size() * 2, 'x');
+    for (FileCopyMethod method : { FILE_COPY_AUTO, FILE_COPY_BUFFER }) {
+        write_file(dest_path, larger);
+        ASSERT_EQ(file_copy(source_path, dest_path, method, nullptr), SUCCESS);
+        EXPECT_EQ(read_file(dest_path), content) << file_copy_method_name(method);
+    }
+
+    write_file(source_path, {});
+    for (FileCopyMethod method : { FILE_COPY_AUTO, FILE_COPY_BUFFER }) {
+        FileCopyStats stats;
+        ASSERT_EQ(file_copy(source_path, dest_path, method, &stats), SUCCESS);
+        EXPECT_EQ(stats.bytes, 0);
+        EXPECT_EQ(std::filesystem::file_size(dest_path), 0u);
+    }
+}
+
+// 같은 파일로 복사하면 원본을 지우지 않고 실패하고, 없는 원본은 대상 파일을 만들지 않아야 함
+TEST_F(FileCopyTest, RejectsSameFileAndMissingSource) {
+    EXPECT_EQ(file_copy(source_path, source_path, FILE_COPY_AUTO, nullptr), FAILURE);
+    EXPECT_EQ(read_file(source_path), content);
+
+    EXPECT_EQ(file_copy("no_such_file.bin", dest_path, FILE_COPY_AUTO, nullptr), FAILURE);
+    EXPECT_FALSE(std::filesystem::exists(dest_path));
+    EXPECT_EQ(file_copy(source_path, "no_such_directory/copy.bin", FILE_COPY_AUTO, nullptr), FAILURE);
+}
+
+// backup_file은 같은 복사 엔진을 써야 함
+TEST_F(FileCopyTest, BackupFileUsesCopyEngine) {
+    set_log_level(LOG_ERROR);
+    ASSERT_EQ(backup_file(source_path, dest_path), SUCCESS);
+    EXPECT_EQ(read_file(dest_path), content);
+    EXPECT_EQ(backup_file(nullptr, dest_path), FAILURE);
+}
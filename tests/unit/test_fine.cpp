@@ -0,0 +1,194 @@
+/**
+ * @file test_fine.cpp
+ * @brief 연체료 관리 모듈 단위 테스트
+ *
+ * 연체료 정책, 일괄 정산, 회원 미납 잔액, 납부 기능을 테스트합니다.
+ */
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <cstring>
+#include <ctime>
+#include <string>
+
+extern "C" {
+    #include "database.h"
+    #include "book.h"
+    #include "member.h"
+    #include "loan.h"
+    #include "fine.h"
+    #include "calendar.h"
+    #include "utils.h"
+    #include "constants.h"
+}
+
+class FineTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        test_db_path = "test_fine_library.db";
+
+        if (std::filesystem::exists(test_db_path)) {
+            std::filesystem::remove(test_db_path);
+        }
+
+        db = database_init(test_db_path);
+        ASSERT_NE(db, nullptr);
+        calendar_invalidate_cache();
+
+        computer_book_id = create_book("9788966260959", "컴퓨터");
+        novel_book_id = create_book("9788937460449", "소설");
+        ASSERT_GT(computer_book_id, 0);
+        ASSERT_GT(novel_book_id, 0);
+
+        Member member;
+        memset(&member, 0, sizeof(Member));
+        strncpy(member.name, "홍길동", sizeof(member.name) - 1);
+        strncpy(member.email, "hong@example.com", sizeof(member.email) - 1);
+        strncpy(member.phone, "010-1234-5678", sizeof(member.phone) - 1);
+        member.is_active = TRUE;
+        member_id = add_member(db, &member);
+        ASSERT_GT(member_id, 0);
+    }
+
+    void TearDown() override {
+        calendar_invalidate_cache();
+        if (db) {
+            database_close(db);
+        }
+        if (std::filesystem::exists(test_db_path)) {
+            std::filesystem::remove(test_db_path);
+        }
+    }
+
+    int create_book(const char *isbn, const char *category) {
+        Book book;
+        memset(&book, 0, sizeof(Book));
+        strncpy(book.title, "테스트 도서", sizeof(book.title) - 1);
+        strncpy(book.author, "테스트 저자", sizeof(book.author) - 1);
+        strncpy(book.isbn, isbn, sizeof(book.isbn) - 1);
+        strncpy(book.category, category, sizeof(book.category) - 1);
+        book.total_copies = 3;
+        book.available_copies = 3;
+        return add_book(db, &book);
+    }
+
+    // 반납 예정일을 기준 시각보다 days일 앞선 시각으로 고정
+    void set_due_date(int loan_id, time_t as_of, int days) {
+        char due_str[32];
+        time_to_sql_string(as_of - (time_t)days * 24 * 60 * 60, due_str, sizeof(due_str));
+
+        sqlite3_stmt *stmt = nullptr;
+        ASSERT_EQ(sqlite3_prepare_v2(db, "UPDATE loans SET due_date = ? WHERE id = ?;", -1, &stmt, nullptr), SQLITE_OK);
+        sqlite3_bind_text(stmt, 1, due_str, -1, SQLITE_TRANSIENT);
+        sqlite3_bind_int(stmt, 2, loan_id);
+        ASSERT_EQ(sqlite3_step(stmt), SQLITE_DONE);
+        sqlite3_finalize(stmt);
+    }
+
+    sqlite3 *db = nullptr;
+    const char *test_db_path;
+    int computer_book_id = 0;
+    int novel_book_id = 0;
+    int member_id = 0;
+};
+
+// 기본 정책과 카테고리별 정책에 따른 일괄 정산 테스트
+TEST_F(FineTest, AccrueAppliesPoliciesAndCaps) {
+    ASSERT_EQ(set_fee_policy(db, "소설", 500, 2000), SUCCESS);
+
+    int computer_loan = loan_book(db, computer_book_id, member_id, DEFAULT_LOAN_DAYS);
+    int novel_loan = loan_book(db, novel_book_id, member_id, DEFAULT_LOAN_DAYS);
+    ASSERT_GT(computer_loan, 0);
+    ASSERT_GT(novel_loan, 0);
+
+    time_t as_of = time(NULL) + 30 * 24 * 60 * 60;
+    set_due_date(computer_loan, as_of, 3);
+    set_due_date(novel_loan, as_of, 10);
+
+    EXPECT_EQ(accrue_fines(db, as_of), 2);
+
+    int amount = 0;
+    ASSERT_EQ(get_loan_fine(db, computer_loan, &amount), SUCCESS);
+    EXPECT_EQ(amount, 3 * DEFAULT_DAILY_FINE);
+    ASSERT_EQ(get_loan_fine(db, novel_loan, &amount), SUCCESS);
+    EXPECT_EQ(amount, 2000);
+
+    int balance = 0;
+    ASSERT_EQ(get_member_balance(db, member_id, &balance), SUCCESS);
+    EXPECT_EQ(balance, 3 * DEFAULT_DAILY_FINE + 2000);
+}
+
+// 같은 기준 시각으로 재정산 시 잔액이 중복 증가하지 않는지 테스트
+TEST_F(FineTest, AccrueIsIncremental) {
+    int loan_id = loan_book(db, computer_book_id, member_id, DEFAULT_LOAN_DAYS);
+    ASSERT_GT(loan_id, 0);
+
+    time_t as_of = time(NULL) + 30 * 24 * 60 * 60;
+    set_due_date(loan_id, as_of, 2);
+
+    EXPECT_EQ(accrue_fines(db, as_of), 1);
+    EXPECT_EQ(accrue_fines(db, as_of), 0);
+
+    int balance = 0;
+    ASSERT_EQ(get_member_balance(db, member_id, &balance), SUCCESS);
+    EXPECT_EQ(balance, 2 * DEFAULT_DAILY_FINE);
+
+    // 하루 뒤 정산 시 차액만 반영
+    EXPECT_EQ(accrue_fines(db, as_of + 24 * 60 * 60), 1);
+    ASSERT_EQ(get_member_balance(db, member_id, &balance), SUCCESS);
+    EXPECT_EQ(balance, 3 * DEFAULT_DAILY_FINE);
+}
+
+// 연체되지 않은 대출과 반납된 대출은 정산 대상이 아님
+TEST_F(FineTest, AccrueSkipsCurrentAndReturnedLoans) {
+    int loan_id = loan_book(db, computer_book_id, member_id, DEFAULT_LOAN_DAYS);
+    ASSERT_GT(loan_id, 0);
+
+    EXPECT_EQ(accrue_fines(db, time(NULL)), 0);
+
+    ASSERT_EQ(return_book(db, loan_id), SUCCESS);
+    EXPECT_EQ(accrue_fines(db, time(NULL) + 60 * 24 * 60 * 60), 0);
+
+    int balance = -1;
+    ASSERT_EQ(get_member_balance(db, member_id, &balance), SUCCESS);
+    EXPECT_EQ(balance, 0);
+}
+
+// 반납 시 연체료 최종 정산 테스트
+TEST_F(FineTest, ReturnBookAccruesFinalFine) {
+    int loan_id = loan_book(db, computer_book_id, member_id, DEFAULT_LOAN_DAYS);
+    ASSERT_GT(loan_id, 0);
+
+    set_due_date(loan_id, time(NULL), 4);
+    ASSERT_EQ(return_book(db, loan_id), SUCCESS);
+
+    int balance = 0;
+    ASSERT_EQ(get_member_balance(db, member_id, &balance), SUCCESS);
+    EXPECT_EQ(balance, 4 * DEFAULT_DAILY_FINE);
+}
+
+// 연체료 납부 테스트
+TEST_F(FineTest, PayFineReducesBalance) {
+    int loan_id = loan_book(db, computer_book_id, member_id, DEFAULT_LOAN_DAYS);
+    ASSERT_GT(loan_id, 0);
+
+    time_t as_of = time(NULL) + 30 * 24 * 60 * 60;
+    set_due_date(loan_id, as_of, 5);
+    ASSERT_EQ(accrue_fines(db, as_of), 1);
+
+    EXPECT_EQ(pay_fine(db, member_id, 5 * DEFAULT_DAILY_FINE + 1), FAILURE);
+    EXPECT_EQ(pay_fine(db, member_id, 0), FAILURE);
+    EXPECT_EQ(pay_fine(db, member_id, 2 * DEFAULT_DAILY_FINE), SUCCESS);
+
+    int balance = 0;
+    ASSERT_EQ(get_member_balance(db, member_id, &balance), SUCCESS);
+    EXPECT_EQ(balance, 3 * DEFAULT_DAILY_FINE);
+}
+
+// 연체 일수 계산 테스트
+TEST_F(FineTest, OverdueDaysAsOf) {
+    time_t due_date = 1700000000;
+    EXPECT_EQ(calculate_overdue_days_as_of(due_date, due_date + 3 * 24 * 60 * 60 + 100), 3);
+    EXPECT_EQ(calculate_overdue_days_as_of(due_date, due_date + 100), 0);
+    EXPECT_LT(calculate_overdue_days_as_of(due_date, due_date - 2 * 24 * 60 * 60), 0);
+}
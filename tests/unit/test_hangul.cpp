@@ -0,0 +1,246 @@
+/**
+ * @file test_hangul.cpp
+ * @brief 한글 검색 정규화 모듈 단위 테스트
+ *
+ * 자모 분해, 초성 추출, 초성/접두어 회원 검색, 도서 부분 검색과 trigram 색인, 기존 데이터베이스 보충을 테스트합니다.
+ */
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <cstring>
+#include <string>
+
+extern "C" {
+    #include "database.h"
+    #include "book.h"
+    #include "member.h"
+    #include "hangul.h"
+    #include "constants.h"
+}
+
+class HangulTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        test_db_path = "test_hangul_library.db";
+
+        if (std::filesystem::exists(test_db_path)) {
+            std::filesystem::remove(test_db_path);
+        }
+
+        db = database_init(test_db_path);
+        ASSERT_NE(db, nullptr);
+    }
+
+    void TearDown() override {
+        if (db) {
+            database_close(db);
+        }
+        if (std::filesystem::exists(test_db_path)) {
+            std::filesystem::remove(test_db_path);
+        }
+    }
+
+    int add_test_member(const char *name, const char *email) {
+        Member member;
+        memset(&member, 0, sizeof(Member));
+        strncpy(member.name, name, sizeof(member.name) - 1);
+        strncpy(member.email, email, sizeof(member.email) - 1);
+        member.is_active = TRUE;
+        return add_member(db, &member);
+    }
+
+    int add_test_book(const char *title, const char *author, const char *isbn) {
+        Book book;
+        memset(&book, 0, sizeof(Book));
+        strncpy(book.title, title, sizeof(book.title) - 1);
+        strncpy(book.author, author, sizeof(book.author) - 1);
+        strncpy(book.isbn, isbn, sizeof(book.isbn) - 1);
+        book.total_copies = 1;
+        book.available_copies = 1;
+        return add_book(db, &book);
+    }
+
+    int count_members(const char *name) {
+        MemberSearchResult result;
+        if (init_member_search_result(&result) != SUCCESS) {
+            return -1;
+        }
+        int count = search_members_by_name(db, name, &result) == SUCCESS ? result.count : -1;
+        free_member_search_result(&result);
+        return count;
+    }
+
+    int count_books_by_title(const char *title) {
+        BookSearchResult result;
+        if (init_book_search_result(&result) != SUCCESS) {
+            return -1;
+        }
+        int count = search_books_by_title(db, title, &result) == SUCCESS ? result.count : -1;
+        free_book_search_result(&result);
+        return count;
+    }
+
+    std::string query_plan(const char *sql) {
+        std::string plan;
+        sqlite3_stmt *stmt = nullptr;
+        std::string explain = std::string("EXPLAIN QUERY PLAN ") + sql;
+        if (sqlite3_prepare_v2(db, explain.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
+            while (sqlite3_step(stmt) == SQLITE_ROW) {
+                plan += (const char*)sqlite3_column_text(stmt, 3);
+                plan += "\n";
+            }
+        }
+        sqlite3_finalize(stmt);
+        return plan;
+    }
+
+    sqlite3 *db = nullptr;
+    const char *test_db_path;
+};
+
+// 자모 분해 및 초성 추출 테스트
+TEST_F(HangulTest, NormalizeAndExtractChosung) {
+    char buffer[128];
+
+    ASSERT_GT(hangul_normalize("김 민수", buffer, sizeof(buffer)), 0);
+    EXPECT_STREQ(buffer, "ㄱㅣㅁㅁㅣㄴㅅㅜ");
+
+    ASSERT_GT(hangul_normalize("Kim MinSu", buffer, sizeof(buffer)), 0);
+    EXPECT_STREQ(buffer, "kimminsu");
+
+    ASSERT_GT(hangul_extract_chosung("김민수", buffer, sizeof(buffer)), 0);
+    EXPECT_STREQ(buffer, "ㄱㅁㅅ");
+
+    ASSERT_GT(hangul_extract_chosung("C 프로그래밍 2판", buffer, sizeof(buffer)), 0);
+    EXPECT_STREQ(buffer, "cㅍㄹㄱㄹㅁ2ㅍ");
+
+    // 버퍼 부족
+    EXPECT_EQ(hangul_normalize("김민수", buffer, 4), FAILURE);
+
+    EXPECT_EQ(hangul_is_chosung_query("ㄱㅁㅅ"), TRUE);
+    EXPECT_EQ(hangul_is_chosung_query("ㄱ ㅁ"), TRUE);
+    EXPECT_EQ(hangul_is_chosung_query("김ㅁ"), FALSE);
+    EXPECT_EQ(hangul_is_chosung_query(""), FALSE);
+}
+
+// 초성/접두어/입력 중인 음절로 회원 검색 테스트
+TEST_F(HangulTest, SearchMembersByChosungAndPrefix) {
+    ASSERT_GT(add_test_member("김민수", "kms@example.com"), 0);
+    ASSERT_GT(add_test_member("김민지", "kmj@example.com"), 0);
+    ASSERT_GT(add_test_member("이민수", "lms@example.com"), 0);
+
+    EXPECT_EQ(count_members("ㄱㅁㅅ"), 1);
+    EXPECT_EQ(count_members("ㄱㅁ"), 2);
+    EXPECT_EQ(count_members("김민"), 2);
+    EXPECT_EQ(count_members("김미"), 2);   // "김민"을 입력하는 중
+    EXPECT_EQ(count_members("김 민 수"), 1);
+    EXPECT_EQ(count_members("박"), 0);
+    EXPECT_EQ(count_members("%"), 0);
+
+    // 앞부분 검색이므로 이름 중간부터 입력하면 찾지 않음
+    EXPECT_EQ(count_members("민수"), 0);
+    EXPECT_EQ(count_members("ㅁㅅ"), 0);
+}
+
+// 이름을 바꾸면 검색 컬럼도 함께 갱신되는지 테스트
+TEST_F(HangulTest, UpdateRefreshesSearchColumns) {
+    int member_id = add_test_member("김민수", "kms@example.com");
+    ASSERT_GT(member_id, 0);
+
+    Member member;
+    ASSERT_EQ(get_member_by_id(db, member_id, &member), SUCCESS);
+    strncpy(member.name, "박지훈", sizeof(member.name) - 1);
+    ASSERT_EQ(update_member(db, &member), SUCCESS);
+
+    EXPECT_EQ(count_members("ㄱㅁㅅ"), 0);
+    EXPECT_EQ(count_members("ㅂㅈㅎ"), 1);
+}
+
+// 회원 이름 검색이 인덱스 범위 조회로 처리되는지 테스트
+TEST_F(HangulTest, MemberNameSearchUsesIndex) {
+    EXPECT_NE(query_plan("SELECT id FROM members WHERE name_norm >= 'a' AND name_norm < 'b';")
+                  .find("idx_members_name_norm"), std::string::npos);
+    EXPECT_NE(query_plan("SELECT id FROM members WHERE name_chosung >= 'a' AND name_chosung < 'b';")
+                  .find("idx_members_name_chosung"), std::string::npos);
+}
+
+// 도서 제목 부분 검색 및 초성 검색 테스트
+TEST_F(HangulTest, SearchBooksByTitle) {
+    ASSERT_GT(add_test_book("자바 프로그래밍", "김개발", "9788966260001"), 0);
+    ASSERT_GT(add_test_book("파이썬 프로그래밍", "이코딩", "9788966260002"), 0);
+    ASSERT_GT(add_test_book("데이터베이스 설계", "박설계", "9788966260003"), 0);
+
+    EXPECT_EQ(count_books_by_title("프로그래밍"), 2);
+    EXPECT_EQ(count_books_by_title("자바프로"), 1);
+    EXPECT_EQ(count_books_by_title("ㅍㄹㄱㄹㅁ"), 2);
+    EXPECT_EQ(count_books_by_title("ㄷㅇㅌ"), 1);
+    EXPECT_EQ(count_books_by_title("_"), 0);
+}
+
+// 세 글자 이상 도서 검색은 trigram 색인으로 후보를 찾는지 테스트
+TEST_F(HangulTest, BookSearchUsesTrigramIndex) {
+    EXPECT_EQ(database_create_book_search_index(db), SUCCESS);
+    EXPECT_NE(query_plan("SELECT id FROM books WHERE id IN "
+                         "(SELECT rowid FROM books_search WHERE books_search MATCH 'title_norm : \"abc\"');")
+                  .find("VIRTUAL TABLE INDEX"), std::string::npos);
+
+    // 따옴표가 들어간 검색어도 문자 그대로 찾음
+    ASSERT_GT(add_test_book("Say \"Hello\" World", "Kim", "9788966260004"), 0);
+    EXPECT_EQ(count_books_by_title("\"hello\""), 1);
+    EXPECT_EQ(count_books_by_title("o\" w"), 1);
+    EXPECT_EQ(count_books_by_title("hello\"\""), 0);
+}
+
+// 도서를 추가/수정/삭제해도 검색 색인이 books와 일치하는지 테스트
+TEST_F(HangulTest, BookSearchIndexFollowsChanges) {
+    int book_id = add_test_book("자바 프로그래밍", "김개발", "9788966260001");
+    ASSERT_GT(book_id, 0);
+
+    Book book;
+    ASSERT_EQ(get_book_by_id(db, book_id, &book), SUCCESS);
+    strncpy(book.title, "코틀린 입문", sizeof(book.title) - 1);
+    ASSERT_EQ(update_book(db, &book), SUCCESS);
+    EXPECT_EQ(count_books_by_title("프로그래밍"), 0);
+    EXPECT_EQ(count_books_by_title("코틀린"), 1);
+    EXPECT_EQ(database_execute_query(db, "INSERT INTO books_search (books_search) VALUES ('integrity-check');"),
+              SUCCESS);
+
+    ASSERT_EQ(delete_book(db, book_id), SUCCESS);
+    EXPECT_EQ(count_books_by_title("코틀린"), 0);
+    EXPECT_EQ(database_execute_query(db, "INSERT INTO books_search (books_search) VALUES ('integrity-check');"),
+              SUCCESS);
+
+    // 트리거를 잠시 지운 동안 넣은 도서도 다시 만들 때 색인에 들어감
+    ASSERT_EQ(database_pause_book_search_index(db), SUCCESS);
+    ASSERT_GT(add_test_book("데이터베이스 설계", "박설계", "9788966260003"), 0);
+    EXPECT_EQ(count_books_by_title("ㄷㅇㅌㅂ"), 0);   // 색인으로 찾는 검색어
+    EXPECT_EQ(count_books_by_title("ㄷㅇ"), 1);       // 두 글자는 검색 컬럼을 훑음
+    ASSERT_EQ(database_create_book_search_index(db), SUCCESS);
+    EXPECT_EQ(database_execute_query(db, "INSERT INTO books_search (books_search) VALUES ('integrity-check');"),
+              SUCCESS);
+    EXPECT_EQ(count_books_by_title("ㄷㅇㅌㅂ"), 1);
+}
+
+// 검색 컬럼이 없던 기존 데이터베이스를 열면 컬럼을 추가하고 채우는지 테스트
+TEST_F(HangulTest, ExistingDatabaseIsBackfilled) {
+    database_close(db);
+    db = nullptr;
+    std::filesystem::remove(test_db_path);
+
+    sqlite3 *legacy = nullptr;
+    ASSERT_EQ(sqlite3_open(test_db_path, &legacy), SQLITE_OK);
+    ASSERT_EQ(sqlite3_exec(legacy,
+        "CREATE TABLE members (id INTEGER PRIMARY KEY AUTOINCREMENT, name TEXT NOT NULL, "
+        "email TEXT UNIQUE NOT NULL, phone TEXT, address TEXT, "
+        "registration_date TIMESTAMP DEFAULT CURRENT_TIMESTAMP, is_active INTEGER DEFAULT 1, "
+        "created_at TIMESTAMP DEFAULT CURRENT_TIMESTAMP, updated_at TIMESTAMP DEFAULT CURRENT_TIMESTAMP);"
+        "INSERT INTO members (name, email) VALUES ('김민수', 'kms@example.com');",
+        nullptr, nullptr, nullptr), SQLITE_OK);
+    sqlite3_close(legacy);
+
+    db = database_init(test_db_path);
+    ASSERT_NE(db, nullptr);
+
+    EXPECT_EQ(count_members("ㄱㅁㅅ"), 1);
+    EXPECT_EQ(database_add_column_if_missing(db, "members", "name_norm", "TEXT"), 0);
+}
@@ -0,0 +1,183 @@
+/**
+ * @file test_loan_event.cpp
+ * @brief 대출 이벤트 로그 모듈 단위 테스트
+ *
+ * 이벤트 기록, 재생, 시점 재구성, 소비자 처리 위치, 보충 기능을 테스트합니다.
+ */
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <vector>
+
+extern "C" {
+    #include "database.h"
+    #include "book.h"
+    #include "member.h"
+    #include "loan.h"
+    #include "loan_event.h"
+    #include "calendar.h"
+    #include "constants.h"
+}
+
+static int collect_events(const LoanEvent *event, void *user_data) {
+    static_cast<std::vector<LoanEvent>*>(user_data)->push_back(*event);
+    return SUCCESS;
+}
+
+static int fail_on_return(const LoanEvent *event, void *user_data) {
+    (void)user_data;
+    return event->event_type == LOAN_EVENT_RETURN ? FAILURE : SUCCESS;
+}
+
+class LoanEventTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        test_db_path = "test_loan_event_library.db";
+
+        if (std::filesystem::exists(test_db_path)) {
+            std::filesystem::remove(test_db_path);
+        }
+
+        db = database_init(test_db_path);
+        ASSERT_NE(db, nullptr);
+        calendar_invalidate_cache();
+
+        Book book;
+        memset(&book, 0, sizeof(Book));
+        strncpy(book.title, "테스트 도서", sizeof(book.title) - 1);
+        strncpy(book.author, "테스트 저자", sizeof(book.author) - 1);
+        strncpy(book.isbn, "9788966260959", sizeof(book.isbn) - 1);
+        book.total_copies = 3;
+        book.available_copies = 3;
+        book_id = add_book(db, &book);
+        ASSERT_GT(book_id, 0);
+
+        Member member;
+        memset(&member, 0, sizeof(Member));
+        strncpy(member.name, "홍길동", sizeof(member.name) - 1);
+        strncpy(member.email, "hong@example.com", sizeof(member.email) - 1);
+        strncpy(member.phone, "010-1234-5678", sizeof(member.phone) - 1);
+        member.is_active = TRUE;
+        member_id = add_member(db, &member);
+        ASSERT_GT(member_id, 0);
+    }
+
+    void TearDown() override {
+        calendar_invalidate_cache();
+        if (db) {
+            database_close(db);
+        }
+        if (std::filesystem::exists(test_db_path)) {
+            std::filesystem::remove(test_db_path);
+        }
+    }
+
+    int count_rows(const char *sql) {
+        sqlite3_stmt *stmt = nullptr;
+        int count = -1;
+        if (sqlite3_prepare_v2(db, sql, -1, &stmt, nullptr) == SQLITE_OK &&
+            sqlite3_step(stmt) == SQLITE_ROW) {
+            count = sqlite3_column_int(stmt, 0);
+        }
+        sqlite3_finalize(stmt);
+        return count;
+    }
+
+    sqlite3 *db = nullptr;
+    const char *test_db_path;
+    int book_id = 0;
+    int member_id = 0;
+};
+
+// 대출/연장/반납 시 이벤트가 순서대로 기록되는지 테스트
+TEST_F(LoanEventTest, CirculationWritesEvents) {
+    int loan_id = loan_book(db, book_id, member_id, DEFAULT_LOAN_DAYS);
+    ASSERT_GT(loan_id, 0);
+    ASSERT_EQ(extend_loan(db, loan_id, 7), SUCCESS);
+    ASSERT_EQ(return_book(db, loan_id), SUCCESS);
+
+    std::vector<LoanEvent> events;
+    long long last_seq = 0;
+    ASSERT_EQ(loan_event_replay(db, 0, 0, collect_events, &events, &last_seq), 3);
+
+    EXPECT_EQ(events[0].event_type, LOAN_EVENT_CHECKOUT);
+    EXPECT_EQ(events[1].event_type, LOAN_EVENT_RENEW);
+    EXPECT_EQ(events[2].event_type, LOAN_EVENT_RETURN);
+    EXPECT_EQ(last_seq, events[2].seq);
+
+    for (const LoanEvent &event : events) {
+        EXPECT_EQ(event.loan_id, loan_id);
+        EXPECT_EQ(event.book_id, book_id);
+        EXPECT_EQ(event.member_id, member_id);
+    }
+
+    // 연장 이벤트의 반납 예정일은 대출 시점보다 7일 뒤
+    EXPECT_EQ(events[1].due_date - events[0].due_date, 7 * 24 * 60 * 60);
+}
+
+// 이벤트 로그는 수정/삭제할 수 없음
+TEST_F(LoanEventTest, EventLogIsAppendOnly) {
+    ASSERT_GT(loan_book(db, book_id, member_id, DEFAULT_LOAN_DAYS), 0);
+
+    EXPECT_NE(sqlite3_exec(db, "UPDATE loan_events SET event_type = 2;", nullptr, nullptr, nullptr), SQLITE_OK);
+    EXPECT_NE(sqlite3_exec(db, "DELETE FROM loan_events;", nullptr, nullptr, nullptr), SQLITE_OK);
+    EXPECT_EQ(count_rows("SELECT COUNT(*) FROM loan_events;"), 1);
+}
+
+// 시점 재구성 테스트
+TEST_F(LoanEventTest, SnapshotReconstructsPastState) {
+    int loan_id = loan_book(db, book_id, member_id, DEFAULT_LOAN_DAYS);
+    ASSERT_GT(loan_id, 0);
+    ASSERT_EQ(return_book(db, loan_id), SUCCESS);
+
+    // 과거 시점: 대출 기록 없음
+    EXPECT_EQ(loan_event_build_snapshot(db, time(NULL) - 24 * 60 * 60), 0);
+
+    // 현재 시점: 반납 완료된 대출 1건
+    EXPECT_EQ(loan_event_build_snapshot(db, time(NULL) + 60), 1);
+    EXPECT_EQ(count_rows("SELECT COUNT(*) FROM temp.loan_snapshot WHERE return_time IS NOT NULL;"), 1);
+}
+
+// 소비자 처리 위치 테스트
+TEST_F(LoanEventTest, ConsumerReadsFromHighWaterMark) {
+    int loan_id = loan_book(db, book_id, member_id, DEFAULT_LOAN_DAYS);
+    ASSERT_GT(loan_id, 0);
+
+    std::vector<LoanEvent> events;
+    EXPECT_EQ(loan_event_consume(db, "stats", collect_events, &events), 1);
+    EXPECT_EQ(loan_event_consume(db, "stats", collect_events, &events), 0);
+
+    ASSERT_EQ(return_book(db, loan_id), SUCCESS);
+    EXPECT_EQ(loan_event_consume(db, "stats", collect_events, &events), 1);
+    ASSERT_EQ(events.size(), 2u);
+    EXPECT_EQ(events[1].event_type, LOAN_EVENT_RETURN);
+
+    long long last_seq = 0;
+    ASSERT_EQ(loan_event_get_cursor(db, "stats", &last_seq), SUCCESS);
+    EXPECT_EQ(last_seq, events[1].seq);
+
+    // 처리 실패 시 처리 위치가 전진하지 않음
+    EXPECT_EQ(loan_event_consume(db, "archive", fail_on_return, nullptr), FAILURE);
+    ASSERT_EQ(loan_event_get_cursor(db, "archive", &last_seq), SUCCESS);
+    EXPECT_EQ(last_seq, 0);
+}
+
+// 이벤트 로그 도입 이전 기록 보충 테스트
+TEST_F(LoanEventTest, BackfillCreatesMissingEvents) {
+    char sql[512];
+    snprintf(sql, sizeof(sql),
+        "INSERT INTO loans (book_id, member_id, due_date, return_date, is_returned) "
+        "VALUES (%d, %d, '2024-01-15 00:00:00', '2024-01-10 00:00:00', 1), "
+        "(%d, %d, '2024-02-15 00:00:00', NULL, 0);", book_id, member_id, book_id, member_id);
+    ASSERT_EQ(database_execute_query(db, sql), SUCCESS);
+
+    EXPECT_EQ(loan_event_backfill(db), 3);
+    EXPECT_EQ(loan_event_backfill(db), 0);
+
+    std::vector<LoanEvent> events;
+    ASSERT_EQ(loan_event_replay(db, 0, 0, collect_events, &events, nullptr), 3);
+    EXPECT_EQ(events[2].event_type, LOAN_EVENT_RETURN);
+}
@@ -0,0 +1,169 @@
+/**
+ * @file test_loan_idempotency.cpp
+ * @brief 대출 요청 중복 방지 및 잠금 대기 재시도 단위 테스트
+ *
+ * 클라이언트 요청 ID 재시도, 요청 ID 오용, 여러 연결의 동시 쓰기를 테스트합니다.
+ */
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+#include <atomic>
+
+extern "C" {
+    #include "database.h"
+    #include "book.h"
+    #include "member.h"
+    #include "loan.h"
+    #include "calendar.h"
+    #include "constants.h"
+}
+
+class LoanIdempotencyTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        test_db_path = "test_loan_idempotency_library.db";
+
+        if (std::filesystem::exists(test_db_path)) {
+            std::filesystem::remove(test_db_path);
+        }
+
+        db = database_init(test_db_path);
+        ASSERT_NE(db, nullptr);
+        calendar_invalidate_cache();
+
+        Book book;
+        memset(&book, 0, sizeof(Book));
+        strncpy(book.title, "테스트 도서", sizeof(book.title) - 1);
+        strncpy(book.author, "테스트 저자", sizeof(book.author) - 1);
+        strncpy(book.isbn, "9788966260959", sizeof(book.isbn) - 1);
+        book.total_copies = 50;
+        book.available_copies = 50;
+        book_id = add_book(db, &book);
+        ASSERT_GT(book_id, 0);
+
+        for (int i = 0; i < 4; i++) {
+            Member member;
+            memset(&member, 0, sizeof(Member));
+            snprintf(member.name, sizeof(member.name), "회원%d", i);
+            snprintf(member.email, sizeof(member.email), "member%d@example.com", i);
+            strncpy(member.phone, "010-1234-5678", sizeof(member.phone) - 1);
+            member.is_active = TRUE;
+            member_ids.push_back(add_member(db, &member));
+            ASSERT_GT(member_ids.back(), 0);
+        }
+    }
+
+    void TearDown() override {
+        calendar_invalidate_cache();
+        if (db) {
+            database_close(db);
+        }
+        if (std::filesystem::exists(test_db_path)) {
+            std::filesystem::remove(test_db_path);
+        }
+    }
+
+    int count_rows(const char *sql) {
+        sqlite3_stmt *stmt = nullptr;
+        int count = -1;
+        if (sqlite3_prepare_v2(db, sql, -1, &stmt, nullptr) == SQLITE_OK &&
+            sqlite3_step(stmt) == SQLITE_ROW) {
+            count = sqlite3_column_int(stmt, 0);
+        }
+        sqlite3_finalize(stmt);
+        return count;
+    }
+
+    sqlite3 *db = nullptr;
+    const char *test_db_path;
+    int book_id = 0;
+    std::vector<int> member_ids;
+};
+
+// 같은 요청 ID로 재시도 시 원래 결과 반환 테스트
+TEST_F(LoanIdempotencyTest, ReplayReturnsOriginalResult) {
+    int loan_id = loan_book_idempotent(db, "desk1-0001", book_id, member_ids[0], DEFAULT_LOAN_DAYS);
+    ASSERT_GT(loan_id, 0);
+
+    EXPECT_EQ(loan_book_idempotent(db, "desk1-0001", book_id, member_ids[0], DEFAULT_LOAN_DAYS), loan_id);
+    EXPECT_EQ(count_rows("SELECT COUNT(*) FROM loans;"), 1);
+    EXPECT_EQ(count_rows("SELECT available_copies FROM books;"), 49);
+
+    EXPECT_EQ(extend_loan_idempotent(db, "desk1-0002", loan_id, 7), SUCCESS);
+    EXPECT_EQ(extend_loan_idempotent(db, "desk1-0002", loan_id, 7), SUCCESS);
+    EXPECT_EQ(count_rows("SELECT renewal_count FROM loans;"), 1);
+
+    EXPECT_EQ(return_book_idempotent(db, "desk1-0003", loan_id), SUCCESS);
+    EXPECT_EQ(return_book_idempotent(db, "desk1-0003", loan_id), SUCCESS);
+    EXPECT_EQ(count_rows("SELECT available_copies FROM books;"), 50);
+    EXPECT_EQ(count_rows("SELECT COUNT(*) FROM loan_events;"), 3);
+
+    // 요청 ID 없이 다시 반납하면 실패
+    EXPECT_EQ(return_book(db, loan_id), FAILURE);
+}
+
+// 다른 작업에 같은 요청 ID 재사용 시 실패 테스트
+TEST_F(LoanIdempotencyTest, RequestIdReusedForOtherOperationFails) {
+    int loan_id = loan_book_idempotent(db, "desk1-0001", book_id, member_ids[0], DEFAULT_LOAN_DAYS);
+    ASSERT_GT(loan_id, 0);
+
+    EXPECT_EQ(return_book_idempotent(db, "desk1-0001", loan_id), FAILURE);
+    EXPECT_EQ(count_rows("SELECT is_returned FROM loans;"), 0);
+}
+
+// 실패한 요청은 기록되지 않아 같은 ID로 다시 시도 가능
+TEST_F(LoanIdempotencyTest, FailedRequestIsNotRecorded) {
+    EXPECT_EQ(loan_book_idempotent(db, "desk1-0001", 999, member_ids[0], DEFAULT_LOAN_DAYS), FAILURE);
+    EXPECT_EQ(count_rows("SELECT COUNT(*) FROM request_dedupe;"), 0);
+
+    EXPECT_GT(loan_book_idempotent(db, "desk1-0001", book_id, member_ids[0], DEFAULT_LOAN_DAYS), 0);
+    EXPECT_EQ(count_rows("SELECT COUNT(*) FROM request_dedupe;"), 1);
+}
+
+// 만료된 요청 ID 정리 테스트
+TEST_F(LoanIdempotencyTest, PurgeRemovesExpiredRequests) {
+    ASSERT_EQ(database_execute_query(db,
+        "INSERT INTO request_dedupe (request_id, operation, result, created_at) "
+        "VALUES ('old', 'loan_book', 1, 0), ('new', 'loan_book', 2, strftime('%s', 'now'));"), SUCCESS);
+
+    EXPECT_EQ(purge_expired_loan_requests(db), 1);
+    EXPECT_EQ(count_rows("SELECT COUNT(*) FROM request_dedupe;"), 1);
+}
+
+// 여러 연결이 동시에 대출/재시도해도 오류나 중복이 없는지 테스트
+TEST_F(LoanIdempotencyTest, ConcurrentWritersDoNotDuplicate) {
+    const int writer_count = 4;
+    std::atomic<int> failures(0);
+    std::vector<std::thread> writers;
+
+    for (int w = 0; w < writer_count; w++) {
+        writers.emplace_back([&, w]() {
+            sqlite3 *conn = database_init(test_db_path);
+            if (!conn) {
+                failures++;
+                return;
+            }
+            // 각 창구가 같은 요청을 두 번씩 보내는 상황 (타임아웃 후 재시도)
+            for (int attempt = 0; attempt < 2; attempt++) {
+                std::string request_id = "desk" + std::to_string(w) + "-loan";
+                if (loan_book_idempotent(conn, request_id.c_str(), book_id, member_ids[w], DEFAULT_LOAN_DAYS) <= 0) {
+                    failures++;
+                }
+            }
+            database_close(conn);
+        });
+    }
+
+    for (std::thread &writer : writers) {
+        writer.join();
+    }
+
+    EXPECT_EQ(failures.load(), 0);
+    EXPECT_EQ(count_rows("SELECT COUNT(*) FROM loans;"), writer_count);
+    EXPECT_EQ(count_rows("SELECT available_copies FROM books;"), 50 - writer_count);
+    EXPECT_EQ(count_rows("SELECT COUNT(*) FROM loan_events;"), writer_count);
+}
@@ -0,0 +1,360 @@
+/**
+ * @file test_logger.cpp
+ * @brief 비동기 로거 단위 테스트
+ *
+ * 수준 필터링, 기록 형식, 다중 스레드 기록, 버퍼 초과 시 유실 처리,
+ * 로그 파일 교체/압축/보관 개수 제한, 끝부분 읽기를 테스트합니다.
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <zlib.h>
+
+extern "C" {
+    #include "logger.h"
+    #include "utils.h"
+    #include "constants.h"
+}
+
+class LoggerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        test_log_path = "test_logger.log";
+
+        if (std::filesystem::exists(test_log_path)) {
+            std::filesystem::remove(test_log_path);
+        }
+
+        set_log_level(LOG_INFO);
+        ASSERT_EQ(init_logging(test_log_path), SUCCESS);
+        logger_get_stats(&baseline);
+    }
+
+    void TearDown() override {
+        close_logging();
+        set_log_level(LOG_INFO);
+
+        LoggerRotation defaults = { LOGGER_DEFAULT_MAX_BYTES, TRUE, LOGGER_DEFAULT_MAX_ARCHIVES, TRUE };
+        logger_set_rotation(&defaults);
+
+        if (std::filesystem::exists(test_log_path)) {
+            std::filesystem::remove(test_log_path);
+        }
+        for (const std::string &archive : list_archives()) {
+            std::filesystem::remove(archive);
+        }
+    }
+
+    void restart_with_rotation(long long max_bytes, int rotate_daily, int max_archives) {
+        close_logging();
+        LoggerRotation rotation = { max_bytes, rotate_daily, max_archives, TRUE };
+        logger_set_rotation(&rotation);
+        ASSERT_EQ(init_logging(test_log_path), SUCCESS);
+        logger_get_stats(&baseline);
+    }
+
+    std::vector<std::string> list_archives() {
+        std::vector<std::string> archives;
+        std::string prefix = std::string(test_log_path) + ".";
+        for (const auto &entry : std::filesystem::directory_iterator(".")) {
+            std::string name = entry.path().filename().string();
+            if (name.compare(0, prefix.size(), prefix) == 0) {
+                archives.push_back(name);
+            }
+        }
+        std::sort(archives.begin(), archives.end());
+        return archives;
+    }
+
+    static std::vector<std::string> read_gzip_lines(const std::string &path) {
+        std::vector<std::string> lines;
+        gzFile file = gzopen(path.c_str(), "rb");
+        if (!file) {
+            return lines;
+        }
+        char buffer[512];
+        while (gzgets(file, buffer, sizeof(buffer))) {
+            std::string line(buffer);
+            if (!line.empty() && line.back() == '\n') {
+                line.pop_back();
+            }
+            lines.push_back(line);
+        }
+        gzclose(file);
+        return lines;
+    }
+
+    static void collect_line(const char *line, size_t length, void *user_data) {
+        static_cast<std::vector<std::string>*>(user_data)->emplace_back(line, length);
+    }
+
+    std::vector<std::string> read_lines() {
+        std::vector<std::string> lines;
+        std::ifstream file(test_log_path);
+        std::string line;
+        while (std::getline(file, line)) {
+            lines.push_back(line);
+        }
+        return lines;
+    }
+
+    static size_t count_containing(const std::vector<std::string> &lines, const std::string &text) {
+        size_t count = 0;
+        for (const std::string &line : lines) {
+            if (line.find(text) != std::string::npos) {
+                count++;
+            }
+        }
+        return count;
+    }
+
+    const char *test_log_path;
+    LoggerStats baseline;
+};
+
+// 기존 로그 형식을 그대로 유지하는지 테스트
+TEST_F(LoggerTest, WritesExistingLineFormat) {
+    log_message(LOG_INFO, "도서 추가: %s (ID %d)", "자바 프로그래밍", 7);
+    log_message(LOG_ERROR, "오류 %d", 42);
+    logger_flush();
+
+    std::vector<std::string> lines = read_lines();
+    ASSERT_EQ(lines.size(), 2u);
+
+    // [YYYY-MM-DD HH:MM:SS] LEVEL: 메시지
+    const std::string &line = lines[0];
+    ASSERT_GT(line.size(), 22u);
+    EXPECT_EQ(line[0], '[');
+    EXPECT_EQ(line[5], '-');
+    EXPECT_EQ(line[11], ' ');
+    EXPECT_EQ(line[20], ']');
+    EXPECT_EQ(line.substr(21), " INFO: 도서 추가: 자바 프로그래밍 (ID 7)");
+    EXPECT_EQ(lines[1].substr(21), " ERROR: 오류 42");
+}
+
+// 최소 수준 미만의 로그는 기록하지 않고 걸러진 수만 늘리는지 테스트
+TEST_F(LoggerTest, FiltersBelowMinimumLevel) {
+    set_log_level(LOG_WARNING);
+    EXPECT_EQ(logger_get_level(), LOG_WARNING);
+
+    log_message(LOG_DEBUG, "디버그");
+    log_message(LOG_INFO, "정보");
+    log_message(LOG_WARNING, "경고");
+    logger_flush();
+
+    LoggerStats stats;
+    logger_get_stats(&stats);
+    EXPECT_EQ(stats.filtered - baseline.filtered, 2);
+
+    std::vector<std::string> lines = read_lines();
+    ASSERT_EQ(lines.size(), 1u);
+    EXPECT_NE(lines[0].find("WARNING: 경고"), std::string::npos);
+}
+
+// 걸러지는 로그만 남기는 스레드는 링 버퍼를 만들지 않는지 테스트
+TEST_F(LoggerTest, FilteredOnlyThreadDoesNotAllocateRing) {
+    set_log_level(LOG_ERROR);
+
+    std::thread thread([] {
+        for (int i = 0; i < 10; i++) {
+            log_message(LOG_DEBUG, "디버그 %d", i);
+        }
+    });
+    thread.join();
+
+    LoggerStats stats;
+    logger_get_stats(&stats);
+    EXPECT_EQ(stats.filtered - baseline.filtered, 10);
+    EXPECT_EQ(stats.ring_count, baseline.ring_count);
+}
+
+// 여러 스레드가 동시에 남긴 로그가 빠짐없이 기록되는지 테스트
+TEST_F(LoggerTest, MultipleThreadsAreAllWritten) {
+    const int thread_count = 4;
+    const int per_thread = 500;
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < thread_count; t++) {
+        threads.emplace_back([t, per_thread]() {
+            for (int i = 0; i < per_thread; i++) {
+                log_message(LOG_INFO, "스레드 %d 메시지 %d", t, i);
+                if (i % 100 == 99) {
+                    logger_flush();
+                }
+            }
+        });
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+    logger_flush();
+
+    LoggerStats stats;
+    logger_get_stats(&stats);
+    EXPECT_EQ(stats.dropped - baseline.dropped, 0);
+    EXPECT_EQ(stats.written - baseline.written, thread_count * per_thread);
+    EXPECT_GE(stats.ring_count, 2);
+
+    std::vector<std::string> lines = read_lines();
+    EXPECT_EQ(lines.size(), (size_t)(thread_count * per_thread));
+    EXPECT_EQ(count_containing(lines, "스레드 3 메시지 "), (size_t)per_thread);
+}
+
+// 버퍼가 가득 차면 호출 스레드를 막지 않고 버린 뒤 경고를 남기는지 테스트
+TEST_F(LoggerTest, OverflowIsDroppedAndReported) {
+    const int total = LOGGER_RING_CAPACITY * 4;
+
+    // 기록 스레드가 비우기 전에 버퍼 용량을 넘도록 한 번에 많이 남김
+    for (int i = 0; i < total; i++) {
+        log_message(LOG_INFO, "대량 메시지 %d", i);
+    }
+    logger_flush();
+
+    LoggerStats stats;
+    logger_get_stats(&stats);
+    long long written = stats.written - baseline.written;
+    long long dropped = stats.dropped - baseline.dropped;
+
+    EXPECT_EQ(written + dropped, total);
+    EXPECT_GT(dropped, 0);
+
+    std::vector<std::string> lines = read_lines();
+    EXPECT_EQ(count_containing(lines, "대량 메시지 "), (size_t)written);
+    EXPECT_GE(count_containing(lines, "WARNING: 로그 버퍼가 가득 차"), 1u);
+}
+
+// 종료 시 남은 로그를 모두 기록하는지 테스트
+TEST_F(LoggerTest, StopFlushesPendingEntries) {
+    for (int i = 0; i < 100; i++) {
+        log_message(LOG_INFO, "종료 전 메시지 %d", i);
+    }
+    close_logging();
+
+    EXPECT_EQ(count_containing(read_lines(), "종료 전 메시지 "), 100u);
+}
+
+// 크기를 넘으면 교체하고 교체된 파일을 압축하는지 테스트
+TEST_F(LoggerTest, RotatesBySizeAndCompresses) {
+    restart_with_rotation(4096, FALSE, 0);
+
+    for (int i = 0; i < 200; i++) {
+        log_message(LOG_INFO, "교체 메시지 %03d", i);
+        if (i % 20 == 19) {
+            logger_flush();
+        }
+    }
+    logger_flush();
+
+    LoggerStats stats;
+    logger_get_stats(&stats);
+    close_logging();   // 압축이 끝날 때까지 기다림
+
+    std::vector<std::string> archives = list_archives();
+    ASSERT_GT(stats.rotations - baseline.rotations, 0);
+    ASSERT_EQ(archives.size(), (size_t)(stats.rotations - baseline.rotations));
+
+    // 교체된 파일과 현재 파일을 순서대로 이으면 빠짐없이 순서대로 남아 있음
+    std::vector<std::string> all_lines;
+    for (const std::string &archive : archives) {
+        EXPECT_TRUE(archive.size() > 3 && archive.compare(archive.size() - 3, 3, ".gz") == 0) << archive;
+        EXPECT_LE(std::filesystem::file_size(archive), 4096u);
+        std::vector<std::string> lines = read_gzip_lines(archive);
+        all_lines.insert(all_lines.end(), lines.begin(), lines.end());
+    }
+    std::vector<std::string> current = read_lines();
+    all_lines.insert(all_lines.end(), current.begin(), current.end());
+
+    ASSERT_EQ(all_lines.size(), 200u);
+    EXPECT_NE(all_lines.front().find("교체 메시지 000"), std::string::npos);
+    EXPECT_NE(all_lines.back().find("교체 메시지 199"), std::string::npos);
+}
+
+// 보관 개수를 넘는 오래된 교체 파일을 지우는지 테스트
+TEST_F(LoggerTest, RetentionRemovesOldestArchives) {
+    restart_with_rotation(0, FALSE, 2);
+
+    for (int i = 0; i < 5; i++) {
+        log_message(LOG_INFO, "구간 %d", i);
+        ASSERT_EQ(logger_rotate(), SUCCESS);
+    }
+    close_logging();
+
+    std::vector<std::string> archives = list_archives();
+    ASSERT_EQ(archives.size(), 2u);
+
+    // 가장 최근 두 구간만 남음
+    std::vector<std::string> lines = read_gzip_lines(archives[0]);
+    ASSERT_EQ(lines.size(), 1u);
+    EXPECT_NE(lines[0].find("구간 3"), std::string::npos);
+    lines = read_gzip_lines(archives[1]);
+    ASSERT_EQ(lines.size(), 1u);
+    EXPECT_NE(lines[0].find("구간 4"), std::string::npos);
+}
+
+// 날짜가 지난 로그 파일은 첫 기록 전에 교체하는지 테스트
+TEST_F(LoggerTest, RotatesWhenDayChanges) {
+    close_logging();
+    {
+        std::ofstream file(test_log_path);
+        file << "[2000-01-01 00:00:00] INFO: 어제 로그\n";
+    }
+    std::filesystem::last_write_time(test_log_path,
+        std::filesystem::last_write_time(test_log_path) - std::chrono::hours(48));
+
+    restart_with_rotation(0, TRUE, 0);
+    log_message(LOG_INFO, "오늘 로그");
+    logger_flush();
+
+    LoggerStats stats;
+    logger_get_stats(&stats);
+    EXPECT_EQ(stats.rotations - baseline.rotations, 1);
+
+    std::vector<std::string> lines = read_lines();
+    ASSERT_EQ(lines.size(), 1u);
+    EXPECT_NE(lines[0].find("오늘 로그"), std::string::npos);
+}
+
+// 파일 끝부분의 줄만 순서대로 읽는지 테스트
+TEST_F(LoggerTest, ReadTailReturnsLastLines) {
+    for (int i = 0; i < 50; i++) {
+        log_message(LOG_INFO, "끝부분 %02d", i);
+    }
+    logger_flush();
+
+    std::vector<std::string> tail;
+    ASSERT_EQ(logger_read_tail(test_log_path, 5, collect_line, &tail), 5);
+    ASSERT_EQ(tail.size(), 5u);
+    EXPECT_NE(tail[0].find("끝부분 45"), std::string::npos);
+    EXPECT_NE(tail[4].find("끝부분 49"), std::string::npos);
+
+    // 요청한 줄 수가 더 많으면 전체를 반환
+    tail.clear();
+    EXPECT_EQ(logger_read_tail(test_log_path, 100, collect_line, &tail), 50);
+
+    EXPECT_EQ(logger_read_tail("no_such_file.log", 5, collect_line, &tail), FAILURE);
+}
+
+// 빈 파일과 마지막 줄에 개행이 없는 파일 처리 테스트
+TEST_F(LoggerTest, ReadTailHandlesEdgeCases) {
+    const char *path = "test_logger_tail.txt";
+    std::vector<std::string> tail;
+
+    { std::ofstream file(path); }
+    EXPECT_EQ(logger_read_tail(path, 3, collect_line, &tail), 0);
+
+    {
+        std::ofstream file(path);
+        file << "첫째\n둘째\r\n셋째";
+    }
+    ASSERT_EQ(logger_read_tail(path, 2, collect_line, &tail), 2);
+    ASSERT_EQ(tail.size(), 2u);
+    EXPECT_EQ(tail[0], "둘째");
+    EXPECT_EQ(tail[1], "셋째");
+
+    std::filesystem::remove(path);
+}
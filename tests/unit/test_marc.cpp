@@ -0,0 +1,382 @@
+/**
+ * @file test_marc.cpp
+ * @brief MARC21 읽기/쓰기 단위 테스트
+ *
+ * 레코드 쓰기와 읽기, 필드 매핑, 손상된 레코드 건너뛰기, 일괄 가져오기, 내보내기를 테스트합니다.
+ */
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <string>
+
+extern "C" {
+    #include "database.h"
+    #include "book.h"
+    #include "book_import.h"
+    #include "marc.h"
+    #include "constants.h"
+}
+
+class MarcTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        test_db_path = "test_marc_library.db";
+        copy_db_path = "test_marc_copy.db";
+        marc_path = "test_marc.mrc";
+        export_path = "test_marc_export.mrc";
+        reject_path = "test_marc.rejects.mrc";
+        remove_test_files();
+
+        db = database_init(test_db_path);
+        ASSERT_NE(db, nullptr);
+
+        book_import_default_config(&config);
+        config.worker_threads = 2;
+        config.batch_rows = 2;
+        config.commit_rows = 4;
+        strcpy(config.reject_path, reject_path);
+    }
+
+    void TearDown() override {
+        if (db) {
+            database_close(db);
+        }
+        remove_test_files();
+    }
+
+    void remove_test_files() {
+        for (const char *path : { test_db_path, copy_db_path, marc_path, export_path, reject_path }) {
+            if (std::filesystem::exists(path)) {
+                std::filesystem::remove(path);
+            }
+        }
+    }
+
+    // MarcWriter로 레코드를 만들어 파일에 씀
+    static void write_records(const char *path, const std::function<void(MarcWriter*)> &build) {
+        FILE *file = fopen(path, "wb");
+        ASSERT_NE(file, nullptr);
+        MarcWriter writer;
+        ASSERT_EQ(marc_writer_init(&writer, file), SUCCESS);
+        build(&writer);
+        marc_writer_free(&writer);
+        fclose(file);
+    }
+
+    // 제목과 저자, ISBN만 있는 단순한 레코드
+    static void write_simple(MarcWriter *writer, const char *title, const char *author, const char *isbn) {
+        marc_writer_begin_record(writer, nullptr);
+        if (isbn) {
+            marc_writer_begin_field(writer, "020", ' ', ' ');
+            marc_writer_add_subfield(writer, 'a', isbn);
+        }
+        if (author) {
+            marc_writer_begin_field(writer, "100", '1', ' ');
+            marc_writer_add_subfield(writer, 'a', author);
+        }
+        if (title) {
+            marc_writer_begin_field(writer, "245", '1', '0');
+            marc_writer_add_subfield(writer, 'a', title);
+        }
+        ASSERT_EQ(marc_writer_end_record(writer), SUCCESS);
+    }
+
+    static void append_file(const char *path, const std::string &content) {
+        std::ofstream file(path, std::ios::binary | std::ios::app);
+        file << content;
+    }
+
+    long long query_int(const char *sql) {
+        sqlite3_stmt *stmt = nullptr;
+        long long value = -1;
+        if (sqlite3_prepare_v2(db, sql, -1, &stmt, nullptr) == SQLITE_OK && sqlite3_step(stmt) == SQLITE_ROW) {
+            value = sqlite3_column_int64(stmt, 0);
+        }
+        sqlite3_finalize(stmt);
+        return value;
+    }
+
+    sqlite3 *db = nullptr;
+    const char *test_db_path;
+    const char *copy_db_path;
+    const char *marc_path;
+    const char *export_path;
+    const char *reject_path;
+    BookImportConfig config;
+};
+
+// 쓴 레코드를 다시 읽으면 디렉터리와 하위 필드가 그대로여야 함
+TEST_F(MarcTest, ReadsWrittenRecord) {
+    write_records(marc_path, [](MarcWriter *writer) {
+        marc_writer_begin_record(writer, nullptr);
+        marc_writer_add_field(writer, "001", "42", 2);
+        marc_writer_begin_field(writer, "245", '1', '0');
+        marc_writer_add_subfield(writer, 'a', "토지 :");
+        marc_writer_add_subfield(writer, 'b', "1부 /");
+        marc_writer_add_subfield(writer, 'c', "박경리 지음.");
+        ASSERT_EQ(marc_writer_end_record(writer), SUCCESS);
+        EXPECT_EQ(writer->records, 1);
+    });
+
+    MarcReader reader;
+    MarcRecord record;
+    MarcField field;
+    ASSERT_EQ(marc_reader_open(&reader, marc_path), SUCCESS);
+    ASSERT_EQ(marc_reader_next(&reader, &record), TRUE);
+    EXPECT_EQ(record.offset, 0u);
+    EXPECT_EQ(record.length, reader.size);
+    EXPECT_EQ(record.field_count, 2);
+    EXPECT_EQ(memcmp(record.data + 5, "nam a22", 7), 0);
+
+    ASSERT_EQ(marc_record_field(&record, 0, &field), SUCCESS);
+    EXPECT_STREQ(field.tag, "001");
+    EXPECT_EQ(std::string((const char*)field.data, field.length), "42");
+
+    ASSERT_EQ(marc_record_find_field(&record, "245", &field), TRUE);
+    const char *value = nullptr;
+    size_t length = 0;
+    ASSERT_EQ(marc_field_subfield(&field, 'b', &value, &length), TRUE);
+    EXPECT_EQ(std::string(value, length), "1부 /");
+    EXPECT_EQ(marc_field_subfield(&field, 'z', &value, &length), FALSE);
+    EXPECT_EQ(marc_record_find_field(&record, "650", &field), FALSE);
+
+    EXPECT_EQ(marc_reader_next(&reader, &record), FALSE);
+    marc_reader_close(&reader);
+}
+
+// 표준 서지 필드를 도서 항목으로 옮기고 ISBD 구두점은 떼야 함
+TEST_F(MarcTest, MapsBibliographicFields) {
+    write_records(marc_path, [](MarcWriter *writer) {
+        marc_writer_begin_record(writer, nullptr);
+        marc_writer_begin_field(writer, "020", ' ', ' ');
+        marc_writer_add_subfield(writer, 'a', "0306406152 (pbk.)");
+        marc_writer_begin_field(writer, "020", ' ', ' ');
+        marc_writer_add_subfield(writer, 'a', "9788966260959");
+        marc_writer_begin_field(writer, "100", '1', ' ');
+        marc_writer_add_subfield(writer, 'a', "Knuth, Donald E.");
+        marc_writer_begin_field(writer, "245", '1', '4');
+        marc_writer_add_subfield(writer, 'a', "The art of computer programming :");
+        marc_writer_add_subfield(writer, 'b', "fundamental algorithms /");
+        marc_writer_add_subfield(writer, 'c', "Donald E. Knuth.");
+        marc_writer_begin_field(writer, "264", ' ', '1');
+        marc_writer_add_subfield(writer, 'a', "Reading, Mass. :");
+        marc_writer_add_subfield(writer, 'b', "Addison-Wesley,");
+        marc_writer_add_subfield(writer, 'c', "c1997.");
+        marc_writer_begin_field(writer, "650", ' ', '0');
+        marc_writer_add_subfield(writer, 'a', "Computer programming.");
+        ASSERT_EQ(marc_writer_end_record(writer), SUCCESS);
+
+        // 주표목이 없으면 책임표시로 대신함
+        marc_writer_begin_record(writer, nullptr);
+        marc_writer_begin_field(writer, "245", '0', '0');
+        marc_writer_add_subfield(writer, 'a', "한국 현대 소설선 /");
+        marc_writer_add_subfield(writer, 'c', "김영하 외 엮음.");
+        marc_writer_begin_field(writer, "949", ' ', ' ');
+        marc_writer_add_subfield(writer, 't', "3");
+        marc_writer_add_subfield(writer, 'v', "2");
+        ASSERT_EQ(marc_writer_end_record(writer), SUCCESS);
+    });
+
+    MarcReader reader;
+    MarcRecord record;
+    Book book;
+    ASSERT_EQ(marc_reader_open(&reader, marc_path), SUCCESS);
+
+    ASSERT_EQ(marc_reader_next(&reader, &record), TRUE);
+    ASSERT_EQ(marc_record_to_book(&record, &book), nullptr);
+    EXPECT_STREQ(book.isbn, "0306406152");
+    EXPECT_STREQ(book.author, "Knuth, Donald E.");
+    EXPECT_STREQ(book.title, "The art of computer programming : fundamental algorithms");
+    EXPECT_STREQ(book.publisher, "Addison-Wesley");
+    EXPECT_EQ(book.publication_year, 1997);
+    EXPECT_STREQ(book.category, "Computer programming");
+    EXPECT_EQ(book.total_copies, 1);
+    EXPECT_EQ(book.available_copies, 1);
+
+    ASSERT_EQ(marc_reader_next(&reader, &record), TRUE);
+    ASSERT_EQ(marc_record_to_book(&record, &book), nullptr);
+    EXPECT_STREQ(book.title, "한국 현대 소설선");
+    EXPECT_STREQ(book.author, "김영하 외 엮음");
+    EXPECT_STREQ(book.isbn, "");
+    EXPECT_EQ(book.total_copies, 3);
+    EXPECT_EQ(book.available_copies, 2);
+
+    marc_reader_close(&reader);
+}
+
+// 손상된 레코드는 건너뛰고 다음 레코드부터 이어서 읽어야 함
+TEST_F(MarcTest, SkipsCorruptRecords) {
+    write_records(marc_path, [](MarcWriter *writer) {
+        write_simple(writer, "첫 번째", "저자", nullptr);
+    });
+    append_file(marc_path, "\r\n00099nam a2200000   4500garbage\x1D");
+    write_records(export_path, [](MarcWriter *writer) {
+        write_simple(writer, "두 번째", "저자", nullptr);
+    });
+    {
+        std::ifstream second(export_path, std::ios::binary);
+        std::stringstream content;
+        content << second.rdbuf();
+        append_file(marc_path, content.str() + "\n");
+    }
+
+    MarcReader reader;
+    MarcRecord record;
+    Book book;
+    ASSERT_EQ(marc_reader_open(&reader, marc_path), SUCCESS);
+    EXPECT_EQ(marc_reader_next(&reader, &record), TRUE);
+
+    ASSERT_EQ(marc_reader_next(&reader, &record), FAILURE);
+    EXPECT_EQ(record.field_count, 0);
+    EXPECT_EQ(record.data[record.length - 1], 0x1D);
+    EXPECT_NE(marc_record_to_book(&record, &book), nullptr);
+
+    ASSERT_EQ(marc_reader_next(&reader, &record), TRUE);
+    ASSERT_EQ(marc_record_to_book(&record, &book), nullptr);
+    EXPECT_STREQ(book.title, "두 번째");
+    EXPECT_EQ(reader.records, 3);
+    EXPECT_EQ(marc_reader_next(&reader, &record), FALSE);
+    marc_reader_close(&reader);
+}
+
+// 리더 09가 유니코드가 아니면서 ASCII 밖의 바이트가 있으면 MARC-8로 보고 거부해야 함
+TEST_F(MarcTest, RejectsMarc8Records) {
+    write_records(marc_path, [](MarcWriter *writer) {
+        unsigned char leader[MARC_LEADER_LENGTH + 1];
+        memcpy(leader, "00000nam  2200000   4500", sizeof(leader));
+        marc_writer_begin_record(writer, leader);
+        marc_writer_begin_field(writer, "245", '1', '0');
+        marc_writer_add_subfield(writer, 'a', "Caf\xE2" "e");
+        marc_writer_begin_field(writer, "100", '1', ' ');
+        marc_writer_add_subfield(writer, 'a', "Author");
+        ASSERT_EQ(marc_writer_end_record(writer), SUCCESS);
+
+        marc_writer_begin_record(writer, leader);
+        marc_writer_begin_field(writer, "245", '1', '0');
+        marc_writer_add_subfield(writer, 'a', "Plain title");
+        marc_writer_begin_field(writer, "100", '1', ' ');
+        marc_writer_add_subfield(writer, 'a', "Author");
+        ASSERT_EQ(marc_writer_end_record(writer), SUCCESS);
+    });
+
+    MarcReader reader;
+    MarcRecord record;
+    Book book;
+    ASSERT_EQ(marc_reader_open(&reader, marc_path), SUCCESS);
+    ASSERT_EQ(marc_reader_next(&reader, &record), TRUE);
+    EXPECT_NE(marc_record_to_book(&record, &book), nullptr);
+    ASSERT_EQ(marc_reader_next(&reader, &record), TRUE);
+    EXPECT_EQ(marc_record_to_book(&record, &book), nullptr);
+    marc_reader_close(&reader);
+}
+
+// 일괄 가져오기는 .mrc를 MARC로 읽고 거부된 레코드는 사유를 덧붙인 MARC로 남겨야 함
+TEST_F(MarcTest, ImportsMarcFileWithRejects) {
+    write_records(marc_path, [](MarcWriter *writer) {
+        write_simple(writer, "The art of computer programming", "Knuth, Donald E.", "9780306406157");
+        write_simple(writer, "제목 없는 레코드", nullptr, "9788966260959");
+        write_simple(writer, "같은 책의 ISBN-10", "Knuth", "0-306-40615-2");
+        write_simple(writer, "토지", "박경리", nullptr);
+        write_simple(writer, "잘못된 ISBN", "저자", "97803064061");
+    });
+    append_file(marc_path, "00050broken\x1D");
+
+    BookImportStats stats;
+    ASSERT_EQ(book_import_file(db, marc_path, &config, &stats), SUCCESS);
+    EXPECT_EQ(stats.rows, 6);
+    EXPECT_EQ(stats.imported, 2);
+    EXPECT_EQ(stats.duplicates, 1);
+    EXPECT_EQ(stats.rejected, 3);
+
+    Book book;
+    ASSERT_EQ(get_book_by_isbn(db, "9780306406157", &book), SUCCESS);
+    EXPECT_STREQ(book.author, "Knuth, Donald E.");
+    EXPECT_EQ(query_int("SELECT COUNT(*) FROM books WHERE title = '토지' AND isbn IS NULL;"), 1);
+
+    // 거부 파일은 다시 MARC로 읽히고 999 필드에 사유와 레코드 번호가 있어야 함
+    MarcReader reader;
+    MarcRecord record;
+    MarcField field;
+    const char *value = nullptr;
+    size_t length = 0;
+    ASSERT_EQ(marc_reader_open(&reader, reject_path), SUCCESS);
+    ASSERT_EQ(marc_reader_next(&reader, &record), TRUE);
+    ASSERT_EQ(marc_record_find_field(&record, "245", &field), TRUE);
+    ASSERT_EQ(marc_record_find_field(&record, "999", &field), TRUE);
+    ASSERT_EQ(marc_field_subfield(&field, 'n', &value, &length), TRUE);
+    EXPECT_EQ(std::string(value, length), "2");
+
+    ASSERT_EQ(marc_reader_next(&reader, &record), TRUE);
+    ASSERT_EQ(marc_record_find_field(&record, "999", &field), TRUE);
+    ASSERT_EQ(marc_field_subfield(&field, 'a', &value, &length), TRUE);
+    EXPECT_EQ(std::string(value, length), "이미 있는 ISBN입니다");
+
+    EXPECT_EQ(marc_reader_next(&reader, &record), TRUE);
+    EXPECT_EQ(marc_reader_next(&reader, &record), FAILURE);
+    EXPECT_EQ(std::string((const char*)record.data, record.length), "00050broken\x1D");
+    EXPECT_EQ(marc_reader_next(&reader, &record), FALSE);
+    marc_reader_close(&reader);
+
+    // 끝까지 가져온 파일은 다시 실행해도 건너뜀
+    ASSERT_EQ(book_import_file(db, marc_path, &config, &stats), SUCCESS);
+    EXPECT_EQ(stats.imported, 0);
+    EXPECT_EQ(stats.resumed_lines, 6);
+}
+
+// 내보낸 파일을 다른 데이터베이스로 가져오면 같은 도서가 되어야 함
+TEST_F(MarcTest, ExportsAndReimportsCatalog) {
+    Book book;
+    init_book(&book);
+    strcpy(book.title, "토지 : 1부");
+    strcpy(book.author, "박경리");
+    strcpy(book.isbn, "9788966260959");
+    strcpy(book.publisher, "마로니에북스");
+    strcpy(book.category, "소설");
+    book.publication_year = 2012;
+    book.total_copies = 4;
+    book.available_copies = 4;
+    ASSERT_GT(add_book(db, &book), 0);
+
+    init_book(&book);
+    strcpy(book.title, "Dr. J.");
+    strcpy(book.author, "Smith, J.");
+    book.total_copies = 1;
+    book.available_copies = 1;
+    ASSERT_GT(add_book(db, &book), 0);
+
+    long long exported = 0;
+    ASSERT_EQ(marc_export_books(db, export_path, &exported), SUCCESS);
+    EXPECT_EQ(exported, 2);
+
+    sqlite3 *copy = database_init(copy_db_path);
+    ASSERT_NE(copy, nullptr);
+    config.reject_path[0] = '\0';
+    BookImportStats stats;
+    ASSERT_EQ(book_import_file(copy, export_path, &config, &stats), SUCCESS);
+    EXPECT_EQ(stats.imported, 2);
+
+    Book imported;
+    ASSERT_EQ(get_book_by_isbn(copy, "9788966260959", &imported), SUCCESS);
+    EXPECT_STREQ(imported.title, "토지 : 1부");
+    EXPECT_STREQ(imported.author, "박경리");
+    EXPECT_STREQ(imported.publisher, "마로니에북스");
+    EXPECT_STREQ(imported.category, "소설");
+    EXPECT_EQ(imported.publication_year, 2012);
+    EXPECT_EQ(imported.total_copies, 4);
+
+    // 이니셜 뒤의 마침표는 구두점으로 떼지 않아야 함
+    BookSearchResult result;
+    init_book_search_result(&result);
+    ASSERT_EQ(search_books_by_author(copy, "Smith", &result), SUCCESS);
+    ASSERT_EQ(result.count, 1);
+    EXPECT_STREQ(result.books[0].title, "Dr. J.");
+    EXPECT_STREQ(result.books[0].author, "Smith, J.");
+    EXPECT_EQ(result.books[0].publication_year, 0);
+    free_book_search_result(&result);
+    database_close(copy);
+}
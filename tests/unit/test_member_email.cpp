@@ -0,0 +1,207 @@
+/**
+ * @file test_member_email.cpp
+ * @brief 회원 이메일 대소문자 구분 없는 고유성/조회 단위 테스트
+ *
+ * 이메일 정규화 저장, 대소문자 무시 조회, 고유 제약, 기존 데이터베이스 변환을 테스트합니다.
+ */
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <cstring>
+#include <string>
+
+extern "C" {
+    #include "database.h"
+    #include "member.h"
+    #include "constants.h"
+}
+
+// 이메일 UNIQUE 제약이 대소문자를 구분하던 이전 버전의 회원 테이블
+static const char *LEGACY_MEMBERS_SQL =
+    "CREATE TABLE members (id INTEGER PRIMARY KEY AUTOINCREMENT, name TEXT NOT NULL, "
+    "email TEXT UNIQUE NOT NULL, phone TEXT, address TEXT, "
+    "registration_date TIMESTAMP DEFAULT CURRENT_TIMESTAMP, is_active INTEGER DEFAULT 1, "
+    "created_at TIMESTAMP DEFAULT CURRENT_TIMESTAMP, updated_at TIMESTAMP DEFAULT CURRENT_TIMESTAMP);"
+    "CREATE INDEX idx_members_email ON members(email);";
+
+class MemberEmailTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        test_db_path = "test_member_email_library.db";
+
+        if (std::filesystem::exists(test_db_path)) {
+            std::filesystem::remove(test_db_path);
+        }
+    }
+
+    void TearDown() override {
+        if (db) {
+            database_close(db);
+        }
+        if (std::filesystem::exists(test_db_path)) {
+            std::filesystem::remove(test_db_path);
+        }
+    }
+
+    void create_legacy_database(const char *rows_sql) {
+        sqlite3 *legacy = nullptr;
+        ASSERT_EQ(sqlite3_open(test_db_path, &legacy), SQLITE_OK);
+        ASSERT_EQ(sqlite3_exec(legacy, LEGACY_MEMBERS_SQL, nullptr, nullptr, nullptr), SQLITE_OK);
+        ASSERT_EQ(sqlite3_exec(legacy, rows_sql, nullptr, nullptr, nullptr), SQLITE_OK);
+        sqlite3_close(legacy);
+    }
+
+    int add_test_member(const char *name, const char *email) {
+        Member member;
+        memset(&member, 0, sizeof(Member));
+        strncpy(member.name, name, sizeof(member.name) - 1);
+        strncpy(member.email, email, sizeof(member.email) - 1);
+        member.is_active = TRUE;
+        return add_member(db, &member);
+    }
+
+    std::string query_text(const char *sql) {
+        std::string text;
+        sqlite3_stmt *stmt = nullptr;
+        if (sqlite3_prepare_v2(db, sql, -1, &stmt, nullptr) == SQLITE_OK) {
+            while (sqlite3_step(stmt) == SQLITE_ROW) {
+                const unsigned char *value = sqlite3_column_text(stmt, sqlite3_column_count(stmt) - 1);
+                text += value ? (const char*)value : "";
+                text += "\n";
+            }
+        }
+        sqlite3_finalize(stmt);
+        return text;
+    }
+
+    sqlite3 *db = nullptr;
+    const char *test_db_path;
+};
+
+// 이메일 정규화 테스트
+TEST_F(MemberEmailTest, NormalizeEmail) {
+    char email[MAX_EMAIL_LENGTH + 1];
+
+    ASSERT_EQ(normalize_email("  Hong.GilDong@Example.COM ", email, sizeof(email)), SUCCESS);
+    EXPECT_STREQ(email, "hong.gildong@example.com");
+    EXPECT_EQ(normalize_email("   ", email, sizeof(email)), FAILURE);
+    EXPECT_EQ(normalize_email("a@b.com", email, 4), FAILURE);
+}
+
+// 정규화 저장 및 대소문자 무시 조회/중복 거부 테스트
+TEST_F(MemberEmailTest, LookupAndUniquenessIgnoreCase) {
+    db = database_init(test_db_path);
+    ASSERT_NE(db, nullptr);
+
+    int member_id = add_test_member("홍길동", "Hong@Example.com");
+    ASSERT_GT(member_id, 0);
+
+    Member member;
+    ASSERT_EQ(get_member_by_email(db, "HONG@example.COM", &member), SUCCESS);
+    EXPECT_EQ(member.id, member_id);
+    EXPECT_STREQ(member.email, "hong@example.com");
+
+    EXPECT_EQ(add_test_member("홍길순", "hong@EXAMPLE.com"), FAILURE);
+
+    // 애플리케이션을 거치지 않은 쓰기도 데이터베이스 제약으로 거부
+    EXPECT_NE(sqlite3_exec(db, "INSERT INTO members (name, email) VALUES ('우회', 'HONG@EXAMPLE.COM');",
+                           nullptr, nullptr, nullptr), SQLITE_OK);
+}
+
+// 이메일 인덱스가 UNIQUE 제약 하나뿐이고 조회가 그 인덱스를 쓰는지 테스트
+TEST_F(MemberEmailTest, SingleEmailIndex) {
+    db = database_init(test_db_path);
+    ASSERT_NE(db, nullptr);
+
+    EXPECT_EQ(query_text("SELECT COUNT(*) FROM pragma_index_list('members') AS il "
+                         "JOIN pragma_index_info(il.name) AS ii WHERE ii.name = 'email';"), "1\n");
+    EXPECT_NE(query_text("EXPLAIN QUERY PLAN SELECT id FROM members WHERE email = 'a@b.com';")
+                  .find("sqlite_autoindex_members"), std::string::npos);
+    EXPECT_NE(query_text("EXPLAIN QUERY PLAN SELECT id FROM members WHERE email = 'a@b.com' COLLATE NOCASE;")
+                  .find("sqlite_autoindex_members"), std::string::npos);
+}
+
+// 중복이 없는 기존 데이터베이스 변환 테스트 (연결된 대출 기록 보존)
+TEST_F(MemberEmailTest, LegacyDatabaseIsMigrated) {
+    create_legacy_database(
+        "INSERT INTO members (name, email, phone, address) VALUES "
+        "('홍길동', 'Hong@Example.com', '', ''), ('김철수', 'kim@example.com', '', '');");
+
+    db = database_init(test_db_path);
+    ASSERT_NE(db, nullptr);
+    ASSERT_EQ(database_execute_query(db,
+        "INSERT INTO books (title, author) VALUES ('도서', '저자');"
+        "INSERT INTO loans (book_id, member_id, due_date) VALUES (1, 1, '2030-01-01 00:00:00');"), SUCCESS);
+    database_close(db);
+
+    // 변환 후 다시 열어도 대출 기록과 회원이 그대로 유지
+    db = database_init(test_db_path);
+    ASSERT_NE(db, nullptr);
+
+    EXPECT_EQ(query_text("SELECT email FROM members WHERE id = 1;"), "hong@example.com\n");
+    EXPECT_EQ(query_text("SELECT COUNT(*) FROM loans;"), "1\n");
+    EXPECT_EQ(query_text("SELECT COUNT(*) FROM sqlite_master WHERE name = 'idx_members_email';"), "0\n");
+    EXPECT_EQ(database_migrate_member_email(db), 0);
+    EXPECT_EQ(add_test_member("홍길순", "HONG@example.com"), FAILURE);
+}
+
+// 변환해도 삭제된 회원의 ID를 다시 쓰지 않음 (AUTOINCREMENT 최댓값 보존)
+TEST_F(MemberEmailTest, LegacyMigrationKeepsIdSequence) {
+    create_legacy_database(
+        "INSERT INTO members (name, email, phone, address) VALUES "
+        "('홍길동', 'hong@example.com', '', ''), ('김철수', 'kim@example.com', '', ''), "
+        "('박영희', 'park@example.com', '', '');"
+        "DELETE FROM members WHERE id = 3;");
+
+    db = database_init(test_db_path);
+    ASSERT_NE(db, nullptr);
+    EXPECT_EQ(query_text("SELECT COUNT(*) FROM sqlite_master WHERE name = 'idx_members_email';"), "0\n");
+    EXPECT_EQ(query_text("SELECT seq FROM sqlite_sequence WHERE name = 'members';"), "3\n");
+    EXPECT_EQ(add_test_member("이민수", "lee@example.com"), 4);
+}
+
+// 대소문자만 다른 중복이 있으면 보고하고 기존 구조 유지
+TEST_F(MemberEmailTest, LegacyConflictsAreReported) {
+    create_legacy_database(
+        "INSERT INTO members (name, email) VALUES ('홍길동', 'hong@example.com'), "
+        "('홍길동2', 'HONG@example.com'), ('김철수', 'kim@example.com');");
+
+    db = database_init(test_db_path);
+    ASSERT_NE(db, nullptr);
+
+    EXPECT_EQ(database_migrate_member_email(db), 1);
+    EXPECT_EQ(query_text("SELECT COUNT(*) FROM members;"), "3\n");
+
+    // 중복을 정리하면 변환됨
+    ASSERT_EQ(database_execute_query(db, "DELETE FROM members WHERE name = '홍길동2';"), SUCCESS);
+    EXPECT_EQ(database_migrate_member_email(db), 0);
+    EXPECT_NE(sqlite3_exec(db, "INSERT INTO members (name, email) VALUES ('우회', 'KIM@EXAMPLE.COM');",
+                           nullptr, nullptr, nullptr), SQLITE_OK);
+}
+
+// 중복 때문에 변환하지 못한 기존 테이블에서도 대소문자가 섞인 이메일을 찾고 중복 등록을 거부
+TEST_F(MemberEmailTest, LegacyMixedCaseEmailsStillMatch) {
+    create_legacy_database(
+        "INSERT INTO members (name, email, phone, address) VALUES ('홍길동', 'hong@example.com', '', ''), "
+        "('홍길동2', 'HONG@example.com', '', ''), ('박영희', 'Park@Example.com', '', '');");
+
+    db = database_init(test_db_path);
+    ASSERT_NE(db, nullptr);
+    ASSERT_EQ(database_migrate_member_email(db), 1);
+
+    Member member;
+    ASSERT_EQ(get_member_by_email(db, "park@example.com", &member), SUCCESS);
+    EXPECT_STREQ(member.email, "Park@Example.com");
+    ASSERT_EQ(get_member_by_email(db, "Hong@Example.COM", &member), SUCCESS);
+    EXPECT_EQ(member.id, 1);
+
+    EXPECT_EQ(add_test_member("박영희2", "PARK@example.com"), FAILURE);
+    EXPECT_EQ(query_text("SELECT COUNT(*) FROM members;"), "3\n");
+
+    int member_id = add_test_member("김철수", "kim@example.com");
+    ASSERT_GT(member_id, 0);
+    ASSERT_EQ(get_member_by_id(db, member_id, &member), SUCCESS);
+    strncpy(member.email, "park@EXAMPLE.com", sizeof(member.email) - 1);
+    EXPECT_EQ(update_member(db, &member), FAILURE);
+    EXPECT_EQ(query_text("SELECT email FROM members WHERE id = 4;"), "kim@example.com\n");
+}
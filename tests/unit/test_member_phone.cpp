@@ -0,0 +1,135 @@
+/**
+ * @file test_member_phone.cpp
+ * @brief 회원 전화번호 끝자리 검색 단위 테스트
+ *
+ * 전화번호 정규화, 끝자리 검색, 인덱스 사용, 기존 회원 보충 작업을 테스트합니다.
+ */
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <cstring>
+#include <string>
+
+extern "C" {
+    #include "database.h"
+    #include "member.h"
+    #include "constants.h"
+}
+
+class MemberPhoneTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        test_db_path = "test_member_phone_library.db";
+
+        if (std::filesystem::exists(test_db_path)) {
+            std::filesystem::remove(test_db_path);
+        }
+
+        db = database_init(test_db_path);
+        ASSERT_NE(db, nullptr);
+    }
+
+    void TearDown() override {
+        if (db) {
+            database_close(db);
+        }
+        if (std::filesystem::exists(test_db_path)) {
+            std::filesystem::remove(test_db_path);
+        }
+    }
+
+    int add_test_member(const char *name, const char *email, const char *phone) {
+        Member member;
+        memset(&member, 0, sizeof(Member));
+        strncpy(member.name, name, sizeof(member.name) - 1);
+        strncpy(member.email, email, sizeof(member.email) - 1);
+        strncpy(member.phone, phone, sizeof(member.phone) - 1);
+        member.is_active = TRUE;
+        return add_member(db, &member);
+    }
+
+    int count_by_phone(const char *phone) {
+        MemberSearchResult result;
+        if (init_member_search_result(&result) != SUCCESS) {
+            return -1;
+        }
+        int count = search_members_by_phone(db, phone, &result) == SUCCESS ? result.count : -1;
+        free_member_search_result(&result);
+        return count;
+    }
+
+    int count_rows(const char *sql) {
+        sqlite3_stmt *stmt = nullptr;
+        int count = -1;
+        if (sqlite3_prepare_v2(db, sql, -1, &stmt, nullptr) == SQLITE_OK &&
+            sqlite3_step(stmt) == SQLITE_ROW) {
+            count = sqlite3_column_int(stmt, 0);
+        }
+        sqlite3_finalize(stmt);
+        return count;
+    }
+
+    sqlite3 *db = nullptr;
+    const char *test_db_path;
+};
+
+// 전화번호 검증 및 숫자만 남기기 테스트
+TEST_F(MemberPhoneTest, NormalizePhone) {
+    char digits[MAX_PHONE_LENGTH + 1];
+
+    ASSERT_EQ(normalize_phone("(02) 123-4567", digits, sizeof(digits)), SUCCESS);
+    EXPECT_STREQ(digits, "021234567");
+
+    EXPECT_EQ(normalize_phone("010-1234-abcd", digits, sizeof(digits)), FAILURE);
+    EXPECT_EQ(normalize_phone("--", digits, sizeof(digits)), FAILURE);
+    EXPECT_EQ(validate_phone("010 1234 5678"), SUCCESS);
+}
+
+// 형식이 달라도 끝자리로 검색되는지 테스트
+TEST_F(MemberPhoneTest, SearchBySuffix) {
+    ASSERT_GT(add_test_member("홍길동", "hong@example.com", "010-1234-5678"), 0);
+    ASSERT_GT(add_test_member("김철수", "kim@example.com", "01099995678"), 0);
+    ASSERT_GT(add_test_member("이영희", "lee@example.com", "(02) 555-1234"), 0);
+
+    EXPECT_EQ(count_by_phone("5678"), 2);
+    EXPECT_EQ(count_by_phone("1234"), 1);
+    EXPECT_EQ(count_by_phone("010-1234-5678"), 1);
+    EXPECT_EQ(count_by_phone("0000"), 0);
+    EXPECT_EQ(count_by_phone("abc"), -1);
+
+    // 끝자리가 아닌 중간 숫자는 찾지 않음
+    EXPECT_EQ(count_by_phone("9999"), 0);
+}
+
+// 끝자리 검색이 인덱스 범위 조회로 처리되는지 테스트
+TEST_F(MemberPhoneTest, SuffixSearchUsesIndex) {
+    sqlite3_stmt *stmt = nullptr;
+    std::string plan;
+    ASSERT_EQ(sqlite3_prepare_v2(db,
+        "EXPLAIN QUERY PLAN SELECT id FROM members "
+        "WHERE phone_digits_reversed >= '8765' AND phone_digits_reversed < '8765:';",
+        -1, &stmt, nullptr), SQLITE_OK);
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+        plan += (const char*)sqlite3_column_text(stmt, 3);
+    }
+    sqlite3_finalize(stmt);
+
+    EXPECT_NE(plan.find("idx_members_phone_reversed"), std::string::npos);
+}
+
+// 검색 컬럼이 비어 있는 기존 회원 보충 테스트
+TEST_F(MemberPhoneTest, BackfillFillsMissingColumns) {
+    ASSERT_EQ(database_execute_query(db,
+        "WITH RECURSIVE n(i) AS (SELECT 1 UNION ALL SELECT i + 1 FROM n WHERE i < 1500) "
+        "INSERT INTO members (name, email, phone) "
+        "SELECT '회원' || i, 'm' || i || '@example.com', '010-0000-' || printf('%04d', i) FROM n;"),
+        SUCCESS);
+    ASSERT_EQ(count_rows("SELECT COUNT(*) FROM members WHERE phone_digits IS NULL;"), 1500);
+
+    // 배치 크기보다 많아도 한 번 호출로 모두 채움
+    EXPECT_EQ(backfill_member_phone_digits(db), 1500);
+    EXPECT_EQ(backfill_member_phone_digits(db), 0);
+
+    EXPECT_EQ(count_by_phone("1234"), 1);
+    EXPECT_EQ(count_rows("SELECT COUNT(*) FROM members WHERE phone_digits_reversed = '43210000010';"), 1);
+}
@@ -0,0 +1,215 @@
+/**
+ * @file test_metrics.cpp
+ * @brief 타이머 및 지연 시간 히스토그램 단위 테스트
+ *
+ * 단조 시계 타이머, 백분위수 정확도, 동시 기록, API별 기록, 파일 저장을 테스트합니다.
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+extern "C" {
+    #include "database.h"
+    #include "book.h"
+    #include "member.h"
+    #include "loan.h"
+    #include "metrics.h"
+    #include "utils.h"
+    #include "constants.h"
+}
+
+class MetricsTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        test_db_path = "test_metrics_library.db";
+        dump_path = "test_metrics_dump.txt";
+
+        if (std::filesystem::exists(test_db_path)) {
+            std::filesystem::remove(test_db_path);
+        }
+
+        db = database_init(test_db_path);
+        ASSERT_NE(db, nullptr);
+        metrics_reset();
+    }
+
+    void TearDown() override {
+        if (db) {
+            database_close(db);
+        }
+        if (std::filesystem::exists(test_db_path)) {
+            std::filesystem::remove(test_db_path);
+        }
+        if (std::filesystem::exists(dump_path)) {
+            std::filesystem::remove(dump_path);
+        }
+    }
+
+    MetricSummary summary_of(MetricId id) {
+        MetricSummary summary;
+        EXPECT_EQ(metrics_get_summary(id, &summary), SUCCESS);
+        return summary;
+    }
+
+    sqlite3 *db = nullptr;
+    const char *test_db_path;
+    const char *dump_path;
+};
+
+// 잠들어 있는 시간(CPU를 쓰지 않는 대기)도 측정하는지 테스트
+TEST_F(MetricsTest, TimerIncludesWaitTime) {
+    Timer timer;
+    timer_start(&timer);
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    timer_stop(&timer);
+
+    EXPECT_GE(timer_get_elapsed_milliseconds(&timer), 29.0);
+    EXPECT_LT(timer_get_elapsed_seconds(&timer), 5.0);
+
+    long long first = timer_now_nanoseconds();
+    long long second = timer_now_nanoseconds();
+    EXPECT_GE(second, first);
+}
+
+// 알려진 분포의 백분위수가 상대 오차 1/16 이내인지 테스트
+TEST_F(MetricsTest, PercentilesWithinBucketPrecision) {
+    // 1us ~ 1000us를 한 번씩 기록
+    for (long long us = 1; us <= 1000; us++) {
+        metrics_record(METRIC_ADD_BOOK, us * 1000);
+    }
+
+    MetricSummary summary = summary_of(METRIC_ADD_BOOK);
+    EXPECT_STREQ(summary.name, "add_book");
+    EXPECT_EQ(summary.count, 1000);
+    EXPECT_EQ(summary.max, 1000000);
+    EXPECT_EQ(summary.mean, 500500);
+
+    EXPECT_NEAR((double)summary.p50, 500000.0, 500000.0 / 16);
+    EXPECT_NEAR((double)summary.p95, 950000.0, 950000.0 / 16);
+    EXPECT_NEAR((double)summary.p99, 990000.0, 990000.0 / 16);
+    EXPECT_GE(summary.p50, 500000);
+    EXPECT_LE(summary.p99, summary.max);
+
+    // 한 번만 느린 호출은 p99 아래로 감춰지지 않고 최댓값에 그대로 남음
+    metrics_record(METRIC_ADD_BOOK, 5000000000LL);
+    summary = summary_of(METRIC_ADD_BOOK);
+    EXPECT_EQ(summary.max, 5000000000LL);
+    EXPECT_LT(summary.p99, 2000000);
+
+    // 아주 작거나 큰 값도 기록 가능
+    metrics_record(METRIC_GET_BOOK_BY_ID, 3);
+    metrics_record(METRIC_GET_BOOK_BY_ID, -5);
+    metrics_record(METRIC_GET_BOOK_BY_ID, 1LL << 60);
+    EXPECT_EQ(summary_of(METRIC_GET_BOOK_BY_ID).count, 3);
+    EXPECT_EQ(summary_of(METRIC_GET_BOOK_BY_ID).max, 1LL << 60);
+}
+
+// 여러 스레드가 동시에 기록해도 빠짐없이 세는지 테스트
+TEST_F(MetricsTest, ConcurrentRecording) {
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([t]() {
+            for (int i = 0; i < 10000; i++) {
+                metrics_record(METRIC_LOAN_BOOK, (long long)(t + 1) * 1000);
+            }
+        });
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+
+    MetricSummary summary = summary_of(METRIC_LOAN_BOOK);
+    EXPECT_EQ(summary.count, 40000);
+    EXPECT_EQ(summary.max, 4000);
+    EXPECT_EQ(summary.mean, 2500);
+}
+
+// 공개 API를 호출하면 해당 히스토그램에 기록되는지 테스트
+TEST_F(MetricsTest, PublicApisRecordLatency) {
+    Book book;
+    memset(&book, 0, sizeof(Book));
+    strncpy(book.title, "자바 프로그래밍", sizeof(book.title) - 1);
+    strncpy(book.author, "김개발", sizeof(book.author) - 1);
+    strncpy(book.isbn, "9788966260001", sizeof(book.isbn) - 1);
+    book.total_copies = 1;
+    book.available_copies = 1;
+    int book_id = add_book(db, &book);
+    ASSERT_GT(book_id, 0);
+
+    Book found;
+    ASSERT_EQ(get_book_by_id(db, book_id, &found), SUCCESS);
+    ASSERT_EQ(get_book_by_id(db, book_id, &found), SUCCESS);
+
+    // 실패한 호출도 기록
+    EXPECT_EQ(get_member_by_id(db, 0, nullptr), FAILURE);
+
+    EXPECT_EQ(summary_of(METRIC_ADD_BOOK).count, 1);
+    EXPECT_EQ(summary_of(METRIC_GET_BOOK_BY_ID).count, 2);
+    EXPECT_EQ(summary_of(METRIC_GET_MEMBER_BY_ID).count, 1);
+    EXPECT_EQ(summary_of(METRIC_GET_MEMBER_BY_ID).failures, 1);
+    EXPECT_EQ(summary_of(METRIC_ADD_BOOK).failures, 0);
+    EXPECT_EQ(summary_of(METRIC_UPDATE_BOOK).count, 0);
+    EXPECT_GT(summary_of(METRIC_ADD_BOOK).max, 0);
+}
+
+// 공개 API 안에서 부른 다른 공개 API는 따로 기록하지 않는지 테스트
+TEST_F(MetricsTest, NestedApiCallsRecordOnlyOutermost) {
+    Book book;
+    memset(&book, 0, sizeof(Book));
+    strncpy(book.title, "자바 프로그래밍", sizeof(book.title) - 1);
+    strncpy(book.author, "김개발", sizeof(book.author) - 1);
+    strncpy(book.isbn, "9788966260001", sizeof(book.isbn) - 1);
+    book.total_copies = 1;
+    book.available_copies = 1;
+    int book_id = add_book(db, &book);
+    ASSERT_GT(book_id, 0);
+
+    Member member;
+    memset(&member, 0, sizeof(Member));
+    strncpy(member.name, "홍길동", sizeof(member.name) - 1);
+    strncpy(member.email, "hong@example.com", sizeof(member.email) - 1);
+    strncpy(member.phone, "010-1234-5678", sizeof(member.phone) - 1);
+    member.is_active = TRUE;
+    int member_id = add_member(db, &member);
+    ASSERT_GT(member_id, 0);
+
+    metrics_reset();
+    ASSERT_GT(loan_book(db, book_id, member_id, 14), 0);
+
+    long long samples = 0;
+    for (int id = 0; id < METRIC_COUNT; id++) {
+        samples += summary_of(static_cast<MetricId>(id)).count;
+    }
+    EXPECT_EQ(summary_of(METRIC_LOAN_BOOK).count, 1);
+    EXPECT_EQ(samples, 1);
+    EXPECT_EQ(metrics_call_depth(), 0);
+}
+
+// 파일로 저장한 표에 기록된 API만 들어가는지 테스트
+TEST_F(MetricsTest, DumpWritesRecordedApis) {
+    metrics_record(METRIC_SEARCH_MEMBERS_BY_NAME, 1500000);
+    metrics_record(METRIC_RETURN_BOOK, 2500000);
+
+    ASSERT_EQ(metrics_dump(dump_path), SUCCESS);
+
+    std::ifstream file(dump_path);
+    std::stringstream content;
+    content << file.rdbuf();
+    std::string text = content.str();
+
+    EXPECT_NE(text.find("search_members_by_name"), std::string::npos);
+    EXPECT_NE(text.find("return_book"), std::string::npos);
+    EXPECT_EQ(text.find("add_book"), std::string::npos);
+    EXPECT_NE(text.find("2.500"), std::string::npos);
+
+    EXPECT_EQ(metrics_name(METRIC_COUNT), nullptr);
+    EXPECT_EQ(metrics_get_summary(METRIC_COUNT, nullptr), FAILURE);
+    EXPECT_EQ(metrics_dump("no_such_dir/metrics.txt"), FAILURE);
+}
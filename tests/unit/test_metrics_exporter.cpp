@@ -0,0 +1,263 @@
+/**
+ * @file test_metrics_exporter.cpp
+ * @brief Prometheus 지표 내보내기 단위 테스트
+ *
+ * 텍스트 형식, 결과별 호출 수, 히스토그램 누적 값, 대출 현황 지표,
+ * 파일 갱신, 유닉스 도메인 소켓 응답을 테스트합니다.
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+extern "C" {
+    #include "database.h"
+    #include "book.h"
+    #include "member.h"
+    #include "loan.h"
+    #include "metrics.h"
+    #include "metrics_exporter.h"
+    #include "constants.h"
+}
+
+class MetricsExporterTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        test_db_path = "test_metrics_exporter_library.db";
+        textfile_path = "test_metrics_exporter.prom";
+        socket_path = "test_metrics_exporter.sock";
+
+        remove_test_files();
+        db = database_init(test_db_path);
+        ASSERT_NE(db, nullptr);
+        metrics_reset();
+    }
+
+    void TearDown() override {
+        metrics_exporter_stop();
+        if (db) {
+            database_close(db);
+        }
+        remove_test_files();
+    }
+
+    void remove_test_files() {
+        for (const char *path : { test_db_path, textfile_path, socket_path }) {
+            if (std::filesystem::exists(path)) {
+                std::filesystem::remove(path);
+            }
+        }
+    }
+
+    int add_test_book(const char *isbn) {
+        Book book;
+        memset(&book, 0, sizeof(Book));
+        strncpy(book.title, "도서", sizeof(book.title) - 1);
+        strncpy(book.author, "저자", sizeof(book.author) - 1);
+        strncpy(book.isbn, isbn, sizeof(book.isbn) - 1);
+        book.total_copies = 2;
+        book.available_copies = 2;
+        return add_book(db, &book);
+    }
+
+    int add_test_member(const char *email) {
+        Member member;
+        memset(&member, 0, sizeof(Member));
+        strncpy(member.name, "회원", sizeof(member.name) - 1);
+        strncpy(member.email, email, sizeof(member.email) - 1);
+        member.is_active = TRUE;
+        return add_member(db, &member);
+    }
+
+    std::string format_metrics() {
+        char *text = nullptr;
+        size_t length = 0;
+        EXPECT_EQ(metrics_format_prometheus(db, &text, &length), SUCCESS);
+        std::string result = text ? std::string(text, length) : "";
+        free(text);
+        return result;
+    }
+
+    static std::string read_file(const char *path) {
+        std::ifstream file(path);
+        std::stringstream content;
+        content << file.rdbuf();
+        return content.str();
+    }
+
+    // "이름{라벨} 값" 줄의 값을 찾음 (없으면 -1)
+    static double sample_value(const std::string &text, const std::string &series) {
+        std::istringstream lines(text);
+        std::string line;
+        while (std::getline(lines, line)) {
+            if (line.compare(0, series.size() + 1, series + " ") == 0) {
+                return std::stod(line.substr(series.size() + 1));
+            }
+        }
+        return -1;
+    }
+
+    sqlite3 *db = nullptr;
+    const char *test_db_path;
+    const char *textfile_path;
+    const char *socket_path;
+};
+
+// 모든 줄이 Prometheus 텍스트 형식을 따르는지 테스트
+TEST_F(MetricsExporterTest, OutputIsValidExpositionFormat) {
+    ASSERT_GT(add_test_book("9788966260001"), 0);
+
+    std::string text = format_metrics();
+    std::regex sample("^[a-zA-Z_:][a-zA-Z0-9_:]*(\\{[a-zA-Z_][a-zA-Z0-9_]*=\"[^\"]*\"(,[a-zA-Z_][a-zA-Z0-9_]*=\"[^\"]*\")*\\})? "
+                      "-?[0-9.eE+-]+$");
+    std::regex comment("^# (HELP|TYPE) [a-zA-Z_:][a-zA-Z0-9_:]* .+$");
+
+    std::istringstream lines(text);
+    std::string line;
+    int samples = 0;
+    while (std::getline(lines, line)) {
+        if (line[0] == '#') {
+            EXPECT_TRUE(std::regex_match(line, comment)) << line;
+        } else {
+            EXPECT_TRUE(std::regex_match(line, sample)) << line;
+            samples++;
+        }
+    }
+    EXPECT_GT(samples, 20);
+    EXPECT_NE(text.find("# TYPE library_api_latency_seconds histogram"), std::string::npos);
+}
+
+// 결과별 호출 수와 히스토그램 누적 값 테스트
+TEST_F(MetricsExporterTest, ApiCountersAndHistogram) {
+    ASSERT_GT(add_test_book("9788966260001"), 0);
+    EXPECT_EQ(add_test_book("9788966260001"), FAILURE);   // ISBN 중복
+    ASSERT_GT(add_test_book("9788966260002"), 0);
+
+    std::string text = format_metrics();
+    EXPECT_EQ(sample_value(text, "library_api_calls_total{api=\"add_book\",outcome=\"success\"}"), 2);
+    EXPECT_EQ(sample_value(text, "library_api_calls_total{api=\"add_book\",outcome=\"failure\"}"), 1);
+    EXPECT_EQ(text.find("api=\"update_book\""), std::string::npos);
+
+    EXPECT_EQ(sample_value(text, "library_api_latency_seconds_count{api=\"add_book\"}"), 3);
+    EXPECT_EQ(sample_value(text, "library_api_latency_seconds_bucket{api=\"add_book\",le=\"+Inf\"}"), 3);
+    EXPECT_GT(sample_value(text, "library_api_latency_seconds_sum{api=\"add_book\"}"), 0);
+
+    // 누적 값은 경계가 커질수록 줄지 않음
+    metrics_record(METRIC_GET_BOOK_BY_ID, 200000);       // 0.2ms
+    metrics_record(METRIC_GET_BOOK_BY_ID, 3000000);      // 3ms
+    metrics_record(METRIC_GET_BOOK_BY_ID, 20000000000LL);  // 20s
+    text = format_metrics();
+    const char *prefix = "library_api_latency_seconds_bucket{api=\"get_book_by_id\",le=\"";
+    EXPECT_EQ(sample_value(text, std::string(prefix) + "0.0001\"}"), 0);
+    EXPECT_EQ(sample_value(text, std::string(prefix) + "0.00025\"}"), 1);
+    EXPECT_EQ(sample_value(text, std::string(prefix) + "0.0025\"}"), 1);
+    EXPECT_EQ(sample_value(text, std::string(prefix) + "0.005\"}"), 2);
+    EXPECT_EQ(sample_value(text, std::string(prefix) + "10\"}"), 2);
+    EXPECT_EQ(sample_value(text, std::string(prefix) + "+Inf\"}"), 3);
+}
+
+// 대출 현황과 SQLite 상태 지표 테스트
+TEST_F(MetricsExporterTest, DatabaseGauges) {
+    int book_id = add_test_book("9788966260001");
+    int first_member = add_test_member("a@example.com");
+    int second_member = add_test_member("b@example.com");
+    ASSERT_GT(book_id, 0);
+    ASSERT_GT(loan_book(db, book_id, first_member, 14), 0);
+    ASSERT_GT(loan_book(db, book_id, second_member, 14), 0);
+
+    std::string text = format_metrics();
+    EXPECT_EQ(sample_value(text, "library_open_loans"), 2);
+    EXPECT_EQ(sample_value(text, "library_overdue_loans"), 0);
+    EXPECT_EQ(sample_value(text, "library_books"), 1);
+    EXPECT_EQ(sample_value(text, "library_active_members"), 2);
+    EXPECT_GT(sample_value(text, "library_sqlite_memory_used_bytes"), 0);
+    EXPECT_GT(sample_value(text, "library_sqlite_page_cache_bytes"), 0);
+    EXPECT_GT(sample_value(text, "library_database_file_bytes"), 0);
+    EXPECT_GE(sample_value(text, "library_database_wal_bytes"), 0);
+    EXPECT_GE(sample_value(text, "library_log_dropped_total"), 0);
+}
+
+// 파일로 내보내기와 주기적 갱신 테스트
+TEST_F(MetricsExporterTest, TextfileIsWrittenAndRefreshed) {
+    ASSERT_EQ(metrics_write_textfile(db, textfile_path), SUCCESS);
+    EXPECT_NE(read_file(textfile_path).find("library_sqlite_memory_used_bytes"), std::string::npos);
+    EXPECT_FALSE(std::filesystem::exists(std::string(textfile_path) + ".tmp"));
+    std::filesystem::remove(textfile_path);
+
+    MetricsExporterConfig config;
+    memset(&config, 0, sizeof(config));
+    strncpy(config.textfile_path, textfile_path, sizeof(config.textfile_path) - 1);
+    config.interval_seconds = 1;
+    ASSERT_EQ(metrics_exporter_start(db, &config), SUCCESS);
+
+    // 시작하자마자 한 번 씀
+    for (int i = 0; i < 50 && !std::filesystem::exists(textfile_path); i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+    ASSERT_TRUE(std::filesystem::exists(textfile_path));
+
+    // 종료 직전 값도 반영
+    ASSERT_GT(add_test_book("9788966260001"), 0);
+    metrics_exporter_stop();
+    EXPECT_EQ(sample_value(read_file(textfile_path),
+                           "library_api_calls_total{api=\"add_book\",outcome=\"success\"}"), 1);
+}
+
+#ifndef _WIN32
+static std::string read_from_socket(const char *path, const char *request) {
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    struct sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    strncpy(address.sun_path, path, sizeof(address.sun_path) - 1);
+    if (connect(fd, (struct sockaddr*)&address, sizeof(address)) != 0) {
+        close(fd);
+        return "";
+    }
+    if (request) {
+        send(fd, request, strlen(request), 0);
+    }
+
+    std::string response;
+    char buffer[4096];
+    ssize_t received;
+    while ((received = recv(fd, buffer, sizeof(buffer), 0)) > 0) {
+        response.append(buffer, (size_t)received);
+    }
+    close(fd);
+    return response;
+}
+
+// 유닉스 도메인 소켓으로 지표를 가져오는지 테스트 (그대로/HTTP)
+TEST_F(MetricsExporterTest, ServesOverUnixSocket) {
+    MetricsExporterConfig config;
+    memset(&config, 0, sizeof(config));
+    strncpy(config.socket_path, socket_path, sizeof(config.socket_path) - 1);
+    config.interval_seconds = 60;
+    ASSERT_EQ(metrics_exporter_start(db, &config), SUCCESS);
+
+    std::string raw = read_from_socket(socket_path, nullptr);
+    EXPECT_EQ(raw.compare(0, 7, "# HELP "), 0);
+    EXPECT_NE(raw.find("library_sqlite_memory_used_bytes"), std::string::npos);
+
+    std::string http = read_from_socket(socket_path, "GET /metrics HTTP/1.1\r\nHost: localhost\r\n\r\n");
+    EXPECT_EQ(http.compare(0, 15, "HTTP/1.0 200 OK"), 0);
+    EXPECT_NE(http.find("Content-Type: text/plain; version=0.0.4"), std::string::npos);
+    EXPECT_NE(http.find("\r\n\r\n# HELP "), std::string::npos);
+
+    metrics_exporter_stop();
+    EXPECT_FALSE(std::filesystem::exists(socket_path));
+}
+#endif
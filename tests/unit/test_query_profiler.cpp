@@ -0,0 +1,188 @@
+/**
+ * @file test_query_profiler.cpp
+ * @brief SQL 프로파일러 단위 테스트
+ *
+ * SQL 정규화, 문장별 누적 통계, 스캔/정렬/자동 인덱스 집계, 느린 쿼리 로그, 보고서를 테스트합니다.
+ */
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+extern "C" {
+    #include "database.h"
+    #include "query_profiler.h"
+    #include "constants.h"
+}
+
+class QueryProfilerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        test_db_path = "test_query_profiler_library.db";
+        slow_log_path = "test_query_profiler_slow.log";
+        remove_test_files();
+        query_profiler_reset();
+    }
+
+    void TearDown() override {
+        if (db) {
+            database_close(db);
+        }
+        query_profiler_configure(FALSE, QUERY_PROFILER_SLOW_THRESHOLD_MS, nullptr);
+        query_profiler_reset();
+        remove_test_files();
+    }
+
+    void remove_test_files() {
+        for (const char *path : { test_db_path, slow_log_path }) {
+            if (std::filesystem::exists(path)) {
+                std::filesystem::remove(path);
+            }
+        }
+    }
+
+    void open_database() {
+        db = database_init(test_db_path);
+        ASSERT_NE(db, nullptr);
+        query_profiler_reset();   // 테이블 생성 문장은 제외
+    }
+
+    void insert_books(int count) {
+        std::string sql =
+            "WITH RECURSIVE n(i) AS (SELECT 1 UNION ALL SELECT i + 1 FROM n WHERE i < " + std::to_string(count) + ") "
+            "INSERT INTO books (title, author, publisher) SELECT '도서' || i, '저자', '출판사' || (i % 10) FROM n;";
+        ASSERT_EQ(database_execute_query(db, sql.c_str()), SUCCESS);
+    }
+
+    bool find_entry(const char *sql, QueryProfileEntry *found) {
+        QueryProfileEntry entries[QUERY_PROFILER_MAX_STATEMENTS + 1];
+        int count = query_profiler_get_top(entries, QUERY_PROFILER_MAX_STATEMENTS + 1);
+        for (int i = 0; i < count; i++) {
+            if (strcmp(entries[i].sql, sql) == 0) {
+                *found = entries[i];
+                return true;
+            }
+        }
+        return false;
+    }
+
+    sqlite3 *db = nullptr;
+    const char *test_db_path;
+    const char *slow_log_path;
+};
+
+// 리터럴과 공백 정규화 테스트
+TEST_F(QueryProfilerTest, NormalizeReplacesLiterals) {
+    char normalized[QUERY_PROFILER_SQL_LENGTH];
+
+    query_profiler_normalize("SELECT *  FROM books\n  WHERE id = 42 AND title = 'It''s' AND price > 1.5e3 ;",
+                             normalized, sizeof(normalized));
+    EXPECT_STREQ(normalized, "SELECT * FROM books WHERE id = ? AND title = ? AND price > ?");
+
+    query_profiler_normalize("SELECT col1 FROM t2 WHERE x=-7", normalized, sizeof(normalized));
+    EXPECT_STREQ(normalized, "SELECT col1 FROM t2 WHERE x=-?");
+
+    query_profiler_normalize("SELECT 1234567890", normalized, 8);
+    EXPECT_STREQ(normalized, "SELECT");
+}
+
+// 값만 다른 문장이 하나로 집계되는지 테스트
+TEST_F(QueryProfilerTest, AggregatesByNormalizedStatement) {
+    ASSERT_EQ(query_profiler_configure(TRUE, -1, nullptr), SUCCESS);
+    open_database();
+    insert_books(20);
+
+    ASSERT_EQ(database_execute_query(db, "SELECT title FROM books WHERE id = 1;"), SUCCESS);
+    ASSERT_EQ(database_execute_query(db, "SELECT title FROM books WHERE id = 2;"), SUCCESS);
+    ASSERT_EQ(database_execute_query(db, "SELECT title FROM books WHERE id = 3;"), SUCCESS);
+
+    QueryProfileEntry entry;
+    ASSERT_TRUE(find_entry("SELECT title FROM books WHERE id = ?", &entry));
+    EXPECT_EQ(entry.count, 3);
+    EXPECT_GE(entry.total_time, entry.max_time);
+    EXPECT_GT(entry.max_time, 0);
+    EXPECT_EQ(entry.fullscan_steps, 0);   // 기본 키 조회
+    EXPECT_EQ(entry.slow_count, 0);
+}
+
+// 전체 스캔/정렬/자동 인덱스가 집계되는지 테스트
+TEST_F(QueryProfilerTest, CountsScansSortsAndAutoindex) {
+    ASSERT_EQ(query_profiler_configure(TRUE, -1, nullptr), SUCCESS);
+    open_database();
+    insert_books(200);
+
+    ASSERT_EQ(database_execute_query(db, "SELECT COUNT(*) FROM books WHERE publisher = '출판사3';"), SUCCESS);
+    ASSERT_EQ(database_execute_query(db, "SELECT title FROM books ORDER BY publisher;"), SUCCESS);
+    ASSERT_EQ(database_execute_query(db,
+        "SELECT COUNT(*) FROM books a JOIN books b ON a.publisher = b.publisher;"), SUCCESS);
+
+    QueryProfileEntry entry;
+    ASSERT_TRUE(find_entry("SELECT COUNT(*) FROM books WHERE publisher = ?", &entry));
+    EXPECT_GE(entry.fullscan_steps, 199);
+
+    ASSERT_TRUE(find_entry("SELECT title FROM books ORDER BY publisher", &entry));
+    EXPECT_GE(entry.sorts, 1);
+
+    ASSERT_TRUE(find_entry("SELECT COUNT(*) FROM books a JOIN books b ON a.publisher = b.publisher", &entry));
+    EXPECT_GT(entry.autoindex_rows, 0);
+
+    // 보고서는 총 시간이 긴 순서
+    QueryProfileEntry top[2];
+    ASSERT_EQ(query_profiler_get_top(top, 2), 2);
+    EXPECT_GE(top[0].total_time, top[1].total_time);
+}
+
+// 기준을 넘은 문장이 실제 값과 함께 느린 쿼리 로그에 남는지 테스트
+TEST_F(QueryProfilerTest, SlowQueriesAreLogged) {
+    ASSERT_EQ(query_profiler_configure(TRUE, 0, slow_log_path), SUCCESS);
+    open_database();
+
+    sqlite3_stmt *stmt = nullptr;
+    ASSERT_EQ(database_prepare_statement(db, "SELECT title FROM books WHERE id = ?;", &stmt), SUCCESS);
+    sqlite3_bind_int(stmt, 1, 777);
+    sqlite3_step(stmt);
+    sqlite3_finalize(stmt);
+
+    // 로그 파일을 닫아 내용을 확정
+    query_profiler_configure(FALSE, -1, nullptr);
+
+    std::ifstream file(slow_log_path);
+    std::stringstream content;
+    content << file.rdbuf();
+    EXPECT_NE(content.str().find("SELECT title FROM books WHERE id = 777"), std::string::npos);
+    EXPECT_NE(content.str().find("fullscan=0"), std::string::npos);
+
+    QueryProfileEntry entry;
+    ASSERT_TRUE(find_entry("SELECT title FROM books WHERE id = ?", &entry));
+    EXPECT_EQ(entry.slow_count, 1);
+}
+
+// 꺼져 있으면 통계를 모으지 않는지, 보고서/초기화 테스트
+TEST_F(QueryProfilerTest, DisabledAndReport) {
+    ASSERT_EQ(query_profiler_configure(FALSE, -1, nullptr), SUCCESS);
+    EXPECT_EQ(query_profiler_is_enabled(), FALSE);
+    open_database();
+    ASSERT_EQ(database_execute_query(db, "SELECT COUNT(*) FROM books;"), SUCCESS);
+
+    QueryProfileEntry entries[4];
+    EXPECT_EQ(query_profiler_get_top(entries, 4), 0);
+
+    ASSERT_EQ(query_profiler_attach(db), SUCCESS);
+    ASSERT_EQ(database_execute_query(db, "SELECT COUNT(*) FROM books;"), SUCCESS);
+    EXPECT_EQ(query_profiler_get_top(entries, 4), 1);
+
+    char buffer[4096] = {0};
+    FILE *output = tmpfile();
+    ASSERT_NE(output, nullptr);
+    EXPECT_EQ(query_profiler_report(output, 5), 1);
+    rewind(output);
+    size_t length = fread(buffer, 1, sizeof(buffer) - 1, output);
+    fclose(output);
+    EXPECT_NE(std::string(buffer, length).find("SELECT COUNT(*) FROM books"), std::string::npos);
+
+    query_profiler_reset();
+    EXPECT_EQ(query_profiler_get_top(entries, 4), 0);
+}
@@ -0,0 +1,255 @@
+/**
+ * @file test_workload_trace.cpp
+ * @brief 호출 기록과 재실행 단위 테스트
+ *
+ * 트레이스 파일 왕복, 중첩 호출 제외, 시작 시점 사본, 재실행 결과 일치, 손상된 파일 거부를 테스트합니다.
+ */
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+extern "C" {
+    #include "database.h"
+    #include "book.h"
+    #include "member.h"
+    #include "loan.h"
+    #include "calendar.h"
+    #include "workload_trace.h"
+    #include "workload_replay.h"
+    #include "constants.h"
+}
+
+class WorkloadTraceTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        test_db_path = "test_workload_trace_library.db";
+        trace_path = "test_workload_trace.trace";
+        snapshot_path = trace_path + WORKLOAD_TRACE_SNAPSHOT_SUFFIX;
+        work_db_path = "test_workload_trace_replay.db";
+        remove_test_files();
+
+        db = database_init(test_db_path);
+        ASSERT_NE(db, nullptr);
+        calendar_invalidate_cache();
+
+        book_id = add_test_book("9788966260959");
+        ASSERT_GT(book_id, 0);
+
+        Member member;
+        memset(&member, 0, sizeof(Member));
+        strncpy(member.name, "기록회원", sizeof(member.name) - 1);
+        strncpy(member.email, "trace@example.com", sizeof(member.email) - 1);
+        strncpy(member.phone, "010-1234-5678", sizeof(member.phone) - 1);
+        member.is_active = TRUE;
+        member_id = add_member(db, &member);
+        ASSERT_GT(member_id, 0);
+    }
+
+    void TearDown() override {
+        if (workload_trace_is_active()) {
+            workload_trace_stop();
+        }
+        calendar_invalidate_cache();
+        if (db) {
+            database_close(db);
+        }
+        remove_test_files();
+    }
+
+    void remove_test_files() {
+        for (const std::string &path : { std::string(test_db_path), trace_path, snapshot_path,
+                                         std::string(work_db_path) }) {
+            if (std::filesystem::exists(path)) {
+                std::filesystem::remove(path);
+            }
+            std::filesystem::remove(path + BACKUP_CHECKSUM_SUFFIX);
+        }
+    }
+
+    int add_test_book(const char *isbn) {
+        Book book;
+        memset(&book, 0, sizeof(Book));
+        strncpy(book.title, "기록 도서", sizeof(book.title) - 1);
+        strncpy(book.author, "기록 저자", sizeof(book.author) - 1);
+        strncpy(book.isbn, isbn, sizeof(book.isbn) - 1);
+        strncpy(book.category, "소설", sizeof(book.category) - 1);
+        book.publication_year = 2020;
+        book.total_copies = 3;
+        book.available_copies = 3;
+        return add_book(db, &book);
+    }
+
+    std::vector<MetricId> read_apis() {
+        std::vector<MetricId> apis;
+        TraceReader reader;
+        TraceRecord record;
+        if (workload_trace_open(&reader, trace_path.c_str()) != SUCCESS) {
+            return apis;
+        }
+        while (workload_trace_next(&reader, &record) == TRUE) {
+            apis.push_back(record.api);
+        }
+        workload_trace_close(&reader);
+        return apis;
+    }
+
+    sqlite3 *db = nullptr;
+    const char *test_db_path;
+    std::string trace_path;
+    std::string snapshot_path;
+    const char *work_db_path;
+    int book_id = 0;
+    int member_id = 0;
+};
+
+// 기록한 호출의 API, 인자, 반환값이 그대로 읽혀야 함
+TEST_F(WorkloadTraceTest, RecordsRoundTrip) {
+    ASSERT_EQ(workload_trace_start(trace_path.c_str(), nullptr), SUCCESS);
+    EXPECT_EQ(workload_trace_is_active(), TRUE);
+
+    int new_book_id = add_test_book("9788932917245");
+    ASSERT_GT(new_book_id, 0);
+    BookSearchResult books;
+    init_book_search_result(&books);
+    search_books_by_title(db, "기록", &books);
+    free_book_search_result(&books);
+    EXPECT_EQ(get_book_by_isbn(db, nullptr, nullptr), FAILURE);
+
+    long long dropped = -1;
+    EXPECT_EQ(workload_trace_get_count(&dropped), 3);
+    EXPECT_EQ(dropped, 0);
+    ASSERT_EQ(workload_trace_stop(), SUCCESS);
+    EXPECT_EQ(workload_trace_is_active(), FALSE);
+
+    TraceReader reader;
+    TraceRecord record;
+    ASSERT_EQ(workload_trace_open(&reader, trace_path.c_str()), SUCCESS);
+    EXPECT_EQ(reader.version, WORKLOAD_TRACE_VERSION);
+
+    ASSERT_EQ(workload_trace_next(&reader, &record), TRUE);
+    EXPECT_EQ(record.api, METRIC_ADD_BOOK);
+    EXPECT_EQ(record.result, new_book_id);
+    EXPECT_EQ(record.thread, 1);
+    ASSERT_EQ(record.arg_count, 9);
+    EXPECT_STREQ(record.args[1].string, "기록 도서");
+    EXPECT_STREQ(record.args[3].string, "9788932917245");
+    EXPECT_EQ(record.args[5].integer, 2020);
+    EXPECT_EQ(record.args[6].integer, 3);
+    long long first_start = record.start_offset_ns;
+    EXPECT_GE(record.latency_ns, 0);
+
+    ASSERT_EQ(workload_trace_next(&reader, &record), TRUE);
+    EXPECT_EQ(record.api, METRIC_SEARCH_BOOKS_BY_TITLE);
+    ASSERT_EQ(record.arg_count, 1);
+    EXPECT_EQ(record.args[0].type, TRACE_ARG_STRING);
+    EXPECT_STREQ(record.args[0].string, "기록");
+    EXPECT_GE(record.start_offset_ns, first_start);
+
+    ASSERT_EQ(workload_trace_next(&reader, &record), TRUE);
+    EXPECT_EQ(record.api, METRIC_GET_BOOK_BY_ISBN);
+    EXPECT_EQ(record.result, FAILURE);
+    ASSERT_EQ(record.arg_count, 1);
+    EXPECT_EQ(record.args[0].string, nullptr);
+
+    EXPECT_EQ(workload_trace_next(&reader, &record), FALSE);
+    workload_trace_close(&reader);
+}
+
+// 다른 API 안에서 부른 API는 기록하지 않아야 함
+TEST_F(WorkloadTraceTest, NestedCallsAreRecordedOnce) {
+    int loan_id = loan_book(db, book_id, member_id, 14);
+    ASSERT_GT(loan_id, 0);
+
+    ASSERT_EQ(workload_trace_start(trace_path.c_str(), nullptr), SUCCESS);
+    ASSERT_EQ(return_book(db, loan_id), SUCCESS);
+    ASSERT_EQ(workload_trace_stop(), SUCCESS);
+
+    std::vector<MetricId> apis = read_apis();
+    ASSERT_EQ(apis.size(), 1u);
+    EXPECT_EQ(apis[0], METRIC_RETURN_BOOK);
+}
+
+// 기록 중이 아닐 때의 호출은 무시되어야 함
+TEST_F(WorkloadTraceTest, InactiveTraceRecordsNothing) {
+    EXPECT_EQ(workload_trace_is_active(), FALSE);
+    EXPECT_EQ(workload_trace_stop(), FAILURE);
+
+    ASSERT_EQ(workload_trace_start(trace_path.c_str(), nullptr), SUCCESS);
+    EXPECT_EQ(workload_trace_start(trace_path.c_str(), nullptr), FAILURE);
+    ASSERT_EQ(workload_trace_stop(), SUCCESS);
+
+    Book book;
+    EXPECT_EQ(get_book_by_id(db, book_id, &book), SUCCESS);
+    EXPECT_TRUE(read_apis().empty());
+    EXPECT_EQ(workload_trace_get_count(nullptr), 0);
+}
+
+// 시작 시점 사본에 재실행하면 반환값이 모두 같아야 함
+TEST_F(WorkloadTraceTest, ReplayOnSnapshotMatchesResults) {
+    ASSERT_EQ(workload_trace_start(trace_path.c_str(), db), SUCCESS);
+    ASSERT_TRUE(std::filesystem::exists(snapshot_path));
+
+    int new_book_id = add_test_book("9788932917245");
+    ASSERT_GT(new_book_id, 0);
+    int loan_id = loan_book(db, new_book_id, member_id, 14);
+    ASSERT_GT(loan_id, 0);
+    EXPECT_EQ(extend_loan(db, loan_id, 7), SUCCESS);
+    EXPECT_EQ(return_book_by_ids(db, new_book_id, member_id), SUCCESS);
+    EXPECT_EQ(return_book(db, loan_id), FAILURE);
+    EXPECT_GT(loan_book_idempotent(db, "trace-req-1", book_id, member_id, 14), 0);
+    EXPECT_EQ(check_loan_availability(db, book_id, member_id), FAILURE);
+    ASSERT_EQ(workload_trace_stop(), SUCCESS);
+
+    // 사본을 작업용 데이터베이스로 복사해 재실행
+    sqlite3 *snapshot = database_init(snapshot_path.c_str());
+    ASSERT_NE(snapshot, nullptr);
+    ASSERT_EQ(database_backup(snapshot, work_db_path), SUCCESS);
+    database_close(snapshot);
+
+    sqlite3 *work = database_init(work_db_path);
+    ASSERT_NE(work, nullptr);
+    WorkloadReplayReport report;
+    ASSERT_EQ(workload_replay(work, trace_path.c_str(), WORKLOAD_REPLAY_FAST, 1.0, &report), SUCCESS);
+
+    EXPECT_EQ(report.replayed, 7);
+    EXPECT_EQ(report.result_mismatches, 0);
+    EXPECT_EQ(report.apis[METRIC_ADD_BOOK].captured.count, 1);
+    EXPECT_EQ(report.apis[METRIC_ADD_BOOK].replayed.count, 1);
+    EXPECT_EQ(report.apis[METRIC_RETURN_BOOK].replayed.failures, 1);
+    EXPECT_GT(report.captured_seconds, 0.0);
+
+    Book replayed_book;
+    EXPECT_EQ(get_book_by_id(work, new_book_id, &replayed_book), SUCCESS);
+    EXPECT_EQ(replayed_book.available_copies, 3);
+    database_close(work);
+
+    FILE *output = tmpfile();
+    ASSERT_NE(output, nullptr);
+    EXPECT_EQ(workload_replay_print_report(output, &report), 7);
+    fclose(output);
+}
+
+// 형식이 다른 파일은 열지 않고, 잘린 레코드는 손상으로 처리해야 함
+TEST_F(WorkloadTraceTest, RejectsCorruptFiles) {
+    FILE *file = fopen(trace_path.c_str(), "wb");
+    ASSERT_NE(file, nullptr);
+    fputs("NOTATRACE", file);
+    fclose(file);
+
+    TraceReader reader;
+    EXPECT_EQ(workload_trace_open(&reader, trace_path.c_str()), FAILURE);
+
+    ASSERT_EQ(workload_trace_start(trace_path.c_str(), nullptr), SUCCESS);
+    add_test_book("9788932917245");
+    ASSERT_EQ(workload_trace_stop(), SUCCESS);
+    std::filesystem::resize_file(trace_path, std::filesystem::file_size(trace_path) - 3);
+
+    TraceRecord record;
+    ASSERT_EQ(workload_trace_open(&reader, trace_path.c_str()), SUCCESS);
+    EXPECT_EQ(workload_trace_next(&reader, &record), FAILURE);
+    workload_trace_close(&reader);
+}
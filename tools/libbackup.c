@@ -0,0 +1,307 @@
+/**
+ * @file libbackup.c
+ * @brief 중복 제거 백업 저장소 관리, 백업 검사와 시점 복구 도구
+ *
+ * 사용 예:
+ *   libbackup create -d library.db                 (매일 cron으로 실행)
+ *   libbackup list
+ *   libbackup restore 20250301_020000 -o restored.db
+ *   libbackup delete 20250101_020000 && libbackup gc
+ *   libbackup verify backups/library_backup_20250301.db --quick-check
+ *   libbackup journal on -d library.db
+ *   libbackup pitr backups/library_backup_20250301.db -t "2025-03-01 14:29:00" --dry-run
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <locale.h>
+#include <dirent.h>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+#include "../include/database.h"
+#include "../include/backup.h"
+#include "../include/backup_store.h"
+#include "../include/change_log.h"
+#include "../include/crc32c.h"
+#include "../include/utils.h"
+
+static void print_usage(const char *program) {
+    fprintf(stderr, "사용법: %s COMMAND [NAME] [옵션]\n", program);
+    fprintf(stderr, "  create [-n NAME]         데이터베이스를 저장소에 백업 (이름 기본: 현재 시각)\n");
+    fprintf(stderr, "  list                     백업 목록 (오래된 것부터)\n");
+    fprintf(stderr, "  restore NAME -o PATH     백업을 데이터베이스 파일로 복원\n");
+    fprintf(stderr, "  delete NAME              백업 목록 삭제 (조각은 gc로 정리)\n");
+    fprintf(stderr, "  gc                       어느 백업도 쓰지 않는 조각 삭제\n");
+    fprintf(stderr, "  verify FILE              백업 파일을 페이지별 체크섬 목록(%s)과 비교\n", BACKUP_CHECKSUM_SUFFIX);
+    fprintf(stderr, "  journal on|off|status    시점 복구용 변경 기록 켜기/끄기/상태\n");
+    fprintf(stderr, "  journal prune -b TIME    TIME 전의 변경 기록 삭제\n");
+    fprintf(stderr, "  pitr FILE|DIR -t TIME    백업에 변경 기록을 TIME까지 적용해 데이터베이스를 되돌림\n");
+    fprintf(stderr, "                           (DIR이면 그 안에서 TIME에 가장 가까운 백업을 사용)\n");
+    fprintf(stderr, "옵션:\n");
+    fprintf(stderr, "  -r, --repository DIR     저장소 디렉터리 (기본: %s)\n", BACKUP_STORE_DEFAULT_PATH);
+    fprintf(stderr, "  -d, --database PATH      백업할 데이터베이스 (기본: %s)\n", DATABASE_PATH);
+    fprintf(stderr, "  -n, --name NAME          create할 백업 이름\n");
+    fprintf(stderr, "  -o, --output PATH        restore할 파일, pitr 결과를 데이터베이스 대신 저장할 파일\n");
+    fprintf(stderr, "  -q, --quick-check        verify 후 PRAGMA quick_check도 실행\n");
+    fprintf(stderr, "  -t, --to TIME            pitr 목표 시각 'YYYY-MM-DD HH:MM:SS' (UTC)\n");
+    fprintf(stderr, "  -b, --before TIME        journal prune 기준 시각 (UTC)\n");
+    fprintf(stderr, "      --dry-run            pitr에서 바꾸지 않고 적용할 변경 수만 출력\n");
+    fprintf(stderr, "  -h, --help               도움말\n");
+}
+
+static void print_stats(const char *action, const BackupStoreStats *stats) {
+    double mb = stats->bytes / (1024.0 * 1024.0);
+    printf("%s: 조각 %lld개 (%.1f MB), 새 조각 %lld개 (%.1f MB), %.2f초 (%.1f MB/s)\n", action,
+           stats->chunks, mb, stats->new_chunks, stats->new_bytes / (1024.0 * 1024.0),
+           stats->elapsed_seconds, stats->elapsed_seconds > 0 ? mb / stats->elapsed_seconds : 0.0);
+}
+
+static int run_create(const char *database_path, const char *repository, const char *name) {
+    sqlite3 *db = database_init(database_path);
+    if (!db) {
+        fprintf(stderr, "데이터베이스를 열 수 없습니다: %s\n", database_path);
+        return FAILURE;
+    }
+    BackupStoreStats stats;
+    int status = backup_store_create(db, repository, name, &stats);
+    database_close(db);
+    if (status == SUCCESS) {
+        print_stats("백업", &stats);
+    }
+    return status;
+}
+
+static int run_list(const char *repository) {
+    char **names = NULL;
+    int count = 0;
+    if (backup_store_list(repository, &names, &count) != SUCCESS) {
+        return FAILURE;
+    }
+    for (int i = 0; i < count; i++) {
+        BackupManifest manifest;
+        if (backup_manifest_load(repository, names[i], &manifest) == SUCCESS) {
+            printf("%-24s %s UTC  %10.1f MB  조각 %d개\n", manifest.name, manifest.created_at,
+                   manifest.file_size / (1024.0 * 1024.0), manifest.chunk_count);
+            backup_manifest_free(&manifest);
+        }
+        free(names[i]);
+    }
+    free(names);
+    if (count == 0) {
+        printf("백업이 없습니다.\n");
+    }
+    return SUCCESS;
+}
+
+static int run_verify(const char *backup_path, int quick_check) {
+    BackupVerifyResult result;
+    int status = backup_verify(backup_path, quick_check, &result);
+    double mb = result.bytes / (1024.0 * 1024.0);
+    printf("검사: %d페이지 (%.1f MB), 불일치 %d개, %.2f초 (%.1f MB/s, CRC32C %s)\n", result.page_count, mb,
+           result.bad_pages, result.elapsed_seconds, result.elapsed_seconds > 0 ? mb / result.elapsed_seconds : 0.0,
+           crc32c_implementation());
+    if (result.quick_check != -1) {
+        printf("PRAGMA quick_check: %s\n", result.quick_check ? "ok" : "실패");
+    }
+    printf("%s\n", status == SUCCESS ? "정상" : "손상됨");
+    return status;
+}
+
+static int run_journal(const char *database_path, const char *action, const char *before_time) {
+    sqlite3 *db = database_init(database_path);
+    if (!db) {
+        fprintf(stderr, "데이터베이스를 열 수 없습니다: %s\n", database_path);
+        return FAILURE;
+    }
+
+    int status = FAILURE;
+    if (strcmp(action, "on") == 0) {
+        status = change_log_enable(db);
+    } else if (strcmp(action, "off") == 0) {
+        status = change_log_disable(db);
+    } else if (strcmp(action, "prune") == 0 && before_time) {
+        long long deleted = 0;
+        status = change_log_prune(db, before_time, &deleted);
+        if (status == SUCCESS) {
+            printf("변경 기록 %lld건을 지웠습니다.\n", deleted);
+        }
+    } else if (strcmp(action, "status") != 0) {
+        fprintf(stderr, "journal 명령은 on, off, status, prune -b TIME 중 하나입니다.\n");
+        database_close(db);
+        return FAILURE;
+    } else {
+        status = SUCCESS;
+    }
+
+    ChangeLogStatus log_status;
+    if (status == SUCCESS && change_log_get_status(db, &log_status) == SUCCESS) {
+        printf("변경 기록: %s", log_status.enabled ? "켜짐" : "꺼짐");
+        if (log_status.epoch[0] != '\0') {
+            printf(" (에포크 %s, %s UTC부터)", log_status.epoch, log_status.enabled_at);
+        }
+        printf("\n");
+        if (log_status.entries > 0) {
+            printf("보관 중: %lld건, #%lld %s ~ #%lld %s UTC\n", log_status.entries, log_status.first_seq,
+                   log_status.first_time, log_status.last_seq, log_status.last_time);
+        }
+    }
+    database_close(db);
+    return status;
+}
+
+static int run_pitr(const char *database_path, const char *backup_path, const char *target_time,
+                    const char *output_path, int dry_run) {
+    sqlite3 *db = database_init(database_path);
+    if (!db) {
+        fprintf(stderr, "데이터베이스를 열 수 없습니다: %s\n", database_path);
+        return FAILURE;
+    }
+
+    // 디렉터리를 주면 목표 시각에 가장 가까운 백업을 고름
+    char nearest_path[MAX_PATH_LENGTH];
+    DIR *directory = opendir(backup_path);
+    if (directory) {
+        closedir(directory);
+        if (change_log_find_backup(db, backup_path, target_time, nearest_path, sizeof(nearest_path)) != SUCCESS) {
+            database_close(db);
+            return FAILURE;
+        }
+        backup_path = nearest_path;
+    }
+
+    ChangeLogRecoverOptions options;
+    change_log_default_options(&options);
+    options.dry_run = dry_run;
+    options.output_path = output_path;
+    ChangeLogRecoverReport report;
+    int status = change_log_recover(db, backup_path, target_time, &options, &report);
+    database_close(db);
+    if (status != SUCCESS) {
+        return FAILURE;
+    }
+
+    printf("백업: %s, #%lld (%s UTC)\n", backup_path, report.backup_seq, report.backup_time);
+    for (int i = 0; i < report.table_count; i++) {
+        const ChangeLogTableCount *table = &report.tables[i];
+        printf("  %-20s 추가 %lld, 수정 %lld, 삭제 %lld\n", table->table_name,
+               table->inserts, table->updates, table->deletes);
+    }
+    printf("%s: 변경 %lld건 (#%lld %s UTC까지), 목표 시각 이후 %lld건 버림",
+           dry_run ? "적용 예정" : "적용", report.applied, report.last_seq, report.last_time, report.skipped);
+    if (!dry_run) {
+        printf(", 트랜잭션 %d개, %.2f초", report.batches, report.elapsed_seconds);
+    }
+    printf("\n");
+    if (!dry_run) {
+        printf("%s에 저장했습니다.\n", output_path ? output_path : database_path);
+    }
+    return SUCCESS;
+}
+
+int main(int argc, char *argv[]) {
+#ifdef _WIN32
+    SetConsoleCP(CP_UTF8);
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+    setlocale(LC_ALL, "ko_KR.UTF-8");
+
+    const char *command = NULL;
+    const char *target = NULL;
+    const char *repository = BACKUP_STORE_DEFAULT_PATH;
+    const char *database_path = DATABASE_PATH;
+    const char *name = NULL;
+    const char *output_path = NULL;
+    const char *target_time = NULL;
+    const char *before_time = NULL;
+    int quick_check = FALSE;
+    int dry_run = FALSE;
+
+    for (int i = 1; i < argc; i++) {
+        const char *option = argv[i];
+        const char *value = i + 1 < argc ? argv[i + 1] : NULL;
+        const char **slot = NULL;
+
+        if (strcmp(option, "-r") == 0 || strcmp(option, "--repository") == 0) {
+            slot = &repository;
+        } else if (strcmp(option, "-d") == 0 || strcmp(option, "--database") == 0) {
+            slot = &database_path;
+        } else if (strcmp(option, "-n") == 0 || strcmp(option, "--name") == 0) {
+            slot = &name;
+        } else if (strcmp(option, "-o") == 0 || strcmp(option, "--output") == 0) {
+            slot = &output_path;
+        } else if (strcmp(option, "-t") == 0 || strcmp(option, "--to") == 0) {
+            slot = &target_time;
+        } else if (strcmp(option, "-b") == 0 || strcmp(option, "--before") == 0) {
+            slot = &before_time;
+        } else if (strcmp(option, "-q") == 0 || strcmp(option, "--quick-check") == 0) {
+            quick_check = TRUE;
+            continue;
+        } else if (strcmp(option, "--dry-run") == 0) {
+            dry_run = TRUE;
+            continue;
+        } else if (strcmp(option, "-h") == 0 || strcmp(option, "--help") == 0) {
+            print_usage(argv[0]);
+            return EXIT_SUCCESS;
+        } else if (option[0] != '-' && !command) {
+            command = option;
+            continue;
+        } else if (option[0] != '-' && !target) {
+            target = option;
+            continue;
+        } else {
+            fprintf(stderr, "알 수 없는 옵션입니다: %s\n", option);
+            print_usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+
+        if (!value) {
+            fprintf(stderr, "%s 옵션의 값이 없습니다.\n", option);
+            return EXIT_FAILURE;
+        }
+        *slot = value;
+        i++;
+    }
+
+    if (!command) {
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    // 로그는 표준 출력으로 나가므로 결과에 섞이지 않도록 오류만 남김
+    set_log_level(LOG_ERROR);
+
+    int status;
+    if (strcmp(command, "create") == 0) {
+        status = run_create(database_path, repository, name);
+    } else if (strcmp(command, "list") == 0) {
+        status = run_list(repository);
+    } else if (strcmp(command, "restore") == 0 && target && output_path) {
+        BackupStoreStats stats;
+        status = backup_store_restore(repository, target, output_path, &stats);
+        if (status == SUCCESS) {
+            print_stats("복원", &stats);
+        }
+    } else if (strcmp(command, "delete") == 0 && target) {
+        status = backup_store_delete(repository, target);
+    } else if (strcmp(command, "gc") == 0) {
+        BackupStoreStats stats;
+        status = backup_store_gc(repository, &stats);
+        if (status == SUCCESS) {
+            printf("정리: 남은 조각 %lld개, 지운 조각 %lld개 (%.1f MB), %.2f초\n", stats.chunks,
+                   stats.new_chunks, stats.new_bytes / (1024.0 * 1024.0), stats.elapsed_seconds);
+        }
+    } else if (strcmp(command, "verify") == 0 && target) {
+        status = run_verify(target, quick_check);
+    } else if (strcmp(command, "journal") == 0 && target) {
+        status = run_journal(database_path, target, before_time);
+    } else if (strcmp(command, "pitr") == 0 && target && target_time) {
+        status = run_pitr(database_path, target, target_time, output_path, dry_run);
+    } else {
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    return status == SUCCESS ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,136 @@
+/**
+ * @file libexport.c
+ * @brief 도서/회원/대출을 CSV, NDJSON 또는 Arrow IPC로 내보내는 도구
+ *
+ * 사용 예:
+ *   libexport books -o books.csv
+ *   libexport loan_details -f ndjson --from 2025-01-01 --to 2025-03-31 > q1.ndjson
+ *   libexport members -d library_1m.db -f csv | gzip > members.csv.gz
+ *   libexport snapshot -f arrow -o snapshot_2025q1
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <locale.h>
+#ifdef _WIN32
+#include <windows.h>
+#include <fcntl.h>
+#include <io.h>
+#endif
+#include "../include/database.h"
+#include "../include/data_export.h"
+#include "../include/utils.h"
+
+static void print_usage(const char *program) {
+    fprintf(stderr, "사용법: %s ENTITY [옵션]\n", program);
+    fprintf(stderr, "  ENTITY                   books, members, loans, loan_details 중 하나,\n");
+    fprintf(stderr, "                           또는 snapshot (도서/회원/대출을 같은 시점으로 -o 디렉터리에)\n");
+    fprintf(stderr, "  -d, --database PATH      데이터베이스 파일 (기본: %s)\n", DATABASE_PATH);
+    fprintf(stderr, "  -f, --format FORMAT      csv, ndjson 또는 arrow (기본: csv)\n");
+    fprintf(stderr, "  -o, --output PATH        출력 파일 (기본: - = 표준 출력)\n");
+    fprintf(stderr, "      --from YYYY-MM-DD    이 날짜부터 (도서: 등록일, 회원: 가입일, 대출: 대출일)\n");
+    fprintf(stderr, "      --to YYYY-MM-DD      이 날짜까지 포함\n");
+    fprintf(stderr, "  -h, --help               도움말\n");
+}
+
+// 기간 옵션 값을 설정에 복사 (형식 검사는 data_export가 함)
+static int copy_date(char *dest, const char *value) {
+    if (!value || strlen(value) >= DATA_EXPORT_DATE_LENGTH) {
+        return FAILURE;
+    }
+    strcpy(dest, value);
+    return SUCCESS;
+}
+
+int main(int argc, char *argv[]) {
+#ifdef _WIN32
+    SetConsoleCP(CP_UTF8);
+    SetConsoleOutputCP(CP_UTF8);
+    // 표준 출력으로 보낼 때 줄바꿈이 CRLF로 바뀌지 않도록
+    _setmode(_fileno(stdout), _O_BINARY);
+#endif
+    setlocale(LC_ALL, "ko_KR.UTF-8");
+
+    const char *entity_name = NULL;
+    const char *database_path = DATABASE_PATH;
+    const char *output_path = "-";
+    DataExportOptions options;
+    memset(&options, 0, sizeof(DataExportOptions));
+    options.format = DATA_EXPORT_CSV;
+
+    for (int i = 1; i < argc; i++) {
+        const char *option = argv[i];
+        const char *value = i + 1 < argc ? argv[i + 1] : NULL;
+        int status = SUCCESS;
+        int takes_value = TRUE;
+
+        if (strcmp(option, "-d") == 0 || strcmp(option, "--database") == 0) {
+            database_path = value;
+            status = value ? SUCCESS : FAILURE;
+        } else if (strcmp(option, "-f") == 0 || strcmp(option, "--format") == 0) {
+            status = data_export_parse_format(value, &options.format);
+        } else if (strcmp(option, "-o") == 0 || strcmp(option, "--output") == 0) {
+            output_path = value;
+            status = value ? SUCCESS : FAILURE;
+        } else if (strcmp(option, "--from") == 0) {
+            status = copy_date(options.from_date, value);
+        } else if (strcmp(option, "--to") == 0) {
+            status = copy_date(options.to_date, value);
+        } else if (strcmp(option, "-h") == 0 || strcmp(option, "--help") == 0) {
+            print_usage(argv[0]);
+            return EXIT_SUCCESS;
+        } else if (option[0] != '-' && !entity_name) {
+            entity_name = option;
+            takes_value = FALSE;
+        } else {
+            fprintf(stderr, "알 수 없는 옵션입니다: %s\n", option);
+            print_usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+
+        if (status != SUCCESS) {
+            fprintf(stderr, "%s 옵션의 값이 올바르지 않습니다.\n", option);
+            return EXIT_FAILURE;
+        }
+        if (takes_value) {
+            i++;
+        }
+    }
+
+    int snapshot = entity_name && strcmp(entity_name, "snapshot") == 0;
+    if (snapshot && (strcmp(output_path, "-") == 0 || options.from_date[0] || options.to_date[0])) {
+        fprintf(stderr, "snapshot은 -o 디렉터리가 필요하고 기간을 지정할 수 없습니다.\n");
+        return EXIT_FAILURE;
+    }
+    if (!entity_name || (!snapshot && data_export_parse_entity(entity_name, &options.entity) != SUCCESS)) {
+        if (entity_name) {
+            fprintf(stderr, "알 수 없는 대상입니다: %s\n", entity_name);
+        }
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    // 로그는 표준 출력으로 나가므로 내보낸 데이터에 섞이지 않도록 오류만 남김
+    set_log_level(LOG_ERROR);
+
+    sqlite3 *db = database_init(database_path);
+    if (!db) {
+        fprintf(stderr, "데이터베이스를 열 수 없습니다: %s\n", database_path);
+        return EXIT_FAILURE;
+    }
+
+    long long rows = 0;
+    long long start_ns = timer_now_nanoseconds();
+    int status = snapshot ? data_export_snapshot(db, options.format, output_path, &rows)
+                          : data_export_to_path(db, &options, output_path, &rows);
+    database_close(db);
+
+    if (status != SUCCESS) {
+        fprintf(stderr, "내보내기에 실패했습니다.\n");
+        return EXIT_FAILURE;
+    }
+    fprintf(stderr, "%s %lld행을 내보냈습니다 (%.2f초).\n", entity_name, rows,
+            (timer_now_nanoseconds() - start_ns) / 1e9);
+    return EXIT_SUCCESS;
+}
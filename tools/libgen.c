@@ -0,0 +1,164 @@
+/**
+ * @file libgen.c
+ * @brief 규모 시험용 합성 도서관 데이터베이스 생성 도구
+ *
+ * 사용 예:
+ *   libgen -o library.db -b 1000000 -s 42
+ *   libgen -o small.db -b 5000 -l 20000 --as-of 2025-01-01 --no-events
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <locale.h>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+#include "../include/database.h"
+#include "../include/dataset_generator.h"
+#include "../include/utils.h"
+
+static void print_usage(const char *program) {
+    printf("사용법: %s [옵션]\n", program);
+    printf("  -o, --output PATH        생성할 데이터베이스 파일 (기본: library.db)\n");
+    printf("  -b, --books N            도서 수 (기본: %d)\n", DATASET_DEFAULT_BOOKS);
+    printf("  -m, --members N          회원 수 (기본: 도서 수 / %d)\n", DATASET_MEMBERS_PER_BOOK_RATIO);
+    printf("  -l, --loans N            대출 기록 수 (기본: 도서 수 x %d)\n", DATASET_LOANS_PER_BOOK);
+    printf("  -y, --years N            대출 이력 기간 (기본: %d년)\n", DATASET_DEFAULT_YEARS);
+    printf("  -s, --seed N             난수 시드 (기본: 1)\n");
+    printf("  -z, --zipf S             도서 인기도 Zipf 지수 (기본: %.1f)\n", DATASET_DEFAULT_ZIPF_EXPONENT);
+    printf("  -p, --overdue-percent N  연체 후 반납 비율 %% (기본: %d)\n", DATASET_DEFAULT_OVERDUE_PERCENT);
+    printf("      --as-of YYYY-MM-DD   기준 날짜 (기본: 현재 시각, 같은 시드로 같은 결과를 얻으려면 지정)\n");
+    printf("      --no-events          loan_events 기록 생략\n");
+    printf("  -h, --help               도움말\n");
+}
+
+// 옵션 값이 양의 정수인지 확인하여 읽음
+static int parse_count(const char *option, const char *value, long long *result) {
+    char *end = NULL;
+    long long parsed = value ? strtoll(value, &end, 10) : 0;
+
+    if (!value || *end != '\0' || parsed < 0) {
+        fprintf(stderr, "%s 옵션에는 0 이상의 정수가 필요합니다: %s\n", option, value ? value : "(없음)");
+        return FAILURE;
+    }
+    *result = parsed;
+    return SUCCESS;
+}
+
+int main(int argc, char *argv[]) {
+#ifdef _WIN32
+    SetConsoleCP(CP_UTF8);
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+    setlocale(LC_ALL, "ko_KR.UTF-8");
+
+    const char *output_path = "library.db";
+    long long books = DATASET_DEFAULT_BOOKS;
+    long long members = -1;
+    long long loans = -1;
+    long long years = DATASET_DEFAULT_YEARS;
+    long long seed = 1;
+    long long overdue_percent = DATASET_DEFAULT_OVERDUE_PERCENT;
+    double zipf_exponent = DATASET_DEFAULT_ZIPF_EXPONENT;
+    const char *as_of = NULL;
+    int write_events = TRUE;
+
+    for (int i = 1; i < argc; i++) {
+        const char *option = argv[i];
+        const char *value = i + 1 < argc ? argv[i + 1] : NULL;
+        int status = SUCCESS;
+        int takes_value = TRUE;
+
+        if (strcmp(option, "-o") == 0 || strcmp(option, "--output") == 0) {
+            output_path = value;
+            status = value ? SUCCESS : FAILURE;
+        } else if (strcmp(option, "-b") == 0 || strcmp(option, "--books") == 0) {
+            status = parse_count(option, value, &books);
+        } else if (strcmp(option, "-m") == 0 || strcmp(option, "--members") == 0) {
+            status = parse_count(option, value, &members);
+        } else if (strcmp(option, "-l") == 0 || strcmp(option, "--loans") == 0) {
+            status = parse_count(option, value, &loans);
+        } else if (strcmp(option, "-y") == 0 || strcmp(option, "--years") == 0) {
+            status = parse_count(option, value, &years);
+        } else if (strcmp(option, "-s") == 0 || strcmp(option, "--seed") == 0) {
+            status = parse_count(option, value, &seed);
+        } else if (strcmp(option, "-p") == 0 || strcmp(option, "--overdue-percent") == 0) {
+            status = parse_count(option, value, &overdue_percent);
+        } else if (strcmp(option, "-z") == 0 || strcmp(option, "--zipf") == 0) {
+            char *end = NULL;
+            zipf_exponent = value ? strtod(value, &end) : -1.0;
+            status = value && *end == '\0' && zipf_exponent >= 0 ? SUCCESS : FAILURE;
+        } else if (strcmp(option, "--as-of") == 0) {
+            as_of = value;
+            status = value && is_valid_date_format(value, "%Y-%m-%d") ? SUCCESS : FAILURE;
+        } else if (strcmp(option, "--no-events") == 0) {
+            write_events = FALSE;
+            takes_value = FALSE;
+        } else if (strcmp(option, "-h") == 0 || strcmp(option, "--help") == 0) {
+            print_usage(argv[0]);
+            return EXIT_SUCCESS;
+        } else {
+            fprintf(stderr, "알 수 없는 옵션입니다: %s\n", option);
+            print_usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+
+        if (status != SUCCESS) {
+            fprintf(stderr, "%s 옵션의 값이 올바르지 않습니다.\n", option);
+            return EXIT_FAILURE;
+        }
+        if (takes_value) {
+            i++;
+        }
+    }
+
+    DatasetGeneratorConfig config;
+    dataset_generator_default_config(&config, (int)books);
+    if (members >= 0) {
+        config.member_count = (int)members;
+    }
+    config.loan_count = loans >= 0 ? loans : (long long)config.book_count * DATASET_LOANS_PER_BOOK;
+    config.years = (int)years;
+    config.seed = (unsigned long long)seed;
+    config.zipf_exponent = zipf_exponent;
+    config.overdue_percent = (int)overdue_percent;
+    config.write_events = write_events;
+    if (as_of) {
+        config.as_of = string_to_time(as_of, "%Y-%m-%d");
+    }
+
+    // 생성 중 정보 로그는 필요 없으므로 경고 이상만 출력
+    set_log_level(LOG_WARNING);
+
+    sqlite3 *db = database_init(output_path);
+    if (!db) {
+        fprintf(stderr, "데이터베이스를 열 수 없습니다: %s\n", output_path);
+        return EXIT_FAILURE;
+    }
+
+    printf("%s 생성 중: 도서 %d권, 회원 %d명, 대출 %lld건 (시드 %llu)\n",
+           output_path, config.book_count, config.member_count, config.loan_count, config.seed);
+
+    DatasetGeneratorStats stats;
+    int status = dataset_generate(db, &config, &stats);
+    database_close(db);
+
+    if (status != SUCCESS) {
+        fprintf(stderr, "데이터 생성에 실패했습니다.\n");
+        return EXIT_FAILURE;
+    }
+
+    long long rows = stats.books + stats.members + stats.loans + stats.events;
+    double minutes = stats.elapsed_seconds / 60.0;
+
+    printf("도서 %lld권, 회원 %lld명, 대출 %lld건 (연장 %lld회, 대출 중 %lld건, 연체 %lld건), 이벤트 %lld건\n",
+           stats.books, stats.members, stats.loans, stats.renewals,
+           stats.open_loans, stats.overdue_loans, stats.events);
+    if (stats.skipped_loans > 0) {
+        printf("남는 사본/대출 한도가 없어 만들지 못한 대출: %lld건\n", stats.skipped_loans);
+    }
+    printf("%.1f초, 분당 %.0f행\n", stats.elapsed_seconds, minutes > 0 ? rows / minutes : 0.0);
+
+    return EXIT_SUCCESS;
+}
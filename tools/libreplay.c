@@ -0,0 +1,149 @@
+/**
+ * @file libreplay.c
+ * @brief 호출 기록(트레이스)을 데이터베이스 사본에 다시 실행해 지연 시간을 비교하는 도구
+ *
+ * 사용 예:
+ *   libreplay library.trace
+ *   libreplay library.trace --original-timing --speed 2
+ *   libreplay library.trace -d snapshot.db -o work.db
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <locale.h>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+#include "../include/database.h"
+#include "../include/workload_replay.h"
+#include "../include/utils.h"
+
+static void print_usage(const char *program) {
+    printf("사용법: %s TRACE [옵션]\n", program);
+    printf("  -d, --snapshot PATH      기록 시작 시점 데이터베이스 사본 (기본: TRACE%s)\n",
+           WORKLOAD_TRACE_SNAPSHOT_SUFFIX);
+    printf("  -o, --output PATH        재실행할 작업용 데이터베이스 (기본: TRACE.replay%s, 있으면 덮어씀)\n",
+           WORKLOAD_TRACE_SNAPSHOT_SUFFIX);
+    printf("      --original-timing    기록된 호출 간격을 지켜 재실행\n");
+    printf("      --speed X            --original-timing 배속 (기본: 1.0)\n");
+    printf("  -h, --help               도움말\n");
+}
+
+int main(int argc, char *argv[]) {
+#ifdef _WIN32
+    SetConsoleCP(CP_UTF8);
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+    setlocale(LC_ALL, "ko_KR.UTF-8");
+
+    const char *trace_path = NULL;
+    const char *snapshot_path = NULL;
+    const char *work_path = NULL;
+    WorkloadReplayMode mode = WORKLOAD_REPLAY_FAST;
+    double speed = 1.0;
+
+    for (int i = 1; i < argc; i++) {
+        const char *option = argv[i];
+        const char *value = i + 1 < argc ? argv[i + 1] : NULL;
+        int status = SUCCESS;
+        int takes_value = TRUE;
+
+        if (strcmp(option, "-d") == 0 || strcmp(option, "--snapshot") == 0) {
+            snapshot_path = value;
+            status = value ? SUCCESS : FAILURE;
+        } else if (strcmp(option, "-o") == 0 || strcmp(option, "--output") == 0) {
+            work_path = value;
+            status = value ? SUCCESS : FAILURE;
+        } else if (strcmp(option, "--original-timing") == 0) {
+            mode = WORKLOAD_REPLAY_ORIGINAL;
+            takes_value = FALSE;
+        } else if (strcmp(option, "--speed") == 0) {
+            char *end = NULL;
+            speed = value ? strtod(value, &end) : -1.0;
+            status = value && *end == '\0' && speed > 0 ? SUCCESS : FAILURE;
+        } else if (strcmp(option, "-h") == 0 || strcmp(option, "--help") == 0) {
+            print_usage(argv[0]);
+            return EXIT_SUCCESS;
+        } else if (option[0] != '-' && !trace_path) {
+            trace_path = option;
+            takes_value = FALSE;
+        } else {
+            fprintf(stderr, "알 수 없는 옵션입니다: %s\n", option);
+            print_usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+
+        if (status != SUCCESS) {
+            fprintf(stderr, "%s 옵션의 값이 올바르지 않습니다.\n", option);
+            return EXIT_FAILURE;
+        }
+        if (takes_value) {
+            i++;
+        }
+    }
+
+    if (!trace_path) {
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    char default_snapshot[MAX_PATH_LENGTH];
+    char default_work[MAX_PATH_LENGTH];
+    snprintf(default_snapshot, sizeof(default_snapshot), "%s%s", trace_path, WORKLOAD_TRACE_SNAPSHOT_SUFFIX);
+    snprintf(default_work, sizeof(default_work), "%s.replay%s", trace_path, WORKLOAD_TRACE_SNAPSHOT_SUFFIX);
+    if (!snapshot_path) {
+        snapshot_path = default_snapshot;
+    }
+    if (!work_path) {
+        work_path = default_work;
+    }
+    if (strcmp(snapshot_path, work_path) == 0) {
+        fprintf(stderr, "사본과 작업용 데이터베이스는 서로 다른 파일이어야 합니다.\n");
+        return EXIT_FAILURE;
+    }
+
+    // 재실행 중 정보 로그는 필요 없으므로 경고 이상만 출력
+    set_log_level(LOG_WARNING);
+
+    // 사본은 그대로 두고 작업용 데이터베이스로 복사한 뒤 재실행
+    sqlite3 *snapshot = database_init(snapshot_path);
+    if (!snapshot) {
+        fprintf(stderr, "사본 데이터베이스를 열 수 없습니다: %s\n", snapshot_path);
+        return EXIT_FAILURE;
+    }
+    int status = database_backup(snapshot, work_path);
+    database_close(snapshot);
+    if (status != SUCCESS) {
+        fprintf(stderr, "작업용 데이터베이스를 만들 수 없습니다: %s\n", work_path);
+        return EXIT_FAILURE;
+    }
+    // 작업용 데이터베이스는 재실행으로 바뀌므로 체크섬 목록을 남기지 않음
+    char checksum_path[MAX_PATH_LENGTH + sizeof(BACKUP_CHECKSUM_SUFFIX)];
+    snprintf(checksum_path, sizeof(checksum_path), "%s%s", work_path, BACKUP_CHECKSUM_SUFFIX);
+    remove(checksum_path);
+
+    sqlite3 *db = database_init(work_path);
+    if (!db) {
+        fprintf(stderr, "작업용 데이터베이스를 열 수 없습니다: %s\n", work_path);
+        return EXIT_FAILURE;
+    }
+
+    printf("%s 재실행 중 (%s, 작업용 데이터베이스 %s)\n", trace_path,
+           mode == WORKLOAD_REPLAY_ORIGINAL ? "기록된 간격" : "최대 속도", work_path);
+
+    WorkloadReplayReport report;
+    status = workload_replay(db, trace_path, mode, speed, &report);
+    database_close(db);
+
+    if (status != SUCCESS) {
+        fprintf(stderr, "재실행에 실패했습니다.\n");
+        return EXIT_FAILURE;
+    }
+
+    workload_replay_print_report(stdout, &report);
+    printf("호출 %lld건, 기록 %.2f초, 재실행 %.2f초, 결과 차이 %lld건\n",
+           report.replayed, report.captured_seconds, report.replay_seconds, report.result_mismatches);
+
+    return report.result_mismatches > 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+}